@@ -12,6 +12,7 @@
 
 #include <array>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -26,7 +27,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 383
+#define ANGLE_SH_VERSION 386
 
 enum ShShaderSpec
 {
@@ -475,6 +476,14 @@ struct ShCompileOptions
 
     uint64_t transformFloatUniformTo16Bits : 1;
 
+    // Propagate constants through variables that are never written to and function parameters
+    // that receive the same constant at every call site, then prune the dead branches.
+    uint64_t propagateConstants : 1;
+
+    // Run a fast, targeted optimizer on the generated SPIR-V that eliminates redundant local loads
+    // and stores, unused local variables and functions, and duplicate types and constants.
+    uint64_t optimizeSPIRV : 1;
+
     ShCompileOptionsMetal metal;
     ShPixelLocalStorageOptions pls;
 };
@@ -761,6 +770,11 @@ struct ShBuiltInResources
 //
 using ShHandle = void *;
 
+namespace angle
+{
+class WorkerThreadPool;
+}  // namespace angle
+
 namespace sh
 {
 using BinaryBlob       = std::vector<uint32_t>;
@@ -831,6 +845,16 @@ bool Compile(const ShHandle handle,
 // Clears the results from the previous compilation.
 void ClearResults(const ShHandle handle);
 
+// Sets the thread pool that the translation of a single shader may be split over, for example to
+// generate the SPIR-V of the shader's functions in parallel.  Without a thread pool, or if the pool
+// runs its tasks on the calling thread, the shader is translated on the thread calling Compile.
+// The output does not depend on the thread pool.
+// Parameters:
+// handle: Specifies the compiler
+// threadPool: Specifies the thread pool, or null.
+void SetWorkerThreadPool(const ShHandle handle,
+                         std::shared_ptr<angle::WorkerThreadPool> threadPool);
+
 // Return the version of the shader language.
 int GetShaderVersion(const ShHandle handle);
 
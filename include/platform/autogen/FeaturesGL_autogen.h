@@ -542,6 +542,12 @@ struct FeaturesGL : FeatureSetBase
         &members,
     };
 
+    FeatureInfo supportsMultiBind = {
+        "supportsMultiBind",
+        FeatureCategory::OpenGLFeatures,
+        &members,
+    };
+
     FeatureInfo disableClipControl = {
         "disableClipControl",
         FeatureCategory::OpenGLFeatures,
@@ -380,6 +380,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo forceGenerateMipmapOnCPU = {
+        "forceGenerateMipmapOnCPU",
+        FeatureCategory::VulkanWorkarounds,
+        &members,
+    };
+
     FeatureInfo supportsRenderPassStoreOpNone = {
         "supportsRenderPassStoreOpNone",
         FeatureCategory::VulkanFeatures,
@@ -1532,6 +1538,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo optimizeTranslatedSpirv = {
+        "optimizeTranslatedSpirv",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsUnifiedImageLayouts = {
         "supportsUnifiedImageLayouts",
         FeatureCategory::VulkanFeatures,
@@ -105,6 +105,12 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo cacheTranscodedTextures = {
+        "cacheTranscodedTextures",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
     FeatureInfo dumpShaderSource = {
         "dumpShaderSource",
         FeatureCategory::FrontendFeatures,
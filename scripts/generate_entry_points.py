@@ -257,6 +257,9 @@ enum class EntryPoint
 {entry_points_list}
 }};
 
+// Number of entries in EntryPoint, for tables indexed by entry point.
+constexpr unsigned int kEntryPointCount = {entry_point_count};
+
 const char *GetEntryPointName(EntryPoint ep);
 }}  // namespace angle
 #endif  // COMMON_ENTRY_POINTS_ENUM_AUTOGEN_H_
@@ -320,6 +323,7 @@ void GL_APIENTRY GL_{name}({params})
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = {context_getter};
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
+    ANGLE_PROFILE_ENTRY_POINT(GL{name});
 
     if ({valid_context_check})
     {{{packed_gl_enum_conversions}
@@ -345,6 +349,7 @@ void GL_APIENTRY GL_{name}({params})
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = {context_getter};
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
+    ANGLE_PROFILE_ENTRY_POINT(GL{name});
 
     if ({valid_context_check})
     {{{packed_gl_enum_conversions}
@@ -369,6 +374,7 @@ TEMPLATE_GLES_ENTRY_POINT_WITH_RETURN = """\
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = {context_getter};
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
+    ANGLE_PROFILE_ENTRY_POINT(GL{name});
 
     {return_type} returnValue;
     if ({valid_context_check})
@@ -401,6 +407,7 @@ TEMPLATE_GLES_CONTEXT_PRIVATE_ENTRY_POINT_WITH_RETURN = """\
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = {context_getter};
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
+    ANGLE_PROFILE_ENTRY_POINT(GL{name});
 
     {return_type} returnValue;
     if ({valid_context_check})
@@ -1747,6 +1754,7 @@ def get_validation_expression(api, cmd_name, entry_point_name, internal_params,
     return """bool isCallValid = context->skipValidation();
 if (!isCallValid)
 {{
+    ANGLE_PROFILE_PHASE(Validation);
     if (ANGLE_LIKELY({support_condition}))
     {{
         {pre_validation}isCallValid = {validation_expression};{post_validation}
@@ -3960,7 +3968,8 @@ def main():
         script_name=os.path.basename(sys.argv[0]),
         data_source_name="gl.xml and gl_angle_ext.xml",
         lib="GL/GLES",
-        entry_points_list=",\n".join(["    " + enum for (enum, _) in all_enums]))
+        entry_points_list=",\n".join(["    " + enum for (enum, _) in all_enums]),
+        entry_point_count=len(all_enums))
 
     entry_points_enum_header_path = path_to("common", "entry_points_enum_autogen.h")
     with open(entry_points_enum_header_path, "w") as out:
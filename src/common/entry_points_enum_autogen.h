@@ -1098,6 +1098,9 @@ enum class EntryPoint
     GLWeightPointerOES
 };
 
+// Number of entries in EntryPoint, for tables indexed by entry point.
+constexpr unsigned int kEntryPointCount = 1081;
+
 const char *GetEntryPointName(EntryPoint ep);
 }  // namespace angle
 #endif  // COMMON_ENTRY_POINTS_ENUM_AUTOGEN_H_
@@ -0,0 +1,283 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// float16_utils.cpp: Conversions of arrays between half-floats and floats.
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include "common/float16_utils.h"
+
+#include "common/mathutil.h"
+#include "common/platform.h"
+
+#include <string.h>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#        include <immintrin.h>
+#        define ANGLE_FLOAT16_USE_F16C
+#    elif defined(__GNUC__)
+#        include <cpuid.h>
+#        include <immintrin.h>
+#        define ANGLE_FLOAT16_USE_F16C
+#    endif
+#elif defined(__aarch64__)
+// FCVT is part of the ARMv8 baseline, so no runtime check is necessary.
+#    include <arm_neon.h>
+#    define ANGLE_FLOAT16_USE_NEON
+#endif
+
+#if defined(ANGLE_FLOAT16_USE_F16C) && defined(__GNUC__) && !defined(__F16C__)
+#    define ANGLE_F16C_TARGET __attribute__((target("f16c")))
+#else
+#    define ANGLE_F16C_TARGET
+#endif
+
+namespace gl
+{
+namespace
+{
+// The scalar conversions also convert the elements left at the end of the arrays by the SIMD
+// paths.
+void Float16ToFloat32Scalar(const uint16_t *source, float *dest, size_t count)
+{
+    for (size_t index = 0; index < count; ++index)
+    {
+        dest[index] = float16ToFloat32(source[index]);
+    }
+}
+
+void Float32ToFloat16Scalar(const float *source, uint16_t *dest, size_t count)
+{
+    for (size_t index = 0; index < count; ++index)
+    {
+        dest[index] = float32ToFloat16(source[index]);
+    }
+}
+
+#if defined(ANGLE_FLOAT16_USE_F16C)
+bool SupportsF16C()
+{
+#    if defined(__F16C__)
+    return true;
+#    else
+    // F16C is only usable if the OS saves the AVX state, which is checked as for AVX.
+    constexpr unsigned int kOSXSAVEBit = 1u << 27;
+    constexpr unsigned int kAVXBit     = 1u << 28;
+    constexpr unsigned int kF16CBit    = 1u << 29;
+    constexpr unsigned int kRequired   = kOSXSAVEBit | kAVXBit | kF16CBit;
+
+#        if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    const unsigned int ecx = static_cast<unsigned int>(info[2]);
+    if ((ecx & kRequired) != kRequired)
+    {
+        return false;
+    }
+    const unsigned long long xcr0 = _xgetbv(0);
+#        else
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & kRequired) != kRequired)
+    {
+        return false;
+    }
+    unsigned int xcr0Low, xcr0High;
+    __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    const unsigned long long xcr0 = xcr0Low;
+#        endif
+
+    // The XMM and YMM states must both be enabled.
+    return (xcr0 & 6) == 6;
+#    endif
+}
+
+bool HasF16C()
+{
+    static const bool sSupportsF16C = SupportsF16C();
+    return sSupportsF16C;
+}
+
+// The hardware conversions follow IEEE 754, which the scalar functions do too except for NaNs:
+// float16ToFloat32 keeps signaling NaNs signaling, and float32ToFloat16 returns 0x7FFF for every
+// NaN.  The NaN lanes are patched so the results are identical.
+ANGLE_F16C_TARGET size_t Float16ToFloat32F16C(const uint16_t *source, float *dest, size_t count)
+{
+    const __m128i kMagnitudeMask = _mm_set1_epi32(0x7FFF);
+    const __m128i kInfinity      = _mm_set1_epi32(0x7C00);
+    const __m128i kSignMask      = _mm_set1_epi32(0x8000);
+    const __m128i kMantissaMask  = _mm_set1_epi32(0x03FF);
+    const __m128i kExponentMask  = _mm_set1_epi32(0x7F800000);
+    const __m128i kZero          = _mm_setzero_si128();
+
+    size_t index = 0;
+    for (; index + 8 <= count; index += 8)
+    {
+        const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + index));
+
+        for (int part = 0; part < 2; ++part)
+        {
+            const __m128i halves32 = part == 0 ? _mm_unpacklo_epi16(halves, kZero)
+                                               : _mm_unpackhi_epi16(halves, kZero);
+            const __m128i packed   = part == 0 ? halves : _mm_unpackhi_epi64(halves, halves);
+            const __m128i floats   = _mm_castps_si128(_mm_cvtph_ps(packed));
+
+            const __m128i isNaN =
+                _mm_cmpgt_epi32(_mm_and_si128(halves32, kMagnitudeMask), kInfinity);
+            const __m128i nans = _mm_or_si128(
+                _mm_or_si128(_mm_slli_epi32(_mm_and_si128(halves32, kSignMask), 16), kExponentMask),
+                _mm_slli_epi32(_mm_and_si128(halves32, kMantissaMask), 13));
+
+            const __m128i result =
+                _mm_or_si128(_mm_andnot_si128(isNaN, floats), _mm_and_si128(isNaN, nans));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + index + part * 4), result);
+        }
+    }
+    return index;
+}
+
+ANGLE_F16C_TARGET size_t Float32ToFloat16F16C(const float *source, uint16_t *dest, size_t count)
+{
+    const __m128i kNaN = _mm_set1_epi16(0x7FFF);
+
+    size_t index = 0;
+    for (; index + 8 <= count; index += 8)
+    {
+        const __m128 floats0 = _mm_loadu_ps(source + index);
+        const __m128 floats1 = _mm_loadu_ps(source + index + 4);
+
+        const __m128i halves = _mm_unpacklo_epi64(_mm_cvtps_ph(floats0, _MM_FROUND_TO_NEAREST_INT),
+                                                  _mm_cvtps_ph(floats1, _MM_FROUND_TO_NEAREST_INT));
+        const __m128i isNaN  = _mm_packs_epi32(_mm_castps_si128(_mm_cmpunord_ps(floats0, floats0)),
+                                               _mm_castps_si128(_mm_cmpunord_ps(floats1, floats1)));
+
+        const __m128i result =
+            _mm_or_si128(_mm_andnot_si128(isNaN, halves), _mm_and_si128(isNaN, kNaN));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + index), result);
+    }
+    return index;
+}
+#endif  // defined(ANGLE_FLOAT16_USE_F16C)
+
+#if defined(ANGLE_FLOAT16_USE_NEON)
+// See the comment above the F16C functions for the NaN patching.
+size_t Float16ToFloat32NEON(const uint16_t *source, float *dest, size_t count)
+{
+    const uint32x4_t kMagnitudeMask = vdupq_n_u32(0x7FFF);
+    const uint32x4_t kInfinity      = vdupq_n_u32(0x7C00);
+    const uint32x4_t kSignMask      = vdupq_n_u32(0x8000);
+    const uint32x4_t kMantissaMask  = vdupq_n_u32(0x03FF);
+    const uint32x4_t kExponentMask  = vdupq_n_u32(0x7F800000);
+
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4)
+    {
+        const uint16x4_t halves   = vld1_u16(source + index);
+        const uint32x4_t halves32 = vmovl_u16(halves);
+        const uint32x4_t floats =
+            vreinterpretq_u32_f32(vcvt_f32_f16(vreinterpret_f16_u16(halves)));
+
+        const uint32x4_t isNaN = vcgtq_u32(vandq_u32(halves32, kMagnitudeMask), kInfinity);
+        const uint32x4_t nans =
+            vorrq_u32(vorrq_u32(vshlq_n_u32(vandq_u32(halves32, kSignMask), 16), kExponentMask),
+                      vshlq_n_u32(vandq_u32(halves32, kMantissaMask), 13));
+
+        vst1q_f32(dest + index, vreinterpretq_f32_u32(vbslq_u32(isNaN, nans, floats)));
+    }
+    return index;
+}
+
+size_t Float32ToFloat16NEON(const float *source, uint16_t *dest, size_t count)
+{
+    const uint16x4_t kNaN = vdup_n_u16(0x7FFF);
+
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4)
+    {
+        const float32x4_t floats = vld1q_f32(source + index);
+        const uint16x4_t halves  = vreinterpret_u16_f16(vcvt_f16_f32(floats));
+        const uint16x4_t isNaN   = vmovn_u32(vmvnq_u32(vceqq_f32(floats, floats)));
+
+        vst1_u16(dest + index, vbsl_u16(isNaN, kNaN, halves));
+    }
+    return index;
+}
+#endif  // defined(ANGLE_FLOAT16_USE_NEON)
+}  // anonymous namespace
+
+void float16ToFloat32Array(const uint16_t *source, float *dest, size_t count)
+{
+    size_t converted = 0;
+#if defined(ANGLE_FLOAT16_USE_F16C)
+    if (HasF16C())
+    {
+        converted = Float16ToFloat32F16C(source, dest, count);
+    }
+#elif defined(ANGLE_FLOAT16_USE_NEON)
+    converted = Float16ToFloat32NEON(source, dest, count);
+#endif
+    Float16ToFloat32Scalar(source + converted, dest + converted, count - converted);
+}
+
+void float32ToFloat16Array(const float *source, uint16_t *dest, size_t count)
+{
+    size_t converted = 0;
+#if defined(ANGLE_FLOAT16_USE_F16C)
+    if (HasF16C())
+    {
+        converted = Float32ToFloat16F16C(source, dest, count);
+    }
+#elif defined(ANGLE_FLOAT16_USE_NEON)
+    converted = Float32ToFloat16NEON(source, dest, count);
+#endif
+    Float32ToFloat16Scalar(source + converted, dest + converted, count - converted);
+}
+
+void float32ToFloat16Elements(const uint8_t *source,
+                              size_t sourceStride,
+                              size_t sourceComponents,
+                              uint16_t *dest,
+                              size_t destComponents,
+                              size_t count)
+{
+    ASSERT(sourceComponents <= destComponents && destComponents <= 4);
+
+    // Tightly packed, aligned elements with nothing to add are converted directly.
+    if (sourceStride == sourceComponents * sizeof(float) && sourceComponents == destComponents &&
+        reinterpret_cast<uintptr_t>(source) % sizeof(float) == 0)
+    {
+        float32ToFloat16Array(reinterpret_cast<const float *>(source), dest,
+                              count * destComponents);
+        return;
+    }
+
+    // Otherwise the elements are gathered in chunks, with the missing components added, and the
+    // chunks are converted.  The source is copied bytewise, as vertex data may be unaligned.
+    constexpr size_t kChunkElements = 256;
+    float chunk[kChunkElements * 4];
+
+    for (size_t first = 0; first < count; first += kChunkElements)
+    {
+        const size_t chunkCount = std::min(kChunkElements, count - first);
+
+        for (size_t element = 0; element < chunkCount; ++element)
+        {
+            float *chunkElement = chunk + element * destComponents;
+            memcpy(chunkElement, source + (first + element) * sourceStride,
+                   sourceComponents * sizeof(float));
+            for (size_t component = sourceComponents; component < destComponents; ++component)
+            {
+                chunkElement[component] = component == 3 ? 1.0f : 0.0f;
+            }
+        }
+
+        float32ToFloat16Array(chunk, dest + first * destComponents, chunkCount * destComponents);
+    }
+}
+}  // namespace gl
@@ -0,0 +1,38 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// float16_utils.h: Conversions of arrays between half-floats and floats.  These use the hardware
+// conversion instructions where available (F16C on x86, FCVT on ARM64), and otherwise the scalar
+// functions of mathutil.h.
+
+#ifndef COMMON_FLOAT16UTILS_H_
+#define COMMON_FLOAT16UTILS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace gl
+{
+// Converts |count| half-floats to floats.  The results are identical to float16ToFloat32 for every
+// input, including denormals, infinities and NaNs.
+void float16ToFloat32Array(const uint16_t *source, float *dest, size_t count);
+
+// Converts |count| floats to half-floats.  The results are identical to float32ToFloat16 for every
+// input: values are rounded to nearest even, and NaNs become 0x7FFF.
+void float32ToFloat16Array(const float *source, uint16_t *dest, size_t count);
+
+// Converts |count| elements of |sourceComponents| floats, |sourceStride| bytes apart, to tightly
+// packed elements of |destComponents| half-floats, where |destComponents| >= |sourceComponents|.
+// Components missing in the source are set to 0, except the fourth which is set to 1, as when
+// reading vertex attributes.
+void float32ToFloat16Elements(const uint8_t *source,
+                              size_t sourceStride,
+                              size_t sourceComponents,
+                              uint16_t *dest,
+                              size_t destComponents,
+                              size_t count);
+}  // namespace gl
+
+#endif  // COMMON_FLOAT16UTILS_H_
@@ -0,0 +1,228 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// float16_utils_unittest:
+//   Tests that the array conversions of float16_utils.h match the scalar ones of mathutil.h.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include "common/float16_utils.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "common/mathutil.h"
+
+using namespace gl;
+
+namespace
+{
+std::vector<uint16_t> AllHalves()
+{
+    std::vector<uint16_t> halves(65536);
+    for (size_t half = 0; half < halves.size(); ++half)
+    {
+        halves[half] = static_cast<uint16_t>(half);
+    }
+    return halves;
+}
+
+// Floats on and around the midpoints between every pair of consecutive half-floats, where the
+// rounding matters, and the values beyond the largest half-float that round to infinity.
+std::vector<float> RoundingFloats()
+{
+    std::vector<float> floats;
+    for (uint32_t half = 0; half < 0x7C00; ++half)
+    {
+        for (uint32_t sign : {0u, 0x8000u})
+        {
+            const float value = float16ToFloat32(static_cast<uint16_t>(half | sign));
+            const float next  = float16ToFloat32(static_cast<uint16_t>((half + 1) | sign));
+            // The midpoint has one more bit than a half-float, so is exact as a float.  Past the
+            // largest half-float, it is where the rounding to infinity starts.
+            const float midpoint =
+                std::isinf(next) ? std::copysign(65520.0f, value) : (value + next) * 0.5f;
+            const uint32_t midpointBits = bitCast<uint32_t>(midpoint);
+
+            for (uint32_t bits : {bitCast<uint32_t>(value), midpointBits - 1, midpointBits,
+                                  midpointBits + 1})
+            {
+                floats.push_back(bitCast<float>(bits));
+            }
+        }
+    }
+
+    // Floats too small for a half-float denormal.
+    for (float value : {0x1.0p-26f, 0x1.fffffep-26f, 0x1.0p-40f, 0x1.0p-149f})
+    {
+        floats.push_back(value);
+        floats.push_back(-value);
+    }
+    // Floats too large for a half-float.
+    for (float value : {65536.0f, 70000.0f, 131056.0f, 1.0e10f, std::numeric_limits<float>::max(),
+                        std::numeric_limits<float>::infinity()})
+    {
+        floats.push_back(value);
+        floats.push_back(-value);
+    }
+    return floats;
+}
+
+// Test that every half-float converts to exactly the float of float16ToFloat32, including the
+// payloads of signaling NaNs.
+TEST(Float16UtilsTest, Float16ToFloat32ArrayMatchesScalar)
+{
+    const std::vector<uint16_t> halves = AllHalves();
+    std::vector<float> floats(halves.size());
+    float16ToFloat32Array(halves.data(), floats.data(), halves.size());
+
+    for (size_t index = 0; index < halves.size(); ++index)
+    {
+        ASSERT_EQ(bitCast<uint32_t>(floats[index]),
+                  bitCast<uint32_t>(float16ToFloat32(halves[index])))
+            << "half 0x" << std::hex << halves[index];
+    }
+}
+
+// Test that every half-float other than NaN converts to a float and back unchanged, and that NaNs
+// become 0x7FFF.
+TEST(Float16UtilsTest, HalfFloatsRoundTrip)
+{
+    const std::vector<uint16_t> halves = AllHalves();
+    std::vector<float> floats(halves.size());
+    std::vector<uint16_t> roundTripped(halves.size());
+    float16ToFloat32Array(halves.data(), floats.data(), halves.size());
+    float32ToFloat16Array(floats.data(), roundTripped.data(), floats.size());
+
+    for (size_t index = 0; index < halves.size(); ++index)
+    {
+        const bool isNaN        = (halves[index] & 0x7FFF) > 0x7C00;
+        const uint16_t expected = isNaN ? 0x7FFF : halves[index];
+        ASSERT_EQ(roundTripped[index], expected) << "half 0x" << std::hex << halves[index];
+    }
+}
+
+// Test that floats are rounded to nearest even exactly as float32ToFloat16 does, including
+// overflows and denormals.
+TEST(Float16UtilsTest, Float32ToFloat16ArrayMatchesScalar)
+{
+    const std::vector<float> floats = RoundingFloats();
+    std::vector<uint16_t> halves(floats.size());
+    float32ToFloat16Array(floats.data(), halves.data(), floats.size());
+
+    for (size_t index = 0; index < floats.size(); ++index)
+    {
+        ASSERT_EQ(halves[index], float32ToFloat16(floats[index]))
+            << "float 0x" << std::hex << bitCast<uint32_t>(floats[index]);
+    }
+}
+
+// Test that every kind of float NaN becomes 0x7FFF.
+TEST(Float16UtilsTest, Float32NaNs)
+{
+    const std::vector<uint32_t> nanBits = {0x7FC00000, 0xFFC00000, 0x7F800001, 0xFF800001,
+                                           0x7FBFFFFF, 0xFFFFFFFF, 0x7F802000, 0x7FFFE000};
+    std::vector<float> nans;
+    for (uint32_t bits : nanBits)
+    {
+        nans.push_back(bitCast<float>(bits));
+    }
+
+    std::vector<uint16_t> halves(nans.size());
+    float32ToFloat16Array(nans.data(), halves.data(), nans.size());
+
+    for (size_t index = 0; index < nans.size(); ++index)
+    {
+        EXPECT_EQ(halves[index], 0x7FFF) << "float 0x" << std::hex << nanBits[index];
+    }
+}
+
+// Test that arrays of every length and alignment are converted completely, and nothing past their
+// end is written.
+TEST(Float16UtilsTest, ArrayLengths)
+{
+    constexpr size_t kMaxCount = 37;
+    std::vector<float> floats(kMaxCount + 1);
+    for (size_t index = 0; index < floats.size(); ++index)
+    {
+        floats[index] = static_cast<float>(index) * 0.5f - 3.0f;
+    }
+
+    for (size_t offset = 0; offset < 4; ++offset)
+    {
+        for (size_t count = 0; count + offset <= kMaxCount; ++count)
+        {
+            std::vector<uint16_t> halves(kMaxCount + 1, 0xABCD);
+            float32ToFloat16Array(floats.data() + offset, halves.data() + offset, count);
+
+            std::vector<float> converted(kMaxCount + 1, -1.0f);
+            float16ToFloat32Array(halves.data() + offset, converted.data() + offset, count);
+
+            for (size_t index = 0; index < halves.size(); ++index)
+            {
+                const bool written = index >= offset && index < offset + count;
+                EXPECT_EQ(halves[index], written ? float32ToFloat16(floats[index]) : 0xABCD)
+                    << "offset " << offset << " count " << count << " index " << index;
+                EXPECT_EQ(converted[index], written ? floats[index] : -1.0f)
+                    << "offset " << offset << " count " << count << " index " << index;
+            }
+        }
+    }
+}
+
+// Test that strided elements are converted and padded as vertex attributes are.
+TEST(Float16UtilsTest, Float32ToFloat16Elements)
+{
+    constexpr size_t kCount = 300;
+    const std::vector<float> floats = RoundingFloats();
+
+    for (size_t sourceComponents = 1; sourceComponents <= 4; ++sourceComponents)
+    {
+        for (size_t destComponents = sourceComponents; destComponents <= 4; ++destComponents)
+        {
+            // Tightly packed, padded and unaligned elements.
+            for (size_t sourceStride : {sourceComponents * sizeof(float),
+                                        sourceComponents * sizeof(float) + 8, size_t(19)})
+            {
+                if (sourceStride < sourceComponents * sizeof(float))
+                {
+                    continue;
+                }
+
+                std::vector<uint8_t> source(sourceStride * kCount + 1);
+                const size_t sourceOffset = sourceStride % sizeof(float) == 0 ? 0 : 1;
+                for (size_t element = 0; element < kCount; ++element)
+                {
+                    memcpy(source.data() + sourceOffset + element * sourceStride,
+                           floats.data() + element * 7, sourceComponents * sizeof(float));
+                }
+
+                std::vector<uint16_t> dest(kCount * destComponents);
+                float32ToFloat16Elements(source.data() + sourceOffset, sourceStride,
+                                         sourceComponents, dest.data(), destComponents, kCount);
+
+                for (size_t element = 0; element < kCount; ++element)
+                {
+                    for (size_t component = 0; component < destComponents; ++component)
+                    {
+                        uint16_t expected = component == 3 ? Float16One : 0;
+                        if (component < sourceComponents)
+                        {
+                            expected = float32ToFloat16(floats[element * 7 + component]);
+                        }
+                        ASSERT_EQ(dest[element * destComponents + component], expected)
+                            << sourceComponents << " to " << destComponents << " stride "
+                            << sourceStride << " element " << element;
+                    }
+                }
+            }
+        }
+    }
+}
+}  // anonymous namespace
@@ -14,14 +14,97 @@
 #define USE_SYSTEM_ZLIB
 #include "compression_utils_portable.h"
 
+#include "common/hash_utils.h"
 #include "common/mathutil.h"
+#include "common/system_utils.h"
 #include "frame_capture_binary_data.h"
 
+#include <algorithm>
 #include <array>
+#include <limits>
 #include <string>
 
 namespace angle
 {
+namespace
+{
+constexpr size_t kInvalidOffset = std::numeric_limits<size_t>::max();
+
+// The rolling hash covers 64 byte windows, starting at kBinaryAlignment boundaries so that data
+// found inside earlier data is still aligned.  About one window in 64 is used as an anchor.
+constexpr size_t kRollingWindowSize        = 64;
+constexpr size_t kRollingWindowWords       = kRollingWindowSize / sizeof(uint64_t);
+constexpr uint64_t kRollingHashBase        = 0x100000001B3ull;
+constexpr uint64_t kRollingAnchorMix       = 0x9E3779B97F4A7C15ull;
+constexpr unsigned int kRollingAnchorShift = 58;
+// Number of anchors of a payload that are looked up before giving up on it
+constexpr size_t kMaxRollingProbes = 4;
+
+constexpr uint64_t GetRollingHashOutFactor()
+{
+    uint64_t factor = 1;
+    for (size_t word = 1; word < kRollingWindowWords; word++)
+    {
+        factor *= kRollingHashBase;
+    }
+    return factor;
+}
+
+uint64_t LoadWord(const uint8_t *data)
+{
+    uint64_t word;
+    memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+// Calls onAnchor(position, windowHash) for the anchor windows of |data|, until it returns false.
+// The window hash is a polynomial of the 64-bit words of the window, so moving the window forward
+// by a word only takes out the first word and adds the next one.
+template <typename AnchorFunc>
+void ForEachAnchorWindow(const uint8_t *data, size_t size, AnchorFunc &&onAnchor)
+{
+    if (size < kRollingWindowSize)
+    {
+        return;
+    }
+
+    constexpr uint64_t kOutFactor = GetRollingHashOutFactor();
+
+    uint64_t windowHash = 0;
+    for (size_t word = 0; word < kRollingWindowWords; word++)
+    {
+        windowHash = windowHash * kRollingHashBase + LoadWord(data + word * sizeof(uint64_t));
+    }
+
+    for (size_t position = 0;; position += kBinaryAlignment)
+    {
+        if (((windowHash * kRollingAnchorMix) >> kRollingAnchorShift) == 0 &&
+            !onAnchor(position, windowHash))
+        {
+            return;
+        }
+        if (position + kBinaryAlignment + kRollingWindowSize > size)
+        {
+            return;
+        }
+        for (size_t step = 0; step < kBinaryAlignment; step += sizeof(uint64_t))
+        {
+            const uint8_t *window = data + position + step;
+            windowHash = (windowHash - LoadWord(window) * kOutFactor) * kRollingHashBase +
+                         LoadWord(window + kRollingWindowSize);
+        }
+    }
+}
+}  // namespace
+
+FrameCaptureBinaryData::FrameCaptureBinaryData() = default;
+
+FrameCaptureBinaryData::~FrameCaptureBinaryData()
+{
+    stopStoreThread();
+    stopPrefetchThread();
+    unmapBinaryDataFile();
+}
 
 // Return current size of all binary data
 size_t FrameCaptureBinaryData::totalSize() const
@@ -112,6 +195,11 @@ std::vector<uint8_t> &FrameCaptureBinaryData::prepareStoreBlock(size_t blockId)
     {
         mData.resize(mData.size() + 1);
     }
+    else
+    {
+        // The new block and the blocks not written yet must fit in the resident size
+        waitForPendingStores(mMaxResidentBlockIndex);
+    }
 
     mBlockCount = blockId + 1;
 
@@ -169,6 +257,13 @@ BinaryFileIndexInfo FrameCaptureBinaryData::appendFileIndex()
         {
             mFileStream->write(reinterpret_cast<const uint8_t *>(&entry), sizeof(FileBlockInfo));
         }
+
+        // Followed by the frame access profile, used to prefetch blocks during replay
+        size_t profileSize = mFrameAccessProfile.size();
+        mFileStream->write(reinterpret_cast<const uint8_t *>(&profileSize), sizeof(profileSize));
+        mFileStream->write(reinterpret_cast<const uint8_t *>(mFrameAccessProfile.data()),
+                           profileSize * sizeof(FrameAccessInfo));
+
         indexInfo.indexOffset = indexDataOffset;
     }
 
@@ -199,6 +294,26 @@ void FrameCaptureBinaryData::constructBlockDescIndex(size_t indexOffset)
             blockDesc.dataSize               = blockInfo.dataSize;
             mReplayBlockDescriptions.push_back(blockDesc);
         }
+
+        // Followed by the frame access profile since version 2
+        if (mVersion >= 2)
+        {
+            size_t profileSize = 0;
+            mFileStream->read(reinterpret_cast<uint8_t *>(&profileSize), sizeof(profileSize));
+            mFrameAccessProfile.resize(profileSize);
+            size_t profileBytes = profileSize * sizeof(FrameAccessInfo);
+            if (mFileStream->read(reinterpret_cast<uint8_t *>(mFrameAccessProfile.data()),
+                                  profileBytes) != profileBytes)
+            {
+                FATAL() << "Truncated frame access profile in binary data file " << mFileName;
+            }
+
+            // The setup is captured after the frames, but replayed before them
+            std::stable_sort(mFrameAccessProfile.begin(), mFrameAccessProfile.end(),
+                             [](const FrameAccessInfo &a, const FrameAccessInfo &b) {
+                                 return a.frameIndex < b.frameIndex;
+                             });
+        }
     }
     else
     {
@@ -207,27 +322,50 @@ void FrameCaptureBinaryData::constructBlockDescIndex(size_t indexOffset)
         size_t size = mFileStream->getPosition();
         mFileStream->seek(0, kSeekBegin);
 
-        size_t remaining = size;
-        while (remaining > 0)
-        {
-            // The final block is typically smaller than mDataBlockSize
-            size_t dataSize = std::min(remaining, mDataBlockSize);
-            size_t offset   = size - remaining;
+        constructFixedSizeBlockDescIndex(size);
+    }
+}
 
-            // Create and save a block description
-            ReplayBlockDescription blockDesc = {};
-            blockDesc.fileOffset             = offset;
-            blockDesc.beginDataOffset        = offset;
-            blockDesc.endDataOffset          = offset + dataSize - 1;
-            blockDesc.dataSize               = dataSize;
-            mReplayBlockDescriptions.push_back(blockDesc);
-            remaining -= dataSize;
-        }
+void FrameCaptureBinaryData::constructFixedSizeBlockDescIndex(size_t size)
+{
+    size_t remaining = size;
+    while (remaining > 0)
+    {
+        // The final block is typically smaller than mDataBlockSize
+        size_t dataSize = std::min(remaining, mDataBlockSize);
+        size_t offset   = size - remaining;
+
+        // Create and save a block description
+        ReplayBlockDescription blockDesc = {};
+        blockDesc.fileOffset             = offset;
+        blockDesc.beginDataOffset        = offset;
+        blockDesc.endDataOffset          = offset + dataSize - 1;
+        blockDesc.dataSize               = dataSize;
+        mReplayBlockDescriptions.push_back(blockDesc);
+        remaining -= dataSize;
     }
 }
 
 size_t FrameCaptureBinaryData::append(const void *data, size_t size)
 {
+    const uint8_t *payload = static_cast<const uint8_t *>(data);
+    uint64_t payloadHash   = 0;
+    if (mDeduplication != Deduplication::Disabled && size > 0)
+    {
+        double startTime       = GetCurrentSystemTime();
+        payloadHash            = XXH64(payload, size, 0);
+        size_t duplicateOffset = findDuplicate(payload, size, payloadHash);
+        mDeduplicationTimeSeconds += GetCurrentSystemTime() - startTime;
+
+        if (duplicateOffset != kInvalidOffset)
+        {
+            mDeduplicatedPayloads++;
+            mDeduplicatedBytes += size;
+            recordFrameAccess(duplicateOffset);
+            return duplicateOffset;
+        }
+    }
+
     if (mData.empty())
     {
         prepareStoreBlock(0);
@@ -261,15 +399,132 @@ size_t FrameCaptureBinaryData::append(const void *data, size_t size)
             // Resident blocks have been saved, write this block to disk
             storeBlock();
         }
+
+        // Data that has been stored isn't in memory to be compared anymore
+        if (isSwapMode())
+        {
+            clearDeduplicationIndex();
+        }
+
         prepareStoreBlock(newBlockId);
         startingOffset = totalSize();
     }
 
-    memcpy(mData.back().data() + mCurrentBlockOffset, data, size);
+    uint8_t *storedData = mData.back().data() + mCurrentBlockOffset;
+    memcpy(storedData, data, size);
     mCurrentBlockOffset += sizeToIncrease;
+
+    if (mDeduplication != Deduplication::Disabled && size > 0)
+    {
+        double startTime = GetCurrentSystemTime();
+        indexPayload(startingOffset, storedData, size, payloadHash);
+        mDeduplicationTimeSeconds += GetCurrentSystemTime() - startTime;
+    }
+
+    recordFrameAccess(startingOffset);
+
     return startingOffset;
 }
 
+// Record the read of the block at |offset| by the frame being captured
+void FrameCaptureBinaryData::recordFrameAccess(size_t offset)
+{
+    size_t blockId = offset / mDataBlockSize;
+    if (mFrameAccessProfile.empty() ||
+        mFrameAccessProfile.back().frameIndex != mCaptureFrameIndex ||
+        mFrameAccessProfile.back().blockId != blockId)
+    {
+        FrameAccessInfo access;
+        access.frameIndex = mCaptureFrameIndex;
+        access.blockId    = blockId;
+        mFrameAccessProfile.push_back(access);
+    }
+}
+
+const uint8_t *FrameCaptureBinaryData::getStoredData(size_t offset, size_t size) const
+{
+    size_t blockId     = offset / mDataBlockSize;
+    size_t blockOffset = offset % mDataBlockSize;
+    if (mData.empty() || blockOffset + size > mDataBlockSize || offset + size > totalSize())
+    {
+        return nullptr;
+    }
+
+    // All blocks are in memory until the resident blocks are stored, and only the last one after
+    if (!isSwapMode())
+    {
+        return mData[blockId].data() + blockOffset;
+    }
+    return blockId + 1 == mBlockCount ? mData.back().data() + blockOffset : nullptr;
+}
+
+// Returns the offset of earlier data identical to the payload, or kInvalidOffset
+size_t FrameCaptureBinaryData::findDuplicate(const uint8_t *data,
+                                             size_t size,
+                                             uint64_t payloadHash) const
+{
+    auto payload = mPayloadIndex.find(payloadHash);
+    if (payload != mPayloadIndex.end() && payload->second.size == size)
+    {
+        const uint8_t *storedData = getStoredData(payload->second.offset, size);
+        if (storedData && memcmp(storedData, data, size) == 0)
+        {
+            return payload->second.offset;
+        }
+    }
+
+    if (mDeduplication != Deduplication::Rolling)
+    {
+        return kInvalidOffset;
+    }
+
+    // Look for the first anchors of the payload in the earlier data, e.g. when a part of a buffer
+    // or texture that was uploaded whole is uploaded again.
+    size_t duplicateOffset = kInvalidOffset;
+    size_t probes          = 0;
+    ForEachAnchorWindow(data, size, [&](size_t position, uint64_t windowHash) {
+        auto window = mWindowIndex.find(windowHash);
+        if (window != mWindowIndex.end() && window->second >= position)
+        {
+            size_t candidateOffset    = window->second - position;
+            const uint8_t *storedData = getStoredData(candidateOffset, size);
+            if (storedData && memcmp(storedData, data, size) == 0)
+            {
+                duplicateOffset = candidateOffset;
+                return false;
+            }
+        }
+        return ++probes < kMaxRollingProbes;
+    });
+
+    return duplicateOffset;
+}
+
+void FrameCaptureBinaryData::indexPayload(size_t offset,
+                                          const uint8_t *data,
+                                          size_t size,
+                                          uint64_t payloadHash)
+{
+    StoredPayload storedPayload;
+    storedPayload.offset = offset;
+    storedPayload.size   = size;
+    mPayloadIndex.emplace(payloadHash, storedPayload);
+
+    if (mDeduplication == Deduplication::Rolling)
+    {
+        ForEachAnchorWindow(data, size, [this, offset](size_t position, uint64_t windowHash) {
+            mWindowIndex.emplace(windowHash, offset + position);
+            return true;
+        });
+    }
+}
+
+void FrameCaptureBinaryData::clearDeduplicationIndex()
+{
+    mPayloadIndex.clear();
+    mWindowIndex.clear();
+}
+
 const uint8_t *FrameCaptureBinaryData::getData(size_t offset)
 {
     // This is the fastpath for this function, misses should be negligible
@@ -283,7 +538,18 @@ const uint8_t *FrameCaptureBinaryData::getData(size_t offset)
     // Swap block into memory if it is nonresident
     if (!isBlockResident(newBlockId))
     {
+        // The replay waits for the block, unless it has been prefetched
+        double loadStartTime = GetCurrentSystemTime();
         loadBlock(newBlockId);
+        mStallTimeSeconds += GetCurrentSystemTime() - loadStartTime;
+
+        onBlockLoaded(newBlockId);
+    }
+    else if (mMappedData && newBlockId + 1 < mReplayBlockDescriptions.size())
+    {
+        // Let the next block of the mapped file be paged in while this one is read
+        const ReplayBlockDescription &nextDesc = mReplayBlockDescriptions[newBlockId + 1];
+        PrefetchMappedFile(mMappedData + nextDesc.fileOffset, nextDesc.dataSize);
     }
     // Update the fastpath cache variables
     updateGetDataCache(newBlockId);
@@ -295,6 +561,8 @@ void FrameCaptureBinaryData::clear()
 {
     mCurrentBlockOffset = 0;
     mFileIndex.clear();
+    mFrameAccessProfile.clear();
+    clearDeduplicationIndex();
     mReplayBlockDescriptions.clear();
     mData.clear();
 }
@@ -387,6 +655,11 @@ void FrameCaptureBinaryData::initializeBinaryDataStore(bool compression,
     mMaxResidentBlockIndex = (mMaxResidentBinarySize / mDataBlockSize) - 1;
 
     mFileStream = new FileStream(binaryDataFileName, Mode::Store);
+
+    if (mAsyncStore)
+    {
+        startStoreThread();
+    }
 }
 
 // Optionally compress and then write a single data block to disk
@@ -400,6 +673,23 @@ void FrameCaptureBinaryData::storeBlock()
         storeBlock.resize(mCurrentBlockOffset);
     }
 
+    size_t blockIndex = mStoredBlocks++;
+
+    if (mStoreThread.joinable())
+    {
+        // The block's memory goes with it, and the next block gets a new one
+        std::lock_guard<std::mutex> lock(mStoreMutex);
+        mStoreQueue.push_back({std::move(storeBlock), blockIndex});
+        mPendingStoreBlocks++;
+        mStoreCondition.notify_all();
+        return;
+    }
+
+    writeBlock(storeBlock, blockIndex);
+}
+
+void FrameCaptureBinaryData::writeBlock(const std::vector<uint8_t> &storeBlock, size_t blockIndex)
+{
     if (mIsBinaryDataCompressed)
     {
         // Use zlib library, based on example/doc here: https://zlib.net/zlib_how.html
@@ -412,7 +702,7 @@ void FrameCaptureBinaryData::storeBlock()
 
         FileBlockInfo fileIndexEntry;
         fileIndexEntry.fileOffset = mFileStream->getPosition();      // CompressedFileOffset
-        fileIndexEntry.dataOffset = mStoredBlocks * mDataBlockSize;  // UncompressedOffset
+        fileIndexEntry.dataOffset = blockIndex * mDataBlockSize;     // UncompressedOffset
         fileIndexEntry.dataSize   = storeBlock.size();               // Size of block
         // Save file index data
         mFileIndex.push_back(fileIndexEntry);
@@ -455,29 +745,100 @@ void FrameCaptureBinaryData::storeBlock()
     {
         mFileStream->write(storeBlock.data(), storeBlock.size());
     }
+}
+
+void FrameCaptureBinaryData::startStoreThread()
+{
+    mStoreThread = std::thread(&FrameCaptureBinaryData::storeThreadLoop, this);
+}
+
+void FrameCaptureBinaryData::stopStoreThread()
+{
+    if (!mStoreThread.joinable())
+    {
+        return;
+    }
+
+    // The thread writes the blocks left in the queue before it exits
+    {
+        std::lock_guard<std::mutex> lock(mStoreMutex);
+        mStoreExit = true;
+    }
+    mStoreCondition.notify_all();
+    mStoreThread.join();
+
+    mStoreExit = false;
+}
+
+void FrameCaptureBinaryData::storeThreadLoop()
+{
+    SetCurrentThreadName("ANGLE-Store");
+
+    std::unique_lock<std::mutex> lock(mStoreMutex);
+    while (true)
+    {
+        mStoreCondition.wait(lock, [this] { return mStoreExit || !mStoreQueue.empty(); });
+        if (mStoreQueue.empty())
+        {
+            return;
+        }
+
+        PendingStoreBlock block = std::move(mStoreQueue.front());
+        mStoreQueue.pop_front();
+        lock.unlock();
+
+        // The file stream and the file index belong to this thread while it runs
+        writeBlock(block.data, block.blockIndex);
+        block.data = {};
+
+        lock.lock();
+        mPendingStoreBlocks--;
+        mStoreCondition.notify_all();
+    }
+}
+
+void FrameCaptureBinaryData::waitForPendingStores(size_t maxPendingBlocks)
+{
+    if (!mStoreThread.joinable())
+    {
+        return;
+    }
 
-    mStoredBlocks++;
+    std::unique_lock<std::mutex> lock(mStoreMutex);
+    mStoreCondition.wait(
+        lock, [this, maxPendingBlocks] { return mPendingStoreBlocks <= maxPendingBlocks; });
 }
 
 BinaryFileIndexInfo FrameCaptureBinaryData::closeBinaryDataStore()
 {
     mCaptureComplete = true;
     storeResidentBlocks();
+    stopStoreThread();
 
     BinaryFileIndexInfo indexInfo;
     indexInfo = appendFileIndex();
+
+    if (mDeduplication != Deduplication::Disabled)
+    {
+        INFO() << "Binary data deduplication saved " << mDeduplicatedBytes << " bytes in "
+               << mDeduplicatedPayloads << " payloads, taking "
+               << mDeduplicationTimeSeconds * 1000.0 << " ms";
+    }
+
     clear();
     return indexInfo;
 }
 
 // Sets up binary data loader with config data from the trace fixture
-void FrameCaptureBinaryData::configureBinaryDataLoader(bool compression,
+void FrameCaptureBinaryData::configureBinaryDataLoader(size_t version,
+                                                       bool compression,
                                                        size_t blockCount,
                                                        size_t blockSize,
                                                        size_t residentSize,
                                                        size_t indexOffset,
                                                        const std::string &fileName)
 {
+    mVersion                       = version;
     mIsBinaryDataCompressed        = compression;
     mFileName                      = fileName;
     mMaxResidentBinarySize         = residentSize;
@@ -491,12 +852,29 @@ void FrameCaptureBinaryData::configureBinaryDataLoader(bool compression,
 // Setup binary data file access, init index and preload data blocks up to limit
 void FrameCaptureBinaryData::initializeBinaryDataLoader()
 {
+    // Uncompressed data is used in place if the file can be mapped
+    if (!mIsBinaryDataCompressed && mapBinaryDataFile())
+    {
+        updateGetDataCache(0);
+        return;
+    }
+
     // Create file stream manager
     mFileStream = new FileStream(mFileName.c_str(), Mode::Load);
 
     // Assemble binary data file/cache index
     constructBlockDescIndex(mIndexOffset);
 
+    // If the data doesn't fit in the resident blocks, the last of them is given to the prefetch
+    // thread, so the resident size isn't exceeded.
+    if (mIsBinaryDataCompressed && mReplayBlockDescriptions.size() > mMaxResidentBlockIndex + 1 &&
+        mMaxResidentBlockIndex >= 2)
+    {
+        mMaxResidentBlockIndex--;
+        mCurrentTransientLoadedBlockId = mMaxResidentBlockIndex;
+        startPrefetchThread();
+    }
+
     // Preload binary data blocks up to limit
     size_t blocksToPreload =
         std::min(mReplayBlockDescriptions.size(), (mMaxResidentBlockIndex + 1));
@@ -507,6 +885,40 @@ void FrameCaptureBinaryData::initializeBinaryDataLoader()
 
     // Initialize getData cache
     updateGetDataCache(0);
+
+    prefetchUpcomingBlock();
+}
+
+bool FrameCaptureBinaryData::mapBinaryDataFile()
+{
+    mMappedData = MapFileReadOnly(mFileName.c_str(), &mMappedSize);
+    if (!mMappedData)
+    {
+        return false;
+    }
+
+    constructFixedSizeBlockDescIndex(mMappedSize);
+    for (size_t blockId = 0; blockId < mReplayBlockDescriptions.size(); blockId++)
+    {
+        uint8_t *blockAddress =
+            const_cast<uint8_t *>(mMappedData) + mReplayBlockDescriptions[blockId].fileOffset;
+        setBlockResident(blockId, blockAddress);
+    }
+
+    // No block is ever swapped, the OS pages them in and out instead
+    mMaxResidentBlockIndex = mReplayBlockDescriptions.size();
+
+    return true;
+}
+
+void FrameCaptureBinaryData::unmapBinaryDataFile()
+{
+    if (mMappedData)
+    {
+        UnmapFile(mMappedData, mMappedSize);
+        mMappedData = nullptr;
+        mMappedSize = 0;
+    }
 }
 
 // Load a single data block into memory
@@ -514,8 +926,26 @@ void FrameCaptureBinaryData::loadBlock(size_t blockId)
 {
     std::vector<uint8_t> &uncompressedDataBlock = prepareLoadBlock(blockId);
 
+    if (!takePrefetchedBlock(blockId, &uncompressedDataBlock))
+    {
+        mCurrentBlockOffset = readBlock(mFileStream, blockId, uncompressedDataBlock.data());
+
+        // Except for the last block this resize will be a no-op
+        uncompressedDataBlock.resize(mCurrentBlockOffset);
+    }
+
+    // Indicate that this block is now loaded
+    setBlockResident(blockId, uncompressedDataBlock.data());
+}
+
+size_t FrameCaptureBinaryData::readBlock(FileStream *fileStream,
+                                         size_t blockId,
+                                         uint8_t *blockData) const
+{
+    size_t blockOffset = 0;
+
     // Move to start of this data block in the data file
-    mFileStream->seek(mReplayBlockDescriptions[blockId].fileOffset, kSeekBegin);
+    fileStream->seek(mReplayBlockDescriptions[blockId].fileOffset, kSeekBegin);
 
     if (mIsBinaryDataCompressed)
     {
@@ -528,22 +958,22 @@ void FrameCaptureBinaryData::loadBlock(size_t blockId)
         using ZlibBuffer = std::array<unsigned char, kZlibBufferSize>;
         std::unique_ptr<ZlibBuffer> compressedDataBuffer(new ZlibBuffer());
         zStream->avail_out = static_cast<uInt>(mDataBlockSize);
-        zStream->next_out  = uncompressedDataBlock.data();
+        zStream->next_out  = blockData;
 
         do
         {
             if (zStream->avail_in == 0)
             {
                 zStream->avail_in = static_cast<uInt>(
-                    mFileStream->read(compressedDataBuffer->data(), kZlibBufferSize));
+                    fileStream->read(compressedDataBuffer->data(), kZlibBufferSize));
                 zStream->next_in = compressedDataBuffer->data();
             }
 
             do
             {
-                int availableOutputSpace = static_cast<int>(mDataBlockSize - mCurrentBlockOffset);
+                int availableOutputSpace = static_cast<int>(mDataBlockSize - blockOffset);
                 zStream->avail_out       = availableOutputSpace;
-                zStream->next_out        = uncompressedDataBlock.data() + mCurrentBlockOffset;
+                zStream->next_out        = blockData + blockOffset;
                 inflateStatus            = inflate(zStream, Z_NO_FLUSH);
                 ASSERT(inflateStatus != Z_STREAM_ERROR);
                 if (inflateStatus == Z_NEED_DICT || inflateStatus == Z_DATA_ERROR ||
@@ -552,23 +982,194 @@ void FrameCaptureBinaryData::loadBlock(size_t blockId)
                     FATAL() << "Zlib inflate failed: " << inflateStatus;
                 }
                 bytesDecompressed = availableOutputSpace - zStream->avail_out;
-                mCurrentBlockOffset += bytesDecompressed;
-            } while (zStream->avail_out == 0 && mCurrentBlockOffset < mDataBlockSize);
-        } while (inflateStatus != Z_STREAM_END && mCurrentBlockOffset != mDataBlockSize);
+                blockOffset += bytesDecompressed;
+            } while (zStream->avail_out == 0 && blockOffset < mDataBlockSize);
+        } while (inflateStatus != Z_STREAM_END && blockOffset != mDataBlockSize);
     }
     else
     {
-        mCurrentBlockOffset = mFileStream->read(uncompressedDataBlock.data(), mDataBlockSize);
+        blockOffset = fileStream->read(blockData, mDataBlockSize);
     }
 
-    // Except for the last block this resize will be a no-op
-    uncompressedDataBlock.resize(mCurrentBlockOffset);
-    // Indicate that this block is now loaded
-    setBlockResident(blockId, uncompressedDataBlock.data());
+    return blockOffset;
+}
+
+void FrameCaptureBinaryData::startPrefetchThread()
+{
+    // The prefetch thread reads the file through its own stream
+    mPrefetchFileStream = std::make_unique<FileStream>(mFileName, Mode::Load);
+    mPrefetchThread     = std::thread(&FrameCaptureBinaryData::prefetchThreadLoop, this);
+}
+
+void FrameCaptureBinaryData::stopPrefetchThread()
+{
+    if (!mPrefetchThread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mPrefetchMutex);
+        mPrefetchExit = true;
+    }
+    mPrefetchCondition.notify_all();
+    mPrefetchThread.join();
+
+    mPrefetchFileStream.reset();
+    mPrefetchBuffer           = {};
+    mPrefetchRequestedBlockId = kInvalidBlockId;
+    mPrefetchedBlockId        = kInvalidBlockId;
+    mPrefetchExit             = false;
+}
+
+void FrameCaptureBinaryData::prefetchThreadLoop()
+{
+    SetCurrentThreadName("ANGLE-Prefetch");
+
+    std::unique_lock<std::mutex> lock(mPrefetchMutex);
+    while (true)
+    {
+        mPrefetchCondition.wait(lock, [this] {
+            return mPrefetchExit || mPrefetchRequestedBlockId != kInvalidBlockId;
+        });
+        if (mPrefetchExit)
+        {
+            return;
+        }
+
+        // The buffer belongs to this thread until the request is complete
+        size_t blockId = mPrefetchRequestedBlockId;
+        lock.unlock();
+
+        mPrefetchBuffer.resize(mDataBlockSize);
+        size_t blockSize = readBlock(mPrefetchFileStream.get(), blockId, mPrefetchBuffer.data());
+        mPrefetchBuffer.resize(blockSize);
+
+        lock.lock();
+        mPrefetchedBlockId        = blockId;
+        mPrefetchRequestedBlockId = kInvalidBlockId;
+        mPrefetchCondition.notify_all();
+    }
+}
+
+// Moves past the read of a block that was just loaded in the frame access profile, and prefetches
+// the next block the replay will read.
+void FrameCaptureBinaryData::onBlockLoaded(size_t blockId)
+{
+    if (!mPrefetchThread.joinable())
+    {
+        return;
+    }
+
+    for (size_t step = 0; step < mFrameAccessProfile.size(); step++)
+    {
+        size_t position = (mFrameAccessPosition + step) % mFrameAccessProfile.size();
+        if (mFrameAccessProfile[position].blockId == blockId)
+        {
+            mFrameAccessPosition = (position + 1) % mFrameAccessProfile.size();
+            break;
+        }
+    }
+
+    prefetchUpcomingBlock();
+}
+
+void FrameCaptureBinaryData::onReplayFrame(uint32_t frameIndex)
+{
+    if (!mPrefetchThread.joinable() || mFrameAccessProfile.empty())
+    {
+        return;
+    }
+
+    auto access = std::lower_bound(
+        mFrameAccessProfile.begin(), mFrameAccessProfile.end(), frameIndex,
+        [](const FrameAccessInfo &info, uint32_t index) { return info.frameIndex < index; });
+    mFrameAccessPosition =
+        access == mFrameAccessProfile.end() ? 0 : access - mFrameAccessProfile.begin();
+
+    prefetchUpcomingBlock();
+}
+
+void FrameCaptureBinaryData::prefetchUpcomingBlock()
+{
+    if (!mPrefetchThread.joinable())
+    {
+        return;
+    }
+
+    size_t blockId = kInvalidBlockId;
+    if (mFrameAccessProfile.empty())
+    {
+        // Without a profile, blocks are expected to be read in order, looping back to the first
+        // block that isn't resident.
+        blockId = mCurrentTransientLoadedBlockId + 1;
+        if (blockId >= mReplayBlockDescriptions.size())
+        {
+            blockId = mMaxResidentBlockIndex;
+        }
+    }
+    else
+    {
+        // The setup is only replayed once, so its reads are skipped when looping back to the first
+        // frame.
+        bool inSetup = mFrameAccessProfile[mFrameAccessPosition].frameIndex == 0;
+        for (size_t step = 0; step < mFrameAccessProfile.size(); step++)
+        {
+            const FrameAccessInfo &access =
+                mFrameAccessProfile[(mFrameAccessPosition + step) % mFrameAccessProfile.size()];
+            if ((inSetup || access.frameIndex != 0) && !isBlockResident(access.blockId))
+            {
+                blockId = access.blockId;
+                break;
+            }
+        }
+    }
+
+    if (blockId == kInvalidBlockId || isBlockResident(blockId))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mPrefetchMutex);
+
+    // Only one block is prefetched at a time
+    if (mPrefetchRequestedBlockId != kInvalidBlockId || mPrefetchedBlockId == blockId)
+    {
+        return;
+    }
+
+    mPrefetchedBlockId        = kInvalidBlockId;
+    mPrefetchRequestedBlockId = blockId;
+    mPrefetchCondition.notify_all();
+}
+
+bool FrameCaptureBinaryData::takePrefetchedBlock(size_t blockId, std::vector<uint8_t> *blockOut)
+{
+    if (!mPrefetchThread.joinable())
+    {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mPrefetchMutex);
+
+    // Waiting for the block to be decompressed is faster than starting over
+    mPrefetchCondition.wait(lock, [this, blockId] { return mPrefetchRequestedBlockId != blockId; });
+
+    if (mPrefetchedBlockId != blockId)
+    {
+        return false;
+    }
+
+    // The block that is swapped out becomes the next prefetch buffer
+    std::swap(*blockOut, mPrefetchBuffer);
+    mPrefetchedBlockId = kInvalidBlockId;
+    return true;
 }
 
 void FrameCaptureBinaryData::closeBinaryDataLoader()
 {
+    stopPrefetchThread();
+    unmapBinaryDataFile();
     clear();
 }
 
@@ -11,9 +11,15 @@
 #define FRAME_CAPTURE_BINARY_DATA_H_
 
 #include "common/debug.h"
+#include "common/hash_containers.h"
 
 #include <stddef.h>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace angle
@@ -25,7 +31,8 @@ constexpr size_t kBinaryAlignment       = 16;
 // The zlib doc recommends buffer sizes on the order of 128K or 256K bytes
 constexpr size_t kZlibBufferSize     = 256 * 1024;
 constexpr uint32_t kInvalidBlockId   = 0xFFFFFFFF;
-constexpr size_t kLongTraceVersionId = 1;
+// Version 2 appends the frame access profile to the file index of compressed files.
+constexpr size_t kLongTraceVersionId = 2;
 
 // Index information ultimately saved in trace JSON file
 struct BinaryFileIndexInfo
@@ -44,12 +51,26 @@ class FileStream;
 class FrameCaptureBinaryData
 {
   public:
+    FrameCaptureBinaryData();
+    ~FrameCaptureBinaryData();
+
     enum class Mode
     {
         Load,
         Store
     };
 
+    // How append() avoids storing the same data more than once
+    enum class Deduplication
+    {
+        // Every payload is stored
+        Disabled,
+        // A payload identical to an earlier one is stored once
+        Exact,
+        // A payload found anywhere in the earlier data, with a rolling hash, is stored once
+        Rolling,
+    };
+
     // Describes a block's location in the binary data file
     struct FileBlockInfo
     {
@@ -60,6 +81,16 @@ class FrameCaptureBinaryData
         FileBlockInfo() : fileOffset(0), dataOffset(0), dataSize(0) {}
     };
 
+    // Records that a frame of the replay reads a block.  The frame access profile lists them in
+    // the order of the frames, and of the reads within a frame.  Frame 0 is the setup.
+    struct FrameAccessInfo
+    {
+        size_t frameIndex;
+        size_t blockId;
+
+        FrameAccessInfo() : frameIndex(0), blockId(0) {}
+    };
+
     // Describes a block's state during replay
     struct ReplayBlockDescription
     {
@@ -79,6 +110,9 @@ class FrameCaptureBinaryData
     void setBlockNonResident(size_t blockId);
     void setBinaryDataSize(size_t binaryDataSize);
     void setBlockSize(size_t blockSize);
+    void setDeduplication(Deduplication deduplication) { mDeduplication = deduplication; }
+    // Compress and write the stored blocks on a thread, instead of in append().
+    void setAsyncStore(bool asyncStore) { mAsyncStore = asyncStore; }
 
     void storeResidentBlocks();
     // Format data for appending to compressed binary file
@@ -90,12 +124,20 @@ class FrameCaptureBinaryData
     void clear();
     const uint8_t *getData(size_t offset);
 
+    // The data appended from now on is read by |frameIndex| of the replay.
+    void setCaptureFrameIndex(uint32_t frameIndex) { mCaptureFrameIndex = frameIndex; }
+    // The frame of the replay that is about to run, to prefetch the blocks it reads.
+    void onReplayFrame(uint32_t frameIndex);
+    // Time getData() spent waiting for blocks to be loaded.
+    double getStallTimeSeconds() const { return mStallTimeSeconds; }
+
     void initializeBinaryDataStore(bool compression,
                                    const std::string &outDir,
                                    const std::string &fileName);
     void storeBlock();
     BinaryFileIndexInfo closeBinaryDataStore();
-    void configureBinaryDataLoader(bool compression,
+    void configureBinaryDataLoader(size_t version,
+                                   bool compression,
                                    size_t blockCount,
                                    size_t blockSize,
                                    size_t residentSize,
@@ -109,11 +151,66 @@ class FrameCaptureBinaryData
     std::vector<uint8_t> &prepareStoreBlock(size_t blockId);
 
   private:
+    // A payload stored by append(), and indexed by its hash
+    struct StoredPayload
+    {
+        size_t offset;
+        size_t size;
+    };
+
+    void recordFrameAccess(size_t offset);
+    // Returns the stored data at |offset|, or nullptr if it isn't in memory anymore.
+    const uint8_t *getStoredData(size_t offset, size_t size) const;
+    size_t findDuplicate(const uint8_t *data, size_t size, uint64_t payloadHash) const;
+    void indexPayload(size_t offset, const uint8_t *data, size_t size, uint64_t payloadHash);
+    void clearDeduplicationIndex();
+
+    // A block handed to the store thread
+    struct PendingStoreBlock
+    {
+        std::vector<uint8_t> data;
+        size_t blockIndex;
+    };
+
+    void writeBlock(const std::vector<uint8_t> &block, size_t blockIndex);
+    void startStoreThread();
+    void stopStoreThread();
+    void storeThreadLoop();
+    // Waits until no more than |maxPendingBlocks| blocks are waiting to be written.
+    void waitForPendingStores(size_t maxPendingBlocks);
+
+    void constructFixedSizeBlockDescIndex(size_t size);
+    bool mapBinaryDataFile();
+    void unmapBinaryDataFile();
+    // Reads a block from |fileStream| into |blockData|, which holds a full block, and returns the
+    // size of the block.  Called by both the replay and the prefetch thread.
+    size_t readBlock(FileStream *fileStream, size_t blockId, uint8_t *blockData) const;
+
+    void startPrefetchThread();
+    void stopPrefetchThread();
+    void prefetchThreadLoop();
+    void onBlockLoaded(size_t blockId);
+    void prefetchUpcomingBlock();
+    bool takePrefetchedBlock(size_t blockId, std::vector<uint8_t> *blockOut);
+
     bool mIsBinaryDataCompressed;
     std::string mFileName;
     size_t mIndexOffset = 0;
+    size_t mVersion     = kLongTraceVersionId;
 
     std::vector<FileBlockInfo> mFileIndex;
+    std::vector<FrameAccessInfo> mFrameAccessProfile;
+    uint32_t mCaptureFrameIndex = 0;
+
+    // Only the data still in memory is indexed, so a duplicate is compared before it's used, and
+    // reading it at replay never swaps in an older block.
+    Deduplication mDeduplication = Deduplication::Exact;
+    HashMap<uint64_t, StoredPayload> mPayloadIndex;
+    // Hash of the windows selected by the rolling hash -> offset of the window
+    HashMap<uint64_t, size_t> mWindowIndex;
+    size_t mDeduplicatedPayloads     = 0;
+    size_t mDeduplicatedBytes        = 0;
+    double mDeduplicationTimeSeconds = 0.0;
 
     uint32_t mStoredBlocks                = 0;
     size_t mCurrentTransientLoadedBlockId = kInvalidBlockId;
@@ -143,6 +240,37 @@ class FrameCaptureBinaryData
     bool mCaptureComplete = false;
 
     FileStream *mFileStream = nullptr;
+
+    // Once the resident blocks are full, each block is compressed and written by a thread while
+    // append() fills the next one.  The blocks waiting to be written count towards the resident
+    // size.
+    bool mAsyncStore = true;
+    std::thread mStoreThread;
+    std::mutex mStoreMutex;
+    std::condition_variable mStoreCondition;
+    std::deque<PendingStoreBlock> mStoreQueue;
+    size_t mPendingStoreBlocks = 0;
+    bool mStoreExit            = false;
+
+    // Uncompressed binary data is mapped, and its blocks are used in place.
+    const uint8_t *mMappedData = nullptr;
+    size_t mMappedSize         = 0;
+
+    // Compressed binary data that doesn't fit in the resident blocks is decompressed ahead of the
+    // replay by a thread, one block at a time.  The replay swaps the prefetched block into the
+    // swap slot instead of loading it.
+    std::thread mPrefetchThread;
+    std::mutex mPrefetchMutex;
+    std::condition_variable mPrefetchCondition;
+    std::unique_ptr<FileStream> mPrefetchFileStream;
+    std::vector<uint8_t> mPrefetchBuffer;
+    size_t mPrefetchRequestedBlockId = kInvalidBlockId;
+    size_t mPrefetchedBlockId        = kInvalidBlockId;
+    bool mPrefetchExit               = false;
+    // Position in the frame access profile of the last block the replay read.
+    size_t mFrameAccessPosition = 0;
+
+    double mStallTimeSeconds = 0.0;
 };
 
 constexpr int kSeekBegin = SEEK_SET;
@@ -0,0 +1,237 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// frame_capture_binary_data_unittest.cpp:
+//   Tests of the deduplication of the payloads appended to FrameCaptureBinaryData.
+//
+
+#include "common/frame_capture_binary_data.h"
+
+#include <gtest/gtest.h>
+
+#include "common/system_utils.h"
+#include "util/test_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr size_t kBlockSize = 4096;
+// Four resident blocks before the blocks are written to the file one at a time.
+constexpr size_t kResidentSize = 4 * kBlockSize;
+
+// Bytes that don't repeat.  The rolling hash finds anchors in the parts of the payloads the tests
+// look for with it.
+std::vector<uint8_t> MakePayload(size_t size, uint32_t seed)
+{
+    std::vector<uint8_t> payload(size);
+    uint32_t state = seed * 2654435761u + 1;
+    for (uint8_t &byte : payload)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+    return payload;
+}
+
+class FrameCaptureBinaryDataTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        Optional<std::string> path = CreateTemporaryFile();
+        ASSERT_TRUE(path.valid());
+        mPath = path.value();
+
+        mBinaryData.setBlockSize(kBlockSize);
+        mBinaryData.setBinaryDataSize(kResidentSize);
+        mBinaryData.setAsyncStore(false);
+    }
+
+    void TearDown() override { DeleteSystemFile(mPath.c_str()); }
+
+    void startStore(FrameCaptureBinaryData::Deduplication deduplication)
+    {
+        mBinaryData.setDeduplication(deduplication);
+        mBinaryData.initializeBinaryDataStore(false, "", mPath);
+    }
+
+    size_t append(const std::vector<uint8_t> &payload, size_t offset = 0, size_t size = 0)
+    {
+        size_t appendSize = size == 0 ? payload.size() - offset : size;
+        size_t result     = mBinaryData.append(payload.data() + offset, appendSize);
+        mExpected.push_back({result, std::vector<uint8_t>(payload.begin() + offset,
+                                                          payload.begin() + offset + appendSize)});
+        return result;
+    }
+
+    // Closes the file and checks that every appended payload is read back from the offset that
+    // append() returned for it.
+    void expectReplayedPayloads()
+    {
+        BinaryFileIndexInfo indexInfo = mBinaryData.closeBinaryDataStore();
+
+        FrameCaptureBinaryData loader;
+        loader.configureBinaryDataLoader(indexInfo.version, false, indexInfo.blockCount,
+                                         indexInfo.blockSize, indexInfo.residentSize,
+                                         indexInfo.indexOffset, mPath);
+        loader.initializeBinaryDataLoader();
+
+        for (const ExpectedPayload &expected : mExpected)
+        {
+            // Payloads never straddle blocks, so they are read in one piece.
+            EXPECT_LE(expected.offset % kBlockSize + expected.data.size(), kBlockSize);
+            const uint8_t *data = loader.getData(expected.offset);
+            EXPECT_EQ(0, memcmp(data, expected.data.data(), expected.data.size()))
+                << "Payload at offset " << expected.offset;
+        }
+
+        loader.closeBinaryDataLoader();
+    }
+
+    struct ExpectedPayload
+    {
+        size_t offset;
+        std::vector<uint8_t> data;
+    };
+
+    FrameCaptureBinaryData mBinaryData;
+    std::string mPath;
+    std::vector<ExpectedPayload> mExpected;
+};
+
+// Test that identical payloads are stored once.
+TEST_F(FrameCaptureBinaryDataTest, ExactDuplicate)
+{
+    startStore(FrameCaptureBinaryData::Deduplication::Exact);
+
+    std::vector<uint8_t> first  = MakePayload(1000, 1);
+    std::vector<uint8_t> second = MakePayload(1000, 2);
+
+    size_t firstOffset  = append(first);
+    size_t secondOffset = append(second);
+    EXPECT_NE(firstOffset, secondOffset);
+
+    size_t sizeBefore = mBinaryData.totalSize();
+    EXPECT_EQ(firstOffset, append(first));
+    EXPECT_EQ(secondOffset, append(second));
+    EXPECT_EQ(sizeBefore, mBinaryData.totalSize());
+
+    // A payload of the same size and different bytes is not a duplicate.
+    std::vector<uint8_t> changed = first;
+    changed[500] ^= 1;
+    EXPECT_EQ(sizeBefore, append(changed));
+
+    expectReplayedPayloads();
+}
+
+// Test that every payload is stored when deduplication is disabled.
+TEST_F(FrameCaptureBinaryDataTest, Disabled)
+{
+    startStore(FrameCaptureBinaryData::Deduplication::Disabled);
+
+    std::vector<uint8_t> payload = MakePayload(1000, 1);
+
+    size_t firstOffset = append(payload);
+    EXPECT_NE(firstOffset, append(payload));
+
+    expectReplayedPayloads();
+}
+
+// Test that a part of an earlier payload is found by the rolling hash, and only by it.
+TEST_F(FrameCaptureBinaryDataTest, RollingSubRange)
+{
+    startStore(FrameCaptureBinaryData::Deduplication::Rolling);
+
+    std::vector<uint8_t> whole = MakePayload(2048, 3);
+
+    size_t wholeOffset = append(whole);
+    size_t sizeBefore  = mBinaryData.totalSize();
+
+    // Parts starting at aligned offsets in the payload are found.
+    EXPECT_EQ(wholeOffset + 512, append(whole, 512, 1024));
+    EXPECT_EQ(wholeOffset + 1024, append(whole, 1024));
+    EXPECT_EQ(sizeBefore, mBinaryData.totalSize());
+
+    // Windows are only hashed at aligned offsets, so an unaligned part is stored again.
+    EXPECT_EQ(sizeBefore, append(whole, 520, 1024));
+
+    expectReplayedPayloads();
+}
+
+// Test that the exact deduplication doesn't look for parts of earlier payloads.
+TEST_F(FrameCaptureBinaryDataTest, ExactIgnoresSubRange)
+{
+    startStore(FrameCaptureBinaryData::Deduplication::Exact);
+
+    std::vector<uint8_t> whole = MakePayload(2048, 3);
+
+    append(whole);
+    size_t sizeBefore = mBinaryData.totalSize();
+    EXPECT_EQ(sizeBefore, append(whole, 512, 1024));
+
+    expectReplayedPayloads();
+}
+
+// Test that payloads in earlier resident blocks are found after new blocks are started.
+TEST_F(FrameCaptureBinaryDataTest, AcrossBlocks)
+{
+    startStore(FrameCaptureBinaryData::Deduplication::Rolling);
+
+    std::vector<uint8_t> first = MakePayload(3072, 4);
+    std::vector<uint8_t> large = MakePayload(3072, 5);
+
+    size_t firstOffset = append(first);
+    EXPECT_EQ(0u, firstOffset / kBlockSize);
+
+    // Doesn't fit in the rest of the first block, so starts the second one.
+    size_t largeOffset = append(large);
+    EXPECT_EQ(kBlockSize, largeOffset);
+
+    // Found in the first block while the second one is being filled.
+    EXPECT_EQ(firstOffset, append(first));
+    EXPECT_EQ(firstOffset + 512, append(first, 512, 2048));
+    EXPECT_EQ(largeOffset + 1024, append(large, 1024));
+    EXPECT_EQ(kBlockSize + large.size(), mBinaryData.totalSize());
+
+    expectReplayedPayloads();
+}
+
+// Test that once the resident blocks are written to the file, only the payloads of the block
+// being filled are found.
+TEST_F(FrameCaptureBinaryDataTest, SwapMode)
+{
+    startStore(FrameCaptureBinaryData::Deduplication::Rolling);
+
+    std::vector<uint8_t> early = MakePayload(3072, 1);
+    size_t earlyOffset         = append(early);
+
+    // Fill the resident blocks, and the first block that is written on its own.
+    for (uint32_t block = 1; block <= kResidentSize / kBlockSize; ++block)
+    {
+        EXPECT_EQ(block * kBlockSize, append(MakePayload(3072, 100 + block)));
+    }
+    ASSERT_TRUE(mBinaryData.isSwapMode());
+
+    // The early payload was written to the file, so it's stored again.
+    size_t earlyAgainOffset = append(early);
+    EXPECT_NE(earlyOffset, earlyAgainOffset);
+    EXPECT_EQ(kResidentSize + kBlockSize, earlyAgainOffset);
+
+    // Which is found while its block is being filled.
+    EXPECT_EQ(earlyAgainOffset, append(early));
+    EXPECT_EQ(earlyAgainOffset + 512, append(early, 512, 1024));
+
+    // And isn't anymore once that block is written too.
+    std::vector<uint8_t> next = MakePayload(3072, 2);
+    size_t nextOffset         = append(next);
+    EXPECT_EQ(earlyAgainOffset + kBlockSize, nextOffset);
+    EXPECT_EQ(nextOffset + next.size(), append(early, 512, 1024));
+
+    expectReplayedPayloads();
+}
+}  // anonymous namespace
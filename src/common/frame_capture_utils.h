@@ -125,6 +125,7 @@ class ParamBuffer final : angle::NonCopyable
 
     bool empty() const { return mParamCaptures.empty(); }
     const std::vector<ParamCapture> &getParamCaptures() const { return mParamCaptures; }
+    std::vector<ParamCapture> &getParamCaptures() { return mParamCaptures; }
 
     const char *getNextParamName();
 
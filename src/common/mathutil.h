@@ -219,8 +219,8 @@ inline unsigned short float32ToFloat16(float fp32)
     {  // NaN
         return 0x7FFF;
     }
-    else if (abs > 0x47FFEFFF)
-    {  // Infinity
+    else if (abs >= 0x477FF000)
+    {  // Infinity, including the values from 65520 which round up to it
         return static_cast<uint16_t>(sign | 0x7C00);
     }
     else if (abs < 0x38800000)  // Denormal
@@ -230,7 +230,9 @@ inline unsigned short float32ToFloat16(float fp32)
 
         if (e < 24)
         {
-            abs = mantissa >> e;
+            // Keep the shifted out bits as a sticky bit, so values just above a midpoint are not
+            // rounded as if they were on it.
+            abs = (mantissa >> e) | ((mantissa & ((1u << e) - 1)) != 0);
         }
         else
         {
@@ -555,6 +555,19 @@ TEST(MathUtilTest, Float32ToFloat16)
     ASSERT_TRUE(nan16 > 0xFC00 || (nan16 < 0x8000 && nan16 > 0x7C00));
 
     ASSERT_EQ(float32ToFloat16(1.0f), 0x3C00);
+
+    // Values from halfway between the largest half-float and the next power of two overflow.
+    ASSERT_EQ(float32ToFloat16(65504.0f), 0x7BFF);
+    ASSERT_EQ(float32ToFloat16(65519.996f), 0x7BFF);
+    ASSERT_EQ(float32ToFloat16(65520.0f), 0x7C00);
+    ASSERT_EQ(float32ToFloat16(70000.0f), 0x7C00);
+    ASSERT_EQ(float32ToFloat16(-100000.0f), 0xFC00);
+
+    // Denormals on a midpoint round to even, and just above it round up.
+    ASSERT_EQ(float32ToFloat16(0x1.8p-24f), 0x0002);
+    ASSERT_EQ(float32ToFloat16(0x1.0p-25f), 0x0000);
+    ASSERT_EQ(float32ToFloat16(0x1.00002p-25f), 0x0001);
+    ASSERT_EQ(float32ToFloat16(0x1.40002p-23f), 0x0003);
 }
 
 // Tests the RGB float to 999E5 conversion
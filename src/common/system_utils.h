@@ -15,6 +15,7 @@
 #include <functional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace angle
 {
@@ -192,6 +193,20 @@ bool UnprotectMemory(uintptr_t start, size_t size);
 
 size_t GetPageSize();
 
+// Soft-dirty page tracking, where the kernel records which pages were written since the bits were
+// last cleared.  Only Linux kernels built with CONFIG_MEM_SOFT_DIRTY track the bits, so callers
+// have to check that a write is actually reported.  Elsewhere these return false.
+bool ClearSoftDirtyPages();
+// Reads the soft-dirty bits of |pageCount| pages starting at the page aligned |start|.
+bool GetSoftDirtyPages(uintptr_t start, size_t pageCount, std::vector<bool> *dirtyPagesOut);
+
+// Maps the whole file at |path| read-only.  Returns nullptr if the file can't be mapped, in which
+// case it has to be read instead.
+const uint8_t *MapFileReadOnly(const char *path, size_t *sizeOut);
+void UnmapFile(const uint8_t *address, size_t size);
+// Hints that a range of a mapped file is about to be read, so it can be paged in ahead of time.
+void PrefetchMappedFile(const uint8_t *address, size_t size);
+
 // Return type of the PageFaultCallback
 enum class PageFaultHandlerRangeType
 {
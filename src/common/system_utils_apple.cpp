@@ -65,4 +65,14 @@ void SetCurrentThreadName(const char *name)
 {
     pthread_setname_np(name);
 }
+
+bool ClearSoftDirtyPages()
+{
+    return false;
+}
+
+bool GetSoftDirtyPages(uintptr_t start, size_t pageCount, std::vector<bool> *dirtyPagesOut)
+{
+    return false;
+}
 }  // namespace angle
@@ -13,6 +13,7 @@
 #include "common/debug.h"
 #include "system_utils.h"
 
+#include <fcntl.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -23,6 +24,12 @@
 
 namespace angle
 {
+namespace
+{
+// See Documentation/admin-guide/mm/soft-dirty.rst and pagemap.rst in the kernel tree.
+constexpr uint64_t kPagemapSoftDirtyBit = uint64_t(1) << 55;
+}  // namespace
+
 std::string GetExecutablePath()
 {
     // We cannot use lstat to get the size of /proc/self/exe as it always returns 0
@@ -65,4 +72,41 @@ void SetCurrentThreadName(const char *name)
     ASSERT(strlen(name) < 16);
     pthread_setname_np(pthread_self(), name);
 }
+
+bool ClearSoftDirtyPages()
+{
+    // Writing 4 clears the soft-dirty bits of every page in the process.
+    static int clearRefsFd = open("/proc/self/clear_refs", O_WRONLY | O_CLOEXEC);
+    return clearRefsFd >= 0 && write(clearRefsFd, "4", 1) == 1;
+}
+
+bool GetSoftDirtyPages(uintptr_t start, size_t pageCount, std::vector<bool> *dirtyPagesOut)
+{
+    static int pagemapFd = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    if (pagemapFd < 0)
+    {
+        return false;
+    }
+
+#if defined(__aarch64__)
+    // Heap pointers may carry a tag in their top byte, which is not part of the virtual address.
+    start &= (uint64_t(1) << 56) - 1;
+#endif
+
+    // pagemap has one 64-bit entry per virtual page.
+    std::vector<uint64_t> entries(pageCount);
+    size_t readSize = pageCount * sizeof(uint64_t);
+    off_t offset    = static_cast<off_t>(start / GetPageSize() * sizeof(uint64_t));
+    if (pread(pagemapFd, entries.data(), readSize, offset) != static_cast<ssize_t>(readSize))
+    {
+        return false;
+    }
+
+    dirtyPagesOut->resize(pageCount);
+    for (size_t page = 0; page < pageCount; page++)
+    {
+        (*dirtyPagesOut)[page] = (entries[page] & kPagemapSoftDirtyBit) != 0;
+    }
+    return true;
+}
 }  // namespace angle
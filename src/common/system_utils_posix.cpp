@@ -17,6 +17,7 @@
 #include <iostream>
 
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <grp.h>
 #include <inttypes.h>
 #include <pwd.h>
@@ -499,6 +500,47 @@ size_t GetPageSize()
     return static_cast<size_t>(pageSize);
 }
 
+const uint8_t *MapFileReadOnly(const char *path, size_t *sizeOut)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    void *address = MAP_FAILED;
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        address =
+            mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+
+    // The mapping stays valid once the file is closed.
+    close(fd);
+
+    if (address == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    *sizeOut = static_cast<size_t>(fileStat.st_size);
+    return static_cast<const uint8_t *>(address);
+}
+
+void UnmapFile(const uint8_t *address, size_t size)
+{
+    munmap(const_cast<uint8_t *>(address), size);
+}
+
+void PrefetchMappedFile(const uint8_t *address, size_t size)
+{
+    // madvise() takes a page aligned address.
+    uintptr_t start = reinterpret_cast<uintptr_t>(address) & ~(GetPageSize() - 1);
+    uintptr_t end   = reinterpret_cast<uintptr_t>(address) + size;
+    madvise(reinterpret_cast<void *>(start), end - start, MADV_WILLNEED);
+}
+
 PageFaultHandler *CreatePageFaultHandler(PageFaultCallback callback)
 {
     gPosixPageFaultHandler = new PosixPageFaultHandler(callback);
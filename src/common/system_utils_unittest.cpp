@@ -218,9 +218,11 @@ TEST(SystemUtils, IsFullPath)
 #if defined(ANGLE_PLATFORM_ANDROID)
 #    define MAYBE_CreateAndDeleteTemporaryFile DISABLED_CreateAndDeleteTemporaryFile
 #    define MAYBE_CreateAndDeleteFileInTempDir DISABLED_CreateAndDeleteFileInTempDir
+#    define MAYBE_MapFileReadOnly DISABLED_MapFileReadOnly
 #else
 #    define MAYBE_CreateAndDeleteTemporaryFile CreateAndDeleteTemporaryFile
 #    define MAYBE_CreateAndDeleteFileInTempDir CreateAndDeleteFileInTempDir
+#    define MAYBE_MapFileReadOnly MapFileReadOnly
 #endif  // defined(ANGLE_PLATFORM_ANDROID)
 
 // Test creating/using temporary file
@@ -286,6 +288,34 @@ TEST(SystemUtils, MAYBE_CreateAndDeleteFileInTempDir)
     EXPECT_TRUE(DeleteSystemFile(path.value().c_str()));
 }
 
+// Test mapping a file in memory
+TEST(SystemUtils, MAYBE_MapFileReadOnly)
+{
+    Optional<std::string> path = CreateTemporaryFile();
+    ASSERT_TRUE(path.valid());
+    ASSERT_TRUE(!path.value().empty());
+
+    const std::string testContents = "test output";
+
+    std::ofstream out;
+    out.open(path.value(), std::ios::binary);
+    ASSERT_TRUE(out.is_open());
+    out << testContents;
+    EXPECT_TRUE(out.good());
+    out.close();
+
+    size_t size         = 0;
+    const uint8_t *data = MapFileReadOnly(path.value().c_str(), &size);
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(size, testContents.size());
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(data), size), testContents);
+
+    PrefetchMappedFile(data, size);
+    UnmapFile(data, size);
+
+    EXPECT_TRUE(DeleteSystemFile(path.value().c_str()));
+}
+
 // Test retrieving page size
 TEST(SystemUtils, PageSize)
 {
@@ -293,6 +323,33 @@ TEST(SystemUtils, PageSize)
     EXPECT_TRUE(pageSize > 0);
 }
 
+// Test that a write is reported by the soft-dirty bits after they are cleared
+TEST(SystemUtils, SoftDirtyPages)
+{
+    size_t pageSize = GetPageSize();
+    EXPECT_TRUE(pageSize > 0);
+
+    std::vector<uint8_t> data(pageSize * 2);
+    uintptr_t pageStart = rx::roundUpPow2(reinterpret_cast<uintptr_t>(data.data()), pageSize);
+    volatile uint8_t *pageData = reinterpret_cast<volatile uint8_t *>(pageStart);
+
+    // Soft-dirty bits are only tracked by some kernels.
+    std::vector<bool> dirtyPages;
+    *pageData = 1;
+    if (!GetSoftDirtyPages(pageStart, 1, &dirtyPages) || !dirtyPages[0])
+    {
+        return;
+    }
+
+    ASSERT_TRUE(ClearSoftDirtyPages());
+    ASSERT_TRUE(GetSoftDirtyPages(pageStart, 1, &dirtyPages));
+    EXPECT_FALSE(dirtyPages[0]);
+
+    *pageData = 2;
+    ASSERT_TRUE(GetSoftDirtyPages(pageStart, 1, &dirtyPages));
+    EXPECT_TRUE(dirtyPages[0]);
+}
+
 // mprotect is not supported on Fuchsia right now.
 #if defined(ANGLE_PLATFORM_FUCHSIA)
 #    define MAYBE_PageFaultHandlerInit DISABLED_PageFaultHandlerInit
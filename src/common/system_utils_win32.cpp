@@ -227,6 +227,57 @@ size_t GetPageSize()
     return static_cast<size_t>(info.dwPageSize);
 }
 
+const uint8_t *MapFileReadOnly(const char *path, size_t *sizeOut)
+{
+    HANDLE file = CreateFileW(Widen(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    const uint8_t *address = nullptr;
+    LARGE_INTEGER fileSize = {};
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+        {
+            address = static_cast<const uint8_t *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            // The view keeps the mapping alive.
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+
+    if (address)
+    {
+        *sizeOut = static_cast<size_t>(fileSize.QuadPart);
+    }
+    return address;
+}
+
+void UnmapFile(const uint8_t *address, size_t size)
+{
+    UnmapViewOfFile(address);
+}
+
+void PrefetchMappedFile(const uint8_t *address, size_t size)
+{
+    WIN32_MEMORY_RANGE_ENTRY range = {const_cast<uint8_t *>(address), size};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+bool ClearSoftDirtyPages()
+{
+    return false;
+}
+
+bool GetSoftDirtyPages(uintptr_t start, size_t pageCount, std::vector<bool> *dirtyPagesOut)
+{
+    return false;
+}
+
 PageFaultHandler *CreatePageFaultHandler(PageFaultCallback callback)
 {
     gWin32PageFaultHandler = new Win32PageFaultHandler(callback);
@@ -104,6 +104,29 @@ size_t GetPageSize()
     return 4096;
 }
 
+const uint8_t *MapFileReadOnly(const char *path, size_t *sizeOut)
+{
+    // Not available on UWP, the file is read instead.
+    return nullptr;
+}
+
+void UnmapFile(const uint8_t *address, size_t size)
+{
+    UNREACHABLE();
+}
+
+void PrefetchMappedFile(const uint8_t *address, size_t size) {}
+
+bool ClearSoftDirtyPages()
+{
+    return false;
+}
+
+bool GetSoftDirtyPages(uintptr_t start, size_t pageCount, std::vector<bool> *dirtyPagesOut)
+{
+    return false;
+}
+
 PageFaultHandler *CreatePageFaultHandler(PageFaultCallback callback)
 {
     return new UwpPageFaultHandler(callback);
@@ -202,6 +202,17 @@ class TCompiler : public TShHandleBase
 
     sh::GLenum getShaderType() const { return mShaderType; }
 
+    // The thread pool that the translation of the shader may be split over, see
+    // sh::SetWorkerThreadPool().
+    void setWorkerThreadPool(std::shared_ptr<angle::WorkerThreadPool> threadPool)
+    {
+        mWorkerThreadPool = std::move(threadPool);
+    }
+    const std::shared_ptr<angle::WorkerThreadPool> &getWorkerThreadPool() const
+    {
+        return mWorkerThreadPool;
+    }
+
     // Generate a self-contained binary representation of the shader.
     bool getShaderBinary(const ShHandle compilerHandle,
                          const char *const shaderStrings[],
@@ -395,6 +406,8 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     ShCompileOptions mCompileOptions;
+
+    std::shared_ptr<angle::WorkerThreadPool> mWorkerThreadPool;
 };
 
 //
@@ -432,6 +432,13 @@ void ClearResults(const ShHandle handle)
     compiler->clearResults();
 }
 
+void SetWorkerThreadPool(const ShHandle handle, std::shared_ptr<angle::WorkerThreadPool> threadPool)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    compiler->setWorkerThreadPool(std::move(threadPool));
+}
+
 int GetShaderVersion(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
@@ -55,6 +55,11 @@ bool CheckShaderType(Shader expected, GLenum actual)
     }
 }
 
+size_t HashName(const ImmutableString &name)
+{
+    return ImmutableString::FowlerNollVoHash<sizeof(size_t)>()(name);
+}
+
 bool CheckExtension(uint32_t extensionIndex, const ShBuiltInResources &resources)
 {
     const int *resourcePtr = reinterpret_cast<const int *>(&resources);
@@ -62,9 +67,14 @@ bool CheckExtension(uint32_t extensionIndex, const ShBuiltInResources &resources
 }
 }  // namespace
 
+// A scope of user-defined symbols.  Levels are allocated from the compile's pool and store their
+// symbols in a flat open-addressing table keyed by name.  The hash of each name is stored with the
+// entry, and lookups take a precomputed hash so that searching through nested scopes only hashes
+// the name once.
 class TSymbolTable::TSymbolTableLevel
 {
   public:
+    POOL_ALLOCATOR_NEW_DELETE
     TSymbolTableLevel() = default;
 
     bool insert(TSymbol *symbol);
@@ -72,37 +82,111 @@ class TSymbolTable::TSymbolTableLevel
     // Insert a function using its unmangled name as the key.
     void insertUnmangled(TFunction *function);
 
-    TSymbol *find(const ImmutableString &name) const;
+    TSymbol *find(const ImmutableString &name, size_t hash) const;
 
   private:
-    using tLevel        = TUnorderedMap<ImmutableString,
-                                        TSymbol *,
-                                        ImmutableString::FowlerNollVoHash<sizeof(size_t)>>;
-    using tLevelPair    = const tLevel::value_type;
-    using tInsertResult = std::pair<tLevel::iterator, bool>;
-
-    tLevel level;
+    struct Entry
+    {
+        size_t hash;
+        ImmutableString name;
+        // nullptr for empty slots.
+        TSymbol *symbol;
+    };
+
+    bool insert(const ImmutableString &name, TSymbol *symbol);
+    void grow();
+
+    // Power of two size, or empty if nothing has been inserted yet.
+    TVector<Entry> mEntries;
+    size_t mSymbolCount = 0;
 };
 
 bool TSymbolTable::TSymbolTableLevel::insert(TSymbol *symbol)
 {
     // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(symbol->getMangledName(), symbol));
-    return result.second;
+    return insert(symbol->getMangledName(), symbol);
 }
 
 void TSymbolTable::TSymbolTableLevel::insertUnmangled(TFunction *function)
 {
-    level.insert(tLevelPair(function->name(), function));
+    insert(function->name(), function);
+}
+
+bool TSymbolTable::TSymbolTableLevel::insert(const ImmutableString &name, TSymbol *symbol)
+{
+    ASSERT(symbol != nullptr);
+
+    // Keep the load factor at or below one half so probe sequences stay short.
+    if ((mSymbolCount + 1) * 2 > mEntries.size())
+    {
+        grow();
+    }
+
+    const size_t hash = HashName(name);
+    const size_t mask = mEntries.size() - 1;
+    for (size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        Entry &entry = mEntries[index];
+        if (entry.symbol == nullptr)
+        {
+            entry.hash   = hash;
+            entry.name   = name;
+            entry.symbol = symbol;
+            ++mSymbolCount;
+            return true;
+        }
+        if (entry.hash == hash && entry.name == name)
+        {
+            return false;
+        }
+    }
+}
+
+void TSymbolTable::TSymbolTableLevel::grow()
+{
+    constexpr size_t kInitialSize = 8;
+    const size_t newSize          = mEntries.empty() ? kInitialSize : mEntries.size() * 2;
+
+    TVector<Entry> oldEntries(newSize, Entry{0, kEmptyImmutableString, nullptr});
+    mEntries.swap(oldEntries);
+
+    const size_t mask = newSize - 1;
+    for (const Entry &oldEntry : oldEntries)
+    {
+        if (oldEntry.symbol == nullptr)
+        {
+            continue;
+        }
+
+        size_t index = oldEntry.hash & mask;
+        while (mEntries[index].symbol != nullptr)
+        {
+            index = (index + 1) & mask;
+        }
+        mEntries[index] = oldEntry;
+    }
 }
 
-TSymbol *TSymbolTable::TSymbolTableLevel::find(const ImmutableString &name) const
+TSymbol *TSymbolTable::TSymbolTableLevel::find(const ImmutableString &name, size_t hash) const
 {
-    tLevel::const_iterator it = level.find(name);
-    if (it == level.end())
+    if (mSymbolCount == 0)
+    {
         return nullptr;
-    else
-        return (*it).second;
+    }
+
+    const size_t mask = mEntries.size() - 1;
+    for (size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        const Entry &entry = mEntries[index];
+        if (entry.symbol == nullptr)
+        {
+            return nullptr;
+        }
+        if (entry.hash == hash && entry.name == name)
+        {
+            return entry.symbol;
+        }
+    }
 }
 
 TSymbolTable::TSymbolTable()
@@ -127,7 +211,8 @@ bool TSymbolTable::atGlobalLevel() const
 
 void TSymbolTable::push()
 {
-    mTable.emplace_back(new TSymbolTableLevel);
+    // Levels are pool allocated and are freed along with the rest of the compilation results.
+    mTable.push_back(new TSymbolTableLevel);
     mPrecisionStack.emplace_back(new PrecisionStackLevel);
 }
 
@@ -237,13 +322,19 @@ const TVariable *TSymbolTable::gl_SecondaryFragDataEXT() const
 
 TSymbolTable::VariableMetadata *TSymbolTable::getOrCreateVariableMetadata(const TVariable &variable)
 {
-    int id    = variable.uniqueId().get();
-    auto iter = mVariableMetadata.find(id);
-    if (iter == mVariableMetadata.end())
+    const size_t id = static_cast<size_t>(variable.uniqueId().get());
+    if (id >= mVariableMetadata.size())
     {
-        iter = mVariableMetadata.insert(std::make_pair(id, VariableMetadata())).first;
+        mVariableMetadata.resize(id + 1);
     }
-    return &iter->second;
+    return &mVariableMetadata[id];
+}
+
+const TSymbolTable::VariableMetadata *TSymbolTable::findVariableMetadata(
+    const TVariable &variable) const
+{
+    const size_t id = static_cast<size_t>(variable.uniqueId().get());
+    return id < mVariableMetadata.size() ? &mVariableMetadata[id] : nullptr;
 }
 
 void TSymbolTable::markStaticUse(const TVariable &variable)
@@ -255,9 +346,8 @@ void TSymbolTable::markStaticUse(const TVariable &variable)
 bool TSymbolTable::isStaticallyUsed(const TVariable &variable) const
 {
     ASSERT(!variable.getConstPointer());
-    int id    = variable.uniqueId().get();
-    auto iter = mVariableMetadata.find(id);
-    return iter != mVariableMetadata.end() && iter->second.staticUse;
+    const VariableMetadata *metadata = findVariableMetadata(variable);
+    return metadata != nullptr && metadata->staticUse;
 }
 
 void TSymbolTable::addInvariantVarying(const TVariable &variable)
@@ -274,9 +364,8 @@ bool TSymbolTable::isVaryingInvariant(const TVariable &variable) const
     {
         return true;
     }
-    int id    = variable.uniqueId().get();
-    auto iter = mVariableMetadata.find(id);
-    return iter != mVariableMetadata.end() && iter->second.invariant;
+    const VariableMetadata *metadata = findVariableMetadata(variable);
+    return metadata != nullptr && metadata->invariant;
 }
 
 void TSymbolTable::setGlobalInvariant(bool invariant)
@@ -298,10 +387,11 @@ const TSymbol *TSymbolTable::find(const ImmutableString &name, int shaderVersion
 
 const TSymbol *TSymbolTable::findUserDefined(const ImmutableString &name) const
 {
+    const size_t hash    = HashName(name);
     int userDefinedLevel = static_cast<int>(mTable.size()) - 1;
     while (userDefinedLevel >= 0)
     {
-        const TSymbol *symbol = mTable[userDefinedLevel]->find(name);
+        const TSymbol *symbol = mTable[userDefinedLevel]->find(name, hash);
         if (symbol)
         {
             return symbol;
@@ -316,13 +406,13 @@ TFunction *TSymbolTable::findUserDefinedFunction(const ImmutableString &name) co
 {
     // User-defined functions are always declared at the global level.
     ASSERT(!mTable.empty());
-    return static_cast<TFunction *>(mTable[0]->find(name));
+    return static_cast<TFunction *>(mTable[0]->find(name, HashName(name)));
 }
 
 const TSymbol *TSymbolTable::findGlobal(const ImmutableString &name) const
 {
     ASSERT(!mTable.empty());
-    return mTable[0]->find(name);
+    return mTable[0]->find(name, HashName(name));
 }
 
 bool TSymbolTable::declare(TSymbol *symbol)
@@ -303,8 +303,9 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
                                     const ShBuiltInResources &resources);
 
     VariableMetadata *getOrCreateVariableMetadata(const TVariable &variable);
+    const VariableMetadata *findVariableMetadata(const TVariable &variable) const;
 
-    std::vector<std::unique_ptr<TSymbolTableLevel>> mTable;
+    std::vector<TSymbolTableLevel *> mTable;
 
     // There's one precision stack level for predefined precisions and then one level for each scope
     // in table.
@@ -321,8 +322,10 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
     ShShaderSpec mShaderSpec;
     ShBuiltInResources mResources;
 
-    // Indexed by unique id. Map instead of vector since the variables are fairly sparse.
-    std::map<int, VariableMetadata> mVariableMetadata;
+    // Indexed by unique id.  Built-in ids are below kFirstUserDefinedSymbolId and user-defined ids
+    // are allocated sequentially after it, so a vector is compact enough and avoids a tree lookup
+    // for every symbol reference.  Cleared, but not deallocated, between compilations.
+    std::vector<VariableMetadata> mVariableMetadata;
 
     // Store gl_in variable with its array size once the array size can be determined. The array
     // size can also be checked against latter input primitive type declaration.
@@ -15,6 +15,7 @@
 #include "common/spirv/spirv_instruction_builder_autogen.h"
 #include "compiler/translator/ValidateVaryingLocations.h"
 #include "compiler/translator/blocklayout.h"
+#include "compiler/translator/spirv/VisitInstructionIds.h"
 #include "compiler/translator/util.h"
 
 namespace sh
@@ -625,6 +626,23 @@ SPIRVBuilder::SPIRVBuilder(TCompiler *compiler,
     predefineCommonTypes();
 }
 
+SPIRVBuilder::SPIRVBuilder(const SPIRVBuilder *moduleBuilder)
+    : mCompiler(moduleBuilder->mCompiler),
+      mCompileOptions(moduleBuilder->mCompileOptions),
+      mShaderType(moduleBuilder->mShaderType),
+      mUniqueToSpirvIdMap(moduleBuilder->mUniqueToSpirvIdMap),
+      mExtInstImportIdStd(moduleBuilder->mExtInstImportIdStd),
+      mNextAvailableId(moduleBuilder->mNextAvailableId),
+      mNextUnusedBinding(0),
+      mNextUnusedInputLocation(0),
+      mNextUnusedOutputLocation(0),
+      mOverviewFlags(0),
+      mModuleBuilder(moduleBuilder),
+      mFirstFunctionId(moduleBuilder->mNextAvailableId)
+{
+    ASSERT(!moduleBuilder->isFunctionBuilder());
+}
+
 spirv::IdRef SPIRVBuilder::getNewId(const SpirvDecorations &decorations)
 {
     spirv::IdRef newId = mNextAvailableId;
@@ -746,10 +764,31 @@ const SpirvTypeData &SPIRVBuilder::getSpirvTypeData(const SpirvType &type, const
     }
 
     ASSERT(type.typeSpec.precision != SPIRVPrecisionChoice::Unset);
+    if (isFunctionBuilder())
+    {
+        auto moduleIter = mModuleBuilder->mTypeMap.find(type);
+        if (moduleIter != mModuleBuilder->mTypeMap.end())
+        {
+            return moduleIter->second;
+        }
+    }
+
     auto iter = mTypeMap.find(type);
     if (iter == mTypeMap.end())
     {
-        SpirvTypeData newTypeData = declareType(type, block);
+        SpirvTypeData newTypeData;
+        if (isFunctionBuilder())
+        {
+            SpirvPendingDeclaration declaration;
+            declaration.kind  = SpirvPendingDeclaration::Kind::Type;
+            declaration.type  = type;
+            declaration.block = block;
+            newTypeData.id    = addPendingDeclaration(std::move(declaration));
+        }
+        else
+        {
+            newTypeData = declareType(type, block);
+        }
 
         iter = mTypeMap.insert({type, newTypeData}).first;
     }
@@ -769,16 +808,36 @@ spirv::IdRef SPIRVBuilder::getTypePointerId(spirv::IdRef typeId, spv::StorageCla
 {
     SpirvIdAndStorageClass key{typeId, storageClass};
 
+    if (isFunctionBuilder())
+    {
+        auto moduleIter = mModuleBuilder->mTypePointerIdMap.find(key);
+        if (moduleIter != mModuleBuilder->mTypePointerIdMap.end())
+        {
+            return moduleIter->second;
+        }
+    }
+
     auto iter = mTypePointerIdMap.find(key);
     if (iter == mTypePointerIdMap.end())
     {
-        // Note that some type pointers have predefined ids.
-        const spirv::IdRef typePointerId =
-            typeId == vk::spirv::kIdOutputPerVertexBlock
-                ? spirv::IdRef(vk::spirv::kIdOutputPerVertexTypePointer)
-                : getNewId({});
+        spirv::IdRef typePointerId;
+        if (isFunctionBuilder())
+        {
+            SpirvPendingDeclaration declaration;
+            declaration.kind         = SpirvPendingDeclaration::Kind::TypePointer;
+            declaration.typeId       = typeId;
+            declaration.storageClass = storageClass;
+            typePointerId            = addPendingDeclaration(std::move(declaration));
+        }
+        else
+        {
+            // Note that some type pointers have predefined ids.
+            typePointerId = typeId == vk::spirv::kIdOutputPerVertexBlock
+                                ? spirv::IdRef(vk::spirv::kIdOutputPerVertexTypePointer)
+                                : getNewId({});
 
-        spirv::WriteTypePointer(&mSpirvTypePointerDecls, typePointerId, storageClass, typeId);
+            spirv::WriteTypePointer(&mSpirvTypePointerDecls, typePointerId, storageClass, typeId);
+        }
 
         iter = mTypePointerIdMap.insert({key, typePointerId}).first;
     }
@@ -789,6 +848,9 @@ spirv::IdRef SPIRVBuilder::getTypePointerId(spirv::IdRef typeId, spv::StorageCla
 spirv::IdRef SPIRVBuilder::getFunctionTypeId(spirv::IdRef returnTypeId,
                                              const spirv::IdRefList &paramTypeIds)
 {
+    // Function types are only needed by function declarations, which are visited by the module.
+    ASSERT(!isFunctionBuilder());
+
     SpirvIdAndIdList key{returnTypeId, paramTypeIds};
 
     auto iter = mFunctionTypeIdMap.find(key);
@@ -1561,9 +1623,22 @@ spirv::IdRef SPIRVBuilder::getBoolConstant(bool value)
 {
     uint32_t asInt = static_cast<uint32_t>(value);
 
+    if (isFunctionBuilder() && mModuleBuilder->mBoolConstants[asInt].valid())
+    {
+        return mModuleBuilder->mBoolConstants[asInt];
+    }
+
     spirv::IdRef constantId = mBoolConstants[asInt];
 
-    if (!constantId.valid())
+    if (!constantId.valid() && isFunctionBuilder())
+    {
+        SpirvPendingDeclaration declaration;
+        declaration.kind      = SpirvPendingDeclaration::Kind::BasicConstant;
+        declaration.basicType = EbtBool;
+        declaration.value     = asInt;
+        mBoolConstants[asInt] = constantId = addPendingDeclaration(std::move(declaration));
+    }
+    else if (!constantId.valid())
     {
         SpirvType boolType;
         boolType.type = EbtBool;
@@ -1584,16 +1659,38 @@ spirv::IdRef SPIRVBuilder::getBoolConstant(bool value)
     return constantId;
 }
 
-spirv::IdRef SPIRVBuilder::getBasicConstantHelper(uint32_t value,
-                                                  TBasicType type,
-                                                  angle::HashMap<uint32_t, spirv::IdRef> *constants)
+spirv::IdRef SPIRVBuilder::getBasicConstantHelper(
+    uint32_t value,
+    TBasicType type,
+    angle::HashMap<uint32_t, spirv::IdRef> SPIRVBuilder::*constants)
 {
-    auto iter = constants->find(value);
-    if (iter != constants->end())
+    if (isFunctionBuilder())
+    {
+        const angle::HashMap<uint32_t, spirv::IdRef> &moduleConstants =
+            mModuleBuilder->*constants;
+        auto moduleIter = moduleConstants.find(value);
+        if (moduleIter != moduleConstants.end())
+        {
+            return moduleIter->second;
+        }
+    }
+
+    auto iter = (this->*constants).find(value);
+    if (iter != (this->*constants).end())
     {
         return iter->second;
     }
 
+    if (isFunctionBuilder())
+    {
+        SpirvPendingDeclaration declaration;
+        declaration.kind      = SpirvPendingDeclaration::Kind::BasicConstant;
+        declaration.basicType = type;
+        declaration.value     = value;
+        const spirv::IdRef constantId = addPendingDeclaration(std::move(declaration));
+        return (this->*constants).insert({value, constantId}).first->second;
+    }
+
     SpirvType spirvType;
     spirvType.type = type;
 
@@ -1603,18 +1700,18 @@ spirv::IdRef SPIRVBuilder::getBasicConstantHelper(uint32_t value,
     spirv::WriteConstant(&mSpirvTypeAndConstantDecls, typeId, constantId,
                          spirv::LiteralContextDependentNumber(value));
 
-    return constants->insert({value, constantId}).first->second;
+    return (this->*constants).insert({value, constantId}).first->second;
 }
 
 spirv::IdRef SPIRVBuilder::getUintConstant(uint32_t value)
 {
-    return getBasicConstantHelper(value, EbtUInt, &mUintConstants);
+    return getBasicConstantHelper(value, EbtUInt, &SPIRVBuilder::mUintConstants);
 }
 
 spirv::IdRef SPIRVBuilder::getIntConstant(int32_t value)
 {
     uint32_t asUint = static_cast<uint32_t>(value);
-    return getBasicConstantHelper(asUint, EbtInt, &mIntConstants);
+    return getBasicConstantHelper(asUint, EbtInt, &SPIRVBuilder::mIntConstants);
 }
 
 spirv::IdRef SPIRVBuilder::getFloatConstant(float value)
@@ -1625,25 +1722,41 @@ spirv::IdRef SPIRVBuilder::getFloatConstant(float value)
         uint32_t u;
     } asUint;
     asUint.f = value;
-    return getBasicConstantHelper(asUint.u, EbtFloat, &mFloatConstants);
+    return getBasicConstantHelper(asUint.u, EbtFloat, &SPIRVBuilder::mFloatConstants);
 }
 
 spirv::IdRef SPIRVBuilder::getNullConstant(spirv::IdRef typeId)
 {
-    if (typeId >= mNullConstants.size())
+    if (isFunctionBuilder())
     {
-        mNullConstants.resize(typeId + 1);
+        auto moduleIter = mModuleBuilder->mNullConstants.find(typeId);
+        if (moduleIter != mModuleBuilder->mNullConstants.end())
+        {
+            return moduleIter->second;
+        }
     }
 
-    if (!mNullConstants[typeId].valid())
+    auto iter = mNullConstants.find(typeId);
+    if (iter == mNullConstants.end())
     {
-        const spirv::IdRef constantId = getNewId({});
-        mNullConstants[typeId]        = constantId;
+        spirv::IdRef constantId;
+        if (isFunctionBuilder())
+        {
+            SpirvPendingDeclaration declaration;
+            declaration.kind   = SpirvPendingDeclaration::Kind::NullConstant;
+            declaration.typeId = typeId;
+            constantId         = addPendingDeclaration(std::move(declaration));
+        }
+        else
+        {
+            constantId = getNewId({});
+            spirv::WriteConstantNull(&mSpirvTypeAndConstantDecls, typeId, constantId);
+        }
 
-        spirv::WriteConstantNull(&mSpirvTypeAndConstantDecls, typeId, constantId);
+        iter = mNullConstants.insert({typeId, constantId}).first;
     }
 
-    return mNullConstants[typeId];
+    return iter->second;
 }
 
 spirv::IdRef SPIRVBuilder::getNullVectorConstantHelper(TBasicType type, int size)
@@ -1709,12 +1822,32 @@ spirv::IdRef SPIRVBuilder::getCompositeConstant(spirv::IdRef typeId, const spirv
 {
     SpirvIdAndIdList key{typeId, values};
 
+    if (isFunctionBuilder())
+    {
+        auto moduleIter = mModuleBuilder->mCompositeConstants.find(key);
+        if (moduleIter != mModuleBuilder->mCompositeConstants.end())
+        {
+            return moduleIter->second;
+        }
+    }
+
     auto iter = mCompositeConstants.find(key);
     if (iter == mCompositeConstants.end())
     {
-        const spirv::IdRef constantId = getNewId({});
-
-        spirv::WriteConstantComposite(&mSpirvTypeAndConstantDecls, typeId, constantId, values);
+        spirv::IdRef constantId;
+        if (isFunctionBuilder())
+        {
+            SpirvPendingDeclaration declaration;
+            declaration.kind         = SpirvPendingDeclaration::Kind::CompositeConstant;
+            declaration.typeId       = typeId;
+            declaration.componentIds = values;
+            constantId               = addPendingDeclaration(std::move(declaration));
+        }
+        else
+        {
+            constantId = getNewId({});
+            spirv::WriteConstantComposite(&mSpirvTypeAndConstantDecls, typeId, constantId, values);
+        }
 
         iter = mCompositeConstants.insert({key, constantId}).first;
     }
@@ -1722,6 +1855,12 @@ spirv::IdRef SPIRVBuilder::getCompositeConstant(spirv::IdRef typeId, const spirv
     return iter->second;
 }
 
+void SPIRVBuilder::startNewFunctionDeclaration()
+{
+    ASSERT(mSpirvCurrentFunctionBlocks.empty());
+    mSpirvFunctions.emplace_back();
+}
+
 void SPIRVBuilder::startNewFunction(spirv::IdRef functionId, const TFunction *func)
 {
     ASSERT(mSpirvCurrentFunctionBlocks.empty());
@@ -1736,21 +1875,36 @@ void SPIRVBuilder::startNewFunction(spirv::IdRef functionId, const TFunction *fu
 
 void SPIRVBuilder::assembleSpirvFunctionBlocks()
 {
-    // Take all the blocks and place them in the functions section of SPIR-V in sequence.
+    // OpLabel takes two words, and OpFunctionEnd (added after the blocks) one.
+    constexpr size_t kLabelSizeInWords       = 2;
+    constexpr size_t kFunctionEndSizeInWords = 1;
+
+    spirv::Blob *functionBlob = getSpirvCurrentFunction();
+
+    // Reserve space for the whole function at once, instead of repeatedly growing the blob for
+    // functions with many blocks.
+    size_t functionSize = functionBlob->size() + kFunctionEndSizeInWords;
+    for (const SpirvBlock &block : mSpirvCurrentFunctionBlocks)
+    {
+        functionSize += kLabelSizeInWords + block.localVariables.size() + block.body.size();
+    }
+    functionBlob->reserve(functionSize);
+
+    // Take all the blocks and place them in the function's SPIR-V in sequence.
     for (const SpirvBlock &block : mSpirvCurrentFunctionBlocks)
     {
         // Every block must be properly terminated.
         ASSERT(block.isTerminated);
 
         // Generate the OpLabel instruction for the block.
-        spirv::WriteLabel(&mSpirvFunctions, block.labelId);
+        spirv::WriteLabel(functionBlob, block.labelId);
 
         // Add the variable declarations if any.
-        mSpirvFunctions.insert(mSpirvFunctions.end(), block.localVariables.begin(),
-                               block.localVariables.end());
+        functionBlob->insert(functionBlob->end(), block.localVariables.begin(),
+                             block.localVariables.end());
 
         // Add the body of the block.
-        mSpirvFunctions.insert(mSpirvFunctions.end(), block.body.begin(), block.body.end());
+        functionBlob->insert(functionBlob->end(), block.body.begin(), block.body.end());
     }
 
     // Clean up.
@@ -1819,6 +1973,8 @@ spirv::IdRef SPIRVBuilder::declareVariable(spirv::IdRef typeId,
 
 spirv::IdRef SPIRVBuilder::declareSpecConst(TBasicType type, int id, const char *name)
 {
+    ASSERT(!isFunctionBuilder());
+
     SpirvType spirvType;
     spirvType.type = type;
 
@@ -2398,26 +2554,187 @@ ImmutableString SPIRVBuilder::getFieldName(const TField *field)
     return field->name();
 }
 
+spirv::IdRef SPIRVBuilder::addPendingDeclaration(SpirvPendingDeclaration &&declaration)
+{
+    ASSERT(isFunctionBuilder());
+
+    declaration.id = getNewId({});
+    mPendingDeclarations.push_back(std::move(declaration));
+    return mPendingDeclarations.back().id;
+}
+
+void SPIRVBuilder::relocateFunctionIds(spirv::Blob *blob,
+                                       spirv::IdRef firstFunctionId,
+                                       const std::vector<spirv::IdRef> &idMap)
+{
+    auto relocate = [&](uint32_t *id) {
+        if (*id >= firstFunctionId)
+        {
+            ASSERT(*id - firstFunctionId < idMap.size());
+            *id = idMap[*id - firstFunctionId];
+        }
+    };
+
+    for (size_t offset = 0; offset < blob->size();)
+    {
+        uint32_t *instruction = &(*blob)[offset];
+
+        spv::Op op;
+        uint32_t length;
+        spirv::GetInstructionOpAndLength(instruction, &op, &length);
+        ASSERT(length > 0 && offset + length <= blob->size());
+
+        uint32_t resultIndex = 0;
+        const bool isLayoutKnown = VisitInstructionIds(
+            instruction, &resultIndex, [&](uint32_t idIndex) { relocate(&instruction[idIndex]); });
+        // Every instruction the generator can write inside a function must be known.
+        ASSERT(isLayoutKnown);
+
+        if (resultIndex != 0)
+        {
+            relocate(&instruction[resultIndex]);
+        }
+
+        offset += length;
+    }
+}
+
+void SPIRVBuilder::mergeFunction(SPIRVBuilder *functionBuilder)
+{
+    ASSERT(!isFunctionBuilder() && functionBuilder->mModuleBuilder == this);
+    ASSERT(functionBuilder->mSpirvCurrentFunctionBlocks.empty());
+    ASSERT(functionBuilder->mConditionalStack.empty());
+
+    // A function builder only generates the function itself, the names and decorations of its ids
+    // and the global variables it declares (for constants that are not folded).  Everything else is
+    // in the pending declarations.
+    ASSERT(functionBuilder->mSpirvTypeAndConstantDecls.empty());
+    ASSERT(functionBuilder->mSpirvTypePointerDecls.empty());
+    ASSERT(functionBuilder->mSpirvFunctionTypeDecls.empty());
+
+    const spirv::IdRef firstFunctionId = functionBuilder->mFirstFunctionId;
+    ASSERT(functionBuilder->mNextAvailableId >= firstFunctionId);
+
+    // The final id of every provisional id of the function.
+    std::vector<spirv::IdRef> idMap(functionBuilder->mNextAvailableId - firstFunctionId);
+    auto getFinalId = [&](spirv::IdRef id) {
+        return id < firstFunctionId ? id : idMap[id - firstFunctionId];
+    };
+
+    // Declare the types and constants that the function needs and the module doesn't have yet.
+    // This reuses the ones declared by the functions merged before.  Declarations are recorded
+    // after the ones they depend on, so the ids they reference are already final.
+    for (SpirvPendingDeclaration &declaration : functionBuilder->mPendingDeclarations)
+    {
+        spirv::IdRef id;
+        switch (declaration.kind)
+        {
+            case SpirvPendingDeclaration::Kind::Type:
+                id = getSpirvTypeData(declaration.type, declaration.block).id;
+                break;
+            case SpirvPendingDeclaration::Kind::TypePointer:
+                id = getTypePointerId(getFinalId(declaration.typeId), declaration.storageClass);
+                break;
+            case SpirvPendingDeclaration::Kind::BasicConstant:
+                switch (declaration.basicType)
+                {
+                    case EbtBool:
+                        id = getBoolConstant(declaration.value != 0);
+                        break;
+                    case EbtUInt:
+                        id = getBasicConstantHelper(declaration.value, EbtUInt,
+                                                    &SPIRVBuilder::mUintConstants);
+                        break;
+                    case EbtInt:
+                        id = getBasicConstantHelper(declaration.value, EbtInt,
+                                                    &SPIRVBuilder::mIntConstants);
+                        break;
+                    case EbtFloat:
+                        id = getBasicConstantHelper(declaration.value, EbtFloat,
+                                                    &SPIRVBuilder::mFloatConstants);
+                        break;
+                    default:
+                        UNREACHABLE();
+                }
+                break;
+            case SpirvPendingDeclaration::Kind::CompositeConstant:
+                for (spirv::IdRef &componentId : declaration.componentIds)
+                {
+                    componentId = getFinalId(componentId);
+                }
+                id = getCompositeConstant(getFinalId(declaration.typeId),
+                                          declaration.componentIds);
+                break;
+            case SpirvPendingDeclaration::Kind::NullConstant:
+                id = getNullConstant(getFinalId(declaration.typeId));
+                break;
+        }
+
+        ASSERT(id.valid());
+        idMap[declaration.id - firstFunctionId] = id;
+    }
+
+    // Give the rest of the function's ids a range of their own.
+    for (spirv::IdRef &id : idMap)
+    {
+        if (!id.valid())
+        {
+            id = getNewId({});
+        }
+    }
+
+    // Relocate the function and its names and decorations, and add them to the module.
+    relocateFunctionIds(&functionBuilder->mSpirvDebug, firstFunctionId, idMap);
+    relocateFunctionIds(&functionBuilder->mSpirvDecorations, firstFunctionId, idMap);
+    mSpirvDebug.insert(mSpirvDebug.end(), functionBuilder->mSpirvDebug.begin(),
+                       functionBuilder->mSpirvDebug.end());
+    mSpirvDecorations.insert(mSpirvDecorations.end(), functionBuilder->mSpirvDecorations.begin(),
+                             functionBuilder->mSpirvDecorations.end());
+
+    relocateFunctionIds(&functionBuilder->mSpirvVariableDecls, firstFunctionId, idMap);
+    mSpirvVariableDecls.insert(mSpirvVariableDecls.end(),
+                               functionBuilder->mSpirvVariableDecls.begin(),
+                               functionBuilder->mSpirvVariableDecls.end());
+    for (spirv::IdRef variableId : functionBuilder->mEntryPointInterfaceList)
+    {
+        addEntryPointInterfaceVariableId(getFinalId(variableId));
+    }
+
+    for (spirv::Blob &function : functionBuilder->mSpirvFunctions)
+    {
+        relocateFunctionIds(&function, firstFunctionId, idMap);
+        mSpirvFunctions.push_back(std::move(function));
+    }
+
+    // Gather what the function found it uses while being generated.
+    for (spv::Capability capability : functionBuilder->mCapabilities)
+    {
+        addCapability(capability);
+    }
+    mExecutionModes.insert(functionBuilder->mExecutionModes.begin(),
+                           functionBuilder->mExecutionModes.end());
+    mExtensions |= functionBuilder->mExtensions;
+    mOverviewFlags |= functionBuilder->mOverviewFlags;
+}
+
 spirv::Blob SPIRVBuilder::getSpirv()
 {
+    ASSERT(!isFunctionBuilder());
     ASSERT(mConditionalStack.empty());
 
     spirv::Blob result;
 
     const spirv::IdRef nonSemanticOverviewId = getNewId({});
 
-    // Reserve a minimum amount of memory.
+    // Reserve a minimum amount of memory for the header and the metadata instructions:
     //
     //   5 for header +
-    //   a number of capabilities +
-    //   size of already generated instructions.
+    //   a number of capabilities.
     //
     // The actual size is larger due to other metadata instructions such as extensions,
-    // OpExtInstImport, OpEntryPoint, OpExecutionMode etc.
-    result.reserve(5 + mCapabilities.size() * 2 + mSpirvDebug.size() + mSpirvDecorations.size() +
-                   mSpirvTypeAndConstantDecls.size() + mSpirvTypePointerDecls.size() +
-                   mSpirvFunctionTypeDecls.size() + mSpirvVariableDecls.size() +
-                   mSpirvFunctions.size());
+    // OpExtInstImport, OpEntryPoint, OpExecutionMode etc.  Once these are generated, the exact
+    // size of the rest of the SPIR-V is known and is reserved before the sections are appended.
+    result.reserve(5 + mCapabilities.size() * 2);
 
     // Generate the SPIR-V header.
     spirv::WriteSpirvHeader(&result,
@@ -2471,6 +2788,24 @@ spirv::Blob SPIRVBuilder::getSpirv()
                        nullptr);
     writeSourceExtensions(&result);
 
+    // The types/constants/variables section is the first place non-semantic instructions can be
+    // output.  These instructions rely on at least the OpVoid type.  The kNonSemanticTypeSectionEnd
+    // instruction additionally carries an overview of the SPIR-V and thus requires a few OpConstant
+    // values.
+    spirv::Blob nonSemanticOverview;
+    writeNonSemanticOverview(&nonSemanticOverview, nonSemanticOverviewId);
+
+    size_t functionsSize = 0;
+    for (const spirv::Blob &function : mSpirvFunctions)
+    {
+        functionsSize += function.size();
+    }
+
+    result.reserve(result.size() + mSpirvDebug.size() + mSpirvDecorations.size() +
+                   mSpirvTypeAndConstantDecls.size() + mSpirvTypePointerDecls.size() +
+                   mSpirvFunctionTypeDecls.size() + mSpirvVariableDecls.size() +
+                   nonSemanticOverview.size() + functionsSize);
+
     // Append the already generated sections in order
     result.insert(result.end(), mSpirvDebug.begin(), mSpirvDebug.end());
     result.insert(result.end(), mSpirvDecorations.begin(), mSpirvDecorations.end());
@@ -2479,15 +2814,14 @@ spirv::Blob SPIRVBuilder::getSpirv()
     result.insert(result.end(), mSpirvTypePointerDecls.begin(), mSpirvTypePointerDecls.end());
     result.insert(result.end(), mSpirvFunctionTypeDecls.begin(), mSpirvFunctionTypeDecls.end());
     result.insert(result.end(), mSpirvVariableDecls.begin(), mSpirvVariableDecls.end());
+    result.insert(result.end(), nonSemanticOverview.begin(), nonSemanticOverview.end());
 
-    // The types/constants/variables section is the first place non-semantic instructions can be
-    // output.  These instructions rely on at least the OpVoid type.  The kNonSemanticTypeSectionEnd
-    // instruction additionally carries an overview of the SPIR-V and thus requires a few OpConstant
-    // values.
-    writeNonSemanticOverview(&result, nonSemanticOverviewId);
-
-    result.insert(result.end(), mSpirvFunctions.begin(), mSpirvFunctions.end());
+    for (const spirv::Blob &function : mSpirvFunctions)
+    {
+        result.insert(result.end(), function.begin(), function.end());
+    }
 
+    // This is a no-op if exactly the reserved size was used.
     result.shrink_to_fit();
     return result;
 }
@@ -307,6 +307,40 @@ struct SpirvConditional
     bool isBreakable = false;
 };
 
+// A type or constant that a function generated by a builder of its own needs, but that the module
+// had not declared when the function started.  The function's builder gives it a provisional id,
+// which SPIRVBuilder::mergeFunction() replaces with the id of the declaration in the module.
+struct SpirvPendingDeclaration
+{
+    enum class Kind
+    {
+        Type,
+        TypePointer,
+        // Bool, uint, int and float constants.
+        BasicConstant,
+        CompositeConstant,
+        NullConstant,
+    };
+
+    Kind kind;
+    // The provisional id.
+    spirv::IdRef id;
+
+    // Type: the type and the struct or interface block declaring it, if any.
+    SpirvType type;
+    const TSymbol *block = nullptr;
+
+    // BasicConstant: the type and value of the constant.
+    TBasicType basicType = EbtVoid;
+    uint32_t value       = 0;
+
+    // TypePointer, CompositeConstant and NullConstant: the type, and the storage class of the
+    // pointer or the components of the constant.
+    spirv::IdRef typeId;
+    spv::StorageClass storageClass = spv::StorageClassMax;
+    spirv::IdRefList componentIds;
+};
+
 // List of known extensions
 enum class SPIRVExtensions
 {
@@ -331,6 +365,10 @@ class SPIRVBuilder : angle::NonCopyable
                  const ShCompileOptions &compileOptions,
                  const angle::HashMap<int, uint32_t> &uniqueToSpirvIdMap,
                  uint32_t firstUnusedSpirvId);
+    // Creates a builder that generates one function of the module built by |moduleBuilder|,
+    // independently of (and possibly in parallel with) the other functions.  The module builder is
+    // only read until the function is merged with mergeFunction().
+    explicit SPIRVBuilder(const SPIRVBuilder *moduleBuilder);
 
     spirv::IdRef getNewId(const SpirvDecorations &decorations);
     spirv::IdRef getReservedOrNewId(TSymbolUniqueId uniqueId, const SpirvDecorations &decorations);
@@ -357,7 +395,11 @@ class SPIRVBuilder : angle::NonCopyable
     spirv::Blob *getSpirvTypePointerDecls() { return &mSpirvTypePointerDecls; }
     spirv::Blob *getSpirvFunctionTypeDecls() { return &mSpirvFunctionTypeDecls; }
     spirv::Blob *getSpirvVariableDecls() { return &mSpirvVariableDecls; }
-    spirv::Blob *getSpirvFunctions() { return &mSpirvFunctions; }
+    spirv::Blob *getSpirvCurrentFunction()
+    {
+        ASSERT(!mSpirvFunctions.empty());
+        return &mSpirvFunctions.back();
+    }
     spirv::Blob *getSpirvCurrentFunctionBlock()
     {
         ASSERT(!mSpirvCurrentFunctionBlocks.empty() &&
@@ -421,6 +463,7 @@ class SPIRVBuilder : angle::NonCopyable
     spirv::IdRef getNullConstant(spirv::IdRef typeId);
 
     // Helpers to start and end a function.
+    void startNewFunctionDeclaration();
     void startNewFunction(spirv::IdRef functionId, const TFunction *func);
     void assembleSpirvFunctionBlocks();
 
@@ -447,6 +490,11 @@ class SPIRVBuilder : angle::NonCopyable
     ImmutableString getName(const TSymbol *symbol);
     ImmutableString getFieldName(const TField *field);
 
+    // Adds the function generated by |functionBuilder| to the module.  The types and constants the
+    // function needs are declared in the module (or deduplicated with the existing ones), and the
+    // function's own ids are given a range of their own.  Functions must be merged in order.
+    void mergeFunction(SPIRVBuilder *functionBuilder);
+
     spirv::Blob getSpirv();
 
   private:
@@ -472,9 +520,17 @@ class SPIRVBuilder : angle::NonCopyable
                                 spirv::LiteralInteger *sampledOut);
     spv::ImageFormat getImageFormat(TLayoutImageInternalFormat imageInternalFormat);
 
-    spirv::IdRef getBasicConstantHelper(uint32_t value,
-                                        TBasicType type,
-                                        angle::HashMap<uint32_t, spirv::IdRef> *constants);
+    // Function builders don't declare types and constants, see mergeFunction().
+    bool isFunctionBuilder() const { return mModuleBuilder != nullptr; }
+    spirv::IdRef addPendingDeclaration(SpirvPendingDeclaration &&declaration);
+    void relocateFunctionIds(spirv::Blob *blob,
+                             spirv::IdRef firstFunctionId,
+                             const std::vector<spirv::IdRef> &idMap);
+
+    spirv::IdRef getBasicConstantHelper(
+        uint32_t value,
+        TBasicType type,
+        angle::HashMap<uint32_t, spirv::IdRef> SPIRVBuilder::*constants);
     spirv::IdRef getNullVectorConstantHelper(TBasicType type, int size);
     spirv::IdRef getVectorConstantHelper(spirv::IdRef valueId, TBasicType type, int size);
 
@@ -530,7 +586,10 @@ class SPIRVBuilder : angle::NonCopyable
     spirv::Blob mSpirvTypePointerDecls;
     spirv::Blob mSpirvFunctionTypeDecls;
     spirv::Blob mSpirvVariableDecls;
-    spirv::Blob mSpirvFunctions;
+    // Each function is generated in a blob of its own, starting with the OpFunction instruction and
+    // ending with OpFunctionEnd.  They are only concatenated once in getSpirv(), with the final
+    // size known in advance.
+    std::vector<spirv::Blob> mSpirvFunctions;
     // A list of blocks created for the current function.  These are assembled by
     // assembleSpirvFunctionBlocks() when the function is entirely visited.  Local variables need to
     // be inserted at the beginning of the first function block, so the entire SPIR-V of the
@@ -546,7 +605,7 @@ class SPIRVBuilder : angle::NonCopyable
     angle::HashMap<uint32_t, spirv::IdRef> mFloatConstants;
     angle::HashMap<SpirvIdAndIdList, spirv::IdRef, SpirvIdAndIdListHash> mCompositeConstants;
     // Keyed by typeId, returns the null constant corresponding to that type.
-    std::vector<spirv::IdRef> mNullConstants;
+    angle::HashMap<uint32_t, spirv::IdRef> mNullConstants;
 
     // List of type pointers that are already defined.
     // TODO: if all users call getTypeData(), move to SpirvTypeData.  http://anglebug.com/40096715
@@ -576,6 +635,14 @@ class SPIRVBuilder : angle::NonCopyable
     // Used to provide an overview of what the SPIR-V declares so the SPIR-V translator doesn't have
     // to discover them.
     uint32_t mOverviewFlags;
+
+    // If this builder generates a single function, the builder of the module.  Types and constants
+    // are looked up in the module's tables first.  The ones the module doesn't have are not
+    // declared, but given a provisional id and recorded in |mPendingDeclarations|.  Every id from
+    // |mFirstFunctionId| on is provisional, and is replaced by mergeFunction().
+    const SPIRVBuilder *mModuleBuilder = nullptr;
+    spirv::IdRef mFirstFunctionId;
+    std::vector<SpirvPendingDeclaration> mPendingDeclarations;
 };
 }  // namespace sh
 
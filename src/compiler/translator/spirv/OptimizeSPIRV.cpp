@@ -0,0 +1,552 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeSPIRV: Fast, targeted optimizations on the SPIR-V generated from the AST.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include "compiler/translator/spirv/OptimizeSPIRV.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/debug.h"
+#include "common/hash_containers.h"
+#include "common/spirv/spirv_instruction_builder_autogen.h"
+#include "common/spirv/spirv_instruction_parser_autogen.h"
+#include "compiler/translator/spirv/VisitInstructionIds.h"
+
+namespace spirv = angle::spirv;
+
+namespace sh
+{
+namespace
+{
+// Ids that the SPIR-V transformer in the Vulkan backend relies on are never removed or replaced.
+bool IsReservedId(uint32_t id)
+{
+    return id < vk::spirv::kIdFirstUnreserved;
+}
+
+struct Instruction
+{
+    uint32_t offset;
+    uint32_t length;
+    spv::Op op;
+};
+
+struct Function
+{
+    // Range of instructions from OpFunction to OpFunctionEnd inclusive.
+    size_t begin;
+    size_t end;
+};
+
+struct Module
+{
+    std::vector<Instruction> instructions;
+    std::vector<Function> functions;
+    // Every word of the instructions whose layout is not known.  Ids in this set may be
+    // referenced in ways that the optimizer cannot see, so they are left alone.
+    angle::HashSet<uint32_t> opaqueWords;
+};
+
+// The changes a pass makes to the module.
+struct Rewrite
+{
+    Rewrite(size_t instructionCount) : removed(instructionCount, false) {}
+
+    bool empty() const { return copies.empty() && removedIds.empty() && !anyRemoved; }
+
+    void remove(size_t instructionIndex)
+    {
+        removed[instructionIndex] = true;
+        anyRemoved                = true;
+    }
+
+    std::vector<bool> removed;
+    bool anyRemoved = false;
+    // Instructions to replace with an OpCopyObject of the given id.
+    angle::HashMap<size_t, uint32_t> copies;
+    // Ids to replace in all instructions that reference them.
+    angle::HashMap<uint32_t, uint32_t> replacedIds;
+    // Ids that no longer exist, so their names and decorations need to be removed.
+    angle::HashSet<uint32_t> removedIds;
+};
+
+void ParseModule(const spirv::Blob &blob, Module *module)
+{
+    size_t currentWord = spirv::kHeaderIndexInstructions;
+    while (currentWord < blob.size())
+    {
+        const uint32_t *instruction = &blob[currentWord];
+        Instruction parsed;
+        parsed.offset = static_cast<uint32_t>(currentWord);
+        spirv::GetInstructionOpAndLength(instruction, &parsed.op, &parsed.length);
+        ASSERT(parsed.length > 0);
+
+        if (parsed.op == spv::OpFunction)
+        {
+            module->functions.push_back({module->instructions.size(), 0});
+        }
+        else if (parsed.op == spv::OpFunctionEnd)
+        {
+            module->functions.back().end = module->instructions.size();
+        }
+
+        uint32_t resultIndex;
+        if (!VisitInstructionIds(instruction, &resultIndex, [](uint32_t) {}))
+        {
+            module->opaqueWords.insert(instruction + 1, instruction + parsed.length);
+        }
+
+        module->instructions.push_back(parsed);
+        currentWord += parsed.length;
+    }
+}
+
+uint32_t GetReplacedId(const Rewrite &rewrite, uint32_t id)
+{
+    auto iter = rewrite.replacedIds.find(id);
+    return iter == rewrite.replacedIds.end() ? id : iter->second;
+}
+
+bool IsVolatile(const uint32_t *instruction, uint32_t length, uint32_t memoryAccessIndex)
+{
+    return memoryAccessIndex < length &&
+           (instruction[memoryAccessIndex] & spv::MemoryAccessVolatileMask) != 0;
+}
+
+// Pass 1: Forward stored and loaded values to subsequent loads of local variables in the same
+// block, and remove the stores and variables that are no longer needed.
+void EliminateLocalLoadsAndStores(const spirv::Blob &blob, const Module &module, Rewrite *rewrite)
+{
+    struct LocalVariable
+    {
+        size_t declaration;
+        std::vector<size_t> stores;
+        bool hasLoads;
+    };
+
+    for (const Function &function : module.functions)
+    {
+        // Gather the local variables.
+        angle::HashMap<uint32_t, LocalVariable> variables;
+        for (size_t index = function.begin; index < function.end; ++index)
+        {
+            const uint32_t *instruction = &blob[module.instructions[index].offset];
+            if (module.instructions[index].op == spv::OpVariable &&
+                instruction[3] == spv::StorageClassFunction && !IsReservedId(instruction[2]) &&
+                module.opaqueWords.count(instruction[2]) == 0)
+            {
+                variables[instruction[2]] = {index, {}, false};
+            }
+        }
+        if (variables.empty())
+        {
+            continue;
+        }
+
+        // Only keep the variables that are exclusively accessed as a whole with non-volatile
+        // OpLoad and OpStore.  Any other reference, such as an access chain or passing the
+        // variable to a function, disqualifies it.
+        for (size_t index = function.begin; index < function.end; ++index)
+        {
+            const Instruction &parsed   = module.instructions[index];
+            const uint32_t *instruction = &blob[parsed.offset];
+            switch (parsed.op)
+            {
+                case spv::OpVariable:
+                    break;
+                case spv::OpLoad:
+                    if (IsVolatile(instruction, parsed.length, 4))
+                    {
+                        variables.erase(instruction[3]);
+                    }
+                    break;
+                case spv::OpStore:
+                    if (IsVolatile(instruction, parsed.length, 3))
+                    {
+                        variables.erase(instruction[1]);
+                    }
+                    variables.erase(instruction[2]);
+                    break;
+                default:
+                {
+                    uint32_t resultIndex;
+                    VisitInstructionIds(instruction, &resultIndex, [&](uint32_t idIndex) {
+                        variables.erase(instruction[idIndex]);
+                    });
+                    break;
+                }
+            }
+        }
+        if (variables.empty())
+        {
+            continue;
+        }
+
+        // Walk the function, tracking the value each variable is known to hold in the current
+        // block.  Loads of a known value are replaced by that value.  A store that is followed by
+        // another store in the same block without being loaded in between is dead.
+        angle::HashMap<uint32_t, uint32_t> currentValues;
+        angle::HashMap<uint32_t, size_t> pendingStores;
+        std::vector<size_t> forwardedLoads;
+        for (size_t index = function.begin; index < function.end; ++index)
+        {
+            const Instruction &parsed   = module.instructions[index];
+            const uint32_t *instruction = &blob[parsed.offset];
+            switch (parsed.op)
+            {
+                case spv::OpLabel:
+                    currentValues.clear();
+                    pendingStores.clear();
+                    break;
+                case spv::OpVariable:
+                    // The initializer of a variable is its value in the first block.
+                    if (parsed.length > 4 && variables.count(instruction[2]) != 0)
+                    {
+                        currentValues[instruction[2]] = instruction[4];
+                    }
+                    break;
+                case spv::OpStore:
+                {
+                    auto variable = variables.find(instruction[1]);
+                    if (variable == variables.end())
+                    {
+                        break;
+                    }
+
+                    auto pendingStore = pendingStores.find(instruction[1]);
+                    if (pendingStore != pendingStores.end())
+                    {
+                        rewrite->remove(pendingStore->second);
+                    }
+                    pendingStores[instruction[1]] = index;
+                    currentValues[instruction[1]] = GetReplacedId(*rewrite, instruction[2]);
+                    variable->second.stores.push_back(index);
+                    break;
+                }
+                case spv::OpLoad:
+                {
+                    auto variable = variables.find(instruction[3]);
+                    if (variable == variables.end())
+                    {
+                        break;
+                    }
+
+                    auto currentValue = currentValues.find(instruction[3]);
+                    if (currentValue != currentValues.end())
+                    {
+                        rewrite->replacedIds[instruction[2]] = currentValue->second;
+                        forwardedLoads.push_back(index);
+                    }
+                    else
+                    {
+                        currentValues[instruction[3]] = instruction[2];
+                        variable->second.hasLoads = true;
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+
+        // Remove the forwarded loads.  If the result of the load is referenced in a way that
+        // cannot be rewritten, it's turned into a copy instead.
+        for (size_t index : forwardedLoads)
+        {
+            const uint32_t *instruction = &blob[module.instructions[index].offset];
+            const uint32_t resultId     = instruction[2];
+            if (IsReservedId(resultId) || module.opaqueWords.count(resultId) != 0)
+            {
+                rewrite->copies[index] = rewrite->replacedIds[resultId];
+            }
+            else
+            {
+                rewrite->remove(index);
+                rewrite->removedIds.insert(resultId);
+            }
+        }
+
+        // Remove the variables that are never loaded anymore, along with all their stores.
+        for (const auto &variable : variables)
+        {
+            if (variable.second.hasLoads)
+            {
+                continue;
+            }
+
+            rewrite->remove(variable.second.declaration);
+            rewrite->removedIds.insert(variable.first);
+            for (size_t store : variable.second.stores)
+            {
+                rewrite->remove(store);
+            }
+        }
+    }
+}
+
+// Pass 2: Remove the functions that cannot be reached from the entry point.
+void EliminateDeadFunctions(const spirv::Blob &blob, const Module &module, Rewrite *rewrite)
+{
+    angle::HashMap<uint32_t, size_t> functionIndices;
+    for (size_t functionIndex = 0; functionIndex < module.functions.size(); ++functionIndex)
+    {
+        const uint32_t *instruction =
+            &blob[module.instructions[module.functions[functionIndex].begin].offset];
+        functionIndices[instruction[2]] = functionIndex;
+    }
+
+    std::vector<bool> isReachable(module.functions.size(), false);
+    std::vector<size_t> toVisit;
+    auto markReachable = [&](uint32_t functionId) {
+        auto iter = functionIndices.find(functionId);
+        if (iter != functionIndices.end() && !isReachable[iter->second])
+        {
+            isReachable[iter->second] = true;
+            toVisit.push_back(iter->second);
+        }
+    };
+
+    for (const Instruction &parsed : module.instructions)
+    {
+        if (parsed.op == spv::OpEntryPoint)
+        {
+            markReachable(blob[parsed.offset + 2]);
+        }
+    }
+    // Conservatively consider functions referenced by unknown instructions as reachable.
+    for (const auto &function : functionIndices)
+    {
+        if (module.opaqueWords.count(function.first) != 0)
+        {
+            markReachable(function.first);
+        }
+    }
+
+    while (!toVisit.empty())
+    {
+        const Function &function = module.functions[toVisit.back()];
+        toVisit.pop_back();
+
+        for (size_t index = function.begin; index < function.end; ++index)
+        {
+            if (module.instructions[index].op == spv::OpFunctionCall)
+            {
+                markReachable(blob[module.instructions[index].offset + 3]);
+            }
+        }
+    }
+
+    for (size_t functionIndex = 0; functionIndex < module.functions.size(); ++functionIndex)
+    {
+        if (isReachable[functionIndex])
+        {
+            continue;
+        }
+
+        // The ids defined in the function must be known to remove their names and decorations.
+        const Function &function = module.functions[functionIndex];
+        std::vector<uint32_t> definedIds;
+        bool isLayoutKnown = true;
+        for (size_t index = function.begin; index <= function.end && isLayoutKnown; ++index)
+        {
+            const uint32_t *instruction = &blob[module.instructions[index].offset];
+            uint32_t resultIndex;
+            isLayoutKnown = VisitInstructionIds(instruction, &resultIndex, [](uint32_t) {});
+            if (resultIndex != 0)
+            {
+                definedIds.push_back(instruction[resultIndex]);
+            }
+        }
+
+        if (!isLayoutKnown || std::any_of(definedIds.begin(), definedIds.end(), IsReservedId))
+        {
+            continue;
+        }
+
+        for (size_t index = function.begin; index <= function.end; ++index)
+        {
+            rewrite->remove(index);
+        }
+        rewrite->removedIds.insert(definedIds.begin(), definedIds.end());
+    }
+}
+
+// Pass 3: Merge identical types and constants.
+void DeduplicateTypesAndConstants(const spirv::Blob &blob, const Module &module, Rewrite *rewrite)
+{
+    // Decorations (such as ArrayStride) make otherwise identical types distinct.
+    angle::HashSet<uint32_t> decoratedIds;
+    for (const Instruction &parsed : module.instructions)
+    {
+        if (parsed.op == spv::OpDecorate || parsed.op == spv::OpMemberDecorate)
+        {
+            decoratedIds.insert(blob[parsed.offset + 1]);
+        }
+    }
+
+    const size_t globalsEnd =
+        module.functions.empty() ? module.instructions.size() : module.functions.front().begin;
+
+    std::map<std::vector<uint32_t>, uint32_t> canonicalIds;
+    std::vector<uint32_t> key;
+    for (size_t index = 0; index < globalsEnd; ++index)
+    {
+        const Instruction &parsed = module.instructions[index];
+        switch (parsed.op)
+        {
+            case spv::OpTypeVector:
+            case spv::OpTypeMatrix:
+            case spv::OpTypeImage:
+            case spv::OpTypeSampledImage:
+            case spv::OpTypeArray:
+            case spv::OpTypeRuntimeArray:
+            case spv::OpTypePointer:
+            case spv::OpTypeFunction:
+            case spv::OpConstantTrue:
+            case spv::OpConstantFalse:
+            case spv::OpConstant:
+            case spv::OpConstantComposite:
+            case spv::OpConstantNull:
+                break;
+            default:
+                continue;
+        }
+
+        const uint32_t *instruction = &blob[parsed.offset];
+        key.assign(instruction, instruction + parsed.length);
+
+        uint32_t resultIndex;
+        VisitInstructionIds(instruction, &resultIndex, [&](uint32_t idIndex) {
+            key[idIndex] = GetReplacedId(*rewrite, key[idIndex]);
+        });
+        const uint32_t resultId = key[resultIndex];
+        key[resultIndex]        = 0;
+
+        if (decoratedIds.count(resultId) != 0)
+        {
+            continue;
+        }
+
+        auto inserted = canonicalIds.emplace(key, resultId);
+        if (inserted.second || IsReservedId(resultId) || module.opaqueWords.count(resultId) != 0)
+        {
+            continue;
+        }
+
+        rewrite->replacedIds[resultId] = inserted.first->second;
+        rewrite->removedIds.insert(resultId);
+        rewrite->remove(index);
+    }
+}
+
+void EmitModule(const spirv::Blob &blob,
+                const Module &module,
+                const Rewrite &rewrite,
+                spirv::Blob *optimized)
+{
+    optimized->reserve(blob.size());
+    optimized->insert(optimized->end(), blob.begin(),
+                      blob.begin() + spirv::kHeaderIndexInstructions);
+
+    for (size_t index = 0; index < module.instructions.size(); ++index)
+    {
+        if (rewrite.removed[index])
+        {
+            continue;
+        }
+
+        const Instruction &parsed   = module.instructions[index];
+        const uint32_t *instruction = &blob[parsed.offset];
+
+        auto copy = rewrite.copies.find(index);
+        if (copy != rewrite.copies.end())
+        {
+            ASSERT(parsed.op == spv::OpLoad);
+            spirv::WriteCopyObject(optimized, spirv::IdResultType(instruction[1]),
+                                   spirv::IdResult(instruction[2]), spirv::IdRef(copy->second));
+            continue;
+        }
+
+        switch (parsed.op)
+        {
+            case spv::OpName:
+            case spv::OpMemberName:
+            case spv::OpDecorate:
+            case spv::OpMemberDecorate:
+                if (rewrite.removedIds.count(instruction[1]) != 0)
+                {
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+
+        const size_t start = optimized->size();
+        optimized->insert(optimized->end(), instruction, instruction + parsed.length);
+
+        if (!rewrite.replacedIds.empty())
+        {
+            uint32_t resultIndex;
+            VisitInstructionIds(instruction, &resultIndex, [&](uint32_t idIndex) {
+                (*optimized)[start + idIndex] = GetReplacedId(rewrite, instruction[idIndex]);
+            });
+        }
+    }
+}
+}  // anonymous namespace
+
+void OptimizeSPIRV(spirv::Blob *blob)
+{
+    using Pass = void (*)(const spirv::Blob &blob, const Module &module, Rewrite *rewrite);
+    struct PassInfo
+    {
+        Pass pass;
+        // The pass is skipped for modules with more instructions than this.
+        size_t maxInstructionCount;
+    };
+    constexpr PassInfo kPasses[] = {
+        // Tracks every local variable of the function being optimized in hash maps.
+        {EliminateLocalLoadsAndStores, 64 * 1024},
+        {EliminateDeadFunctions, 256 * 1024},
+        {DeduplicateTypesAndConstants, 256 * 1024},
+    };
+
+    // Every pass visits each instruction a bounded number of times, so capping the number of
+    // instructions a pass is run on bounds the time the optimizer takes on the compile thread.
+    // Unlike a time budget, this keeps the output independent of the speed of the machine.
+    for (const PassInfo &passInfo : kPasses)
+    {
+        Module module;
+        ParseModule(*blob, &module);
+
+        if (module.instructions.size() > passInfo.maxInstructionCount)
+        {
+            continue;
+        }
+
+        const Pass pass = passInfo.pass;
+        Rewrite rewrite(module.instructions.size());
+        pass(*blob, module, &rewrite);
+        if (rewrite.empty())
+        {
+            continue;
+        }
+
+        spirv::Blob optimized;
+        EmitModule(*blob, module, rewrite, &optimized);
+        blob->swap(optimized);
+    }
+}
+}  // namespace sh
@@ -0,0 +1,33 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeSPIRV: Fast, targeted optimizations on the SPIR-V generated from the AST.  The SPIR-V
+// generator produces a load and a store for every access to a local variable, which drivers have
+// to clean up at pipeline creation time.  The following is done:
+//
+//   1. Within a block, loads of local variables that are only ever accessed as a whole are
+//      replaced with the value that was last stored to or loaded from the variable.  Stores that
+//      are overwritten before being loaded are removed.  Variables that are no longer loaded are
+//      removed along with their stores.
+//   2. Functions that are not reachable from the entry point are removed.
+//   3. Duplicate undecorated types and constants are merged.
+//
+// Names and decorations of removed ids are removed too.  Instructions whose layout is not known to
+// the optimizer are left untouched, and any id they reference is excluded from the optimizations.
+// The passes run in order, each skipped for modules larger than its instruction-count cap, so the
+// output only depends on the input.
+//
+
+#ifndef COMPILER_TRANSLATOR_SPIRV_OPTIMIZESPIRV_H_
+#define COMPILER_TRANSLATOR_SPIRV_OPTIMIZESPIRV_H_
+
+#include "common/spirv/spirv_types.h"
+
+namespace sh
+{
+void OptimizeSPIRV(angle::spirv::Blob *blob);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_SPIRV_OPTIMIZESPIRV_H_
@@ -13,16 +13,23 @@
 #include "compiler/translator/spirv/OutputSPIRV.h"
 
 #include "angle_gl.h"
+#include "common/WorkerThread.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
 #include "common/spirv/spirv_instruction_builder_autogen.h"
 #include "compiler/translator/Compiler.h"
+#include "compiler/translator/PoolAlloc.h"
 #include "compiler/translator/StaticType.h"
 #include "compiler/translator/spirv/BuildSPIRV.h"
+#include "compiler/translator/spirv/OptimizeSPIRV.h"
 #include "compiler/translator/tree_util/FindPreciseNodes.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 
+#include <atomic>
 #include <cfloat>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 // Extended instructions
 namespace spv
@@ -179,6 +186,32 @@ bool IsAccessChainRValue(const AccessChain &accessChain)
     return accessChain.storageClass == spv::StorageClassMax;
 }
 
+// The number of out parameters of the built-ins whose SPIR-V instruction returns a struct, see
+// OutputSPIRVTraverser::makeBuiltInOutputStructType().  Zero for the other operators.
+size_t GetBuiltInStructOutputLvalueCount(TOperator op)
+{
+    switch (op)
+    {
+        case EOpModf:
+        case EOpFrexp:
+        case EOpUaddCarry:
+        case EOpUsubBorrow:
+            return 1;
+        case EOpUmulExtended:
+        case EOpImulExtended:
+            return 2;
+        default:
+            return 0;
+    }
+}
+
+// Shaders with fewer nodes in their functions than this are generated in one go.  Below this,
+// setting up builders per function and merging them costs more than generating the functions in
+// parallel saves.
+constexpr size_t kMinNodeCountToGenerateFunctionsSeparately = 2048;
+
+class PrepareFunctionTraverser;
+
 // A traverser that generates SPIR-V as it walks the AST.
 class OutputSPIRVTraverser : public TIntermTraverser
 {
@@ -187,8 +220,16 @@ class OutputSPIRVTraverser : public TIntermTraverser
                          const ShCompileOptions &compileOptions,
                          const angle::HashMap<int, uint32_t> &uniqueToSpirvIdMap,
                          uint32_t firstUnusedSpirvId);
+    // Creates a traverser that generates a single function of the module generated by
+    // |moduleTraverser|, see generateFunctions().
+    explicit OutputSPIRVTraverser(const OutputSPIRVTraverser *moduleTraverser);
     ~OutputSPIRVTraverser() override;
 
+    // The traversal of the tree only declares the functions.  Their bodies are generated here, each
+    // with a builder of its own and in parallel if |threadPool| allows it, and merged in the order
+    // they appear in the tree.  Small shaders are generated directly by this traverser instead.
+    void generateFunctions(angle::WorkerThreadPool *threadPool);
+
     spirv::Blob getSpirv();
 
   protected:
@@ -213,6 +254,12 @@ class OutputSPIRVTraverser : public TIntermTraverser
     void visitPreprocessorDirective(TIntermPreprocessorDirective *node) override;
 
   private:
+    friend class PrepareFunctionTraverser;
+
+    // Used by the traversers of single functions to find the ids declared by the module.
+    spirv::IdRef getSymbolId(const TSymbol *symbol) const;
+    const FunctionIds &getFunctionIds(const TFunction *function) const;
+
     spirv::IdRef getSymbolIdAndStorageClass(const TSymbol *symbol,
                                             const TType &type,
                                             spv::StorageClass *storageClass);
@@ -381,8 +428,19 @@ class OutputSPIRVTraverser : public TIntermTraverser
     TCompiler *mCompiler;
     ANGLE_MAYBE_UNUSED_PRIVATE_FIELD const ShCompileOptions &mCompileOptions;
 
+    // The pools the functions generated in other threads allocated from.  The types in the tables
+    // of |mBuilder| may reference them, so they are destroyed after it.
+    std::vector<std::unique_ptr<angle::PoolAllocator>> mFunctionPoolAllocators;
+
     SPIRVBuilder mBuilder;
 
+    // If this traverser generates a single function, the traverser of the module.  The globals,
+    // functions and built-in result structs are looked up there.
+    const OutputSPIRVTraverser *mModuleTraverser = nullptr;
+    // The function definitions left to generateFunctions().
+    std::vector<TIntermFunctionDefinition *> mFunctionDefinitions;
+    bool mDeferFunctionDefinitions = true;
+
     // Traversal state.  Nodes generally push() once to this stack on PreVisit.  On InVisit and
     // PostVisit, they pop() once (data corresponding to the result of the child) and accumulate it
     // in back() (data corresponding to the node itself).  On PostVisit, code is generated.
@@ -534,11 +592,44 @@ OutputSPIRVTraverser::OutputSPIRVTraverser(TCompiler *compiler,
       mBuilder(compiler, compileOptions, uniqueToSpirvIdMap, firstUnusedSpirvId)
 {}
 
+OutputSPIRVTraverser::OutputSPIRVTraverser(const OutputSPIRVTraverser *moduleTraverser)
+    : TIntermTraverser(true, true, true, &moduleTraverser->mCompiler->getSymbolTable()),
+      mCompiler(moduleTraverser->mCompiler),
+      mCompileOptions(moduleTraverser->mCompileOptions),
+      mBuilder(&moduleTraverser->mBuilder),
+      mModuleTraverser(moduleTraverser),
+      mDeferFunctionDefinitions(false)
+{
+    ASSERT(moduleTraverser->mModuleTraverser == nullptr);
+}
+
 OutputSPIRVTraverser::~OutputSPIRVTraverser()
 {
     ASSERT(mNodeData.empty());
 }
 
+spirv::IdRef OutputSPIRVTraverser::getSymbolId(const TSymbol *symbol) const
+{
+    auto iter = mSymbolIdMap.find(symbol->uniqueId());
+    if (iter != mSymbolIdMap.end())
+    {
+        return iter->second;
+    }
+
+    ASSERT(mModuleTraverser != nullptr);
+    return mModuleTraverser->getSymbolId(symbol);
+}
+
+const FunctionIds &OutputSPIRVTraverser::getFunctionIds(const TFunction *function) const
+{
+    const angle::HashMap<const TFunction *, FunctionIds> &functionIdMap =
+        mModuleTraverser != nullptr ? mModuleTraverser->mFunctionIdMap : mFunctionIdMap;
+
+    auto iter = functionIdMap.find(function);
+    ASSERT(iter != functionIdMap.end());
+    return iter->second;
+}
+
 spirv::IdRef OutputSPIRVTraverser::getSymbolIdAndStorageClass(const TSymbol *symbol,
                                                               const TType &type,
                                                               spv::StorageClass *storageClass)
@@ -550,6 +641,13 @@ spirv::IdRef OutputSPIRVTraverser::getSymbolIdAndStorageClass(const TSymbol *sym
         return iter->second;
     }
 
+    // The globals used by a function generated separately, including the implicitly defined ones,
+    // are all declared by the module.  See PrepareFunctionTraverser.
+    if (mModuleTraverser != nullptr)
+    {
+        return mModuleTraverser->getSymbolId(symbol);
+    }
+
     // This must be an implicitly defined variable, define it now.
     const char *name                = nullptr;
     spv::BuiltIn builtInDecoration  = spv::BuiltInMax;
@@ -912,9 +1010,7 @@ void OutputSPIRVTraverser::accessChainPushDynamicComponent(NodeData *data,
         const spirv::IdRef uintTypeId = mBuilder.getBasicTypeId(EbtUInt, 1);
         const spirv::IdRef uvecTypeId = mBuilder.getBasicTypeId(EbtUInt, swizzleIds.size());
 
-        const spirv::IdRef swizzlesId = mBuilder.getNewId({});
-        spirv::WriteConstantComposite(mBuilder.getSpirvTypeAndConstantDecls(), uvecTypeId,
-                                      swizzlesId, swizzleIds);
+        const spirv::IdRef swizzlesId = mBuilder.getCompositeConstant(uvecTypeId, swizzleIds);
 
         // Index that vector constant with the dynamic index.  For example, vec.ywxz[i] becomes the
         // constant {1, 3, 0, 2} indexed with i, and that index used on vec.
@@ -2160,8 +2256,7 @@ spirv::IdRef OutputSPIRVTraverser::createFunctionCall(TIntermAggregate *node,
     const TFunction *function = node->getFunction();
     ASSERT(function);
 
-    ASSERT(mFunctionIdMap.count(function) > 0);
-    const spirv::IdRef functionId = mFunctionIdMap[function].functionId;
+    const spirv::IdRef functionId = getFunctionIds(function).functionId;
 
     // Get the list of parameters passed to the function.  The function parameters can only be
     // memory variables, or if the function argument is |const|, an rvalue.
@@ -3018,6 +3113,7 @@ spirv::IdRef OutputSPIRVTraverser::visitOperator(TIntermOperator *node, spirv::I
     // result is expected to be a struct instead.
     spirv::IdRef builtInResultTypeId = resultTypeId;
     spirv::IdRef builtInResult;
+    ASSERT(lvalueCount == GetBuiltInStructOutputLvalueCount(op));
     if (lvalueCount > 0)
     {
         builtInResultTypeId = makeBuiltInOutputStructType(node, lvalueCount);
@@ -4849,6 +4945,14 @@ spirv::IdRef OutputSPIRVTraverser::makeBuiltInOutputStructType(TIntermOperator *
         static_cast<uint32_t>(msbType.getNominalSize()),
     };
 
+    // Declaring the struct adds a symbol to the symbol table, which is left to the module.
+    if (mModuleTraverser != nullptr)
+    {
+        auto moduleIter = mModuleTraverser->mBuiltInResultStructMap.find(key);
+        ASSERT(moduleIter != mModuleTraverser->mBuiltInResultStructMap.end());
+        return moduleIter->second;
+    }
+
     auto iter = mBuiltInResultStructMap.find(key);
     if (iter == mBuiltInResultStructMap.end())
     {
@@ -4980,8 +5084,7 @@ void OutputSPIRVTraverser::visitSymbol(TIntermSymbol *node)
         type.getQualifier() == EvqSpecConst)
     {
         ASSERT(interfaceBlock == nullptr);
-        ASSERT(mSymbolIdMap.count(symbol->uniqueId()) > 0);
-        nodeDataInitRValue(&mNodeData.back(), mSymbolIdMap[symbol->uniqueId()], typeId);
+        nodeDataInitRValue(&mNodeData.back(), getSymbolId(symbol), typeId);
         return;
     }
 
@@ -5755,19 +5858,25 @@ bool OutputSPIRVTraverser::visitFunctionDefinition(Visit visit, TIntermFunctionD
 {
     if (visit == PreVisit)
     {
+        // Only declare the function for now, see generateFunctions().
+        if (mDeferFunctionDefinitions)
+        {
+            visitFunctionPrototype(node->getFunctionPrototype());
+            mFunctionDefinitions.push_back(node);
+            return false;
+        }
         return true;
     }
 
     const TFunction *function = node->getFunction();
-
-    ASSERT(mFunctionIdMap.count(function) > 0);
-    const FunctionIds &ids = mFunctionIdMap[function];
+    const FunctionIds &ids    = getFunctionIds(function);
 
     // After the prototype is visited, generate the initial code for the function.
     if (visit == InVisit)
     {
         // Declare the function.
-        spirv::WriteFunction(mBuilder.getSpirvFunctions(), ids.returnTypeId, ids.functionId,
+        mBuilder.startNewFunctionDeclaration();
+        spirv::WriteFunction(mBuilder.getSpirvCurrentFunction(), ids.returnTypeId, ids.functionId,
                              spv::FunctionControlMaskNone, ids.functionTypeId);
 
         for (size_t paramIndex = 0; paramIndex < function->getParamCount(); ++paramIndex)
@@ -5776,7 +5885,7 @@ bool OutputSPIRVTraverser::visitFunctionDefinition(Visit visit, TIntermFunctionD
 
             const spirv::IdRef paramId =
                 mBuilder.getNewId(mBuilder.getDecorations(paramVariable->getType()));
-            spirv::WriteFunctionParameter(mBuilder.getSpirvFunctions(),
+            spirv::WriteFunctionParameter(mBuilder.getSpirvCurrentFunction(),
                                           ids.parameterTypeIds[paramIndex], paramId);
 
             // Remember the id of the variable for future look up.
@@ -5858,7 +5967,7 @@ bool OutputSPIRVTraverser::visitFunctionDefinition(Visit visit, TIntermFunctionD
     mBuilder.assembleSpirvFunctionBlocks();
 
     // End the function
-    spirv::WriteFunctionEnd(mBuilder.getSpirvFunctions());
+    spirv::WriteFunctionEnd(mBuilder.getSpirvCurrentFunction());
 
     mCurrentFunctionId = {};
 
@@ -5894,8 +6003,9 @@ void OutputSPIRVTraverser::visitFunctionPrototype(TIntermFunctionPrototype *node
 {
     const TFunction *function = node->getFunction();
 
-    // If the function was previously forward declared, skip this.
-    if (mFunctionIdMap.count(function) > 0)
+    // If the function was previously forward declared, skip this.  Functions generated separately
+    // are always declared by the module first.
+    if (mModuleTraverser != nullptr || mFunctionIdMap.count(function) > 0)
     {
         return;
     }
@@ -6679,6 +6789,216 @@ void OutputSPIRVTraverser::markVertexOutputOnEmitVertex()
     }
 }
 
+// Prepares the functions to be generated by traversers of their own, which can only read the
+// module.  The global variables that are implicitly declared on first use, and the structs holding
+// the results of some built-ins, are declared in the module up-front.  The sizes of structs, which
+// are lazily cached in the types shared by all functions, are calculated as well.  Also counts the
+// nodes of the functions.
+class PrepareFunctionTraverser : public TIntermTraverser
+{
+  public:
+    PrepareFunctionTraverser(OutputSPIRVTraverser *moduleTraverser)
+        : TIntermTraverser(true, false, false), mModuleTraverser(moduleTraverser)
+    {}
+
+    size_t getNodeCount() const { return mNodeCount; }
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        visitTyped(node);
+
+        // Mirrors OutputSPIRVTraverser::visitSymbol().
+        const TType &type = node->getType();
+        if (type.getQualifier() == EvqConst || type.getQualifier() == EvqParamConst ||
+            type.getQualifier() == EvqSpecConst)
+        {
+            return;
+        }
+
+        const TSymbol *symbol = type.getInterfaceBlock();
+        if (symbol == nullptr)
+        {
+            symbol = &node->variable();
+        }
+
+        if (symbol->symbolType() == SymbolType::BuiltIn &&
+            mModuleTraverser->mSymbolIdMap.count(symbol->uniqueId()) == 0)
+        {
+            spv::StorageClass storageClass;
+            mModuleTraverser->getSymbolIdAndStorageClass(symbol, type, &storageClass);
+        }
+    }
+    void visitConstantUnion(TIntermConstantUnion *node) override { visitTyped(node); }
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override
+    {
+        visitTyped(node);
+        return true;
+    }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        visitOperator(node);
+        return true;
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        visitOperator(node);
+        return true;
+    }
+    bool visitTernary(Visit visit, TIntermTernary *node) override
+    {
+        visitTyped(node);
+        return true;
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        visitOperator(node);
+        return true;
+    }
+
+  private:
+    void visitTyped(TIntermTyped *node)
+    {
+        ++mNodeCount;
+        node->getType().getObjectSize();
+    }
+
+    void visitOperator(TIntermOperator *node)
+    {
+        visitTyped(node);
+
+        const size_t lvalueCount = GetBuiltInStructOutputLvalueCount(node->getOp());
+        if (lvalueCount > 0)
+        {
+            mModuleTraverser->makeBuiltInOutputStructType(node, lvalueCount);
+        }
+    }
+
+    OutputSPIRVTraverser *mModuleTraverser;
+    size_t mNodeCount = 0;
+};
+
+// The functions of a shader being generated in parallel.  Each function is claimed by the first
+// thread to get to it.  The thread that generates the shader waits for the functions to be done,
+// not for the tasks helping it, which may not even have started if the pool is busy.
+struct FunctionGenerationState
+{
+    const OutputSPIRVTraverser *moduleTraverser;
+    std::vector<TIntermFunctionDefinition *> functions;
+    std::vector<std::unique_ptr<OutputSPIRVTraverser>> traversers;
+    std::vector<std::unique_ptr<angle::PoolAllocator>> poolAllocators;
+
+    std::atomic<size_t> nextFunction{0};
+    std::mutex mutex;
+    std::condition_variable doneCondition;
+    size_t doneCount = 0;
+};
+
+void GenerateUnclaimedFunctions(FunctionGenerationState *state, bool usePoolAllocatorPerFunction)
+{
+    while (true)
+    {
+        const size_t index = state->nextFunction.fetch_add(1);
+        if (index >= state->functions.size())
+        {
+            return;
+        }
+
+        // Threads other than the one compiling the shader have no pool to allocate from.
+        angle::PoolAllocator *previousPoolAllocator = GetGlobalPoolAllocator();
+        if (usePoolAllocatorPerFunction)
+        {
+            state->poolAllocators[index] = std::make_unique<angle::PoolAllocator>();
+            SetGlobalPoolAllocator(state->poolAllocators[index].get());
+        }
+
+        state->traversers[index] = std::make_unique<OutputSPIRVTraverser>(state->moduleTraverser);
+        state->functions[index]->traverse(state->traversers[index].get());
+
+        SetGlobalPoolAllocator(previousPoolAllocator);
+
+        std::lock_guard<std::mutex> lock(state->mutex);
+        ++state->doneCount;
+        state->doneCondition.notify_one();
+    }
+}
+
+class GenerateFunctionsTask : public angle::Closure
+{
+  public:
+    GenerateFunctionsTask(const std::shared_ptr<FunctionGenerationState> &state) : mState(state) {}
+
+    void operator()() override { GenerateUnclaimedFunctions(mState.get(), true); }
+
+  private:
+    std::shared_ptr<FunctionGenerationState> mState;
+};
+
+void OutputSPIRVTraverser::generateFunctions(angle::WorkerThreadPool *threadPool)
+{
+    ASSERT(mModuleTraverser == nullptr);
+    mDeferFunctionDefinitions = false;
+
+    size_t nodeCount = 0;
+    for (TIntermFunctionDefinition *node : mFunctionDefinitions)
+    {
+        PrepareFunctionTraverser prepareTraverser(this);
+        node->traverse(&prepareTraverser);
+        nodeCount += prepareTraverser.getNodeCount();
+    }
+
+    // The split into functions only depends on the shader, so the output is the same whether or
+    // not the functions are generated in parallel.
+    const size_t functionCount = mFunctionDefinitions.size();
+    if (functionCount < 2 || nodeCount < kMinNodeCountToGenerateFunctionsSeparately)
+    {
+        for (TIntermFunctionDefinition *node : mFunctionDefinitions)
+        {
+            node->traverse(this);
+        }
+        mFunctionDefinitions.clear();
+        return;
+    }
+
+    std::shared_ptr<FunctionGenerationState> state = std::make_shared<FunctionGenerationState>();
+    state->moduleTraverser = this;
+    state->functions       = std::move(mFunctionDefinitions);
+    state->traversers.resize(functionCount);
+    state->poolAllocators.resize(functionCount);
+    mFunctionDefinitions.clear();
+
+    size_t helperCount = 0;
+    if (threadPool != nullptr && threadPool->isAsync())
+    {
+        const size_t threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        helperCount              = std::min(functionCount, threadCount) - 1;
+    }
+    for (size_t helperIndex = 0; helperIndex < helperCount; ++helperIndex)
+    {
+        threadPool->postWorkerTask(std::make_shared<GenerateFunctionsTask>(state));
+    }
+
+    // This thread generates functions too, using the pool of the compiler.
+    GenerateUnclaimedFunctions(state.get(), false);
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->doneCondition.wait(lock, [&state, functionCount]() {
+            return state->doneCount == functionCount;
+        });
+    }
+
+    for (size_t index = 0; index < functionCount; ++index)
+    {
+        mBuilder.mergeFunction(&state->traversers[index]->mBuilder);
+        if (state->poolAllocators[index])
+        {
+            mFunctionPoolAllocators.push_back(std::move(state->poolAllocators[index]));
+        }
+    }
+
+    // The helper tasks that haven't run yet keep |state| alive, but don't touch the traversers.
+    state->traversers.clear();
+}
+
 spirv::Blob OutputSPIRVTraverser::getSpirv()
 {
     spirv::Blob result = mBuilder.getSpirv();
@@ -6717,9 +7037,15 @@ bool OutputSPIRV(TCompiler *compiler,
     OutputSPIRVTraverser traverser(compiler, compileOptions, uniqueToSpirvIdMap,
                                    firstUnusedSpirvId);
     root->traverse(&traverser);
+    traverser.generateFunctions(compiler->getWorkerThreadPool().get());
 
     // Generate the final SPIR-V and store in the sink
     spirv::Blob spirvBlob = traverser.getSpirv();
+    if (compileOptions.optimizeSPIRV)
+    {
+        OptimizeSPIRV(&spirvBlob);
+        ASSERT(spirv::Validate(spirvBlob));
+    }
     compiler->getInfoSink().obj.setBinary(std::move(spirvBlob));
 
     return true;
@@ -0,0 +1,349 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VisitInstructionIds.h: Enumerates the id operands of the SPIR-V instructions generated by the
+// translator.  Used by the optimizer and by the merge of the separately generated functions.
+//
+
+#ifndef COMPILER_TRANSLATOR_SPIRV_VISITINSTRUCTIONIDS_H_
+#define COMPILER_TRANSLATOR_SPIRV_VISITINSTRUCTIONIDS_H_
+
+#include <algorithm>
+
+#include "common/spirv/spirv_instruction_parser_autogen.h"
+
+namespace sh
+{
+// Calls |visitIdOperand| with the index of every word of |instruction| that references an id,
+// including the result type but not the result id itself.  The index of the result id is returned
+// in |resultIndexOut|, or 0 if the instruction doesn't have a result.  Returns false without
+// visiting anything if the layout of the instruction is not known.
+template <typename VisitIdOperand>
+bool VisitInstructionIds(const uint32_t *instruction,
+                         uint32_t *resultIndexOut,
+                         VisitIdOperand &&visitIdOperand)
+{
+    spv::Op op;
+    uint32_t length;
+    angle::spirv::GetInstructionOpAndLength(instruction, &op, &length);
+
+    auto visitIds = [&](uint32_t first, uint32_t last) {
+        for (uint32_t index = first; index < std::min(last, length); ++index)
+        {
+            visitIdOperand(index);
+        }
+    };
+    constexpr uint32_t kToEnd = 0xFFFFFFFFu;
+
+    *resultIndexOut = 0;
+
+    switch (op)
+    {
+        // Result type and result id, followed only by ids.
+        case spv::OpConstantComposite:
+        case spv::OpSpecConstantComposite:
+        case spv::OpFunctionCall:
+        case spv::OpAccessChain:
+        case spv::OpInBoundsAccessChain:
+        case spv::OpImageTexelPointer:
+        case spv::OpCompositeConstruct:
+        case spv::OpCopyObject:
+        case spv::OpCopyLogical:
+        case spv::OpTranspose:
+        case spv::OpVectorExtractDynamic:
+        case spv::OpVectorInsertDynamic:
+        case spv::OpSampledImage:
+        case spv::OpImage:
+        case spv::OpImageQuerySize:
+        case spv::OpImageQuerySizeLod:
+        case spv::OpImageQueryLod:
+        case spv::OpImageQueryLevels:
+        case spv::OpImageQuerySamples:
+        case spv::OpConvertFToU:
+        case spv::OpConvertFToS:
+        case spv::OpConvertSToF:
+        case spv::OpConvertUToF:
+        case spv::OpUConvert:
+        case spv::OpSConvert:
+        case spv::OpFConvert:
+        case spv::OpQuantizeToF16:
+        case spv::OpBitcast:
+        case spv::OpSNegate:
+        case spv::OpFNegate:
+        case spv::OpIAdd:
+        case spv::OpFAdd:
+        case spv::OpISub:
+        case spv::OpFSub:
+        case spv::OpIMul:
+        case spv::OpFMul:
+        case spv::OpUDiv:
+        case spv::OpSDiv:
+        case spv::OpFDiv:
+        case spv::OpUMod:
+        case spv::OpSRem:
+        case spv::OpSMod:
+        case spv::OpFRem:
+        case spv::OpFMod:
+        case spv::OpVectorTimesScalar:
+        case spv::OpMatrixTimesScalar:
+        case spv::OpVectorTimesMatrix:
+        case spv::OpMatrixTimesVector:
+        case spv::OpMatrixTimesMatrix:
+        case spv::OpOuterProduct:
+        case spv::OpDot:
+        case spv::OpIAddCarry:
+        case spv::OpISubBorrow:
+        case spv::OpUMulExtended:
+        case spv::OpSMulExtended:
+        case spv::OpAny:
+        case spv::OpAll:
+        case spv::OpIsNan:
+        case spv::OpIsInf:
+        case spv::OpLogicalEqual:
+        case spv::OpLogicalNotEqual:
+        case spv::OpLogicalOr:
+        case spv::OpLogicalAnd:
+        case spv::OpLogicalNot:
+        case spv::OpSelect:
+        case spv::OpIEqual:
+        case spv::OpINotEqual:
+        case spv::OpUGreaterThan:
+        case spv::OpSGreaterThan:
+        case spv::OpUGreaterThanEqual:
+        case spv::OpSGreaterThanEqual:
+        case spv::OpULessThan:
+        case spv::OpSLessThan:
+        case spv::OpULessThanEqual:
+        case spv::OpSLessThanEqual:
+        case spv::OpFOrdEqual:
+        case spv::OpFUnordEqual:
+        case spv::OpFOrdNotEqual:
+        case spv::OpFUnordNotEqual:
+        case spv::OpFOrdLessThan:
+        case spv::OpFUnordLessThan:
+        case spv::OpFOrdGreaterThan:
+        case spv::OpFUnordGreaterThan:
+        case spv::OpFOrdLessThanEqual:
+        case spv::OpFUnordLessThanEqual:
+        case spv::OpFOrdGreaterThanEqual:
+        case spv::OpFUnordGreaterThanEqual:
+        case spv::OpShiftRightLogical:
+        case spv::OpShiftRightArithmetic:
+        case spv::OpShiftLeftLogical:
+        case spv::OpBitwiseOr:
+        case spv::OpBitwiseXor:
+        case spv::OpBitwiseAnd:
+        case spv::OpNot:
+        case spv::OpBitFieldInsert:
+        case spv::OpBitFieldSExtract:
+        case spv::OpBitFieldUExtract:
+        case spv::OpBitReverse:
+        case spv::OpBitCount:
+        case spv::OpDPdx:
+        case spv::OpDPdy:
+        case spv::OpFwidth:
+        case spv::OpDPdxFine:
+        case spv::OpDPdyFine:
+        case spv::OpFwidthFine:
+        case spv::OpDPdxCoarse:
+        case spv::OpDPdyCoarse:
+        case spv::OpFwidthCoarse:
+        case spv::OpPhi:
+        case spv::OpAtomicLoad:
+        case spv::OpAtomicExchange:
+        case spv::OpAtomicCompareExchange:
+        case spv::OpAtomicIIncrement:
+        case spv::OpAtomicIDecrement:
+        case spv::OpAtomicIAdd:
+        case spv::OpAtomicISub:
+        case spv::OpAtomicSMin:
+        case spv::OpAtomicUMin:
+        case spv::OpAtomicSMax:
+        case spv::OpAtomicUMax:
+        case spv::OpAtomicAnd:
+        case spv::OpAtomicOr:
+        case spv::OpAtomicXor:
+            *resultIndexOut = 2;
+            visitIds(1, 2);
+            visitIds(3, kToEnd);
+            return true;
+
+        // Result type and result id, optionally followed by literals.
+        case spv::OpUndef:
+        case spv::OpFunctionParameter:
+        case spv::OpConstantTrue:
+        case spv::OpConstantFalse:
+        case spv::OpConstantNull:
+        case spv::OpConstant:
+        case spv::OpSpecConstantTrue:
+        case spv::OpSpecConstantFalse:
+        case spv::OpSpecConstant:
+            *resultIndexOut = 2;
+            visitIds(1, 2);
+            return true;
+
+        // Result type and result id, followed by a fixed number of ids and then literals.
+        case spv::OpLoad:
+        case spv::OpCompositeExtract:
+        case spv::OpArrayLength:
+            *resultIndexOut = 2;
+            visitIds(1, 2);
+            visitIds(3, 4);
+            return true;
+        case spv::OpCompositeInsert:
+        case spv::OpVectorShuffle:
+            *resultIndexOut = 2;
+            visitIds(1, 2);
+            visitIds(3, 5);
+            return true;
+        case spv::OpVariable:
+            // The storage class is followed by an optional initializer.
+            *resultIndexOut = 2;
+            visitIds(1, 2);
+            visitIds(4, 5);
+            return true;
+        case spv::OpFunction:
+            // The function control mask is followed by the function type.
+            *resultIndexOut = 2;
+            visitIds(1, 2);
+            visitIds(4, 5);
+            return true;
+        case spv::OpExtInst:
+            // The instruction set is followed by the literal instruction number and then ids.
+            *resultIndexOut = 2;
+            visitIds(1, 2);
+            visitIds(3, 4);
+            visitIds(5, kToEnd);
+            return true;
+
+        // Image instructions with two or three fixed ids, followed by the optional image operands
+        // mask and then only ids.
+        case spv::OpImageSampleImplicitLod:
+        case spv::OpImageSampleExplicitLod:
+        case spv::OpImageSampleProjImplicitLod:
+        case spv::OpImageSampleProjExplicitLod:
+        case spv::OpImageFetch:
+        case spv::OpImageRead:
+            *resultIndexOut = 2;
+            visitIds(1, 2);
+            visitIds(3, 5);
+            visitIds(6, kToEnd);
+            return true;
+        case spv::OpImageSampleDrefImplicitLod:
+        case spv::OpImageSampleDrefExplicitLod:
+        case spv::OpImageSampleProjDrefImplicitLod:
+        case spv::OpImageSampleProjDrefExplicitLod:
+        case spv::OpImageGather:
+        case spv::OpImageDrefGather:
+            *resultIndexOut = 2;
+            visitIds(1, 2);
+            visitIds(3, 6);
+            visitIds(7, kToEnd);
+            return true;
+        case spv::OpImageWrite:
+            visitIds(1, 4);
+            visitIds(5, kToEnd);
+            return true;
+
+        // Types and other instructions without a result type.
+        case spv::OpLabel:
+        case spv::OpExtInstImport:
+        case spv::OpTypeVoid:
+        case spv::OpTypeBool:
+        case spv::OpTypeInt:
+        case spv::OpTypeFloat:
+        case spv::OpTypeSampler:
+            *resultIndexOut = 1;
+            return true;
+        case spv::OpTypeVector:
+        case spv::OpTypeMatrix:
+        case spv::OpTypeImage:
+        case spv::OpTypeSampledImage:
+        case spv::OpTypeRuntimeArray:
+            *resultIndexOut = 1;
+            visitIds(2, 3);
+            return true;
+        case spv::OpTypeArray:
+            *resultIndexOut = 1;
+            visitIds(2, 4);
+            return true;
+        case spv::OpTypeStruct:
+        case spv::OpTypeFunction:
+            *resultIndexOut = 1;
+            visitIds(2, kToEnd);
+            return true;
+        case spv::OpTypePointer:
+            // The storage class is followed by the pointee type.
+            *resultIndexOut = 1;
+            visitIds(3, 4);
+            return true;
+
+        // Instructions without a result.
+        case spv::OpStore:
+        case spv::OpCopyMemory:
+        case spv::OpLoopMerge:
+            visitIds(1, 3);
+            return true;
+        case spv::OpAtomicStore:
+        case spv::OpControlBarrier:
+        case spv::OpMemoryBarrier:
+            visitIds(1, kToEnd);
+            return true;
+        case spv::OpBranchConditional:
+            visitIds(1, 4);
+            return true;
+        case spv::OpSwitch:
+            // The selector and default label are followed by pairs of literal and label.  The
+            // translator only generates switches on 32-bit integers.
+            visitIds(1, 3);
+            for (uint32_t index = 4; index < length; index += 2)
+            {
+                visitIdOperand(index);
+            }
+            return true;
+        case spv::OpReturnValue:
+        case spv::OpBranch:
+        case spv::OpSelectionMerge:
+        case spv::OpName:
+        case spv::OpMemberName:
+        case spv::OpDecorate:
+        case spv::OpMemberDecorate:
+        case spv::OpExecutionMode:
+            visitIds(1, 2);
+            return true;
+        case spv::OpEntryPoint:
+        {
+            // The execution model is followed by the entry point, its name and the interface
+            // variables.
+            visitIds(2, 3);
+            uint32_t interfaceIndex = 3;
+            while (interfaceIndex < length && (instruction[interfaceIndex] >> 24) != 0)
+            {
+                ++interfaceIndex;
+            }
+            visitIds(interfaceIndex + 1, kToEnd);
+            return true;
+        }
+        case spv::OpNop:
+        case spv::OpCapability:
+        case spv::OpExtension:
+        case spv::OpMemoryModel:
+        case spv::OpReturn:
+        case spv::OpKill:
+        case spv::OpUnreachable:
+        case spv::OpFunctionEnd:
+        case spv::OpEmitVertex:
+        case spv::OpEndPrimitive:
+        case spv::OpBeginInvocationInterlockEXT:
+        case spv::OpEndInvocationInterlockEXT:
+            return true;
+
+        default:
+            return false;
+    }
+}
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_SPIRV_VISITINSTRUCTIONIDS_H_
@@ -0,0 +1,373 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PropagateConstants.cpp: Propagate constant values through variables that are never written to,
+// and prune the branches that become unreachable as a result.
+//
+
+#include "compiler/translator/tree_ops/PropagateConstants.h"
+
+#include "common/hash_containers.h"
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/tree_ops/FoldExpressions.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+using ConstantValueMap = angle::HashMap<int, const TConstantUnion *>;
+
+// Only basic non-array, non-struct values are propagated.  Aggregates are typically indexed, and
+// replacing them with constants would duplicate potentially large constant data in the output.
+bool IsPropagatableType(const TType &type)
+{
+    if (type.isArray() || type.getStruct() != nullptr)
+    {
+        return false;
+    }
+
+    switch (type.getBasicType())
+    {
+        case EbtFloat:
+        case EbtInt:
+        case EbtUInt:
+        case EbtBool:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool IsSameConstant(const TConstantUnion *a, const TConstantUnion *b, size_t size)
+{
+    for (size_t index = 0; index < size; ++index)
+    {
+        if (a[index] != b[index])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool HasSideEffects(TIntermNode *node)
+{
+    if (node == nullptr)
+    {
+        return false;
+    }
+
+    TIntermDeclaration *declaration = node->getAsDeclarationNode();
+    if (declaration != nullptr)
+    {
+        for (TIntermNode *declarator : *declaration->getSequence())
+        {
+            TIntermBinary *initNode = declarator->getAsBinaryNode();
+            if (initNode != nullptr && initNode->getRight()->hasSideEffects())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    TIntermTyped *typed = node->getAsTyped();
+    return typed == nullptr || typed->hasSideEffects();
+}
+
+// Gathers the constant values that variables and function parameters are known to hold throughout
+// the shader.
+class CollectConstantValuesTraverser : public TLValueTrackingTraverser
+{
+  public:
+    CollectConstantValuesTraverser(TSymbolTable *symbolTable)
+        : TLValueTrackingTraverser(true, false, false, symbolTable)
+    {}
+
+    void visitSymbol(TIntermSymbol *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override;
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override;
+
+    void getConstantValues(ConstantValueMap *constantValuesOut) const;
+
+  private:
+    // Variables that are initialized with a constant.
+    ConstantValueMap mInitialValues;
+    // Variables that are written to anywhere in the shader.
+    angle::HashSet<int> mWrittenVariables;
+    // For each called function, the value of each of its arguments across all call sites.  nullptr
+    // if the argument is not the same constant at every call site.
+    angle::HashMap<int, TVector<const TConstantUnion *>> mArgumentValues;
+    TVector<const TFunction *> mDefinedFunctions;
+};
+
+void CollectConstantValuesTraverser::visitSymbol(TIntermSymbol *node)
+{
+    if (isLValueRequiredHere())
+    {
+        mWrittenVariables.insert(node->uniqueId().get());
+    }
+}
+
+bool CollectConstantValuesTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    if (node->getOp() != EOpInitialize)
+    {
+        return true;
+    }
+
+    TIntermSymbol *symbol              = node->getLeft()->getAsSymbolNode();
+    TIntermConstantUnion *initialValue = node->getRight()->getAsConstantUnion();
+    if (symbol == nullptr || initialValue == nullptr || !IsPropagatableType(symbol->getType()))
+    {
+        return true;
+    }
+
+    const TQualifier qualifier = symbol->getType().getQualifier();
+    if (qualifier == EvqTemporary || qualifier == EvqGlobal)
+    {
+        mInitialValues[symbol->uniqueId().get()] = initialValue->getConstantValue();
+    }
+
+    return true;
+}
+
+bool CollectConstantValuesTraverser::visitAggregate(Visit visit, TIntermAggregate *node)
+{
+    if (node->getOp() != EOpCallFunctionInAST)
+    {
+        return true;
+    }
+
+    const TFunction *function   = node->getFunction();
+    const size_t paramCount     = function->getParamCount();
+    const TIntermSequence &args = *node->getSequence();
+    ASSERT(args.size() == paramCount);
+
+    auto iter              = mArgumentValues.find(function->uniqueId().get());
+    const bool isFirstCall = iter == mArgumentValues.end();
+    if (isFirstCall)
+    {
+        iter = mArgumentValues
+                   .emplace(function->uniqueId().get(),
+                            TVector<const TConstantUnion *>(paramCount, nullptr))
+                   .first;
+    }
+    TVector<const TConstantUnion *> &argumentValues = iter->second;
+
+    for (size_t paramIndex = 0; paramIndex < paramCount; ++paramIndex)
+    {
+        const TType &paramType         = function->getParam(paramIndex)->getType();
+        const TQualifier qualifier     = paramType.getQualifier();
+        TIntermConstantUnion *argument = args[paramIndex]->getAsConstantUnion();
+        const TConstantUnion *&value   = argumentValues[paramIndex];
+
+        if ((qualifier != EvqParamIn && qualifier != EvqParamConst) || argument == nullptr ||
+            !IsPropagatableType(paramType))
+        {
+            value = nullptr;
+        }
+        else if (isFirstCall)
+        {
+            value = argument->getConstantValue();
+        }
+        else if (value != nullptr && !IsSameConstant(value, argument->getConstantValue(),
+                                                     paramType.getObjectSize()))
+        {
+            value = nullptr;
+        }
+    }
+
+    return true;
+}
+
+bool CollectConstantValuesTraverser::visitFunctionDefinition(Visit visit,
+                                                             TIntermFunctionDefinition *node)
+{
+    mDefinedFunctions.push_back(node->getFunction());
+    return true;
+}
+
+void CollectConstantValuesTraverser::getConstantValues(ConstantValueMap *constantValuesOut) const
+{
+    for (const auto &initialValue : mInitialValues)
+    {
+        if (mWrittenVariables.count(initialValue.first) == 0)
+        {
+            (*constantValuesOut)[initialValue.first] = initialValue.second;
+        }
+    }
+
+    for (const TFunction *function : mDefinedFunctions)
+    {
+        auto iter = mArgumentValues.find(function->uniqueId().get());
+        if (iter == mArgumentValues.end())
+        {
+            continue;
+        }
+
+        const TVector<const TConstantUnion *> &argumentValues = iter->second;
+        ASSERT(argumentValues.size() == function->getParamCount());
+        for (size_t paramIndex = 0; paramIndex < argumentValues.size(); ++paramIndex)
+        {
+            const int paramId = function->getParam(paramIndex)->uniqueId().get();
+            if (argumentValues[paramIndex] != nullptr && mWrittenVariables.count(paramId) == 0)
+            {
+                (*constantValuesOut)[paramId] = argumentValues[paramIndex];
+            }
+        }
+    }
+}
+
+// Replaces reads of variables with known constant values with the constant.
+class ReplaceConstantVariablesTraverser : public TIntermTraverser
+{
+  public:
+    ReplaceConstantVariablesTraverser(const ConstantValueMap &constantValues)
+        : TIntermTraverser(true, false, false), mConstantValues(constantValues)
+    {}
+
+    bool didReplace() const { return mDidReplace; }
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        auto iter = mConstantValues.find(node->uniqueId().get());
+        if (iter == mConstantValues.end())
+        {
+            return;
+        }
+
+        TType *constType = new TType(node->getType());
+        constType->setQualifier(EvqConst);
+
+        TIntermConstantUnion *replacement = new TIntermConstantUnion(iter->second, *constType);
+        replacement->setLine(node->getLine());
+        queueReplacement(replacement, OriginalNode::IS_DROPPED);
+        mDidReplace = true;
+    }
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        // Don't replace the variable being declared, only its initializer.
+        if (node->getOp() == EOpInitialize)
+        {
+            node->getRight()->traverse(this);
+            return false;
+        }
+        return true;
+    }
+
+  private:
+    const ConstantValueMap &mConstantValues;
+    bool mDidReplace = false;
+};
+
+// Removes if/else branches and loops that are known never to execute.
+class PruneDeadBranchesTraverser : public TIntermTraverser
+{
+  public:
+    PruneDeadBranchesTraverser() : TIntermTraverser(true, false, false) {}
+
+    bool didPrune() const { return mDidPrune; }
+
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override
+    {
+        TIntermConstantUnion *condition = node->getCondition()->getAsConstantUnion();
+        TIntermBlock *parentBlock       = getParentNode()->getAsBlock();
+        if (condition == nullptr || parentBlock == nullptr)
+        {
+            return true;
+        }
+
+        TIntermBlock *taken =
+            condition->getBConst(0) ? node->getTrueBlock() : node->getFalseBlock();
+
+        TIntermSequence replacement;
+        if (taken != nullptr)
+        {
+            replacement.push_back(taken);
+        }
+        mMultiReplacements.emplace_back(parentBlock, node, std::move(replacement));
+        mDidPrune = true;
+
+        // The taken branch is visited again in the next iteration.
+        return false;
+    }
+
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        // A do-while loop executes at least once, and its body may contain break and continue
+        // statements, so it cannot be trivially unwrapped.
+        if (node->getType() == ELoopDoWhile)
+        {
+            return true;
+        }
+
+        TIntermTyped *conditionNode     = node->getCondition();
+        TIntermConstantUnion *condition =
+            conditionNode != nullptr ? conditionNode->getAsConstantUnion() : nullptr;
+        TIntermBlock *parentBlock = getParentNode()->getAsBlock();
+        if (condition == nullptr || condition->getBConst(0) || parentBlock == nullptr ||
+            HasSideEffects(node->getInit()))
+        {
+            return true;
+        }
+
+        mMultiReplacements.emplace_back(parentBlock, node, TIntermSequence());
+        mDidPrune = true;
+        return false;
+    }
+
+  private:
+    bool mDidPrune = false;
+};
+}  // anonymous namespace
+
+bool PropagateConstants(TCompiler *compiler,
+                        TIntermBlock *root,
+                        TSymbolTable *symbolTable,
+                        TDiagnostics *diagnostics)
+{
+    bool changed = false;
+    do
+    {
+        CollectConstantValuesTraverser collect(symbolTable);
+        root->traverse(&collect);
+
+        ConstantValueMap constantValues;
+        collect.getConstantValues(&constantValues);
+
+        ReplaceConstantVariablesTraverser replace(constantValues);
+        if (!constantValues.empty())
+        {
+            root->traverse(&replace);
+            if (!replace.updateTree(compiler, root))
+            {
+                return false;
+            }
+        }
+
+        if (!FoldExpressions(compiler, root, diagnostics))
+        {
+            return false;
+        }
+
+        PruneDeadBranchesTraverser prune;
+        root->traverse(&prune);
+        if (!prune.updateTree(compiler, root))
+        {
+            return false;
+        }
+
+        changed = replace.didReplace() || prune.didPrune();
+    } while (changed);
+
+    return true;
+}
+
+}  // namespace sh
@@ -0,0 +1,38 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PropagateConstants.h: Propagate constant values through variables that are never written to
+// after their initialization, and prune the branches that become unreachable as a result.  This
+// covers:
+//   1. Global and local variables that are initialized with a constant and never assigned to.
+//   2. Function parameters that receive the same constant at every call site and are never
+//      assigned to inside the function.
+//   3. if/else statements whose condition folds to a constant, and while and for loops whose
+//      condition folds to false.
+// Pruning a branch may remove the only write to another variable, so the above is iterated until
+// nothing changes.  Functions that are only called from pruned branches are later removed by the
+// unused function pruning.
+
+#ifndef COMPILER_TRANSLATOR_TREEOPS_PROPAGATECONSTANTS_H_
+#define COMPILER_TRANSLATOR_TREEOPS_PROPAGATECONSTANTS_H_
+
+#include "common/angleutils.h"
+
+namespace sh
+{
+
+class TCompiler;
+class TDiagnostics;
+class TIntermBlock;
+class TSymbolTable;
+
+[[nodiscard]] bool PropagateConstants(TCompiler *compiler,
+                                      TIntermBlock *root,
+                                      TSymbolTable *symbolTable,
+                                      TDiagnostics *diagnostics);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEOPS_PROPAGATECONSTANTS_H_
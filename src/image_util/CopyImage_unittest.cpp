@@ -0,0 +1,198 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CopyImage_unittest.cpp: Unit tests for the fast copy functions used by glReadPixels.
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "common/mathutil.h"
+#include "image_util/copyimage.h"
+
+using namespace angle;
+using namespace testing;
+
+namespace
+{
+using CopyFunction = void (*)(const uint8_t *source,
+                              int srcXAxisPitch,
+                              int srcYAxisPitch,
+                              uint8_t *dest,
+                              int destXAxisPitch,
+                              int destYAxisPitch,
+                              int destWidth,
+                              int destHeight);
+
+// The generic conversion done by PackPixels without a fast copy function.
+template <typename SourceType, typename DestType>
+void ReferenceCopy(const uint8_t *source,
+                   int srcXAxisPitch,
+                   int srcYAxisPitch,
+                   uint8_t *dest,
+                   int destXAxisPitch,
+                   int destYAxisPitch,
+                   int destWidth,
+                   int destHeight)
+{
+    for (int y = 0; y < destHeight; ++y)
+    {
+        for (int x = 0; x < destWidth; ++x)
+        {
+            gl::ColorF color;
+            ReadColor<SourceType, float>(source + y * srcYAxisPitch + x * srcXAxisPitch,
+                                         reinterpret_cast<uint8_t *>(&color));
+            WriteColor<DestType, float>(reinterpret_cast<const uint8_t *>(&color),
+                                        dest + y * destYAxisPitch + x * destXAxisPitch);
+        }
+    }
+}
+
+// Copies images of many widths with the fast copy function and the reference, with padded rows,
+// forwards and, as PackPixels does for y-flipped and rotated readbacks, backwards.
+void TestCopyMatchesReference(CopyFunction copyFunction,
+                              CopyFunction referenceFunction,
+                              const std::vector<uint8_t> &sourceValues,
+                              size_t sourceValueBytes,
+                              int sourcePixelBytes,
+                              int destPixelBytes)
+{
+    constexpr int kHeight = 3;
+    for (int width = 1; width <= 41; ++width)
+    {
+        const int sourceRowPitch = (width + 3) * sourcePixelBytes;
+        const int destRowPitch   = (width + 1) * destPixelBytes;
+
+        // Fill the source with a mix of the values.
+        std::vector<uint8_t> source(sourceRowPitch * kHeight);
+        const size_t valueCount = sourceValues.size() / sourceValueBytes;
+        for (size_t index = 0; index < source.size() / sourceValueBytes; ++index)
+        {
+            const size_t value = (index * 7 + width) % valueCount;
+            memcpy(source.data() + index * sourceValueBytes,
+                   sourceValues.data() + value * sourceValueBytes, sourceValueBytes);
+        }
+
+        struct Direction
+        {
+            int xAxisPitch;
+            int yAxisPitch;
+            int firstPixelOffset;
+        };
+        const Direction kDirections[] = {
+            {sourcePixelBytes, sourceRowPitch, 0},
+            {sourcePixelBytes, -sourceRowPitch, sourceRowPitch * (kHeight - 1)},
+            {-sourcePixelBytes, sourceRowPitch, sourcePixelBytes * (width - 1)},
+        };
+
+        for (const Direction &direction : kDirections)
+        {
+            std::vector<uint8_t> dest(destRowPitch * kHeight, 0);
+            std::vector<uint8_t> expected(destRowPitch * kHeight, 0);
+
+            const uint8_t *firstPixel = source.data() + direction.firstPixelOffset;
+            copyFunction(firstPixel, direction.xAxisPitch, direction.yAxisPitch, dest.data(),
+                         destPixelBytes, destRowPitch, width, kHeight);
+            referenceFunction(firstPixel, direction.xAxisPitch, direction.yAxisPitch,
+                              expected.data(), destPixelBytes, destRowPitch, width, kHeight);
+
+            EXPECT_EQ(dest, expected) << "width " << width << " pitches " << direction.xAxisPitch
+                                      << ", " << direction.yAxisPitch;
+        }
+    }
+}
+
+std::vector<uint8_t> AllBytes()
+{
+    std::vector<uint8_t> values(256);
+    for (size_t value = 0; value < values.size(); ++value)
+    {
+        values[value] = static_cast<uint8_t>(value * 73);
+    }
+    return values;
+}
+
+// Test that the BGRA8 to RGBA8 copy matches the generic conversion.
+TEST(CopyImage, BGRA8ToRGBA8MatchesReference)
+{
+    TestCopyMatchesReference(CopyBGRA8ToRGBA8, ReferenceCopy<B8G8R8A8, R8G8B8A8>, AllBytes(), 1, 4,
+                             4);
+}
+
+// Test that the RGBA8 to BGRA8 copy matches the generic conversion.
+TEST(CopyImage, RGBA8ToBGRA8MatchesReference)
+{
+    TestCopyMatchesReference(CopyRGBA8ToBGRA8, ReferenceCopy<R8G8B8A8, B8G8R8A8>, AllBytes(), 1, 4,
+                             4);
+}
+
+// Test that the RGBA16F to RGBA8 copy matches the generic conversion for every half-float in
+// [0, 1].
+TEST(CopyImage, RGBA16FToRGBA8MatchesReference)
+{
+    std::vector<uint8_t> halves;
+    for (uint32_t half = 0; half <= gl::float32ToFloat16(1.0f); ++half)
+    {
+        halves.push_back(static_cast<uint8_t>(half));
+        halves.push_back(static_cast<uint8_t>(half >> 8));
+    }
+
+    TestCopyMatchesReference(CopyRGBA16FToRGBA8, ReferenceCopy<R16G16B16A16F, R8G8B8A8>, halves,
+                             2, 8, 4);
+}
+
+// Test that the RGBA16F to RGBA32F copy matches the generic conversion, including for denormals,
+// infinities and NaNs.
+TEST(CopyImage, RGBA16FToRGBA32FMatchesReference)
+{
+    std::vector<uint8_t> halves;
+    for (uint32_t half = 0; half < 65536; half += 3)
+    {
+        halves.push_back(static_cast<uint8_t>(half));
+        halves.push_back(static_cast<uint8_t>(half >> 8));
+    }
+
+    TestCopyMatchesReference(CopyRGBA16FToRGBA32F, ReferenceCopy<R16G16B16A16F, R32G32B32A32F>,
+                             halves, 2, 8, 16);
+}
+
+// Test that every other half-float is clamped to [0, 1], with NaN becoming 0.
+TEST(CopyImage, RGBA16FToRGBA8Clamps)
+{
+    // One pixel per half-float, with the value in every channel.
+    constexpr int kWidth = 65536;
+    std::vector<uint16_t> source(kWidth * 4);
+    for (int half = 0; half < kWidth; ++half)
+    {
+        std::fill_n(source.begin() + half * 4, 4, static_cast<uint16_t>(half));
+    }
+
+    std::vector<uint8_t> dest(kWidth * 4);
+    CopyRGBA16FToRGBA8(reinterpret_cast<const uint8_t *>(source.data()), 8, kWidth * 8,
+                       dest.data(), 4, kWidth * 4, kWidth, 1);
+
+    for (int half = 0; half < kWidth; ++half)
+    {
+        const float value = gl::float16ToFloat32(static_cast<uint16_t>(half));
+        uint8_t expected  = 0;
+        if (value >= 1.0f)
+        {
+            expected = 255;
+        }
+        else if (value > 0.0f)
+        {
+            expected = gl::floatToNormalized<uint8_t>(value);
+        }
+
+        for (int channel = 0; channel < 4; ++channel)
+        {
+            ASSERT_EQ(dest[half * 4 + channel], expected) << "half 0x" << std::hex << half;
+        }
+    }
+}
+}  // anonymous namespace
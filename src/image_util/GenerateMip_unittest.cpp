@@ -0,0 +1,221 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenerateMip_unittest.cpp: Unit tests for mip generation functions.
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "common/WorkerThread.h"
+#include "common/mathutil.h"
+#include "image_util/generatemip.h"
+#include "image_util/loadimage.h"
+
+using namespace angle;
+using namespace testing;
+
+namespace
+{
+uint32_t NextRandom(uint32_t *seed)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+// Fills the image with random bytes, which for RGBA16F includes denormals, infinities and NaNs.
+template <typename T>
+void FillImage(std::vector<uint8_t> *image, uint32_t seed)
+{
+    for (uint8_t &value : *image)
+    {
+        value = static_cast<uint8_t>(NextRandom(&seed));
+    }
+}
+
+// Random bits make a lot of NaNs and very large or small floats, so fill RGBA32F with values that
+// are likely to come up instead.
+template <>
+void FillImage<R32G32B32A32F>(std::vector<uint8_t> *image, uint32_t seed)
+{
+    float *values = reinterpret_cast<float *>(image->data());
+    for (size_t index = 0; index < image->size() / sizeof(float); ++index)
+    {
+        values[index] = static_cast<float>(NextRandom(&seed) % 20000) / 1000.0f - 10.0f;
+    }
+}
+
+// The 2x2 box filter of GenerateMip, without the SIMD rows.
+template <typename T>
+void ReferenceGenerateMipXY(size_t sourceWidth,
+                            size_t sourceHeight,
+                            const uint8_t *sourceData,
+                            size_t sourceRowPitch,
+                            uint8_t *destData,
+                            size_t destRowPitch)
+{
+    for (size_t y = 0; y < sourceHeight / 2; ++y)
+    {
+        for (size_t x = 0; x < sourceWidth / 2; ++x)
+        {
+            const T *src0 =
+                reinterpret_cast<const T *>(sourceData + y * 2 * sourceRowPitch) + x * 2;
+            const T *src1 =
+                reinterpret_cast<const T *>(sourceData + (y * 2 + 1) * sourceRowPitch) + x * 2;
+            T *dst = reinterpret_cast<T *>(destData + y * destRowPitch) + x;
+
+            T tmp0, tmp1;
+            T::average(&tmp0, src0, src1);
+            T::average(&tmp1, src0 + 1, src1 + 1);
+            T::average(dst, &tmp0, &tmp1);
+        }
+    }
+}
+
+template <typename T>
+void TestGenerateMipMatchesReference()
+{
+    for (size_t sourceHeight = 2; sourceHeight <= 5; ++sourceHeight)
+    {
+        for (size_t sourceWidth = 2; sourceWidth <= 41; ++sourceWidth)
+        {
+            // Padding at the end of the rows makes sure the pitch is respected.
+            const size_t sourceRowPitch = (sourceWidth + 3) * sizeof(T);
+            const size_t destWidth      = sourceWidth / 2;
+            const size_t destHeight     = sourceHeight / 2;
+            const size_t destRowPitch   = (destWidth + 1) * sizeof(T);
+
+            std::vector<uint8_t> source(sourceRowPitch * sourceHeight);
+            FillImage<T>(&source, static_cast<uint32_t>(sourceWidth * 7 + sourceHeight));
+
+            std::vector<uint8_t> dest(destRowPitch * destHeight, 0);
+            std::vector<uint8_t> expected(destRowPitch * destHeight, 0);
+
+            GenerateMip<T>(sourceWidth, sourceHeight, 1, source.data(), sourceRowPitch,
+                           source.size(), dest.data(), destRowPitch, dest.size());
+            ReferenceGenerateMipXY<T>(sourceWidth, sourceHeight, source.data(), sourceRowPitch,
+                                      expected.data(), destRowPitch);
+
+            EXPECT_EQ(dest, expected) << sourceWidth << "x" << sourceHeight;
+        }
+    }
+}
+
+// Generates the chain with GenerateMipChain and one level at a time with GenerateMip, and checks
+// that the results are the same.
+template <typename T>
+void TestGenerateMipChainMatchesGenerateMip(const ImageLoadContext &context,
+                                            size_t width,
+                                            size_t height,
+                                            size_t depth)
+{
+    const size_t levelCount = static_cast<size_t>(gl::log2(std::max({width, height, depth})));
+
+    std::vector<uint8_t> source(width * height * depth * sizeof(T));
+    FillImage<T>(&source, static_cast<uint32_t>(width + height + depth));
+
+    std::vector<std::vector<uint8_t>> levels(levelCount);
+    std::vector<std::vector<uint8_t>> expectedLevels(levelCount);
+    std::vector<MipLevelDestination> destLevels(levelCount);
+
+    size_t levelWidth  = width;
+    size_t levelHeight = height;
+    size_t levelDepth  = depth;
+    for (size_t level = 0; level < levelCount; ++level)
+    {
+        const size_t previousWidth  = levelWidth;
+        const size_t previousHeight = levelHeight;
+        const size_t previousDepth  = levelDepth;
+        levelWidth                  = std::max<size_t>(1, levelWidth >> 1);
+        levelHeight                 = std::max<size_t>(1, levelHeight >> 1);
+        levelDepth                  = std::max<size_t>(1, levelDepth >> 1);
+
+        const size_t rowPitch   = levelWidth * sizeof(T);
+        const size_t depthPitch = rowPitch * levelHeight;
+        levels[level].resize(depthPitch * levelDepth, 0);
+        expectedLevels[level].resize(depthPitch * levelDepth, 0);
+        destLevels[level] = {levels[level].data(), rowPitch, depthPitch};
+
+        const uint8_t *previousData =
+            level == 0 ? source.data() : expectedLevels[level - 1].data();
+        const size_t previousRowPitch = previousWidth * sizeof(T);
+        GenerateMip<T>(previousWidth, previousHeight, previousDepth, previousData,
+                       previousRowPitch, previousRowPitch * previousHeight,
+                       expectedLevels[level].data(), rowPitch, depthPitch);
+    }
+
+    GenerateMipChain(context, GenerateMip<T>, sizeof(T), width, height, depth, source.data(),
+                     width * sizeof(T), width * height * sizeof(T), destLevels.data(), levelCount);
+
+    for (size_t level = 0; level < levelCount; ++level)
+    {
+        EXPECT_EQ(levels[level], expectedLevels[level])
+            << width << "x" << height << "x" << depth << " level " << level + 1;
+    }
+}
+
+template <typename T>
+void TestGenerateMipChain()
+{
+    ImageLoadContext singleThreaded;
+    ImageLoadContext multiThreaded;
+    multiThreaded.multiThreadPool = WorkerThreadPool::Create(4, ANGLEPlatformCurrent());
+
+    for (const ImageLoadContext *context : {&singleThreaded, &multiThreaded})
+    {
+        TestGenerateMipChainMatchesGenerateMip<T>(*context, 1024, 1024, 1);
+        TestGenerateMipChainMatchesGenerateMip<T>(*context, 1023, 517, 1);
+        TestGenerateMipChainMatchesGenerateMip<T>(*context, 130, 1100, 1);
+        TestGenerateMipChainMatchesGenerateMip<T>(*context, 300, 1, 1);
+        TestGenerateMipChainMatchesGenerateMip<T>(*context, 3, 3, 1);
+        TestGenerateMipChainMatchesGenerateMip<T>(*context, 33, 17, 9);
+    }
+}
+
+// Test that the 2D mips of RGBA8 match the scalar box filter.
+TEST(GenerateMip, RGBA8MatchesReference)
+{
+    TestGenerateMipMatchesReference<R8G8B8A8>();
+}
+
+// Test that the 2D mips of BGRA8 match the scalar box filter.
+TEST(GenerateMip, BGRA8MatchesReference)
+{
+    TestGenerateMipMatchesReference<B8G8R8A8>();
+}
+
+// Test that the 2D mips of RGBA16F match the scalar box filter, including with special values.
+TEST(GenerateMip, RGBA16FMatchesReference)
+{
+    TestGenerateMipMatchesReference<R16G16B16A16F>();
+}
+
+// Test that the 2D mips of RGBA32F match the scalar box filter.
+TEST(GenerateMip, RGBA32FMatchesReference)
+{
+    TestGenerateMipMatchesReference<R32G32B32A32F>();
+}
+
+// Test that generating the mip chain in tiles gives the same result as one level at a time.
+TEST(GenerateMip, RGBA8ChainMatchesLevels)
+{
+    TestGenerateMipChain<R8G8B8A8>();
+}
+
+// Same as above with pixels of a different size, and so different tiles.
+TEST(GenerateMip, RGBA16FChainMatchesLevels)
+{
+    TestGenerateMipChain<R16G16B16A16F>();
+}
+
+// Same as above with a format that is not vectorized.
+TEST(GenerateMip, R8ChainMatchesLevels)
+{
+    TestGenerateMipChain<R8>();
+}
+}  // anonymous namespace
@@ -185,6 +185,77 @@ void TestLoadSbyteRGBToRGBA(ImageLoadContext &context,
                                                 outputRowPitch, outputDepthPitch);
 }
 
+using LoadFunction = void (*)(const ImageLoadContext &context,
+                              size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+
+// Converts a single pixel, as a reference for the load functions that are vectorized.
+using ReferenceLoadFunction = void (*)(const uint8_t *input, uint8_t *output);
+
+// Verifies that a load function produces bit-exact results with the reference for every width up
+// to and beyond the SIMD widths, and with input and output addresses at different alignments.  The
+// input addresses are offset by multiples of the input component size, which the load functions
+// can assume.
+void TestLoadFunctionAgainstReference(const char *name,
+                                      LoadFunction loadFunction,
+                                      ReferenceLoadFunction referenceFunction,
+                                      size_t inputPixelBytes,
+                                      size_t inputComponentBytes,
+                                      size_t outputPixelBytes)
+{
+    constexpr size_t kHeight        = 3;
+    constexpr size_t kMaxWidth      = 67;
+    constexpr size_t kOffsetCount   = 4;
+    constexpr uint8_t kInitialValue = 0xAA;
+
+    ImageLoadContext context;
+    uint32_t seed = 1;
+    for (size_t width = 1; width <= kMaxWidth; ++width)
+    {
+        for (size_t offset = 0; offset < kOffsetCount; ++offset)
+        {
+            const size_t inputOffset   = offset * inputComponentBytes;
+            const size_t outputOffset  = offset * 4;
+            const size_t inputRowPitch = rx::roundUpPow2(width * inputPixelBytes, size_t(4));
+            const size_t outputRowPitch = width * outputPixelBytes;
+
+            std::vector<uint8_t> input(inputOffset + inputRowPitch * kHeight);
+            for (uint8_t &value : input)
+            {
+                seed  = seed * 1664525u + 1013904223u;
+                value = static_cast<uint8_t>(seed >> 24);
+            }
+
+            std::vector<uint8_t> output(outputOffset + outputRowPitch * kHeight, kInitialValue);
+            std::vector<uint8_t> expected(output);
+
+            loadFunction(context, width, kHeight, 1, input.data() + inputOffset, inputRowPitch,
+                         inputRowPitch * kHeight, output.data() + outputOffset, outputRowPitch,
+                         outputRowPitch * kHeight);
+
+            for (size_t y = 0; y < kHeight; ++y)
+            {
+                for (size_t x = 0; x < width; ++x)
+                {
+                    referenceFunction(
+                        &input[inputOffset + y * inputRowPitch + x * inputPixelBytes],
+                        &expected[outputOffset + y * outputRowPitch + x * outputPixelBytes]);
+                }
+            }
+
+            ASSERT_EQ(output, expected)
+                << name << ": mismatch with width " << width << " and offset " << offset;
+        }
+    }
+}
+
 void TestLoadByteRGBToRGBAForAllCases(ImageLoadContext &context,
                                       size_t inputCase,
                                       size_t width,
@@ -504,4 +575,94 @@ TEST(LoadToNative3To4, LoadByteRGBToRGBAWithUnalignedWidthAndAlignment4)
         TestLoadByteRGBToRGBAForAllCases(context, alignment, 5, 5, 1, 0, 0, alignment);
     }
 }
+
+// Tests that the vectorized LA8 to RGBA8 loading function matches the scalar conversion.
+TEST(LoadToNative, LoadLA8ToRGBA8MatchesReference)
+{
+    TestLoadFunctionAgainstReference(
+        "LoadLA8ToRGBA8", LoadLA8ToRGBA8,
+        [](const uint8_t *input, uint8_t *output) {
+            output[0] = input[0];
+            output[1] = input[0];
+            output[2] = input[0];
+            output[3] = input[1];
+        },
+        2, 1, 4);
+}
+
+// Tests that the vectorized RGB8 to BGRX8 loading function matches the scalar conversion.
+TEST(LoadToNative, LoadRGB8ToBGRX8MatchesReference)
+{
+    TestLoadFunctionAgainstReference(
+        "LoadRGB8ToBGRX8", LoadRGB8ToBGRX8,
+        [](const uint8_t *input, uint8_t *output) {
+            output[0] = input[2];
+            output[1] = input[1];
+            output[2] = input[0];
+            output[3] = 0xFF;
+        },
+        3, 1, 4);
+}
+
+// Tests that the vectorized RGBA8 to BGRA8 loading function matches the scalar conversion.
+TEST(LoadToNative, LoadRGBA8ToBGRA8MatchesReference)
+{
+    TestLoadFunctionAgainstReference(
+        "LoadRGBA8ToBGRA8", LoadRGBA8ToBGRA8,
+        [](const uint8_t *input, uint8_t *output) {
+            output[0] = input[2];
+            output[1] = input[1];
+            output[2] = input[0];
+            output[3] = input[3];
+        },
+        4, 4, 4);
+}
+
+// Tests that the vectorized R5G6B5 to RGBA8 loading function matches the scalar conversion.
+TEST(LoadToNative, LoadR5G6B5ToRGBA8MatchesReference)
+{
+    TestLoadFunctionAgainstReference(
+        "LoadR5G6B5ToRGBA8", LoadR5G6B5ToRGBA8,
+        [](const uint8_t *input, uint8_t *output) {
+            uint16_t rgb;
+            memcpy(&rgb, input, sizeof(rgb));
+            output[0] = static_cast<uint8_t>(((rgb & 0xF800) >> 8) | ((rgb & 0xF800) >> 13));
+            output[1] = static_cast<uint8_t>(((rgb & 0x07E0) >> 3) | ((rgb & 0x07E0) >> 9));
+            output[2] = static_cast<uint8_t>(((rgb & 0x001F) << 3) | ((rgb & 0x001F) >> 2));
+            output[3] = 0xFF;
+        },
+        2, 2, 4);
+}
+
+// Tests that the vectorized R5G6B5 to BGRA8 loading function matches the scalar conversion.
+TEST(LoadToNative, LoadR5G6B5ToBGRA8MatchesReference)
+{
+    TestLoadFunctionAgainstReference(
+        "LoadR5G6B5ToBGRA8", LoadR5G6B5ToBGRA8,
+        [](const uint8_t *input, uint8_t *output) {
+            uint16_t rgb;
+            memcpy(&rgb, input, sizeof(rgb));
+            output[0] = static_cast<uint8_t>(((rgb & 0x001F) << 3) | ((rgb & 0x001F) >> 2));
+            output[1] = static_cast<uint8_t>(((rgb & 0x07E0) >> 3) | ((rgb & 0x07E0) >> 9));
+            output[2] = static_cast<uint8_t>(((rgb & 0xF800) >> 8) | ((rgb & 0xF800) >> 13));
+            output[3] = 0xFF;
+        },
+        2, 2, 4);
+}
+
+// Tests that the vectorized RGB10A2 to RGBA8 loading function matches the scalar conversion.
+TEST(LoadToNative, LoadRGB10A2ToRGBA8MatchesReference)
+{
+    TestLoadFunctionAgainstReference(
+        "LoadRGB10A2ToRGBA8", LoadRGB10A2ToRGBA8,
+        [](const uint8_t *input, uint8_t *output) {
+            uint32_t rgba;
+            memcpy(&rgba, input, sizeof(rgba));
+            output[0] = static_cast<uint8_t>((rgba & 0x000003FF) >> 2);
+            output[1] = static_cast<uint8_t>((rgba & 0x000FFC00) >> 12);
+            output[2] = static_cast<uint8_t>((rgba & 0x3FF00000) >> 22);
+            output[3] = static_cast<uint8_t>(((rgba & 0xC0000000) >> 30) * 0x55);
+        },
+        4, 4, 4);
+}
 }  // namespace
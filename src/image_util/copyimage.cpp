@@ -12,6 +12,25 @@
 
 #include "image_util/copyimage.h"
 
+#include <algorithm>
+#include <utility>
+
+#include "common/float16_utils.h"
+#include "common/mathutil.h"
+
+// The rows are only vectorized where the instructions are part of the baseline of the target, so
+// no runtime check is necessary.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ANGLE_COPYIMAGE_USE_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_COPYIMAGE_USE_NEON
+#    if defined(__aarch64__) || defined(_M_ARM64)
+#        define ANGLE_COPYIMAGE_USE_NEON_A64
+#    endif
+#endif
+
 namespace angle
 {
 
@@ -24,6 +43,147 @@ inline uint32_t SwizzleBGRAToRGBA(uint32_t argb)
            ((argb & 0xFF00FF00));         // Keep alpha and green
 }
 
+// Swaps the first and third channels of a row of 4-byte pixels.  Returns the number of pixels
+// processed; the caller swizzles the rest.
+size_t SwizzleBGRAToRGBARow(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_COPYIMAGE_USE_SSE2)
+    const __m128i greenAlphaMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x * 4));
+        // Swapping the 16-bit halves of each pixel swaps blue and red.
+        const __m128i redBlue    = _mm_andnot_si128(greenAlphaMask, pixels);
+        const __m128i swapped    = _mm_or_si128(_mm_srli_epi32(redBlue, 16),
+                                                _mm_slli_epi32(redBlue, 16));
+        const __m128i greenAlpha = _mm_and_si128(pixels, greenAlphaMask);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x * 4),
+                         _mm_or_si128(greenAlpha, swapped));
+    }
+#elif defined(ANGLE_COPYIMAGE_USE_NEON)
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8(source + x * 4);
+        std::swap(pixels.val[0], pixels.val[2]);
+        vst4q_u8(dest + x * 4, pixels);
+    }
+#endif
+    return x;
+}
+
+// The conversion of PixelReadFunction of R16G16B16A16_FLOAT followed by PixelWriteFunction of
+// R8G8B8A8_UNORM, with the clamp to [0, 1] that glReadPixels requires of normalized destinations.
+// NaN becomes 0.
+inline uint8_t HalfToUnorm8(uint16_t half)
+{
+    const float value = gl::float16ToFloat32(half);
+    return gl::floatToNormalized<uint8_t>(value > 0.0f ? std::min(value, 1.0f) : 0.0f);
+}
+
+// Converts a row of RGBA16F pixels to RGBA8.  Returns the number of pixels processed; the caller
+// converts the rest.
+size_t ConvertRGBA16FToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_COPYIMAGE_USE_SSE2) || defined(ANGLE_COPYIMAGE_USE_NEON_A64)
+    // Halves are widened to floats by moving the exponent and mantissa in place and rebiasing the
+    // exponent.  Denormals become small normals instead, which still round to 0.  Infinity and NaN
+    // are rebiased once more to stay infinity and NaN.
+    constexpr uint32_t kMagnitudeMask  = 0x7FFF;
+    constexpr uint32_t kExponentMask   = 0x7C00;
+    constexpr uint32_t kExponentRebias = (127 - 15) << 23;
+    constexpr uint32_t kInfinityRebias = (128 - 16) << 23;
+    constexpr uint32_t kSignMask       = 0x8000;
+#endif
+#if defined(ANGLE_COPYIMAGE_USE_SSE2)
+    const __m128i magnitudeMask  = _mm_set1_epi32(kMagnitudeMask);
+    const __m128i exponentMask   = _mm_set1_epi32(kExponentMask);
+    const __m128i exponentRebias = _mm_set1_epi32(kExponentRebias);
+    const __m128i infinityRebias = _mm_set1_epi32(kInfinityRebias);
+    const __m128i signMask       = _mm_set1_epi32(kSignMask);
+    const __m128 zero            = _mm_setzero_ps();
+    const __m128 one             = _mm_set1_ps(1.0f);
+    const __m128 scale           = _mm_set1_ps(255.0f);
+    // The same bias as gl::roundToNearest, so the results are identical.
+    const __m128 bias = _mm_set1_ps(0.49999997f);
+
+    auto toFloat = [&](__m128i halves) {
+        const __m128i magnitude = _mm_and_si128(halves, magnitudeMask);
+        const __m128i isInfinityOrNaN =
+            _mm_cmpeq_epi32(_mm_and_si128(halves, exponentMask), exponentMask);
+        __m128i bits = _mm_add_epi32(_mm_slli_epi32(magnitude, 13), exponentRebias);
+        bits         = _mm_add_epi32(bits, _mm_and_si128(isInfinityOrNaN, infinityRebias));
+        bits         = _mm_or_si128(bits, _mm_slli_epi32(_mm_and_si128(halves, signMask), 16));
+        return _mm_castsi128_ps(bits);
+    };
+    auto toUnorm = [&](__m128 value) {
+        // _mm_max_ps returns the second operand if either is NaN.
+        value = _mm_min_ps(_mm_max_ps(value, zero), one);
+        return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, scale), bias));
+    };
+
+    const __m128i zeroi = _mm_setzero_si128();
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i pixels01 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x * 8));
+        const __m128i pixels23 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x * 8 + 16));
+
+        const __m128i unorm0 = toUnorm(toFloat(_mm_unpacklo_epi16(pixels01, zeroi)));
+        const __m128i unorm1 = toUnorm(toFloat(_mm_unpackhi_epi16(pixels01, zeroi)));
+        const __m128i unorm2 = toUnorm(toFloat(_mm_unpacklo_epi16(pixels23, zeroi)));
+        const __m128i unorm3 = toUnorm(toFloat(_mm_unpackhi_epi16(pixels23, zeroi)));
+
+        // All values are in [0, 255], so saturation doesn't change them.
+        const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(unorm0, unorm1),
+                                                _mm_packs_epi32(unorm2, unorm3));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x * 4), packed);
+    }
+#elif defined(ANGLE_COPYIMAGE_USE_NEON_A64)
+    const uint32x4_t magnitudeMask  = vdupq_n_u32(kMagnitudeMask);
+    const uint32x4_t exponentMask   = vdupq_n_u32(kExponentMask);
+    const uint32x4_t exponentRebias = vdupq_n_u32(kExponentRebias);
+    const uint32x4_t infinityRebias = vdupq_n_u32(kInfinityRebias);
+    const uint32x4_t signMask       = vdupq_n_u32(kSignMask);
+    const float32x4_t zero          = vdupq_n_f32(0.0f);
+    const float32x4_t one           = vdupq_n_f32(1.0f);
+    const float32x4_t scale         = vdupq_n_f32(255.0f);
+
+    auto toFloat = [&](uint32x4_t halves) {
+        const uint32x4_t magnitude = vandq_u32(halves, magnitudeMask);
+        const uint32x4_t isInfinityOrNaN =
+            vceqq_u32(vandq_u32(halves, exponentMask), exponentMask);
+        uint32x4_t bits = vaddq_u32(vshlq_n_u32(magnitude, 13), exponentRebias);
+        bits            = vaddq_u32(bits, vandq_u32(isInfinityOrNaN, infinityRebias));
+        bits            = vorrq_u32(bits, vshlq_n_u32(vandq_u32(halves, signMask), 16));
+        return vreinterpretq_f32_u32(bits);
+    };
+    auto toUnorm = [&](float32x4_t value) {
+        // vmaxnmq_f32 returns the number if the other operand is NaN.
+        value = vminq_f32(vmaxnmq_f32(value, zero), one);
+        // Rounds to nearest with ties away from zero, like the std::round of gl::roundToNearest.
+        return vmovn_u32(vcvtaq_u32_f32(vmulq_f32(value, scale)));
+    };
+
+    for (; x + 4 <= width; x += 4)
+    {
+        const uint16x8_t pixels01 = vld1q_u16(reinterpret_cast<const uint16_t *>(source + x * 8));
+        const uint16x8_t pixels23 =
+            vld1q_u16(reinterpret_cast<const uint16_t *>(source + x * 8 + 16));
+
+        const uint16x4_t unorm0 = toUnorm(toFloat(vmovl_u16(vget_low_u16(pixels01))));
+        const uint16x4_t unorm1 = toUnorm(toFloat(vmovl_u16(vget_high_u16(pixels01))));
+        const uint16x4_t unorm2 = toUnorm(toFloat(vmovl_u16(vget_low_u16(pixels23))));
+        const uint16x4_t unorm3 = toUnorm(toFloat(vmovl_u16(vget_high_u16(pixels23))));
+
+        vst1_u8(dest + x * 4, vmovn_u16(vcombine_u16(unorm0, unorm1)));
+        vst1_u8(dest + x * 4 + 8, vmovn_u16(vcombine_u16(unorm2, unorm3)));
+    }
+#endif
+    return x;
+}
+
 void CopyBGRA8ToRGBA8Fast(const uint8_t *source,
                           int srcYAxisPitch,
                           uint8_t *dest,
@@ -33,9 +193,13 @@ void CopyBGRA8ToRGBA8Fast(const uint8_t *source,
 {
     for (int y = 0; y < destHeight; ++y)
     {
-        const uint32_t *src32 = reinterpret_cast<const uint32_t *>(source + y * srcYAxisPitch);
-        uint32_t *dest32      = reinterpret_cast<uint32_t *>(dest + y * destYAxisPitch);
-        const uint32_t *end32 = src32 + destWidth;
+        const uint8_t *srcRow = source + y * srcYAxisPitch;
+        uint8_t *destRow      = dest + y * destYAxisPitch;
+
+        const size_t start    = SwizzleBGRAToRGBARow(srcRow, destRow, destWidth);
+        const uint32_t *src32 = reinterpret_cast<const uint32_t *>(srcRow) + start;
+        uint32_t *dest32      = reinterpret_cast<uint32_t *>(destRow) + start;
+        const uint32_t *end32 = reinterpret_cast<const uint32_t *>(srcRow) + destWidth;
         while (src32 != end32)
         {
             *dest32++ = SwizzleBGRAToRGBA(*src32++);
@@ -43,6 +207,29 @@ void CopyBGRA8ToRGBA8Fast(const uint8_t *source,
     }
 }
 
+void CopyRGBA16FToRGBA8Fast(const uint8_t *source,
+                            int srcYAxisPitch,
+                            uint8_t *dest,
+                            int destYAxisPitch,
+                            int destWidth,
+                            int destHeight)
+{
+    for (int y = 0; y < destHeight; ++y)
+    {
+        const uint8_t *srcRow = source + y * srcYAxisPitch;
+        uint8_t *destRow      = dest + y * destYAxisPitch;
+
+        const size_t start  = ConvertRGBA16FToRGBA8Row(srcRow, destRow, destWidth);
+        const uint16_t *src = reinterpret_cast<const uint16_t *>(srcRow) + start * 4;
+        uint8_t *dst        = destRow + start * 4;
+        const uint8_t *end  = destRow + destWidth * 4;
+        while (dst != end)
+        {
+            *dst++ = HalfToUnorm8(*src++);
+        }
+    }
+}
+
 void CopyRGBA8ToRGBA8Fast(const uint8_t *source,
                           int srcYAxisPitch,
                           uint8_t *dest,
@@ -131,4 +318,83 @@ void CopyRGBA8ToRGBA8(const uint8_t *source,
     }
 }
 
+void CopyRGBA8ToBGRA8(const uint8_t *source,
+                      int srcXAxisPitch,
+                      int srcYAxisPitch,
+                      uint8_t *dest,
+                      int destXAxisPitch,
+                      int destYAxisPitch,
+                      int destWidth,
+                      int destHeight)
+{
+    // Swapping red and blue is its own inverse.
+    CopyBGRA8ToRGBA8(source, srcXAxisPitch, srcYAxisPitch, dest, destXAxisPitch, destYAxisPitch,
+                     destWidth, destHeight);
+}
+
+void CopyRGBA16FToRGBA8(const uint8_t *source,
+                        int srcXAxisPitch,
+                        int srcYAxisPitch,
+                        uint8_t *dest,
+                        int destXAxisPitch,
+                        int destYAxisPitch,
+                        int destWidth,
+                        int destHeight)
+{
+    if (srcXAxisPitch == 8 && destXAxisPitch == 4)
+    {
+        CopyRGBA16FToRGBA8Fast(source, srcYAxisPitch, dest, destYAxisPitch, destWidth,
+                               destHeight);
+        return;
+    }
+
+    for (int y = 0; y < destHeight; ++y)
+    {
+        uint8_t *dst       = dest + y * destYAxisPitch;
+        const uint8_t *src = source + y * srcYAxisPitch;
+        const uint8_t *end = src + destWidth * srcXAxisPitch;
+
+        while (src != end)
+        {
+            const uint16_t *src16 = reinterpret_cast<const uint16_t *>(src);
+            for (int channel = 0; channel < 4; ++channel)
+            {
+                dst[channel] = HalfToUnorm8(src16[channel]);
+            }
+            src += srcXAxisPitch;
+            dst += destXAxisPitch;
+        }
+    }
+}
+
+void CopyRGBA16FToRGBA32F(const uint8_t *source,
+                          int srcXAxisPitch,
+                          int srcYAxisPitch,
+                          uint8_t *dest,
+                          int destXAxisPitch,
+                          int destYAxisPitch,
+                          int destWidth,
+                          int destHeight)
+{
+    for (int y = 0; y < destHeight; ++y)
+    {
+        const uint8_t *srcRow = source + y * srcYAxisPitch;
+        uint8_t *destRow      = dest + y * destYAxisPitch;
+
+        if (srcXAxisPitch == 8 && destXAxisPitch == 16)
+        {
+            gl::float16ToFloat32Array(reinterpret_cast<const uint16_t *>(srcRow),
+                                      reinterpret_cast<float *>(destRow), destWidth * 4);
+            continue;
+        }
+
+        for (int x = 0; x < destWidth; ++x)
+        {
+            gl::float16ToFloat32Array(
+                reinterpret_cast<const uint16_t *>(srcRow + x * srcXAxisPitch),
+                reinterpret_cast<float *>(destRow + x * destXAxisPitch), 4);
+        }
+    }
+}
+
 }  // namespace angle
@@ -48,6 +48,34 @@ void CopyRGBA8ToRGBA8(const uint8_t *source,
                       int destWidth,
                       int destHeight);
 
+void CopyRGBA8ToBGRA8(const uint8_t *source,
+                      int srcXAxisPitch,
+                      int srcYAxisPitch,
+                      uint8_t *dest,
+                      int destXAxisPitch,
+                      int destYAxisPitch,
+                      int destWidth,
+                      int destHeight);
+
+// Values outside [0, 1] are clamped, as glReadPixels does for normalized formats.
+void CopyRGBA16FToRGBA8(const uint8_t *source,
+                        int srcXAxisPitch,
+                        int srcYAxisPitch,
+                        uint8_t *dest,
+                        int destXAxisPitch,
+                        int destYAxisPitch,
+                        int destWidth,
+                        int destHeight);
+
+void CopyRGBA16FToRGBA32F(const uint8_t *source,
+                          int srcXAxisPitch,
+                          int srcYAxisPitch,
+                          uint8_t *dest,
+                          int destXAxisPitch,
+                          int destYAxisPitch,
+                          int destWidth,
+                          int destHeight);
+
 }  // namespace angle
 
 #include "copyimage.inc"
@@ -0,0 +1,441 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+// generatemip.cpp: Defines the SIMD rows of GenerateMip and GenerateMipChain.
+
+#include "image_util/generatemip.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "common/WorkerThread.h"
+#include "image_util/loadimage.h"
+
+// The rows are only vectorized where the instructions are part of the baseline of the target, so
+// no runtime check is necessary.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ANGLE_GENERATEMIP_USE_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_GENERATEMIP_USE_NEON
+#endif
+
+namespace angle
+{
+namespace
+{
+#if defined(ANGLE_GENERATEMIP_USE_SSE2)
+// gl::average on every byte.  Unlike _mm_avg_epu8, rounds down.
+inline __m128i AverageU8(__m128i a, __m128i b)
+{
+    const __m128i roundingBits = _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1));
+    return _mm_sub_epi8(_mm_avg_epu8(a, b), roundingBits);
+}
+
+// gl::float16ToFloat32 on the low 16 bits of every lane, for zeros and normal numbers.  Lanes
+// holding denormals, infinities or NaNs are set in |invalidOut|.
+inline __m128 HalfToFloat(__m128i h, __m128i *invalidOut)
+{
+    const __m128i zero      = _mm_setzero_si128();
+    const __m128i sign      = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+    const __m128i magnitude = _mm_and_si128(h, _mm_set1_epi32(0x7FFF));
+    const __m128i exponent  = _mm_and_si128(h, _mm_set1_epi32(0x7C00));
+    const __m128i isZero    = _mm_cmpeq_epi32(magnitude, zero);
+
+    const __m128i isSpecial = _mm_or_si128(_mm_cmpeq_epi32(exponent, zero),
+                                           _mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x7C00)));
+    *invalidOut = _mm_or_si128(*invalidOut, _mm_andnot_si128(isZero, isSpecial));
+
+    const __m128i bits =
+        _mm_add_epi32(_mm_slli_epi32(magnitude, 13), _mm_set1_epi32(0x38000000));
+    return _mm_castsi128_ps(_mm_or_si128(sign, _mm_andnot_si128(isZero, bits)));
+}
+
+// gl::float32ToFloat16 on every lane, for values that are zero or normal halves.  Other lanes are
+// set in |invalidOut|.
+inline __m128i FloatToHalf(__m128 f, __m128i *invalidOut)
+{
+    const __m128i bits      = _mm_castps_si128(f);
+    const __m128i sign      = _mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x80000000)), 16);
+    const __m128i magnitude = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+    const __m128i isZero    = _mm_cmpeq_epi32(magnitude, _mm_setzero_si128());
+
+    const __m128i isSpecial = _mm_or_si128(
+        _mm_andnot_si128(isZero, _mm_cmplt_epi32(magnitude, _mm_set1_epi32(0x38800000))),
+        _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x47FFEFFF)));
+    *invalidOut = _mm_or_si128(*invalidOut, isSpecial);
+
+    // Round to nearest even.
+    const __m128i roundingBits =
+        _mm_add_epi32(_mm_set1_epi32(0xC8000FFF),
+                      _mm_and_si128(_mm_srli_epi32(magnitude, 13), _mm_set1_epi32(1)));
+    const __m128i half = _mm_srli_epi32(_mm_add_epi32(magnitude, roundingBits), 13);
+    return _mm_or_si128(sign, _mm_andnot_si128(isZero, half));
+}
+
+// gl::averageHalfFloat on the eight halves of a and b.
+inline __m128i AverageHalf(__m128i a, __m128i b, __m128i *invalidOut)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 half  = _mm_set1_ps(0.5f);
+
+    const __m128 aLow  = HalfToFloat(_mm_unpacklo_epi16(a, zero), invalidOut);
+    const __m128 aHigh = HalfToFloat(_mm_unpackhi_epi16(a, zero), invalidOut);
+    const __m128 bLow  = HalfToFloat(_mm_unpacklo_epi16(b, zero), invalidOut);
+    const __m128 bHigh = HalfToFloat(_mm_unpackhi_epi16(b, zero), invalidOut);
+
+    __m128i low  = FloatToHalf(_mm_mul_ps(_mm_add_ps(aLow, bLow), half), invalidOut);
+    __m128i high = FloatToHalf(_mm_mul_ps(_mm_add_ps(aHigh, bHigh), half), invalidOut);
+
+    // Sign extend the halves, so they are packed without saturation.
+    low  = _mm_srai_epi32(_mm_slli_epi32(low, 16), 16);
+    high = _mm_srai_epi32(_mm_slli_epi32(high, 16), 16);
+    return _mm_packs_epi32(low, high);
+}
+#endif  // defined(ANGLE_GENERATEMIP_USE_SSE2)
+
+size_t GenerateMipRowRGBA8(const uint8_t *sourceRow0,
+                           const uint8_t *sourceRow1,
+                           uint8_t *destRow,
+                           size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_GENERATEMIP_USE_SSE2)
+    for (; x + 4 <= destWidth; x += 4)
+    {
+        const uint8_t *source0 = sourceRow0 + x * 8;
+        const uint8_t *source1 = sourceRow1 + x * 8;
+
+        // Average the rows, then the even and odd pixels of the result.
+        const __m128i vertical0 =
+            AverageU8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source0)),
+                      _mm_loadu_si128(reinterpret_cast<const __m128i *>(source1)));
+        const __m128i vertical1 =
+            AverageU8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source0 + 16)),
+                      _mm_loadu_si128(reinterpret_cast<const __m128i *>(source1 + 16)));
+        const __m128 even = _mm_shuffle_ps(_mm_castsi128_ps(vertical0),
+                                           _mm_castsi128_ps(vertical1), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 odd  = _mm_shuffle_ps(_mm_castsi128_ps(vertical0),
+                                           _mm_castsi128_ps(vertical1), _MM_SHUFFLE(3, 1, 3, 1));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destRow + x * 4),
+                         AverageU8(_mm_castps_si128(even), _mm_castps_si128(odd)));
+    }
+#elif defined(ANGLE_GENERATEMIP_USE_NEON)
+    for (; x + 4 <= destWidth; x += 4)
+    {
+        // vld2q_u32 separates the even and odd pixels, and vhaddq_u8 rounds down like gl::average.
+        const uint32x4x2_t source0 =
+            vld2q_u32(reinterpret_cast<const uint32_t *>(sourceRow0 + x * 8));
+        const uint32x4x2_t source1 =
+            vld2q_u32(reinterpret_cast<const uint32_t *>(sourceRow1 + x * 8));
+
+        const uint8x16_t even =
+            vhaddq_u8(vreinterpretq_u8_u32(source0.val[0]), vreinterpretq_u8_u32(source1.val[0]));
+        const uint8x16_t odd =
+            vhaddq_u8(vreinterpretq_u8_u32(source0.val[1]), vreinterpretq_u8_u32(source1.val[1]));
+
+        vst1q_u8(destRow + x * 4, vhaddq_u8(even, odd));
+    }
+#endif
+    return x;
+}
+
+// Returns the max number of threads to use when generating on the multithreaded pool.
+size_t MaxThreads()
+{
+    static const size_t numThreads =
+        std::max<size_t>(1, std::min(16u, std::thread::hardware_concurrency()));
+    return numThreads;
+}
+
+// Bands are as high as possible while the source of a band fits in this many bytes.
+constexpr size_t kMaxBandBytes  = 256 * 1024;
+constexpr size_t kMaxBandHeight = 256;
+
+// For smaller images the overhead of multithreading exceeds the benefits, so every task generates
+// mips from at least this many source pixels.
+constexpr size_t kMinSourcePixelsPerTask = 256 * 1024;
+
+struct MipChainBands
+{
+    MipGenerationFunction generateMip;
+    size_t sourceWidth;
+    size_t sourceHeight;
+    MipLevelDestination source;
+    const MipLevelDestination *destLevels;
+    size_t levelCount;
+    size_t bandHeight;
+};
+
+// Generates the banded levels of the bands in the range [begin, end).
+void GenerateBands(const MipChainBands &bands, size_t begin, size_t end)
+{
+    for (size_t band = begin; band < end; ++band)
+    {
+        const size_t bandY = band * bands.bandHeight;
+        for (size_t level = 1; level <= bands.levelCount; ++level)
+        {
+            // The rows of the level covered by the band.  Every level has exactly half the size of
+            // the previous one, so these rows only depend on rows of the source in the same band.
+            const size_t destY0 = bandY >> level;
+            const size_t destY1 =
+                std::min((bandY + bands.bandHeight) >> level, bands.sourceHeight >> level);
+            if (destY1 <= destY0)
+            {
+                break;
+            }
+
+            const MipLevelDestination &previous =
+                level == 1 ? bands.source : bands.destLevels[level - 2];
+            const MipLevelDestination &dest = bands.destLevels[level - 1];
+
+            bands.generateMip((bands.sourceWidth >> level) * 2, (destY1 - destY0) * 2, 1,
+                              previous.data + destY0 * 2 * previous.rowPitch, previous.rowPitch,
+                              previous.depthPitch, dest.data + destY0 * dest.rowPitch,
+                              dest.rowPitch, dest.depthPitch);
+        }
+    }
+}
+
+class GenerateBandsTask : public Closure
+{
+  public:
+    GenerateBandsTask(const MipChainBands &bands, size_t begin, size_t end)
+        : mBands(bands), mBegin(begin), mEnd(end)
+    {}
+
+    void operator()() override { GenerateBands(mBands, mBegin, mEnd); }
+
+  private:
+    const MipChainBands &mBands;
+    size_t mBegin;
+    size_t mEnd;
+};
+
+// Bands are independent, so if the context provides a multithreaded pool, they are split in
+// contiguous ranges that are generated in parallel, with the calling thread generating the first
+// range itself.
+void GenerateAllBands(const ImageLoadContext &context, const MipChainBands &bands)
+{
+    const size_t bandCount = (bands.sourceHeight + bands.bandHeight - 1) / bands.bandHeight;
+
+    size_t taskCount = 1;
+    if (context.multiThreadPool && context.multiThreadPool->isAsync())
+    {
+        taskCount = std::min({MaxThreads(), bandCount,
+                              bands.sourceWidth * bands.sourceHeight / kMinSourcePixelsPerTask});
+    }
+
+    if (taskCount <= 1)
+    {
+        GenerateBands(bands, 0, bandCount);
+        return;
+    }
+
+    const size_t bandsPerTask = (bandCount + taskCount - 1) / taskCount;
+
+    std::vector<std::shared_ptr<WaitableEvent>> waitEvents;
+    waitEvents.reserve(taskCount - 1);
+    for (size_t begin = bandsPerTask; begin < bandCount; begin += bandsPerTask)
+    {
+        const size_t end = std::min(begin + bandsPerTask, bandCount);
+        std::shared_ptr<WaitableEvent> waitEvent = context.multiThreadPool->postWorkerTask(
+            std::make_shared<GenerateBandsTask>(bands, begin, end));
+        if (waitEvent)
+        {
+            waitEvents.push_back(std::move(waitEvent));
+        }
+        else
+        {
+            GenerateBands(bands, begin, end);
+        }
+    }
+
+    GenerateBands(bands, 0, bandsPerTask);
+    WaitableEvent::WaitMany(&waitEvents);
+}
+}  // anonymous namespace
+
+namespace priv
+{
+template <>
+size_t GenerateMipRow_XY<R8G8B8A8>(const uint8_t *sourceRow0,
+                                   const uint8_t *sourceRow1,
+                                   uint8_t *destRow,
+                                   size_t destWidth)
+{
+    return GenerateMipRowRGBA8(sourceRow0, sourceRow1, destRow, destWidth);
+}
+
+template <>
+size_t GenerateMipRow_XY<B8G8R8A8>(const uint8_t *sourceRow0,
+                                   const uint8_t *sourceRow1,
+                                   uint8_t *destRow,
+                                   size_t destWidth)
+{
+    // Channels are averaged independently, so the order doesn't matter.
+    return GenerateMipRowRGBA8(sourceRow0, sourceRow1, destRow, destWidth);
+}
+
+template <>
+size_t GenerateMipRow_XY<R16G16B16A16F>(const uint8_t *sourceRow0,
+                                        const uint8_t *sourceRow1,
+                                        uint8_t *destRow,
+                                        size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_GENERATEMIP_USE_SSE2)
+    for (; x + 2 <= destWidth; x += 2)
+    {
+        const uint8_t *source0 = sourceRow0 + x * 16;
+        const uint8_t *source1 = sourceRow1 + x * 16;
+        __m128i invalid        = _mm_setzero_si128();
+
+        // Average the rows, then the even and odd pixels of the result.
+        const __m128i vertical0 =
+            AverageHalf(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source0)),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(source1)), &invalid);
+        const __m128i vertical1 =
+            AverageHalf(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source0 + 16)),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(source1 + 16)), &invalid);
+        const __m128i result = AverageHalf(_mm_unpacklo_epi64(vertical0, vertical1),
+                                           _mm_unpackhi_epi64(vertical0, vertical1), &invalid);
+
+        if (_mm_movemask_epi8(invalid) == 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destRow + x * 8), result);
+            continue;
+        }
+
+        // Denormals, infinities and NaNs are rare, so they are left to the scalar code.
+        for (size_t pixel = x; pixel < x + 2; ++pixel)
+        {
+            const R16G16B16A16F *src0 = GetPixel<R16G16B16A16F>(sourceRow0, pixel * 2, 0, 0, 0, 0);
+            const R16G16B16A16F *src1 = GetPixel<R16G16B16A16F>(sourceRow1, pixel * 2, 0, 0, 0, 0);
+            const R16G16B16A16F *src2 =
+                GetPixel<R16G16B16A16F>(sourceRow0, pixel * 2 + 1, 0, 0, 0, 0);
+            const R16G16B16A16F *src3 =
+                GetPixel<R16G16B16A16F>(sourceRow1, pixel * 2 + 1, 0, 0, 0, 0);
+            R16G16B16A16F *dst = GetPixel<R16G16B16A16F>(destRow, pixel, 0, 0, 0, 0);
+
+            R16G16B16A16F tmp0, tmp1;
+
+            R16G16B16A16F::average(&tmp0, src0, src1);
+            R16G16B16A16F::average(&tmp1, src2, src3);
+            R16G16B16A16F::average(dst, &tmp0, &tmp1);
+        }
+    }
+#endif
+    return x;
+}
+
+template <>
+size_t GenerateMipRow_XY<R32G32B32A32F>(const uint8_t *sourceRow0,
+                                        const uint8_t *sourceRow1,
+                                        uint8_t *destRow,
+                                        size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_GENERATEMIP_USE_SSE2)
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (; x < destWidth; ++x)
+    {
+        // Every pixel fills a register.
+        const float *source0 = reinterpret_cast<const float *>(sourceRow0 + x * 32);
+        const float *source1 = reinterpret_cast<const float *>(sourceRow1 + x * 32);
+
+        const __m128 even =
+            _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(source0), _mm_loadu_ps(source1)), half);
+        const __m128 odd =
+            _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(source0 + 4), _mm_loadu_ps(source1 + 4)), half);
+
+        _mm_storeu_ps(reinterpret_cast<float *>(destRow + x * 16),
+                      _mm_mul_ps(_mm_add_ps(even, odd), half));
+    }
+#elif defined(ANGLE_GENERATEMIP_USE_NEON)
+    for (; x < destWidth; ++x)
+    {
+        const float *source0 = reinterpret_cast<const float *>(sourceRow0 + x * 32);
+        const float *source1 = reinterpret_cast<const float *>(sourceRow1 + x * 32);
+
+        const float32x4_t even =
+            vmulq_n_f32(vaddq_f32(vld1q_f32(source0), vld1q_f32(source1)), 0.5f);
+        const float32x4_t odd =
+            vmulq_n_f32(vaddq_f32(vld1q_f32(source0 + 4), vld1q_f32(source1 + 4)), 0.5f);
+
+        vst1q_f32(reinterpret_cast<float *>(destRow + x * 16),
+                  vmulq_n_f32(vaddq_f32(even, odd), 0.5f));
+    }
+#endif
+    return x;
+}
+}  // namespace priv
+
+void GenerateMipChain(const ImageLoadContext &context,
+                      MipGenerationFunction generateMip,
+                      size_t pixelBytes,
+                      size_t sourceWidth,
+                      size_t sourceHeight,
+                      size_t sourceDepth,
+                      const uint8_t *sourceData,
+                      size_t sourceRowPitch,
+                      size_t sourceDepthPitch,
+                      const MipLevelDestination *destLevels,
+                      size_t levelCount)
+{
+    MipLevelDestination previous = {const_cast<uint8_t *>(sourceData), sourceRowPitch,
+                                    sourceDepthPitch};
+    size_t previousWidth         = sourceWidth;
+    size_t previousHeight        = sourceHeight;
+    size_t previousDepth         = sourceDepth;
+    size_t level                 = 0;
+
+    // Generate the levels that use the 2D box filter, i.e. while neither dimension is clamped to
+    // 1, in bands of rows.  This only pays off if there are at least two such levels.
+    if (sourceDepth == 1)
+    {
+        MipChainBands bands = {generateMip, sourceWidth, sourceHeight, previous,
+                               destLevels,  0,           kMaxBandHeight};
+        while (bands.bandHeight * sourceWidth * pixelBytes > kMaxBandBytes && bands.bandHeight > 4)
+        {
+            bands.bandHeight /= 2;
+        }
+        bands.levelCount = std::min<size_t>(
+            {levelCount, static_cast<size_t>(gl::log2(bands.bandHeight)),
+             static_cast<size_t>(gl::log2(std::min(sourceWidth, sourceHeight)))});
+
+        if (bands.levelCount >= 2)
+        {
+            GenerateAllBands(context, bands);
+
+            level          = bands.levelCount;
+            previous       = destLevels[level - 1];
+            previousWidth  = sourceWidth >> level;
+            previousHeight = sourceHeight >> level;
+        }
+    }
+
+    // Generate the rest of the levels whole.
+    for (; level < levelCount; ++level)
+    {
+        generateMip(previousWidth, previousHeight, previousDepth, previous.data,
+                    previous.rowPitch, previous.depthPitch, destLevels[level].data,
+                    destLevels[level].rowPitch, destLevels[level].depthPitch);
+
+        previous       = destLevels[level];
+        previousWidth  = std::max<size_t>(1, previousWidth >> 1);
+        previousHeight = std::max<size_t>(1, previousHeight >> 1);
+        previousDepth  = std::max<size_t>(1, previousDepth >> 1);
+    }
+}
+}  // namespace angle
@@ -15,6 +15,7 @@
 
 namespace angle
 {
+struct ImageLoadContext;
 
 template <typename T>
 inline void GenerateMip(size_t sourceWidth,
@@ -27,6 +28,42 @@ inline void GenerateMip(size_t sourceWidth,
                         size_t destRowPitch,
                         size_t destDepthPitch);
 
+using MipGenerationFunction = void (*)(size_t sourceWidth,
+                                       size_t sourceHeight,
+                                       size_t sourceDepth,
+                                       const uint8_t *sourceData,
+                                       size_t sourceRowPitch,
+                                       size_t sourceDepthPitch,
+                                       uint8_t *destData,
+                                       size_t destRowPitch,
+                                       size_t destDepthPitch);
+
+struct MipLevelDestination
+{
+    uint8_t *data;
+    size_t rowPitch;
+    size_t depthPitch;
+};
+
+// Generates |levelCount| mip levels, each from the previous one with |generateMip|, which is one
+// of the GenerateMip functions.  |destLevels[0]| receives the level following the source.
+//
+// For 2D images, the source is split in bands of rows that fit in the cache, and all the levels
+// that can be generated from a band are generated before moving on to the next band.  If the
+// context has a multithreaded pool, bands are generated in parallel.  The result is the same as
+// calling |generateMip| on every level.
+void GenerateMipChain(const ImageLoadContext &context,
+                      MipGenerationFunction generateMip,
+                      size_t pixelBytes,
+                      size_t sourceWidth,
+                      size_t sourceHeight,
+                      size_t sourceDepth,
+                      const uint8_t *sourceData,
+                      size_t sourceRowPitch,
+                      size_t sourceDepthPitch,
+                      const MipLevelDestination *destLevels,
+                      size_t levelCount);
+
 }  // namespace angle
 
 #include "generatemip.inc"
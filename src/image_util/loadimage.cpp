@@ -12,6 +12,7 @@
 
 #include "image_util/loadimage.h"
 
+#include "common/float16_utils.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
 #include "image_util/imageformats.h"
@@ -26,11 +27,24 @@
 #            define ANGLE_LOADIMAGE_USE_SSE
 #        endif
 #    endif
+#elif defined(__GNUC__) && defined(__x86_64__)
+// SSE2 is part of the x86-64 baseline, so no runtime check is necessary.
+#    include <emmintrin.h>
+#    define ANGLE_LOADIMAGE_USE_SSE
+#    define ANGLE_LOADIMAGE_SSE2_IS_BASELINE
+#endif
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_LOADIMAGE_USE_NEON
 #endif
 
 #if defined(ANGLE_LOADIMAGE_USE_SSE)
 inline bool supportsSSE2()
 {
+#    if defined(ANGLE_LOADIMAGE_SSE2_IS_BASELINE)
+    return true;
+#    else
     static bool checked  = false;
     static bool supports = false;
 
@@ -51,11 +65,232 @@ inline bool supportsSSE2()
 
     checked = true;
     return supports;
+#    endif
 }
 #endif
 
 namespace angle
 {
+namespace
+{
+// Rows of half-floats are converted to floats in chunks of this many pixels on the stack, before
+// they are packed into other formats.
+constexpr size_t kHalfFloatChunkPixels = 256;
+
+// The following helpers convert as many pixels at the start of a row as the available SIMD
+// instructions allow, and return the number of pixels converted.  The rest of the row is converted
+// by the scalar loop of the caller, which also produces the reference results for the tests.
+
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+// Each 32-bit lane holds a 16-bit LA8 pixel.
+inline __m128i ExpandLA8ToRGBA8(__m128i la)
+{
+    const __m128i l = _mm_and_si128(la, _mm_set1_epi32(0x000000FF));
+    const __m128i a = _mm_and_si128(la, _mm_set1_epi32(0x0000FF00));
+    const __m128i rg = _mm_or_si128(l, _mm_slli_epi32(l, 8));
+    return _mm_or_si128(_mm_or_si128(rg, _mm_slli_epi32(l, 16)), _mm_slli_epi32(a, 16));
+}
+
+// Each 32-bit lane holds a 16-bit R5G6B5 pixel.  If |swapRB|, the output is BGRA8.
+inline __m128i ExpandR5G6B5ToRGBA8(__m128i rgb, bool swapRB)
+{
+    const __m128i mask5 = _mm_set1_epi32(0x1F);
+    const __m128i r5    = _mm_and_si128(_mm_srli_epi32(rgb, 11), mask5);
+    const __m128i g6    = _mm_and_si128(_mm_srli_epi32(rgb, 5), _mm_set1_epi32(0x3F));
+    const __m128i b5    = _mm_and_si128(rgb, mask5);
+
+    const __m128i r8 = _mm_or_si128(_mm_slli_epi32(r5, 3), _mm_srli_epi32(r5, 2));
+    const __m128i g8 = _mm_or_si128(_mm_slli_epi32(g6, 2), _mm_srli_epi32(g6, 4));
+    const __m128i b8 = _mm_or_si128(_mm_slli_epi32(b5, 3), _mm_srli_epi32(b5, 2));
+
+    const __m128i first = swapRB ? b8 : r8;
+    const __m128i third = swapRB ? r8 : b8;
+    return _mm_or_si128(_mm_or_si128(first, _mm_slli_epi32(g8, 8)),
+                        _mm_or_si128(_mm_slli_epi32(third, 16), _mm_set1_epi32(0xFF000000)));
+}
+#endif
+
+#if defined(ANGLE_LOADIMAGE_USE_NEON)
+// Converts 8 R5G6B5 pixels to RGBA8, or BGRA8 if |swapRB|.
+inline uint8x8x4_t ExpandR5G6B5ToRGBA8(uint16x8_t rgb, bool swapRB)
+{
+    const uint16x8_t r5 = vshrq_n_u16(rgb, 11);
+    const uint16x8_t g6 = vandq_u16(vshrq_n_u16(rgb, 5), vdupq_n_u16(0x3F));
+    const uint16x8_t b5 = vandq_u16(rgb, vdupq_n_u16(0x1F));
+
+    const uint8x8_t r8 = vmovn_u16(vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2)));
+    const uint8x8_t g8 = vmovn_u16(vorrq_u16(vshlq_n_u16(g6, 2), vshrq_n_u16(g6, 4)));
+    const uint8x8_t b8 = vmovn_u16(vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2)));
+
+    uint8x8x4_t rgba;
+    rgba.val[0] = swapRB ? b8 : r8;
+    rgba.val[1] = g8;
+    rgba.val[2] = swapRB ? r8 : b8;
+    rgba.val[3] = vdup_n_u8(0xFF);
+    return rgba;
+}
+#endif
+
+size_t LoadLA8ToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (supportsSSE2())
+    {
+        const __m128i zero = _mm_setzero_si128();
+        for (; x + 7 < width; x += 8)
+        {
+            __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[2 * x]));
+            __m128i lo = ExpandLA8ToRGBA8(_mm_unpacklo_epi16(la, zero));
+            __m128i hi = ExpandLA8ToRGBA8(_mm_unpackhi_epi16(la, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x]), lo);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 16]), hi);
+        }
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    for (; x + 15 < width; x += 16)
+    {
+        uint8x16x2_t la = vld2q_u8(&source[2 * x]);
+        uint8x16x4_t rgba;
+        rgba.val[0] = la.val[0];
+        rgba.val[1] = la.val[0];
+        rgba.val[2] = la.val[0];
+        rgba.val[3] = la.val[1];
+        vst4q_u8(&dest[4 * x], rgba);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGB8ToBGRX8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_NEON)
+    for (; x + 15 < width; x += 16)
+    {
+        uint8x16x3_t rgb = vld3q_u8(&source[3 * x]);
+        uint8x16x4_t bgrx;
+        bgrx.val[0] = rgb.val[2];
+        bgrx.val[1] = rgb.val[1];
+        bgrx.val[2] = rgb.val[0];
+        bgrx.val[3] = vdupq_n_u8(0xFF);
+        vst4q_u8(&dest[4 * x], bgrx);
+    }
+#elif defined(_MSC_VER) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    // Without a byte shuffle instruction (SSSE3 is not part of the x86 baseline), four pixels are
+    // converted at a time using 32-bit operations.  Three 32-bit input values contain 4 RGB
+    // pixels: RGBR GBRG BRGB -> BGRX BGRX BGRX BGRX.  This relies on little-endian loads;
+    // big-endian targets fall back to the scalar loop of the caller.
+    for (; x + 3 < width; x += 4)
+    {
+        uint32_t rgb[3];
+        memcpy(rgb, &source[3 * x], sizeof(rgb));
+
+        uint32_t pixels[4] = {
+            rgb[0] & 0x00FFFFFF,
+            (rgb[0] >> 24) | ((rgb[1] & 0x0000FFFF) << 8),
+            (rgb[1] >> 16) | ((rgb[2] & 0x000000FF) << 16),
+            rgb[2] >> 8,
+        };
+        for (uint32_t &pixel : pixels)
+        {
+            pixel = (pixel & 0x0000FF00) | ((pixel & 0x000000FF) << 16) |
+                    ((pixel & 0x00FF0000) >> 16) | 0xFF000000;
+        }
+        memcpy(&dest[4 * x], pixels, sizeof(pixels));
+    }
+#endif
+    return x;
+}
+
+size_t LoadR5G6B5ToRGBA8Row(const uint16_t *source, uint8_t *dest, size_t width, bool swapRB)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (supportsSSE2())
+    {
+        const __m128i zero = _mm_setzero_si128();
+        for (; x + 7 < width; x += 8)
+        {
+            __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+            __m128i lo  = ExpandR5G6B5ToRGBA8(_mm_unpacklo_epi16(rgb, zero), swapRB);
+            __m128i hi  = ExpandR5G6B5ToRGBA8(_mm_unpackhi_epi16(rgb, zero), swapRB);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x]), lo);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 16]), hi);
+        }
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    for (; x + 7 < width; x += 8)
+    {
+        vst4_u8(&dest[4 * x], ExpandR5G6B5ToRGBA8(vld1q_u16(&source[x]), swapRB));
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGBA8ToBGRA8Row(const uint32_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_NEON)
+    for (; x + 15 < width; x += 16)
+    {
+        uint8x16x4_t rgba = vld4q_u8(reinterpret_cast<const uint8_t *>(&source[x]));
+        uint8x16_t r      = rgba.val[0];
+        rgba.val[0]       = rgba.val[2];
+        rgba.val[2]       = r;
+        vst4q_u8(reinterpret_cast<uint8_t *>(&dest[x]), rgba);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGB10A2ToRGBA8Row(const uint32_t *source, uint8_t *dest, size_t width)
+{
+    // With 32-bit lanes, each channel is extracted with a shift and a mask.  The 2-bit alpha is
+    // expanded to 8 bits by replicating it, which is the same as multiplying it by 0x55.
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (supportsSSE2())
+    {
+        const __m128i rMask = _mm_set1_epi32(0x000000FF);
+        const __m128i gMask = _mm_set1_epi32(0x0000FF00);
+        const __m128i bMask = _mm_set1_epi32(0x00FF0000);
+        const __m128i aMask = _mm_set1_epi32(static_cast<int>(0xC0000000));
+        for (; x + 3 < width; x += 4)
+        {
+            __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+            __m128i r    = _mm_and_si128(_mm_srli_epi32(rgba, 2), rMask);
+            __m128i g    = _mm_and_si128(_mm_srli_epi32(rgba, 4), gMask);
+            __m128i b    = _mm_and_si128(_mm_srli_epi32(rgba, 6), bMask);
+            __m128i a    = _mm_and_si128(rgba, aMask);
+            a            = _mm_or_si128(a, _mm_srli_epi32(a, 2));
+            a            = _mm_or_si128(a, _mm_srli_epi32(a, 4));
+            __m128i result = _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x]), result);
+        }
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    const uint32x4_t rMask = vdupq_n_u32(0x000000FF);
+    const uint32x4_t gMask = vdupq_n_u32(0x0000FF00);
+    const uint32x4_t bMask = vdupq_n_u32(0x00FF0000);
+    const uint32x4_t aMask = vdupq_n_u32(0xC0000000);
+    for (; x + 3 < width; x += 4)
+    {
+        uint32x4_t rgba = vld1q_u32(&source[x]);
+        uint32x4_t r    = vandq_u32(vshrq_n_u32(rgba, 2), rMask);
+        uint32x4_t g    = vandq_u32(vshrq_n_u32(rgba, 4), gMask);
+        uint32x4_t b    = vandq_u32(vshrq_n_u32(rgba, 6), bMask);
+        uint32x4_t a    = vandq_u32(rgba, aMask);
+        a               = vorrq_u32(a, vshrq_n_u32(a, 2));
+        a               = vorrq_u32(a, vshrq_n_u32(a, 4));
+        vst1q_u8(&dest[4 * x],
+                 vreinterpretq_u8_u32(vorrq_u32(vorrq_u32(r, g), vorrq_u32(b, a))));
+    }
+#endif
+    return x;
+}
+}  // anonymous namespace
+
 ImageLoadContext::ImageLoadContext()                                         = default;
 ImageLoadContext::~ImageLoadContext()                                        = default;
 ImageLoadContext::ImageLoadContext(const ImageLoadContext &other)            = default;
@@ -368,7 +603,7 @@ void LoadLA8ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadLA8ToRGBA8Row(source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[2 * x + 0];
                 dest[4 * x + 1] = source[2 * x + 0];
@@ -571,7 +806,7 @@ void LoadRGB8ToBGRX8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGB8ToBGRX8Row(source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[x * 3 + 2];
                 dest[4 * x + 1] = source[x * 3 + 1];
@@ -661,7 +896,7 @@ void LoadR5G6B5ToBGRA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadR5G6B5ToRGBA8Row(source, dest, width, true); x < width; x++)
             {
                 uint16_t rgb = source[x];
                 dest[4 * x + 0] =
@@ -695,7 +930,7 @@ void LoadR5G6B5ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadR5G6B5ToRGBA8Row(source, dest, width, false); x < width; x++)
             {
                 uint16_t rgb = source[x];
                 dest[4 * x + 0] =
@@ -781,7 +1016,7 @@ void LoadRGBA8ToBGRA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGBA8ToBGRA8Row(source, dest, width); x < width; x++)
             {
                 uint32_t rgba = source[x];
                 dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
@@ -1365,7 +1600,7 @@ void LoadRGB10A2ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGB10A2ToRGBA8Row(source, dest, width); x < width; x++)
             {
                 uint32_t rgba   = source[x];
                 dest[4 * x + 0] = static_cast<uint8_t>((rgba & 0x000003FF) >> 2);
@@ -1486,11 +1721,17 @@ void LoadRGB16FToRGB9E5(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = 0; x < width; x += kHalfFloatChunkPixels)
             {
-                dest[x] = gl::convertRGBFloatsTo999E5(gl::float16ToFloat32(source[x * 3 + 0]),
-                                                      gl::float16ToFloat32(source[x * 3 + 1]),
-                                                      gl::float16ToFloat32(source[x * 3 + 2]));
+                const size_t chunkWidth = std::min(kHalfFloatChunkPixels, width - x);
+                float rgb[kHalfFloatChunkPixels * 3];
+                gl::float16ToFloat32Array(source + x * 3, rgb, chunkWidth * 3);
+
+                for (size_t pixel = 0; pixel < chunkWidth; pixel++)
+                {
+                    dest[x + pixel] = gl::convertRGBFloatsTo999E5(
+                        rgb[pixel * 3 + 0], rgb[pixel * 3 + 1], rgb[pixel * 3 + 2]);
+                }
             }
         }
     }
@@ -1543,11 +1784,18 @@ void LoadRGB16FToRG11B10F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = 0; x < width; x += kHalfFloatChunkPixels)
             {
-                dest[x] = (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 0])) << 0) |
-                          (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 1])) << 11) |
-                          (gl::float32ToFloat10(gl::float16ToFloat32(source[x * 3 + 2])) << 22);
+                const size_t chunkWidth = std::min(kHalfFloatChunkPixels, width - x);
+                float rgb[kHalfFloatChunkPixels * 3];
+                gl::float16ToFloat32Array(source + x * 3, rgb, chunkWidth * 3);
+
+                for (size_t pixel = 0; pixel < chunkWidth; pixel++)
+                {
+                    dest[x + pixel] = (gl::float32ToFloat11(rgb[pixel * 3 + 0]) << 0) |
+                                      (gl::float32ToFloat11(rgb[pixel * 3 + 1]) << 11) |
+                                      (gl::float32ToFloat10(rgb[pixel * 3 + 2]) << 22);
+                }
             }
         }
     }
@@ -1913,13 +2161,8 @@ void LoadRGB32FToRGBA16F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x * 4 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
-                dest[x * 4 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
-                dest[x * 4 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
-                dest[x * 4 + 3] = gl::Float16One;
-            }
+            gl::float32ToFloat16Elements(reinterpret_cast<const uint8_t *>(source),
+                                         3 * sizeof(float), 3, dest, 4, width);
         }
     }
 }
@@ -1943,12 +2186,7 @@ void LoadRGB32FToRGB16F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x * 3 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
-                dest[x * 3 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
-                dest[x * 3 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
-            }
+            gl::float32ToFloat16Array(source, dest, width * 3);
         }
     }
 }
@@ -12,7 +12,12 @@
 
 #include "image_util/loadimage.h"
 
+#include <algorithm>
+#include <functional>
+#include <thread>
 #include <type_traits>
+
+#include "common/WorkerThread.h"
 #include "common/mathutil.h"
 
 #include "image_util/imageformats.h"
@@ -1378,8 +1383,10 @@ struct ETC2Block
     {
         static const size_t kNumColors = kNumPixelsInBlock;
 
+        // The whole block is decoded even if it is partially outside the image, so that the
+        // endpoints are never selected from uninitialized colors.
         R8G8B8A8 rgbaBlock[kNumColors];
-        decodePlanarBlock(reinterpret_cast<uint8_t *>(rgbaBlock), x, y, w, h, sizeof(R8G8B8A8) * 4,
+        decodePlanarBlock(reinterpret_cast<uint8_t *>(rgbaBlock), 0, 0, 4, 4, sizeof(R8G8B8A8) * 4,
                           alphaValues);
 
         // Planar block doesn't have a color table, fill indices as full
@@ -1474,6 +1481,107 @@ static const uint8_t DefaultETCAlphaValues[4][4] =
 };
 
 // clang-format on
+
+// Returns the max number of threads to use when decoding on the multithreaded pool.
+size_t MaxThreads()
+{
+    static const size_t numThreads =
+        std::max<size_t>(1, std::min(16u, std::thread::hardware_concurrency()));
+    return numThreads;
+}
+
+// For smaller images the overhead of multithreading exceeds the benefits, so every task decodes
+// at least this many blocks.
+constexpr size_t kMinBlocksPerTask = 1024;
+
+using DecodeBlockRowFunction = std::function<void(size_t z, size_t y)>;
+
+// Decodes rows of blocks in the range [begin, end) over all the slices of the image.
+void DecodeBlockRows(const DecodeBlockRowFunction &decodeBlockRow,
+                     size_t blockRowsPerSlice,
+                     size_t begin,
+                     size_t end)
+{
+    for (size_t blockRow = begin; blockRow < end; ++blockRow)
+    {
+        decodeBlockRow(blockRow / blockRowsPerSlice, (blockRow % blockRowsPerSlice) * 4);
+    }
+}
+
+class DecodeBlockRowsTask : public Closure
+{
+  public:
+    DecodeBlockRowsTask(const DecodeBlockRowFunction &decodeBlockRow,
+                        size_t blockRowsPerSlice,
+                        size_t begin,
+                        size_t end)
+        : mDecodeBlockRow(decodeBlockRow),
+          mBlockRowsPerSlice(blockRowsPerSlice),
+          mBegin(begin),
+          mEnd(end)
+    {}
+
+    void operator()() override
+    {
+        DecodeBlockRows(mDecodeBlockRow, mBlockRowsPerSlice, mBegin, mEnd);
+    }
+
+  private:
+    const DecodeBlockRowFunction &mDecodeBlockRow;
+    size_t mBlockRowsPerSlice;
+    size_t mBegin;
+    size_t mEnd;
+};
+
+// Calls |decodeBlockRow| for every row of blocks of the image, where y is the first pixel row of
+// the blocks.  Rows of blocks are independent, so if the context provides a multithreaded pool,
+// they are split in contiguous ranges that are decoded in parallel, with the calling thread
+// decoding the first range itself.
+void ForEachBlockRow(const ImageLoadContext &context,
+                     size_t width,
+                     size_t height,
+                     size_t depth,
+                     const DecodeBlockRowFunction &decodeBlockRow)
+{
+    const size_t blockRowsPerSlice = (height + 3) / 4;
+    const size_t blockRowCount     = blockRowsPerSlice * depth;
+    const size_t blockCount        = blockRowCount * ((width + 3) / 4);
+
+    size_t taskCount = 1;
+    if (context.multiThreadPool && context.multiThreadPool->isAsync())
+    {
+        taskCount = std::min({MaxThreads(), blockRowCount, blockCount / kMinBlocksPerTask});
+    }
+
+    if (taskCount <= 1)
+    {
+        DecodeBlockRows(decodeBlockRow, blockRowsPerSlice, 0, blockRowCount);
+        return;
+    }
+
+    const size_t blockRowsPerTask = (blockRowCount + taskCount - 1) / taskCount;
+
+    std::vector<std::shared_ptr<WaitableEvent>> waitEvents;
+    waitEvents.reserve(taskCount - 1);
+    for (size_t begin = blockRowsPerTask; begin < blockRowCount; begin += blockRowsPerTask)
+    {
+        const size_t end = std::min(begin + blockRowsPerTask, blockRowCount);
+        std::shared_ptr<WaitableEvent> waitEvent = context.multiThreadPool->postWorkerTask(
+            std::make_shared<DecodeBlockRowsTask>(decodeBlockRow, blockRowsPerSlice, begin, end));
+        if (waitEvent)
+        {
+            waitEvents.push_back(std::move(waitEvent));
+        }
+        else
+        {
+            DecodeBlockRows(decodeBlockRow, blockRowsPerSlice, begin, end);
+        }
+    }
+
+    DecodeBlockRows(decodeBlockRow, blockRowsPerSlice, 0, blockRowsPerTask);
+    WaitableEvent::WaitMany(&waitEvents);
+}
+
 void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t width,
                     size_t height,
@@ -1486,25 +1594,21 @@ void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t outputDepthPitch,
                     bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t z, size_t y) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint8_t *destPixels          = destRow + x;
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint8_t *destPixels          = destRow + x;
 
-                sourceBlock->decodeAsSingleETC2Channel(destPixels, x, y, width, height, 1,
-                                                       outputRowPitch, isSigned);
-            }
+            sourceBlock->decodeAsSingleETC2Channel(destPixels, x, y, width, height, 1,
+                                                   outputRowPitch, isSigned);
         }
-    }
+    });
 }
 
 void LoadRG11EACToRG8(const ImageLoadContext &context,
@@ -1519,29 +1623,25 @@ void LoadRG11EACToRG8(const ImageLoadContext &context,
                       size_t outputDepthPitch,
                       bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t z, size_t y) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                uint8_t *destPixelsRed          = destRow + (x * 2);
-                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
-                sourceBlockRed->decodeAsSingleETC2Channel(destPixelsRed, x, y, width, height, 2,
-                                                          outputRowPitch, isSigned);
-
-                uint8_t *destPixelsGreen          = destPixelsRed + 1;
-                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
-                sourceBlockGreen->decodeAsSingleETC2Channel(destPixelsGreen, x, y, width, height, 2,
-                                                            outputRowPitch, isSigned);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            uint8_t *destPixelsRed          = destRow + (x * 2);
+            const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+            sourceBlockRed->decodeAsSingleETC2Channel(destPixelsRed, x, y, width, height, 2,
+                                                      outputRowPitch, isSigned);
+
+            uint8_t *destPixelsGreen          = destPixelsRed + 1;
+            const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+            sourceBlockGreen->decodeAsSingleETC2Channel(destPixelsGreen, x, y, width, height, 2,
+                                                        outputRowPitch, isSigned);
         }
-    }
+    });
 }
 
 void LoadR11EACToR16(const ImageLoadContext &context,
@@ -1557,25 +1657,21 @@ void LoadR11EACToR16(const ImageLoadContext &context,
                      bool isSigned,
                      bool isFloat)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint16_t *destRow =
-                priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t z, size_t y) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint16_t *destRow =
+            priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint16_t *destPixels         = destRow + x;
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint16_t *destPixels         = destRow + x;
 
-                sourceBlock->decodeAsSingleEACChannel(destPixels, x, y, width, height, 1,
-                                                      outputRowPitch, isSigned, isFloat);
-            }
+            sourceBlock->decodeAsSingleEACChannel(destPixels, x, y, width, height, 1,
+                                                  outputRowPitch, isSigned, isFloat);
         }
-    }
+    });
 }
 
 void LoadRG11EACToRG16(const ImageLoadContext &context,
@@ -1591,29 +1687,25 @@ void LoadRG11EACToRG16(const ImageLoadContext &context,
                        bool isSigned,
                        bool isFloat)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint16_t *destRow =
-                priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t z, size_t y) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint16_t *destRow =
+            priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                uint16_t *destPixelsRed         = destRow + (x * 2);
-                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
-                sourceBlockRed->decodeAsSingleEACChannel(destPixelsRed, x, y, width, height, 2,
-                                                         outputRowPitch, isSigned, isFloat);
-
-                uint16_t *destPixelsGreen         = destPixelsRed + 1;
-                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
-                sourceBlockGreen->decodeAsSingleEACChannel(destPixelsGreen, x, y, width, height, 2,
-                                                           outputRowPitch, isSigned, isFloat);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            uint16_t *destPixelsRed         = destRow + (x * 2);
+            const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+            sourceBlockRed->decodeAsSingleEACChannel(destPixelsRed, x, y, width, height, 2,
+                                                     outputRowPitch, isSigned, isFloat);
+
+            uint16_t *destPixelsGreen         = destPixelsRed + 1;
+            const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+            sourceBlockGreen->decodeAsSingleEACChannel(destPixelsGreen, x, y, width, height, 2,
+                                                       outputRowPitch, isSigned, isFloat);
         }
-    }
+    });
 }
 
 void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
@@ -1628,25 +1720,21 @@ void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                          size_t outputDepthPitch,
                          bool punchthroughAlpha)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t z, size_t y) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint8_t *destPixels          = destRow + (x * 4);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint8_t *destPixels          = destRow + (x * 4);
 
-                sourceBlock->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
-                                         DefaultETCAlphaValues, punchthroughAlpha);
-            }
+            sourceBlock->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
+                                     DefaultETCAlphaValues, punchthroughAlpha);
         }
-    }
+    });
 }
 
 void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
@@ -1661,25 +1749,21 @@ void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
                        size_t outputDepthPitch,
                        bool punchthroughAlpha)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t z, size_t y) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint8_t *destPixels          = destRow + (x * 2);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint8_t *destPixels          = destRow + (x * 2);
 
-                sourceBlock->transcodeAsBC1(destPixels, x, y, width, height, DefaultETCAlphaValues,
-                                            punchthroughAlpha);
-            }
+            sourceBlock->transcodeAsBC1(destPixels, x, y, width, height, DefaultETCAlphaValues,
+                                        punchthroughAlpha);
         }
-    }
+    });
 }
 
 void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
@@ -1695,30 +1779,26 @@ void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
                         bool punchthroughAlpha,
                         bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t z, size_t y) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceAlphaBlock = sourceRow + (x / 4) * 2;
-                uint8_t *destAlphaPixels          = destRow + (x * 4);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceAlphaBlock = sourceRow + (x / 4) * 2;
+            uint8_t *destAlphaPixels          = destRow + (x * 4);
 
-                const ETC2Block *sourceRgbBlock = sourceAlphaBlock + 1;
-                uint8_t *destRgbPixels          = destAlphaPixels + 8;
+            const ETC2Block *sourceRgbBlock = sourceAlphaBlock + 1;
+            uint8_t *destRgbPixels          = destAlphaPixels + 8;
 
-                sourceRgbBlock->transcodeAsBC1(destRgbPixels, x, y, width, height,
-                                               DefaultETCAlphaValues, punchthroughAlpha);
+            sourceRgbBlock->transcodeAsBC1(destRgbPixels, x, y, width, height,
+                                           DefaultETCAlphaValues, punchthroughAlpha);
 
-                sourceAlphaBlock->transcodeAsBC4(destAlphaPixels, x, y, width, height, isSigned);
-            }
+            sourceAlphaBlock->transcodeAsBC4(destAlphaPixels, x, y, width, height, isSigned);
         }
-    }
+    });
 }
 
 void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
@@ -1733,31 +1813,25 @@ void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
                           size_t outputDepthPitch,
                           bool srgb)
 {
-    uint8_t decodedAlphaValues[4][4];
-
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
+    ForEachBlockRow(context, width, height, depth, [&](size_t z, size_t y) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+
+        uint8_t decodedAlphaValues[4][4];
+        for (size_t x = 0; x < width; x += 4)
         {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
-                sourceBlockAlpha->decodeAsSingleETC2Channel(
-                    reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4,
-                    false);
-
-                uint8_t *destPixels             = destRow + (x * 4);
-                const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
-                sourceBlockRGB->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
-                                            decodedAlphaValues, false);
-            }
+            const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
+            sourceBlockAlpha->decodeAsSingleETC2Channel(
+                reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4, false);
+
+            uint8_t *destPixels             = destRow + (x * 4);
+            const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
+            sourceBlockRGB->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
+                                        decodedAlphaValues, false);
         }
-    }
+    });
 }
 
 }  // anonymous namespace
@@ -2164,23 +2238,19 @@ void LoadEACR11ToBC4(const ImageLoadContext &context,
                      size_t outputDepthPitch,
                      bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t z, size_t y) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceR11Block = sourceRow + (x / 4);
-                uint8_t *destR11Pixels          = destRow + (x * 2);
-                sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceR11Block = sourceRow + (x / 4);
+            uint8_t *destR11Pixels          = destRow + (x * 2);
+            sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
         }
-    }
+    });
 }
 
 void LoadEACRG11ToBC5(const ImageLoadContext &context,
@@ -2195,27 +2265,23 @@ void LoadEACRG11ToBC5(const ImageLoadContext &context,
                       size_t outputDepthPitch,
                       bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t z, size_t y) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceR11Block = sourceRow + (x / 2);
-                uint8_t *destR11Pixels          = destRow + (x * 4);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceR11Block = sourceRow + (x / 2);
+            uint8_t *destR11Pixels          = destRow + (x * 4);
 
-                const ETC2Block *sourceG11Block = sourceR11Block + 1;
-                uint8_t *destG11Pixels          = destR11Pixels + 8;
-                sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
-                sourceG11Block->transcodeAsBC4(destG11Pixels, x, y, width, height, isSigned);
-            }
+            const ETC2Block *sourceG11Block = sourceR11Block + 1;
+            uint8_t *destG11Pixels          = destR11Pixels + 8;
+            sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
+            sourceG11Block->transcodeAsBC4(destG11Pixels, x, y, width, height, isSigned);
         }
-    }
+    });
 }
 
 void LoadEACR11ToBC4(const ImageLoadContext &context,
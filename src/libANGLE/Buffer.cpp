@@ -11,6 +11,7 @@
 #include "libANGLE/Buffer.h"
 
 #include "libANGLE/Context.h"
+#include "libANGLE/EntryPointProfiler.h"
 #include "libANGLE/renderer/BufferImpl.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 
@@ -183,8 +184,12 @@ angle::Result Buffer::setDataWithUsageFlags(const gl::Context *context,
                                             gl::BufferStorage bufferStorage)
 {
     rx::BufferFeedback feedback;
-    angle::Result result = mImpl->setDataWithUsageFlags(context, target, clientBuffer, data, size,
-                                                        usage, flags, bufferStorage, &feedback);
+    angle::Result result;
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        result = mImpl->setDataWithUsageFlags(context, target, clientBuffer, data, size, usage,
+                                              flags, bufferStorage, &feedback);
+    }
 
     applyImplFeedback(context, feedback);
 
@@ -300,8 +305,11 @@ angle::Result Buffer::bufferSubData(const Context *context,
                                     GLintptr offset)
 {
     rx::BufferFeedback feedback;
-    ANGLE_TRY_WITH_FINALLY(mImpl->setSubData(context, target, data, size, offset, &feedback),
-                           applyImplFeedback(context, feedback));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY_WITH_FINALLY(mImpl->setSubData(context, target, data, size, offset, &feedback),
+                               applyImplFeedback(context, feedback));
+    }
 
     mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
                                      static_cast<unsigned int>(size));
@@ -319,9 +327,12 @@ angle::Result Buffer::copyBufferSubData(const Context *context,
                                         GLsizeiptr size)
 {
     rx::BufferFeedback feedback;
-    ANGLE_TRY_WITH_FINALLY(mImpl->copySubData(context, source->getImplementation(), sourceOffset,
-                                              destOffset, size, &feedback),
-                           applyImplFeedback(context, feedback));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY_WITH_FINALLY(mImpl->copySubData(context, source->getImplementation(),
+                                                  sourceOffset, destOffset, size, &feedback),
+                               applyImplFeedback(context, feedback));
+    }
 
     mIndexRangeCache.invalidateRange(static_cast<unsigned int>(destOffset),
                                      static_cast<unsigned int>(size));
@@ -338,8 +349,11 @@ angle::Result Buffer::map(const Context *context, GLenum access)
 
     rx::BufferFeedback feedback;
     mState.mMapPointer = nullptr;
-    ANGLE_TRY_WITH_FINALLY(mImpl->map(context, access, &mState.mMapPointer, &feedback),
-                           applyImplFeedback(context, feedback));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY_WITH_FINALLY(mImpl->map(context, access, &mState.mMapPointer, &feedback),
+                               applyImplFeedback(context, feedback));
+    }
 
     ASSERT(access == GL_WRITE_ONLY_OES);
 
@@ -366,9 +380,12 @@ angle::Result Buffer::mapRange(const Context *context,
 
     rx::BufferFeedback feedback;
     mState.mMapPointer = nullptr;
-    ANGLE_TRY_WITH_FINALLY(
-        mImpl->mapRange(context, offset, length, access, &mState.mMapPointer, &feedback),
-        applyImplFeedback(context, feedback));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY_WITH_FINALLY(
+            mImpl->mapRange(context, offset, length, access, &mState.mMapPointer, &feedback),
+            applyImplFeedback(context, feedback));
+    }
 
     mState.mMapped      = GL_TRUE;
     mState.mMapOffset   = static_cast<GLint64>(offset);
@@ -399,8 +416,11 @@ angle::Result Buffer::unmap(const Context *context, GLboolean *result)
 
     rx::BufferFeedback feedback;
     *result = GL_FALSE;
-    ANGLE_TRY_WITH_FINALLY(mImpl->unmap(context, result, &feedback),
-                           applyImplFeedback(context, feedback));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY_WITH_FINALLY(mImpl->unmap(context, result, &feedback),
+                               applyImplFeedback(context, feedback));
+    }
 
     mState.mMapped      = GL_FALSE;
     mState.mMapPointer  = nullptr;
@@ -14,6 +14,7 @@
 #include "libANGLE/State.h"
 #include "libANGLE/renderer/CompilerImpl.h"
 #include "libANGLE/renderer/GLImplFactory.h"
+#include "libANGLE/trace.h"
 
 namespace gl
 {
@@ -36,6 +37,42 @@ ShShaderOutput GetShaderOutputType(const State &state, const rx::CompilerImpl *i
 
 }  // anonymous namespace
 
+class Compiler::WarmupTask final : public angle::Closure
+{
+  public:
+    WarmupTask(ShaderType shaderType,
+               ShShaderSpec spec,
+               ShShaderOutput outputType,
+               const ShBuiltInResources &resources)
+        : mShaderType(shaderType),
+          mSpec(spec),
+          mOutputType(outputType),
+          mResources(resources),
+          mHandle(nullptr)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "Compiler::WarmupTask");
+        mHandle = sh::ConstructCompiler(ToGLenum(mShaderType), mSpec, mOutputType, &mResources);
+    }
+
+    // Only valid once the task's event is signaled.
+    ShCompilerInstance takeInstance()
+    {
+        ShCompilerInstance instance(mHandle, mOutputType, mShaderType);
+        mHandle = nullptr;
+        return instance;
+    }
+
+  private:
+    ShaderType mShaderType;
+    ShShaderSpec mSpec;
+    ShShaderOutput mOutputType;
+    ShBuiltInResources mResources;
+    ShHandle mHandle;
+};
+
 Compiler::Compiler(rx::GLImplFactory *implFactory, const State &state, egl::Display *display)
     : mImplementation(implFactory->createCompiler()),
       mSpec(SelectShaderSpec(state)),
@@ -300,12 +337,29 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const State &state, egl::Disp
 
     // Subpixel bits.
     mResources.SubPixelBits = static_cast<int>(caps.subPixelBits);
+
+    // Initializing the built-ins of a translator instance is expensive.  If the display can run
+    // tasks asynchronously, get instances for the most common shader types ready in the
+    // background, so the first compilation of each does not have to wait for it.  Passthrough
+    // shaders never use the translator.
+    std::shared_ptr<angle::WorkerThreadPool> workerPool = display->getMultiThreadPool();
+    if (mOutputType != SH_NULL_OUTPUT && workerPool && workerPool->isAsync())
+    {
+        mWarmupThreadPool = std::move(workerPool);
+        scheduleWarmup(ShaderType::Vertex);
+        scheduleWarmup(ShaderType::Fragment);
+    }
 }
 
 Compiler::~Compiler() = default;
 
 void Compiler::onDestroy(const Context *context)
 {
+    for (ShaderType shaderType : AllShaderTypes())
+    {
+        collectWarmup(shaderType, true);
+    }
+
     std::lock_guard<angle::SimpleMutex> lock(context->getDisplay()->getDisplayGlobalMutex());
     for (auto &pool : mPools)
     {
@@ -325,18 +379,62 @@ ShCompilerInstance Compiler::getInstance(ShaderType type)
 {
     ASSERT(type != ShaderType::InvalidEnum);
     auto &pool = mPools[type];
+
+    // If there is no free instance, wait for the one being warmed up instead of building another.
+    collectWarmup(type, pool.empty());
+
+    ShCompilerInstance instance;
     if (pool.empty())
     {
         ShHandle handle = sh::ConstructCompiler(ToGLenum(type), mSpec, mOutputType, &mResources);
         ASSERT(handle);
-        return ShCompilerInstance(handle, mOutputType, type);
+        instance = ShCompilerInstance(handle, mOutputType, type);
     }
     else
     {
-        ShCompilerInstance instance = std::move(pool.back());
+        instance = std::move(pool.back());
         pool.pop_back();
-        return instance;
     }
+
+    // Refill the pool in the background, so that another compilation of this shader type while
+    // the instance is checked out doesn't have to build its own.
+    if (pool.empty())
+    {
+        scheduleWarmup(type);
+    }
+
+    return instance;
+}
+
+void Compiler::scheduleWarmup(ShaderType shaderType)
+{
+    if (!mWarmupThreadPool || mWarmupEvents[shaderType])
+    {
+        return;
+    }
+
+    mWarmupTasks[shaderType] =
+        std::make_shared<WarmupTask>(shaderType, mSpec, mOutputType, mResources);
+    mWarmupEvents[shaderType] = mWarmupThreadPool->postWorkerTask(mWarmupTasks[shaderType]);
+}
+
+void Compiler::collectWarmup(ShaderType shaderType, bool wait)
+{
+    std::shared_ptr<angle::WaitableEvent> &event = mWarmupEvents[shaderType];
+    if (!event || (!wait && !event->isReady()))
+    {
+        return;
+    }
+
+    event->wait();
+    ShCompilerInstance instance = mWarmupTasks[shaderType]->takeInstance();
+    if (instance.getHandle() != nullptr)
+    {
+        mPools[shaderType].push_back(std::move(instance));
+    }
+
+    event.reset();
+    mWarmupTasks[shaderType].reset();
 }
 
 void Compiler::putInstance(ShCompilerInstance &&instance)
@@ -10,10 +10,12 @@
 #ifndef LIBANGLE_COMPILER_H_
 #define LIBANGLE_COMPILER_H_
 
+#include <memory>
 #include <vector>
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/PackedEnums.h"
+#include "common/WorkerThread.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/RefCountObject.h"
 
@@ -43,12 +45,26 @@ class Compiler final : public RefCountObjectNoID
     static ShShaderSpec SelectShaderSpec(const State &state);
 
   private:
+    class WarmupTask;
+
     ~Compiler() override;
+
+    // Builds a translator instance for the given shader type on a worker thread, so that the next
+    // getInstance() call for that type does not have to initialize the built-ins inline.
+    void scheduleWarmup(ShaderType shaderType);
+    // Moves the instance built by a pending warmup into the pool.  If |wait| is false, this is
+    // only done if the warmup has already finished.
+    void collectWarmup(ShaderType shaderType, bool wait);
+
     std::unique_ptr<rx::CompilerImpl> mImplementation;
     ShShaderSpec mSpec;
     ShShaderOutput mOutputType;
     ShBuiltInResources mResources;
     ShaderMap<std::vector<ShCompilerInstance>> mPools;
+
+    std::shared_ptr<angle::WorkerThreadPool> mWarmupThreadPool;
+    ShaderMap<std::shared_ptr<WarmupTask>> mWarmupTasks;
+    ShaderMap<std::shared_ptr<angle::WaitableEvent>> mWarmupEvents;
 };
 
 class ShCompilerInstance final : public angle::NonCopyable
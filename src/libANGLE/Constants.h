@@ -19,6 +19,13 @@ namespace gl
 // The binary cache is currently left disable by default, and the application can enable it.
 const size_t kDefaultMaxProgramCacheMemoryBytes = 0;
 
+// Textures transcoded on the CPU are cached separately, so they can't evict programs.  The cache
+// is only used if the cacheTranscodedTextures frontend feature is enabled.
+const size_t kDefaultMaxTranscodeCacheMemoryBytes = 16 * 1024 * 1024;
+
+// The amount of transcoded textures stored in the application's blob cache per run.
+const size_t kDefaultMaxTranscodeCachePersistentBytes = 32 * 1024 * 1024;
+
 enum
 {
     // Implementation upper limits, real maximums depend on the hardware
@@ -780,6 +780,12 @@ egl::Error Context::initialize()
 void Context::initializeDefaultResources()
 {
     mImplementation->setMemoryProgramCache(mMemoryProgramCache);
+    // Every cache miss pays for hashing the source data and copying the transcoded data, so the
+    // backends only enable the cache where textures are transcoded on the CPU.
+    if (mDisplay->getFrontendFeatures().cacheTranscodedTextures.enabled)
+    {
+        mImplementation->setMemoryTranscodeCache(mDisplay->getMemoryTranscodeCache());
+    }
 
     initCaps();
 
@@ -1077,6 +1083,15 @@ egl::Error Context::makeCurrent(egl::Display *display,
         ContextPrivateScissor(getMutablePrivateState(), getMutablePrivateStateCache(), 0, 0, width,
                               height);
 
+        // Creating the compiler starts building translator instances on the worker pool.  Do it
+        // now instead of on the first glCompileShader, so that the built-ins are ready by the time
+        // the application compiles its first shaders.
+        std::shared_ptr<angle::WorkerThreadPool> workerPool = display->getMultiThreadPool();
+        if (workerPool && workerPool->isAsync())
+        {
+            getCompiler();
+        }
+
         mHasBeenCurrent = true;
     }
 
@@ -2908,6 +2923,7 @@ void Context::drawArraysInstanced(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(
         mImplementation->drawArraysInstanced(this, mode, first, count, instanceCount));
     MarkTransformFeedbackBufferUsage(this, count, instanceCount);
@@ -2928,6 +2944,7 @@ void Context::drawElementsInstanced(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(
         mImplementation->drawElementsInstanced(this, mode, count, type, indices, instances));
     MarkShaderStorageUsage(this);
@@ -2947,6 +2964,7 @@ void Context::drawElementsBaseVertex(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(
         mImplementation->drawElementsBaseVertex(this, mode, count, type, indices, basevertex));
     MarkShaderStorageUsage(this);
@@ -2967,6 +2985,7 @@ void Context::drawElementsInstancedBaseVertex(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->drawElementsInstancedBaseVertex(
         this, mode, count, type, indices, instancecount, basevertex));
     MarkShaderStorageUsage(this);
@@ -2987,6 +3006,7 @@ void Context::drawRangeElements(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(
         mImplementation->drawRangeElements(this, mode, start, end, count, type, indices));
     MarkShaderStorageUsage(this);
@@ -3008,6 +3028,7 @@ void Context::drawRangeElementsBaseVertex(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->drawRangeElementsBaseVertex(this, mode, start, end, count,
                                                                    type, indices, basevertex));
     MarkShaderStorageUsage(this);
@@ -3022,6 +3043,7 @@ void Context::drawArraysIndirect(PrimitiveMode mode, const void *indirect)
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->drawArraysIndirect(this, mode, indirect));
     MarkShaderStorageUsage(this);
 }
@@ -3035,17 +3057,20 @@ void Context::drawElementsIndirect(PrimitiveMode mode, DrawElementsType type, co
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->drawElementsIndirect(this, mode, type, indirect));
     MarkShaderStorageUsage(this);
 }
 
 void Context::flush()
 {
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->flush(this));
 }
 
 void Context::finish()
 {
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->finish(this));
 }
 
@@ -6695,6 +6720,7 @@ void Context::dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGr
 
     ANGLE_CONTEXT_TRY(prepareForDispatch());
 
+    ANGLE_PROFILE_PHASE(Backend);
     angle::Result result =
         mImplementation->dispatchCompute(this, numGroupsX, numGroupsY, numGroupsZ);
 
@@ -6711,6 +6737,7 @@ void Context::dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGr
 void Context::dispatchComputeIndirect(GLintptr indirect)
 {
     ANGLE_CONTEXT_TRY(prepareForDispatch());
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->dispatchComputeIndirect(this, indirect));
 
     MarkShaderStorageUsage(this);
@@ -6741,11 +6768,13 @@ void Context::texStorage3D(TextureType target,
 
 void Context::memoryBarrier(GLbitfield barriers)
 {
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->memoryBarrier(this, barriers));
 }
 
 void Context::memoryBarrierByRegion(GLbitfield barriers)
 {
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->memoryBarrierByRegion(this, barriers));
 }
 
@@ -6761,6 +6790,7 @@ void Context::multiDrawArrays(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->multiDrawArrays(this, mode, firsts, counts, drawcount));
 }
 
@@ -6777,6 +6807,7 @@ void Context::multiDrawArraysInstanced(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->multiDrawArraysInstanced(this, mode, firsts, counts,
                                                                 instanceCounts, drawcount));
 }
@@ -6793,6 +6824,7 @@ void Context::multiDrawArraysIndirect(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(
         mImplementation->multiDrawArraysIndirect(this, mode, indirect, drawcount, stride));
     MarkShaderStorageUsage(this);
@@ -6811,6 +6843,7 @@ void Context::multiDrawElements(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(
         mImplementation->multiDrawElements(this, mode, counts, type, indices, drawcount));
 }
@@ -6829,6 +6862,7 @@ void Context::multiDrawElementsInstanced(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->multiDrawElementsInstanced(this, mode, counts, type, indices,
                                                                   instanceCounts, drawcount));
 }
@@ -6846,6 +6880,7 @@ void Context::multiDrawElementsIndirect(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(
         mImplementation->multiDrawElementsIndirect(this, mode, type, indirect, drawcount, stride));
     MarkShaderStorageUsage(this);
@@ -6877,6 +6912,7 @@ void Context::drawArraysInstancedBaseInstance(PrimitiveMode mode,
     // The input gl_InstanceID does not follow the baseinstance. gl_InstanceID always falls on
     // the half-open range [0, instancecount). No need to set other stuff. Except for Vulkan.
 
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->drawArraysInstancedBaseInstance(
         this, mode, first, count, instanceCount, baseInstance));
     MarkTransformFeedbackBufferUsage(this, count, 1);
@@ -6934,6 +6970,7 @@ void Context::drawElementsInstancedBaseVertexBaseInstance(PrimitiveMode mode,
 
     rx::ResetBaseVertexBaseInstance resetUniforms(executable, hasBaseVertex, hasBaseInstance);
 
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->drawElementsInstancedBaseVertexBaseInstance(
         this, mode, count, type, indices, instanceCount, baseVertex, baseInstance));
 }
@@ -6964,6 +7001,7 @@ void Context::multiDrawArraysInstancedBaseInstance(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->multiDrawArraysInstancedBaseInstance(
         this, mode, firsts, counts, instanceCounts, baseInstances, drawcount));
 }
@@ -6994,6 +7032,7 @@ void Context::multiDrawElementsInstancedBaseVertexBaseInstance(PrimitiveMode mod
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->multiDrawElementsInstancedBaseVertexBaseInstance(
         this, mode, counts, type, indices, instanceCounts, baseVertices, baseInstances, drawcount));
 }
@@ -9455,6 +9494,8 @@ void Context::onPreSwap()
 {
     // Dump frame capture if enabled.
     getShareGroup()->getFrameCaptureShared()->onEndFrame(this);
+
+    mImplementation->onPreSwap();
 }
 
 void Context::getTexImage(TextureTarget target,
@@ -9578,7 +9619,7 @@ void Context::getPerfMonitorCounterData(GLuint monitor,
                                         GLint *bytesWritten)
 {
     using namespace angle;
-    const PerfMonitorCounterGroups &perfMonitorGroups = mImplementation->getPerfMonitorCounters();
+    const PerfMonitorCounterGroups &perfMonitorGroups = getPerfMonitorCounterGroups();
     GLint byteCount                                   = 0;
     switch (pname)
     {
@@ -9635,7 +9676,7 @@ void Context::getPerfMonitorCounterData(GLuint monitor,
 void Context::getPerfMonitorCounterInfo(GLuint group, GLuint counter, GLenum pname, void *data)
 {
     using namespace angle;
-    const PerfMonitorCounterGroups &perfMonitorGroups = mImplementation->getPerfMonitorCounters();
+    const PerfMonitorCounterGroups &perfMonitorGroups = getPerfMonitorCounterGroups();
     ASSERT(group < perfMonitorGroups.size());
     const PerfMonitorCounters &counters = perfMonitorGroups[group].counters;
     ASSERT(counter < counters.size());
@@ -9667,7 +9708,7 @@ void Context::getPerfMonitorCounterString(GLuint group,
                                           GLchar *counterString)
 {
     using namespace angle;
-    const PerfMonitorCounterGroups &perfMonitorGroups = mImplementation->getPerfMonitorCounters();
+    const PerfMonitorCounterGroups &perfMonitorGroups = getPerfMonitorCounterGroups();
     ASSERT(group < perfMonitorGroups.size());
     const PerfMonitorCounters &counters = perfMonitorGroups[group].counters;
     ASSERT(counter < counters.size());
@@ -9681,7 +9722,7 @@ void Context::getPerfMonitorCounters(GLuint group,
                                      GLuint *counters)
 {
     using namespace angle;
-    const PerfMonitorCounterGroups &perfMonitorGroups = mImplementation->getPerfMonitorCounters();
+    const PerfMonitorCounterGroups &perfMonitorGroups = getPerfMonitorCounterGroups();
     ASSERT(group < perfMonitorGroups.size());
     const PerfMonitorCounters &groupCounters = perfMonitorGroups[group].counters;
 
@@ -9711,7 +9752,7 @@ void Context::getPerfMonitorGroupString(GLuint group,
                                         GLchar *groupString)
 {
     using namespace angle;
-    const PerfMonitorCounterGroups &perfMonitorGroups = mImplementation->getPerfMonitorCounters();
+    const PerfMonitorCounterGroups &perfMonitorGroups = getPerfMonitorCounterGroups();
     ASSERT(group < perfMonitorGroups.size());
     GetPerfMonitorString(perfMonitorGroups[group].name, bufSize, length, groupString);
 }
@@ -9719,7 +9760,7 @@ void Context::getPerfMonitorGroupString(GLuint group,
 void Context::getPerfMonitorGroups(GLint *numGroups, GLsizei groupsSize, GLuint *groups)
 {
     using namespace angle;
-    const PerfMonitorCounterGroups &perfMonitorGroups = mImplementation->getPerfMonitorCounters();
+    const PerfMonitorCounterGroups &perfMonitorGroups = getPerfMonitorCounterGroups();
 
     if (numGroups)
     {
@@ -9743,7 +9784,16 @@ void Context::selectPerfMonitorCounters(GLuint monitor,
 
 const angle::PerfMonitorCounterGroups &Context::getPerfMonitorCounterGroups() const
 {
+#if defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+    // The entry point profile is added after the backend's groups so their indices don't change.
+    const angle::PerfMonitorCounterGroups &implGroups = mImplementation->getPerfMonitorCounters();
+    mPerfMonitorCounterGroups.resize(implGroups.size() + 1);
+    std::copy(implGroups.begin(), implGroups.end(), mPerfMonitorCounterGroups.begin());
+    angle::UpdateEntryPointProfileCounterGroup(&mPerfMonitorCounterGroups.back());
+    return mPerfMonitorCounterGroups;
+#else
     return mImplementation->getPerfMonitorCounters();
+#endif
 }
 
 void Context::framebufferFoveationConfig(FramebufferID framebufferPacked,
@@ -1141,6 +1141,11 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     // Cache representation of the serialized context string.
     mutable std::string mCachedSerializedStateString;
 
+#if defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+    // The backend's perf monitor counter groups, followed by the entry point profile.
+    mutable angle::PerfMonitorCounterGroups mPerfMonitorCounterGroups;
+#endif
+
     mutable size_t mRefCount;
 
     OverlayType mOverlay;
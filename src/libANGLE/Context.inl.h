@@ -12,6 +12,7 @@
 #define LIBANGLE_CONTEXT_INL_H_
 
 #include "libANGLE/Context.h"
+#include "libANGLE/EntryPointProfiler.h"
 #include "libANGLE/GLES1Renderer.h"
 #include "libANGLE/renderer/ContextImpl.h"
 
@@ -129,6 +130,7 @@ ANGLE_INLINE angle::Result Context::syncDirtyBits(const state::DirtyBits bitMask
     const state::DirtyBits dirtyBits = (mState.getDirtyBits() & bitMask);
     const state::ExtendedDirtyBits extendedDirtyBits =
         (mState.getExtendedDirtyBits() & extendedBitMask);
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_TRY(mImplementation->syncState(this, dirtyBits, bitMask, extendedDirtyBits,
                                          extendedBitMask, command));
     mState.clearDirtyBits(dirtyBits);
@@ -165,6 +167,7 @@ ANGLE_INLINE void Context::drawArrays(PrimitiveMode mode, GLint first, GLsizei c
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->drawArrays(this, mode, first, count));
     MarkTransformFeedbackBufferUsage(this, count, 1);
 }
@@ -182,6 +185,7 @@ ANGLE_INLINE void Context::drawElements(PrimitiveMode mode,
     }
 
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
+    ANGLE_PROFILE_PHASE(Backend);
     ANGLE_CONTEXT_TRY(mImplementation->drawElements(this, mode, count, type, indices));
 }
 
@@ -254,6 +254,25 @@ static DevicePlatformDisplayMap *GetDevicePlatformDisplayMap()
     return displays.get();
 }
 
+// The blob cache callbacks last set by the application, on any display.
+struct ApplicationBlobCacheFuncs
+{
+    EGLSetBlobFuncANDROID set = nullptr;
+    EGLGetBlobFuncANDROID get = nullptr;
+};
+
+static angle::SimpleMutex *ApplicationBlobCacheFuncsMutex()
+{
+    static angle::base::NoDestructor<angle::SimpleMutex> applicationBlobCacheFuncsMutex;
+    return applicationBlobCacheFuncsMutex.get();
+}
+
+static ApplicationBlobCacheFuncs *GetLastApplicationBlobCacheFuncs()
+{
+    static angle::base::NoDestructor<ApplicationBlobCacheFuncs> funcs;
+    return funcs.get();
+}
+
 rx::DisplayImpl *CreateDisplayFromDevice(Device *eglDevice, const DisplayState &state)
 {
     rx::DisplayImpl *impl = nullptr;
@@ -953,6 +972,9 @@ Display::Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDe
       mBlobCache(gl::kDefaultMaxProgramCacheMemoryBytes),
       mMemoryProgramCache(mBlobCache),
       mMemoryShaderCache(mBlobCache),
+      mMemoryTranscodeCache(mBlobCache,
+                            gl::kDefaultMaxTranscodeCacheMemoryBytes,
+                            gl::kDefaultMaxTranscodeCachePersistentBytes),
       mGlobalTextureShareGroupUsers(0),
       mGlobalSemaphoreShareGroupUsers(0),
       mTerminatedByApi(false)
@@ -1331,6 +1353,7 @@ Error Display::terminate(Thread *thread, TerminateReason terminateReason)
 
     mMemoryProgramCache.clear();
     mMemoryShaderCache.clear();
+    mMemoryTranscodeCache.clear();
     mBlobCache.setBlobCacheFuncs(nullptr, nullptr);
 
     mState.singleThreadPool.reset();
@@ -2041,6 +2064,19 @@ void Display::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID
 {
     mBlobCache.setBlobCacheFuncs(set, get);
     mImplementation->setBlobCacheFuncs(set, get);
+
+    std::lock_guard<angle::SimpleMutex> lock(*ApplicationBlobCacheFuncsMutex());
+    GetLastApplicationBlobCacheFuncs()->set = set;
+    GetLastApplicationBlobCacheFuncs()->get = get;
+}
+
+// static
+void Display::GetApplicationBlobCacheFuncs(EGLSetBlobFuncANDROID *setOut,
+                                           EGLGetBlobFuncANDROID *getOut)
+{
+    std::lock_guard<angle::SimpleMutex> lock(*ApplicationBlobCacheFuncsMutex());
+    *setOut = GetLastApplicationBlobCacheFuncs()->set;
+    *getOut = GetLastApplicationBlobCacheFuncs()->get;
 }
 
 // static
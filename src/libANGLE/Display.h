@@ -27,6 +27,7 @@
 #include "libANGLE/LoggingAnnotator.h"
 #include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/MemoryShaderCache.h"
+#include "libANGLE/MemoryTranscodeCache.h"
 #include "libANGLE/Observer.h"
 #include "libANGLE/ShareGroup.h"
 #include "libANGLE/Version.h"
@@ -232,6 +233,9 @@ class Display final : public LabeledObject,
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
     bool areBlobCacheFuncsSet() const { return mBlobCache.areBlobCacheFuncsSet(); }
     BlobCache &getBlobCache() { return mBlobCache; }
+    // The callbacks last set on any display, for the caches of APIs without a display, like CL.
+    static void GetApplicationBlobCacheFuncs(EGLSetBlobFuncANDROID *setOut,
+                                             EGLGetBlobFuncANDROID *getOut);
 
     static EGLClientBuffer GetNativeClientBuffer(const struct AHardwareBuffer *buffer);
     static Error CreateNativeClientBuffer(const egl::AttributeMap &attribMap,
@@ -303,6 +307,7 @@ class Display final : public LabeledObject,
     void unlockVulkanQueue();
 
     gl::MemoryShaderCache *getMemoryShaderCache() { return &mMemoryShaderCache; }
+    gl::MemoryTranscodeCache *getMemoryTranscodeCache() { return &mMemoryTranscodeCache; }
 
     // Installs LoggingAnnotator as the global DebugAnnotator, for back-ends that do not implement
     // their own DebugAnnotator.
@@ -431,6 +436,7 @@ class Display final : public LabeledObject,
     BlobCache mBlobCache;
     gl::MemoryProgramCache mMemoryProgramCache;
     gl::MemoryShaderCache mMemoryShaderCache;
+    gl::MemoryTranscodeCache mMemoryTranscodeCache;
     size_t mGlobalTextureShareGroupUsers;
     size_t mGlobalSemaphoreShareGroupUsers;
 
@@ -0,0 +1,248 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EntryPointProfiler.cpp:
+//   Per-thread CPU time counters for the GLES entry points.
+//
+
+#include "libANGLE/EntryPointProfiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include "common/base/anglebase/no_destructor.h"
+#include "common/debug.h"
+
+namespace angle
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// The counters are only written by their thread, and are atomic so they can be read while the
+// thread is running.
+struct ThreadEntryPointProfile
+{
+    std::atomic<uint64_t> callCount{0};
+    std::array<std::atomic<uint64_t>, kEntryPointPhaseCount> phaseTimeNs = {};
+};
+
+void AddToCounter(std::atomic<uint64_t> *counter, uint64_t value)
+{
+    counter->store(counter->load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+class ThreadProfile;
+
+struct ProfileRegistry
+{
+    std::mutex mutex;
+    std::vector<ThreadProfile *> threadProfiles;
+    // Counters of the threads that have exited.
+    std::vector<EntryPointProfile> retiredProfiles =
+        std::vector<EntryPointProfile>(kEntryPointCount);
+};
+
+ProfileRegistry *GetProfileRegistry()
+{
+    static angle::base::NoDestructor<ProfileRegistry> registry;
+    return registry.get();
+}
+
+class ThreadProfile final : angle::NonCopyable
+{
+  public:
+    ThreadProfile() : mProfiles(kEntryPointCount)
+    {
+        ProfileRegistry *registry = GetProfileRegistry();
+        std::lock_guard<std::mutex> lock(registry->mutex);
+        registry->threadProfiles.push_back(this);
+    }
+
+    ~ThreadProfile()
+    {
+        ProfileRegistry *registry = GetProfileRegistry();
+        std::lock_guard<std::mutex> lock(registry->mutex);
+        accumulate(&registry->retiredProfiles);
+        registry->threadProfiles.erase(std::find(registry->threadProfiles.begin(),
+                                                 registry->threadProfiles.end(), this));
+    }
+
+    void beginCall(EntryPoint entryPoint)
+    {
+        if (mDepth++ > 0)
+        {
+            return;
+        }
+        mEntryPoint = entryPoint;
+        mPhase      = EntryPointPhase::Frontend;
+        mPhaseStart = Clock::now();
+    }
+
+    void endCall()
+    {
+        ASSERT(mDepth > 0);
+        if (--mDepth > 0)
+        {
+            return;
+        }
+        endPhase();
+        AddToCounter(&mProfiles[static_cast<size_t>(mEntryPoint)].callCount, 1);
+    }
+
+    bool isInCall() const { return mDepth > 0; }
+
+    // Returns the phase that was active before.
+    EntryPointPhase setPhase(EntryPointPhase phase)
+    {
+        ASSERT(isInCall());
+        endPhase();
+        EntryPointPhase previousPhase = mPhase;
+        mPhase                        = phase;
+        return previousPhase;
+    }
+
+    // Called with the registry mutex held.
+    void accumulate(std::vector<EntryPointProfile> *profilesOut) const
+    {
+        for (size_t entryPoint = 0; entryPoint < kEntryPointCount; ++entryPoint)
+        {
+            const ThreadEntryPointProfile &profile = mProfiles[entryPoint];
+            EntryPointProfile &profileOut          = (*profilesOut)[entryPoint];
+            profileOut.callCount += profile.callCount.load(std::memory_order_relaxed);
+            for (size_t phase = 0; phase < kEntryPointPhaseCount; ++phase)
+            {
+                profileOut.phaseTimeNs[phase] +=
+                    profile.phaseTimeNs[phase].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+  private:
+    // Adds the time since the current phase started to its counter.
+    void endPhase()
+    {
+        Clock::time_point now = Clock::now();
+        uint64_t elapsedNs    = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - mPhaseStart).count());
+        AddToCounter(&mProfiles[static_cast<size_t>(mEntryPoint)]
+                          .phaseTimeNs[static_cast<size_t>(mPhase)],
+                     elapsedNs);
+        mPhaseStart = now;
+    }
+
+    std::vector<ThreadEntryPointProfile> mProfiles;
+    uint32_t mDepth             = 0;
+    EntryPoint mEntryPoint      = EntryPoint::Invalid;
+    EntryPointPhase mPhase      = EntryPointPhase::Frontend;
+    Clock::time_point mPhaseStart;
+};
+
+ThreadProfile &GetThreadProfile()
+{
+    thread_local ThreadProfile threadProfile;
+    return threadProfile;
+}
+
+constexpr const char *kEntryPointPhaseCounterSuffixes[kEntryPointPhaseCount] = {
+    ".frontend_ns",
+    ".validation_ns",
+    ".backend_ns",
+};
+}  // anonymous namespace
+
+EntryPointProfileCall::EntryPointProfileCall(EntryPoint entryPoint)
+{
+    GetThreadProfile().beginCall(entryPoint);
+}
+
+EntryPointProfileCall::~EntryPointProfileCall()
+{
+    GetThreadProfile().endCall();
+}
+
+EntryPointProfilePhase::EntryPointProfilePhase(EntryPointPhase phase)
+    : mActive(GetThreadProfile().isInCall()), mPreviousPhase(phase)
+{
+    if (mActive)
+    {
+        mPreviousPhase = GetThreadProfile().setPhase(phase);
+    }
+}
+
+EntryPointProfilePhase::~EntryPointProfilePhase()
+{
+    if (mActive)
+    {
+        GetThreadProfile().setPhase(mPreviousPhase);
+    }
+}
+
+std::vector<EntryPointProfile> GetEntryPointProfiles()
+{
+    ProfileRegistry *registry = GetProfileRegistry();
+    std::lock_guard<std::mutex> lock(registry->mutex);
+
+    std::vector<EntryPointProfile> profiles = registry->retiredProfiles;
+    for (const ThreadProfile *threadProfile : registry->threadProfiles)
+    {
+        threadProfile->accumulate(&profiles);
+    }
+    return profiles;
+}
+
+void UpdateEntryPointProfileCounterGroup(PerfMonitorCounterGroup *groupOut)
+{
+    // Only the GL entry points are reported, in the order of the EntryPoint enum.
+    auto isReported = [](size_t entryPoint) {
+        const char *name = GetEntryPointName(static_cast<EntryPoint>(entryPoint));
+        return name[0] == 'g' && name[1] == 'l';
+    };
+
+    if (groupOut->counters.empty())
+    {
+        groupOut->name = kEntryPointProfileCounterGroupName;
+        for (size_t entryPoint = 0; entryPoint < kEntryPointCount; ++entryPoint)
+        {
+            if (!isReported(entryPoint))
+            {
+                continue;
+            }
+            std::string name = GetEntryPointName(static_cast<EntryPoint>(entryPoint));
+
+            PerfMonitorCounter callCounter;
+            callCounter.name  = name + ".calls";
+            callCounter.value = 0;
+            groupOut->counters.push_back(callCounter);
+            for (const char *suffix : kEntryPointPhaseCounterSuffixes)
+            {
+                PerfMonitorCounter phaseCounter;
+                phaseCounter.name  = name + suffix;
+                phaseCounter.value = 0;
+                groupOut->counters.push_back(phaseCounter);
+            }
+        }
+    }
+
+    std::vector<EntryPointProfile> profiles = GetEntryPointProfiles();
+    size_t counterIndex                     = 0;
+    for (size_t entryPoint = 0; entryPoint < kEntryPointCount; ++entryPoint)
+    {
+        if (!isReported(entryPoint))
+        {
+            continue;
+        }
+        const EntryPointProfile &profile = profiles[entryPoint];
+        ASSERT(counterIndex + 1 + kEntryPointPhaseCount <= groupOut->counters.size());
+        groupOut->counters[counterIndex++].value = profile.callCount;
+        for (uint64_t phaseTimeNs : profile.phaseTimeNs)
+        {
+            groupOut->counters[counterIndex++].value = phaseTimeNs;
+        }
+    }
+}
+}  // namespace angle
@@ -0,0 +1,86 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EntryPointProfiler.h:
+//   Per-thread CPU time counters for the GLES entry points, built with
+//   angle_enable_entry_point_profiling.  The time spent in each entry point is split into
+//   validation, frontend and backend time.  The counters are reported through the
+//   GL_AMD_performance_monitor extension.
+//
+
+#ifndef LIBANGLE_ENTRY_POINT_PROFILER_H_
+#define LIBANGLE_ENTRY_POINT_PROFILER_H_
+
+#include <array>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "common/entry_points_enum_autogen.h"
+
+namespace angle
+{
+enum class EntryPointPhase : uint8_t
+{
+    // Everything not covered by the other phases, e.g. state tracking.
+    Frontend,
+    // Validation of the entry point's parameters.
+    Validation,
+    // Calls into the backend implementation.
+    Backend,
+
+    EnumCount,
+};
+
+constexpr size_t kEntryPointPhaseCount = static_cast<size_t>(EntryPointPhase::EnumCount);
+
+// Name of the GL_AMD_performance_monitor group holding the entry point counters.
+constexpr char kEntryPointProfileCounterGroupName[] = "EntryPointProfile";
+
+struct EntryPointProfile
+{
+    uint64_t callCount = 0;
+    std::array<uint64_t, kEntryPointPhaseCount> phaseTimeNs = {};
+};
+
+// Times an entry point.  Entry points called while another one is being timed are attributed to
+// the outer entry point.
+class [[nodiscard]] EntryPointProfileCall final : angle::NonCopyable
+{
+  public:
+    EntryPointProfileCall(EntryPoint entryPoint);
+    ~EntryPointProfileCall();
+};
+
+// Attributes the time spent in its scope to |phase|.  Does nothing outside of a timed entry point.
+class [[nodiscard]] EntryPointProfilePhase final : angle::NonCopyable
+{
+  public:
+    EntryPointProfilePhase(EntryPointPhase phase);
+    ~EntryPointProfilePhase();
+
+  private:
+    bool mActive;
+    EntryPointPhase mPreviousPhase;
+};
+
+// Returns the counters of all threads, indexed by EntryPoint.
+std::vector<EntryPointProfile> GetEntryPointProfiles();
+
+// Sets |groupOut| to the call count and phase times of each GL entry point.  The counters are only
+// created if |groupOut| is empty, and their values are updated otherwise.
+void UpdateEntryPointProfileCounterGroup(PerfMonitorCounterGroup *groupOut);
+}  // namespace angle
+
+#if defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+#    define ANGLE_PROFILE_ENTRY_POINT(EP) \
+        angle::EntryPointProfileCall entryPointProfileCall(angle::EntryPoint::EP)
+#    define ANGLE_PROFILE_PHASE(PHASE) \
+        angle::EntryPointProfilePhase entryPointProfilePhase(angle::EntryPointPhase::PHASE)
+#else
+#    define ANGLE_PROFILE_ENTRY_POINT(EP) (void(0))
+#    define ANGLE_PROFILE_PHASE(PHASE) (void(0))
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_PROFILING)
+
+#endif  // LIBANGLE_ENTRY_POINT_PROFILER_H_
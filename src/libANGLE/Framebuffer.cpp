@@ -19,6 +19,7 @@
 #include "libANGLE/Config.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/EntryPointProfiler.h"
 #include "libANGLE/ErrorStrings.h"
 #include "libANGLE/FramebufferAttachment.h"
 #include "libANGLE/PixelLocalStorage.h"
@@ -1641,6 +1642,7 @@ angle::Result Framebuffer::discard(const Context *context, size_t count, const G
     // can be no-ops, so we should probably do that to ensure consistency.
     // TODO(jmadill): WebGL behaviour, and robust resource init behaviour without WebGL.
 
+    ANGLE_PROFILE_PHASE(Backend);
     return mImpl->discard(context, count, attachments);
 }
 
@@ -1652,6 +1654,7 @@ angle::Result Framebuffer::invalidate(const Context *context,
     // can be no-ops, so we should probably do that to ensure consistency.
     // TODO(jmadill): WebGL behaviour, and robust resource init behaviour without WebGL.
 
+    ANGLE_PROFILE_PHASE(Backend);
     return mImpl->invalidate(context, count, attachments);
 }
 
@@ -1716,6 +1719,7 @@ angle::Result Framebuffer::invalidateSub(const Context *context,
     // can be no-ops, so we should probably do that to ensure consistency.
     // TODO(jmadill): Make a invalidate no-op in WebGL 2.0.
 
+    ANGLE_PROFILE_PHASE(Backend);
     return mImpl->invalidateSub(context, count, attachments, area);
 }
 
@@ -1723,6 +1727,7 @@ angle::Result Framebuffer::clear(const Context *context, GLbitfield mask)
 {
     ASSERT(mask && !context->getState().isRasterizerDiscardEnabled());
 
+    ANGLE_PROFILE_PHASE(Backend);
     return mImpl->clear(context, mask);
 }
 
@@ -1731,6 +1736,7 @@ angle::Result Framebuffer::clearBufferfv(const Context *context,
                                          GLint drawbuffer,
                                          const GLfloat *values)
 {
+    ANGLE_PROFILE_PHASE(Backend);
     return mImpl->clearBufferfv(context, buffer, drawbuffer, values);
 }
 
@@ -1739,6 +1745,7 @@ angle::Result Framebuffer::clearBufferuiv(const Context *context,
                                           GLint drawbuffer,
                                           const GLuint *values)
 {
+    ANGLE_PROFILE_PHASE(Backend);
     return mImpl->clearBufferuiv(context, buffer, drawbuffer, values);
 }
 
@@ -1747,6 +1754,7 @@ angle::Result Framebuffer::clearBufferiv(const Context *context,
                                          GLint drawbuffer,
                                          const GLint *values)
 {
+    ANGLE_PROFILE_PHASE(Backend);
     return mImpl->clearBufferiv(context, buffer, drawbuffer, values);
 }
 
@@ -1798,7 +1806,10 @@ angle::Result Framebuffer::readPixels(const Context *context,
                                       Buffer *packBuffer,
                                       void *pixels)
 {
-    ANGLE_TRY(mImpl->readPixels(context, area, format, type, pack, packBuffer, pixels));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY(mImpl->readPixels(context, area, format, type, pack, packBuffer, pixels));
+    }
 
     if (packBuffer)
     {
@@ -1816,7 +1827,10 @@ angle::Result Framebuffer::blit(const Context *context,
 {
     ASSERT(mask != 0);
 
-    ANGLE_TRY(mImpl->blit(context, sourceArea, destArea, mask, filter));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY(mImpl->blit(context, sourceArea, destArea, mask, filter));
+    }
 
     // Mark the contents of the attachments dirty
     if ((mask & GL_COLOR_BUFFER_BIT) != 0)
@@ -2181,7 +2195,10 @@ angle::Result Framebuffer::syncState(const Context *context,
     if (mDirtyBits.any())
     {
         mDirtyBitsGuard = mDirtyBits;
-        ANGLE_TRY(mImpl->syncState(context, framebufferBinding, mDirtyBits, command));
+        {
+            ANGLE_PROFILE_PHASE(Backend);
+            ANGLE_TRY(mImpl->syncState(context, framebufferBinding, mDirtyBits, command));
+        }
         mDirtyBits.reset();
         mDirtyBitsGuard.reset();
     }
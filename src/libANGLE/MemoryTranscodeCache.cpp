@@ -0,0 +1,253 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryTranscodeCache: Stores compressed textures transcoded on the CPU to a format the device
+//   supports, so the same data doesn't have to be transcoded again.  Transcodes are kept in memory,
+//   and can be used in conjunction with the application's blob cache callbacks to keep them across
+//   runs.
+
+#include "libANGLE/MemoryTranscodeCache.h"
+
+#include <anglebase/sha1.h>
+
+#include "common/angle_version_info.h"
+#include "libANGLE/histogram_macros.h"
+#include "platform/PlatformMethods.h"
+
+namespace gl
+{
+
+namespace
+{
+// Distinguishes the transcode keys from the program and shader keys in the application's cache,
+// as its callbacks are shared between them.
+constexpr char kTranscodeKeyPrefix[] = "ANGLE transcode";
+
+template <typename T>
+void AppendHashValue(angle::base::SecureHashAlgorithm &hasher, T value)
+{
+    static_assert(std::is_fundamental<T>::value || std::is_enum<T>::value);
+    hasher.Update(&value, sizeof(T));
+}
+
+// The key of a transcode in the application's cache.  Unlike the key of the in-memory cache, it
+// outlives the process, and the transcoders may change from one version of ANGLE to the next.
+egl::BlobCache::Key ComputePersistentKey(const egl::BlobCache::Key &hash)
+{
+    angle::base::SecureHashAlgorithm hasher;
+    hasher.Init();
+
+    hasher.Update(kTranscodeKeyPrefix, sizeof(kTranscodeKeyPrefix));
+    hasher.Update(angle::GetANGLECommitHash(), angle::GetANGLECommitHashSize());
+    hasher.Update(hash.data(), hash.size());
+
+    hasher.Final();
+    egl::BlobCache::Key key;
+    memcpy(key.data(), hasher.Digest(), angle::base::kSHA1Length);
+    return key;
+}
+}  // anonymous namespace
+
+MemoryTranscodeCache::MemoryTranscodeCache(egl::BlobCache &blobCache,
+                                           size_t maxCacheSizeBytes,
+                                           size_t maxPersistentSizeBytes)
+    : mBlobCache(blobCache),
+      mCache(maxCacheSizeBytes),
+      mMaxPersistentSize(maxPersistentSizeBytes),
+      mPersistentSize(0),
+      mHitCount(0),
+      mMissCount(0),
+      mPersistentHitCount(0)
+{}
+
+MemoryTranscodeCache::~MemoryTranscodeCache() {}
+
+bool MemoryTranscodeCache::isEnabled() const
+{
+    return maxSize() > 0;
+}
+
+// static
+void MemoryTranscodeCache::ComputeHash(angle::FormatID sourceFormat,
+                                       angle::FormatID transcodedFormat,
+                                       const Extents &extents,
+                                       size_t sourceRowPitch,
+                                       size_t sourceDepthPitch,
+                                       const uint8_t *source,
+                                       size_t sourceSize,
+                                       egl::BlobCache::Key *hashOut)
+{
+    angle::base::SecureHashAlgorithm hasher;
+    hasher.Init();
+
+    AppendHashValue(hasher, sourceFormat);
+    AppendHashValue(hasher, transcodedFormat);
+    AppendHashValue(hasher, extents.width);
+    AppendHashValue(hasher, extents.height);
+    AppendHashValue(hasher, extents.depth);
+    AppendHashValue(hasher, sourceRowPitch);
+    AppendHashValue(hasher, sourceDepthPitch);
+    hasher.Update(source, sourceSize);
+
+    hasher.Final();
+    memcpy(hashOut->data(), hasher.Digest(), angle::base::kSHA1Length);
+}
+
+bool MemoryTranscodeCache::getTranscodedData(const egl::BlobCache::Key &hash,
+                                             uint8_t *dest,
+                                             size_t destSize)
+{
+    bool found = false;
+    {
+        // The entry is copied out while the lock is held, as another thread may evict it.
+        std::lock_guard<angle::SimpleMutex> lock(mCacheMutex);
+        const angle::MemoryBuffer *entry = nullptr;
+        if (mCache.get(hash, &entry))
+        {
+            if (entry->size() == destSize)
+            {
+                memcpy(dest, entry->data(), destSize);
+                found = true;
+            }
+            else
+            {
+                mCache.eraseByKey(hash);
+            }
+        }
+    }
+
+    if (!found && getPersistentData(hash, dest, destSize))
+    {
+        found = true;
+        ++mPersistentHitCount;
+
+        // Keep the transcode in memory, so the next lookup doesn't go through the application.
+        angle::MemoryBuffer entry;
+        if (entry.resize(destSize))
+        {
+            memcpy(entry.data(), dest, destSize);
+            std::lock_guard<angle::SimpleMutex> lock(mCacheMutex);
+            mCache.put(hash, std::move(entry), destSize);
+        }
+    }
+
+    if (found)
+    {
+        ++mHitCount;
+    }
+    else
+    {
+        ++mMissCount;
+    }
+    ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.TranscodeCacheHit", found);
+
+    return found;
+}
+
+void MemoryTranscodeCache::putTranscodedData(const egl::BlobCache::Key &hash,
+                                             const uint8_t *data,
+                                             size_t size)
+{
+    // Don't bother copying data that would not fit in the cache.
+    if (size > maxSize())
+    {
+        return;
+    }
+
+    angle::MemoryBuffer entry;
+    if (!entry.resize(size))
+    {
+        return;
+    }
+    memcpy(entry.data(), data, size);
+
+    putPersistentData(hash, entry);
+
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mCacheMutex);
+        mCache.put(hash, std::move(entry), size);
+    }
+
+    ANGLE_HISTOGRAM_MEMORY_KB("GPU.ANGLE.TranscodeCacheEntrySizeKB", static_cast<int>(size / 1024));
+}
+
+void MemoryTranscodeCache::clear()
+{
+    std::lock_guard<angle::SimpleMutex> lock(mCacheMutex);
+    mCache.clear();
+    mPersistentSize = 0;
+}
+
+void MemoryTranscodeCache::resize(size_t maxCacheSizeBytes)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mCacheMutex);
+    mCache.resize(maxCacheSizeBytes);
+}
+
+size_t MemoryTranscodeCache::size() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mCacheMutex);
+    return mCache.size();
+}
+
+size_t MemoryTranscodeCache::maxSize() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mCacheMutex);
+    return mCache.maxSize();
+}
+
+size_t MemoryTranscodeCache::getPersistentSize() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mCacheMutex);
+    return mPersistentSize;
+}
+
+bool MemoryTranscodeCache::getPersistentData(const egl::BlobCache::Key &hash,
+                                             uint8_t *dest,
+                                             size_t destSize)
+{
+    // Without application callbacks, the blob cache only holds programs and shaders in memory.
+    if (!mBlobCache.areBlobCacheFuncsSet())
+    {
+        return false;
+    }
+
+    // The scratch buffer is local so contexts on different threads can look up transcodes at the
+    // same time.
+    angle::ScratchBuffer scratchBuffer;
+    egl::BlobCache::Value value;
+    if (!mBlobCache.get(nullptr, &scratchBuffer, ComputePersistentKey(hash), &value) ||
+        value.size() != destSize)
+    {
+        return false;
+    }
+
+    memcpy(dest, value.data(), destSize);
+    return true;
+}
+
+void MemoryTranscodeCache::putPersistentData(const egl::BlobCache::Key &hash,
+                                             const angle::MemoryBuffer &entry)
+{
+    if (!mBlobCache.areBlobCacheFuncsSet())
+    {
+        return;
+    }
+
+    // Transcodes are large compared to programs, so they are kept within their own budget to leave
+    // room for the programs and shaders in the application's cache.
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mCacheMutex);
+        if (entry.size() > mMaxPersistentSize - mPersistentSize)
+        {
+            return;
+        }
+        mPersistentSize += entry.size();
+    }
+
+    mBlobCache.putApplication(nullptr, ComputePersistentKey(hash), entry);
+}
+
+}  // namespace gl
@@ -0,0 +1,105 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryTranscodeCache: Stores compressed textures transcoded on the CPU to a format the device
+//   supports, so the same data doesn't have to be transcoded again.  Transcodes are kept in memory,
+//   and can be used in conjunction with the application's blob cache callbacks to keep them across
+//   runs.
+
+#ifndef LIBANGLE_MEMORY_TRANSCODE_CACHE_H_
+#define LIBANGLE_MEMORY_TRANSCODE_CACHE_H_
+
+#include <atomic>
+
+#include "common/MemoryBuffer.h"
+#include "common/SimpleMutex.h"
+#include "libANGLE/BlobCache.h"
+#include "libANGLE/SizedMRUCache.h"
+#include "libANGLE/angletypes.h"
+#include "libANGLE/renderer/FormatID_autogen.h"
+
+namespace gl
+{
+
+class MemoryTranscodeCache final : angle::NonCopyable
+{
+  public:
+    // The transcode cache keeps its own entries in memory, so that textures don't evict programs
+    // and shaders from the blob cache.  Transcodes are also stored in the application's cache
+    // through |blobCache| if its callbacks are set, up to |maxPersistentSizeBytes| per run.
+    MemoryTranscodeCache(egl::BlobCache &blobCache,
+                         size_t maxCacheSizeBytes,
+                         size_t maxPersistentSizeBytes);
+    ~MemoryTranscodeCache();
+
+    // Returns whether transcodes are cached at all.  If not, hashing the source data can be
+    // skipped.
+    bool isEnabled() const;
+
+    // Computes the key of a transcode.  The transcoded data depends on the source data, its
+    // layout and the source and transcoded formats.
+    static void ComputeHash(angle::FormatID sourceFormat,
+                            angle::FormatID transcodedFormat,
+                            const Extents &extents,
+                            size_t sourceRowPitch,
+                            size_t sourceDepthPitch,
+                            const uint8_t *source,
+                            size_t sourceSize,
+                            egl::BlobCache::Key *hashOut);
+
+    // Copies the transcoded data to |dest| if it is in the cache, looking in the application's
+    // cache if it isn't in memory.  Data of a different size than |destSize| is evicted.
+    bool getTranscodedData(const egl::BlobCache::Key &hash, uint8_t *dest, size_t destSize);
+
+    // Stores transcoded data in the cache, and in the application's cache if the persistent budget
+    // allows it.
+    void putTranscodedData(const egl::BlobCache::Key &hash, const uint8_t *data, size_t size);
+
+    // Empty the cache and reset the persistent budget.  Entries already stored in the
+    // application's cache are left there.
+    void clear();
+
+    // Resize the cache. Discards current contents.
+    void resize(size_t maxCacheSizeBytes);
+
+    // Returns the current cache size in bytes.
+    size_t size() const;
+
+    // Returns the maximum cache size in bytes.
+    size_t maxSize() const;
+
+    // Returns the number of lookups that found, or didn't find, the transcoded data.
+    uint64_t getHitCount() const { return mHitCount; }
+    uint64_t getMissCount() const { return mMissCount; }
+
+    // Returns the number of hits that were found in the application's cache.
+    uint64_t getPersistentHitCount() const { return mPersistentHitCount; }
+
+    // Returns the number of bytes stored in the application's cache since the last clear().
+    size_t getPersistentSize() const;
+
+  private:
+    bool getPersistentData(const egl::BlobCache::Key &hash, uint8_t *dest, size_t destSize);
+    void putPersistentData(const egl::BlobCache::Key &hash, const angle::MemoryBuffer &entry);
+
+    egl::BlobCache &mBlobCache;
+
+    // Transcoded formats are already compressed, so entries are stored as they are.
+    mutable angle::SimpleMutex mCacheMutex;
+    angle::SizedMRUCache<egl::BlobCache::Key, angle::MemoryBuffer> mCache;
+
+    // The application's cache evicts entries on its own terms, so only the amount of data sent to
+    // it is bounded.
+    size_t mMaxPersistentSize;
+    size_t mPersistentSize;
+
+    std::atomic<uint64_t> mHitCount;
+    std::atomic<uint64_t> mMissCount;
+    std::atomic<uint64_t> mPersistentHitCount;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_MEMORY_TRANSCODE_CACHE_H_
@@ -0,0 +1,249 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryTranscodeCache_unittest.cpp: Unit tests for the transcode cache.
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <vector>
+
+#include "libANGLE/MemoryTranscodeCache.h"
+
+namespace gl
+{
+namespace
+{
+using Key = egl::BlobCache::Key;
+
+std::vector<uint8_t> MakeData(size_t size, uint8_t start)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7 + start);
+    }
+    return data;
+}
+
+// Stands in for the application's blob cache.
+std::map<std::vector<uint8_t>, std::vector<uint8_t>> gApplicationCache;
+
+void SetBlob(const void *key, EGLsizeiANDROID keySize, const void *value, EGLsizeiANDROID valueSize)
+{
+    const uint8_t *keyBytes   = static_cast<const uint8_t *>(key);
+    const uint8_t *valueBytes = static_cast<const uint8_t *>(value);
+    gApplicationCache[std::vector<uint8_t>(keyBytes, keyBytes + keySize)] =
+        std::vector<uint8_t>(valueBytes, valueBytes + valueSize);
+}
+
+EGLsizeiANDROID GetBlob(const void *key,
+                        EGLsizeiANDROID keySize,
+                        void *value,
+                        EGLsizeiANDROID valueSize)
+{
+    const uint8_t *keyBytes = static_cast<const uint8_t *>(key);
+    auto iter = gApplicationCache.find(std::vector<uint8_t>(keyBytes, keyBytes + keySize));
+    if (iter == gApplicationCache.end())
+    {
+        return 0;
+    }
+    if (static_cast<size_t>(valueSize) >= iter->second.size())
+    {
+        memcpy(value, iter->second.data(), iter->second.size());
+    }
+    return static_cast<EGLsizeiANDROID>(iter->second.size());
+}
+
+Key HashSource(const std::vector<uint8_t> &source,
+               angle::FormatID transcodedFormat = angle::FormatID::BC1_RGB_UNORM_BLOCK,
+               const Extents &extents           = Extents(16, 16, 1))
+{
+    Key key;
+    MemoryTranscodeCache::ComputeHash(angle::FormatID::ETC2_R8G8B8_UNORM_BLOCK, transcodedFormat,
+                                      extents, 32, 128, source.data(), source.size(), &key);
+    return key;
+}
+
+// Test that transcoded data is found again, and that lookups are counted.
+TEST(MemoryTranscodeCacheTest, PutAndGet)
+{
+    egl::BlobCache blobCache(0);
+    MemoryTranscodeCache cache(blobCache, 1024 * 1024, 1024 * 1024);
+    EXPECT_TRUE(cache.isEnabled());
+
+    const std::vector<uint8_t> source     = MakeData(128, 1);
+    const std::vector<uint8_t> transcoded = MakeData(128, 2);
+    const Key key                         = HashSource(source);
+
+    std::vector<uint8_t> result(transcoded.size());
+    EXPECT_FALSE(cache.getTranscodedData(key, result.data(), result.size()));
+    EXPECT_EQ(cache.getHitCount(), 0u);
+    EXPECT_EQ(cache.getMissCount(), 1u);
+
+    cache.putTranscodedData(key, transcoded.data(), transcoded.size());
+    EXPECT_TRUE(cache.getTranscodedData(key, result.data(), result.size()));
+    EXPECT_EQ(result, transcoded);
+    EXPECT_EQ(cache.getHitCount(), 1u);
+    EXPECT_EQ(cache.getMissCount(), 1u);
+
+    cache.clear();
+    EXPECT_FALSE(cache.getTranscodedData(key, result.data(), result.size()));
+    EXPECT_EQ(cache.getMissCount(), 2u);
+}
+
+// Test that the key depends on the source data, the transcoded format and the extents.
+TEST(MemoryTranscodeCacheTest, KeyContents)
+{
+    const std::vector<uint8_t> source = MakeData(128, 1);
+    std::vector<uint8_t> otherSource  = source;
+    otherSource.back() ^= 1;
+
+    const Key key = HashSource(source);
+    EXPECT_EQ(key, HashSource(source));
+    EXPECT_NE(key, HashSource(otherSource));
+    EXPECT_NE(key, HashSource(source, angle::FormatID::BC1_RGB_UNORM_SRGB_BLOCK));
+    EXPECT_NE(key, HashSource(source, angle::FormatID::BC1_RGB_UNORM_BLOCK, Extents(8, 32, 1)));
+}
+
+// Test that data of an unexpected size is not returned, and is evicted.
+TEST(MemoryTranscodeCacheTest, SizeMismatch)
+{
+    egl::BlobCache blobCache(0);
+    MemoryTranscodeCache cache(blobCache, 1024 * 1024, 1024 * 1024);
+
+    const std::vector<uint8_t> source     = MakeData(128, 1);
+    const std::vector<uint8_t> transcoded = MakeData(64, 2);
+    const Key key                         = HashSource(source);
+    cache.putTranscodedData(key, transcoded.data(), transcoded.size());
+
+    std::vector<uint8_t> result(transcoded.size() * 2);
+    EXPECT_FALSE(cache.getTranscodedData(key, result.data(), result.size()));
+
+    result.resize(transcoded.size());
+    EXPECT_FALSE(cache.getTranscodedData(key, result.data(), result.size()));
+}
+
+// Test that the cache stays within its budget, evicting the least recently used transcodes.
+TEST(MemoryTranscodeCacheTest, Budget)
+{
+    egl::BlobCache blobCache(0);
+    MemoryTranscodeCache cache(blobCache, 256, 1024 * 1024);
+
+    const std::vector<uint8_t> transcoded = MakeData(128, 2);
+    const Key firstKey                    = HashSource(MakeData(128, 1));
+    const Key secondKey                   = HashSource(MakeData(128, 3));
+    const Key thirdKey                    = HashSource(MakeData(128, 4));
+
+    cache.putTranscodedData(firstKey, transcoded.data(), transcoded.size());
+    cache.putTranscodedData(secondKey, transcoded.data(), transcoded.size());
+    EXPECT_EQ(cache.size(), 256u);
+
+    // Use the first transcode, so the second one is evicted.
+    std::vector<uint8_t> result(transcoded.size());
+    EXPECT_TRUE(cache.getTranscodedData(firstKey, result.data(), result.size()));
+    cache.putTranscodedData(thirdKey, transcoded.data(), transcoded.size());
+    EXPECT_EQ(cache.size(), 256u);
+    EXPECT_TRUE(cache.getTranscodedData(firstKey, result.data(), result.size()));
+    EXPECT_FALSE(cache.getTranscodedData(secondKey, result.data(), result.size()));
+    EXPECT_TRUE(cache.getTranscodedData(thirdKey, result.data(), result.size()));
+
+    // Transcodes larger than the whole budget are not stored.
+    const std::vector<uint8_t> large = MakeData(512, 5);
+    const Key largeKey               = HashSource(MakeData(128, 6));
+    cache.putTranscodedData(largeKey, large.data(), large.size());
+    result.resize(large.size());
+    EXPECT_FALSE(cache.getTranscodedData(largeKey, result.data(), result.size()));
+    EXPECT_EQ(cache.size(), 256u);
+}
+
+// Test that a cache without a budget is disabled.
+TEST(MemoryTranscodeCacheTest, Disabled)
+{
+    egl::BlobCache blobCache(0);
+    MemoryTranscodeCache cache(blobCache, 0, 1024 * 1024);
+    EXPECT_FALSE(cache.isEnabled());
+
+    cache.resize(1024);
+    EXPECT_TRUE(cache.isEnabled());
+    EXPECT_EQ(cache.maxSize(), 1024u);
+}
+
+// Test that transcodes stored in the application's cache are found by a new cache, as they would
+// be in the next run of the application, and don't collide with other blobs.
+TEST(MemoryTranscodeCacheTest, Persistent)
+{
+    gApplicationCache.clear();
+
+    const std::vector<uint8_t> source     = MakeData(128, 1);
+    const std::vector<uint8_t> transcoded = MakeData(128, 2);
+    const Key key                         = HashSource(source);
+
+    {
+        egl::BlobCache blobCache(0);
+        blobCache.setBlobCacheFuncs(SetBlob, GetBlob);
+        MemoryTranscodeCache cache(blobCache, 1024 * 1024, 1024 * 1024);
+        cache.putTranscodedData(key, transcoded.data(), transcoded.size());
+        EXPECT_EQ(cache.getPersistentSize(), transcoded.size());
+    }
+    ASSERT_EQ(gApplicationCache.size(), 1u);
+    EXPECT_EQ(gApplicationCache.count(std::vector<uint8_t>(key.begin(), key.end())), 0u);
+
+    egl::BlobCache blobCache(0);
+    blobCache.setBlobCacheFuncs(SetBlob, GetBlob);
+    MemoryTranscodeCache cache(blobCache, 1024 * 1024, 1024 * 1024);
+
+    std::vector<uint8_t> result(transcoded.size());
+    EXPECT_TRUE(cache.getTranscodedData(key, result.data(), result.size()));
+    EXPECT_EQ(result, transcoded);
+    EXPECT_EQ(cache.getHitCount(), 1u);
+    EXPECT_EQ(cache.getPersistentHitCount(), 1u);
+
+    // The transcode is now in memory as well.
+    gApplicationCache.clear();
+    EXPECT_TRUE(cache.getTranscodedData(key, result.data(), result.size()));
+    EXPECT_EQ(cache.getHitCount(), 2u);
+    EXPECT_EQ(cache.getPersistentHitCount(), 1u);
+
+    // Data of an unexpected size in the application's cache is not returned.
+    cache.clear();
+    cache.putTranscodedData(key, transcoded.data(), transcoded.size());
+    cache.clear();
+    result.resize(transcoded.size() / 2);
+    EXPECT_FALSE(cache.getTranscodedData(key, result.data(), result.size()));
+    EXPECT_EQ(cache.getMissCount(), 1u);
+}
+
+// Test that the application's cache receives no more transcodes than the persistent budget, and
+// that the in-memory cache doesn't depend on it.
+TEST(MemoryTranscodeCacheTest, PersistentBudget)
+{
+    gApplicationCache.clear();
+
+    egl::BlobCache blobCache(0);
+    blobCache.setBlobCacheFuncs(SetBlob, GetBlob);
+    MemoryTranscodeCache cache(blobCache, 1024 * 1024, 256);
+
+    const std::vector<uint8_t> transcoded = MakeData(128, 2);
+    for (uint8_t i = 0; i < 3; ++i)
+    {
+        const Key key = HashSource(MakeData(128, i + 10));
+        cache.putTranscodedData(key, transcoded.data(), transcoded.size());
+    }
+    EXPECT_EQ(gApplicationCache.size(), 2u);
+    EXPECT_EQ(cache.getPersistentSize(), 256u);
+    EXPECT_EQ(cache.size(), 384u);
+
+    // Clearing the cache starts a new budget.
+    cache.clear();
+    EXPECT_EQ(cache.getPersistentSize(), 0u);
+    const Key key = HashSource(MakeData(128, 20));
+    cache.putTranscodedData(key, transcoded.data(), transcoded.size());
+    EXPECT_EQ(gApplicationCache.size(), 3u);
+
+    gApplicationCache.clear();
+}
+}  // anonymous namespace
+}  // namespace gl
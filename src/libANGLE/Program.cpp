@@ -1700,7 +1700,9 @@ bool Program::linkValidateShaders()
 {
     // Wait for attached shaders to finish compilation.  At this point, they need to be checked
     // whether they successfully compiled.  This information is cached so that all compile jobs can
-    // be waited on and their corresponding objects released before the actual check.
+    // be waited on and their corresponding objects released before the actual check.  The
+    // compilation a backend does internally is not waited on if the program can be linked while
+    // it's in progress.
     //
     // Note that this function is called from the link job, and is therefore not protected by any
     // locks.
@@ -1710,7 +1712,7 @@ bool Program::linkValidateShaders()
         const SharedCompileJob &compileJob = mState.mShaderCompileJobs[shaderType];
         if (compileJob)
         {
-            const bool success = WaitCompileJobUnlocked(compileJob);
+            const bool success = WaitCompileJobForLinkUnlocked(compileJob);
             successfullyCompiledShaders.set(shaderType, success);
         }
     }
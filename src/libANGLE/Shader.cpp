@@ -136,6 +136,19 @@ class CompileTask final : public angle::Closure
         return angle::Result::Continue;
     }
 
+    // Like getResult(), except that only the result of the translation is returned if the
+    // backend can link the shader while it's still being compiled internally.  The link then
+    // doesn't have to wait for the driver to finish compiling.
+    angle::Result getResultForLink()
+    {
+        if (mTranslateTask->canLinkWhileCompilingInternally() &&
+            mTranslateTask->isCompilingInternally())
+        {
+            return mResult;
+        }
+        return getResult();
+    }
+
     bool isCompilingInternally() { return mTranslateTask->isCompilingInternally(); }
 
     std::string &&getInfoLog() { return std::move(mInfoLog); }
@@ -180,6 +193,14 @@ class CompileEvent final
 
         return mCompileTask->getResult();
     }
+    angle::Result waitForLink()
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "CompileEvent::waitForLink");
+
+        mWaitableEvent->wait();
+
+        return mCompileTask->getResultForLink();
+    }
     bool isCompiling()
     {
         return !mWaitableEvent->isReady() || mCompileTask->isCompilingInternally();
@@ -404,6 +425,7 @@ struct CompileJob
 {
     virtual ~CompileJob() = default;
     virtual bool wait() { return compileEvent->wait() == angle::Result::Continue; }
+    virtual bool waitForLink() { return compileEvent->waitForLink() == angle::Result::Continue; }
 
     std::unique_ptr<CompileEvent> compileEvent;
     ShCompilerInstance shCompilerInstance;
@@ -413,6 +435,7 @@ struct CompileJobDone final : public CompileJob
 {
     CompileJobDone(bool compiledIn) : compiled(compiledIn) {}
     bool wait() override { return compiled; }
+    bool waitForLink() override { return compiled; }
 
     bool compiled;
 };
@@ -737,6 +760,12 @@ void Shader::compile(const Context *context, angle::JobResultExpectancy resultEx
         context->getFrontendFeatures().compileJobIsThreadSafe.enabled
             ? angle::JobThreadSafety::Safe
             : angle::JobThreadSafety::Unsafe;
+
+    // Let the translator split large shaders over the same pool the compile job runs on.
+    sh::SetWorkerThreadPool(compilerHandle, threadSafety == angle::JobThreadSafety::Safe
+                                                ? context->getShaderCompileThreadPool()
+                                                : nullptr);
+
     std::shared_ptr<angle::WaitableEvent> compileEvent =
         context->postCompileLinkTask(compileTask, threadSafety, resultExpectancy);
 
@@ -776,6 +805,7 @@ void Shader::resolveCompile(const Context *context)
             }
         }
 
+        sh::SetWorkerThreadPool(mCompileJob->shCompilerInstance.getHandle(), nullptr);
         mBoundCompiler->putInstance(std::move(mCompileJob->shCompilerInstance));
     }
     mCompileJob.reset();
@@ -1032,4 +1062,9 @@ bool WaitCompileJobUnlocked(const SharedCompileJob &compileJob)
     // done in resolveCompile() when the main thread happens to call it.
     return compileJob->wait();
 }
+
+bool WaitCompileJobForLinkUnlocked(const SharedCompileJob &compileJob)
+{
+    return compileJob->waitForLink();
+}
 }  // namespace gl
@@ -240,6 +240,11 @@ std::string GetShaderDumpFileName(size_t shaderHash);
 // for shader compilation.  As such, it may be called by multiple threads without holding a lock and
 // must therefore be thread-safe.  It returns true if shader compilation has succeeded.
 bool WaitCompileJobUnlocked(const SharedCompileJob &compileJob);
+
+// Like WaitCompileJobUnlocked, but doesn't wait for the compilation the backend does internally if
+// the program can be linked before it's finished.  A failure of that compilation results in a link
+// failure instead.
+bool WaitCompileJobForLinkUnlocked(const SharedCompileJob &compileJob);
 }  // namespace gl
 
 #endif  // LIBANGLE_SHADER_H_
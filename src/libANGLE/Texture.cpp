@@ -16,6 +16,7 @@
 #include "common/utilities.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/EntryPointProfiler.h"
 #include "libANGLE/Image.h"
 #include "libANGLE/State.h"
 #include "libANGLE/Surface.h"
@@ -1407,8 +1408,11 @@ angle::Result Texture::setImage(Context *context,
 
     ImageIndex index = ImageIndex::MakeFromTarget(target, level, size.depth);
 
-    ANGLE_TRY(mTexture->setImage(context, index, internalFormat, size, format, type, unpackState,
-                                 unpackBuffer, pixels));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY(mTexture->setImage(context, index, internalFormat, size, format, type,
+                                     unpackState, unpackBuffer, pixels));
+    }
 
     InitState initState = DetermineInitState(context, unpackBuffer, pixels);
     mState.setImageDesc(target, level, ImageDesc(size, Format(internalFormat, type), initState));
@@ -1435,8 +1439,11 @@ angle::Result Texture::setSubImage(Context *context,
     ImageIndex index = ImageIndex::MakeFromTarget(target, level, area.depth);
     ANGLE_TRY(ensureSubImageInitialized(context, index, area));
 
-    ANGLE_TRY(mTexture->setSubImage(context, index, area, format, type, unpackState, unpackBuffer,
-                                    pixels));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY(mTexture->setSubImage(context, index, area, format, type, unpackState,
+                                        unpackBuffer, pixels));
+    }
 
     ANGLE_TRY(handleMipmapGenerationHint(context, level));
 
@@ -1464,8 +1471,11 @@ angle::Result Texture::setCompressedImage(Context *context,
 
     ImageIndex index = ImageIndex::MakeFromTarget(target, level, size.depth);
 
-    ANGLE_TRY(mTexture->setCompressedImage(context, index, internalFormat, size, unpackState,
-                                           imageSize, pixels));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY(mTexture->setCompressedImage(context, index, internalFormat, size, unpackState,
+                                               imageSize, pixels));
+    }
 
     Buffer *unpackBuffer = context->getState().getTargetBuffer(BufferBinding::PixelUnpack);
 
@@ -1490,8 +1500,11 @@ angle::Result Texture::setCompressedSubImage(const Context *context,
     ImageIndex index = ImageIndex::MakeFromTarget(target, level, area.depth);
     ANGLE_TRY(ensureSubImageInitialized(context, index, area));
 
-    ANGLE_TRY(mTexture->setCompressedSubImage(context, index, area, format, unpackState, imageSize,
-                                              pixels));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY(mTexture->setCompressedSubImage(context, index, area, format, unpackState,
+                                                  imageSize, pixels));
+    }
 
     onStateChange(angle::SubjectMessage::ContentsChanged);
 
@@ -1553,15 +1566,20 @@ angle::Result Texture::copyImage(Context *context,
     Extents size(sourceArea.width, sourceArea.height, 1);
     if (forceCopySubImage || doesSubImageNeedInit(context, index, destBox))
     {
-        ANGLE_TRY(mTexture->setImage(context, index, internalFormat, size,
-                                     internalFormatInfo.format, internalFormatInfo.type,
-                                     PixelUnpackState(), nullptr, nullptr));
+        {
+            ANGLE_PROFILE_PHASE(Backend);
+            ANGLE_TRY(mTexture->setImage(context, index, internalFormat, size,
+                                         internalFormatInfo.format, internalFormatInfo.type,
+                                         PixelUnpackState(), nullptr, nullptr));
+        }
         mState.setImageDesc(target, level, ImageDesc(size, Format(internalFormatInfo), initState));
         ANGLE_TRY(ensureSubImageInitialized(context, index, destBox));
+        ANGLE_PROFILE_PHASE(Backend);
         ANGLE_TRY(mTexture->copySubImage(context, index, Offset(), sourceArea, source));
     }
     else
     {
+        ANGLE_PROFILE_PHASE(Backend);
         ANGLE_TRY(mTexture->copyImage(context, index, sourceArea, internalFormat, source));
     }
 
@@ -1607,7 +1625,10 @@ angle::Result Texture::copySubImage(Context *context,
 
     ANGLE_TRY(ensureSubImageInitialized(context, index, destBox));
 
-    ANGLE_TRY(mTexture->copySubImage(context, index, destOffset, sourceArea, source));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY(mTexture->copySubImage(context, index, destOffset, sourceArea, source));
+    }
     ANGLE_TRY(handleMipmapGenerationHint(context, index.getLevelIndex()));
 
     onStateChange(angle::SubjectMessage::ContentsChanged);
@@ -1771,7 +1792,10 @@ angle::Result Texture::setStorage(Context *context,
     mState.setImageDescChain(0, static_cast<GLuint>(levels - 1), size, Format(internalFormat),
                              initState);
 
-    ANGLE_TRY(mTexture->setStorage(context, type, levels, internalFormat, size));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY(mTexture->setStorage(context, type, levels, internalFormat, size));
+    }
 
     // Changing the texture to immutable can trigger a change in the base and max levels:
     // GLES 3.0.4 section 3.8.10 pg 158:
@@ -1995,7 +2019,10 @@ angle::Result Texture::generateMipmap(Context *context)
     }
 
     ANGLE_TRY(syncState(context, Command::GenerateMipmap));
-    ANGLE_TRY(mTexture->generateMipmap(context));
+    {
+        ANGLE_PROFILE_PHASE(Backend);
+        ANGLE_TRY(mTexture->generateMipmap(context));
+    }
 
     // Propagate the format and size of the base mip to the smaller ones. Cube maps are guaranteed
     // to have faces of the same size and format so any faces can be picked.
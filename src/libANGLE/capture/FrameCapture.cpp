@@ -5777,12 +5777,14 @@ bool IsTrackedPerContext(ResourceIDType type)
 CoherentBuffer::CoherentBuffer(uintptr_t start,
                                size_t size,
                                size_t pageSize,
-                               bool isShadowMemoryEnabled)
+                               bool isShadowMemoryEnabled,
+                               bool isSoftDirtyEnabled)
     : mPageSize(pageSize),
       mShadowMemoryEnabled(isShadowMemoryEnabled),
       mBufferStart(start),
       mShadowMemory(nullptr),
-      mShadowDirty(false)
+      mShadowDirty(false),
+      mSoftDirtyEnabled(isSoftDirtyEnabled)
 {
     if (mShadowMemoryEnabled)
     {
@@ -5948,6 +5950,12 @@ void CoherentBuffer::setDirty(size_t relativePage, bool dirty)
         ASSERT(mProtectionRange.end() == pageStart + mPageSize);
     }
 
+    if (mSoftDirtyEnabled)
+    {
+        mDirtyPages[relativePage] = dirty;
+        return;
+    }
+
     bool ret;
     if (dirty)
     {
@@ -5968,6 +5976,11 @@ void CoherentBuffer::setDirty(size_t relativePage, bool dirty)
 
 void CoherentBuffer::removeProtection(PageSharingType sharingType)
 {
+    if (mSoftDirtyEnabled)
+    {
+        return;
+    }
+
     uintptr_t start = mProtectionRange.start;
     size_t size     = mProtectionRange.size;
 
@@ -6005,16 +6018,36 @@ void CoherentBuffer::removeProtection(PageSharingType sharingType)
     }
 }
 
-bool CoherentBufferTracker::canProtectDirectly(gl::Context *context)
+size_t CoherentBuffer::collectSoftDirtyPages(std::vector<bool> *softDirtyPages)
+{
+    if (!GetSoftDirtyPages(mProtectionRange.start, mPageCount, softDirtyPages))
+    {
+        ERR() << "Could not read soft-dirty bits for buffer at "
+              << reinterpret_cast<void *>(mProtectionRange.start) << ", comparing all of it.";
+        softDirtyPages->assign(mPageCount, true);
+    }
+
+    // The bits of the pages captured since they were last cleared are still set, those pages are
+    // captured again as the app may have written them since.
+    size_t newlyDirtyPages = 0;
+    for (size_t page = 0; page < mPageCount; page++)
+    {
+        if ((*softDirtyPages)[page] && !mDirtyPages[page])
+        {
+            mDirtyPages[page] = true;
+            newlyDirtyPages++;
+        }
+    }
+    return newlyDirtyPages;
+}
+
+gl::Buffer *MapCoherentProbeBuffer(gl::Context *context, GLsizei size)
 {
     gl::BufferID bufferId = context->createBuffer();
 
     gl::BufferBinding targetPacked = gl::BufferBinding::Array;
     context->bindBuffer(targetPacked, bufferId);
 
-    // Allocate 2 pages so we will always have a full aligned page to protect
-    GLsizei size = static_cast<GLsizei>(mPageSize * 2);
-
     context->bufferStorage(targetPacked, size, nullptr,
                            GL_DYNAMIC_STORAGE_BIT_EXT | GL_MAP_WRITE_BIT |
                                GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT);
@@ -6028,14 +6061,51 @@ bool CoherentBufferTracker::canProtectDirectly(gl::Context *context)
         ERR() << "Failed to mapRange of buffer.";
     }
 
-    void *map = buffer->getMapPointer();
-    if (map == nullptr)
+    if (buffer->getMapPointer() == nullptr)
     {
         ERR() << "Failed to getMapPointer of buffer.";
     }
 
+    return buffer;
+}
+
+void UnmapCoherentProbeBuffer(gl::Context *context, gl::Buffer *buffer)
+{
+    GLboolean unmapResult;
+    if (buffer->unmap(context, &unmapResult) != angle::Result::Continue)
+    {
+        ERR() << "Could not unmap buffer.";
+    }
+    context->bindBuffer(gl::BufferBinding::Array, {0});
+    context->deleteBuffer(buffer->id());
+}
+
+// Soft-dirty bits can only be used if clearing them sticks and a write sets them again. Kernels
+// built without CONFIG_MEM_SOFT_DIRTY and PFN mapped device memory fail this.
+bool CanTrackSoftDirtyPage(uintptr_t pageStart)
+{
+    volatile uint8_t *pageData = reinterpret_cast<volatile uint8_t *>(pageStart);
+    std::vector<bool> dirtyPages;
+
+    // Make sure the page is present, as faulting it in could set the bit without tracking writes
+    *pageData = *pageData;
+    if (!ClearSoftDirtyPages() || !GetSoftDirtyPages(pageStart, 1, &dirtyPages) || dirtyPages[0])
+    {
+        return false;
+    }
+
+    *pageData = *pageData;
+    return GetSoftDirtyPages(pageStart, 1, &dirtyPages) && dirtyPages[0];
+}
+
+bool CoherentBufferTracker::canProtectDirectly(gl::Context *context)
+{
+    // Allocate 2 pages so we will always have a full aligned page to protect
+    GLsizei size       = static_cast<GLsizei>(mPageSize * 2);
+    gl::Buffer *buffer = MapCoherentProbeBuffer(context, size);
+
     // Test mprotect
-    auto start = reinterpret_cast<uintptr_t>(map);
+    auto start = reinterpret_cast<uintptr_t>(buffer->getMapPointer());
 
     // Only protect a whole page inside the allocated memory
     uintptr_t protectionStart = rx::roundUpPow2(start, mPageSize);
@@ -6051,12 +6121,7 @@ bool CoherentBufferTracker::canProtectDirectly(gl::Context *context)
 
     if (!handler->enable())
     {
-        GLboolean unmapResult;
-        if (buffer->unmap(context, &unmapResult) != angle::Result::Continue)
-        {
-            ERR() << "Could not unmap buffer.";
-        }
-        context->bindBuffer(targetPacked, {0});
+        UnmapCoherentProbeBuffer(context, buffer);
 
         // Page fault handler could not be enabled, memory can't be protected directly.
         return false;
@@ -6074,16 +6139,87 @@ bool CoherentBufferTracker::canProtectDirectly(gl::Context *context)
 
     // Clean up
     handler->disable();
+    UnmapCoherentProbeBuffer(context, buffer);
 
-    GLboolean unmapResult;
-    if (buffer->unmap(context, &unmapResult) != angle::Result::Continue)
+    return canProtect;
+}
+
+void CoherentBufferTracker::determineSoftDirtySupport(gl::Context *context)
+{
+    // Buffers that are already tracked keep the mode they were added with
+    if (!mSoftDirtyAllowed || mEnabled || !mBuffers.empty())
     {
-        ERR() << "Could not unmap buffer.";
+        return;
     }
-    context->bindBuffer(targetPacked, {0});
-    context->deleteBuffer(buffer->id());
 
-    return canProtect;
+    if (mShadowMemoryEnabled)
+    {
+        // Shadow memory is ordinary anonymous memory
+        void *page        = AlignedAlloc(mPageSize, mPageSize);
+        mSoftDirtyEnabled = CanTrackSoftDirtyPage(reinterpret_cast<uintptr_t>(page));
+        AlignedFree(page);
+    }
+    else
+    {
+        GLsizei size       = static_cast<GLsizei>(mPageSize * 2);
+        gl::Buffer *buffer = MapCoherentProbeBuffer(context, size);
+        auto start         = reinterpret_cast<uintptr_t>(buffer->getMapPointer());
+        mSoftDirtyEnabled  = start != 0 && CanTrackSoftDirtyPage(rx::roundUpPow2(start, mPageSize));
+        UnmapCoherentProbeBuffer(context, buffer);
+    }
+
+    if (mSoftDirtyEnabled)
+    {
+        INFO() << "Using soft-dirty bits for coherent buffer tracking.";
+    }
+}
+
+void CoherentBufferTracker::scanSoftDirtyPages()
+{
+    if (!mSoftDirtyEnabled || !mEnabled)
+    {
+        return;
+    }
+
+    size_t newlyDirtyPages = 0;
+    for (const auto &pair : mBuffers)
+    {
+        newlyDirtyPages += pair.second->collectSoftDirtyPages(&mSoftDirtyPages);
+    }
+
+    // Clearing the bits write protects every page of the process in the kernel, so every page the
+    // process writes afterwards takes a fault.  Until the end of the frame, the captured pages are
+    // captured again at each scan instead, unless that's more expensive.  A write made by another
+    // thread between the scan and the clear is missed.
+    if (newlyDirtyPages > kMaxRecapturedSoftDirtyPages)
+    {
+        clearSoftDirtyPages();
+    }
+}
+
+void CoherentBufferTracker::onFrameCaptured()
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    if (!mSoftDirtyEnabled || !mEnabled)
+    {
+        return;
+    }
+
+    // The pages written since the last scan stay dirty until the next capture
+    for (const auto &pair : mBuffers)
+    {
+        pair.second->collectSoftDirtyPages(&mSoftDirtyPages);
+    }
+    clearSoftDirtyPages();
+}
+
+void CoherentBufferTracker::clearSoftDirtyPages()
+{
+    if (!ClearSoftDirtyPages())
+    {
+        ERR() << "Could not clear soft-dirty bits.";
+    }
 }
 
 PageFaultHandlerRangeType CoherentBufferTracker::handleWrite(uintptr_t address)
@@ -6159,6 +6295,13 @@ void CoherentBufferTracker::enable()
         return;
     }
 
+    // Writes are found by scanning the soft-dirty bits, the pages don't need to be protected
+    if (mSoftDirtyEnabled)
+    {
+        mEnabled = true;
+        return;
+    }
+
     PageFaultCallback callback = [this](uintptr_t address) { return handleWrite(address); };
 
     // This needs to be initialized after canProtectDirectly ran and can only be initialized once.
@@ -6214,7 +6357,8 @@ uintptr_t CoherentBufferTracker::addBuffer(gl::BufferID id, uintptr_t start, siz
         return buffer->getRange().start;
     }
 
-    auto buffer = std::make_shared<CoherentBuffer>(start, size, mPageSize, mShadowMemoryEnabled);
+    auto buffer = std::make_shared<CoherentBuffer>(start, size, mPageSize, mShadowMemoryEnabled,
+                                                   mSoftDirtyEnabled);
     uintptr_t realOrShadowStart = buffer->getRange().start;
 
     mBuffers.insert(std::make_pair(id.value, std::move(buffer)));
@@ -6224,6 +6368,7 @@ uintptr_t CoherentBufferTracker::addBuffer(gl::BufferID id, uintptr_t start, siz
 
 void CoherentBufferTracker::maybeUpdateShadowMemory()
 {
+    std::vector<std::shared_ptr<CoherentBuffer>> updatedBuffers;
     for (const auto &pair : mBuffers)
     {
         std::shared_ptr<CoherentBuffer> cb = pair.second;
@@ -6231,9 +6376,23 @@ void CoherentBufferTracker::maybeUpdateShadowMemory()
         {
             cb->removeProtection(PageSharingType::NoneShared);
             cb->updateShadowMemory();
-            cb->protectAll();
+            updatedBuffers.push_back(cb);
         }
     }
+
+    if (updatedBuffers.empty())
+    {
+        return;
+    }
+
+    // Our own writes to the shadow memory set soft-dirty bits, they are scanned so the updated
+    // buffers can be set clean without losing the app's writes to other buffers.
+    scanSoftDirtyPages();
+
+    for (const std::shared_ptr<CoherentBuffer> &cb : updatedBuffers)
+    {
+        cb->protectAll();
+    }
 }
 
 void CoherentBufferTracker::markAllShadowDirty()
@@ -6335,6 +6494,7 @@ void FrameCaptureShared::determineMemoryProtectionSupport(gl::Context *context)
     // previously
     if (mCoherentBufferTracker.isShadowMemoryEnabled())
     {
+        mCoherentBufferTracker.determineSoftDirtySupport(context);
         return;
     }
 
@@ -6373,6 +6533,8 @@ void FrameCaptureShared::determineMemoryProtectionSupport(gl::Context *context)
         // only on assertion enabled builds.
         ASSERT(mCoherentBufferTracker.canProtectDirectly(context));
     }
+
+    mCoherentBufferTracker.determineSoftDirtySupport(context);
 }
 
 void FrameCaptureShared::trackBufferMapping(const gl::Context *context,
@@ -6903,6 +7065,8 @@ void FrameCaptureShared::maybeCaptureCoherentBuffers(const gl::Context *context)
 
     std::lock_guard<angle::SimpleMutex> lock(mCoherentBufferTracker.mMutex);
 
+    mCoherentBufferTracker.scanSoftDirtyPages();
+
     for (const auto &pair : mCoherentBufferTracker.mBuffers)
     {
         gl::BufferID id = {pair.first};
@@ -8032,6 +8196,7 @@ void FrameCaptureShared::maybeCapturePostCallUpdates(const gl::Context *context)
                         mCoherentBufferTracker.mBuffers[buffer->id().value];
                     cb->removeProtection(PageSharingType::NoneShared);
                     cb->updateShadowMemory();
+                    mCoherentBufferTracker.scanSoftDirtyPages();
                     cb->protectAll();
                 }
             }
@@ -8310,6 +8475,9 @@ void FrameCaptureShared::scanSetupCalls(std::vector<CallCapture> &setupCalls)
 
 void FrameCaptureShared::runMidExecutionCapture(gl::Context *mainContext)
 {
+    // The setup is written by this thread, after the frames of an earlier capture
+    mWriterThread.waitIdle();
+
     // Set the capture active to ensure all GLES commands issued by the next frame are
     // handled correctly by maybeCapturePreCallUpdates() and maybeCapturePostCallUpdates().
     setCaptureActive();
@@ -8460,6 +8628,8 @@ void FrameCaptureShared::onEndFrame(gl::Context *context)
 
     ASSERT(isCaptureActive());
 
+    mCoherentBufferTracker.onFrameCaptured();
+
     if (!mFrameCalls.empty())
     {
         mActiveFrameIndices.push_back(getReplayFrameIndex());
@@ -8481,7 +8651,13 @@ void FrameCaptureShared::onEndFrame(gl::Context *context)
 
     if (mFrameIndex == mCaptureEndFrame)
     {
-        // Write shared MEC after frame sequence so we can eliminate unused assets like programs
+        mWriterThread.waitIdle();
+        INFO() << "Capture stalled the app for " << mWriterThread.getWaitTimeSeconds() * 1000.0
+               << " ms waiting for frames to be written";
+
+        // Write shared MEC after frame sequence so we can eliminate unused assets like programs.
+        // Its binary data is read before the first frame.
+        mBinaryData.setCaptureFrameIndex(0);
         WriteShareGroupCppSetupReplay(mReplayWriter, mCompression, mOutDirectory, mCaptureLabel, 1,
                                       1, mShareGroupSetupCalls, &mResourceTracker, &mBinaryData,
                                       mSerializeStateEnabled, mWindowSurfaceContextID,
@@ -8888,6 +9064,8 @@ void FrameCaptureShared::writeJSON(const gl::Context *context)
 void FrameCaptureShared::writeCppReplayIndexFiles(const gl::Context *context,
                                                   bool writeResetContextCall)
 {
+    mWriterThread.waitIdle();
+
     // Ensure the last frame is written. This will no-op if the frame is already written.
     mReplayWriter.saveFrame();
 
@@ -9015,6 +9193,11 @@ void FrameCaptureShared::writeMainContextCppReplay(const gl::Context *context,
 {
     ASSERT(mWindowSurfaceContextID == context->id());
 
+    // The parts of the replay that depend on the state of the contexts are generated here, and
+    // the rest is written by mWriterThread, in the same order.
+    uint32_t frameCount = getFrameCount();
+    uint32_t frameIndex = getReplayFrameIndex();
+
     {
         std::stringstream header;
 
@@ -9022,11 +9205,13 @@ void FrameCaptureShared::writeMainContextCppReplay(const gl::Context *context,
         header << "#include \"angle_trace_gl.h\"\n";
 
         std::string headerString = header.str();
-        mReplayWriter.setSourcePrologue(headerString);
-    }
+        mWriterThread.post([this, headerString, frameIndex]() {
+            mReplayWriter.setSourcePrologue(headerString);
 
-    uint32_t frameCount = getFrameCount();
-    uint32_t frameIndex = getReplayFrameIndex();
+            // The binary data written below is read when replaying this frame
+            mBinaryData.setCaptureFrameIndex(frameIndex);
+        });
+    }
 
     if (frameIndex == 1)
     {
@@ -9106,13 +9291,20 @@ void FrameCaptureShared::writeMainContextCppReplay(const gl::Context *context,
 
             out << "}\n";
 
-            mReplayWriter.addPublicFunction(proto, std::stringstream(), out);
+            std::string body = out.str();
+            mWriterThread.post([this, proto, body]() {
+                mReplayWriter.addPublicFunction(proto, std::stringstream(),
+                                                std::stringstream(body));
+            });
         }
     }
 
     // Emit code to reset back to starting state
     if (frameIndex == frameCount)
     {
+        // Reset is generated from the state of the contexts, after the frames before it
+        mWriterThread.waitIdle();
+
         std::stringstream resetProtoStream;
         std::stringstream resetHeaderStream;
         std::stringstream resetBodyStream;
@@ -9250,24 +9442,33 @@ void FrameCaptureShared::writeMainContextCppReplay(const gl::Context *context,
         protoStream << "void "
                     << FmtReplayFunction(context->id(), FuncUsage::Prototype, frameIndex);
         std::string proto = protoStream.str();
-        std::stringstream headerStream;
-        std::stringstream bodyStream;
 
-        if (context->getShareGroup()->getContexts().size() > 1)
-        {
-            // Only ReplayFunc::Replay trace file output functions are affected by multi-context
-            // call grouping so they can safely be special-cased here.
-            WriteCppReplayFunctionWithPartsMultiContext(
-                context->id(), ReplayFunc::Replay, mReplayWriter, frameIndex, &mBinaryData,
-                mFrameCalls, headerStream, bodyStream, &mResourceIDBufferSize);
-        }
-        else
-        {
-            WriteCppReplayFunctionWithParts(context->id(), ReplayFunc::Replay, mReplayWriter,
-                                            frameIndex, &mBinaryData, mFrameCalls, headerStream,
-                                            bodyStream, &mResourceIDBufferSize);
-        }
-        mReplayWriter.addPrivateFunction(proto, headerStream, bodyStream);
+        // The calls hold copies of their data, so they are written without the app's state
+        gl::ContextID contextID = context->id();
+        bool isMultiContext     = context->getShareGroup()->getContexts().size() > 1;
+        auto frameCalls = std::make_shared<std::vector<CallCapture>>(std::move(mFrameCalls));
+        mFrameCalls.clear();
+
+        mWriterThread.post([this, proto, contextID, isMultiContext, frameIndex, frameCalls]() {
+            std::stringstream headerStream;
+            std::stringstream bodyStream;
+
+            if (isMultiContext)
+            {
+                // Only ReplayFunc::Replay trace file output functions are affected by
+                // multi-context call grouping so they can safely be special-cased here.
+                WriteCppReplayFunctionWithPartsMultiContext(
+                    contextID, ReplayFunc::Replay, mReplayWriter, frameIndex, &mBinaryData,
+                    *frameCalls, headerStream, bodyStream, &mResourceIDBufferSize);
+            }
+            else
+            {
+                WriteCppReplayFunctionWithParts(contextID, ReplayFunc::Replay, mReplayWriter,
+                                                frameIndex, &mBinaryData, *frameCalls,
+                                                headerStream, bodyStream, &mResourceIDBufferSize);
+            }
+            mReplayWriter.addPrivateFunction(proto, headerStream, bodyStream);
+        });
     }
 
     if (mSerializeStateEnabled)
@@ -9288,26 +9489,31 @@ void FrameCaptureShared::writeMainContextCppReplay(const gl::Context *context,
             bodyStream << "    return " << FmtMultiLineString(serializedContextString) << ";\n";
             bodyStream << "}\n";
 
-            mReplayWriter.addPrivateFunction(proto, std::stringstream(), bodyStream);
+            std::string body = bodyStream.str();
+            mWriterThread.post([this, proto, body]() {
+                mReplayWriter.addPrivateFunction(proto, std::stringstream(),
+                                                 std::stringstream(body));
+            });
         }
     }
 
-    {
-        std::stringstream fnamePatternStream;
-        fnamePatternStream << mOutDirectory << FmtCapturePrefix(context->id(), mCaptureLabel);
-        std::string fnamePattern = fnamePatternStream.str();
+    std::stringstream fnamePatternStream;
+    fnamePatternStream << mOutDirectory << FmtCapturePrefix(context->id(), mCaptureLabel);
+    std::string fnamePattern = fnamePatternStream.str();
+    bool isLastFrame         = mFrameIndex == mCaptureEndFrame;
 
+    mWriterThread.post([this, fnamePattern, isLastFrame]() {
         mReplayWriter.setFilenamePattern(fnamePattern);
-    }
 
-    if (mFrameIndex == mCaptureEndFrame)
-    {
-        mReplayWriter.saveFrame();
-    }
-    else
-    {
-        mReplayWriter.saveFrameIfFull();
-    }
+        if (isLastFrame)
+        {
+            mReplayWriter.saveFrame();
+        }
+        else
+        {
+            mReplayWriter.saveFrameIfFull();
+        }
+    });
 }
 
 const std::string &FrameCaptureShared::getShaderSource(gl::ShaderProgramID id) const
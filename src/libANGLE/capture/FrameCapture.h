@@ -14,7 +14,12 @@
 #    pragma allow_unsafe_buffers
 #endif
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include "sys/stat.h"
 
 #include "common/PackedEnums.h"
@@ -172,6 +177,38 @@ class ReplayWriter final : angle::NonCopyable
     std::vector<std::string> mWrittenFiles;
 };
 
+// Runs the parts of writing the replay that don't need the app's state, like formatting the calls
+// of a frame and storing their binary data, in order on a thread.  The app's thread only takes a
+// snapshot of what they need.
+class CaptureWriterThread final : angle::NonCopyable
+{
+  public:
+    CaptureWriterThread();
+    ~CaptureWriterThread();
+
+    void setEnabled(bool enabled) { mEnabled = enabled; }
+
+    // Runs |task| on the thread, or right away if the thread isn't enabled.
+    void post(std::function<void()> &&task);
+    // Waits until the tasks posted so far have completed.
+    void waitIdle();
+
+    // Time the app's thread waited for the writer thread to catch up.
+    double getWaitTimeSeconds() const { return mWaitTimeSeconds; }
+
+  private:
+    void threadLoop();
+
+    bool mEnabled;
+    std::thread mThread;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<std::function<void()>> mTasks;
+    bool mBusy;
+    bool mExit;
+    double mWaitTimeSeconds;
+};
+
 using BufferCalls = std::map<GLuint, std::vector<CallCapture>>;
 
 // true means mapped, false means unmapped
@@ -639,7 +676,11 @@ enum class PageSharingType
 class CoherentBuffer
 {
   public:
-    CoherentBuffer(uintptr_t start, size_t size, size_t pageSize, bool useShadowMemory);
+    CoherentBuffer(uintptr_t start,
+                   size_t size,
+                   size_t pageSize,
+                   bool useShadowMemory,
+                   bool useSoftDirty);
     ~CoherentBuffer();
 
     // Sets the a range in the buffer clean and protects a selected range
@@ -658,6 +699,10 @@ class CoherentBuffer
     // Removes protection
     void removeProtection(PageSharingType sharingType);
 
+    // Sets the pages the kernel reports as written since soft-dirty bits were last cleared dirty.
+    // Returns the number of clean pages set dirty.
+    size_t collectSoftDirtyPages(std::vector<bool> *softDirtyPages);
+
     bool contains(size_t page, size_t *relativePage);
     bool isDirty();
 
@@ -693,11 +738,16 @@ class CoherentBuffer
     uintptr_t mBufferStart;
     void *mShadowMemory;
     bool mShadowDirty;
+
+    // Pages are not protected when writes are found through soft-dirty bits
+    bool mSoftDirtyEnabled;
 };
 
 class CoherentBufferTracker final : angle::NonCopyable
 {
   public:
+    static constexpr size_t kMaxRecapturedSoftDirtyPages = 32;
+
     CoherentBufferTracker();
     ~CoherentBufferTracker();
 
@@ -715,6 +765,18 @@ class CoherentBufferTracker final : angle::NonCopyable
     // Determine whether memory protection can be used directly on graphics memory
     bool canProtectDirectly(gl::Context *context);
 
+    // On Linux, writes can be found by scanning the soft-dirty bits of the tracked pages instead of
+    // catching a page fault on the first write to each of them.  Used if the tracked memory
+    // supports it, unless disabled.
+    void disableSoftDirty() { mSoftDirtyAllowed = false; }
+    void determineSoftDirtySupport(gl::Context *context);
+    bool isSoftDirtyEnabled() const { return mSoftDirtyEnabled; }
+    // Sets the pages written since the last scan dirty.  The soft-dirty bits are cleared right
+    // away if more pages than kMaxRecapturedSoftDirtyPages were set dirty.
+    void scanSoftDirtyPages();
+    // Clears the soft-dirty bits, which is deferred to the end of each captured frame
+    void onFrameCaptured();
+
   private:
     // Detect overlapping pages when removing protection
     PageSharingType doesBufferSharePage(gl::BufferID id);
@@ -723,6 +785,7 @@ class CoherentBufferTracker final : angle::NonCopyable
     // For addresses that are in a page shared by 2 buffers, 2 results are returned.
     HashMap<std::shared_ptr<CoherentBuffer>, size_t> getBufferPagesForAddress(uintptr_t address);
     PageFaultHandlerRangeType handleWrite(uintptr_t address);
+    void clearSoftDirtyPages();
 
   public:
     angle::SimpleMutex mMutex;
@@ -736,6 +799,10 @@ class CoherentBufferTracker final : angle::NonCopyable
     size_t mPageSize;
 
     bool mShadowMemoryEnabled;
+
+    bool mSoftDirtyAllowed;
+    bool mSoftDirtyEnabled;
+    std::vector<bool> mSoftDirtyPages;
 };
 
 // Shared class for any items that need to be tracked by FrameCapture across shared contexts
@@ -1115,6 +1182,10 @@ class FrameCaptureShared final : angle::NonCopyable
     ResourceTracker mResourceTracker;
     ReplayWriter mReplayWriter;
 
+    // Writes the frames, using mReplayWriter and mBinaryData.  The app's thread waits for it to be
+    // idle before it uses them itself.  Declared after them, so it stops before they are destroyed.
+    CaptureWriterThread mWriterThread;
+
     // If you don't know which frame you want to start capturing at, use the capture trigger.
     // Initialize it to the number of frames you want to capture, and then clear the value to 0 when
     // you reach the content you want to capture. Currently only available on Android.
@@ -1519,12 +1590,15 @@ constexpr char kTriggerVarName[]        = "ANGLE_CAPTURE_TRIGGER";
 constexpr char kEndCaptureVarName[]     = "ANGLE_CAPTURE_END_CAPTURE";
 constexpr char kCaptureLabelVarName[]   = "ANGLE_CAPTURE_LABEL";
 constexpr char kCompressionVarName[]    = "ANGLE_CAPTURE_COMPRESSION";
+constexpr char kDeduplicationVarName[]  = "ANGLE_CAPTURE_DEDUPLICATION";
+constexpr char kAsyncWriteVarName[]     = "ANGLE_CAPTURE_ASYNC_WRITE";
 constexpr char kSerializeStateVarName[] = "ANGLE_CAPTURE_SERIALIZE_STATE";
 constexpr char kValidationVarName[]     = "ANGLE_CAPTURE_VALIDATION";
 constexpr char kValidationExprVarName[] = "ANGLE_CAPTURE_VALIDATION_EXPR";
 constexpr char kSourceExtVarName[]      = "ANGLE_CAPTURE_SOURCE_EXT";
 constexpr char kSourceSizeVarName[]     = "ANGLE_CAPTURE_SOURCE_SIZE";
 constexpr char kForceShadowVarName[]    = "ANGLE_CAPTURE_FORCE_SHADOW";
+constexpr char kSoftDirtyVarName[]      = "ANGLE_CAPTURE_SOFT_DIRTY";
 
 constexpr size_t kFunctionSizeLimit = 5000;
 
@@ -1546,11 +1620,14 @@ constexpr char kAndroidTrigger[]        = "debug.angle.capture.trigger";
 constexpr char kAndroidEndCapture[]     = "debug.angle.capture.end_capture";
 constexpr char kAndroidCaptureLabel[]   = "debug.angle.capture.label";
 constexpr char kAndroidCompression[]    = "debug.angle.capture.compression";
+constexpr char kAndroidDeduplication[]  = "debug.angle.capture.deduplication";
+constexpr char kAndroidAsyncWrite[]     = "debug.angle.capture.async_write";
 constexpr char kAndroidValidation[]     = "debug.angle.capture.validation";
 constexpr char kAndroidValidationExpr[] = "debug.angle.capture.validation_expr";
 constexpr char kAndroidSourceExt[]      = "debug.angle.capture.source_ext";
 constexpr char kAndroidSourceSize[]     = "debug.angle.capture.source_size";
 constexpr char kAndroidForceShadow[]    = "debug.angle.capture.force_shadow";
+constexpr char kAndroidSoftDirty[]      = "debug.angle.capture.soft_dirty";
 
 void WriteCppReplayForCall(const CallCapture &call,
                            ReplayWriter &replayWriter,
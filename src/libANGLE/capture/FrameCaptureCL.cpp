@@ -3254,6 +3254,8 @@ void FrameCaptureShared::writeCppReplayIndexFilesCL()
     std::string protoSetup = protoSetupStream.str();
     std::stringstream headerStreamSetup;
     std::stringstream bodyStreamSetup;
+    // The setup is written after the frames, but its binary data is read before them
+    mBinaryData.setCaptureFrameIndex(0);
     WriteCppReplayFunctionWithPartsCL(ReplayFunc::SetupFirstFrame, mReplayWriter,
                                       mCaptureStartFrame, &mBinaryData, mCLSetupCalls,
                                       headerStreamSetup, bodyStreamSetup);
@@ -3326,6 +3328,7 @@ void FrameCaptureShared::writeMainContextCppReplayCL()
         std::stringstream headerStream;
         std::stringstream bodyStream;
 
+        mBinaryData.setCaptureFrameIndex(mFrameIndex);
         WriteCppReplayFunctionWithPartsCL(ReplayFunc::Replay, mReplayWriter, mFrameIndex,
                                           &mBinaryData, mFrameCalls, headerStream, bodyStream);
 
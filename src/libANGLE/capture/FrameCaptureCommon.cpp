@@ -520,6 +520,30 @@ FrameCaptureShared::FrameCaptureShared()
     {
         mCompression = false;
     }
+
+    std::string deduplicationFromEnv =
+        GetEnvironmentVarOrUnCachedAndroidProperty(kDeduplicationVarName, kAndroidDeduplication);
+    if (deduplicationFromEnv == "0")
+    {
+        mBinaryData.setDeduplication(FrameCaptureBinaryData::Deduplication::Disabled);
+    }
+    else if (deduplicationFromEnv == "rolling")
+    {
+        mBinaryData.setDeduplication(FrameCaptureBinaryData::Deduplication::Rolling);
+    }
+    else if (!deduplicationFromEnv.empty() && deduplicationFromEnv != "1")
+    {
+        WARN() << "Invalid capture deduplication: " << deduplicationFromEnv;
+    }
+
+    std::string asyncWriteFromEnv =
+        GetEnvironmentVarOrUnCachedAndroidProperty(kAsyncWriteVarName, kAndroidAsyncWrite);
+    if (asyncWriteFromEnv == "0")
+    {
+        mWriterThread.setEnabled(false);
+        mBinaryData.setAsyncStore(false);
+    }
+
     std::string serializeStateFromEnv = angle::GetEnvironmentVar(kSerializeStateVarName);
     if (serializeStateFromEnv == "1")
     {
@@ -579,6 +603,14 @@ FrameCaptureShared::FrameCaptureShared()
         mCoherentBufferTracker.enableShadowMemory();
     }
 
+    std::string softDirtyFromEnv =
+        GetEnvironmentVarOrUnCachedAndroidProperty(kSoftDirtyVarName, kAndroidSoftDirty);
+    if (softDirtyFromEnv == "0")
+    {
+        INFO() << "Using the page fault handler for coherent buffer tracking.";
+        mCoherentBufferTracker.disableSoftDirty();
+    }
+
     if (mFrameIndex == mCaptureStartFrame)
     {
         // Capture is starting from the first frame, so set the capture active to ensure all GLES
@@ -1123,6 +1155,95 @@ std::vector<std::string> ReplayWriter::getAndResetWrittenFiles()
     return results;
 }
 
+// CaptureWriterThread implementation.
+CaptureWriterThread::CaptureWriterThread()
+    : mEnabled(true), mBusy(false), mExit(false), mWaitTimeSeconds(0.0)
+{}
+
+CaptureWriterThread::~CaptureWriterThread()
+{
+    if (!mThread.joinable())
+    {
+        return;
+    }
+
+    // The thread runs the tasks left in the queue before it exits
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExit = true;
+    }
+    mCondition.notify_all();
+    mThread.join();
+}
+
+void CaptureWriterThread::post(std::function<void()> &&task)
+{
+    if (!mEnabled)
+    {
+        task();
+        return;
+    }
+
+    if (!mThread.joinable())
+    {
+        mThread = std::thread(&CaptureWriterThread::threadLoop, this);
+    }
+
+    // Limit the frames waiting to be written, since they hold all of their calls' data
+    constexpr size_t kMaxPendingTasks = 16;
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    if (mTasks.size() >= kMaxPendingTasks)
+    {
+        double startTime = GetCurrentSystemTime();
+        mCondition.wait(lock, [this] { return mTasks.size() < kMaxPendingTasks; });
+        mWaitTimeSeconds += GetCurrentSystemTime() - startTime;
+    }
+    mTasks.push_back(std::move(task));
+    mCondition.notify_all();
+}
+
+void CaptureWriterThread::waitIdle()
+{
+    if (!mThread.joinable())
+    {
+        return;
+    }
+
+    double startTime = GetCurrentSystemTime();
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this] { return mTasks.empty() && !mBusy; });
+    mWaitTimeSeconds += GetCurrentSystemTime() - startTime;
+}
+
+void CaptureWriterThread::threadLoop()
+{
+    SetCurrentThreadName("ANGLE-Capture");
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mCondition.wait(lock, [this] { return mExit || !mTasks.empty(); });
+        if (mTasks.empty())
+        {
+            return;
+        }
+
+        std::function<void()> task = std::move(mTasks.front());
+        mTasks.pop_front();
+        mBusy = true;
+        mCondition.notify_all();
+        lock.unlock();
+
+        task();
+        task = nullptr;
+
+        lock.lock();
+        mBusy = false;
+        mCondition.notify_all();
+    }
+}
+
 void AddComment(std::vector<CallCapture> *outCalls, const std::string &comment)
 {
     ParamBuffer commentParamBuffer;
@@ -1187,7 +1308,11 @@ StateResetHelper::StateResetHelper() = default;
 StateResetHelper::~StateResetHelper() = default;
 
 CoherentBufferTracker::CoherentBufferTracker()
-    : mEnabled(false), mHasBeenReset(false), mShadowMemoryEnabled(false)
+    : mEnabled(false),
+      mHasBeenReset(false),
+      mShadowMemoryEnabled(false),
+      mSoftDirtyAllowed(true),
+      mSoftDirtyEnabled(false)
 {
     mPageSize = GetPageSize();
 }
@@ -1204,7 +1329,7 @@ void CoherentBufferTracker::disable()
         return;
     }
 
-    if (mPageFaultHandler->disable())
+    if (mSoftDirtyEnabled || mPageFaultHandler->disable())
     {
         mEnabled = false;
     }
@@ -36,6 +36,10 @@ StringCounters::StringCounters() {}
 StringCounters::~StringCounters() {}
 ReplayWriter::ReplayWriter() {}
 ReplayWriter::~ReplayWriter() {}
+FrameCaptureBinaryData::FrameCaptureBinaryData() {}
+FrameCaptureBinaryData::~FrameCaptureBinaryData() {}
+CaptureWriterThread::CaptureWriterThread() {}
+CaptureWriterThread::~CaptureWriterThread() {}
 
 FrameCapture::FrameCapture() {}
 FrameCapture::~FrameCapture() {}
@@ -17,6 +17,7 @@
 #include "common/mathutil.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/EntryPointProfiler.h"
 
 namespace gl
 {
@@ -15,7 +15,10 @@
 namespace rx
 {
 ContextImpl::ContextImpl(const gl::State &state, gl::ErrorSet *errorSet)
-    : mState(state), mMemoryProgramCache(nullptr), mErrors(errorSet)
+    : mState(state),
+      mMemoryProgramCache(nullptr),
+      mMemoryTranscodeCache(nullptr),
+      mErrors(errorSet)
 {}
 
 ContextImpl::~ContextImpl() {}
@@ -59,6 +62,11 @@ void ContextImpl::setMemoryProgramCache(gl::MemoryProgramCache *memoryProgramCac
     mMemoryProgramCache = memoryProgramCache;
 }
 
+void ContextImpl::setMemoryTranscodeCache(gl::MemoryTranscodeCache *memoryTranscodeCache)
+{
+    mMemoryTranscodeCache = memoryTranscodeCache;
+}
+
 void ContextImpl::handleError(GLenum errorCode,
                               const char *message,
                               const char *file,
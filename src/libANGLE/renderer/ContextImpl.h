@@ -20,6 +20,7 @@ namespace gl
 {
 class ErrorSet;
 class MemoryProgramCache;
+class MemoryTranscodeCache;
 class Path;
 class PixelLocalStoragePlane;
 class Semaphore;
@@ -257,6 +258,10 @@ class ContextImpl : public GLImplFactory
     // on draw calls we can store the refreshed shaders in the cache.
     void setMemoryProgramCache(gl::MemoryProgramCache *memoryProgramCache);
 
+    // Compressed textures the backend transcodes on the CPU may be found in this cache.
+    void setMemoryTranscodeCache(gl::MemoryTranscodeCache *memoryTranscodeCache);
+    gl::MemoryTranscodeCache *getMemoryTranscodeCache() const { return mMemoryTranscodeCache; }
+
     void handleError(GLenum errorCode,
                      const char *message,
                      const char *file,
@@ -282,9 +287,13 @@ class ContextImpl : public GLImplFactory
     // AMD_performance_monitor
     virtual const angle::PerfMonitorCounterGroups &getPerfMonitorCounters();
 
+    // Called before a surface the context renders to is swapped, at the end of a frame.
+    virtual void onPreSwap() {}
+
   protected:
     const gl::State &mState;
     gl::MemoryProgramCache *mMemoryProgramCache;
+    gl::MemoryTranscodeCache *mMemoryTranscodeCache;
     gl::ErrorSet *mErrors;
 };
 
@@ -54,6 +54,9 @@ class ShaderTranslateTask
 
     // Used by the GL backend to query whether the driver is compiling in parallel internally.
     virtual bool isCompilingInternally() { return false; }
+    // Used by the GL backend to link programs without waiting for the internal compilation to
+    // finish.  The driver fails the link if the compilation fails.
+    virtual bool canLinkWhileCompilingInternally() { return false; }
     // Used by the GL backend to finish internal compilation and return results.
     virtual angle::Result getResult(std::string &infoLog) { return angle::Result::Continue; }
 };
@@ -0,0 +1,477 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyvertex.cpp: Vectorized kernels for the vertex conversion functions of copyvertex.inc.h.
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include "libANGLE/renderer/copyvertex.h"
+
+#include <algorithm>
+#include <limits>
+
+// The kernels are only vectorized where the instructions are part of the baseline of the target,
+// so no runtime check is necessary.  The NEON kernels divide, which needs ARM64.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ANGLE_COPYVERTEX_USE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_COPYVERTEX_USE_NEON
+#endif
+
+namespace rx
+{
+namespace priv
+{
+namespace
+{
+// The scalar conversions, which also convert the components left over by the SIMD loops, and give
+// the same results as the SIMD ones.  The divisions are kept, rather than multiplications by the
+// reciprocal, so the results are the same as they have always been.
+template <typename T>
+float ComponentToFloat(T value, bool normalized)
+{
+    using NL = std::numeric_limits<T>;
+
+    const float result = static_cast<float>(value);
+    if (!normalized)
+    {
+        return result;
+    }
+
+    const float normalizedResult = result / static_cast<float>(NL::max());
+    return NL::is_signed && normalizedResult < -1.0f ? -1.0f : normalizedResult;
+}
+
+int16_t Snorm8ToSnorm16(int8_t value)
+{
+    // The original GLbyte value ranges from -128 to +127 (INT8_MAX).  When converted to GLshort,
+    // the value must be scaled to between -32768 and +32767 (INT16_MAX).
+    if (value > 0)
+    {
+        return static_cast<int16_t>(value << 8 | value << 1 | ((value & 0x40) >> 6));
+    }
+    return static_cast<int16_t>(value * 256);
+}
+
+template <bool isSigned, bool normalized>
+void XYZ10W2ToFloat(uint32_t packedValue, float *output)
+{
+    for (size_t component = 0; component < 3; ++component)
+    {
+        const uint32_t bits = (packedValue >> (component * 10)) & 0x3FF;
+        float value         = static_cast<float>(bits);
+        if (isSigned)
+        {
+            // Sign-extend the 10 bits.
+            value = static_cast<float>(static_cast<int32_t>(bits << 22) >> 22);
+            if (normalized)
+            {
+                // The most negative value is clamped, so -1 and 1 are equally far from 0.
+                value = std::max(value, -511.0f);
+                value = (value + 511.0f) / 511.0f - 1.0f;
+            }
+        }
+        else if (normalized)
+        {
+            value /= 1023.0f;
+        }
+        output[component] = value;
+    }
+
+    const uint32_t alphaBits = packedValue >> 30;
+    float alpha              = static_cast<float>(alphaBits);
+    if (isSigned)
+    {
+        alpha = static_cast<float>(static_cast<int32_t>(packedValue) >> 30);
+        if (normalized)
+        {
+            alpha = std::max(alpha, -1.0f);
+        }
+    }
+    else if (normalized)
+    {
+        alpha /= 3.0f;
+    }
+    output[3] = alpha;
+}
+
+#if defined(ANGLE_COPYVERTEX_USE_SSE2)
+// Loads 8 components and converts them to floats, in two vectors of 4.
+inline void LoadFloats8(const int8_t *input, __m128 *low, __m128 *high)
+{
+    const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input));
+    const __m128i words = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+    *low                = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16));
+    *high               = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(words, words), 16));
+}
+
+inline void LoadFloats8(const uint8_t *input, __m128 *low, __m128 *high)
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input));
+    const __m128i words = _mm_unpacklo_epi8(bytes, zero);
+    *low                = _mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero));
+    *high               = _mm_cvtepi32_ps(_mm_unpackhi_epi16(words, zero));
+}
+
+inline void LoadFloats8(const int16_t *input, __m128 *low, __m128 *high)
+{
+    const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input));
+    *low                = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16));
+    *high               = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(words, words), 16));
+}
+
+inline void LoadFloats8(const uint16_t *input, __m128 *low, __m128 *high)
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input));
+    *low                = _mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero));
+    *high               = _mm_cvtepi32_ps(_mm_unpackhi_epi16(words, zero));
+}
+
+template <typename T>
+size_t ComponentsToFloatSIMD(const T *input, float *output, size_t count, bool normalized)
+{
+    using NL = std::numeric_limits<T>;
+
+    const __m128 maxValue = _mm_set1_ps(static_cast<float>(NL::max()));
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+
+    size_t index = 0;
+    for (; index + 8 <= count; index += 8)
+    {
+        __m128 low, high;
+        LoadFloats8(input + index, &low, &high);
+        if (normalized)
+        {
+            low  = _mm_div_ps(low, maxValue);
+            high = _mm_div_ps(high, maxValue);
+            if (NL::is_signed)
+            {
+                low  = _mm_max_ps(low, minusOne);
+                high = _mm_max_ps(high, minusOne);
+            }
+        }
+        _mm_storeu_ps(output + index, low);
+        _mm_storeu_ps(output + index + 4, high);
+    }
+    return index;
+}
+
+size_t Snorm8ToSnorm16SIMD(const int8_t *input, int16_t *output, size_t count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bit6 = _mm_set1_epi16(0x40);
+
+    size_t index = 0;
+    for (; index + 8 <= count; index += 8)
+    {
+        const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input + index));
+        const __m128i words = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+
+        // Positive values also get their bits repeated in the low byte.
+        const __m128i repeated =
+            _mm_or_si128(_mm_slli_epi16(words, 1), _mm_srli_epi16(_mm_and_si128(words, bit6), 6));
+        const __m128i isPositive = _mm_cmpgt_epi16(words, zero);
+        const __m128i result =
+            _mm_or_si128(_mm_slli_epi16(words, 8), _mm_and_si128(isPositive, repeated));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + index), result);
+    }
+    return index;
+}
+
+template <bool isSigned, bool normalized>
+size_t XYZ10W2ToFloatSIMD(const uint32_t *input, float *output, size_t count)
+{
+    const __m128i componentMask = _mm_set1_epi32(0x3FF);
+
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4)
+    {
+        const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + index));
+
+        __m128i r, g, b, a;
+        if (isSigned)
+        {
+            r = _mm_srai_epi32(_mm_slli_epi32(packed, 22), 22);
+            g = _mm_srai_epi32(_mm_slli_epi32(packed, 12), 22);
+            b = _mm_srai_epi32(_mm_slli_epi32(packed, 2), 22);
+            a = _mm_srai_epi32(packed, 30);
+        }
+        else
+        {
+            r = _mm_and_si128(packed, componentMask);
+            g = _mm_and_si128(_mm_srli_epi32(packed, 10), componentMask);
+            b = _mm_and_si128(_mm_srli_epi32(packed, 20), componentMask);
+            a = _mm_srli_epi32(packed, 30);
+        }
+
+        __m128 rgba[4] = {_mm_cvtepi32_ps(r), _mm_cvtepi32_ps(g), _mm_cvtepi32_ps(b),
+                          _mm_cvtepi32_ps(a)};
+        if (normalized)
+        {
+            for (size_t component = 0; component < 3; ++component)
+            {
+                if (isSigned)
+                {
+                    const __m128 clamped = _mm_max_ps(rgba[component], _mm_set1_ps(-511.0f));
+                    rgba[component] = _mm_sub_ps(
+                        _mm_div_ps(_mm_add_ps(clamped, _mm_set1_ps(511.0f)), _mm_set1_ps(511.0f)),
+                        _mm_set1_ps(1.0f));
+                }
+                else
+                {
+                    rgba[component] = _mm_div_ps(rgba[component], _mm_set1_ps(1023.0f));
+                }
+            }
+            rgba[3] = isSigned ? _mm_max_ps(rgba[3], _mm_set1_ps(-1.0f))
+                               : _mm_div_ps(rgba[3], _mm_set1_ps(3.0f));
+        }
+
+        _MM_TRANSPOSE4_PS(rgba[0], rgba[1], rgba[2], rgba[3]);
+        for (size_t element = 0; element < 4; ++element)
+        {
+            _mm_storeu_ps(output + (index + element) * 4, rgba[element]);
+        }
+    }
+    return index;
+}
+#elif defined(ANGLE_COPYVERTEX_USE_NEON)
+// Loads 8 components and converts them to floats, in two vectors of 4.
+inline void LoadFloats8(const int8_t *input, float32x4_t *low, float32x4_t *high)
+{
+    const int16x8_t words = vmovl_s8(vld1_s8(input));
+    *low                  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(words)));
+    *high                 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(words)));
+}
+
+inline void LoadFloats8(const uint8_t *input, float32x4_t *low, float32x4_t *high)
+{
+    const uint16x8_t words = vmovl_u8(vld1_u8(input));
+    *low                   = vcvtq_f32_u32(vmovl_u16(vget_low_u16(words)));
+    *high                  = vcvtq_f32_u32(vmovl_u16(vget_high_u16(words)));
+}
+
+inline void LoadFloats8(const int16_t *input, float32x4_t *low, float32x4_t *high)
+{
+    const int16x8_t words = vld1q_s16(input);
+    *low                  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(words)));
+    *high                 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(words)));
+}
+
+inline void LoadFloats8(const uint16_t *input, float32x4_t *low, float32x4_t *high)
+{
+    const uint16x8_t words = vld1q_u16(input);
+    *low                   = vcvtq_f32_u32(vmovl_u16(vget_low_u16(words)));
+    *high                  = vcvtq_f32_u32(vmovl_u16(vget_high_u16(words)));
+}
+
+template <typename T>
+size_t ComponentsToFloatSIMD(const T *input, float *output, size_t count, bool normalized)
+{
+    using NL = std::numeric_limits<T>;
+
+    const float32x4_t maxValue = vdupq_n_f32(static_cast<float>(NL::max()));
+    const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+
+    size_t index = 0;
+    for (; index + 8 <= count; index += 8)
+    {
+        float32x4_t low, high;
+        LoadFloats8(input + index, &low, &high);
+        if (normalized)
+        {
+            low  = vdivq_f32(low, maxValue);
+            high = vdivq_f32(high, maxValue);
+            if (NL::is_signed)
+            {
+                low  = vmaxq_f32(low, minusOne);
+                high = vmaxq_f32(high, minusOne);
+            }
+        }
+        vst1q_f32(output + index, low);
+        vst1q_f32(output + index + 4, high);
+    }
+    return index;
+}
+
+size_t Snorm8ToSnorm16SIMD(const int8_t *input, int16_t *output, size_t count)
+{
+    const int16x8_t bit6 = vdupq_n_s16(0x40);
+
+    size_t index = 0;
+    for (; index + 8 <= count; index += 8)
+    {
+        const int16x8_t words = vmovl_s8(vld1_s8(input + index));
+
+        // Positive values also get their bits repeated in the low byte.
+        const int16x8_t repeated =
+            vorrq_s16(vshlq_n_s16(words, 1), vshrq_n_s16(vandq_s16(words, bit6), 6));
+        const uint16x8_t isPositive = vcgtq_s16(words, vdupq_n_s16(0));
+        const int16x8_t result      = vorrq_s16(
+            vshlq_n_s16(words, 8), vandq_s16(vreinterpretq_s16_u16(isPositive), repeated));
+
+        vst1q_s16(output + index, result);
+    }
+    return index;
+}
+
+template <bool isSigned, bool normalized>
+size_t XYZ10W2ToFloatSIMD(const uint32_t *input, float *output, size_t count)
+{
+    const uint32x4_t componentMask = vdupq_n_u32(0x3FF);
+
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4)
+    {
+        const uint32x4_t packed = vld1q_u32(input + index);
+
+        float32x4x4_t rgba;
+        if (isSigned)
+        {
+            const int32x4_t packedSigned = vreinterpretq_s32_u32(packed);
+            rgba.val[0] = vcvtq_f32_s32(vshrq_n_s32(vshlq_n_s32(packedSigned, 22), 22));
+            rgba.val[1] = vcvtq_f32_s32(vshrq_n_s32(vshlq_n_s32(packedSigned, 12), 22));
+            rgba.val[2] = vcvtq_f32_s32(vshrq_n_s32(vshlq_n_s32(packedSigned, 2), 22));
+            rgba.val[3] = vcvtq_f32_s32(vshrq_n_s32(packedSigned, 30));
+        }
+        else
+        {
+            rgba.val[0] = vcvtq_f32_u32(vandq_u32(packed, componentMask));
+            rgba.val[1] = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 10), componentMask));
+            rgba.val[2] = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 20), componentMask));
+            rgba.val[3] = vcvtq_f32_u32(vshrq_n_u32(packed, 30));
+        }
+
+        if (normalized)
+        {
+            for (size_t component = 0; component < 3; ++component)
+            {
+                if (isSigned)
+                {
+                    const float32x4_t clamped =
+                        vmaxq_f32(rgba.val[component], vdupq_n_f32(-511.0f));
+                    rgba.val[component] = vsubq_f32(
+                        vdivq_f32(vaddq_f32(clamped, vdupq_n_f32(511.0f)), vdupq_n_f32(511.0f)),
+                        vdupq_n_f32(1.0f));
+                }
+                else
+                {
+                    rgba.val[component] = vdivq_f32(rgba.val[component], vdupq_n_f32(1023.0f));
+                }
+            }
+            rgba.val[3] = isSigned ? vmaxq_f32(rgba.val[3], vdupq_n_f32(-1.0f))
+                                   : vdivq_f32(rgba.val[3], vdupq_n_f32(3.0f));
+        }
+
+        vst4q_f32(output + index * 4, rgba);
+    }
+    return index;
+}
+#else
+template <typename T>
+size_t ComponentsToFloatSIMD(const T *input, float *output, size_t count, bool normalized)
+{
+    return 0;
+}
+
+size_t Snorm8ToSnorm16SIMD(const int8_t *input, int16_t *output, size_t count)
+{
+    return 0;
+}
+
+template <bool isSigned, bool normalized>
+size_t XYZ10W2ToFloatSIMD(const uint32_t *input, float *output, size_t count)
+{
+    return 0;
+}
+#endif
+
+template <typename T>
+void ComponentsToFloat(const T *input, float *output, size_t count, bool normalized)
+{
+    for (size_t index = ComponentsToFloatSIMD(input, output, count, normalized); index < count;
+         ++index)
+    {
+        output[index] = ComponentToFloat(input[index], normalized);
+    }
+}
+
+template <bool isSigned, bool normalized>
+void XYZ10W2ToFloatArray(const uint32_t *input, float *output, size_t count)
+{
+    for (size_t index = XYZ10W2ToFloatSIMD<isSigned, normalized>(input, output, count);
+         index < count; ++index)
+    {
+        XYZ10W2ToFloat<isSigned, normalized>(input[index], output + index * 4);
+    }
+}
+}  // anonymous namespace
+
+void ConvertVertexComponentsToFloat(const int8_t *input,
+                                    float *output,
+                                    size_t count,
+                                    bool normalized)
+{
+    ComponentsToFloat(input, output, count, normalized);
+}
+
+void ConvertVertexComponentsToFloat(const uint8_t *input,
+                                    float *output,
+                                    size_t count,
+                                    bool normalized)
+{
+    ComponentsToFloat(input, output, count, normalized);
+}
+
+void ConvertVertexComponentsToFloat(const int16_t *input,
+                                    float *output,
+                                    size_t count,
+                                    bool normalized)
+{
+    ComponentsToFloat(input, output, count, normalized);
+}
+
+void ConvertVertexComponentsToFloat(const uint16_t *input,
+                                    float *output,
+                                    size_t count,
+                                    bool normalized)
+{
+    ComponentsToFloat(input, output, count, normalized);
+}
+
+void ConvertSnorm8ToSnorm16(const int8_t *input, int16_t *output, size_t count)
+{
+    for (size_t index = Snorm8ToSnorm16SIMD(input, output, count); index < count; ++index)
+    {
+        output[index] = Snorm8ToSnorm16(input[index]);
+    }
+}
+
+void ConvertXYZ10W2ToFloat(const uint32_t *input,
+                           float *output,
+                           size_t count,
+                           bool isSigned,
+                           bool normalized)
+{
+    if (isSigned)
+    {
+        normalized ? XYZ10W2ToFloatArray<true, true>(input, output, count)
+                   : XYZ10W2ToFloatArray<true, false>(input, output, count);
+    }
+    else
+    {
+        normalized ? XYZ10W2ToFloatArray<false, true>(input, output, count)
+                   : XYZ10W2ToFloatArray<false, false>(input, output, count);
+    }
+}
+}  // namespace priv
+}  // namespace rx
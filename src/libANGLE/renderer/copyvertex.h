@@ -9,6 +9,8 @@
 #ifndef LIBANGLE_RENDERER_COPYVERTEX_H_
 #define LIBANGLE_RENDERER_COPYVERTEX_H_
 
+#include "angle_gl.h"
+#include "common/float16_utils.h"
 #include "common/mathutil.h"
 
 namespace rx
@@ -19,6 +21,37 @@ using VertexCopyFunction = void (*)(const uint8_t *input,
                                     size_t count,
                                     uint8_t *output);
 
+namespace priv
+{
+// Vectorized conversions of tightly packed components, which the copy functions below use on
+// chunks of elements gathered from the strided input.  The results are identical to converting the
+// components one at a time.
+void ConvertVertexComponentsToFloat(const int8_t *input,
+                                    float *output,
+                                    size_t count,
+                                    bool normalized);
+void ConvertVertexComponentsToFloat(const uint8_t *input,
+                                    float *output,
+                                    size_t count,
+                                    bool normalized);
+void ConvertVertexComponentsToFloat(const int16_t *input,
+                                    float *output,
+                                    size_t count,
+                                    bool normalized);
+void ConvertVertexComponentsToFloat(const uint16_t *input,
+                                    float *output,
+                                    size_t count,
+                                    bool normalized);
+void ConvertSnorm8ToSnorm16(const int8_t *input, int16_t *output, size_t count);
+
+// Unpacks |count| XYZ10W2 values to 4 floats each.
+void ConvertXYZ10W2ToFloat(const uint32_t *input,
+                           float *output,
+                           size_t count,
+                           bool isSigned,
+                           bool normalized);
+}  // namespace priv
+
 // 'alphaDefaultValueBits' gives the default value for the alpha channel (4th component)
 template <typename T,
           size_t inputComponentCount,
@@ -56,6 +56,72 @@ inline const T *GetAlignedOffsetInput(const T *offsetInput, T *alignedElement)
     }
 }
 
+namespace priv
+{
+// Number of elements converted at a time on the stack by the chunked copies.
+constexpr size_t kVertexCopyChunkElements = 128;
+
+// Gathers chunks of elements into a tightly packed array, converts all of their components at once
+// with |convert|, and writes them out with the missing components set to 0, except the fourth which
+// is set to |alphaValue|.
+template <typename InputT,
+          typename OutputT,
+          size_t inputComponentCount,
+          size_t outputComponentCount,
+          typename ConvertFunction>
+inline void CopyVertexDataInChunks(const uint8_t *input,
+                                   size_t stride,
+                                   size_t count,
+                                   uint8_t *output,
+                                   OutputT alphaValue,
+                                   ConvertFunction convert)
+{
+    constexpr size_t kAttribSize = sizeof(InputT) * inputComponentCount;
+
+    InputT gathered[kVertexCopyChunkElements * inputComponentCount];
+    OutputT converted[kVertexCopyChunkElements * inputComponentCount];
+
+    for (size_t first = 0; first < count; first += kVertexCopyChunkElements)
+    {
+        const size_t chunkCount   = std::min(kVertexCopyChunkElements, count - first);
+        const uint8_t *chunkInput = input + first * stride;
+        OutputT *chunkOutput = reinterpret_cast<OutputT *>(output) + first * outputComponentCount;
+
+        // The input is copied bytewise, as applications may pass arbitrarily aligned buffers.
+        if (stride == kAttribSize)
+        {
+            memcpy(gathered, chunkInput, chunkCount * kAttribSize);
+        }
+        else
+        {
+            for (size_t i = 0; i < chunkCount; i++)
+            {
+                memcpy(&gathered[i * inputComponentCount], chunkInput + i * stride, kAttribSize);
+            }
+        }
+
+        if (inputComponentCount == outputComponentCount)
+        {
+            convert(gathered, chunkOutput, chunkCount * inputComponentCount);
+            continue;
+        }
+
+        convert(gathered, converted, chunkCount * inputComponentCount);
+        for (size_t i = 0; i < chunkCount; i++)
+        {
+            OutputT *offsetOutput = chunkOutput + i * outputComponentCount;
+            memcpy(offsetOutput, &converted[i * inputComponentCount],
+                   inputComponentCount * sizeof(OutputT));
+
+            for (size_t j = inputComponentCount; j < outputComponentCount; j++)
+            {
+                offsetOutput[j] = (j == 3) ? alphaValue : OutputT(0);
+            }
+        }
+    }
+}
+}  // namespace priv
+
 template <typename T,
           size_t inputComponentCount,
           size_t outputComponentCount,
@@ -70,18 +136,13 @@ inline void CopyNativeVertexData(const uint8_t *input, size_t stride, size_t cou
         return;
     }
 
+    // The elements are copied with memcpy, which handles arbitrarily aligned input, so they don't
+    // need to be aligned first.
     if (inputComponentCount == outputComponentCount)
     {
         for (size_t i = 0; i < count; i++)
         {
-            const T *offsetInput = reinterpret_cast<const T *>(input + (i * stride));
-            T offsetInputAligned[inputComponentCount];
-            offsetInput =
-                GetAlignedOffsetInput<T, inputComponentCount>(offsetInput, &offsetInputAligned[0]);
-
-            T *offsetOutput = reinterpret_cast<T *>(output) + i * outputComponentCount;
-
-            memcpy(offsetOutput, offsetInput, attribSize);
+            memcpy(output + i * attribSize, input + i * stride, attribSize);
         }
         return;
     }
@@ -91,15 +152,9 @@ inline void CopyNativeVertexData(const uint8_t *input, size_t stride, size_t cou
 
     for (size_t i = 0; i < count; i++)
     {
-        const T *offsetInput = reinterpret_cast<const T *>(input + (i * stride));
-        T offsetInputAligned[inputComponentCount];
-        ASSERT(sizeof(offsetInputAligned) == attribSize);
-        offsetInput =
-            GetAlignedOffsetInput<T, inputComponentCount>(offsetInput, &offsetInputAligned[0]);
-
         T *offsetOutput = reinterpret_cast<T *>(output) + i * outputComponentCount;
 
-        memcpy(offsetOutput, offsetInput, attribSize);
+        memcpy(offsetOutput, input + i * stride, attribSize);
 
         if (inputComponentCount < lastNonAlphaOutputComponent)
         {
@@ -154,39 +209,12 @@ inline void Copy8SnormTo16SnormVertexData(const uint8_t *input,
                                           size_t count,
                                           uint8_t *output)
 {
-    for (size_t i = 0; i < count; i++)
-    {
-        const GLbyte *offsetInput = reinterpret_cast<const GLbyte *>(input + i * stride);
-        GLshort *offsetOutput     = reinterpret_cast<GLshort *>(output) + i * outputComponentCount;
-
-        for (size_t j = 0; j < inputComponentCount; j++)
-        {
-            // The original GLbyte value ranges from -128 to +127 (INT8_MAX).
-            // When converted to GLshort, the value must be scaled to between -32768 and +32767
-            // (INT16_MAX).
-            if (offsetInput[j] > 0)
-            {
-                offsetOutput[j] =
-                    offsetInput[j] << 8 | offsetInput[j] << 1 | ((offsetInput[j] & 0x40) >> 6);
-            }
-            else
-            {
-                offsetOutput[j] = offsetInput[j] << 8;
-            }
-        }
-
-        for (size_t j = inputComponentCount; j < std::min<size_t>(outputComponentCount, 3); j++)
-        {
-            // Set remaining G/B channels to 0.
-            offsetOutput[j] = 0;
-        }
-
-        if (inputComponentCount < outputComponentCount && outputComponentCount == 4)
-        {
-            // On normalized formats, we must set the Alpha channel to the max value if it's unused.
-            offsetOutput[3] = INT16_MAX;
-        }
-    }
+    // On normalized formats, we must set the Alpha channel to the max value if it's unused.
+    priv::CopyVertexDataInChunks<GLbyte, GLshort, inputComponentCount, outputComponentCount>(
+        input, stride, count, output, static_cast<GLshort>(INT16_MAX),
+        [](const GLbyte *source, GLshort *dest, size_t componentCount) {
+            priv::ConvertSnorm8ToSnorm16(source, dest, componentCount);
+        });
 }
 
 template <size_t inputComponentCount, size_t outputComponentCount>
@@ -246,6 +274,37 @@ inline void CopyToFloatVertexData(const uint8_t *input,
     typedef std::numeric_limits<T> NL;
     typedef typename std::conditional<toHalf, GLhalf, float>::type outputType;
 
+    if constexpr (sizeof(T) <= sizeof(GLshort))
+    {
+        // 8 and 16-bit components are converted with SIMD, in chunks.
+        if constexpr (toHalf)
+        {
+            priv::CopyVertexDataInChunks<T, GLhalf, inputComponentCount, outputComponentCount>(
+                input, stride, count, output, gl::Float16One,
+                [](const T *source, GLhalf *dest, size_t componentCount) {
+                    float floats[priv::kVertexCopyChunkElements];
+                    for (size_t first = 0; first < componentCount;
+                         first += priv::kVertexCopyChunkElements)
+                    {
+                        const size_t floatCount =
+                            std::min(priv::kVertexCopyChunkElements, componentCount - first);
+                        priv::ConvertVertexComponentsToFloat(source + first, floats, floatCount,
+                                                             normalized);
+                        gl::float32ToFloat16Array(floats, dest + first, floatCount);
+                    }
+                });
+        }
+        else
+        {
+            priv::CopyVertexDataInChunks<T, float, inputComponentCount, outputComponentCount>(
+                input, stride, count, output, 1.0f,
+                [](const T *source, float *dest, size_t componentCount) {
+                    priv::ConvertVertexComponentsToFloat(source, dest, componentCount, normalized);
+                });
+        }
+        return;
+    }
+
     for (size_t i = 0; i < count; i++)
     {
         const T *offsetInput = reinterpret_cast<const T *>(input + (stride * i));
@@ -309,25 +368,8 @@ inline void CopyToFloatVertexData(const uint8_t *input,
 template <size_t inputComponentCount, size_t outputComponentCount>
 void Copy32FTo16FVertexData(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
 {
-    const unsigned short kZero = gl::float32ToFloat16(0.0f);
-    const unsigned short kOne  = gl::float32ToFloat16(1.0f);
-
-    for (size_t i = 0; i < count; i++)
-    {
-        const float *offsetInput = reinterpret_cast<const float *>(input + (stride * i));
-        unsigned short *offsetOutput =
-            reinterpret_cast<unsigned short *>(output) + i * outputComponentCount;
-
-        for (size_t j = 0; j < inputComponentCount; j++)
-        {
-            offsetOutput[j] = gl::float32ToFloat16(offsetInput[j]);
-        }
-
-        for (size_t j = inputComponentCount; j < outputComponentCount; j++)
-        {
-            offsetOutput[j] = (j == 3) ? kOne : kZero;
-        }
-    }
+    gl::float32ToFloat16Elements(input, stride, inputComponentCount,
+                                 reinterpret_cast<uint16_t *>(output), outputComponentCount, count);
 }
 
 inline void CopyXYZ32FToXYZ9E5(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
@@ -556,6 +598,37 @@ inline void CopyXYZ10W2ToXYZWFloatVertexData(const uint8_t *input,
     const uint32_t alphaMask = 0x3;  // 1 set in bits 0 and 1
     const size_t alphaShift  = 30;   // Alpha is the 30 and 31 bits
 
+    if constexpr (toFloat || toHalf)
+    {
+        // Chunks of the packed values are unpacked to floats with SIMD.
+        GLuint packedValues[priv::kVertexCopyChunkElements];
+        float unpackedValues[priv::kVertexCopyChunkElements * componentCount];
+
+        for (size_t first = 0; first < count; first += priv::kVertexCopyChunkElements)
+        {
+            const size_t chunkCount = std::min(priv::kVertexCopyChunkElements, count - first);
+            for (size_t i = 0; i < chunkCount; i++)
+            {
+                memcpy(&packedValues[i], input + (first + i) * stride, sizeof(GLuint));
+            }
+
+            if (toHalf)
+            {
+                priv::ConvertXYZ10W2ToFloat(packedValues, unpackedValues, chunkCount, isSigned,
+                                            normalized);
+                GLhalf *chunkOutput = reinterpret_cast<GLhalf *>(output) + first * componentCount;
+                gl::float32ToFloat16Array(unpackedValues, chunkOutput, chunkCount * componentCount);
+            }
+            else
+            {
+                priv::ConvertXYZ10W2ToFloat(
+                    packedValues, reinterpret_cast<float *>(output) + first * componentCount,
+                    chunkCount, isSigned, normalized);
+            }
+        }
+        return;
+    }
+
     for (size_t i = 0; i < count; i++)
     {
         GLuint packedValue    = *reinterpret_cast<const GLuint *>(input + (i * stride));
@@ -0,0 +1,261 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// copyvertex_unittest:
+//   Tests that the vectorized vertex copy functions match a scalar conversion of every element.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "libANGLE/renderer/copyvertex.h"
+
+using namespace rx;
+
+namespace
+{
+// Fills the input with bytes that make every value of the small types, and a spread of packed
+// values.
+std::vector<uint8_t> MakeInput(size_t size)
+{
+    std::vector<uint8_t> input(size);
+    uint32_t seed = 12345;
+    for (uint8_t &value : input)
+    {
+        seed  = seed * 1664525u + 1013904223u;
+        value = static_cast<uint8_t>(seed >> 24);
+    }
+    return input;
+}
+
+// Copies many counts of elements with various strides and alignments, and compares each element
+// with the scalar conversion.
+template <typename InputT,
+          typename OutputT,
+          size_t inputComponentCount,
+          size_t outputComponentCount>
+void TestCopyMatchesReference(VertexCopyFunction copyFunction,
+                              void (*referenceFunction)(const uint8_t *input, OutputT *output))
+{
+    constexpr size_t kAttribSize = sizeof(InputT) * inputComponentCount;
+
+    for (size_t count : {size_t(0), size_t(1), size_t(7), size_t(9), size_t(128), size_t(300)})
+    {
+        // Packed, padded and unaligned elements.
+        for (size_t stride : {kAttribSize, kAttribSize + 4, kAttribSize + 3})
+        {
+            for (size_t inputOffset : {size_t(0), size_t(1)})
+            {
+                const std::vector<uint8_t> input = MakeInput(count * stride + inputOffset + 16);
+                std::vector<OutputT> output(count * outputComponentCount + 1, OutputT(0x55));
+                std::vector<OutputT> expected(count * outputComponentCount + 1, OutputT(0x55));
+
+                copyFunction(input.data() + inputOffset, stride, count,
+                             reinterpret_cast<uint8_t *>(output.data()));
+                for (size_t i = 0; i < count; i++)
+                {
+                    referenceFunction(input.data() + inputOffset + i * stride,
+                                      expected.data() + i * outputComponentCount);
+                }
+
+                ASSERT_EQ(memcmp(output.data(), expected.data(), output.size() * sizeof(OutputT)),
+                          0)
+                    << "count " << count << " stride " << stride << " offset " << inputOffset;
+            }
+        }
+    }
+}
+
+// The conversion of CopyToFloatVertexData, one component at a time.
+template <typename T,
+          size_t inputComponentCount,
+          size_t outputComponentCount,
+          bool normalized,
+          bool toHalf>
+void ReferenceToFloat(const uint8_t *input,
+                      typename std::conditional<toHalf, GLhalf, float>::type *output)
+{
+    using NL = std::numeric_limits<T>;
+
+    for (size_t j = 0; j < inputComponentCount; j++)
+    {
+        T value;
+        memcpy(&value, input + j * sizeof(T), sizeof(T));
+
+        float result = static_cast<float>(value);
+        if (normalized)
+        {
+            result = result / static_cast<float>(NL::max());
+            if (NL::is_signed)
+            {
+                result = result >= -1.0f ? result : -1.0f;
+            }
+        }
+
+        if (toHalf)
+        {
+            output[j] = gl::float32ToFloat16(result);
+        }
+        else
+        {
+            output[j] = static_cast<float>(result);
+        }
+    }
+
+    for (size_t j = inputComponentCount; j < outputComponentCount; j++)
+    {
+        output[j] = 0;
+    }
+    if (inputComponentCount < 4 && outputComponentCount == 4)
+    {
+        output[3] = toHalf ? gl::Float16One : 1.0f;
+    }
+}
+
+template <typename T,
+          size_t inputComponentCount,
+          size_t outputComponentCount,
+          bool normalized,
+          bool toHalf>
+void TestToFloat()
+{
+    using OutputT = typename std::conditional<toHalf, GLhalf, float>::type;
+    TestCopyMatchesReference<T, OutputT, inputComponentCount, outputComponentCount>(
+        CopyToFloatVertexData<T, inputComponentCount, outputComponentCount, normalized, toHalf>,
+        ReferenceToFloat<T, inputComponentCount, outputComponentCount, normalized, toHalf>);
+}
+
+template <typename T>
+void TestToFloatAllCombinations()
+{
+    TestToFloat<T, 1, 1, false, false>();
+    TestToFloat<T, 2, 2, true, false>();
+    TestToFloat<T, 3, 3, false, false>();
+    TestToFloat<T, 3, 3, true, false>();
+    TestToFloat<T, 3, 4, true, false>();
+    TestToFloat<T, 4, 4, true, false>();
+    TestToFloat<T, 3, 3, false, true>();
+    TestToFloat<T, 3, 4, true, true>();
+    TestToFloat<T, 4, 4, false, true>();
+}
+
+// Test that 8 and 16-bit integers convert to floats and half-floats as before.
+TEST(CopyVertexTest, ToFloat)
+{
+    TestToFloatAllCombinations<GLbyte>();
+    TestToFloatAllCombinations<GLubyte>();
+    TestToFloatAllCombinations<GLshort>();
+    TestToFloatAllCombinations<GLushort>();
+}
+
+// The conversion of Copy8SnormTo16SnormVertexData, one component at a time.
+template <size_t inputComponentCount, size_t outputComponentCount>
+void ReferenceSnorm8ToSnorm16(const uint8_t *input, GLshort *output)
+{
+    for (size_t j = 0; j < inputComponentCount; j++)
+    {
+        const GLbyte value = static_cast<GLbyte>(input[j]);
+        if (value > 0)
+        {
+            output[j] = value << 8 | value << 1 | ((value & 0x40) >> 6);
+        }
+        else
+        {
+            output[j] = static_cast<GLshort>(value * 256);
+        }
+    }
+    for (size_t j = inputComponentCount; j < std::min<size_t>(outputComponentCount, 3); j++)
+    {
+        output[j] = 0;
+    }
+    if (inputComponentCount < outputComponentCount && outputComponentCount == 4)
+    {
+        output[3] = INT16_MAX;
+    }
+}
+
+template <size_t inputComponentCount, size_t outputComponentCount>
+void TestSnorm8ToSnorm16()
+{
+    TestCopyMatchesReference<GLbyte, GLshort, inputComponentCount, outputComponentCount>(
+        Copy8SnormTo16SnormVertexData<inputComponentCount, outputComponentCount>,
+        ReferenceSnorm8ToSnorm16<inputComponentCount, outputComponentCount>);
+}
+
+// Test that 8-bit snorm components are scaled to 16 bits as before.
+TEST(CopyVertexTest, Snorm8ToSnorm16)
+{
+    TestSnorm8ToSnorm16<1, 1>();
+    TestSnorm8ToSnorm16<2, 2>();
+    TestSnorm8ToSnorm16<3, 4>();
+    TestSnorm8ToSnorm16<4, 4>();
+}
+
+// The conversion of CopyXYZ10W2ToXYZWFloatVertexData, with the scalar helpers it used for every
+// element.
+template <bool isSigned, bool normalized, bool toHalf>
+void ReferenceXYZ10W2(const uint8_t *input,
+                      typename std::conditional<toHalf, GLhalf, float>::type *output)
+{
+    GLuint packedValue;
+    memcpy(&packedValue, input, sizeof(packedValue));
+
+    uint8_t *offsetOutput            = reinterpret_cast<uint8_t *>(output);
+    const size_t outputComponentSize = toHalf ? 2 : 4;
+    for (size_t component = 0; component < 3; ++component)
+    {
+        priv::CopyPackedRGB<isSigned, normalized, true, toHalf>(
+            (packedValue >> (component * 10)) & 0x3FF,
+            offsetOutput + component * outputComponentSize);
+    }
+    priv::CopyPackedAlpha<isSigned, normalized, true, toHalf>(
+        packedValue >> 30, offsetOutput + 3 * outputComponentSize);
+}
+
+template <bool isSigned, bool normalized, bool toHalf>
+void TestXYZ10W2()
+{
+    using OutputT = typename std::conditional<toHalf, GLhalf, float>::type;
+    TestCopyMatchesReference<GLuint, OutputT, 1, 4>(
+        CopyXYZ10W2ToXYZWFloatVertexData<isSigned, normalized, true, toHalf>,
+        ReferenceXYZ10W2<isSigned, normalized, toHalf>);
+}
+
+// Test that packed 10-bit components unpack to floats and half-floats as before.
+TEST(CopyVertexTest, XYZ10W2ToFloat)
+{
+    TestXYZ10W2<false, false, false>();
+    TestXYZ10W2<false, true, false>();
+    TestXYZ10W2<true, false, false>();
+    TestXYZ10W2<true, true, false>();
+    TestXYZ10W2<false, true, true>();
+    TestXYZ10W2<true, true, true>();
+}
+
+// The copy of CopyNativeVertexData, which adds the missing components.
+template <size_t inputComponentCount, size_t outputComponentCount>
+void ReferenceNativeFloat(const uint8_t *input, float *output)
+{
+    memcpy(output, input, inputComponentCount * sizeof(float));
+    for (size_t j = inputComponentCount; j < outputComponentCount; j++)
+    {
+        output[j] = j == 3 ? 1.0f : 0.0f;
+    }
+}
+
+// Test that native components are copied and padded from unaligned and strided input.
+TEST(CopyVertexTest, Native)
+{
+    constexpr uint32_t kOne = 0x3F800000;
+    TestCopyMatchesReference<float, float, 3, 3>(CopyNativeVertexData<GLfloat, 3, 3, kOne>,
+                                                 ReferenceNativeFloat<3, 3>);
+    TestCopyMatchesReference<float, float, 2, 4>(CopyNativeVertexData<GLfloat, 2, 4, kOne>,
+                                                 ReferenceNativeFloat<2, 4>);
+}
+}  // anonymous namespace
@@ -67,10 +67,17 @@ namespace angle
 
 static constexpr rx::FastCopyFunctionMap::Entry BGRAEntry = {{angle::FormatID::R8G8B8A8_UNORM,
                                                              CopyBGRA8ToRGBA8}};
-static constexpr rx::FastCopyFunctionMap::Entry RGBAEntry = {{angle::FormatID::R8G8B8A8_UNORM,
-                                                             CopyRGBA8ToRGBA8}};
+static constexpr rx::FastCopyFunctionMap::Entry RGBAEntries[] = {{
+    {{angle::FormatID::R8G8B8A8_UNORM, CopyRGBA8ToRGBA8}},
+    {{angle::FormatID::B8G8R8A8_UNORM, CopyRGBA8ToBGRA8}},
+}};
+static constexpr rx::FastCopyFunctionMap::Entry RGBA16FEntries[] = {{
+    {{angle::FormatID::R8G8B8A8_UNORM, CopyRGBA16FToRGBA8}},
+    {{angle::FormatID::R32G32B32A32_FLOAT, CopyRGBA16FToRGBA32F}},
+}};
 static constexpr rx::FastCopyFunctionMap BGRACopyFunctions = {{&BGRAEntry, 1}};
-static constexpr rx::FastCopyFunctionMap RGBACopyFunctions = {{&RGBAEntry, 1}};
+static constexpr rx::FastCopyFunctionMap RGBACopyFunctions = {{RGBAEntries, 2}};
+static constexpr rx::FastCopyFunctionMap RGBA16FCopyFunctions = {{RGBA16FEntries, 2}};
 static constexpr rx::FastCopyFunctionMap NoCopyFunctions;
 
 const Format gFormatInfoTable[] = {{
@@ -412,6 +419,9 @@ def json_to_table_data(format_id, json, angle_to_gl):
     if format_id == "R8G8B8A8_UNORM_SRGB":
         parsed["fastCopyFunctions"] = "RGBACopyFunctions"
 
+    if format_id == "R16G16B16A16_FLOAT":
+        parsed["fastCopyFunctions"] = "RGBA16FCopyFunctions"
+
     is_block = format_id.endswith("_BLOCK")
 
     pixel_bytes = 0
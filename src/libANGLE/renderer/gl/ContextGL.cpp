@@ -67,7 +67,42 @@ ContextGL::ContextGL(const gl::State &state,
     : ContextImpl(state, errorSet),
       mRenderer(renderer),
       mRobustnessVideoMemoryPurgeStatus(robustnessVideoMemoryPurgeStatus)
-{}
+{
+    angle::PerfMonitorCounter multiBindCallsSaved;
+    multiBindCallsSaved.name  = "multiBindCallsSaved";
+    multiBindCallsSaved.value = 0;
+
+    angle::PerfMonitorCounterGroup openGLGroup;
+    openGLGroup.name = "opengl";
+    openGLGroup.counters.push_back(multiBindCallsSaved);
+
+#if defined(ANGLE_ENABLE_OPENGL_NULL)
+    // The NULL driver counts the calls made in each frame, in total and per entry point, so that
+    // the calls histogram of a frame can be sampled like the other counters.
+    if (getFunctions()->isNULLDriver())
+    {
+        mNullDriverFrameCallCounts = std::make_unique<NullDriverFrameCallCounts>();
+        GetNullDriverCallCounts(&mNullDriverFrameCallCounts->currentFrameStart);
+
+        angle::PerfMonitorCounter nullDriverCalls;
+        nullDriverCalls.name  = "nullDriverCalls";
+        nullDriverCalls.value = 0;
+        openGLGroup.counters.push_back(nullDriverCalls);
+
+        mNullDriverEntryPointCountersStart = openGLGroup.counters.size();
+        for (NullEntryPoint entryPoint : angle::AllEnums<NullEntryPoint>())
+        {
+            angle::PerfMonitorCounter entryPointCalls;
+            entryPointCalls.name =
+                std::string("nullDriverCalls.") + GetNullEntryPointName(entryPoint);
+            entryPointCalls.value = 0;
+            openGLGroup.counters.push_back(entryPointCalls);
+        }
+    }
+#endif  // defined(ANGLE_ENABLE_OPENGL_NULL)
+
+    mPerfMonitorCounters.push_back(openGLGroup);
+}
 
 ContextGL::~ContextGL() {}
 
@@ -948,6 +983,49 @@ const ShPixelLocalStorageOptions &ContextGL::getNativePixelLocalStorageOptions()
     return mRenderer->getNativePixelLocalStorageOptions();
 }
 
+const angle::PerfMonitorCounterGroups &ContextGL::getPerfMonitorCounters()
+{
+    angle::PerfMonitorCounters &counters =
+        angle::GetPerfMonitorCounterGroup(mPerfMonitorCounters, "opengl").counters;
+    angle::GetPerfMonitorCounter(counters, "multiBindCallsSaved").value =
+        getStateManager()->getMultiBindCallsSaved();
+
+#if defined(ANGLE_ENABLE_OPENGL_NULL)
+    if (mNullDriverFrameCallCounts)
+    {
+        uint64_t frameCalls = 0;
+        size_t counterIndex = mNullDriverEntryPointCountersStart;
+        for (uint64_t entryPointCalls : mNullDriverFrameCallCounts->lastFrame)
+        {
+            counters[counterIndex++].value = entryPointCalls;
+            frameCalls += entryPointCalls;
+        }
+        angle::GetPerfMonitorCounter(counters, "nullDriverCalls").value = frameCalls;
+    }
+#endif  // defined(ANGLE_ENABLE_OPENGL_NULL)
+
+    return mPerfMonitorCounters;
+}
+
+void ContextGL::onPreSwap()
+{
+#if defined(ANGLE_ENABLE_OPENGL_NULL)
+    if (mNullDriverFrameCallCounts)
+    {
+        // The NULL entry points are shared by all contexts, so the calls of the other contexts
+        // rendering at the same time are counted too.
+        NullDriverCallCounts callCounts;
+        GetNullDriverCallCounts(&callCounts);
+        for (NullEntryPoint entryPoint : angle::AllEnums<NullEntryPoint>())
+        {
+            mNullDriverFrameCallCounts->lastFrame[entryPoint] =
+                callCounts[entryPoint] - mNullDriverFrameCallCounts->currentFrameStart[entryPoint];
+        }
+        mNullDriverFrameCallCounts->currentFrameStart = callCounts;
+    }
+#endif  // defined(ANGLE_ENABLE_OPENGL_NULL)
+}
+
 StateManagerGL *ContextGL::getStateManager()
 {
     return mRenderer->getStateManager();
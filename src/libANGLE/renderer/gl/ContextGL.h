@@ -13,6 +13,10 @@
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/gl/RendererGL.h"
 
+#if defined(ANGLE_ENABLE_OPENGL_NULL)
+#    include "libANGLE/renderer/gl/NullDriverGL.h"
+#endif  // defined(ANGLE_ENABLE_OPENGL_NULL)
+
 namespace angle
 {
 struct FeaturesGL;
@@ -261,6 +265,11 @@ class ContextGL : public ContextImpl
     const gl::Limitations &getNativeLimitations() const override;
     const ShPixelLocalStorageOptions &getNativePixelLocalStorageOptions() const override;
 
+    // AMD_performance_monitor
+    const angle::PerfMonitorCounterGroups &getPerfMonitorCounters() override;
+
+    void onPreSwap() override;
+
     // Handle helpers
     ANGLE_INLINE const FunctionsGL *getFunctions() const { return mRenderer->getFunctions(); }
 
@@ -321,6 +330,22 @@ class ContextGL : public ContextImpl
     std::shared_ptr<RendererGL> mRenderer;
 
     RobustnessVideoMemoryPurgeStatus mRobustnessVideoMemoryPurgeStatus;
+
+    angle::PerfMonitorCounterGroups mPerfMonitorCounters;
+
+#if defined(ANGLE_ENABLE_OPENGL_NULL)
+    // The calls made to the NULL driver in the last frame, and the call counts when the current
+    // frame started.  Only allocated when the NULL driver is used.
+    struct NullDriverFrameCallCounts
+    {
+        NullDriverCallCounts lastFrame;
+        NullDriverCallCounts currentFrameStart;
+    };
+    std::unique_ptr<NullDriverFrameCallCounts> mNullDriverFrameCallCounts;
+
+    // The index of the first per entry point counter in the "opengl" group.
+    size_t mNullDriverEntryPointCountersStart = 0;
+#endif  // defined(ANGLE_ENABLE_OPENGL_NULL)
 };
 
 }  // namespace rx
@@ -14,6 +14,10 @@
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 
+#if defined(ANGLE_ENABLE_OPENGL_NULL)
+#    include "libANGLE/renderer/gl/NullDriverGL.h"
+#endif  // defined(ANGLE_ENABLE_OPENGL_NULL)
+
 namespace rx
 {
 
@@ -61,40 +65,6 @@ static std::vector<std::string> GetIndexedExtensions(PFNGLGETINTEGERVPROC getInt
     return result;
 }
 
-#if defined(ANGLE_ENABLE_OPENGL_NULL)
-static GLenum INTERNAL_GL_APIENTRY StubCheckFramebufferStatus(GLenum)
-{
-    return GL_FRAMEBUFFER_COMPLETE;
-}
-
-static void INTERNAL_GL_APIENTRY StubGetProgramiv(GLuint program, GLenum pname, GLint *params)
-{
-    switch (pname)
-    {
-        case GL_LINK_STATUS:
-            *params = GL_TRUE;
-            break;
-        case GL_VALIDATE_STATUS:
-            *params = GL_TRUE;
-            break;
-        default:
-            break;
-    }
-}
-
-static void INTERNAL_GL_APIENTRY StubGetShaderiv(GLuint program, GLenum pname, GLint *params)
-{
-    switch (pname)
-    {
-        case GL_COMPILE_STATUS:
-            *params = GL_TRUE;
-            break;
-        default:
-            break;
-    }
-}
-#endif  // defined(ANGLE_ENABLE_OPENGL_NULL)
-
 #define ASSIGN(NAME, FP) FP = reinterpret_cast<decltype(FP)>(loadProcAddress(NAME))
 
 FunctionsGL::FunctionsGL() : version(), standard(), extensions() {}
@@ -193,6 +163,7 @@ void FunctionsGL::initialize(const egl::AttributeMap &displayAttributes)
     {
         initProcsSharedExtensionsNULL(extensionSet);
         initializeStubFunctionsForNULLDriver(extensionSet);
+        mIsNULLDriver = true;
     }
     else
 #endif  // defined(ANGLE_ENABLE_OPENGL_NULL)
@@ -250,9 +221,7 @@ void FunctionsGL::initializeStubFunctionsForNULLDriver(const std::set<std::strin
     ASSIGN("glGetIntegerv", getIntegerv);
     ASSIGN("glGetIntegeri_v", getIntegeri_v);
 
-    getProgramiv           = &StubGetProgramiv;
-    getShaderiv            = &StubGetShaderiv;
-    checkFramebufferStatus = &StubCheckFramebufferStatus;
+    AssignNullDriverShadowFunctions(this);
 
     if (isAtLeastGLES(gl::Version(3, 0)) || isAtLeastGL(gl::Version(4, 2)) ||
         extensionSet.count("GL_ARB_internalformat_query") > 0)
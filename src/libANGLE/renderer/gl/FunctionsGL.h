@@ -52,9 +52,14 @@ class FunctionsGL : public DispatchTableGL
     bool hasGLExtension(const std::string &ext) const;
     bool hasGLESExtension(const std::string &ext) const;
 
+    // Whether the entry points are the NULL driver's, which count the calls made to them.
+    bool isNULLDriver() const { return mIsNULLDriver; }
+
   private:
     void *loadProcAddress(const std::string &function) const override = 0;
     void initializeStubFunctionsForNULLDriver(const std::set<std::string> &extensionSet);
+
+    bool mIsNULLDriver = false;
 };
 
 }  // namespace rx
@@ -0,0 +1,380 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullDriverGL.cpp: Implements the instrumentation of the NULL driver of the GL back-end.
+
+#include "libANGLE/renderer/gl/NullDriverGL.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "anglebase/no_destructor.h"
+#include "common/system_utils.h"
+#include "libANGLE/renderer/gl/DispatchTableGL_autogen.h"
+
+namespace rx
+{
+namespace
+{
+constexpr char kCallLatencyEnvVar[] = "ANGLE_GL_NULL_DRIVER_CALL_LATENCY_NS";
+
+std::array<std::atomic<uint64_t>, angle::EnumSize<NullEntryPoint>()> gCallCounts;
+
+// Object names and sync handles are never reused, so that they stay unique across contexts.
+std::atomic<GLuint> gNextObjectName(1);
+std::atomic<uintptr_t> gNextSync(1);
+
+// The buffers bound on this thread, which are the ones current contexts map.
+thread_local angle::PackedEnumMap<gl::BufferBinding, GLuint> gBoundBuffers;
+
+struct ShadowBuffer
+{
+    GLsizeiptr size = 0;
+    std::vector<uint8_t> mapping;
+};
+
+struct ShadowBuffers
+{
+    std::mutex mutex;
+    std::unordered_map<GLuint, ShadowBuffer> buffers;
+};
+
+ShadowBuffers &GetShadowBuffers()
+{
+    static angle::base::NoDestructor<ShadowBuffers> sShadowBuffers;
+    return *sShadowBuffers;
+}
+
+GLuint &BoundBuffer(GLenum target)
+{
+    return gBoundBuffers[gl::FromGLenum<gl::BufferBinding>(target)];
+}
+
+uint64_t GetCallLatencyNs()
+{
+    std::string latency = angle::GetEnvironmentVar(kCallLatencyEnvVar);
+    return latency.empty() ? 0 : std::strtoull(latency.c_str(), nullptr, 10);
+}
+
+void SpinFor(uint64_t durationNs)
+{
+    const auto end = std::chrono::steady_clock::now() + std::chrono::nanoseconds(durationNs);
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+void GenNames(GLsizei n, GLuint *names)
+{
+    for (GLsizei i = 0; i < n; ++i)
+    {
+        names[i] = gNextObjectName++;
+    }
+}
+
+void *MapShadowBuffer(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    ShadowBuffers &shadowBuffers = GetShadowBuffers();
+    std::lock_guard<std::mutex> lock(shadowBuffers.mutex);
+    ShadowBuffer &buffer = shadowBuffers.buffers[BoundBuffer(target)];
+    if (length < 0)
+    {
+        length = buffer.size - offset;
+    }
+    // Only grow the mapping of buffers whose size isn't known, as the memory of a persistent
+    // mapping can't be moved.
+    size_t mappingSize = std::max<size_t>(buffer.size, offset + length);
+    if (buffer.mapping.size() < mappingSize)
+    {
+        buffer.mapping.resize(mappingSize);
+    }
+    return buffer.mapping.data() + offset;
+}
+
+template <typename T>
+void GetQueryObject(GLenum pname, T *params)
+{
+    // Queries are always available, and count nothing.
+    *params = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+}
+
+#define ANGLE_SHADOW_GEN_NAMES(NAME)                                 \
+    void INTERNAL_GL_APIENTRY Shadow##NAME(GLsizei n, GLuint *names) \
+    {                                                                \
+        RecordNullDriverCall(NullEntryPoint::NAME);                  \
+        GenNames(n, names);                                          \
+    }
+
+ANGLE_SHADOW_GEN_NAMES(GenBuffers)
+ANGLE_SHADOW_GEN_NAMES(GenFencesNV)
+ANGLE_SHADOW_GEN_NAMES(GenFramebuffers)
+ANGLE_SHADOW_GEN_NAMES(GenProgramPipelines)
+ANGLE_SHADOW_GEN_NAMES(GenQueries)
+ANGLE_SHADOW_GEN_NAMES(GenRenderbuffers)
+ANGLE_SHADOW_GEN_NAMES(GenSamplers)
+ANGLE_SHADOW_GEN_NAMES(GenSemaphoresEXT)
+ANGLE_SHADOW_GEN_NAMES(GenTextures)
+ANGLE_SHADOW_GEN_NAMES(GenTransformFeedbacks)
+ANGLE_SHADOW_GEN_NAMES(GenVertexArrays)
+
+#undef ANGLE_SHADOW_GEN_NAMES
+
+GLuint INTERNAL_GL_APIENTRY ShadowCreateProgram()
+{
+    RecordNullDriverCall(NullEntryPoint::CreateProgram);
+    return gNextObjectName++;
+}
+
+GLuint INTERNAL_GL_APIENTRY ShadowCreateShader(GLenum type)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateShader);
+    return gNextObjectName++;
+}
+
+void INTERNAL_GL_APIENTRY ShadowBindBuffer(GLenum target, GLuint buffer)
+{
+    RecordNullDriverCall(NullEntryPoint::BindBuffer);
+    BoundBuffer(target) = buffer;
+}
+
+// Binding a buffer to an indexed target also binds it to the generic target.
+void INTERNAL_GL_APIENTRY ShadowBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    RecordNullDriverCall(NullEntryPoint::BindBufferBase);
+    BoundBuffer(target) = buffer;
+}
+
+void INTERNAL_GL_APIENTRY ShadowBindBufferRange(GLenum target,
+                                                GLuint index,
+                                                GLuint buffer,
+                                                GLintptr offset,
+                                                GLsizeiptr size)
+{
+    RecordNullDriverCall(NullEntryPoint::BindBufferRange);
+    BoundBuffer(target) = buffer;
+}
+
+void INTERNAL_GL_APIENTRY ShadowBufferData(GLenum target,
+                                           GLsizeiptr size,
+                                           const void *data,
+                                           GLenum usage)
+{
+    RecordNullDriverCall(NullEntryPoint::BufferData);
+    ShadowBuffers &shadowBuffers = GetShadowBuffers();
+    std::lock_guard<std::mutex> lock(shadowBuffers.mutex);
+    shadowBuffers.buffers[BoundBuffer(target)].size = size;
+}
+
+void INTERNAL_GL_APIENTRY ShadowBufferStorage(GLenum target,
+                                              GLsizeiptr size,
+                                              const void *data,
+                                              GLbitfield flags)
+{
+    RecordNullDriverCall(NullEntryPoint::BufferStorage);
+    ShadowBuffers &shadowBuffers = GetShadowBuffers();
+    std::lock_guard<std::mutex> lock(shadowBuffers.mutex);
+    shadowBuffers.buffers[BoundBuffer(target)].size = size;
+}
+
+void INTERNAL_GL_APIENTRY ShadowDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteBuffers);
+    ShadowBuffers &shadowBuffers = GetShadowBuffers();
+    std::lock_guard<std::mutex> lock(shadowBuffers.mutex);
+    for (GLsizei i = 0; i < n; ++i)
+    {
+        shadowBuffers.buffers.erase(buffers[i]);
+    }
+}
+
+void *INTERNAL_GL_APIENTRY ShadowMapBuffer(GLenum target, GLenum access)
+{
+    RecordNullDriverCall(NullEntryPoint::MapBuffer);
+    return MapShadowBuffer(target, 0, -1);
+}
+
+void *INTERNAL_GL_APIENTRY ShadowMapBufferRange(GLenum target,
+                                                GLintptr offset,
+                                                GLsizeiptr length,
+                                                GLbitfield access)
+{
+    RecordNullDriverCall(NullEntryPoint::MapBufferRange);
+    return MapShadowBuffer(target, offset, length);
+}
+
+// The mapped memory is kept until the buffer is deleted, as persistent mappings outlive unmapping
+// any other buffer.
+GLboolean INTERNAL_GL_APIENTRY ShadowUnmapBuffer(GLenum target)
+{
+    RecordNullDriverCall(NullEntryPoint::UnmapBuffer);
+    return GL_TRUE;
+}
+
+GLsync INTERNAL_GL_APIENTRY ShadowFenceSync(GLenum condition, GLbitfield flags)
+{
+    RecordNullDriverCall(NullEntryPoint::FenceSync);
+    return reinterpret_cast<GLsync>(gNextSync++);
+}
+
+GLenum INTERNAL_GL_APIENTRY ShadowClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    RecordNullDriverCall(NullEntryPoint::ClientWaitSync);
+    return GL_ALREADY_SIGNALED;
+}
+
+void INTERNAL_GL_APIENTRY
+ShadowGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
+{
+    RecordNullDriverCall(NullEntryPoint::GetSynciv);
+    if (count > 0)
+    {
+        values[0] = pname == GL_SYNC_STATUS ? GL_SIGNALED : 0;
+    }
+    if (length != nullptr)
+    {
+        *length = 1;
+    }
+}
+
+void INTERNAL_GL_APIENTRY ShadowGetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryObjectiv);
+    GetQueryObject(pname, params);
+}
+
+void INTERNAL_GL_APIENTRY ShadowGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryObjectuiv);
+    GetQueryObject(pname, params);
+}
+
+void INTERNAL_GL_APIENTRY ShadowGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryObjecti64v);
+    GetQueryObject(pname, params);
+}
+
+void INTERNAL_GL_APIENTRY ShadowGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryObjectui64v);
+    GetQueryObject(pname, params);
+}
+
+GLenum INTERNAL_GL_APIENTRY ShadowCheckFramebufferStatus(GLenum target)
+{
+    RecordNullDriverCall(NullEntryPoint::CheckFramebufferStatus);
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+void INTERNAL_GL_APIENTRY ShadowGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetProgramiv);
+    switch (pname)
+    {
+        case GL_LINK_STATUS:
+            *params = GL_TRUE;
+            break;
+        case GL_VALIDATE_STATUS:
+            *params = GL_TRUE;
+            break;
+        default:
+            // Programs have no info log, resources or binary.
+            *params = 0;
+            break;
+    }
+}
+
+void INTERNAL_GL_APIENTRY ShadowGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetShaderiv);
+    switch (pname)
+    {
+        case GL_COMPILE_STATUS:
+            *params = GL_TRUE;
+            break;
+        default:
+            *params = 0;
+            break;
+    }
+}
+
+template <typename FunctionT>
+void AssignShadowFunction(FunctionT *function, FunctionT shadowFunction)
+{
+    if (*function != nullptr)
+    {
+        *function = shadowFunction;
+    }
+}
+}  // anonymous namespace
+
+void RecordNullDriverCall(NullEntryPoint entryPoint)
+{
+    static const uint64_t kCallLatencyNs = GetCallLatencyNs();
+
+    gCallCounts[static_cast<size_t>(entryPoint)].fetch_add(1, std::memory_order_relaxed);
+    if (kCallLatencyNs > 0)
+    {
+        SpinFor(kCallLatencyNs);
+    }
+}
+
+void GetNullDriverCallCounts(NullDriverCallCounts *countsOut)
+{
+    for (NullEntryPoint entryPoint : angle::AllEnums<NullEntryPoint>())
+    {
+        (*countsOut)[entryPoint] =
+            gCallCounts[static_cast<size_t>(entryPoint)].load(std::memory_order_relaxed);
+    }
+}
+
+void AssignNullDriverShadowFunctions(DispatchTableGL *functions)
+{
+    AssignShadowFunction(&functions->genBuffers, &ShadowGenBuffers);
+    AssignShadowFunction(&functions->genFencesNV, &ShadowGenFencesNV);
+    AssignShadowFunction(&functions->genFramebuffers, &ShadowGenFramebuffers);
+    AssignShadowFunction(&functions->genProgramPipelines, &ShadowGenProgramPipelines);
+    AssignShadowFunction(&functions->genQueries, &ShadowGenQueries);
+    AssignShadowFunction(&functions->genRenderbuffers, &ShadowGenRenderbuffers);
+    AssignShadowFunction(&functions->genSamplers, &ShadowGenSamplers);
+    AssignShadowFunction(&functions->genSemaphoresEXT, &ShadowGenSemaphoresEXT);
+    AssignShadowFunction(&functions->genTextures, &ShadowGenTextures);
+    AssignShadowFunction(&functions->genTransformFeedbacks, &ShadowGenTransformFeedbacks);
+    AssignShadowFunction(&functions->genVertexArrays, &ShadowGenVertexArrays);
+    AssignShadowFunction(&functions->createProgram, &ShadowCreateProgram);
+    AssignShadowFunction(&functions->createShader, &ShadowCreateShader);
+
+    AssignShadowFunction(&functions->bindBuffer, &ShadowBindBuffer);
+    AssignShadowFunction(&functions->bindBufferBase, &ShadowBindBufferBase);
+    AssignShadowFunction(&functions->bindBufferRange, &ShadowBindBufferRange);
+    AssignShadowFunction(&functions->bufferData, &ShadowBufferData);
+    AssignShadowFunction(&functions->bufferStorage, &ShadowBufferStorage);
+    AssignShadowFunction(&functions->deleteBuffers, &ShadowDeleteBuffers);
+    AssignShadowFunction(&functions->mapBuffer, &ShadowMapBuffer);
+    AssignShadowFunction(&functions->mapBufferRange, &ShadowMapBufferRange);
+    AssignShadowFunction(&functions->unmapBuffer, &ShadowUnmapBuffer);
+
+    AssignShadowFunction(&functions->fenceSync, &ShadowFenceSync);
+    AssignShadowFunction(&functions->clientWaitSync, &ShadowClientWaitSync);
+    AssignShadowFunction(&functions->getSynciv, &ShadowGetSynciv);
+    AssignShadowFunction(&functions->getQueryObjectiv, &ShadowGetQueryObjectiv);
+    AssignShadowFunction(&functions->getQueryObjectuiv, &ShadowGetQueryObjectuiv);
+    AssignShadowFunction(&functions->getQueryObjecti64v, &ShadowGetQueryObjecti64v);
+    AssignShadowFunction(&functions->getQueryObjectui64v, &ShadowGetQueryObjectui64v);
+
+    // Programs and shaders always compile and link, and framebuffers are always complete.
+    functions->checkFramebufferStatus = &ShadowCheckFramebufferStatus;
+    functions->getProgramiv           = &ShadowGetProgramiv;
+    functions->getShaderiv            = &ShadowGetShaderiv;
+}
+
+}  // namespace rx
@@ -0,0 +1,39 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullDriverGL.h: Instrumentation of the NULL driver of the GL back-end. The calls made to the NULL
+// entry points are counted per entry point, and can be slowed down to simulate the CPU cost of a
+// real driver.
+
+#ifndef LIBANGLE_RENDERER_GL_NULLDRIVERGL_H_
+#define LIBANGLE_RENDERER_GL_NULLDRIVERGL_H_
+
+#include "common/PackedEnums.h"
+#include "libANGLE/renderer/gl/null_functions.h"
+
+namespace rx
+{
+class DispatchTableGL;
+
+using NullDriverCallCounts = angle::PackedEnumMap<NullEntryPoint, uint64_t>;
+
+// Counts a call to a NULL entry point.  If the ANGLE_GL_NULL_DRIVER_CALL_LATENCY_NS environment
+// variable is set, the call also spins for that many nanoseconds.
+void RecordNullDriverCall(NullEntryPoint entryPoint);
+
+// Returns the number of calls made to each NULL entry point since the process started.  The entry
+// points are shared by all the displays using the NULL driver, and so are the counts.
+void GetNullDriverCallCounts(NullDriverCallCounts *countsOut);
+
+// Replaces the NULL entry points that create objects or return state with ones that shadow enough
+// of it for the queries ANGLE makes to return sane values: object names are unique, syncs and
+// queries are always signaled and buffers can be mapped.  Entry points that aren't loaded are left
+// alone.
+void AssignNullDriverShadowFunctions(DispatchTableGL *functions);
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_NULLDRIVERGL_H_
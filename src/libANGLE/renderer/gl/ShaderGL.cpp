@@ -57,6 +57,8 @@ class ShaderTranslateTaskGL final : public ShaderTranslateTask
         return status != GL_TRUE;
     }
 
+    bool canLinkWhileCompilingInternally() override { return mHasNativeParallelCompile; }
+
     angle::Result getResult(std::string &infoLog) override
     {
         // Check for compile errors from the native driver
@@ -60,6 +60,32 @@ static void ValidateStateHelper(const FunctionsGL *functions,
     }
 }
 
+// Calls |bindRange| with the first index and the count of each run of consecutive indices in
+// |indices|.
+template <typename IndicesT, typename BindRangeT>
+void ForEachConsecutiveRange(const IndicesT &indices, BindRangeT &&bindRange)
+{
+    size_t first = 0;
+    size_t count = 0;
+    for (size_t index : indices)
+    {
+        if (count > 0 && index != first + count)
+        {
+            bindRange(first, count);
+            count = 0;
+        }
+        if (count == 0)
+        {
+            first = index;
+        }
+        ++count;
+    }
+    if (count > 0)
+    {
+        bindRange(first, count);
+    }
+}
+
 }  // anonymous namespace
 
 VertexArrayStateGL::VertexArrayStateGL(size_t maxAttribs, size_t maxBindings)
@@ -83,6 +109,7 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions,
       mFeatures(features),
       mProgram(0),
       mSupportsVertexArrayObjects(nativegl::SupportsVertexArrayObjects(functions)),
+      mSupportsMultiBind(features.supportsMultiBind.enabled),
       mVAO(0),
       mVertexAttribCurrentValues(rendererCaps.maxVertexAttributes),
       mDefaultVAOState(rendererCaps.maxVertexAttributes, rendererCaps.maxVertexAttribBindings),
@@ -987,12 +1014,14 @@ void StateManagerGL::updateProgramTextureBindings(const gl::Context *context)
     const gl::ActiveTextureMask &activeTextures    = executable->getActiveSamplersMask();
     const gl::ActiveTextureTypeArray &textureTypes = executable->getActiveSamplerTypes();
 
+    gl::ActiveTextureMask changedUnits;
     for (size_t textureUnitIndex : activeTextures)
     {
         gl::TextureType textureType = textureTypes[textureUnitIndex];
         gl::Texture *texture        = textures[textureUnitIndex];
 
         // A nullptr texture indicates incomplete.
+        GLuint textureID = 0;
         if (texture != nullptr)
         {
             const TextureGL *textureGL = GetImplAs<TextureGL>(texture);
@@ -1004,43 +1033,76 @@ void StateManagerGL::updateProgramTextureBindings(const gl::Context *context)
             ASSERT(!texture->hasAnyDirtyBitExcludingBoundAsAttachmentBit());
             ASSERT(!textureGL->hasAnyDirtyBit());
 
-            activeTexture(textureUnitIndex);
-            bindTexture(textureType, textureGL->getTextureID());
+            textureID = textureGL->getTextureID();
         }
-        else
+
+        if (!mSupportsMultiBind)
         {
             activeTexture(textureUnitIndex);
-            bindTexture(textureType, 0);
+            bindTexture(textureType, textureID);
+            continue;
+        }
+
+        const gl::TextureType nativeType = nativegl::GetNativeTextureType(textureType);
+        if (mTextures[nativeType][textureUnitIndex] != textureID)
+        {
+            changedUnits.set(textureUnitIndex);
+            mPendingTextures[textureUnitIndex]     = textureID;
+            mPendingTextureTypes[textureUnitIndex] = nativeType;
         }
     }
+
+    bindTextureRanges(changedUnits);
 }
 
-void StateManagerGL::updateProgramStorageBufferBindings(const gl::Context *context)
+void StateManagerGL::bindTextureRanges(const gl::ActiveTextureMask &units)
 {
-    const gl::State &glState                = context->getState();
-    const gl::ProgramExecutable *executable = glState.getProgramExecutable();
-
-    for (size_t blockIndex = 0; blockIndex < executable->getShaderStorageBlocks().size();
-         blockIndex++)
-    {
-        GLuint binding = executable->getShaderStorageBlockBinding(static_cast<GLuint>(blockIndex));
-        const auto &shaderStorageBuffer = glState.getIndexedShaderStorageBuffer(binding);
-
-        if (shaderStorageBuffer.get() != nullptr)
+    ForEachConsecutiveRange(units, [this](size_t first, size_t count) {
+        if (count == 1)
         {
-            BufferGL *bufferGL = GetImplAs<BufferGL>(shaderStorageBuffer.get());
+            activeTexture(first);
+            bindTexture(mPendingTextureTypes[first], mPendingTextures[first]);
+            return;
+        }
 
-            if (shaderStorageBuffer.getSize() == 0)
+        // glBindTextures binds each texture to the target it was created with, and unbinds every
+        // target of the units given no texture.  The active texture unit is unchanged.
+        mFunctions->bindTextures(static_cast<GLuint>(first), static_cast<GLsizei>(count),
+                                 &mPendingTextures[first]);
+        for (size_t unit = first; unit < first + count; ++unit)
+        {
+            if (mPendingTextures[unit] == 0)
             {
-                bindBufferBase(gl::BufferBinding::ShaderStorage, binding, bufferGL->getBufferID());
+                for (gl::ActiveTextureArray<GLuint> &unitTextures : mTextures)
+                {
+                    unitTextures[unit] = 0;
+                }
             }
             else
             {
-                bindBufferRange(gl::BufferBinding::ShaderStorage, binding, bufferGL->getBufferID(),
-                                shaderStorageBuffer.getOffset(), shaderStorageBuffer.getSize());
+                mTextures[mPendingTextureTypes[unit]][unit] = mPendingTextures[unit];
             }
         }
+        mLocalDirtyBits.set(gl::state::DIRTY_BIT_TEXTURE_BINDINGS);
+
+        // Each unit would otherwise need its own glActiveTexture and glBindTexture calls.
+        mMultiBindCallsSaved += 2 * count - 1;
+    });
+}
+
+void StateManagerGL::updateProgramStorageBufferBindings(const gl::Context *context)
+{
+    const gl::State &glState                = context->getState();
+    const gl::ProgramExecutable *executable = glState.getProgramExecutable();
+
+    for (size_t blockIndex = 0; blockIndex < executable->getShaderStorageBlocks().size();
+         blockIndex++)
+    {
+        GLuint binding = executable->getShaderStorageBlockBinding(static_cast<GLuint>(blockIndex));
+        bindIndexedBuffer(gl::BufferBinding::ShaderStorage, binding,
+                          glState.getIndexedShaderStorageBuffer(binding));
     }
+    flushIndexedBufferBindings(gl::BufferBinding::ShaderStorage);
 }
 
 void StateManagerGL::updateProgramUniformBufferBindings(const gl::Context *context)
@@ -1060,23 +1122,10 @@ void StateManagerGL::updateProgramUniformBufferBindings(const gl::Context *conte
          uniformBlockIndex++)
     {
         GLuint binding = executable->getUniformBlockBinding(static_cast<GLuint>(uniformBlockIndex));
-        const auto &uniformBuffer = glState.getIndexedUniformBuffer(binding);
-
-        if (uniformBuffer.get() != nullptr)
-        {
-            BufferGL *bufferGL = GetImplAs<BufferGL>(uniformBuffer.get());
-
-            if (uniformBuffer.getSize() == 0)
-            {
-                bindBufferBase(gl::BufferBinding::Uniform, binding, bufferGL->getBufferID());
-            }
-            else
-            {
-                bindBufferRange(gl::BufferBinding::Uniform, binding, bufferGL->getBufferID(),
-                                uniformBuffer.getOffset(), uniformBuffer.getSize());
-            }
-        }
+        bindIndexedBuffer(gl::BufferBinding::Uniform, binding,
+                          glState.getIndexedUniformBuffer(binding));
     }
+    flushIndexedBufferBindings(gl::BufferBinding::Uniform);
 }
 
 void StateManagerGL::updateProgramAtomicCounterBufferBindings(const gl::Context *context)
@@ -2867,19 +2916,159 @@ void StateManagerGL::syncSamplersState(const gl::Context *context)
     const gl::SamplerBindingVector &samplers = context->getState().getSamplers();
 
     // This could be optimized by using a separate binding dirty bit per sampler.
+    gl::ActiveTextureMask changedUnits;
     for (size_t samplerIndex = 0; samplerIndex < samplers.size(); ++samplerIndex)
     {
         const gl::Sampler *sampler = samplers[samplerIndex].get();
-        if (sampler != nullptr)
+        const GLuint samplerID =
+            sampler != nullptr ? GetImplAs<SamplerGL>(sampler)->getSamplerID() : 0;
+
+        if (!mSupportsMultiBind)
+        {
+            bindSampler(samplerIndex, samplerID);
+        }
+        else if (mSamplers[samplerIndex] != samplerID)
+        {
+            changedUnits.set(samplerIndex);
+            mPendingSamplers[samplerIndex] = samplerID;
+        }
+    }
+
+    ForEachConsecutiveRange(changedUnits, [this](size_t first, size_t count) {
+        if (count == 1)
+        {
+            bindSampler(first, mPendingSamplers[first]);
+            return;
+        }
+
+        mFunctions->bindSamplers(static_cast<GLuint>(first), static_cast<GLsizei>(count),
+                                 &mPendingSamplers[first]);
+        std::copy_n(&mPendingSamplers[first], count, &mSamplers[first]);
+        mLocalDirtyBits.set(gl::state::DIRTY_BIT_SAMPLER_BINDINGS);
+        mMultiBindCallsSaved += count - 1;
+    });
+}
+
+void StateManagerGL::bindIndexedBuffer(gl::BufferBinding target,
+                                       size_t index,
+                                       const gl::OffsetBindingPointer<gl::Buffer> &buffer)
+{
+    if (buffer.get() == nullptr)
+    {
+        return;
+    }
+
+    const GLuint bufferID = GetImplAs<BufferGL>(buffer.get())->getBufferID();
+    const size_t offset   = buffer.getSize() == 0 ? static_cast<size_t>(-1) : buffer.getOffset();
+    const size_t size     = buffer.getSize() == 0 ? static_cast<size_t>(-1) : buffer.getSize();
+
+    if (!mSupportsMultiBind)
+    {
+        if (buffer.getSize() == 0)
+        {
+            bindBufferBase(target, index, bufferID);
+        }
+        else
+        {
+            bindBufferRange(target, index, bufferID, offset, size);
+        }
+        return;
+    }
+
+    const IndexedBufferBinding &binding = mIndexedBuffers[target][index];
+    if (binding.buffer != bufferID || binding.offset != offset || binding.size != size)
+    {
+        mPendingIndexedBuffers.push_back({index, bufferID, offset, size});
+    }
+}
+
+void StateManagerGL::flushIndexedBufferBindings(gl::BufferBinding target)
+{
+    if (mPendingIndexedBuffers.empty())
+    {
+        return;
+    }
+
+    // Several blocks may use the same binding point.
+    std::sort(mPendingIndexedBuffers.begin(), mPendingIndexedBuffers.end(),
+              [](const PendingIndexedBufferBinding &a, const PendingIndexedBufferBinding &b) {
+                  return a.index < b.index;
+              });
+    mPendingIndexedBuffers.erase(
+        std::unique(mPendingIndexedBuffers.begin(), mPendingIndexedBuffers.end(),
+                    [](const PendingIndexedBufferBinding &a, const PendingIndexedBufferBinding &b) {
+                        return a.index == b.index;
+                    }),
+        mPendingIndexedBuffers.end());
+
+    // Whole buffers and ranges are bound with different calls, so a run is only made of one kind
+    // of binding.
+    auto isBase = [](const PendingIndexedBufferBinding &binding) {
+        return binding.size == static_cast<size_t>(-1);
+    };
+
+    size_t runStart = 0;
+    while (runStart < mPendingIndexedBuffers.size())
+    {
+        const PendingIndexedBufferBinding &first = mPendingIndexedBuffers[runStart];
+        size_t runEnd                            = runStart + 1;
+        while (runEnd < mPendingIndexedBuffers.size() &&
+               mPendingIndexedBuffers[runEnd].index == first.index + (runEnd - runStart) &&
+               isBase(mPendingIndexedBuffers[runEnd]) == isBase(first))
+        {
+            ++runEnd;
+        }
+        const size_t count = runEnd - runStart;
+
+        if (count == 1)
+        {
+            if (isBase(first))
+            {
+                bindBufferBase(target, first.index, first.buffer);
+            }
+            else
+            {
+                bindBufferRange(target, first.index, first.buffer, first.offset, first.size);
+            }
+            runStart = runEnd;
+            continue;
+        }
+
+        mMultiBindBuffers.clear();
+        mMultiBindOffsets.clear();
+        mMultiBindSizes.clear();
+        for (size_t pending = runStart; pending < runEnd; ++pending)
         {
-            SamplerGL *samplerGL = GetImplAs<SamplerGL>(sampler);
-            bindSampler(samplerIndex, samplerGL->getSamplerID());
+            const PendingIndexedBufferBinding &binding = mPendingIndexedBuffers[pending];
+            mMultiBindBuffers.push_back(binding.buffer);
+            mMultiBindOffsets.push_back(static_cast<GLintptr>(binding.offset));
+            mMultiBindSizes.push_back(static_cast<GLsizeiptr>(binding.size));
+
+            IndexedBufferBinding &tracked = mIndexedBuffers[target][binding.index];
+            tracked.buffer                = binding.buffer;
+            tracked.offset                = binding.offset;
+            tracked.size                  = binding.size;
+        }
+
+        // Unlike glBindBufferBase and glBindBufferRange, these leave the generic binding point
+        // unchanged.
+        if (isBase(first))
+        {
+            mFunctions->bindBuffersBase(gl::ToGLenum(target), static_cast<GLuint>(first.index),
+                                        static_cast<GLsizei>(count), mMultiBindBuffers.data());
         }
         else
         {
-            bindSampler(samplerIndex, 0);
+            mFunctions->bindBuffersRange(gl::ToGLenum(target), static_cast<GLuint>(first.index),
+                                         static_cast<GLsizei>(count), mMultiBindBuffers.data(),
+                                         mMultiBindOffsets.data(), mMultiBindSizes.data());
         }
+        mMultiBindCallsSaved += count - 1;
+
+        runStart = runEnd;
     }
+
+    mPendingIndexedBuffers.clear();
 }
 
 void StateManagerGL::syncTransformFeedbackState(const gl::Context *context)
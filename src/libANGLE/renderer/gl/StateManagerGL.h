@@ -333,6 +333,10 @@ class StateManagerGL final : angle::NonCopyable
 
     bool getHasSeparateFramebufferBindings() const { return mHasSeparateFramebufferBindings; }
 
+    // The number of GL calls avoided by binding ranges of texture units, samplers and indexed
+    // buffers together.
+    uint64_t getMultiBindCallsSaved() const { return mMultiBindCallsSaved; }
+
     GLuint getDefaultVAO() const;
     VertexArrayStateGL *getDefaultVAOState();
     void setDefaultVAOStateDirty();
@@ -357,6 +361,7 @@ class StateManagerGL final : angle::NonCopyable
                                         VertexArrayGL *vao);
 
     void updateProgramTextureBindings(const gl::Context *context);
+    void bindTextureRanges(const gl::ActiveTextureMask &units);
     void updateProgramStorageBufferBindings(const gl::Context *context);
     void updateProgramUniformBufferBindings(const gl::Context *context);
     void updateProgramAtomicCounterBufferBindings(const gl::Context *context);
@@ -372,6 +377,10 @@ class StateManagerGL final : angle::NonCopyable
     void get(GLenum name, std::array<T, n> *values);
 
     void syncSamplersState(const gl::Context *context);
+    void bindIndexedBuffer(gl::BufferBinding target,
+                           size_t index,
+                           const gl::OffsetBindingPointer<gl::Buffer> &buffer);
+    void flushIndexedBufferBindings(gl::BufferBinding target);
     void syncTransformFeedbackState(const gl::Context *context);
 
     void updateEmulatedClipDistanceState(const gl::ProgramExecutable *executable,
@@ -421,6 +430,26 @@ class StateManagerGL final : angle::NonCopyable
     GLuint mProgram;
 
     const bool mSupportsVertexArrayObjects;
+
+    // With GL_ARB_multi_bind, the bindings of a program are gathered and consecutive units are
+    // bound together.
+    const bool mSupportsMultiBind;
+    gl::ActiveTextureArray<GLuint> mPendingTextures;
+    gl::ActiveTextureArray<gl::TextureType> mPendingTextureTypes;
+    gl::ActiveTextureArray<GLuint> mPendingSamplers;
+    struct PendingIndexedBufferBinding
+    {
+        size_t index;
+        GLuint buffer;
+        size_t offset;
+        size_t size;
+    };
+    std::vector<PendingIndexedBufferBinding> mPendingIndexedBuffers;
+    std::vector<GLuint> mMultiBindBuffers;
+    std::vector<GLintptr> mMultiBindOffsets;
+    std::vector<GLsizeiptr> mMultiBindSizes;
+    uint64_t mMultiBindCallsSaved = 0;
+
     GLuint mVAO;
     std::vector<gl::VertexAttribCurrentValueData> mVertexAttribCurrentValues;
 
@@ -0,0 +1,189 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingRingBufferGL.cpp: Implements the class methods for StreamingRingBufferGL.
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include "libANGLE/renderer/gl/StreamingRingBufferGL.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/renderergl_utils.h"
+
+namespace rx
+{
+namespace
+{
+// Enough for the alignment of any vertex attribute or index type.
+constexpr size_t kAllocationAlignment = 16;
+
+constexpr GLbitfield kPersistentMapFlags =
+    GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+}  // anonymous namespace
+
+StreamingRingBufferGL::StreamingRingBufferGL() = default;
+
+StreamingRingBufferGL::~StreamingRingBufferGL()
+{
+    ASSERT(mBufferID == 0);
+}
+
+void StreamingRingBufferGL::destroy(const gl::Context *context)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    StateManagerGL *stateManager = GetStateManagerGL(context);
+
+    for (GLsync &fence : mRegionFences)
+    {
+        if (fence != 0)
+        {
+            functions->deleteSync(fence);
+            fence = 0;
+        }
+    }
+
+    // Deleting the buffer unmaps it.
+    stateManager->deleteBuffer(mBufferID);
+    mBufferID = 0;
+    mPointer  = nullptr;
+    mRegion   = 0;
+    mOffset   = 0;
+    mUnfencedRegions.reset();
+}
+
+angle::Result StreamingRingBufferGL::initialize(const gl::Context *context)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    StateManagerGL *stateManager = GetStateManagerGL(context);
+
+    if (!nativegl::SupportsPersistentMappedBuffers(functions))
+    {
+        mUnsupported = true;
+        return angle::Result::Continue;
+    }
+
+    constexpr size_t kBufferSize = kRegionSize * kRegionCount;
+
+    ANGLE_GL_TRY(context, functions->genBuffers(1, &mBufferID));
+    stateManager->bindBuffer(gl::BufferBinding::Array, mBufferID);
+    ANGLE_GL_TRY(context, functions->bufferStorage(GL_ARRAY_BUFFER, kBufferSize, nullptr,
+                                                   kPersistentMapFlags));
+    void *pointer = ANGLE_GL_TRY(
+        context, functions->mapBufferRange(GL_ARRAY_BUFFER, 0, kBufferSize, kPersistentMapFlags));
+    mPointer = static_cast<uint8_t *>(pointer);
+
+    // Fall back to mapping the streaming buffers on every draw if the ring can't be mapped.
+    if (mPointer == nullptr)
+    {
+        WARN() << "Failed to persistently map the client data streaming buffer.";
+        destroy(context);
+        mUnsupported = true;
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingRingBufferGL::fenceRegions(const gl::Context *context)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+
+    for (size_t region : mUnfencedRegions)
+    {
+        ASSERT(mRegionFences[region] == 0);
+        mRegionFences[region] =
+            ANGLE_GL_TRY(context, functions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        ANGLE_CHECK(GetImplAs<ContextGL>(context), mRegionFences[region] != 0,
+                    "glFenceSync failed to create a GLsync object.", GL_OUT_OF_MEMORY);
+    }
+    mUnfencedRegions.reset();
+
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingRingBufferGL::waitForRegion(const gl::Context *context, size_t region)
+{
+    GLsync &fence = mRegionFences[region];
+    if (fence == 0)
+    {
+        return angle::Result::Continue;
+    }
+
+    const FunctionsGL *functions = GetFunctionsGL(context);
+
+    // The fence is flushed by the first wait, so the later ones can't wait forever.
+    constexpr GLuint64 kTimeoutNs = 1'000'000'000;
+    GLenum result                 = GL_TIMEOUT_EXPIRED;
+    GLbitfield flags              = GL_SYNC_FLUSH_COMMANDS_BIT;
+    while (result == GL_TIMEOUT_EXPIRED)
+    {
+        result = ANGLE_GL_TRY(context, functions->clientWaitSync(fence, flags, kTimeoutNs));
+        flags  = 0;
+    }
+
+    functions->deleteSync(fence);
+    fence = 0;
+
+    ANGLE_CHECK(GetImplAs<ContextGL>(context), result != GL_WAIT_FAILED,
+                "Failed to wait for the client data streaming buffer.", GL_OUT_OF_MEMORY);
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingRingBufferGL::allocate(const gl::Context *context,
+                                              size_t size,
+                                              uint8_t **pointerOut,
+                                              size_t *offsetOut)
+{
+    *pointerOut = nullptr;
+    *offsetOut  = 0;
+
+    if (mUnsupported || size > kRegionSize)
+    {
+        return angle::Result::Continue;
+    }
+
+    if (mBufferID == 0)
+    {
+        ANGLE_TRY(initialize(context));
+        if (mUnsupported)
+        {
+            return angle::Result::Continue;
+        }
+    }
+
+    size_t offset = roundUpPow2(mOffset, kAllocationAlignment);
+    if (offset + size > (mRegion + 1) * kRegionSize)
+    {
+        // The next region may still be read by the draw being set up if it left it earlier, in
+        // which case it can't be fenced yet.
+        const size_t nextRegion = (mRegion + 1) % kRegionCount;
+        if (mUnfencedRegions.test(nextRegion))
+        {
+            return angle::Result::Continue;
+        }
+
+        // The current region is fenced once this draw is issued.  Move on to the next one once
+        // the draws that used it last are done.
+        mUnfencedRegions.set(mRegion);
+        mRegion = nextRegion;
+        ANGLE_TRY(waitForRegion(context, mRegion));
+        offset = mRegion * kRegionSize;
+    }
+
+    *pointerOut = mPointer + offset;
+    *offsetOut  = offset;
+    mOffset     = offset + size;
+
+    return angle::Result::Continue;
+}
+
+}  // namespace rx
@@ -0,0 +1,80 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingRingBufferGL.h: Defines the class interface for StreamingRingBufferGL, a persistently
+// mapped buffer that client data is streamed to without mapping or reallocating it on every draw.
+
+#ifndef LIBANGLE_RENDERER_GL_STREAMINGRINGBUFFERGL_H_
+#define LIBANGLE_RENDERER_GL_STREAMINGRINGBUFFERGL_H_
+
+#include <array>
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+#include "common/bitset_utils.h"
+#include "libANGLE/Error.h"
+
+namespace gl
+{
+class Context;
+}  // namespace gl
+
+namespace rx
+{
+
+class StreamingRingBufferGL final : angle::NonCopyable
+{
+  public:
+    StreamingRingBufferGL();
+    ~StreamingRingBufferGL();
+
+    void destroy(const gl::Context *context);
+
+    // Fences the regions the allocations moved on from during the previous draws.  Must be called
+    // before the allocations of every draw, so the fences follow the draws that read the regions.
+    angle::Result onDrawStart(const gl::Context *context)
+    {
+        return mUnfencedRegions.none() ? angle::Result::Continue : fenceRegions(context);
+    }
+
+    // Returns a pointer to |size| bytes of the ring that the GPU is done with, and their offset in
+    // the buffer.  The pointer is null if the driver can't map buffers persistently, |size| is
+    // too large for the ring or the ring is full of data for the current draw, in which case the
+    // data must be streamed some other way.  The data written to the pointer is visible to the
+    // draw calls that follow without flushing.
+    angle::Result allocate(const gl::Context *context,
+                           size_t size,
+                           uint8_t **pointerOut,
+                           size_t *offsetOut);
+
+    GLuint getBufferID() const { return mBufferID; }
+
+  private:
+    static constexpr size_t kRegionSize  = 1024 * 1024;
+    static constexpr size_t kRegionCount = 4;
+
+    angle::Result initialize(const gl::Context *context);
+    angle::Result fenceRegions(const gl::Context *context);
+    angle::Result waitForRegion(const gl::Context *context, size_t region);
+
+    GLuint mBufferID  = 0;
+    uint8_t *mPointer = nullptr;
+    bool mUnsupported = false;
+
+    // The region allocations are made from, and the offset of the next allocation in the buffer.
+    size_t mRegion = 0;
+    size_t mOffset = 0;
+
+    // The ring is split in regions, each guarded by a fence inserted at the start of the draw
+    // after the allocations move on to the next region; the draw that made the move may still read
+    // from the region it left.  A region is only written to again once the draws using it are done.
+    std::array<GLsync, kRegionCount> mRegionFences = {};
+    angle::BitSet8<kRegionCount> mUnfencedRegions;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_STREAMINGRINGBUFFERGL_H_
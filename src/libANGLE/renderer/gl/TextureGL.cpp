@@ -45,6 +45,10 @@ namespace
 // For use with the uploadTextureDataInChunks feature.  See http://crbug.com/1181068
 constexpr const size_t kUploadTextureDataInChunksUploadSize = (120 * 1024) - 1;
 
+// Robust resource initialization uploads zeros in bands of at most this size, so that the zero
+// buffer doesn't grow with the size of the largest texture.
+constexpr const size_t kMaxZeroFillBandSize = 8 * 1024 * 1024;
+
 size_t GetLevelInfoIndex(gl::TextureTarget target, size_t level)
 {
     return gl::IsCubeMapFaceTarget(target)
@@ -2365,42 +2369,74 @@ angle::Result TextureGL::initializeContents(const gl::Context *context,
         nativegl::TexSubImageFormat nativeSubImageFormat = nativegl::GetTexSubImageFormat(
             functions, features, internalFormatInfo.format, internalFormatInfo.type);
 
-        GLuint imageSize = 0;
+        GLuint rowPitch = 0;
+        ANGLE_CHECK_GL_MATH(contextGL, internalFormatInfo.computeRowPitch(
+                                           nativeSubImageFormat.type, desc.size.width,
+                                           unpackState.alignment, 0, &rowPitch));
+        const size_t depthPitch = static_cast<size_t>(rowPitch) * desc.size.height;
+
+        // Upload whole slices at a time if they fit in a band, otherwise rows of each slice.
+        GLint bandHeight = desc.size.height;
+        GLint bandDepth  = 1;
+        if (depthPitch <= kMaxZeroFillBandSize)
+        {
+            bandDepth = static_cast<GLint>(std::min<size_t>(
+                desc.size.depth, kMaxZeroFillBandSize / std::max<size_t>(depthPitch, 1)));
+        }
+        else
+        {
+            bandHeight = static_cast<GLint>(std::max<size_t>(kMaxZeroFillBandSize / rowPitch, 1));
+        }
+
+        GLuint bandSize = 0;
         ANGLE_CHECK_GL_MATH(contextGL, internalFormatInfo.computePackUnpackEndByte(
-                                           nativeSubImageFormat.type, desc.size, unpackState,
-                                           nativegl::UseTexImage3D(getType()), &imageSize));
+                                           nativeSubImageFormat.type,
+                                           gl::Extents(desc.size.width, bandHeight, bandDepth),
+                                           unpackState, nativegl::UseTexImage3D(getType()),
+                                           &bandSize));
 
+        // Every band reads the same zeros.
         angle::MemoryBuffer *zero;
-        ANGLE_CHECK_GL_ALLOC(contextGL, context->getZeroFilledBuffer(imageSize, &zero));
+        ANGLE_CHECK_GL_ALLOC(contextGL, context->getZeroFilledBuffer(bandSize, &zero));
 
-        if (nativegl::UseTexImage2D(getType()))
+        for (GLint z = 0; z < desc.size.depth; z += bandDepth)
         {
-            if (features.uploadTextureDataInChunks.enabled)
-            {
-                gl::Box area(0, 0, 0, desc.size.width, desc.size.height, 1);
-                ANGLE_TRY(setSubImageRowByRowWorkaround(
-                    context, imageIndex.getTarget(), imageIndex.getLevelIndex(), area,
-                    nativeSubImageFormat.format, nativeSubImageFormat.type, unpackState, nullptr,
-                    kUploadTextureDataInChunksUploadSize, zero->data()));
-            }
-            else
+            for (GLint y = 0; y < desc.size.height; y += bandHeight)
             {
-                ANGLE_GL_TRY(context,
-                             functions->texSubImage2D(
-                                 ToGLenum(imageIndex.getTarget()), imageIndex.getLevelIndex(), 0, 0,
-                                 desc.size.width, desc.size.height, nativeSubImageFormat.format,
-                                 nativeSubImageFormat.type, zero->data()));
+                const GLint height = std::min(bandHeight, desc.size.height - y);
+                const GLint depth  = std::min(bandDepth, desc.size.depth - z);
+
+                if (nativegl::UseTexImage2D(getType()))
+                {
+                    if (features.uploadTextureDataInChunks.enabled)
+                    {
+                        gl::Box area(0, y, 0, desc.size.width, height, 1);
+                        ANGLE_TRY(setSubImageRowByRowWorkaround(
+                            context, imageIndex.getTarget(), imageIndex.getLevelIndex(), area,
+                            nativeSubImageFormat.format, nativeSubImageFormat.type, unpackState,
+                            nullptr, kUploadTextureDataInChunksUploadSize, zero->data()));
+                    }
+                    else
+                    {
+                        ANGLE_GL_TRY(context, functions->texSubImage2D(
+                                                  ToGLenum(imageIndex.getTarget()),
+                                                  imageIndex.getLevelIndex(), 0, y,
+                                                  desc.size.width, height,
+                                                  nativeSubImageFormat.format,
+                                                  nativeSubImageFormat.type, zero->data()));
+                    }
+                }
+                else
+                {
+                    ASSERT(nativegl::UseTexImage3D(getType()));
+                    ANGLE_GL_TRY(context, functions->texSubImage3D(
+                                              ToGLenum(imageIndex.getTarget()),
+                                              imageIndex.getLevelIndex(), 0, y, z, desc.size.width,
+                                              height, depth, nativeSubImageFormat.format,
+                                              nativeSubImageFormat.type, zero->data()));
+                }
             }
         }
-        else
-        {
-            ASSERT(nativegl::UseTexImage3D(getType()));
-            ANGLE_GL_TRY(context,
-                         functions->texSubImage3D(
-                             ToGLenum(imageIndex.getTarget()), imageIndex.getLevelIndex(), 0, 0, 0,
-                             desc.size.width, desc.size.height, desc.size.depth,
-                             nativeSubImageFormat.format, nativeSubImageFormat.type, zero->data()));
-        }
     }
 
     // Reset the pixel unpack state.  Because this call is made after synchronizing dirty bits in a
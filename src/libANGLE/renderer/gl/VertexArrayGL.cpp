@@ -164,6 +164,8 @@ void VertexArrayGL::destroy(const gl::Context *context)
     mStreamingArrayBufferSize = 0;
     mStreamingArrayBuffer     = 0;
 
+    mStreamingRingBuffer.destroy(context);
+
     if (mOwnsNativeState)
     {
         delete mNativeState;
@@ -210,6 +212,9 @@ angle::Result VertexArrayGL::syncDrawState(const gl::Context *context,
 {
     const FunctionsGL *functions = GetFunctionsGL(context);
 
+    // The previous draws have been issued, so the ring regions they moved on from can be fenced.
+    ANGLE_TRY(mStreamingRingBuffer.onDrawStart(context));
+
     // Check if any attributes need to be streamed, determines if the index range needs to be
     // computed
     gl::AttributesMask needsStreamingAttribs = context->getActiveClientAttribsMask();
@@ -328,6 +333,29 @@ angle::Result VertexArrayGL::syncIndexData(const gl::Context *context,
             *outIndexRange = ComputeIndexRange(type, indices, count, primitiveRestartEnabled);
         }
 
+        const GLuint indexTypeBytes        = gl::GetDrawElementsTypeSize(type);
+        size_t requiredStreamingBufferSize = indexTypeBytes * count;
+
+        // Write the indices at the head of the ring if possible
+        uint8_t *ringPointer = nullptr;
+        size_t ringOffset    = 0;
+        ANGLE_TRY(mStreamingRingBuffer.allocate(context, requiredStreamingBufferSize, &ringPointer,
+                                                &ringOffset));
+        if (ringPointer != nullptr)
+        {
+            memcpy(ringPointer, indices, requiredStreamingBufferSize);
+
+            stateManager->bindVertexArray(mVertexArrayID, mNativeState);
+
+            const GLuint ringBufferID = mStreamingRingBuffer.getBufferID();
+            stateManager->bindBuffer(gl::BufferBinding::ElementArray, ringBufferID);
+            mElementArrayBuffer.set(context, nullptr);
+            mNativeState->elementArrayBuffer = ringBufferID;
+
+            *outIndices = reinterpret_cast<const void *>(ringOffset);
+            return angle::Result::Continue;
+        }
+
         // Allocate the streaming element array buffer
         if (mStreamingElementArrayBuffer == 0)
         {
@@ -342,8 +370,6 @@ angle::Result VertexArrayGL::syncIndexData(const gl::Context *context,
         mNativeState->elementArrayBuffer = mStreamingElementArrayBuffer;
 
         // Make sure the element array buffer is large enough
-        const GLuint indexTypeBytes        = gl::GetDrawElementsTypeSize(type);
-        size_t requiredStreamingBufferSize = indexTypeBytes * count;
         if (requiredStreamingBufferSize > mStreamingElementArrayBufferSize)
         {
             // Copy the indices in while resizing the buffer
@@ -420,26 +446,39 @@ angle::Result VertexArrayGL::streamAttributes(
         return angle::Result::Continue;
     }
 
-    if (mStreamingArrayBuffer == 0)
-    {
-        ANGLE_GL_TRY(context, functions->genBuffers(1, &mStreamingArrayBuffer));
-        mStreamingArrayBufferSize = 0;
-    }
-
     // If first is greater than zero, a slack space needs to be left at the beginning of the buffer
     // for each attribute so that the same 'first' argument can be passed into the draw call.
     const size_t bufferEmptySpace =
         attribsToStream.count() * maxAttributeDataSize * indexRange.start();
     const size_t requiredBufferSize = streamingDataSize + bufferEmptySpace;
 
-    stateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
-    if (requiredBufferSize > mStreamingArrayBufferSize)
+    // Write the attributes at the head of the ring if possible, which needs no mapping.
+    uint8_t *ringPointer = nullptr;
+    size_t ringOffset    = 0;
+    ANGLE_TRY(
+        mStreamingRingBuffer.allocate(context, requiredBufferSize, &ringPointer, &ringOffset));
+    const bool useRingBuffer = ringPointer != nullptr;
+    const GLuint streamingBuffer =
+        useRingBuffer ? mStreamingRingBuffer.getBufferID() : mStreamingArrayBuffer;
+
+    if (!useRingBuffer)
     {
-        ANGLE_GL_TRY(context, functions->bufferData(GL_ARRAY_BUFFER, requiredBufferSize, nullptr,
-                                                    GL_DYNAMIC_DRAW));
-        mStreamingArrayBufferSize = requiredBufferSize;
+        if (mStreamingArrayBuffer == 0)
+        {
+            ANGLE_GL_TRY(context, functions->genBuffers(1, &mStreamingArrayBuffer));
+            mStreamingArrayBufferSize = 0;
+        }
+
+        stateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
+        if (requiredBufferSize > mStreamingArrayBufferSize)
+        {
+            ANGLE_GL_TRY(context, functions->bufferData(GL_ARRAY_BUFFER, requiredBufferSize,
+                                                        nullptr, GL_DYNAMIC_DRAW));
+            mStreamingArrayBufferSize = requiredBufferSize;
+        }
     }
 
+    stateManager->bindBuffer(gl::BufferBinding::Array, streamingBuffer);
     stateManager->bindVertexArray(mVertexArrayID, mNativeState);
 
     // Unmapping a buffer can return GL_FALSE to indicate that the system has corrupted the data
@@ -449,8 +488,10 @@ angle::Result VertexArrayGL::streamAttributes(
     size_t unmapRetryAttempts = 5;
     while (unmapResult != GL_TRUE && --unmapRetryAttempts > 0)
     {
-        uint8_t *bufferPointer = MapBufferRangeWithFallback(functions, GL_ARRAY_BUFFER, 0,
-                                                            requiredBufferSize, GL_MAP_WRITE_BIT);
+        uint8_t *bufferPointer =
+            useRingBuffer ? ringPointer
+                          : MapBufferRangeWithFallback(functions, GL_ARRAY_BUFFER, 0,
+                                                       requiredBufferSize, GL_MAP_WRITE_BIT);
         size_t curBufferOffset = maxAttributeDataSize * indexRange.start();
 
         const auto &attribs  = mState.getVertexAttributes();
@@ -557,11 +598,12 @@ angle::Result VertexArrayGL::streamAttributes(
             if (needsUnmapAndRebindStreamingAttributeBuffer)
             {
                 ANGLE_GL_TRY(context, functions->unmapBuffer(GL_ARRAY_BUFFER));
-                stateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
+                stateManager->bindBuffer(gl::BufferBinding::Array, streamingBuffer);
             }
 
             // Compute where the 0-index vertex would be.
-            const size_t vertexStartOffset = curBufferOffset - (firstIndex * destStride);
+            const size_t vertexStartOffset =
+                (useRingBuffer ? ringOffset : 0) + curBufferOffset - (firstIndex * destStride);
 
             ANGLE_TRY(callVertexAttribPointer(context, static_cast<GLuint>(idx), attrib,
                                               static_cast<GLsizei>(destStride),
@@ -576,7 +618,7 @@ angle::Result VertexArrayGL::streamAttributes(
             mNativeState->bindings[idx].stride = static_cast<GLsizei>(destStride);
             mNativeState->bindings[idx].offset = static_cast<GLintptr>(vertexStartOffset);
             mArrayBuffers[idx].set(context, nullptr);
-            mNativeState->bindings[idx].buffer = mStreamingArrayBuffer;
+            mNativeState->bindings[idx].buffer = streamingBuffer;
 
             // There's maxAttributeDataSize * indexRange.start() of empty space allocated for each
             // streaming attributes
@@ -584,7 +626,15 @@ angle::Result VertexArrayGL::streamAttributes(
                 destStride * streamedVertexCount + maxAttributeDataSize * indexRange.start();
         }
 
-        unmapResult = ANGLE_GL_TRY(context, functions->unmapBuffer(GL_ARRAY_BUFFER));
+        if (useRingBuffer)
+        {
+            // The ring stays mapped, and is coherent.
+            unmapResult = GL_TRUE;
+        }
+        else
+        {
+            unmapResult = ANGLE_GL_TRY(context, functions->unmapBuffer(GL_ARRAY_BUFFER));
+        }
     }
 
     ANGLE_CHECK(GetImplAs<ContextGL>(context), unmapResult == GL_TRUE,
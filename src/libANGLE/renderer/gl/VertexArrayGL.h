@@ -14,6 +14,7 @@
 #include "common/mathutil.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/StreamingRingBufferGL.h"
 
 namespace rx
 {
@@ -151,6 +152,10 @@ class VertexArrayGL : public VertexArrayImpl
     mutable size_t mStreamingArrayBufferSize = 0;
     mutable GLuint mStreamingArrayBuffer     = 0;
 
+    // Client indices and attributes are streamed to this ring instead of the buffers above where
+    // buffers can be mapped persistently.
+    mutable StreamingRingBufferGL mStreamingRingBuffer;
+
     // Used for Mac Intel instanced draw workaround
     mutable gl::AttributesMask mForcedStreamingAttributesForDrawArraysInstancedMask;
     mutable gl::AttributesMask mInstancedAttributesMask;
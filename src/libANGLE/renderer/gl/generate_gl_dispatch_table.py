@@ -217,8 +217,19 @@ null_functions_header_template = """// GENERATED FILE - DO NOT EDIT.
 
 #include "libANGLE/renderer/gl/functionsgl_typedefs.h"
 
+#include <cstdint>
+
 namespace rx
 {{
+// Identifies the NULL entry points, so that the calls made to them can be counted.
+enum class NullEntryPoint : uint16_t
+{{
+{enum_data}
+    EnumCount,
+}};
+
+const char *GetNullEntryPointName(NullEntryPoint entryPoint);
+
 {table_data}
 }}  // namespace rx
 
@@ -237,8 +248,22 @@ null_functions_source_template = """// GENERATED FILE - DO NOT EDIT.
 
 #include "libANGLE/renderer/gl/null_functions.h"
 
+#include "libANGLE/renderer/gl/NullDriverGL.h"
+
 namespace rx
 {{
+namespace
+{{
+constexpr const char *kNullEntryPointNames[] = {{
+{names_data}
+}};
+}}  // anonymous namespace
+
+const char *GetNullEntryPointName(NullEntryPoint entryPoint)
+{{
+    return kNullEntryPointNames[static_cast<size_t>(entryPoint)];
+}}
+
 {table_data}
 }}  // namespace rx
 """
@@ -473,6 +498,7 @@ def main():
         command_decls[command_name] = entry + ';'
 
         entry += '\n{\n'
+        entry += '    RecordNullDriverCall(NullEntryPoint::' + command_name[2:] + ');\n'
         if return_type != 'void ':
             entry += '    return static_cast<' + return_type + '>(0);\n'
         entry += '}'
@@ -481,11 +507,14 @@ def main():
 
     null_decls = [command_decls[entry_point] for entry_point in sorted(all_entry_points)]
     null_stubs = [command_defs[entry_point] for entry_point in sorted(all_entry_points)]
+    null_enums = ['    ' + entry_point[2:] + ',' for entry_point in sorted(all_entry_points)]
+    null_names = ['    "' + entry_point + '",' for entry_point in sorted(all_entry_points)]
 
     null_functions_header = null_functions_header_template.format(
         script_name=os.path.basename(sys.argv[0]),
         data_source_name=data_source_name,
         file_name=null_functions_header_path,
+        enum_data="\n".join(null_enums),
         table_data="\n".join(null_decls))
 
     with open(null_functions_header_path, "w") as out:
@@ -495,6 +524,7 @@ def main():
         script_name=os.path.basename(sys.argv[0]),
         data_source_name=data_source_name,
         file_name=null_functions_source_path,
+        names_data="\n".join(null_names),
         table_data="\n\n".join(null_stubs))
 
     with open(null_functions_source_path, "w") as out:
@@ -10,38 +10,804 @@
 
 #include "libANGLE/renderer/gl/null_functions.h"
 
+#include "libANGLE/renderer/gl/NullDriverGL.h"
+
 namespace rx
 {
-void INTERNAL_GL_APIENTRY glActiveShaderProgramNULL(GLuint pipeline, GLuint program) {}
+namespace
+{
+constexpr const char *kNullEntryPointNames[] = {
+    "glActiveShaderProgram",
+    "glActiveTexture",
+    "glAttachShader",
+    "glBeginConditionalRender",
+    "glBeginQuery",
+    "glBeginQueryIndexed",
+    "glBeginTransformFeedback",
+    "glBindAttribLocation",
+    "glBindBuffer",
+    "glBindBufferBase",
+    "glBindBufferRange",
+    "glBindBuffersBase",
+    "glBindBuffersRange",
+    "glBindFragDataLocation",
+    "glBindFragDataLocationIndexed",
+    "glBindFramebuffer",
+    "glBindImageTexture",
+    "glBindImageTextures",
+    "glBindProgramPipeline",
+    "glBindRenderbuffer",
+    "glBindSampler",
+    "glBindSamplers",
+    "glBindTexture",
+    "glBindTextureUnit",
+    "glBindTextures",
+    "glBindTransformFeedback",
+    "glBindVertexArray",
+    "glBindVertexBuffer",
+    "glBindVertexBuffers",
+    "glBlendBarrier",
+    "glBlendColor",
+    "glBlendEquation",
+    "glBlendEquationSeparate",
+    "glBlendEquationSeparatei",
+    "glBlendEquationi",
+    "glBlendFunc",
+    "glBlendFuncSeparate",
+    "glBlendFuncSeparatei",
+    "glBlendFunci",
+    "glBlitFramebuffer",
+    "glBlitFramebufferEXT",
+    "glBlitFramebufferNV",
+    "glBlitNamedFramebuffer",
+    "glBufferData",
+    "glBufferStorage",
+    "glBufferStorageMemEXT",
+    "glBufferSubData",
+    "glCheckFramebufferStatus",
+    "glCheckNamedFramebufferStatus",
+    "glClampColor",
+    "glClear",
+    "glClearBufferData",
+    "glClearBufferSubData",
+    "glClearBufferfi",
+    "glClearBufferfv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearColor",
+    "glClearDepth",
+    "glClearDepthf",
+    "glClearNamedBufferData",
+    "glClearNamedBufferSubData",
+    "glClearNamedFramebufferfi",
+    "glClearNamedFramebufferfv",
+    "glClearNamedFramebufferiv",
+    "glClearNamedFramebufferuiv",
+    "glClearStencil",
+    "glClearTexImage",
+    "glClearTexSubImage",
+    "glClientWaitSync",
+    "glClipControl",
+    "glColorMask",
+    "glColorMaski",
+    "glCompileShader",
+    "glCompressedTexImage1D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage3D",
+    "glCompressedTexSubImage1D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTextureSubImage1D",
+    "glCompressedTextureSubImage2D",
+    "glCompressedTextureSubImage3D",
+    "glCopyBufferSubData",
+    "glCopyImageSubData",
+    "glCopyNamedBufferSubData",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glCopyTexSubImage3D",
+    "glCopyTextureSubImage1D",
+    "glCopyTextureSubImage2D",
+    "glCopyTextureSubImage3D",
+    "glCoverageModulationNV",
+    "glCreateBuffers",
+    "glCreateFramebuffers",
+    "glCreateMemoryObjectsEXT",
+    "glCreateProgram",
+    "glCreateProgramPipelines",
+    "glCreateQueries",
+    "glCreateRenderbuffers",
+    "glCreateSamplers",
+    "glCreateShader",
+    "glCreateShaderProgramv",
+    "glCreateTextures",
+    "glCreateTransformFeedbacks",
+    "glCreateVertexArrays",
+    "glCullFace",
+    "glDebugMessageCallback",
+    "glDebugMessageControl",
+    "glDebugMessageInsert",
+    "glDeleteBuffers",
+    "glDeleteFencesNV",
+    "glDeleteFramebuffers",
+    "glDeleteMemoryObjectsEXT",
+    "glDeleteProgram",
+    "glDeleteProgramPipelines",
+    "glDeleteQueries",
+    "glDeleteRenderbuffers",
+    "glDeleteSamplers",
+    "glDeleteSemaphoresEXT",
+    "glDeleteShader",
+    "glDeleteSync",
+    "glDeleteTextures",
+    "glDeleteTransformFeedbacks",
+    "glDeleteVertexArrays",
+    "glDepthFunc",
+    "glDepthMask",
+    "glDepthRange",
+    "glDepthRangeArrayv",
+    "glDepthRangeIndexed",
+    "glDepthRangef",
+    "glDetachShader",
+    "glDisable",
+    "glDisableVertexArrayAttrib",
+    "glDisableVertexAttribArray",
+    "glDisablei",
+    "glDiscardFramebufferEXT",
+    "glDispatchCompute",
+    "glDispatchComputeIndirect",
+    "glDrawArrays",
+    "glDrawArraysIndirect",
+    "glDrawArraysInstanced",
+    "glDrawArraysInstancedBaseInstance",
+    "glDrawBuffer",
+    "glDrawBuffers",
+    "glDrawElements",
+    "glDrawElementsBaseVertex",
+    "glDrawElementsIndirect",
+    "glDrawElementsInstanced",
+    "glDrawElementsInstancedBaseInstance",
+    "glDrawElementsInstancedBaseVertex",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glDrawRangeElements",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawTransformFeedback",
+    "glDrawTransformFeedbackInstanced",
+    "glDrawTransformFeedbackStream",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glEGLImageTargetRenderbufferStorageOES",
+    "glEGLImageTargetTexture2DOES",
+    "glEnable",
+    "glEnableVertexArrayAttrib",
+    "glEnableVertexAttribArray",
+    "glEnablei",
+    "glEndConditionalRender",
+    "glEndQuery",
+    "glEndQueryIndexed",
+    "glEndTilingQCOM",
+    "glEndTransformFeedback",
+    "glFenceSync",
+    "glFinish",
+    "glFinishFenceNV",
+    "glFlush",
+    "glFlushMappedBufferRange",
+    "glFlushMappedNamedBufferRange",
+    "glFramebufferFetchBarrierEXT",
+    "glFramebufferParameteri",
+    "glFramebufferParameteriMESA",
+    "glFramebufferRenderbuffer",
+    "glFramebufferTexture",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture2DMultisampleEXT",
+    "glFramebufferTexture2DMultisampleIMG",
+    "glFramebufferTexture3D",
+    "glFramebufferTextureLayer",
+    "glFramebufferTextureMultiviewOVR",
+    "glFrontFace",
+    "glGenBuffers",
+    "glGenFencesNV",
+    "glGenFramebuffers",
+    "glGenProgramPipelines",
+    "glGenQueries",
+    "glGenRenderbuffers",
+    "glGenSamplers",
+    "glGenSemaphoresEXT",
+    "glGenTextures",
+    "glGenTransformFeedbacks",
+    "glGenVertexArrays",
+    "glGenerateMipmap",
+    "glGenerateTextureMipmap",
+    "glGetActiveAtomicCounterBufferiv",
+    "glGetActiveAttrib",
+    "glGetActiveSubroutineName",
+    "glGetActiveSubroutineUniformName",
+    "glGetActiveSubroutineUniformiv",
+    "glGetActiveUniform",
+    "glGetActiveUniformBlockName",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformName",
+    "glGetActiveUniformsiv",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetBooleani_v",
+    "glGetBooleanv",
+    "glGetBufferParameteri64v",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glGetBufferSubData",
+    "glGetCompressedTexImage",
+    "glGetCompressedTextureImage",
+    "glGetCompressedTextureSubImage",
+    "glGetDebugMessageLog",
+    "glGetDoublei_v",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFenceivNV",
+    "glGetFloati_v",
+    "glGetFloatv",
+    "glGetFragDataIndex",
+    "glGetFragDataLocation",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGetFramebufferParameteriv",
+    "glGetGraphicsResetStatus",
+    "glGetInteger64i_v",
+    "glGetInteger64v",
+    "glGetIntegeri_v",
+    "glGetIntegerv",
+    "glGetInternalformatSampleivNV",
+    "glGetInternalformati64v",
+    "glGetInternalformativ",
+    "glGetMemoryObjectParameterivEXT",
+    "glGetMultisamplefv",
+    "glGetNamedBufferParameteri64v",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedBufferPointerv",
+    "glGetNamedBufferSubData",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glGetNamedFramebufferParameteriv",
+    "glGetNamedRenderbufferParameteriv",
+    "glGetObjectLabel",
+    "glGetObjectPtrLabel",
+    "glGetPointerv",
+    "glGetProgramBinary",
+    "glGetProgramInfoLog",
+    "glGetProgramInterfaceiv",
+    "glGetProgramPipelineInfoLog",
+    "glGetProgramPipelineiv",
+    "glGetProgramResourceIndex",
+    "glGetProgramResourceLocation",
+    "glGetProgramResourceLocationIndex",
+    "glGetProgramResourceName",
+    "glGetProgramResourceiv",
+    "glGetProgramStageiv",
+    "glGetProgramiv",
+    "glGetQueryBufferObjecti64v",
+    "glGetQueryBufferObjectiv",
+    "glGetQueryBufferObjectui64v",
+    "glGetQueryBufferObjectuiv",
+    "glGetQueryIndexediv",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectui64v",
+    "glGetQueryObjectuiv",
+    "glGetQueryiv",
+    "glGetRenderbufferParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterIuiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameteriv",
+    "glGetSemaphoreParameterui64vEXT",
+    "glGetShaderInfoLog",
+    "glGetShaderPrecisionFormat",
+    "glGetShaderSource",
+    "glGetShaderiv",
+    "glGetString",
+    "glGetStringi",
+    "glGetSubroutineIndex",
+    "glGetSubroutineUniformLocation",
+    "glGetSynciv",
+    "glGetTexImage",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTextureImage",
+    "glGetTextureLevelParameterfv",
+    "glGetTextureLevelParameteriv",
+    "glGetTextureParameterIiv",
+    "glGetTextureParameterIuiv",
+    "glGetTextureParameterfv",
+    "glGetTextureParameteriv",
+    "glGetTextureSubImage",
+    "glGetTransformFeedbackVarying",
+    "glGetTransformFeedbacki64_v",
+    "glGetTransformFeedbacki_v",
+    "glGetTransformFeedbackiv",
+    "glGetUniformBlockIndex",
+    "glGetUniformIndices",
+    "glGetUniformLocation",
+    "glGetUniformSubroutineuiv",
+    "glGetUniformdv",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetUniformuiv",
+    "glGetUnsignedBytei_vEXT",
+    "glGetUnsignedBytevEXT",
+    "glGetVertexArrayIndexed64iv",
+    "glGetVertexArrayIndexediv",
+    "glGetVertexArrayiv",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glGetVertexAttribLdv",
+    "glGetVertexAttribPointerv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetnCompressedTexImage",
+    "glGetnTexImage",
+    "glGetnUniformdv",
+    "glGetnUniformfv",
+    "glGetnUniformiv",
+    "glGetnUniformuiv",
+    "glHint",
+    "glImportMemoryFdEXT",
+    "glImportMemoryWin32HandleEXT",
+    "glImportMemoryWin32NameEXT",
+    "glImportSemaphoreFdEXT",
+    "glImportSemaphoreWin32HandleEXT",
+    "glImportSemaphoreWin32NameEXT",
+    "glInsertEventMarkerEXT",
+    "glInvalidateBufferData",
+    "glInvalidateBufferSubData",
+    "glInvalidateFramebuffer",
+    "glInvalidateNamedFramebufferData",
+    "glInvalidateNamedFramebufferSubData",
+    "glInvalidateSubFramebuffer",
+    "glInvalidateTexImage",
+    "glInvalidateTexSubImage",
+    "glIsBuffer",
+    "glIsEnabled",
+    "glIsEnabledi",
+    "glIsFenceNV",
+    "glIsFramebuffer",
+    "glIsMemoryObjectEXT",
+    "glIsProgram",
+    "glIsProgramPipeline",
+    "glIsQuery",
+    "glIsRenderbuffer",
+    "glIsSampler",
+    "glIsSemaphoreEXT",
+    "glIsShader",
+    "glIsSync",
+    "glIsTexture",
+    "glIsTransformFeedback",
+    "glIsVertexArray",
+    "glLineWidth",
+    "glLinkProgram",
+    "glLogicOp",
+    "glMapBuffer",
+    "glMapBufferRange",
+    "glMapNamedBuffer",
+    "glMapNamedBufferRange",
+    "glMaxShaderCompilerThreadsARB",
+    "glMaxShaderCompilerThreadsKHR",
+    "glMemoryBarrier",
+    "glMemoryBarrierByRegion",
+    "glMemoryObjectParameterivEXT",
+    "glMinSampleShading",
+    "glMultiDrawArrays",
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElements",
+    "glMultiDrawElementsBaseVertex",
+    "glMultiDrawElementsIndirect",
+    "glNamedBufferData",
+    "glNamedBufferStorage",
+    "glNamedBufferStorageMemEXT",
+    "glNamedBufferSubData",
+    "glNamedFramebufferDrawBuffer",
+    "glNamedFramebufferDrawBuffers",
+    "glNamedFramebufferParameteri",
+    "glNamedFramebufferReadBuffer",
+    "glNamedFramebufferRenderbuffer",
+    "glNamedFramebufferTexture",
+    "glNamedFramebufferTextureLayer",
+    "glNamedFramebufferTextureMultiviewOVR",
+    "glNamedRenderbufferStorage",
+    "glNamedRenderbufferStorageMultisample",
+    "glObjectLabel",
+    "glObjectPtrLabel",
+    "glPatchParameterfv",
+    "glPatchParameteri",
+    "glPauseTransformFeedback",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glPointSize",
+    "glPolygonMode",
+    "glPolygonModeNV",
+    "glPolygonOffset",
+    "glPolygonOffsetClampEXT",
+    "glPopDebugGroup",
+    "glPopGroupMarkerEXT",
+    "glPrimitiveBoundingBox",
+    "glPrimitiveRestartIndex",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glProgramUniform1d",
+    "glProgramUniform1dv",
+    "glProgramUniform1f",
+    "glProgramUniform1fv",
+    "glProgramUniform1i",
+    "glProgramUniform1iv",
+    "glProgramUniform1ui",
+    "glProgramUniform1uiv",
+    "glProgramUniform2d",
+    "glProgramUniform2dv",
+    "glProgramUniform2f",
+    "glProgramUniform2fv",
+    "glProgramUniform2i",
+    "glProgramUniform2iv",
+    "glProgramUniform2ui",
+    "glProgramUniform2uiv",
+    "glProgramUniform3d",
+    "glProgramUniform3dv",
+    "glProgramUniform3f",
+    "glProgramUniform3fv",
+    "glProgramUniform3i",
+    "glProgramUniform3iv",
+    "glProgramUniform3ui",
+    "glProgramUniform3uiv",
+    "glProgramUniform4d",
+    "glProgramUniform4dv",
+    "glProgramUniform4f",
+    "glProgramUniform4fv",
+    "glProgramUniform4i",
+    "glProgramUniform4iv",
+    "glProgramUniform4ui",
+    "glProgramUniform4uiv",
+    "glProgramUniformMatrix2dv",
+    "glProgramUniformMatrix2fv",
+    "glProgramUniformMatrix2x3dv",
+    "glProgramUniformMatrix2x3fv",
+    "glProgramUniformMatrix2x4dv",
+    "glProgramUniformMatrix2x4fv",
+    "glProgramUniformMatrix3dv",
+    "glProgramUniformMatrix3fv",
+    "glProgramUniformMatrix3x2dv",
+    "glProgramUniformMatrix3x2fv",
+    "glProgramUniformMatrix3x4dv",
+    "glProgramUniformMatrix3x4fv",
+    "glProgramUniformMatrix4dv",
+    "glProgramUniformMatrix4fv",
+    "glProgramUniformMatrix4x2dv",
+    "glProgramUniformMatrix4x2fv",
+    "glProgramUniformMatrix4x3dv",
+    "glProgramUniformMatrix4x3fv",
+    "glProvokingVertex",
+    "glPushDebugGroup",
+    "glPushGroupMarkerEXT",
+    "glQueryCounter",
+    "glReadBuffer",
+    "glReadPixels",
+    "glReadnPixels",
+    "glReleaseShaderCompiler",
+    "glRenderbufferStorage",
+    "glRenderbufferStorageMultisample",
+    "glRenderbufferStorageMultisampleEXT",
+    "glRenderbufferStorageMultisampleIMG",
+    "glResumeTransformFeedback",
+    "glSampleCoverage",
+    "glSampleMaski",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glScissor",
+    "glScissorArrayv",
+    "glScissorIndexed",
+    "glScissorIndexedv",
+    "glSemaphoreParameterui64vEXT",
+    "glSetFenceNV",
+    "glShaderBinary",
+    "glShaderSource",
+    "glShaderStorageBlockBinding",
+    "glSignalSemaphoreEXT",
+    "glStartTilingQCOM",
+    "glStencilFunc",
+    "glStencilFuncSeparate",
+    "glStencilMask",
+    "glStencilMaskSeparate",
+    "glStencilOp",
+    "glStencilOpSeparate",
+    "glTestFenceNV",
+    "glTexBuffer",
+    "glTexBufferEXT",
+    "glTexBufferOES",
+    "glTexBufferRange",
+    "glTexBufferRangeEXT",
+    "glTexBufferRangeOES",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glTexImage2DMultisample",
+    "glTexImage3D",
+    "glTexImage3DMultisample",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexStorage1D",
+    "glTexStorage2D",
+    "glTexStorage2DMultisample",
+    "glTexStorage3D",
+    "glTexStorage3DMultisample",
+    "glTexStorageMem2DEXT",
+    "glTexStorageMem2DMultisampleEXT",
+    "glTexStorageMem3DEXT",
+    "glTexStorageMem3DMultisampleEXT",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glTexSubImage3D",
+    "glTextureBarrier",
+    "glTextureBuffer",
+    "glTextureBufferRange",
+    "glTextureParameterIiv",
+    "glTextureParameterIuiv",
+    "glTextureParameterf",
+    "glTextureParameterfv",
+    "glTextureParameteri",
+    "glTextureParameteriv",
+    "glTextureStorage1D",
+    "glTextureStorage2D",
+    "glTextureStorage2DMultisample",
+    "glTextureStorage3D",
+    "glTextureStorage3DMultisample",
+    "glTextureStorageMem2DEXT",
+    "glTextureStorageMem2DMultisampleEXT",
+    "glTextureStorageMem3DEXT",
+    "glTextureStorageMem3DMultisampleEXT",
+    "glTextureSubImage1D",
+    "glTextureSubImage2D",
+    "glTextureSubImage3D",
+    "glTextureView",
+    "glTransformFeedbackBufferBase",
+    "glTransformFeedbackBufferRange",
+    "glTransformFeedbackVaryings",
+    "glUniform1d",
+    "glUniform1dv",
+    "glUniform1f",
+    "glUniform1fv",
+    "glUniform1i",
+    "glUniform1iv",
+    "glUniform1ui",
+    "glUniform1uiv",
+    "glUniform2d",
+    "glUniform2dv",
+    "glUniform2f",
+    "glUniform2fv",
+    "glUniform2i",
+    "glUniform2iv",
+    "glUniform2ui",
+    "glUniform2uiv",
+    "glUniform3d",
+    "glUniform3dv",
+    "glUniform3f",
+    "glUniform3fv",
+    "glUniform3i",
+    "glUniform3iv",
+    "glUniform3ui",
+    "glUniform3uiv",
+    "glUniform4d",
+    "glUniform4dv",
+    "glUniform4f",
+    "glUniform4fv",
+    "glUniform4i",
+    "glUniform4iv",
+    "glUniform4ui",
+    "glUniform4uiv",
+    "glUniformBlockBinding",
+    "glUniformMatrix2dv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix2x3dv",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix2x4dv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix3dv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix3x2dv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix3x4dv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4dv",
+    "glUniformMatrix4fv",
+    "glUniformMatrix4x2dv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix4x3dv",
+    "glUniformMatrix4x3fv",
+    "glUniformSubroutinesuiv",
+    "glUnmapBuffer",
+    "glUnmapNamedBuffer",
+    "glUseProgram",
+    "glUseProgramStages",
+    "glValidateProgram",
+    "glValidateProgramPipeline",
+    "glVertexArrayAttribBinding",
+    "glVertexArrayAttribFormat",
+    "glVertexArrayAttribIFormat",
+    "glVertexArrayAttribLFormat",
+    "glVertexArrayBindingDivisor",
+    "glVertexArrayElementBuffer",
+    "glVertexArrayVertexBuffer",
+    "glVertexArrayVertexBuffers",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribBinding",
+    "glVertexAttribDivisor",
+    "glVertexAttribFormat",
+    "glVertexAttribI1i",
+    "glVertexAttribI1iv",
+    "glVertexAttribI1ui",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2i",
+    "glVertexAttribI2iv",
+    "glVertexAttribI2ui",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3i",
+    "glVertexAttribI3iv",
+    "glVertexAttribI3ui",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4i",
+    "glVertexAttribI4iv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4ui",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4usv",
+    "glVertexAttribIFormat",
+    "glVertexAttribIPointer",
+    "glVertexAttribL1d",
+    "glVertexAttribL1dv",
+    "glVertexAttribL2d",
+    "glVertexAttribL2dv",
+    "glVertexAttribL3d",
+    "glVertexAttribL3dv",
+    "glVertexAttribL4d",
+    "glVertexAttribL4dv",
+    "glVertexAttribLFormat",
+    "glVertexAttribLPointer",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glVertexAttribPointer",
+    "glVertexBindingDivisor",
+    "glViewport",
+    "glViewportArrayv",
+    "glViewportIndexedf",
+    "glViewportIndexedfv",
+    "glWaitSemaphoreEXT",
+    "glWaitSync",
+};
+}  // anonymous namespace
+
+const char *GetNullEntryPointName(NullEntryPoint entryPoint)
+{
+    return kNullEntryPointNames[static_cast<size_t>(entryPoint)];
+}
+
+void INTERNAL_GL_APIENTRY glActiveShaderProgramNULL(GLuint pipeline, GLuint program)
+{
+    RecordNullDriverCall(NullEntryPoint::ActiveShaderProgram);
+}
 
-void INTERNAL_GL_APIENTRY glActiveTextureNULL(GLenum texture) {}
+void INTERNAL_GL_APIENTRY glActiveTextureNULL(GLenum texture)
+{
+    RecordNullDriverCall(NullEntryPoint::ActiveTexture);
+}
 
-void INTERNAL_GL_APIENTRY glAttachShaderNULL(GLuint program, GLuint shader) {}
+void INTERNAL_GL_APIENTRY glAttachShaderNULL(GLuint program, GLuint shader)
+{
+    RecordNullDriverCall(NullEntryPoint::AttachShader);
+}
 
-void INTERNAL_GL_APIENTRY glBeginConditionalRenderNULL(GLuint id, GLenum mode) {}
+void INTERNAL_GL_APIENTRY glBeginConditionalRenderNULL(GLuint id, GLenum mode)
+{
+    RecordNullDriverCall(NullEntryPoint::BeginConditionalRender);
+}
 
-void INTERNAL_GL_APIENTRY glBeginQueryNULL(GLenum target, GLuint id) {}
+void INTERNAL_GL_APIENTRY glBeginQueryNULL(GLenum target, GLuint id)
+{
+    RecordNullDriverCall(NullEntryPoint::BeginQuery);
+}
 
-void INTERNAL_GL_APIENTRY glBeginQueryIndexedNULL(GLenum target, GLuint index, GLuint id) {}
+void INTERNAL_GL_APIENTRY glBeginQueryIndexedNULL(GLenum target, GLuint index, GLuint id)
+{
+    RecordNullDriverCall(NullEntryPoint::BeginQueryIndexed);
+}
 
-void INTERNAL_GL_APIENTRY glBeginTransformFeedbackNULL(GLenum primitiveMode) {}
+void INTERNAL_GL_APIENTRY glBeginTransformFeedbackNULL(GLenum primitiveMode)
+{
+    RecordNullDriverCall(NullEntryPoint::BeginTransformFeedback);
+}
 
 void INTERNAL_GL_APIENTRY glBindAttribLocationNULL(GLuint program, GLuint index, const GLchar *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BindAttribLocation);
+}
 
-void INTERNAL_GL_APIENTRY glBindBufferNULL(GLenum target, GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glBindBufferNULL(GLenum target, GLuint buffer)
+{
+    RecordNullDriverCall(NullEntryPoint::BindBuffer);
+}
 
-void INTERNAL_GL_APIENTRY glBindBufferBaseNULL(GLenum target, GLuint index, GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glBindBufferBaseNULL(GLenum target, GLuint index, GLuint buffer)
+{
+    RecordNullDriverCall(NullEntryPoint::BindBufferBase);
+}
 
 void INTERNAL_GL_APIENTRY
 glBindBufferRangeNULL(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BindBufferRange);
+}
 
 void INTERNAL_GL_APIENTRY glBindBuffersBaseNULL(GLenum target,
                                                 GLuint first,
                                                 GLsizei count,
                                                 const GLuint *buffers)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BindBuffersBase);
+}
 
 void INTERNAL_GL_APIENTRY glBindBuffersRangeNULL(GLenum target,
                                                  GLuint first,
@@ -49,20 +815,29 @@ void INTERNAL_GL_APIENTRY glBindBuffersRangeNULL(GLenum target,
                                                  const GLuint *buffers,
                                                  const GLintptr *offsets,
                                                  const GLsizeiptr *sizes)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BindBuffersRange);
+}
 
 void INTERNAL_GL_APIENTRY glBindFragDataLocationNULL(GLuint program,
                                                      GLuint color,
                                                      const GLchar *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BindFragDataLocation);
+}
 
 void INTERNAL_GL_APIENTRY glBindFragDataLocationIndexedNULL(GLuint program,
                                                             GLuint colorNumber,
                                                             GLuint index,
                                                             const GLchar *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BindFragDataLocationIndexed);
+}
 
-void INTERNAL_GL_APIENTRY glBindFramebufferNULL(GLenum target, GLuint framebuffer) {}
+void INTERNAL_GL_APIENTRY glBindFramebufferNULL(GLenum target, GLuint framebuffer)
+{
+    RecordNullDriverCall(NullEntryPoint::BindFramebuffer);
+}
 
 void INTERNAL_GL_APIENTRY glBindImageTextureNULL(GLuint unit,
                                                  GLuint texture,
@@ -71,71 +846,132 @@ void INTERNAL_GL_APIENTRY glBindImageTextureNULL(GLuint unit,
                                                  GLint layer,
                                                  GLenum access,
                                                  GLenum format)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BindImageTexture);
+}
 
 void INTERNAL_GL_APIENTRY glBindImageTexturesNULL(GLuint first,
                                                   GLsizei count,
                                                   const GLuint *textures)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BindImageTextures);
+}
 
-void INTERNAL_GL_APIENTRY glBindProgramPipelineNULL(GLuint pipeline) {}
+void INTERNAL_GL_APIENTRY glBindProgramPipelineNULL(GLuint pipeline)
+{
+    RecordNullDriverCall(NullEntryPoint::BindProgramPipeline);
+}
 
-void INTERNAL_GL_APIENTRY glBindRenderbufferNULL(GLenum target, GLuint renderbuffer) {}
+void INTERNAL_GL_APIENTRY glBindRenderbufferNULL(GLenum target, GLuint renderbuffer)
+{
+    RecordNullDriverCall(NullEntryPoint::BindRenderbuffer);
+}
 
-void INTERNAL_GL_APIENTRY glBindSamplerNULL(GLuint unit, GLuint sampler) {}
+void INTERNAL_GL_APIENTRY glBindSamplerNULL(GLuint unit, GLuint sampler)
+{
+    RecordNullDriverCall(NullEntryPoint::BindSampler);
+}
 
-void INTERNAL_GL_APIENTRY glBindSamplersNULL(GLuint first, GLsizei count, const GLuint *samplers) {}
+void INTERNAL_GL_APIENTRY glBindSamplersNULL(GLuint first, GLsizei count, const GLuint *samplers)
+{
+    RecordNullDriverCall(NullEntryPoint::BindSamplers);
+}
 
-void INTERNAL_GL_APIENTRY glBindTextureNULL(GLenum target, GLuint texture) {}
+void INTERNAL_GL_APIENTRY glBindTextureNULL(GLenum target, GLuint texture)
+{
+    RecordNullDriverCall(NullEntryPoint::BindTexture);
+}
 
-void INTERNAL_GL_APIENTRY glBindTextureUnitNULL(GLuint unit, GLuint texture) {}
+void INTERNAL_GL_APIENTRY glBindTextureUnitNULL(GLuint unit, GLuint texture)
+{
+    RecordNullDriverCall(NullEntryPoint::BindTextureUnit);
+}
 
-void INTERNAL_GL_APIENTRY glBindTexturesNULL(GLuint first, GLsizei count, const GLuint *textures) {}
+void INTERNAL_GL_APIENTRY glBindTexturesNULL(GLuint first, GLsizei count, const GLuint *textures)
+{
+    RecordNullDriverCall(NullEntryPoint::BindTextures);
+}
 
-void INTERNAL_GL_APIENTRY glBindTransformFeedbackNULL(GLenum target, GLuint id) {}
+void INTERNAL_GL_APIENTRY glBindTransformFeedbackNULL(GLenum target, GLuint id)
+{
+    RecordNullDriverCall(NullEntryPoint::BindTransformFeedback);
+}
 
-void INTERNAL_GL_APIENTRY glBindVertexArrayNULL(GLuint array) {}
+void INTERNAL_GL_APIENTRY glBindVertexArrayNULL(GLuint array)
+{
+    RecordNullDriverCall(NullEntryPoint::BindVertexArray);
+}
 
 void INTERNAL_GL_APIENTRY glBindVertexBufferNULL(GLuint bindingindex,
                                                  GLuint buffer,
                                                  GLintptr offset,
                                                  GLsizei stride)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BindVertexBuffer);
+}
 
 void INTERNAL_GL_APIENTRY glBindVertexBuffersNULL(GLuint first,
                                                   GLsizei count,
                                                   const GLuint *buffers,
                                                   const GLintptr *offsets,
                                                   const GLsizei *strides)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BindVertexBuffers);
+}
 
-void INTERNAL_GL_APIENTRY glBlendBarrierNULL() {}
+void INTERNAL_GL_APIENTRY glBlendBarrierNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::BlendBarrier);
+}
 
 void INTERNAL_GL_APIENTRY glBlendColorNULL(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BlendColor);
+}
 
-void INTERNAL_GL_APIENTRY glBlendEquationNULL(GLenum mode) {}
+void INTERNAL_GL_APIENTRY glBlendEquationNULL(GLenum mode)
+{
+    RecordNullDriverCall(NullEntryPoint::BlendEquation);
+}
 
-void INTERNAL_GL_APIENTRY glBlendEquationSeparateNULL(GLenum modeRGB, GLenum modeAlpha) {}
+void INTERNAL_GL_APIENTRY glBlendEquationSeparateNULL(GLenum modeRGB, GLenum modeAlpha)
+{
+    RecordNullDriverCall(NullEntryPoint::BlendEquationSeparate);
+}
 
 void INTERNAL_GL_APIENTRY glBlendEquationSeparateiNULL(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BlendEquationSeparatei);
+}
 
-void INTERNAL_GL_APIENTRY glBlendEquationiNULL(GLuint buf, GLenum mode) {}
+void INTERNAL_GL_APIENTRY glBlendEquationiNULL(GLuint buf, GLenum mode)
+{
+    RecordNullDriverCall(NullEntryPoint::BlendEquationi);
+}
 
-void INTERNAL_GL_APIENTRY glBlendFuncNULL(GLenum sfactor, GLenum dfactor) {}
+void INTERNAL_GL_APIENTRY glBlendFuncNULL(GLenum sfactor, GLenum dfactor)
+{
+    RecordNullDriverCall(NullEntryPoint::BlendFunc);
+}
 
 void INTERNAL_GL_APIENTRY glBlendFuncSeparateNULL(GLenum sfactorRGB,
                                                   GLenum dfactorRGB,
                                                   GLenum sfactorAlpha,
                                                   GLenum dfactorAlpha)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BlendFuncSeparate);
+}
 
 void INTERNAL_GL_APIENTRY
 glBlendFuncSeparateiNULL(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BlendFuncSeparatei);
+}
 
-void INTERNAL_GL_APIENTRY glBlendFunciNULL(GLuint buf, GLenum src, GLenum dst) {}
+void INTERNAL_GL_APIENTRY glBlendFunciNULL(GLuint buf, GLenum src, GLenum dst)
+{
+    RecordNullDriverCall(NullEntryPoint::BlendFunci);
+}
 
 void INTERNAL_GL_APIENTRY glBlitFramebufferNULL(GLint srcX0,
                                                 GLint srcY0,
@@ -147,7 +983,9 @@ void INTERNAL_GL_APIENTRY glBlitFramebufferNULL(GLint srcX0,
                                                 GLint dstY1,
                                                 GLbitfield mask,
                                                 GLenum filter)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BlitFramebuffer);
+}
 
 void INTERNAL_GL_APIENTRY glBlitFramebufferEXTNULL(GLint srcX0,
                                                    GLint srcY0,
@@ -159,7 +997,9 @@ void INTERNAL_GL_APIENTRY glBlitFramebufferEXTNULL(GLint srcX0,
                                                    GLint dstY1,
                                                    GLbitfield mask,
                                                    GLenum filter)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BlitFramebufferEXT);
+}
 
 void INTERNAL_GL_APIENTRY glBlitFramebufferNVNULL(GLint srcX0,
                                                   GLint srcY0,
@@ -171,7 +1011,9 @@ void INTERNAL_GL_APIENTRY glBlitFramebufferNVNULL(GLint srcX0,
                                                   GLint dstY1,
                                                   GLbitfield mask,
                                                   GLenum filter)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BlitFramebufferNV);
+}
 
 void INTERNAL_GL_APIENTRY glBlitNamedFramebufferNULL(GLuint readFramebuffer,
                                                      GLuint drawFramebuffer,
@@ -185,52 +1027,72 @@ void INTERNAL_GL_APIENTRY glBlitNamedFramebufferNULL(GLuint readFramebuffer,
                                                      GLint dstY1,
                                                      GLbitfield mask,
                                                      GLenum filter)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BlitNamedFramebuffer);
+}
 
 void INTERNAL_GL_APIENTRY glBufferDataNULL(GLenum target,
                                            GLsizeiptr size,
                                            const void *data,
                                            GLenum usage)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BufferData);
+}
 
 void INTERNAL_GL_APIENTRY glBufferStorageNULL(GLenum target,
                                               GLsizeiptr size,
                                               const void *data,
                                               GLbitfield flags)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BufferStorage);
+}
 
 void INTERNAL_GL_APIENTRY glBufferStorageMemEXTNULL(GLenum target,
                                                     GLsizeiptr size,
                                                     GLuint memory,
                                                     GLuint64 offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BufferStorageMemEXT);
+}
 
 void INTERNAL_GL_APIENTRY glBufferSubDataNULL(GLenum target,
                                               GLintptr offset,
                                               GLsizeiptr size,
                                               const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::BufferSubData);
+}
 
 GLenum INTERNAL_GL_APIENTRY glCheckFramebufferStatusNULL(GLenum target)
 {
+    RecordNullDriverCall(NullEntryPoint::CheckFramebufferStatus);
     return static_cast<GLenum>(0);
 }
 
 GLenum INTERNAL_GL_APIENTRY glCheckNamedFramebufferStatusNULL(GLuint framebuffer, GLenum target)
 {
+    RecordNullDriverCall(NullEntryPoint::CheckNamedFramebufferStatus);
     return static_cast<GLenum>(0);
 }
 
-void INTERNAL_GL_APIENTRY glClampColorNULL(GLenum target, GLenum clamp) {}
+void INTERNAL_GL_APIENTRY glClampColorNULL(GLenum target, GLenum clamp)
+{
+    RecordNullDriverCall(NullEntryPoint::ClampColor);
+}
 
-void INTERNAL_GL_APIENTRY glClearNULL(GLbitfield mask) {}
+void INTERNAL_GL_APIENTRY glClearNULL(GLbitfield mask)
+{
+    RecordNullDriverCall(NullEntryPoint::Clear);
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferDataNULL(GLenum target,
                                                 GLenum internalformat,
                                                 GLenum format,
                                                 GLenum type,
                                                 const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearBufferData);
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferSubDataNULL(GLenum target,
                                                    GLenum internalformat,
@@ -239,36 +1101,56 @@ void INTERNAL_GL_APIENTRY glClearBufferSubDataNULL(GLenum target,
                                                    GLenum format,
                                                    GLenum type,
                                                    const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearBufferSubData);
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferfiNULL(GLenum buffer,
                                               GLint drawbuffer,
                                               GLfloat depth,
                                               GLint stencil)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearBufferfi);
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferfvNULL(GLenum buffer, GLint drawbuffer, const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearBufferfv);
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferivNULL(GLenum buffer, GLint drawbuffer, const GLint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearBufferiv);
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferuivNULL(GLenum buffer, GLint drawbuffer, const GLuint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearBufferuiv);
+}
 
 void INTERNAL_GL_APIENTRY glClearColorNULL(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearColor);
+}
 
-void INTERNAL_GL_APIENTRY glClearDepthNULL(GLdouble depth) {}
+void INTERNAL_GL_APIENTRY glClearDepthNULL(GLdouble depth)
+{
+    RecordNullDriverCall(NullEntryPoint::ClearDepth);
+}
 
-void INTERNAL_GL_APIENTRY glClearDepthfNULL(GLfloat d) {}
+void INTERNAL_GL_APIENTRY glClearDepthfNULL(GLfloat d)
+{
+    RecordNullDriverCall(NullEntryPoint::ClearDepthf);
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedBufferDataNULL(GLuint buffer,
                                                      GLenum internalformat,
                                                      GLenum format,
                                                      GLenum type,
                                                      const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearNamedBufferData);
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedBufferSubDataNULL(GLuint buffer,
                                                         GLenum internalformat,
@@ -277,38 +1159,53 @@ void INTERNAL_GL_APIENTRY glClearNamedBufferSubDataNULL(GLuint buffer,
                                                         GLenum format,
                                                         GLenum type,
                                                         const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearNamedBufferSubData);
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedFramebufferfiNULL(GLuint framebuffer,
                                                         GLenum buffer,
                                                         GLint drawbuffer,
                                                         GLfloat depth,
                                                         GLint stencil)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearNamedFramebufferfi);
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedFramebufferfvNULL(GLuint framebuffer,
                                                         GLenum buffer,
                                                         GLint drawbuffer,
                                                         const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearNamedFramebufferfv);
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedFramebufferivNULL(GLuint framebuffer,
                                                         GLenum buffer,
                                                         GLint drawbuffer,
                                                         const GLint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearNamedFramebufferiv);
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedFramebufferuivNULL(GLuint framebuffer,
                                                          GLenum buffer,
                                                          GLint drawbuffer,
                                                          const GLuint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearNamedFramebufferuiv);
+}
 
-void INTERNAL_GL_APIENTRY glClearStencilNULL(GLint s) {}
+void INTERNAL_GL_APIENTRY glClearStencilNULL(GLint s)
+{
+    RecordNullDriverCall(NullEntryPoint::ClearStencil);
+}
 
 void INTERNAL_GL_APIENTRY
 glClearTexImageNULL(GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearTexImage);
+}
 
 void INTERNAL_GL_APIENTRY glClearTexSubImageNULL(GLuint texture,
                                                  GLint level,
@@ -321,26 +1218,39 @@ void INTERNAL_GL_APIENTRY glClearTexSubImageNULL(GLuint texture,
                                                  GLenum format,
                                                  GLenum type,
                                                  const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ClearTexSubImage);
+}
 
 GLenum INTERNAL_GL_APIENTRY glClientWaitSyncNULL(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
+    RecordNullDriverCall(NullEntryPoint::ClientWaitSync);
     return static_cast<GLenum>(0);
 }
 
-void INTERNAL_GL_APIENTRY glClipControlNULL(GLenum origin, GLenum depth) {}
+void INTERNAL_GL_APIENTRY glClipControlNULL(GLenum origin, GLenum depth)
+{
+    RecordNullDriverCall(NullEntryPoint::ClipControl);
+}
 
 void INTERNAL_GL_APIENTRY glColorMaskNULL(GLboolean red,
                                           GLboolean green,
                                           GLboolean blue,
                                           GLboolean alpha)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ColorMask);
+}
 
 void INTERNAL_GL_APIENTRY
 glColorMaskiNULL(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ColorMaski);
+}
 
-void INTERNAL_GL_APIENTRY glCompileShaderNULL(GLuint shader) {}
+void INTERNAL_GL_APIENTRY glCompileShaderNULL(GLuint shader)
+{
+    RecordNullDriverCall(NullEntryPoint::CompileShader);
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexImage1DNULL(GLenum target,
                                                      GLint level,
@@ -349,7 +1259,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexImage1DNULL(GLenum target,
                                                      GLint border,
                                                      GLsizei imageSize,
                                                      const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CompressedTexImage1D);
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexImage2DNULL(GLenum target,
                                                      GLint level,
@@ -359,7 +1271,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexImage2DNULL(GLenum target,
                                                      GLint border,
                                                      GLsizei imageSize,
                                                      const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CompressedTexImage2D);
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexImage3DNULL(GLenum target,
                                                      GLint level,
@@ -370,7 +1284,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexImage3DNULL(GLenum target,
                                                      GLint border,
                                                      GLsizei imageSize,
                                                      const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CompressedTexImage3D);
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexSubImage1DNULL(GLenum target,
                                                         GLint level,
@@ -379,7 +1295,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexSubImage1DNULL(GLenum target,
                                                         GLenum format,
                                                         GLsizei imageSize,
                                                         const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CompressedTexSubImage1D);
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexSubImage2DNULL(GLenum target,
                                                         GLint level,
@@ -390,7 +1308,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexSubImage2DNULL(GLenum target,
                                                         GLenum format,
                                                         GLsizei imageSize,
                                                         const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CompressedTexSubImage2D);
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexSubImage3DNULL(GLenum target,
                                                         GLint level,
@@ -403,7 +1323,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexSubImage3DNULL(GLenum target,
                                                         GLenum format,
                                                         GLsizei imageSize,
                                                         const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CompressedTexSubImage3D);
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTextureSubImage1DNULL(GLuint texture,
                                                             GLint level,
@@ -412,7 +1334,9 @@ void INTERNAL_GL_APIENTRY glCompressedTextureSubImage1DNULL(GLuint texture,
                                                             GLenum format,
                                                             GLsizei imageSize,
                                                             const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CompressedTextureSubImage1D);
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTextureSubImage2DNULL(GLuint texture,
                                                             GLint level,
@@ -423,7 +1347,9 @@ void INTERNAL_GL_APIENTRY glCompressedTextureSubImage2DNULL(GLuint texture,
                                                             GLenum format,
                                                             GLsizei imageSize,
                                                             const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CompressedTextureSubImage2D);
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTextureSubImage3DNULL(GLuint texture,
                                                             GLint level,
@@ -436,14 +1362,18 @@ void INTERNAL_GL_APIENTRY glCompressedTextureSubImage3DNULL(GLuint texture,
                                                             GLenum format,
                                                             GLsizei imageSize,
                                                             const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CompressedTextureSubImage3D);
+}
 
 void INTERNAL_GL_APIENTRY glCopyBufferSubDataNULL(GLenum readTarget,
                                                   GLenum writeTarget,
                                                   GLintptr readOffset,
                                                   GLintptr writeOffset,
                                                   GLsizeiptr size)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyBufferSubData);
+}
 
 void INTERNAL_GL_APIENTRY glCopyImageSubDataNULL(GLuint srcName,
                                                  GLenum srcTarget,
@@ -460,14 +1390,18 @@ void INTERNAL_GL_APIENTRY glCopyImageSubDataNULL(GLuint srcName,
                                                  GLsizei srcWidth,
                                                  GLsizei srcHeight,
                                                  GLsizei srcDepth)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyImageSubData);
+}
 
 void INTERNAL_GL_APIENTRY glCopyNamedBufferSubDataNULL(GLuint readBuffer,
                                                        GLuint writeBuffer,
                                                        GLintptr readOffset,
                                                        GLintptr writeOffset,
                                                        GLsizeiptr size)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyNamedBufferSubData);
+}
 
 void INTERNAL_GL_APIENTRY glCopyTexImage1DNULL(GLenum target,
                                                GLint level,
@@ -476,7 +1410,9 @@ void INTERNAL_GL_APIENTRY glCopyTexImage1DNULL(GLenum target,
                                                GLint y,
                                                GLsizei width,
                                                GLint border)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyTexImage1D);
+}
 
 void INTERNAL_GL_APIENTRY glCopyTexImage2DNULL(GLenum target,
                                                GLint level,
@@ -486,11 +1422,15 @@ void INTERNAL_GL_APIENTRY glCopyTexImage2DNULL(GLenum target,
                                                GLsizei width,
                                                GLsizei height,
                                                GLint border)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyTexImage2D);
+}
 
 void INTERNAL_GL_APIENTRY
 glCopyTexSubImage1DNULL(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyTexSubImage1D);
+}
 
 void INTERNAL_GL_APIENTRY glCopyTexSubImage2DNULL(GLenum target,
                                                   GLint level,
@@ -500,7 +1440,9 @@ void INTERNAL_GL_APIENTRY glCopyTexSubImage2DNULL(GLenum target,
                                                   GLint y,
                                                   GLsizei width,
                                                   GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyTexSubImage2D);
+}
 
 void INTERNAL_GL_APIENTRY glCopyTexSubImage3DNULL(GLenum target,
                                                   GLint level,
@@ -511,7 +1453,9 @@ void INTERNAL_GL_APIENTRY glCopyTexSubImage3DNULL(GLenum target,
                                                   GLint y,
                                                   GLsizei width,
                                                   GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyTexSubImage3D);
+}
 
 void INTERNAL_GL_APIENTRY glCopyTextureSubImage1DNULL(GLuint texture,
                                                       GLint level,
@@ -519,7 +1463,9 @@ void INTERNAL_GL_APIENTRY glCopyTextureSubImage1DNULL(GLuint texture,
                                                       GLint x,
                                                       GLint y,
                                                       GLsizei width)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyTextureSubImage1D);
+}
 
 void INTERNAL_GL_APIENTRY glCopyTextureSubImage2DNULL(GLuint texture,
                                                       GLint level,
@@ -529,7 +1475,9 @@ void INTERNAL_GL_APIENTRY glCopyTextureSubImage2DNULL(GLuint texture,
                                                       GLint y,
                                                       GLsizei width,
                                                       GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyTextureSubImage2D);
+}
 
 void INTERNAL_GL_APIENTRY glCopyTextureSubImage3DNULL(GLuint texture,
                                                       GLint level,
@@ -540,31 +1488,59 @@ void INTERNAL_GL_APIENTRY glCopyTextureSubImage3DNULL(GLuint texture,
                                                       GLint y,
                                                       GLsizei width,
                                                       GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::CopyTextureSubImage3D);
+}
 
-void INTERNAL_GL_APIENTRY glCoverageModulationNVNULL(GLenum components) {}
+void INTERNAL_GL_APIENTRY glCoverageModulationNVNULL(GLenum components)
+{
+    RecordNullDriverCall(NullEntryPoint::CoverageModulationNV);
+}
 
-void INTERNAL_GL_APIENTRY glCreateBuffersNULL(GLsizei n, GLuint *buffers) {}
+void INTERNAL_GL_APIENTRY glCreateBuffersNULL(GLsizei n, GLuint *buffers)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateBuffers);
+}
 
-void INTERNAL_GL_APIENTRY glCreateFramebuffersNULL(GLsizei n, GLuint *framebuffers) {}
+void INTERNAL_GL_APIENTRY glCreateFramebuffersNULL(GLsizei n, GLuint *framebuffers)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateFramebuffers);
+}
 
-void INTERNAL_GL_APIENTRY glCreateMemoryObjectsEXTNULL(GLsizei n, GLuint *memoryObjects) {}
+void INTERNAL_GL_APIENTRY glCreateMemoryObjectsEXTNULL(GLsizei n, GLuint *memoryObjects)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateMemoryObjectsEXT);
+}
 
 GLuint INTERNAL_GL_APIENTRY glCreateProgramNULL()
 {
+    RecordNullDriverCall(NullEntryPoint::CreateProgram);
     return static_cast<GLuint>(0);
 }
 
-void INTERNAL_GL_APIENTRY glCreateProgramPipelinesNULL(GLsizei n, GLuint *pipelines) {}
+void INTERNAL_GL_APIENTRY glCreateProgramPipelinesNULL(GLsizei n, GLuint *pipelines)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateProgramPipelines);
+}
 
-void INTERNAL_GL_APIENTRY glCreateQueriesNULL(GLenum target, GLsizei n, GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glCreateQueriesNULL(GLenum target, GLsizei n, GLuint *ids)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateQueries);
+}
 
-void INTERNAL_GL_APIENTRY glCreateRenderbuffersNULL(GLsizei n, GLuint *renderbuffers) {}
+void INTERNAL_GL_APIENTRY glCreateRenderbuffersNULL(GLsizei n, GLuint *renderbuffers)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateRenderbuffers);
+}
 
-void INTERNAL_GL_APIENTRY glCreateSamplersNULL(GLsizei n, GLuint *samplers) {}
+void INTERNAL_GL_APIENTRY glCreateSamplersNULL(GLsizei n, GLuint *samplers)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateSamplers);
+}
 
 GLuint INTERNAL_GL_APIENTRY glCreateShaderNULL(GLenum type)
 {
+    RecordNullDriverCall(NullEntryPoint::CreateShader);
     return static_cast<GLuint>(0);
 }
 
@@ -572,18 +1548,34 @@ GLuint INTERNAL_GL_APIENTRY glCreateShaderProgramvNULL(GLenum type,
                                                        GLsizei count,
                                                        const GLchar *const *strings)
 {
+    RecordNullDriverCall(NullEntryPoint::CreateShaderProgramv);
     return static_cast<GLuint>(0);
 }
 
-void INTERNAL_GL_APIENTRY glCreateTexturesNULL(GLenum target, GLsizei n, GLuint *textures) {}
+void INTERNAL_GL_APIENTRY glCreateTexturesNULL(GLenum target, GLsizei n, GLuint *textures)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateTextures);
+}
 
-void INTERNAL_GL_APIENTRY glCreateTransformFeedbacksNULL(GLsizei n, GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glCreateTransformFeedbacksNULL(GLsizei n, GLuint *ids)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateTransformFeedbacks);
+}
 
-void INTERNAL_GL_APIENTRY glCreateVertexArraysNULL(GLsizei n, GLuint *arrays) {}
+void INTERNAL_GL_APIENTRY glCreateVertexArraysNULL(GLsizei n, GLuint *arrays)
+{
+    RecordNullDriverCall(NullEntryPoint::CreateVertexArrays);
+}
 
-void INTERNAL_GL_APIENTRY glCullFaceNULL(GLenum mode) {}
+void INTERNAL_GL_APIENTRY glCullFaceNULL(GLenum mode)
+{
+    RecordNullDriverCall(NullEntryPoint::CullFace);
+}
 
-void INTERNAL_GL_APIENTRY glDebugMessageCallbackNULL(GLDEBUGPROC callback, const void *userParam) {}
+void INTERNAL_GL_APIENTRY glDebugMessageCallbackNULL(GLDEBUGPROC callback, const void *userParam)
+{
+    RecordNullDriverCall(NullEntryPoint::DebugMessageCallback);
+}
 
 void INTERNAL_GL_APIENTRY glDebugMessageControlNULL(GLenum source,
                                                     GLenum type,
@@ -591,7 +1583,9 @@ void INTERNAL_GL_APIENTRY glDebugMessageControlNULL(GLenum source,
                                                     GLsizei count,
                                                     const GLuint *ids,
                                                     GLboolean enabled)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DebugMessageControl);
+}
 
 void INTERNAL_GL_APIENTRY glDebugMessageInsertNULL(GLenum source,
                                                    GLenum type,
@@ -599,115 +1593,226 @@ void INTERNAL_GL_APIENTRY glDebugMessageInsertNULL(GLenum source,
                                                    GLenum severity,
                                                    GLsizei length,
                                                    const GLchar *buf)
-{}
-
-void INTERNAL_GL_APIENTRY glDeleteBuffersNULL(GLsizei n, const GLuint *buffers) {}
+{
+    RecordNullDriverCall(NullEntryPoint::DebugMessageInsert);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteFencesNVNULL(GLsizei n, const GLuint *fences) {}
+void INTERNAL_GL_APIENTRY glDeleteBuffersNULL(GLsizei n, const GLuint *buffers)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteBuffers);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteFramebuffersNULL(GLsizei n, const GLuint *framebuffers) {}
+void INTERNAL_GL_APIENTRY glDeleteFencesNVNULL(GLsizei n, const GLuint *fences)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteFencesNV);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteMemoryObjectsEXTNULL(GLsizei n, const GLuint *memoryObjects) {}
+void INTERNAL_GL_APIENTRY glDeleteFramebuffersNULL(GLsizei n, const GLuint *framebuffers)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteFramebuffers);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteProgramNULL(GLuint program) {}
+void INTERNAL_GL_APIENTRY glDeleteMemoryObjectsEXTNULL(GLsizei n, const GLuint *memoryObjects)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteMemoryObjectsEXT);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteProgramPipelinesNULL(GLsizei n, const GLuint *pipelines) {}
+void INTERNAL_GL_APIENTRY glDeleteProgramNULL(GLuint program)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteProgram);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteQueriesNULL(GLsizei n, const GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glDeleteProgramPipelinesNULL(GLsizei n, const GLuint *pipelines)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteProgramPipelines);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteRenderbuffersNULL(GLsizei n, const GLuint *renderbuffers) {}
+void INTERNAL_GL_APIENTRY glDeleteQueriesNULL(GLsizei n, const GLuint *ids)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteQueries);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteSamplersNULL(GLsizei count, const GLuint *samplers) {}
+void INTERNAL_GL_APIENTRY glDeleteRenderbuffersNULL(GLsizei n, const GLuint *renderbuffers)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteRenderbuffers);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteSemaphoresEXTNULL(GLsizei n, const GLuint *semaphores) {}
+void INTERNAL_GL_APIENTRY glDeleteSamplersNULL(GLsizei count, const GLuint *samplers)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteSamplers);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteShaderNULL(GLuint shader) {}
+void INTERNAL_GL_APIENTRY glDeleteSemaphoresEXTNULL(GLsizei n, const GLuint *semaphores)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteSemaphoresEXT);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteSyncNULL(GLsync sync) {}
+void INTERNAL_GL_APIENTRY glDeleteShaderNULL(GLuint shader)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteShader);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteTexturesNULL(GLsizei n, const GLuint *textures) {}
+void INTERNAL_GL_APIENTRY glDeleteSyncNULL(GLsync sync)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteSync);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteTransformFeedbacksNULL(GLsizei n, const GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glDeleteTexturesNULL(GLsizei n, const GLuint *textures)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteTextures);
+}
 
-void INTERNAL_GL_APIENTRY glDeleteVertexArraysNULL(GLsizei n, const GLuint *arrays) {}
+void INTERNAL_GL_APIENTRY glDeleteTransformFeedbacksNULL(GLsizei n, const GLuint *ids)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteTransformFeedbacks);
+}
 
-void INTERNAL_GL_APIENTRY glDepthFuncNULL(GLenum func) {}
+void INTERNAL_GL_APIENTRY glDeleteVertexArraysNULL(GLsizei n, const GLuint *arrays)
+{
+    RecordNullDriverCall(NullEntryPoint::DeleteVertexArrays);
+}
 
-void INTERNAL_GL_APIENTRY glDepthMaskNULL(GLboolean flag) {}
+void INTERNAL_GL_APIENTRY glDepthFuncNULL(GLenum func)
+{
+    RecordNullDriverCall(NullEntryPoint::DepthFunc);
+}
 
-void INTERNAL_GL_APIENTRY glDepthRangeNULL(GLdouble n, GLdouble f) {}
+void INTERNAL_GL_APIENTRY glDepthMaskNULL(GLboolean flag)
+{
+    RecordNullDriverCall(NullEntryPoint::DepthMask);
+}
 
-void INTERNAL_GL_APIENTRY glDepthRangeArrayvNULL(GLuint first, GLsizei count, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glDepthRangeNULL(GLdouble n, GLdouble f)
+{
+    RecordNullDriverCall(NullEntryPoint::DepthRange);
+}
 
-void INTERNAL_GL_APIENTRY glDepthRangeIndexedNULL(GLuint index, GLdouble n, GLdouble f) {}
+void INTERNAL_GL_APIENTRY glDepthRangeArrayvNULL(GLuint first, GLsizei count, const GLdouble *v)
+{
+    RecordNullDriverCall(NullEntryPoint::DepthRangeArrayv);
+}
 
-void INTERNAL_GL_APIENTRY glDepthRangefNULL(GLfloat n, GLfloat f) {}
+void INTERNAL_GL_APIENTRY glDepthRangeIndexedNULL(GLuint index, GLdouble n, GLdouble f)
+{
+    RecordNullDriverCall(NullEntryPoint::DepthRangeIndexed);
+}
+
+void INTERNAL_GL_APIENTRY glDepthRangefNULL(GLfloat n, GLfloat f)
+{
+    RecordNullDriverCall(NullEntryPoint::DepthRangef);
+}
 
-void INTERNAL_GL_APIENTRY glDetachShaderNULL(GLuint program, GLuint shader) {}
+void INTERNAL_GL_APIENTRY glDetachShaderNULL(GLuint program, GLuint shader)
+{
+    RecordNullDriverCall(NullEntryPoint::DetachShader);
+}
 
-void INTERNAL_GL_APIENTRY glDisableNULL(GLenum cap) {}
+void INTERNAL_GL_APIENTRY glDisableNULL(GLenum cap)
+{
+    RecordNullDriverCall(NullEntryPoint::Disable);
+}
 
-void INTERNAL_GL_APIENTRY glDisableVertexArrayAttribNULL(GLuint vaobj, GLuint index) {}
+void INTERNAL_GL_APIENTRY glDisableVertexArrayAttribNULL(GLuint vaobj, GLuint index)
+{
+    RecordNullDriverCall(NullEntryPoint::DisableVertexArrayAttrib);
+}
 
-void INTERNAL_GL_APIENTRY glDisableVertexAttribArrayNULL(GLuint index) {}
+void INTERNAL_GL_APIENTRY glDisableVertexAttribArrayNULL(GLuint index)
+{
+    RecordNullDriverCall(NullEntryPoint::DisableVertexAttribArray);
+}
 
-void INTERNAL_GL_APIENTRY glDisableiNULL(GLenum target, GLuint index) {}
+void INTERNAL_GL_APIENTRY glDisableiNULL(GLenum target, GLuint index)
+{
+    RecordNullDriverCall(NullEntryPoint::Disablei);
+}
 
 void INTERNAL_GL_APIENTRY glDiscardFramebufferEXTNULL(GLenum target,
                                                       GLsizei numAttachments,
                                                       const GLenum *attachments)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DiscardFramebufferEXT);
+}
 
 void INTERNAL_GL_APIENTRY glDispatchComputeNULL(GLuint num_groups_x,
                                                 GLuint num_groups_y,
                                                 GLuint num_groups_z)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DispatchCompute);
+}
 
-void INTERNAL_GL_APIENTRY glDispatchComputeIndirectNULL(GLintptr indirect) {}
+void INTERNAL_GL_APIENTRY glDispatchComputeIndirectNULL(GLintptr indirect)
+{
+    RecordNullDriverCall(NullEntryPoint::DispatchComputeIndirect);
+}
 
-void INTERNAL_GL_APIENTRY glDrawArraysNULL(GLenum mode, GLint first, GLsizei count) {}
+void INTERNAL_GL_APIENTRY glDrawArraysNULL(GLenum mode, GLint first, GLsizei count)
+{
+    RecordNullDriverCall(NullEntryPoint::DrawArrays);
+}
 
-void INTERNAL_GL_APIENTRY glDrawArraysIndirectNULL(GLenum mode, const void *indirect) {}
+void INTERNAL_GL_APIENTRY glDrawArraysIndirectNULL(GLenum mode, const void *indirect)
+{
+    RecordNullDriverCall(NullEntryPoint::DrawArraysIndirect);
+}
 
 void INTERNAL_GL_APIENTRY glDrawArraysInstancedNULL(GLenum mode,
                                                     GLint first,
                                                     GLsizei count,
                                                     GLsizei instancecount)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawArraysInstanced);
+}
 
 void INTERNAL_GL_APIENTRY glDrawArraysInstancedBaseInstanceNULL(GLenum mode,
                                                                 GLint first,
                                                                 GLsizei count,
                                                                 GLsizei instancecount,
                                                                 GLuint baseinstance)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawArraysInstancedBaseInstance);
+}
 
-void INTERNAL_GL_APIENTRY glDrawBufferNULL(GLenum buf) {}
+void INTERNAL_GL_APIENTRY glDrawBufferNULL(GLenum buf)
+{
+    RecordNullDriverCall(NullEntryPoint::DrawBuffer);
+}
 
-void INTERNAL_GL_APIENTRY glDrawBuffersNULL(GLsizei n, const GLenum *bufs) {}
+void INTERNAL_GL_APIENTRY glDrawBuffersNULL(GLsizei n, const GLenum *bufs)
+{
+    RecordNullDriverCall(NullEntryPoint::DrawBuffers);
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsNULL(GLenum mode,
                                              GLsizei count,
                                              GLenum type,
                                              const void *indices)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawElements);
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsBaseVertexNULL(GLenum mode,
                                                        GLsizei count,
                                                        GLenum type,
                                                        const void *indices,
                                                        GLint basevertex)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawElementsBaseVertex);
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsIndirectNULL(GLenum mode, GLenum type, const void *indirect)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawElementsIndirect);
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsInstancedNULL(GLenum mode,
                                                       GLsizei count,
                                                       GLenum type,
                                                       const void *indices,
                                                       GLsizei instancecount)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawElementsInstanced);
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseInstanceNULL(GLenum mode,
                                                                   GLsizei count,
@@ -715,7 +1820,9 @@ void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseInstanceNULL(GLenum mode,
                                                                   const void *indices,
                                                                   GLsizei instancecount,
                                                                   GLuint baseinstance)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawElementsInstancedBaseInstance);
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseVertexNULL(GLenum mode,
                                                                 GLsizei count,
@@ -723,7 +1830,9 @@ void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseVertexNULL(GLenum mode,
                                                                 const void *indices,
                                                                 GLsizei instancecount,
                                                                 GLint basevertex)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawElementsInstancedBaseVertex);
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseVertexBaseInstanceNULL(GLenum mode,
                                                                             GLsizei count,
@@ -732,7 +1841,9 @@ void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseVertexBaseInstanceNULL(GLen
                                                                             GLsizei instancecount,
                                                                             GLint basevertex,
                                                                             GLuint baseinstance)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawElementsInstancedBaseVertexBaseInstance);
+}
 
 void INTERNAL_GL_APIENTRY glDrawRangeElementsNULL(GLenum mode,
                                                   GLuint start,
@@ -740,7 +1851,9 @@ void INTERNAL_GL_APIENTRY glDrawRangeElementsNULL(GLenum mode,
                                                   GLsizei count,
                                                   GLenum type,
                                                   const void *indices)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawRangeElements);
+}
 
 void INTERNAL_GL_APIENTRY glDrawRangeElementsBaseVertexNULL(GLenum mode,
                                                             GLuint start,
@@ -749,101 +1862,174 @@ void INTERNAL_GL_APIENTRY glDrawRangeElementsBaseVertexNULL(GLenum mode,
                                                             GLenum type,
                                                             const void *indices,
                                                             GLint basevertex)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawRangeElementsBaseVertex);
+}
 
-void INTERNAL_GL_APIENTRY glDrawTransformFeedbackNULL(GLenum mode, GLuint id) {}
+void INTERNAL_GL_APIENTRY glDrawTransformFeedbackNULL(GLenum mode, GLuint id)
+{
+    RecordNullDriverCall(NullEntryPoint::DrawTransformFeedback);
+}
 
 void INTERNAL_GL_APIENTRY glDrawTransformFeedbackInstancedNULL(GLenum mode,
                                                                GLuint id,
                                                                GLsizei instancecount)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawTransformFeedbackInstanced);
+}
 
 void INTERNAL_GL_APIENTRY glDrawTransformFeedbackStreamNULL(GLenum mode, GLuint id, GLuint stream)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawTransformFeedbackStream);
+}
 
 void INTERNAL_GL_APIENTRY glDrawTransformFeedbackStreamInstancedNULL(GLenum mode,
                                                                      GLuint id,
                                                                      GLuint stream,
                                                                      GLsizei instancecount)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::DrawTransformFeedbackStreamInstanced);
+}
 
 void INTERNAL_GL_APIENTRY glEGLImageTargetRenderbufferStorageOESNULL(GLenum target,
                                                                      GLeglImageOES image)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::EGLImageTargetRenderbufferStorageOES);
+}
 
-void INTERNAL_GL_APIENTRY glEGLImageTargetTexture2DOESNULL(GLenum target, GLeglImageOES image) {}
+void INTERNAL_GL_APIENTRY glEGLImageTargetTexture2DOESNULL(GLenum target, GLeglImageOES image)
+{
+    RecordNullDriverCall(NullEntryPoint::EGLImageTargetTexture2DOES);
+}
 
-void INTERNAL_GL_APIENTRY glEnableNULL(GLenum cap) {}
+void INTERNAL_GL_APIENTRY glEnableNULL(GLenum cap)
+{
+    RecordNullDriverCall(NullEntryPoint::Enable);
+}
 
-void INTERNAL_GL_APIENTRY glEnableVertexArrayAttribNULL(GLuint vaobj, GLuint index) {}
+void INTERNAL_GL_APIENTRY glEnableVertexArrayAttribNULL(GLuint vaobj, GLuint index)
+{
+    RecordNullDriverCall(NullEntryPoint::EnableVertexArrayAttrib);
+}
 
-void INTERNAL_GL_APIENTRY glEnableVertexAttribArrayNULL(GLuint index) {}
+void INTERNAL_GL_APIENTRY glEnableVertexAttribArrayNULL(GLuint index)
+{
+    RecordNullDriverCall(NullEntryPoint::EnableVertexAttribArray);
+}
 
-void INTERNAL_GL_APIENTRY glEnableiNULL(GLenum target, GLuint index) {}
+void INTERNAL_GL_APIENTRY glEnableiNULL(GLenum target, GLuint index)
+{
+    RecordNullDriverCall(NullEntryPoint::Enablei);
+}
 
-void INTERNAL_GL_APIENTRY glEndConditionalRenderNULL() {}
+void INTERNAL_GL_APIENTRY glEndConditionalRenderNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::EndConditionalRender);
+}
 
-void INTERNAL_GL_APIENTRY glEndQueryNULL(GLenum target) {}
+void INTERNAL_GL_APIENTRY glEndQueryNULL(GLenum target)
+{
+    RecordNullDriverCall(NullEntryPoint::EndQuery);
+}
 
-void INTERNAL_GL_APIENTRY glEndQueryIndexedNULL(GLenum target, GLuint index) {}
+void INTERNAL_GL_APIENTRY glEndQueryIndexedNULL(GLenum target, GLuint index)
+{
+    RecordNullDriverCall(NullEntryPoint::EndQueryIndexed);
+}
 
-void INTERNAL_GL_APIENTRY glEndTilingQCOMNULL(GLbitfield preserveMask) {}
+void INTERNAL_GL_APIENTRY glEndTilingQCOMNULL(GLbitfield preserveMask)
+{
+    RecordNullDriverCall(NullEntryPoint::EndTilingQCOM);
+}
 
-void INTERNAL_GL_APIENTRY glEndTransformFeedbackNULL() {}
+void INTERNAL_GL_APIENTRY glEndTransformFeedbackNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::EndTransformFeedback);
+}
 
 GLsync INTERNAL_GL_APIENTRY glFenceSyncNULL(GLenum condition, GLbitfield flags)
 {
+    RecordNullDriverCall(NullEntryPoint::FenceSync);
     return static_cast<GLsync>(0);
 }
 
-void INTERNAL_GL_APIENTRY glFinishNULL() {}
+void INTERNAL_GL_APIENTRY glFinishNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::Finish);
+}
 
-void INTERNAL_GL_APIENTRY glFinishFenceNVNULL(GLuint fence) {}
+void INTERNAL_GL_APIENTRY glFinishFenceNVNULL(GLuint fence)
+{
+    RecordNullDriverCall(NullEntryPoint::FinishFenceNV);
+}
 
-void INTERNAL_GL_APIENTRY glFlushNULL() {}
+void INTERNAL_GL_APIENTRY glFlushNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::Flush);
+}
 
 void INTERNAL_GL_APIENTRY glFlushMappedBufferRangeNULL(GLenum target,
                                                        GLintptr offset,
                                                        GLsizeiptr length)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FlushMappedBufferRange);
+}
 
 void INTERNAL_GL_APIENTRY glFlushMappedNamedBufferRangeNULL(GLuint buffer,
                                                             GLintptr offset,
                                                             GLsizeiptr length)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FlushMappedNamedBufferRange);
+}
 
-void INTERNAL_GL_APIENTRY glFramebufferFetchBarrierEXTNULL() {}
+void INTERNAL_GL_APIENTRY glFramebufferFetchBarrierEXTNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferFetchBarrierEXT);
+}
 
-void INTERNAL_GL_APIENTRY glFramebufferParameteriNULL(GLenum target, GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glFramebufferParameteriNULL(GLenum target, GLenum pname, GLint param)
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferParameteri);
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferParameteriMESANULL(GLenum target, GLenum pname, GLint param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferParameteriMESA);
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferRenderbufferNULL(GLenum target,
                                                         GLenum attachment,
                                                         GLenum renderbuffertarget,
                                                         GLuint renderbuffer)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferRenderbuffer);
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTextureNULL(GLenum target,
                                                    GLenum attachment,
                                                    GLuint texture,
                                                    GLint level)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferTexture);
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTexture1DNULL(GLenum target,
                                                      GLenum attachment,
                                                      GLenum textarget,
                                                      GLuint texture,
                                                      GLint level)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferTexture1D);
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTexture2DNULL(GLenum target,
                                                      GLenum attachment,
                                                      GLenum textarget,
                                                      GLuint texture,
                                                      GLint level)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferTexture2D);
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTexture2DMultisampleEXTNULL(GLenum target,
                                                                    GLenum attachment,
@@ -851,7 +2037,9 @@ void INTERNAL_GL_APIENTRY glFramebufferTexture2DMultisampleEXTNULL(GLenum target
                                                                    GLuint texture,
                                                                    GLint level,
                                                                    GLsizei samples)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferTexture2DMultisampleEXT);
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTexture2DMultisampleIMGNULL(GLenum target,
                                                                    GLenum attachment,
@@ -859,7 +2047,9 @@ void INTERNAL_GL_APIENTRY glFramebufferTexture2DMultisampleIMGNULL(GLenum target
                                                                    GLuint texture,
                                                                    GLint level,
                                                                    GLsizei samples)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferTexture2DMultisampleIMG);
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTexture3DNULL(GLenum target,
                                                      GLenum attachment,
@@ -867,14 +2057,18 @@ void INTERNAL_GL_APIENTRY glFramebufferTexture3DNULL(GLenum target,
                                                      GLuint texture,
                                                      GLint level,
                                                      GLint zoffset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferTexture3D);
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTextureLayerNULL(GLenum target,
                                                         GLenum attachment,
                                                         GLuint texture,
                                                         GLint level,
                                                         GLint layer)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferTextureLayer);
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTextureMultiviewOVRNULL(GLenum target,
                                                                GLenum attachment,
@@ -882,41 +2076,87 @@ void INTERNAL_GL_APIENTRY glFramebufferTextureMultiviewOVRNULL(GLenum target,
                                                                GLint level,
                                                                GLint baseViewIndex,
                                                                GLsizei numViews)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::FramebufferTextureMultiviewOVR);
+}
 
-void INTERNAL_GL_APIENTRY glFrontFaceNULL(GLenum mode) {}
+void INTERNAL_GL_APIENTRY glFrontFaceNULL(GLenum mode)
+{
+    RecordNullDriverCall(NullEntryPoint::FrontFace);
+}
 
-void INTERNAL_GL_APIENTRY glGenBuffersNULL(GLsizei n, GLuint *buffers) {}
+void INTERNAL_GL_APIENTRY glGenBuffersNULL(GLsizei n, GLuint *buffers)
+{
+    RecordNullDriverCall(NullEntryPoint::GenBuffers);
+}
 
-void INTERNAL_GL_APIENTRY glGenFencesNVNULL(GLsizei n, GLuint *fences) {}
+void INTERNAL_GL_APIENTRY glGenFencesNVNULL(GLsizei n, GLuint *fences)
+{
+    RecordNullDriverCall(NullEntryPoint::GenFencesNV);
+}
 
-void INTERNAL_GL_APIENTRY glGenFramebuffersNULL(GLsizei n, GLuint *framebuffers) {}
+void INTERNAL_GL_APIENTRY glGenFramebuffersNULL(GLsizei n, GLuint *framebuffers)
+{
+    RecordNullDriverCall(NullEntryPoint::GenFramebuffers);
+}
 
-void INTERNAL_GL_APIENTRY glGenProgramPipelinesNULL(GLsizei n, GLuint *pipelines) {}
+void INTERNAL_GL_APIENTRY glGenProgramPipelinesNULL(GLsizei n, GLuint *pipelines)
+{
+    RecordNullDriverCall(NullEntryPoint::GenProgramPipelines);
+}
 
-void INTERNAL_GL_APIENTRY glGenQueriesNULL(GLsizei n, GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glGenQueriesNULL(GLsizei n, GLuint *ids)
+{
+    RecordNullDriverCall(NullEntryPoint::GenQueries);
+}
 
-void INTERNAL_GL_APIENTRY glGenRenderbuffersNULL(GLsizei n, GLuint *renderbuffers) {}
+void INTERNAL_GL_APIENTRY glGenRenderbuffersNULL(GLsizei n, GLuint *renderbuffers)
+{
+    RecordNullDriverCall(NullEntryPoint::GenRenderbuffers);
+}
 
-void INTERNAL_GL_APIENTRY glGenSamplersNULL(GLsizei count, GLuint *samplers) {}
+void INTERNAL_GL_APIENTRY glGenSamplersNULL(GLsizei count, GLuint *samplers)
+{
+    RecordNullDriverCall(NullEntryPoint::GenSamplers);
+}
 
-void INTERNAL_GL_APIENTRY glGenSemaphoresEXTNULL(GLsizei n, GLuint *semaphores) {}
+void INTERNAL_GL_APIENTRY glGenSemaphoresEXTNULL(GLsizei n, GLuint *semaphores)
+{
+    RecordNullDriverCall(NullEntryPoint::GenSemaphoresEXT);
+}
 
-void INTERNAL_GL_APIENTRY glGenTexturesNULL(GLsizei n, GLuint *textures) {}
+void INTERNAL_GL_APIENTRY glGenTexturesNULL(GLsizei n, GLuint *textures)
+{
+    RecordNullDriverCall(NullEntryPoint::GenTextures);
+}
 
-void INTERNAL_GL_APIENTRY glGenTransformFeedbacksNULL(GLsizei n, GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glGenTransformFeedbacksNULL(GLsizei n, GLuint *ids)
+{
+    RecordNullDriverCall(NullEntryPoint::GenTransformFeedbacks);
+}
 
-void INTERNAL_GL_APIENTRY glGenVertexArraysNULL(GLsizei n, GLuint *arrays) {}
+void INTERNAL_GL_APIENTRY glGenVertexArraysNULL(GLsizei n, GLuint *arrays)
+{
+    RecordNullDriverCall(NullEntryPoint::GenVertexArrays);
+}
 
-void INTERNAL_GL_APIENTRY glGenerateMipmapNULL(GLenum target) {}
+void INTERNAL_GL_APIENTRY glGenerateMipmapNULL(GLenum target)
+{
+    RecordNullDriverCall(NullEntryPoint::GenerateMipmap);
+}
 
-void INTERNAL_GL_APIENTRY glGenerateTextureMipmapNULL(GLuint texture) {}
+void INTERNAL_GL_APIENTRY glGenerateTextureMipmapNULL(GLuint texture)
+{
+    RecordNullDriverCall(NullEntryPoint::GenerateTextureMipmap);
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveAtomicCounterBufferivNULL(GLuint program,
                                                                GLuint bufferIndex,
                                                                GLenum pname,
                                                                GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetActiveAtomicCounterBufferiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveAttribNULL(GLuint program,
                                                 GLuint index,
@@ -925,7 +2165,9 @@ void INTERNAL_GL_APIENTRY glGetActiveAttribNULL(GLuint program,
                                                 GLint *size,
                                                 GLenum *type,
                                                 GLchar *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetActiveAttrib);
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveSubroutineNameNULL(GLuint program,
                                                         GLenum shadertype,
@@ -933,7 +2175,9 @@ void INTERNAL_GL_APIENTRY glGetActiveSubroutineNameNULL(GLuint program,
                                                         GLsizei bufSize,
                                                         GLsizei *length,
                                                         GLchar *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetActiveSubroutineName);
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveSubroutineUniformNameNULL(GLuint program,
                                                                GLenum shadertype,
@@ -941,14 +2185,18 @@ void INTERNAL_GL_APIENTRY glGetActiveSubroutineUniformNameNULL(GLuint program,
                                                                GLsizei bufSize,
                                                                GLsizei *length,
                                                                GLchar *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetActiveSubroutineUniformName);
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveSubroutineUniformivNULL(GLuint program,
                                                              GLenum shadertype,
                                                              GLuint index,
                                                              GLenum pname,
                                                              GLint *values)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetActiveSubroutineUniformiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveUniformNULL(GLuint program,
                                                  GLuint index,
@@ -957,70 +2205,104 @@ void INTERNAL_GL_APIENTRY glGetActiveUniformNULL(GLuint program,
                                                  GLint *size,
                                                  GLenum *type,
                                                  GLchar *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetActiveUniform);
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveUniformBlockNameNULL(GLuint program,
                                                           GLuint uniformBlockIndex,
                                                           GLsizei bufSize,
                                                           GLsizei *length,
                                                           GLchar *uniformBlockName)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetActiveUniformBlockName);
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveUniformBlockivNULL(GLuint program,
                                                         GLuint uniformBlockIndex,
                                                         GLenum pname,
                                                         GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetActiveUniformBlockiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveUniformNameNULL(GLuint program,
                                                      GLuint uniformIndex,
                                                      GLsizei bufSize,
                                                      GLsizei *length,
                                                      GLchar *uniformName)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetActiveUniformName);
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveUniformsivNULL(GLuint program,
                                                     GLsizei uniformCount,
                                                     const GLuint *uniformIndices,
                                                     GLenum pname,
                                                     GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetActiveUniformsiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetAttachedShadersNULL(GLuint program,
                                                    GLsizei maxCount,
                                                    GLsizei *count,
                                                    GLuint *shaders)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetAttachedShaders);
+}
 
 GLint INTERNAL_GL_APIENTRY glGetAttribLocationNULL(GLuint program, const GLchar *name)
 {
+    RecordNullDriverCall(NullEntryPoint::GetAttribLocation);
     return static_cast<GLint>(0);
 }
 
-void INTERNAL_GL_APIENTRY glGetBooleani_vNULL(GLenum target, GLuint index, GLboolean *data) {}
+void INTERNAL_GL_APIENTRY glGetBooleani_vNULL(GLenum target, GLuint index, GLboolean *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetBooleani_v);
+}
 
-void INTERNAL_GL_APIENTRY glGetBooleanvNULL(GLenum pname, GLboolean *data) {}
+void INTERNAL_GL_APIENTRY glGetBooleanvNULL(GLenum pname, GLboolean *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetBooleanv);
+}
 
 void INTERNAL_GL_APIENTRY glGetBufferParameteri64vNULL(GLenum target, GLenum pname, GLint64 *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetBufferParameteri64v);
+}
 
-void INTERNAL_GL_APIENTRY glGetBufferParameterivNULL(GLenum target, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetBufferParameterivNULL(GLenum target, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetBufferParameteriv);
+}
 
-void INTERNAL_GL_APIENTRY glGetBufferPointervNULL(GLenum target, GLenum pname, void **params) {}
+void INTERNAL_GL_APIENTRY glGetBufferPointervNULL(GLenum target, GLenum pname, void **params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetBufferPointerv);
+}
 
 void INTERNAL_GL_APIENTRY glGetBufferSubDataNULL(GLenum target,
                                                  GLintptr offset,
                                                  GLsizeiptr size,
                                                  void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetBufferSubData);
+}
 
-void INTERNAL_GL_APIENTRY glGetCompressedTexImageNULL(GLenum target, GLint level, void *img) {}
+void INTERNAL_GL_APIENTRY glGetCompressedTexImageNULL(GLenum target, GLint level, void *img)
+{
+    RecordNullDriverCall(NullEntryPoint::GetCompressedTexImage);
+}
 
 void INTERNAL_GL_APIENTRY glGetCompressedTextureImageNULL(GLuint texture,
                                                           GLint level,
                                                           GLsizei bufSize,
                                                           void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetCompressedTextureImage);
+}
 
 void INTERNAL_GL_APIENTRY glGetCompressedTextureSubImageNULL(GLuint texture,
                                                              GLint level,
@@ -1032,7 +2314,9 @@ void INTERNAL_GL_APIENTRY glGetCompressedTextureSubImageNULL(GLuint texture,
                                                              GLsizei depth,
                                                              GLsizei bufSize,
                                                              void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetCompressedTextureSubImage);
+}
 
 GLuint INTERNAL_GL_APIENTRY glGetDebugMessageLogNULL(GLuint count,
                                                      GLsizei bufSize,
@@ -1043,31 +2327,50 @@ GLuint INTERNAL_GL_APIENTRY glGetDebugMessageLogNULL(GLuint count,
                                                      GLsizei *lengths,
                                                      GLchar *messageLog)
 {
+    RecordNullDriverCall(NullEntryPoint::GetDebugMessageLog);
     return static_cast<GLuint>(0);
 }
 
-void INTERNAL_GL_APIENTRY glGetDoublei_vNULL(GLenum target, GLuint index, GLdouble *data) {}
+void INTERNAL_GL_APIENTRY glGetDoublei_vNULL(GLenum target, GLuint index, GLdouble *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetDoublei_v);
+}
 
-void INTERNAL_GL_APIENTRY glGetDoublevNULL(GLenum pname, GLdouble *data) {}
+void INTERNAL_GL_APIENTRY glGetDoublevNULL(GLenum pname, GLdouble *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetDoublev);
+}
 
 GLenum INTERNAL_GL_APIENTRY glGetErrorNULL()
 {
+    RecordNullDriverCall(NullEntryPoint::GetError);
     return static_cast<GLenum>(0);
 }
 
-void INTERNAL_GL_APIENTRY glGetFenceivNVNULL(GLuint fence, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetFenceivNVNULL(GLuint fence, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetFenceivNV);
+}
 
-void INTERNAL_GL_APIENTRY glGetFloati_vNULL(GLenum target, GLuint index, GLfloat *data) {}
+void INTERNAL_GL_APIENTRY glGetFloati_vNULL(GLenum target, GLuint index, GLfloat *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetFloati_v);
+}
 
-void INTERNAL_GL_APIENTRY glGetFloatvNULL(GLenum pname, GLfloat *data) {}
+void INTERNAL_GL_APIENTRY glGetFloatvNULL(GLenum pname, GLfloat *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetFloatv);
+}
 
 GLint INTERNAL_GL_APIENTRY glGetFragDataIndexNULL(GLuint program, const GLchar *name)
 {
+    RecordNullDriverCall(NullEntryPoint::GetFragDataIndex);
     return static_cast<GLint>(0);
 }
 
 GLint INTERNAL_GL_APIENTRY glGetFragDataLocationNULL(GLuint program, const GLchar *name)
 {
+    RecordNullDriverCall(NullEntryPoint::GetFragDataLocation);
     return static_cast<GLint>(0);
 }
 
@@ -1075,25 +2378,42 @@ void INTERNAL_GL_APIENTRY glGetFramebufferAttachmentParameterivNULL(GLenum targe
                                                                     GLenum attachment,
                                                                     GLenum pname,
                                                                     GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetFramebufferAttachmentParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glGetFramebufferParameterivNULL(GLenum target,
                                                           GLenum pname,
                                                           GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetFramebufferParameteriv);
+}
 
 GLenum INTERNAL_GL_APIENTRY glGetGraphicsResetStatusNULL()
 {
+    RecordNullDriverCall(NullEntryPoint::GetGraphicsResetStatus);
     return static_cast<GLenum>(0);
 }
 
-void INTERNAL_GL_APIENTRY glGetInteger64i_vNULL(GLenum target, GLuint index, GLint64 *data) {}
+void INTERNAL_GL_APIENTRY glGetInteger64i_vNULL(GLenum target, GLuint index, GLint64 *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetInteger64i_v);
+}
 
-void INTERNAL_GL_APIENTRY glGetInteger64vNULL(GLenum pname, GLint64 *data) {}
+void INTERNAL_GL_APIENTRY glGetInteger64vNULL(GLenum pname, GLint64 *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetInteger64v);
+}
 
-void INTERNAL_GL_APIENTRY glGetIntegeri_vNULL(GLenum target, GLuint index, GLint *data) {}
+void INTERNAL_GL_APIENTRY glGetIntegeri_vNULL(GLenum target, GLuint index, GLint *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetIntegeri_v);
+}
 
-void INTERNAL_GL_APIENTRY glGetIntegervNULL(GLenum pname, GLint *data) {}
+void INTERNAL_GL_APIENTRY glGetIntegervNULL(GLenum pname, GLint *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetIntegerv);
+}
 
 void INTERNAL_GL_APIENTRY glGetInternalformatSampleivNVNULL(GLenum target,
                                                             GLenum internalformat,
@@ -1101,111 +2421,154 @@ void INTERNAL_GL_APIENTRY glGetInternalformatSampleivNVNULL(GLenum target,
                                                             GLenum pname,
                                                             GLsizei count,
                                                             GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetInternalformatSampleivNV);
+}
 
 void INTERNAL_GL_APIENTRY glGetInternalformati64vNULL(GLenum target,
                                                       GLenum internalformat,
                                                       GLenum pname,
                                                       GLsizei count,
                                                       GLint64 *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetInternalformati64v);
+}
 
 void INTERNAL_GL_APIENTRY glGetInternalformativNULL(GLenum target,
                                                     GLenum internalformat,
                                                     GLenum pname,
                                                     GLsizei count,
                                                     GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetInternalformativ);
+}
 
 void INTERNAL_GL_APIENTRY glGetMemoryObjectParameterivEXTNULL(GLuint memoryObject,
                                                               GLenum pname,
                                                               GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetMemoryObjectParameterivEXT);
+}
 
-void INTERNAL_GL_APIENTRY glGetMultisamplefvNULL(GLenum pname, GLuint index, GLfloat *val) {}
+void INTERNAL_GL_APIENTRY glGetMultisamplefvNULL(GLenum pname, GLuint index, GLfloat *val)
+{
+    RecordNullDriverCall(NullEntryPoint::GetMultisamplefv);
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedBufferParameteri64vNULL(GLuint buffer,
                                                             GLenum pname,
                                                             GLint64 *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetNamedBufferParameteri64v);
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedBufferParameterivNULL(GLuint buffer,
                                                           GLenum pname,
                                                           GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetNamedBufferParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedBufferPointervNULL(GLuint buffer, GLenum pname, void **params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetNamedBufferPointerv);
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedBufferSubDataNULL(GLuint buffer,
                                                       GLintptr offset,
                                                       GLsizeiptr size,
                                                       void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetNamedBufferSubData);
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedFramebufferAttachmentParameterivNULL(GLuint framebuffer,
                                                                          GLenum attachment,
                                                                          GLenum pname,
                                                                          GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetNamedFramebufferAttachmentParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedFramebufferParameterivNULL(GLuint framebuffer,
                                                                GLenum pname,
                                                                GLint *param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetNamedFramebufferParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedRenderbufferParameterivNULL(GLuint renderbuffer,
                                                                 GLenum pname,
                                                                 GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetNamedRenderbufferParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glGetObjectLabelNULL(GLenum identifier,
                                                GLuint name,
                                                GLsizei bufSize,
                                                GLsizei *length,
                                                GLchar *label)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetObjectLabel);
+}
 
 void INTERNAL_GL_APIENTRY glGetObjectPtrLabelNULL(const void *ptr,
                                                   GLsizei bufSize,
                                                   GLsizei *length,
                                                   GLchar *label)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetObjectPtrLabel);
+}
 
-void INTERNAL_GL_APIENTRY glGetPointervNULL(GLenum pname, void **params) {}
+void INTERNAL_GL_APIENTRY glGetPointervNULL(GLenum pname, void **params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetPointerv);
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramBinaryNULL(GLuint program,
                                                  GLsizei bufSize,
                                                  GLsizei *length,
                                                  GLenum *binaryFormat,
                                                  void *binary)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetProgramBinary);
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramInfoLogNULL(GLuint program,
                                                   GLsizei bufSize,
                                                   GLsizei *length,
                                                   GLchar *infoLog)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetProgramInfoLog);
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramInterfaceivNULL(GLuint program,
                                                       GLenum programInterface,
                                                       GLenum pname,
                                                       GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetProgramInterfaceiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramPipelineInfoLogNULL(GLuint pipeline,
                                                           GLsizei bufSize,
                                                           GLsizei *length,
                                                           GLchar *infoLog)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetProgramPipelineInfoLog);
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramPipelineivNULL(GLuint pipeline, GLenum pname, GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetProgramPipelineiv);
+}
 
 GLuint INTERNAL_GL_APIENTRY glGetProgramResourceIndexNULL(GLuint program,
                                                           GLenum programInterface,
                                                           const GLchar *name)
 {
+    RecordNullDriverCall(NullEntryPoint::GetProgramResourceIndex);
     return static_cast<GLuint>(0);
 }
 
@@ -1213,6 +2576,7 @@ GLint INTERNAL_GL_APIENTRY glGetProgramResourceLocationNULL(GLuint program,
                                                             GLenum programInterface,
                                                             const GLchar *name)
 {
+    RecordNullDriverCall(NullEntryPoint::GetProgramResourceLocation);
     return static_cast<GLint>(0);
 }
 
@@ -1220,6 +2584,7 @@ GLint INTERNAL_GL_APIENTRY glGetProgramResourceLocationIndexNULL(GLuint program,
                                                                  GLenum programInterface,
                                                                  const GLchar *name)
 {
+    RecordNullDriverCall(NullEntryPoint::GetProgramResourceLocationIndex);
     return static_cast<GLint>(0);
 }
 
@@ -1229,7 +2594,9 @@ void INTERNAL_GL_APIENTRY glGetProgramResourceNameNULL(GLuint program,
                                                        GLsizei bufSize,
                                                        GLsizei *length,
                                                        GLchar *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetProgramResourceName);
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramResourceivNULL(GLuint program,
                                                      GLenum programInterface,
@@ -1239,107 +2606,162 @@ void INTERNAL_GL_APIENTRY glGetProgramResourceivNULL(GLuint program,
                                                      GLsizei count,
                                                      GLsizei *length,
                                                      GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetProgramResourceiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramStageivNULL(GLuint program,
                                                   GLenum shadertype,
                                                   GLenum pname,
                                                   GLint *values)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetProgramStageiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetProgramivNULL(GLuint program, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetProgramivNULL(GLuint program, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetProgramiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetQueryBufferObjecti64vNULL(GLuint id,
                                                          GLuint buffer,
                                                          GLenum pname,
                                                          GLintptr offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryBufferObjecti64v);
+}
 
 void INTERNAL_GL_APIENTRY glGetQueryBufferObjectivNULL(GLuint id,
                                                        GLuint buffer,
                                                        GLenum pname,
                                                        GLintptr offset)
-{}
-
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryBufferObjectiv);
+}
+
 void INTERNAL_GL_APIENTRY glGetQueryBufferObjectui64vNULL(GLuint id,
                                                           GLuint buffer,
                                                           GLenum pname,
                                                           GLintptr offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryBufferObjectui64v);
+}
 
 void INTERNAL_GL_APIENTRY glGetQueryBufferObjectuivNULL(GLuint id,
                                                         GLuint buffer,
                                                         GLenum pname,
                                                         GLintptr offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryBufferObjectuiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetQueryIndexedivNULL(GLenum target,
                                                   GLuint index,
                                                   GLenum pname,
                                                   GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryIndexediv);
+}
 
-void INTERNAL_GL_APIENTRY glGetQueryObjecti64vNULL(GLuint id, GLenum pname, GLint64 *params) {}
+void INTERNAL_GL_APIENTRY glGetQueryObjecti64vNULL(GLuint id, GLenum pname, GLint64 *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryObjecti64v);
+}
 
-void INTERNAL_GL_APIENTRY glGetQueryObjectivNULL(GLuint id, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetQueryObjectivNULL(GLuint id, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryObjectiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetQueryObjectui64vNULL(GLuint id, GLenum pname, GLuint64 *params) {}
+void INTERNAL_GL_APIENTRY glGetQueryObjectui64vNULL(GLuint id, GLenum pname, GLuint64 *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryObjectui64v);
+}
 
-void INTERNAL_GL_APIENTRY glGetQueryObjectuivNULL(GLuint id, GLenum pname, GLuint *params) {}
+void INTERNAL_GL_APIENTRY glGetQueryObjectuivNULL(GLuint id, GLenum pname, GLuint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryObjectuiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetQueryivNULL(GLenum target, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetQueryivNULL(GLenum target, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetQueryiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetRenderbufferParameterivNULL(GLenum target,
                                                            GLenum pname,
                                                            GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetRenderbufferParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glGetSamplerParameterIivNULL(GLuint sampler, GLenum pname, GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetSamplerParameterIiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetSamplerParameterIuivNULL(GLuint sampler,
                                                         GLenum pname,
                                                         GLuint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetSamplerParameterIuiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetSamplerParameterfvNULL(GLuint sampler, GLenum pname, GLfloat *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetSamplerParameterfv);
+}
 
 void INTERNAL_GL_APIENTRY glGetSamplerParameterivNULL(GLuint sampler, GLenum pname, GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetSamplerParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glGetSemaphoreParameterui64vEXTNULL(GLuint semaphore,
                                                               GLenum pname,
                                                               GLuint64 *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetSemaphoreParameterui64vEXT);
+}
 
 void INTERNAL_GL_APIENTRY glGetShaderInfoLogNULL(GLuint shader,
                                                  GLsizei bufSize,
                                                  GLsizei *length,
                                                  GLchar *infoLog)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetShaderInfoLog);
+}
 
 void INTERNAL_GL_APIENTRY glGetShaderPrecisionFormatNULL(GLenum shadertype,
                                                          GLenum precisiontype,
                                                          GLint *range,
                                                          GLint *precision)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetShaderPrecisionFormat);
+}
 
 void INTERNAL_GL_APIENTRY glGetShaderSourceNULL(GLuint shader,
                                                 GLsizei bufSize,
                                                 GLsizei *length,
                                                 GLchar *source)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetShaderSource);
+}
 
-void INTERNAL_GL_APIENTRY glGetShaderivNULL(GLuint shader, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetShaderivNULL(GLuint shader, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetShaderiv);
+}
 
 const GLubyte *INTERNAL_GL_APIENTRY glGetStringNULL(GLenum name)
 {
+    RecordNullDriverCall(NullEntryPoint::GetString);
     return static_cast<const GLubyte *>(0);
 }
 
 const GLubyte *INTERNAL_GL_APIENTRY glGetStringiNULL(GLenum name, GLuint index)
 {
+    RecordNullDriverCall(NullEntryPoint::GetStringi);
     return static_cast<const GLubyte *>(0);
 }
 
@@ -1347,6 +2769,7 @@ GLuint INTERNAL_GL_APIENTRY glGetSubroutineIndexNULL(GLuint program,
                                                      GLenum shadertype,
                                                      const GLchar *name)
 {
+    RecordNullDriverCall(NullEntryPoint::GetSubroutineIndex);
     return static_cast<GLuint>(0);
 }
 
@@ -1354,36 +2777,57 @@ GLint INTERNAL_GL_APIENTRY glGetSubroutineUniformLocationNULL(GLuint program,
                                                               GLenum shadertype,
                                                               const GLchar *name)
 {
+    RecordNullDriverCall(NullEntryPoint::GetSubroutineUniformLocation);
     return static_cast<GLint>(0);
 }
 
 void INTERNAL_GL_APIENTRY
 glGetSyncivNULL(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetSynciv);
+}
 
 void INTERNAL_GL_APIENTRY
 glGetTexImageNULL(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTexImage);
+}
 
 void INTERNAL_GL_APIENTRY glGetTexLevelParameterfvNULL(GLenum target,
                                                        GLint level,
                                                        GLenum pname,
                                                        GLfloat *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTexLevelParameterfv);
+}
 
 void INTERNAL_GL_APIENTRY glGetTexLevelParameterivNULL(GLenum target,
                                                        GLint level,
                                                        GLenum pname,
                                                        GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTexLevelParameteriv);
+}
 
-void INTERNAL_GL_APIENTRY glGetTexParameterIivNULL(GLenum target, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetTexParameterIivNULL(GLenum target, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetTexParameterIiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetTexParameterIuivNULL(GLenum target, GLenum pname, GLuint *params) {}
+void INTERNAL_GL_APIENTRY glGetTexParameterIuivNULL(GLenum target, GLenum pname, GLuint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetTexParameterIuiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetTexParameterfvNULL(GLenum target, GLenum pname, GLfloat *params) {}
+void INTERNAL_GL_APIENTRY glGetTexParameterfvNULL(GLenum target, GLenum pname, GLfloat *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetTexParameterfv);
+}
 
-void INTERNAL_GL_APIENTRY glGetTexParameterivNULL(GLenum target, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetTexParameterivNULL(GLenum target, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetTexParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureImageNULL(GLuint texture,
                                                 GLint level,
@@ -1391,33 +2835,47 @@ void INTERNAL_GL_APIENTRY glGetTextureImageNULL(GLuint texture,
                                                 GLenum type,
                                                 GLsizei bufSize,
                                                 void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTextureImage);
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureLevelParameterfvNULL(GLuint texture,
                                                            GLint level,
                                                            GLenum pname,
                                                            GLfloat *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTextureLevelParameterfv);
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureLevelParameterivNULL(GLuint texture,
                                                            GLint level,
                                                            GLenum pname,
                                                            GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTextureLevelParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureParameterIivNULL(GLuint texture, GLenum pname, GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTextureParameterIiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureParameterIuivNULL(GLuint texture,
                                                         GLenum pname,
                                                         GLuint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTextureParameterIuiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureParameterfvNULL(GLuint texture, GLenum pname, GLfloat *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTextureParameterfv);
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureParameterivNULL(GLuint texture, GLenum pname, GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTextureParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureSubImageNULL(GLuint texture,
                                                    GLint level,
@@ -1431,7 +2889,9 @@ void INTERNAL_GL_APIENTRY glGetTextureSubImageNULL(GLuint texture,
                                                    GLenum type,
                                                    GLsizei bufSize,
                                                    void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTextureSubImage);
+}
 
 void INTERNAL_GL_APIENTRY glGetTransformFeedbackVaryingNULL(GLuint program,
                                                             GLuint index,
@@ -1440,25 +2900,35 @@ void INTERNAL_GL_APIENTRY glGetTransformFeedbackVaryingNULL(GLuint program,
                                                             GLsizei *size,
                                                             GLenum *type,
                                                             GLchar *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTransformFeedbackVarying);
+}
 
 void INTERNAL_GL_APIENTRY glGetTransformFeedbacki64_vNULL(GLuint xfb,
                                                           GLenum pname,
                                                           GLuint index,
                                                           GLint64 *param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTransformFeedbacki64_v);
+}
 
 void INTERNAL_GL_APIENTRY glGetTransformFeedbacki_vNULL(GLuint xfb,
                                                         GLenum pname,
                                                         GLuint index,
                                                         GLint *param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetTransformFeedbacki_v);
+}
 
-void INTERNAL_GL_APIENTRY glGetTransformFeedbackivNULL(GLuint xfb, GLenum pname, GLint *param) {}
+void INTERNAL_GL_APIENTRY glGetTransformFeedbackivNULL(GLuint xfb, GLenum pname, GLint *param)
+{
+    RecordNullDriverCall(NullEntryPoint::GetTransformFeedbackiv);
+}
 
 GLuint INTERNAL_GL_APIENTRY glGetUniformBlockIndexNULL(GLuint program,
                                                        const GLchar *uniformBlockName)
 {
+    RecordNullDriverCall(NullEntryPoint::GetUniformBlockIndex);
     return static_cast<GLuint>(0);
 }
 
@@ -1466,64 +2936,116 @@ void INTERNAL_GL_APIENTRY glGetUniformIndicesNULL(GLuint program,
                                                   GLsizei uniformCount,
                                                   const GLchar *const *uniformNames,
                                                   GLuint *uniformIndices)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetUniformIndices);
+}
 
 GLint INTERNAL_GL_APIENTRY glGetUniformLocationNULL(GLuint program, const GLchar *name)
 {
+    RecordNullDriverCall(NullEntryPoint::GetUniformLocation);
     return static_cast<GLint>(0);
 }
 
 void INTERNAL_GL_APIENTRY glGetUniformSubroutineuivNULL(GLenum shadertype,
                                                         GLint location,
                                                         GLuint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetUniformSubroutineuiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetUniformdvNULL(GLuint program, GLint location, GLdouble *params) {}
+void INTERNAL_GL_APIENTRY glGetUniformdvNULL(GLuint program, GLint location, GLdouble *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetUniformdv);
+}
 
-void INTERNAL_GL_APIENTRY glGetUniformfvNULL(GLuint program, GLint location, GLfloat *params) {}
+void INTERNAL_GL_APIENTRY glGetUniformfvNULL(GLuint program, GLint location, GLfloat *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetUniformfv);
+}
 
-void INTERNAL_GL_APIENTRY glGetUniformivNULL(GLuint program, GLint location, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetUniformivNULL(GLuint program, GLint location, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetUniformiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetUniformuivNULL(GLuint program, GLint location, GLuint *params) {}
+void INTERNAL_GL_APIENTRY glGetUniformuivNULL(GLuint program, GLint location, GLuint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetUniformuiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetUnsignedBytei_vEXTNULL(GLenum target, GLuint index, GLubyte *data) {}
+void INTERNAL_GL_APIENTRY glGetUnsignedBytei_vEXTNULL(GLenum target, GLuint index, GLubyte *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetUnsignedBytei_vEXT);
+}
 
-void INTERNAL_GL_APIENTRY glGetUnsignedBytevEXTNULL(GLenum pname, GLubyte *data) {}
+void INTERNAL_GL_APIENTRY glGetUnsignedBytevEXTNULL(GLenum pname, GLubyte *data)
+{
+    RecordNullDriverCall(NullEntryPoint::GetUnsignedBytevEXT);
+}
 
 void INTERNAL_GL_APIENTRY glGetVertexArrayIndexed64ivNULL(GLuint vaobj,
                                                           GLuint index,
                                                           GLenum pname,
                                                           GLint64 *param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetVertexArrayIndexed64iv);
+}
 
 void INTERNAL_GL_APIENTRY glGetVertexArrayIndexedivNULL(GLuint vaobj,
                                                         GLuint index,
                                                         GLenum pname,
                                                         GLint *param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetVertexArrayIndexediv);
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexArrayivNULL(GLuint vaobj, GLenum pname, GLint *param) {}
+void INTERNAL_GL_APIENTRY glGetVertexArrayivNULL(GLuint vaobj, GLenum pname, GLint *param)
+{
+    RecordNullDriverCall(NullEntryPoint::GetVertexArrayiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribIivNULL(GLuint index, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribIivNULL(GLuint index, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetVertexAttribIiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribIuivNULL(GLuint index, GLenum pname, GLuint *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribIuivNULL(GLuint index, GLenum pname, GLuint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetVertexAttribIuiv);
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribLdvNULL(GLuint index, GLenum pname, GLdouble *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribLdvNULL(GLuint index, GLenum pname, GLdouble *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetVertexAttribLdv);
+}
 
 void INTERNAL_GL_APIENTRY glGetVertexAttribPointervNULL(GLuint index, GLenum pname, void **pointer)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetVertexAttribPointerv);
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribdvNULL(GLuint index, GLenum pname, GLdouble *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribdvNULL(GLuint index, GLenum pname, GLdouble *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetVertexAttribdv);
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribfvNULL(GLuint index, GLenum pname, GLfloat *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribfvNULL(GLuint index, GLenum pname, GLfloat *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetVertexAttribfv);
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribivNULL(GLuint index, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribivNULL(GLuint index, GLenum pname, GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::GetVertexAttribiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetnCompressedTexImageNULL(GLenum target,
                                                        GLint lod,
                                                        GLsizei bufSize,
                                                        void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetnCompressedTexImage);
+}
 
 void INTERNAL_GL_APIENTRY glGetnTexImageNULL(GLenum target,
                                              GLint level,
@@ -1531,83 +3053,120 @@ void INTERNAL_GL_APIENTRY glGetnTexImageNULL(GLenum target,
                                              GLenum type,
                                              GLsizei bufSize,
                                              void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetnTexImage);
+}
 
 void INTERNAL_GL_APIENTRY glGetnUniformdvNULL(GLuint program,
                                               GLint location,
                                               GLsizei bufSize,
                                               GLdouble *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetnUniformdv);
+}
 
 void INTERNAL_GL_APIENTRY glGetnUniformfvNULL(GLuint program,
                                               GLint location,
                                               GLsizei bufSize,
                                               GLfloat *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetnUniformfv);
+}
 
 void INTERNAL_GL_APIENTRY glGetnUniformivNULL(GLuint program,
                                               GLint location,
                                               GLsizei bufSize,
                                               GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetnUniformiv);
+}
 
 void INTERNAL_GL_APIENTRY glGetnUniformuivNULL(GLuint program,
                                                GLint location,
                                                GLsizei bufSize,
                                                GLuint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::GetnUniformuiv);
+}
 
-void INTERNAL_GL_APIENTRY glHintNULL(GLenum target, GLenum mode) {}
+void INTERNAL_GL_APIENTRY glHintNULL(GLenum target, GLenum mode)
+{
+    RecordNullDriverCall(NullEntryPoint::Hint);
+}
 
 void INTERNAL_GL_APIENTRY glImportMemoryFdEXTNULL(GLuint memory,
                                                   GLuint64 size,
                                                   GLenum handleType,
                                                   GLint fd)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ImportMemoryFdEXT);
+}
 
 void INTERNAL_GL_APIENTRY glImportMemoryWin32HandleEXTNULL(GLuint memory,
                                                            GLuint64 size,
                                                            GLenum handleType,
                                                            void *handle)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ImportMemoryWin32HandleEXT);
+}
 
 void INTERNAL_GL_APIENTRY glImportMemoryWin32NameEXTNULL(GLuint memory,
                                                          GLuint64 size,
                                                          GLenum handleType,
                                                          const void *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ImportMemoryWin32NameEXT);
+}
 
 void INTERNAL_GL_APIENTRY glImportSemaphoreFdEXTNULL(GLuint semaphore, GLenum handleType, GLint fd)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ImportSemaphoreFdEXT);
+}
 
 void INTERNAL_GL_APIENTRY glImportSemaphoreWin32HandleEXTNULL(GLuint semaphore,
                                                               GLenum handleType,
                                                               void *handle)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ImportSemaphoreWin32HandleEXT);
+}
 
 void INTERNAL_GL_APIENTRY glImportSemaphoreWin32NameEXTNULL(GLuint semaphore,
                                                             GLenum handleType,
                                                             const void *name)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ImportSemaphoreWin32NameEXT);
+}
 
-void INTERNAL_GL_APIENTRY glInsertEventMarkerEXTNULL(GLsizei length, const GLchar *marker) {}
+void INTERNAL_GL_APIENTRY glInsertEventMarkerEXTNULL(GLsizei length, const GLchar *marker)
+{
+    RecordNullDriverCall(NullEntryPoint::InsertEventMarkerEXT);
+}
 
-void INTERNAL_GL_APIENTRY glInvalidateBufferDataNULL(GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glInvalidateBufferDataNULL(GLuint buffer)
+{
+    RecordNullDriverCall(NullEntryPoint::InvalidateBufferData);
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateBufferSubDataNULL(GLuint buffer,
                                                         GLintptr offset,
                                                         GLsizeiptr length)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::InvalidateBufferSubData);
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateFramebufferNULL(GLenum target,
                                                       GLsizei numAttachments,
                                                       const GLenum *attachments)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::InvalidateFramebuffer);
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateNamedFramebufferDataNULL(GLuint framebuffer,
                                                                GLsizei numAttachments,
                                                                const GLenum *attachments)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::InvalidateNamedFramebufferData);
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateNamedFramebufferSubDataNULL(GLuint framebuffer,
                                                                   GLsizei numAttachments,
@@ -1616,7 +3175,9 @@ void INTERNAL_GL_APIENTRY glInvalidateNamedFramebufferSubDataNULL(GLuint framebu
                                                                   GLint y,
                                                                   GLsizei width,
                                                                   GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::InvalidateNamedFramebufferSubData);
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateSubFramebufferNULL(GLenum target,
                                                          GLsizei numAttachments,
@@ -1625,9 +3186,14 @@ void INTERNAL_GL_APIENTRY glInvalidateSubFramebufferNULL(GLenum target,
                                                          GLint y,
                                                          GLsizei width,
                                                          GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::InvalidateSubFramebuffer);
+}
 
-void INTERNAL_GL_APIENTRY glInvalidateTexImageNULL(GLuint texture, GLint level) {}
+void INTERNAL_GL_APIENTRY glInvalidateTexImageNULL(GLuint texture, GLint level)
+{
+    RecordNullDriverCall(NullEntryPoint::InvalidateTexImage);
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateTexSubImageNULL(GLuint texture,
                                                       GLint level,
@@ -1637,101 +3203,130 @@ void INTERNAL_GL_APIENTRY glInvalidateTexSubImageNULL(GLuint texture,
                                                       GLsizei width,
                                                       GLsizei height,
                                                       GLsizei depth)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::InvalidateTexSubImage);
+}
 
 GLboolean INTERNAL_GL_APIENTRY glIsBufferNULL(GLuint buffer)
 {
+    RecordNullDriverCall(NullEntryPoint::IsBuffer);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsEnabledNULL(GLenum cap)
 {
+    RecordNullDriverCall(NullEntryPoint::IsEnabled);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsEnablediNULL(GLenum target, GLuint index)
 {
+    RecordNullDriverCall(NullEntryPoint::IsEnabledi);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsFenceNVNULL(GLuint fence)
 {
+    RecordNullDriverCall(NullEntryPoint::IsFenceNV);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsFramebufferNULL(GLuint framebuffer)
 {
+    RecordNullDriverCall(NullEntryPoint::IsFramebuffer);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsMemoryObjectEXTNULL(GLuint memoryObject)
 {
+    RecordNullDriverCall(NullEntryPoint::IsMemoryObjectEXT);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsProgramNULL(GLuint program)
 {
+    RecordNullDriverCall(NullEntryPoint::IsProgram);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsProgramPipelineNULL(GLuint pipeline)
 {
+    RecordNullDriverCall(NullEntryPoint::IsProgramPipeline);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsQueryNULL(GLuint id)
 {
+    RecordNullDriverCall(NullEntryPoint::IsQuery);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsRenderbufferNULL(GLuint renderbuffer)
 {
+    RecordNullDriverCall(NullEntryPoint::IsRenderbuffer);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsSamplerNULL(GLuint sampler)
 {
+    RecordNullDriverCall(NullEntryPoint::IsSampler);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsSemaphoreEXTNULL(GLuint semaphore)
 {
+    RecordNullDriverCall(NullEntryPoint::IsSemaphoreEXT);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsShaderNULL(GLuint shader)
 {
+    RecordNullDriverCall(NullEntryPoint::IsShader);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsSyncNULL(GLsync sync)
 {
+    RecordNullDriverCall(NullEntryPoint::IsSync);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsTextureNULL(GLuint texture)
 {
+    RecordNullDriverCall(NullEntryPoint::IsTexture);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsTransformFeedbackNULL(GLuint id)
 {
+    RecordNullDriverCall(NullEntryPoint::IsTransformFeedback);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsVertexArrayNULL(GLuint array)
 {
+    RecordNullDriverCall(NullEntryPoint::IsVertexArray);
     return static_cast<GLboolean>(0);
 }
 
-void INTERNAL_GL_APIENTRY glLineWidthNULL(GLfloat width) {}
+void INTERNAL_GL_APIENTRY glLineWidthNULL(GLfloat width)
+{
+    RecordNullDriverCall(NullEntryPoint::LineWidth);
+}
 
-void INTERNAL_GL_APIENTRY glLinkProgramNULL(GLuint program) {}
+void INTERNAL_GL_APIENTRY glLinkProgramNULL(GLuint program)
+{
+    RecordNullDriverCall(NullEntryPoint::LinkProgram);
+}
 
-void INTERNAL_GL_APIENTRY glLogicOpNULL(GLenum opcode) {}
+void INTERNAL_GL_APIENTRY glLogicOpNULL(GLenum opcode)
+{
+    RecordNullDriverCall(NullEntryPoint::LogicOp);
+}
 
 void *INTERNAL_GL_APIENTRY glMapBufferNULL(GLenum target, GLenum access)
 {
+    RecordNullDriverCall(NullEntryPoint::MapBuffer);
     return static_cast<void *>(0);
 }
 
@@ -1740,11 +3335,13 @@ void *INTERNAL_GL_APIENTRY glMapBufferRangeNULL(GLenum target,
                                                 GLsizeiptr length,
                                                 GLbitfield access)
 {
+    RecordNullDriverCall(NullEntryPoint::MapBufferRange);
     return static_cast<void *>(0);
 }
 
 void *INTERNAL_GL_APIENTRY glMapNamedBufferNULL(GLuint buffer, GLenum access)
 {
+    RecordNullDriverCall(NullEntryPoint::MapNamedBuffer);
     return static_cast<void *>(0);
 }
 
@@ -1753,42 +3350,66 @@ void *INTERNAL_GL_APIENTRY glMapNamedBufferRangeNULL(GLuint buffer,
                                                      GLsizeiptr length,
                                                      GLbitfield access)
 {
+    RecordNullDriverCall(NullEntryPoint::MapNamedBufferRange);
     return static_cast<void *>(0);
 }
 
-void INTERNAL_GL_APIENTRY glMaxShaderCompilerThreadsARBNULL(GLuint count) {}
+void INTERNAL_GL_APIENTRY glMaxShaderCompilerThreadsARBNULL(GLuint count)
+{
+    RecordNullDriverCall(NullEntryPoint::MaxShaderCompilerThreadsARB);
+}
 
-void INTERNAL_GL_APIENTRY glMaxShaderCompilerThreadsKHRNULL(GLuint count) {}
+void INTERNAL_GL_APIENTRY glMaxShaderCompilerThreadsKHRNULL(GLuint count)
+{
+    RecordNullDriverCall(NullEntryPoint::MaxShaderCompilerThreadsKHR);
+}
 
-void INTERNAL_GL_APIENTRY glMemoryBarrierNULL(GLbitfield barriers) {}
+void INTERNAL_GL_APIENTRY glMemoryBarrierNULL(GLbitfield barriers)
+{
+    RecordNullDriverCall(NullEntryPoint::MemoryBarrier);
+}
 
-void INTERNAL_GL_APIENTRY glMemoryBarrierByRegionNULL(GLbitfield barriers) {}
+void INTERNAL_GL_APIENTRY glMemoryBarrierByRegionNULL(GLbitfield barriers)
+{
+    RecordNullDriverCall(NullEntryPoint::MemoryBarrierByRegion);
+}
 
 void INTERNAL_GL_APIENTRY glMemoryObjectParameterivEXTNULL(GLuint memoryObject,
                                                            GLenum pname,
                                                            const GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::MemoryObjectParameterivEXT);
+}
 
-void INTERNAL_GL_APIENTRY glMinSampleShadingNULL(GLfloat value) {}
+void INTERNAL_GL_APIENTRY glMinSampleShadingNULL(GLfloat value)
+{
+    RecordNullDriverCall(NullEntryPoint::MinSampleShading);
+}
 
 void INTERNAL_GL_APIENTRY glMultiDrawArraysNULL(GLenum mode,
                                                 const GLint *first,
                                                 const GLsizei *count,
                                                 GLsizei drawcount)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::MultiDrawArrays);
+}
 
 void INTERNAL_GL_APIENTRY glMultiDrawArraysIndirectNULL(GLenum mode,
                                                         const void *indirect,
                                                         GLsizei drawcount,
                                                         GLsizei stride)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::MultiDrawArraysIndirect);
+}
 
 void INTERNAL_GL_APIENTRY glMultiDrawElementsNULL(GLenum mode,
                                                   const GLsizei *count,
                                                   GLenum type,
                                                   const void *const *indices,
                                                   GLsizei drawcount)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::MultiDrawElements);
+}
 
 void INTERNAL_GL_APIENTRY glMultiDrawElementsBaseVertexNULL(GLenum mode,
                                                             const GLsizei *count,
@@ -1796,71 +3417,99 @@ void INTERNAL_GL_APIENTRY glMultiDrawElementsBaseVertexNULL(GLenum mode,
                                                             const void *const *indices,
                                                             GLsizei drawcount,
                                                             const GLint *basevertex)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::MultiDrawElementsBaseVertex);
+}
 
 void INTERNAL_GL_APIENTRY glMultiDrawElementsIndirectNULL(GLenum mode,
                                                           GLenum type,
                                                           const void *indirect,
                                                           GLsizei drawcount,
                                                           GLsizei stride)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::MultiDrawElementsIndirect);
+}
 
 void INTERNAL_GL_APIENTRY glNamedBufferDataNULL(GLuint buffer,
                                                 GLsizeiptr size,
                                                 const void *data,
                                                 GLenum usage)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedBufferData);
+}
 
 void INTERNAL_GL_APIENTRY glNamedBufferStorageNULL(GLuint buffer,
                                                    GLsizeiptr size,
                                                    const void *data,
                                                    GLbitfield flags)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedBufferStorage);
+}
 
 void INTERNAL_GL_APIENTRY glNamedBufferStorageMemEXTNULL(GLuint buffer,
                                                          GLsizeiptr size,
                                                          GLuint memory,
                                                          GLuint64 offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedBufferStorageMemEXT);
+}
 
 void INTERNAL_GL_APIENTRY glNamedBufferSubDataNULL(GLuint buffer,
                                                    GLintptr offset,
                                                    GLsizeiptr size,
                                                    const void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedBufferSubData);
+}
 
-void INTERNAL_GL_APIENTRY glNamedFramebufferDrawBufferNULL(GLuint framebuffer, GLenum buf) {}
+void INTERNAL_GL_APIENTRY glNamedFramebufferDrawBufferNULL(GLuint framebuffer, GLenum buf)
+{
+    RecordNullDriverCall(NullEntryPoint::NamedFramebufferDrawBuffer);
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferDrawBuffersNULL(GLuint framebuffer,
                                                             GLsizei n,
                                                             const GLenum *bufs)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedFramebufferDrawBuffers);
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferParameteriNULL(GLuint framebuffer,
                                                            GLenum pname,
                                                            GLint param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedFramebufferParameteri);
+}
 
-void INTERNAL_GL_APIENTRY glNamedFramebufferReadBufferNULL(GLuint framebuffer, GLenum src) {}
+void INTERNAL_GL_APIENTRY glNamedFramebufferReadBufferNULL(GLuint framebuffer, GLenum src)
+{
+    RecordNullDriverCall(NullEntryPoint::NamedFramebufferReadBuffer);
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferRenderbufferNULL(GLuint framebuffer,
                                                              GLenum attachment,
                                                              GLenum renderbuffertarget,
                                                              GLuint renderbuffer)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedFramebufferRenderbuffer);
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferTextureNULL(GLuint framebuffer,
                                                         GLenum attachment,
                                                         GLuint texture,
                                                         GLint level)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedFramebufferTexture);
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferTextureLayerNULL(GLuint framebuffer,
                                                              GLenum attachment,
                                                              GLuint texture,
                                                              GLint level,
                                                              GLint layer)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedFramebufferTextureLayer);
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferTextureMultiviewOVRNULL(GLuint framebuffer,
                                                                     GLenum attachment,
@@ -1868,62 +3517,119 @@ void INTERNAL_GL_APIENTRY glNamedFramebufferTextureMultiviewOVRNULL(GLuint frame
                                                                     GLint level,
                                                                     GLint baseViewIndex,
                                                                     GLsizei numViews)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedFramebufferTextureMultiviewOVR);
+}
 
 void INTERNAL_GL_APIENTRY glNamedRenderbufferStorageNULL(GLuint renderbuffer,
                                                          GLenum internalformat,
                                                          GLsizei width,
                                                          GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedRenderbufferStorage);
+}
 
 void INTERNAL_GL_APIENTRY glNamedRenderbufferStorageMultisampleNULL(GLuint renderbuffer,
                                                                     GLsizei samples,
                                                                     GLenum internalformat,
                                                                     GLsizei width,
                                                                     GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::NamedRenderbufferStorageMultisample);
+}
 
 void INTERNAL_GL_APIENTRY glObjectLabelNULL(GLenum identifier,
                                             GLuint name,
                                             GLsizei length,
                                             const GLchar *label)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ObjectLabel);
+}
 
 void INTERNAL_GL_APIENTRY glObjectPtrLabelNULL(const void *ptr, GLsizei length, const GLchar *label)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ObjectPtrLabel);
+}
 
-void INTERNAL_GL_APIENTRY glPatchParameterfvNULL(GLenum pname, const GLfloat *values) {}
+void INTERNAL_GL_APIENTRY glPatchParameterfvNULL(GLenum pname, const GLfloat *values)
+{
+    RecordNullDriverCall(NullEntryPoint::PatchParameterfv);
+}
 
-void INTERNAL_GL_APIENTRY glPatchParameteriNULL(GLenum pname, GLint value) {}
+void INTERNAL_GL_APIENTRY glPatchParameteriNULL(GLenum pname, GLint value)
+{
+    RecordNullDriverCall(NullEntryPoint::PatchParameteri);
+}
 
-void INTERNAL_GL_APIENTRY glPauseTransformFeedbackNULL() {}
+void INTERNAL_GL_APIENTRY glPauseTransformFeedbackNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::PauseTransformFeedback);
+}
 
-void INTERNAL_GL_APIENTRY glPixelStorefNULL(GLenum pname, GLfloat param) {}
+void INTERNAL_GL_APIENTRY glPixelStorefNULL(GLenum pname, GLfloat param)
+{
+    RecordNullDriverCall(NullEntryPoint::PixelStoref);
+}
 
-void INTERNAL_GL_APIENTRY glPixelStoreiNULL(GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glPixelStoreiNULL(GLenum pname, GLint param)
+{
+    RecordNullDriverCall(NullEntryPoint::PixelStorei);
+}
 
-void INTERNAL_GL_APIENTRY glPointParameterfNULL(GLenum pname, GLfloat param) {}
+void INTERNAL_GL_APIENTRY glPointParameterfNULL(GLenum pname, GLfloat param)
+{
+    RecordNullDriverCall(NullEntryPoint::PointParameterf);
+}
 
-void INTERNAL_GL_APIENTRY glPointParameterfvNULL(GLenum pname, const GLfloat *params) {}
+void INTERNAL_GL_APIENTRY glPointParameterfvNULL(GLenum pname, const GLfloat *params)
+{
+    RecordNullDriverCall(NullEntryPoint::PointParameterfv);
+}
 
-void INTERNAL_GL_APIENTRY glPointParameteriNULL(GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glPointParameteriNULL(GLenum pname, GLint param)
+{
+    RecordNullDriverCall(NullEntryPoint::PointParameteri);
+}
 
-void INTERNAL_GL_APIENTRY glPointParameterivNULL(GLenum pname, const GLint *params) {}
+void INTERNAL_GL_APIENTRY glPointParameterivNULL(GLenum pname, const GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::PointParameteriv);
+}
 
-void INTERNAL_GL_APIENTRY glPointSizeNULL(GLfloat size) {}
+void INTERNAL_GL_APIENTRY glPointSizeNULL(GLfloat size)
+{
+    RecordNullDriverCall(NullEntryPoint::PointSize);
+}
 
-void INTERNAL_GL_APIENTRY glPolygonModeNULL(GLenum face, GLenum mode) {}
+void INTERNAL_GL_APIENTRY glPolygonModeNULL(GLenum face, GLenum mode)
+{
+    RecordNullDriverCall(NullEntryPoint::PolygonMode);
+}
 
-void INTERNAL_GL_APIENTRY glPolygonModeNVNULL(GLenum face, GLenum mode) {}
+void INTERNAL_GL_APIENTRY glPolygonModeNVNULL(GLenum face, GLenum mode)
+{
+    RecordNullDriverCall(NullEntryPoint::PolygonModeNV);
+}
 
-void INTERNAL_GL_APIENTRY glPolygonOffsetNULL(GLfloat factor, GLfloat units) {}
+void INTERNAL_GL_APIENTRY glPolygonOffsetNULL(GLfloat factor, GLfloat units)
+{
+    RecordNullDriverCall(NullEntryPoint::PolygonOffset);
+}
 
 void INTERNAL_GL_APIENTRY glPolygonOffsetClampEXTNULL(GLfloat factor, GLfloat units, GLfloat clamp)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::PolygonOffsetClampEXT);
+}
 
-void INTERNAL_GL_APIENTRY glPopDebugGroupNULL() {}
+void INTERNAL_GL_APIENTRY glPopDebugGroupNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::PopDebugGroup);
+}
 
-void INTERNAL_GL_APIENTRY glPopGroupMarkerEXTNULL() {}
+void INTERNAL_GL_APIENTRY glPopGroupMarkerEXTNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::PopGroupMarkerEXT);
+}
 
 void INTERNAL_GL_APIENTRY glPrimitiveBoundingBoxNULL(GLfloat minX,
                                                      GLfloat minY,
@@ -1933,134 +3639,196 @@ void INTERNAL_GL_APIENTRY glPrimitiveBoundingBoxNULL(GLfloat minX,
                                                      GLfloat maxY,
                                                      GLfloat maxZ,
                                                      GLfloat maxW)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::PrimitiveBoundingBox);
+}
 
-void INTERNAL_GL_APIENTRY glPrimitiveRestartIndexNULL(GLuint index) {}
+void INTERNAL_GL_APIENTRY glPrimitiveRestartIndexNULL(GLuint index)
+{
+    RecordNullDriverCall(NullEntryPoint::PrimitiveRestartIndex);
+}
 
 void INTERNAL_GL_APIENTRY glProgramBinaryNULL(GLuint program,
                                               GLenum binaryFormat,
                                               const void *binary,
                                               GLsizei length)
-{}
-
-void INTERNAL_GL_APIENTRY glProgramParameteriNULL(GLuint program, GLenum pname, GLint value) {}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramBinary);
+}
+
+void INTERNAL_GL_APIENTRY glProgramParameteriNULL(GLuint program, GLenum pname, GLint value)
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramParameteri);
+}
 
-void INTERNAL_GL_APIENTRY glProgramUniform1dNULL(GLuint program, GLint location, GLdouble v0) {}
+void INTERNAL_GL_APIENTRY glProgramUniform1dNULL(GLuint program, GLint location, GLdouble v0)
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform1d);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform1dvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform1dv);
+}
 
-void INTERNAL_GL_APIENTRY glProgramUniform1fNULL(GLuint program, GLint location, GLfloat v0) {}
+void INTERNAL_GL_APIENTRY glProgramUniform1fNULL(GLuint program, GLint location, GLfloat v0)
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform1f);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform1fvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform1fv);
+}
 
-void INTERNAL_GL_APIENTRY glProgramUniform1iNULL(GLuint program, GLint location, GLint v0) {}
+void INTERNAL_GL_APIENTRY glProgramUniform1iNULL(GLuint program, GLint location, GLint v0)
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform1i);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform1ivNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform1iv);
+}
 
-void INTERNAL_GL_APIENTRY glProgramUniform1uiNULL(GLuint program, GLint location, GLuint v0) {}
+void INTERNAL_GL_APIENTRY glProgramUniform1uiNULL(GLuint program, GLint location, GLuint v0)
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform1ui);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform1uivNULL(GLuint program,
                                                    GLint location,
                                                    GLsizei count,
                                                    const GLuint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform1uiv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2dNULL(GLuint program,
                                                  GLint location,
                                                  GLdouble v0,
                                                  GLdouble v1)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform2d);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2dvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform2dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2fNULL(GLuint program,
                                                  GLint location,
                                                  GLfloat v0,
                                                  GLfloat v1)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform2f);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2fvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform2fv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2iNULL(GLuint program, GLint location, GLint v0, GLint v1)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform2i);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2ivNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform2iv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2uiNULL(GLuint program,
                                                   GLint location,
                                                   GLuint v0,
                                                   GLuint v1)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform2ui);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2uivNULL(GLuint program,
                                                    GLint location,
                                                    GLsizei count,
                                                    const GLuint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform2uiv);
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform3dNULL(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform3d);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform3dvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform3dv);
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform3fNULL(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform3f);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform3fvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform3fv);
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform3iNULL(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform3i);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform3ivNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform3iv);
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform3uiNULL(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform3ui);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform3uivNULL(GLuint program,
                                                    GLint location,
                                                    GLsizei count,
                                                    const GLuint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform3uiv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4dNULL(GLuint program,
                                                  GLint location,
@@ -2068,13 +3836,17 @@ void INTERNAL_GL_APIENTRY glProgramUniform4dNULL(GLuint program,
                                                  GLdouble v1,
                                                  GLdouble v2,
                                                  GLdouble v3)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform4d);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4dvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform4dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4fNULL(GLuint program,
                                                  GLint location,
@@ -2082,173 +3854,235 @@ void INTERNAL_GL_APIENTRY glProgramUniform4fNULL(GLuint program,
                                                  GLfloat v1,
                                                  GLfloat v2,
                                                  GLfloat v3)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform4f);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4fvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform4fv);
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform4iNULL(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform4i);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4ivNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform4iv);
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform4uiNULL(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform4ui);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4uivNULL(GLuint program,
                                                    GLint location,
                                                    GLsizei count,
                                                    const GLuint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniform4uiv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2dvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix2dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2fvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix2fv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x3dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix2x3dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x3fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix2x3fv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x4dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix2x4dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x4fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix2x4fv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3dvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix3dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3fvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix3fv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x2dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix3x2dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x2fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix3x2fv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x4dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix3x4dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x4fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix3x4fv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4dvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix4dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4fvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix4fv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x2dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix4x2dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x2fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix4x2fv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x3dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix4x3dv);
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x3fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ProgramUniformMatrix4x3fv);
+}
 
-void INTERNAL_GL_APIENTRY glProvokingVertexNULL(GLenum mode) {}
+void INTERNAL_GL_APIENTRY glProvokingVertexNULL(GLenum mode)
+{
+    RecordNullDriverCall(NullEntryPoint::ProvokingVertex);
+}
 
 void INTERNAL_GL_APIENTRY glPushDebugGroupNULL(GLenum source,
                                                GLuint id,
                                                GLsizei length,
                                                const GLchar *message)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::PushDebugGroup);
+}
 
-void INTERNAL_GL_APIENTRY glPushGroupMarkerEXTNULL(GLsizei length, const GLchar *marker) {}
+void INTERNAL_GL_APIENTRY glPushGroupMarkerEXTNULL(GLsizei length, const GLchar *marker)
+{
+    RecordNullDriverCall(NullEntryPoint::PushGroupMarkerEXT);
+}
 
-void INTERNAL_GL_APIENTRY glQueryCounterNULL(GLuint id, GLenum target) {}
+void INTERNAL_GL_APIENTRY glQueryCounterNULL(GLuint id, GLenum target)
+{
+    RecordNullDriverCall(NullEntryPoint::QueryCounter);
+}
 
-void INTERNAL_GL_APIENTRY glReadBufferNULL(GLenum src) {}
+void INTERNAL_GL_APIENTRY glReadBufferNULL(GLenum src)
+{
+    RecordNullDriverCall(NullEntryPoint::ReadBuffer);
+}
 
 void INTERNAL_GL_APIENTRY glReadPixelsNULL(GLint x,
                                            GLint y,
@@ -2257,7 +4091,9 @@ void INTERNAL_GL_APIENTRY glReadPixelsNULL(GLint x,
                                            GLenum format,
                                            GLenum type,
                                            void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ReadPixels);
+}
 
 void INTERNAL_GL_APIENTRY glReadnPixelsNULL(GLint x,
                                             GLint y,
@@ -2267,99 +4103,157 @@ void INTERNAL_GL_APIENTRY glReadnPixelsNULL(GLint x,
                                             GLenum type,
                                             GLsizei bufSize,
                                             void *data)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ReadnPixels);
+}
 
-void INTERNAL_GL_APIENTRY glReleaseShaderCompilerNULL() {}
+void INTERNAL_GL_APIENTRY glReleaseShaderCompilerNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::ReleaseShaderCompiler);
+}
 
 void INTERNAL_GL_APIENTRY glRenderbufferStorageNULL(GLenum target,
                                                     GLenum internalformat,
                                                     GLsizei width,
                                                     GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::RenderbufferStorage);
+}
 
 void INTERNAL_GL_APIENTRY glRenderbufferStorageMultisampleNULL(GLenum target,
                                                                GLsizei samples,
                                                                GLenum internalformat,
                                                                GLsizei width,
                                                                GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::RenderbufferStorageMultisample);
+}
 
 void INTERNAL_GL_APIENTRY glRenderbufferStorageMultisampleEXTNULL(GLenum target,
                                                                   GLsizei samples,
                                                                   GLenum internalformat,
                                                                   GLsizei width,
                                                                   GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::RenderbufferStorageMultisampleEXT);
+}
 
 void INTERNAL_GL_APIENTRY glRenderbufferStorageMultisampleIMGNULL(GLenum target,
                                                                   GLsizei samples,
                                                                   GLenum internalformat,
                                                                   GLsizei width,
                                                                   GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::RenderbufferStorageMultisampleIMG);
+}
 
-void INTERNAL_GL_APIENTRY glResumeTransformFeedbackNULL() {}
+void INTERNAL_GL_APIENTRY glResumeTransformFeedbackNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::ResumeTransformFeedback);
+}
 
-void INTERNAL_GL_APIENTRY glSampleCoverageNULL(GLfloat value, GLboolean invert) {}
+void INTERNAL_GL_APIENTRY glSampleCoverageNULL(GLfloat value, GLboolean invert)
+{
+    RecordNullDriverCall(NullEntryPoint::SampleCoverage);
+}
 
-void INTERNAL_GL_APIENTRY glSampleMaskiNULL(GLuint maskNumber, GLbitfield mask) {}
+void INTERNAL_GL_APIENTRY glSampleMaskiNULL(GLuint maskNumber, GLbitfield mask)
+{
+    RecordNullDriverCall(NullEntryPoint::SampleMaski);
+}
 
 void INTERNAL_GL_APIENTRY glSamplerParameterIivNULL(GLuint sampler,
                                                     GLenum pname,
                                                     const GLint *param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::SamplerParameterIiv);
+}
 
 void INTERNAL_GL_APIENTRY glSamplerParameterIuivNULL(GLuint sampler,
                                                      GLenum pname,
                                                      const GLuint *param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::SamplerParameterIuiv);
+}
 
-void INTERNAL_GL_APIENTRY glSamplerParameterfNULL(GLuint sampler, GLenum pname, GLfloat param) {}
+void INTERNAL_GL_APIENTRY glSamplerParameterfNULL(GLuint sampler, GLenum pname, GLfloat param)
+{
+    RecordNullDriverCall(NullEntryPoint::SamplerParameterf);
+}
 
 void INTERNAL_GL_APIENTRY glSamplerParameterfvNULL(GLuint sampler,
                                                    GLenum pname,
                                                    const GLfloat *param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::SamplerParameterfv);
+}
 
-void INTERNAL_GL_APIENTRY glSamplerParameteriNULL(GLuint sampler, GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glSamplerParameteriNULL(GLuint sampler, GLenum pname, GLint param)
+{
+    RecordNullDriverCall(NullEntryPoint::SamplerParameteri);
+}
 
 void INTERNAL_GL_APIENTRY glSamplerParameterivNULL(GLuint sampler, GLenum pname, const GLint *param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::SamplerParameteriv);
+}
 
-void INTERNAL_GL_APIENTRY glScissorNULL(GLint x, GLint y, GLsizei width, GLsizei height) {}
+void INTERNAL_GL_APIENTRY glScissorNULL(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    RecordNullDriverCall(NullEntryPoint::Scissor);
+}
 
-void INTERNAL_GL_APIENTRY glScissorArrayvNULL(GLuint first, GLsizei count, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glScissorArrayvNULL(GLuint first, GLsizei count, const GLint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::ScissorArrayv);
+}
 
 void INTERNAL_GL_APIENTRY
 glScissorIndexedNULL(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ScissorIndexed);
+}
 
-void INTERNAL_GL_APIENTRY glScissorIndexedvNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glScissorIndexedvNULL(GLuint index, const GLint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::ScissorIndexedv);
+}
 
 void INTERNAL_GL_APIENTRY glSemaphoreParameterui64vEXTNULL(GLuint semaphore,
                                                            GLenum pname,
                                                            const GLuint64 *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::SemaphoreParameterui64vEXT);
+}
 
-void INTERNAL_GL_APIENTRY glSetFenceNVNULL(GLuint fence, GLenum condition) {}
+void INTERNAL_GL_APIENTRY glSetFenceNVNULL(GLuint fence, GLenum condition)
+{
+    RecordNullDriverCall(NullEntryPoint::SetFenceNV);
+}
 
 void INTERNAL_GL_APIENTRY glShaderBinaryNULL(GLsizei count,
                                              const GLuint *shaders,
                                              GLenum binaryFormat,
                                              const void *binary,
                                              GLsizei length)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ShaderBinary);
+}
 
 void INTERNAL_GL_APIENTRY glShaderSourceNULL(GLuint shader,
                                              GLsizei count,
                                              const GLchar *const *string,
                                              const GLint *length)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ShaderSource);
+}
 
 void INTERNAL_GL_APIENTRY glShaderStorageBlockBindingNULL(GLuint program,
                                                           GLuint storageBlockIndex,
                                                           GLuint storageBlockBinding)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ShaderStorageBlockBinding);
+}
 
 void INTERNAL_GL_APIENTRY glSignalSemaphoreEXTNULL(GLuint semaphore,
                                                    GLuint numBufferBarriers,
@@ -2367,63 +4261,99 @@ void INTERNAL_GL_APIENTRY glSignalSemaphoreEXTNULL(GLuint semaphore,
                                                    GLuint numTextureBarriers,
                                                    const GLuint *textures,
                                                    const GLenum *dstLayouts)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::SignalSemaphoreEXT);
+}
 
 void INTERNAL_GL_APIENTRY
 glStartTilingQCOMNULL(GLuint x, GLuint y, GLuint width, GLuint height, GLbitfield preserveMask)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::StartTilingQCOM);
+}
 
-void INTERNAL_GL_APIENTRY glStencilFuncNULL(GLenum func, GLint ref, GLuint mask) {}
+void INTERNAL_GL_APIENTRY glStencilFuncNULL(GLenum func, GLint ref, GLuint mask)
+{
+    RecordNullDriverCall(NullEntryPoint::StencilFunc);
+}
 
 void INTERNAL_GL_APIENTRY glStencilFuncSeparateNULL(GLenum face,
                                                     GLenum func,
                                                     GLint ref,
                                                     GLuint mask)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::StencilFuncSeparate);
+}
 
-void INTERNAL_GL_APIENTRY glStencilMaskNULL(GLuint mask) {}
+void INTERNAL_GL_APIENTRY glStencilMaskNULL(GLuint mask)
+{
+    RecordNullDriverCall(NullEntryPoint::StencilMask);
+}
 
-void INTERNAL_GL_APIENTRY glStencilMaskSeparateNULL(GLenum face, GLuint mask) {}
+void INTERNAL_GL_APIENTRY glStencilMaskSeparateNULL(GLenum face, GLuint mask)
+{
+    RecordNullDriverCall(NullEntryPoint::StencilMaskSeparate);
+}
 
-void INTERNAL_GL_APIENTRY glStencilOpNULL(GLenum fail, GLenum zfail, GLenum zpass) {}
+void INTERNAL_GL_APIENTRY glStencilOpNULL(GLenum fail, GLenum zfail, GLenum zpass)
+{
+    RecordNullDriverCall(NullEntryPoint::StencilOp);
+}
 
 void INTERNAL_GL_APIENTRY glStencilOpSeparateNULL(GLenum face,
                                                   GLenum sfail,
                                                   GLenum dpfail,
                                                   GLenum dppass)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::StencilOpSeparate);
+}
 
 GLboolean INTERNAL_GL_APIENTRY glTestFenceNVNULL(GLuint fence)
 {
+    RecordNullDriverCall(NullEntryPoint::TestFenceNV);
     return static_cast<GLboolean>(0);
 }
 
-void INTERNAL_GL_APIENTRY glTexBufferNULL(GLenum target, GLenum internalformat, GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glTexBufferNULL(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    RecordNullDriverCall(NullEntryPoint::TexBuffer);
+}
 
-void INTERNAL_GL_APIENTRY glTexBufferEXTNULL(GLenum target, GLenum internalformat, GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glTexBufferEXTNULL(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    RecordNullDriverCall(NullEntryPoint::TexBufferEXT);
+}
 
-void INTERNAL_GL_APIENTRY glTexBufferOESNULL(GLenum target, GLenum internalformat, GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glTexBufferOESNULL(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    RecordNullDriverCall(NullEntryPoint::TexBufferOES);
+}
 
 void INTERNAL_GL_APIENTRY glTexBufferRangeNULL(GLenum target,
                                                GLenum internalformat,
                                                GLuint buffer,
                                                GLintptr offset,
                                                GLsizeiptr size)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexBufferRange);
+}
 
 void INTERNAL_GL_APIENTRY glTexBufferRangeEXTNULL(GLenum target,
                                                   GLenum internalformat,
                                                   GLuint buffer,
                                                   GLintptr offset,
                                                   GLsizeiptr size)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexBufferRangeEXT);
+}
 
 void INTERNAL_GL_APIENTRY glTexBufferRangeOESNULL(GLenum target,
                                                   GLenum internalformat,
                                                   GLuint buffer,
                                                   GLintptr offset,
                                                   GLsizeiptr size)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexBufferRangeOES);
+}
 
 void INTERNAL_GL_APIENTRY glTexImage1DNULL(GLenum target,
                                            GLint level,
@@ -2433,7 +4363,9 @@ void INTERNAL_GL_APIENTRY glTexImage1DNULL(GLenum target,
                                            GLenum format,
                                            GLenum type,
                                            const void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexImage1D);
+}
 
 void INTERNAL_GL_APIENTRY glTexImage2DNULL(GLenum target,
                                            GLint level,
@@ -2444,7 +4376,9 @@ void INTERNAL_GL_APIENTRY glTexImage2DNULL(GLenum target,
                                            GLenum format,
                                            GLenum type,
                                            const void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexImage2D);
+}
 
 void INTERNAL_GL_APIENTRY glTexImage2DMultisampleNULL(GLenum target,
                                                       GLsizei samples,
@@ -2452,7 +4386,9 @@ void INTERNAL_GL_APIENTRY glTexImage2DMultisampleNULL(GLenum target,
                                                       GLsizei width,
                                                       GLsizei height,
                                                       GLboolean fixedsamplelocations)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexImage2DMultisample);
+}
 
 void INTERNAL_GL_APIENTRY glTexImage3DNULL(GLenum target,
                                            GLint level,
@@ -2464,7 +4400,9 @@ void INTERNAL_GL_APIENTRY glTexImage3DNULL(GLenum target,
                                            GLenum format,
                                            GLenum type,
                                            const void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexImage3D);
+}
 
 void INTERNAL_GL_APIENTRY glTexImage3DMultisampleNULL(GLenum target,
                                                       GLsizei samples,
@@ -2473,34 +4411,56 @@ void INTERNAL_GL_APIENTRY glTexImage3DMultisampleNULL(GLenum target,
                                                       GLsizei height,
                                                       GLsizei depth,
                                                       GLboolean fixedsamplelocations)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexImage3DMultisample);
+}
 
-void INTERNAL_GL_APIENTRY glTexParameterIivNULL(GLenum target, GLenum pname, const GLint *params) {}
+void INTERNAL_GL_APIENTRY glTexParameterIivNULL(GLenum target, GLenum pname, const GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::TexParameterIiv);
+}
 
 void INTERNAL_GL_APIENTRY glTexParameterIuivNULL(GLenum target, GLenum pname, const GLuint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexParameterIuiv);
+}
 
-void INTERNAL_GL_APIENTRY glTexParameterfNULL(GLenum target, GLenum pname, GLfloat param) {}
+void INTERNAL_GL_APIENTRY glTexParameterfNULL(GLenum target, GLenum pname, GLfloat param)
+{
+    RecordNullDriverCall(NullEntryPoint::TexParameterf);
+}
 
 void INTERNAL_GL_APIENTRY glTexParameterfvNULL(GLenum target, GLenum pname, const GLfloat *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexParameterfv);
+}
 
-void INTERNAL_GL_APIENTRY glTexParameteriNULL(GLenum target, GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glTexParameteriNULL(GLenum target, GLenum pname, GLint param)
+{
+    RecordNullDriverCall(NullEntryPoint::TexParameteri);
+}
 
-void INTERNAL_GL_APIENTRY glTexParameterivNULL(GLenum target, GLenum pname, const GLint *params) {}
+void INTERNAL_GL_APIENTRY glTexParameterivNULL(GLenum target, GLenum pname, const GLint *params)
+{
+    RecordNullDriverCall(NullEntryPoint::TexParameteriv);
+}
 
 void INTERNAL_GL_APIENTRY glTexStorage1DNULL(GLenum target,
                                              GLsizei levels,
                                              GLenum internalformat,
                                              GLsizei width)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexStorage1D);
+}
 
 void INTERNAL_GL_APIENTRY glTexStorage2DNULL(GLenum target,
                                              GLsizei levels,
                                              GLenum internalformat,
                                              GLsizei width,
                                              GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexStorage2D);
+}
 
 void INTERNAL_GL_APIENTRY glTexStorage2DMultisampleNULL(GLenum target,
                                                         GLsizei samples,
@@ -2508,7 +4468,9 @@ void INTERNAL_GL_APIENTRY glTexStorage2DMultisampleNULL(GLenum target,
                                                         GLsizei width,
                                                         GLsizei height,
                                                         GLboolean fixedsamplelocations)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexStorage2DMultisample);
+}
 
 void INTERNAL_GL_APIENTRY glTexStorage3DNULL(GLenum target,
                                              GLsizei levels,
@@ -2516,7 +4478,9 @@ void INTERNAL_GL_APIENTRY glTexStorage3DNULL(GLenum target,
                                              GLsizei width,
                                              GLsizei height,
                                              GLsizei depth)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexStorage3D);
+}
 
 void INTERNAL_GL_APIENTRY glTexStorage3DMultisampleNULL(GLenum target,
                                                         GLsizei samples,
@@ -2525,7 +4489,9 @@ void INTERNAL_GL_APIENTRY glTexStorage3DMultisampleNULL(GLenum target,
                                                         GLsizei height,
                                                         GLsizei depth,
                                                         GLboolean fixedsamplelocations)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexStorage3DMultisample);
+}
 
 void INTERNAL_GL_APIENTRY glTexStorageMem2DEXTNULL(GLenum target,
                                                    GLsizei levels,
@@ -2534,7 +4500,9 @@ void INTERNAL_GL_APIENTRY glTexStorageMem2DEXTNULL(GLenum target,
                                                    GLsizei height,
                                                    GLuint memory,
                                                    GLuint64 offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexStorageMem2DEXT);
+}
 
 void INTERNAL_GL_APIENTRY glTexStorageMem2DMultisampleEXTNULL(GLenum target,
                                                               GLsizei samples,
@@ -2544,7 +4512,9 @@ void INTERNAL_GL_APIENTRY glTexStorageMem2DMultisampleEXTNULL(GLenum target,
                                                               GLboolean fixedSampleLocations,
                                                               GLuint memory,
                                                               GLuint64 offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexStorageMem2DMultisampleEXT);
+}
 
 void INTERNAL_GL_APIENTRY glTexStorageMem3DEXTNULL(GLenum target,
                                                    GLsizei levels,
@@ -2554,7 +4524,9 @@ void INTERNAL_GL_APIENTRY glTexStorageMem3DEXTNULL(GLenum target,
                                                    GLsizei depth,
                                                    GLuint memory,
                                                    GLuint64 offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexStorageMem3DEXT);
+}
 
 void INTERNAL_GL_APIENTRY glTexStorageMem3DMultisampleEXTNULL(GLenum target,
                                                               GLsizei samples,
@@ -2565,7 +4537,9 @@ void INTERNAL_GL_APIENTRY glTexStorageMem3DMultisampleEXTNULL(GLenum target,
                                                               GLboolean fixedSampleLocations,
                                                               GLuint memory,
                                                               GLuint64 offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexStorageMem3DMultisampleEXT);
+}
 
 void INTERNAL_GL_APIENTRY glTexSubImage1DNULL(GLenum target,
                                               GLint level,
@@ -2574,7 +4548,9 @@ void INTERNAL_GL_APIENTRY glTexSubImage1DNULL(GLenum target,
                                               GLenum format,
                                               GLenum type,
                                               const void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexSubImage1D);
+}
 
 void INTERNAL_GL_APIENTRY glTexSubImage2DNULL(GLenum target,
                                               GLint level,
@@ -2585,7 +4561,9 @@ void INTERNAL_GL_APIENTRY glTexSubImage2DNULL(GLenum target,
                                               GLenum format,
                                               GLenum type,
                                               const void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexSubImage2D);
+}
 
 void INTERNAL_GL_APIENTRY glTexSubImage3DNULL(GLenum target,
                                               GLint level,
@@ -2598,54 +4576,81 @@ void INTERNAL_GL_APIENTRY glTexSubImage3DNULL(GLenum target,
                                               GLenum format,
                                               GLenum type,
                                               const void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TexSubImage3D);
+}
 
-void INTERNAL_GL_APIENTRY glTextureBarrierNULL() {}
+void INTERNAL_GL_APIENTRY glTextureBarrierNULL()
+{
+    RecordNullDriverCall(NullEntryPoint::TextureBarrier);
+}
 
 void INTERNAL_GL_APIENTRY glTextureBufferNULL(GLuint texture, GLenum internalformat, GLuint buffer)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureBuffer);
+}
 
 void INTERNAL_GL_APIENTRY glTextureBufferRangeNULL(GLuint texture,
                                                    GLenum internalformat,
                                                    GLuint buffer,
                                                    GLintptr offset,
                                                    GLsizeiptr size)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureBufferRange);
+}
 
 void INTERNAL_GL_APIENTRY glTextureParameterIivNULL(GLuint texture,
                                                     GLenum pname,
                                                     const GLint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureParameterIiv);
+}
 
 void INTERNAL_GL_APIENTRY glTextureParameterIuivNULL(GLuint texture,
                                                      GLenum pname,
                                                      const GLuint *params)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureParameterIuiv);
+}
 
-void INTERNAL_GL_APIENTRY glTextureParameterfNULL(GLuint texture, GLenum pname, GLfloat param) {}
+void INTERNAL_GL_APIENTRY glTextureParameterfNULL(GLuint texture, GLenum pname, GLfloat param)
+{
+    RecordNullDriverCall(NullEntryPoint::TextureParameterf);
+}
 
 void INTERNAL_GL_APIENTRY glTextureParameterfvNULL(GLuint texture,
                                                    GLenum pname,
                                                    const GLfloat *param)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureParameterfv);
+}
 
-void INTERNAL_GL_APIENTRY glTextureParameteriNULL(GLuint texture, GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glTextureParameteriNULL(GLuint texture, GLenum pname, GLint param)
+{
+    RecordNullDriverCall(NullEntryPoint::TextureParameteri);
+}
 
 void INTERNAL_GL_APIENTRY glTextureParameterivNULL(GLuint texture, GLenum pname, const GLint *param)
-{}
-
+{
+    RecordNullDriverCall(NullEntryPoint::TextureParameteriv);
+}
+
 void INTERNAL_GL_APIENTRY glTextureStorage1DNULL(GLuint texture,
                                                  GLsizei levels,
                                                  GLenum internalformat,
                                                  GLsizei width)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureStorage1D);
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorage2DNULL(GLuint texture,
                                                  GLsizei levels,
                                                  GLenum internalformat,
                                                  GLsizei width,
                                                  GLsizei height)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureStorage2D);
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorage2DMultisampleNULL(GLuint texture,
                                                             GLsizei samples,
@@ -2653,7 +4658,9 @@ void INTERNAL_GL_APIENTRY glTextureStorage2DMultisampleNULL(GLuint texture,
                                                             GLsizei width,
                                                             GLsizei height,
                                                             GLboolean fixedsamplelocations)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureStorage2DMultisample);
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorage3DNULL(GLuint texture,
                                                  GLsizei levels,
@@ -2661,7 +4668,9 @@ void INTERNAL_GL_APIENTRY glTextureStorage3DNULL(GLuint texture,
                                                  GLsizei width,
                                                  GLsizei height,
                                                  GLsizei depth)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureStorage3D);
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorage3DMultisampleNULL(GLuint texture,
                                                             GLsizei samples,
@@ -2670,7 +4679,9 @@ void INTERNAL_GL_APIENTRY glTextureStorage3DMultisampleNULL(GLuint texture,
                                                             GLsizei height,
                                                             GLsizei depth,
                                                             GLboolean fixedsamplelocations)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureStorage3DMultisample);
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorageMem2DEXTNULL(GLuint texture,
                                                        GLsizei levels,
@@ -2679,7 +4690,9 @@ void INTERNAL_GL_APIENTRY glTextureStorageMem2DEXTNULL(GLuint texture,
                                                        GLsizei height,
                                                        GLuint memory,
                                                        GLuint64 offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureStorageMem2DEXT);
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorageMem2DMultisampleEXTNULL(GLuint texture,
                                                                   GLsizei samples,
@@ -2689,7 +4702,9 @@ void INTERNAL_GL_APIENTRY glTextureStorageMem2DMultisampleEXTNULL(GLuint texture
                                                                   GLboolean fixedSampleLocations,
                                                                   GLuint memory,
                                                                   GLuint64 offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureStorageMem2DMultisampleEXT);
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorageMem3DEXTNULL(GLuint texture,
                                                        GLsizei levels,
@@ -2699,7 +4714,9 @@ void INTERNAL_GL_APIENTRY glTextureStorageMem3DEXTNULL(GLuint texture,
                                                        GLsizei depth,
                                                        GLuint memory,
                                                        GLuint64 offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureStorageMem3DEXT);
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorageMem3DMultisampleEXTNULL(GLuint texture,
                                                                   GLsizei samples,
@@ -2710,7 +4727,9 @@ void INTERNAL_GL_APIENTRY glTextureStorageMem3DMultisampleEXTNULL(GLuint texture
                                                                   GLboolean fixedSampleLocations,
                                                                   GLuint memory,
                                                                   GLuint64 offset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureStorageMem3DMultisampleEXT);
+}
 
 void INTERNAL_GL_APIENTRY glTextureSubImage1DNULL(GLuint texture,
                                                   GLint level,
@@ -2719,7 +4738,9 @@ void INTERNAL_GL_APIENTRY glTextureSubImage1DNULL(GLuint texture,
                                                   GLenum format,
                                                   GLenum type,
                                                   const void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureSubImage1D);
+}
 
 void INTERNAL_GL_APIENTRY glTextureSubImage2DNULL(GLuint texture,
                                                   GLint level,
@@ -2730,7 +4751,9 @@ void INTERNAL_GL_APIENTRY glTextureSubImage2DNULL(GLuint texture,
                                                   GLenum format,
                                                   GLenum type,
                                                   const void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureSubImage2D);
+}
 
 void INTERNAL_GL_APIENTRY glTextureSubImage3DNULL(GLuint texture,
                                                   GLint level,
@@ -2743,7 +4766,9 @@ void INTERNAL_GL_APIENTRY glTextureSubImage3DNULL(GLuint texture,
                                                   GLenum format,
                                                   GLenum type,
                                                   const void *pixels)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureSubImage3D);
+}
 
 void INTERNAL_GL_APIENTRY glTextureViewNULL(GLuint texture,
                                             GLenum target,
@@ -2753,235 +4778,391 @@ void INTERNAL_GL_APIENTRY glTextureViewNULL(GLuint texture,
                                             GLuint numlevels,
                                             GLuint minlayer,
                                             GLuint numlayers)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TextureView);
+}
 
 void INTERNAL_GL_APIENTRY glTransformFeedbackBufferBaseNULL(GLuint xfb, GLuint index, GLuint buffer)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TransformFeedbackBufferBase);
+}
 
 void INTERNAL_GL_APIENTRY glTransformFeedbackBufferRangeNULL(GLuint xfb,
                                                              GLuint index,
                                                              GLuint buffer,
                                                              GLintptr offset,
                                                              GLsizeiptr size)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TransformFeedbackBufferRange);
+}
 
 void INTERNAL_GL_APIENTRY glTransformFeedbackVaryingsNULL(GLuint program,
                                                           GLsizei count,
                                                           const GLchar *const *varyings,
                                                           GLenum bufferMode)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::TransformFeedbackVaryings);
+}
 
-void INTERNAL_GL_APIENTRY glUniform1dNULL(GLint location, GLdouble x) {}
+void INTERNAL_GL_APIENTRY glUniform1dNULL(GLint location, GLdouble x)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform1d);
+}
 
-void INTERNAL_GL_APIENTRY glUniform1dvNULL(GLint location, GLsizei count, const GLdouble *value) {}
+void INTERNAL_GL_APIENTRY glUniform1dvNULL(GLint location, GLsizei count, const GLdouble *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform1dv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform1fNULL(GLint location, GLfloat v0) {}
+void INTERNAL_GL_APIENTRY glUniform1fNULL(GLint location, GLfloat v0)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform1f);
+}
 
-void INTERNAL_GL_APIENTRY glUniform1fvNULL(GLint location, GLsizei count, const GLfloat *value) {}
+void INTERNAL_GL_APIENTRY glUniform1fvNULL(GLint location, GLsizei count, const GLfloat *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform1fv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform1iNULL(GLint location, GLint v0) {}
+void INTERNAL_GL_APIENTRY glUniform1iNULL(GLint location, GLint v0)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform1i);
+}
 
-void INTERNAL_GL_APIENTRY glUniform1ivNULL(GLint location, GLsizei count, const GLint *value) {}
+void INTERNAL_GL_APIENTRY glUniform1ivNULL(GLint location, GLsizei count, const GLint *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform1iv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform1uiNULL(GLint location, GLuint v0) {}
+void INTERNAL_GL_APIENTRY glUniform1uiNULL(GLint location, GLuint v0)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform1ui);
+}
 
-void INTERNAL_GL_APIENTRY glUniform1uivNULL(GLint location, GLsizei count, const GLuint *value) {}
+void INTERNAL_GL_APIENTRY glUniform1uivNULL(GLint location, GLsizei count, const GLuint *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform1uiv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform2dNULL(GLint location, GLdouble x, GLdouble y) {}
+void INTERNAL_GL_APIENTRY glUniform2dNULL(GLint location, GLdouble x, GLdouble y)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform2d);
+}
 
-void INTERNAL_GL_APIENTRY glUniform2dvNULL(GLint location, GLsizei count, const GLdouble *value) {}
+void INTERNAL_GL_APIENTRY glUniform2dvNULL(GLint location, GLsizei count, const GLdouble *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform2dv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform2fNULL(GLint location, GLfloat v0, GLfloat v1) {}
+void INTERNAL_GL_APIENTRY glUniform2fNULL(GLint location, GLfloat v0, GLfloat v1)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform2f);
+}
 
-void INTERNAL_GL_APIENTRY glUniform2fvNULL(GLint location, GLsizei count, const GLfloat *value) {}
+void INTERNAL_GL_APIENTRY glUniform2fvNULL(GLint location, GLsizei count, const GLfloat *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform2fv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform2iNULL(GLint location, GLint v0, GLint v1) {}
+void INTERNAL_GL_APIENTRY glUniform2iNULL(GLint location, GLint v0, GLint v1)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform2i);
+}
 
-void INTERNAL_GL_APIENTRY glUniform2ivNULL(GLint location, GLsizei count, const GLint *value) {}
+void INTERNAL_GL_APIENTRY glUniform2ivNULL(GLint location, GLsizei count, const GLint *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform2iv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform2uiNULL(GLint location, GLuint v0, GLuint v1) {}
+void INTERNAL_GL_APIENTRY glUniform2uiNULL(GLint location, GLuint v0, GLuint v1)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform2ui);
+}
 
-void INTERNAL_GL_APIENTRY glUniform2uivNULL(GLint location, GLsizei count, const GLuint *value) {}
+void INTERNAL_GL_APIENTRY glUniform2uivNULL(GLint location, GLsizei count, const GLuint *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform2uiv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform3dNULL(GLint location, GLdouble x, GLdouble y, GLdouble z) {}
+void INTERNAL_GL_APIENTRY glUniform3dNULL(GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform3d);
+}
 
-void INTERNAL_GL_APIENTRY glUniform3dvNULL(GLint location, GLsizei count, const GLdouble *value) {}
+void INTERNAL_GL_APIENTRY glUniform3dvNULL(GLint location, GLsizei count, const GLdouble *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform3dv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform3fNULL(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {}
+void INTERNAL_GL_APIENTRY glUniform3fNULL(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform3f);
+}
 
-void INTERNAL_GL_APIENTRY glUniform3fvNULL(GLint location, GLsizei count, const GLfloat *value) {}
+void INTERNAL_GL_APIENTRY glUniform3fvNULL(GLint location, GLsizei count, const GLfloat *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform3fv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform3iNULL(GLint location, GLint v0, GLint v1, GLint v2) {}
+void INTERNAL_GL_APIENTRY glUniform3iNULL(GLint location, GLint v0, GLint v1, GLint v2)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform3i);
+}
 
-void INTERNAL_GL_APIENTRY glUniform3ivNULL(GLint location, GLsizei count, const GLint *value) {}
+void INTERNAL_GL_APIENTRY glUniform3ivNULL(GLint location, GLsizei count, const GLint *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform3iv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform3uiNULL(GLint location, GLuint v0, GLuint v1, GLuint v2) {}
+void INTERNAL_GL_APIENTRY glUniform3uiNULL(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform3ui);
+}
 
-void INTERNAL_GL_APIENTRY glUniform3uivNULL(GLint location, GLsizei count, const GLuint *value) {}
+void INTERNAL_GL_APIENTRY glUniform3uivNULL(GLint location, GLsizei count, const GLuint *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform3uiv);
+}
 
 void INTERNAL_GL_APIENTRY
 glUniform4dNULL(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform4d);
+}
 
-void INTERNAL_GL_APIENTRY glUniform4dvNULL(GLint location, GLsizei count, const GLdouble *value) {}
+void INTERNAL_GL_APIENTRY glUniform4dvNULL(GLint location, GLsizei count, const GLdouble *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform4dv);
+}
 
 void INTERNAL_GL_APIENTRY
 glUniform4fNULL(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform4f);
+}
 
-void INTERNAL_GL_APIENTRY glUniform4fvNULL(GLint location, GLsizei count, const GLfloat *value) {}
+void INTERNAL_GL_APIENTRY glUniform4fvNULL(GLint location, GLsizei count, const GLfloat *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform4fv);
+}
 
-void INTERNAL_GL_APIENTRY glUniform4iNULL(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {}
+void INTERNAL_GL_APIENTRY glUniform4iNULL(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform4i);
+}
 
-void INTERNAL_GL_APIENTRY glUniform4ivNULL(GLint location, GLsizei count, const GLint *value) {}
+void INTERNAL_GL_APIENTRY glUniform4ivNULL(GLint location, GLsizei count, const GLint *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform4iv);
+}
 
 void INTERNAL_GL_APIENTRY
 glUniform4uiNULL(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform4ui);
+}
 
-void INTERNAL_GL_APIENTRY glUniform4uivNULL(GLint location, GLsizei count, const GLuint *value) {}
+void INTERNAL_GL_APIENTRY glUniform4uivNULL(GLint location, GLsizei count, const GLuint *value)
+{
+    RecordNullDriverCall(NullEntryPoint::Uniform4uiv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformBlockBindingNULL(GLuint program,
                                                     GLuint uniformBlockIndex,
                                                     GLuint uniformBlockBinding)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformBlockBinding);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2dvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix2dv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2fvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix2fv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2x3dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix2x3dv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2x3fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix2x3fv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2x4dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix2x4dv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2x4fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix2x4fv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3dvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix3dv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3fvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix3fv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3x2dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix3x2dv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3x2fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix3x2fv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3x4dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix3x4dv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3x4fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix3x4fv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4dvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix4dv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4fvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix4fv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4x2dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix4x2dv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4x2fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix4x2fv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4x3dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix4x3dv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4x3fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformMatrix4x3fv);
+}
 
 void INTERNAL_GL_APIENTRY glUniformSubroutinesuivNULL(GLenum shadertype,
                                                       GLsizei count,
                                                       const GLuint *indices)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UniformSubroutinesuiv);
+}
 
 GLboolean INTERNAL_GL_APIENTRY glUnmapBufferNULL(GLenum target)
 {
+    RecordNullDriverCall(NullEntryPoint::UnmapBuffer);
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glUnmapNamedBufferNULL(GLuint buffer)
 {
+    RecordNullDriverCall(NullEntryPoint::UnmapNamedBuffer);
     return static_cast<GLboolean>(0);
 }
 
-void INTERNAL_GL_APIENTRY glUseProgramNULL(GLuint program) {}
+void INTERNAL_GL_APIENTRY glUseProgramNULL(GLuint program)
+{
+    RecordNullDriverCall(NullEntryPoint::UseProgram);
+}
 
 void INTERNAL_GL_APIENTRY glUseProgramStagesNULL(GLuint pipeline, GLbitfield stages, GLuint program)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::UseProgramStages);
+}
 
-void INTERNAL_GL_APIENTRY glValidateProgramNULL(GLuint program) {}
+void INTERNAL_GL_APIENTRY glValidateProgramNULL(GLuint program)
+{
+    RecordNullDriverCall(NullEntryPoint::ValidateProgram);
+}
 
-void INTERNAL_GL_APIENTRY glValidateProgramPipelineNULL(GLuint pipeline) {}
+void INTERNAL_GL_APIENTRY glValidateProgramPipelineNULL(GLuint pipeline)
+{
+    RecordNullDriverCall(NullEntryPoint::ValidateProgramPipeline);
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayAttribBindingNULL(GLuint vaobj,
                                                          GLuint attribindex,
                                                          GLuint bindingindex)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexArrayAttribBinding);
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayAttribFormatNULL(GLuint vaobj,
                                                         GLuint attribindex,
@@ -2989,35 +5170,48 @@ void INTERNAL_GL_APIENTRY glVertexArrayAttribFormatNULL(GLuint vaobj,
                                                         GLenum type,
                                                         GLboolean normalized,
                                                         GLuint relativeoffset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexArrayAttribFormat);
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayAttribIFormatNULL(GLuint vaobj,
                                                          GLuint attribindex,
                                                          GLint size,
                                                          GLenum type,
                                                          GLuint relativeoffset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexArrayAttribIFormat);
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayAttribLFormatNULL(GLuint vaobj,
                                                          GLuint attribindex,
                                                          GLint size,
                                                          GLenum type,
                                                          GLuint relativeoffset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexArrayAttribLFormat);
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayBindingDivisorNULL(GLuint vaobj,
                                                           GLuint bindingindex,
                                                           GLuint divisor)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexArrayBindingDivisor);
+}
 
-void INTERNAL_GL_APIENTRY glVertexArrayElementBufferNULL(GLuint vaobj, GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glVertexArrayElementBufferNULL(GLuint vaobj, GLuint buffer)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexArrayElementBuffer);
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayVertexBufferNULL(GLuint vaobj,
                                                         GLuint bindingindex,
                                                         GLuint buffer,
                                                         GLintptr offset,
                                                         GLsizei stride)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexArrayVertexBuffer);
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayVertexBuffersNULL(GLuint vaobj,
                                                          GLuint first,
@@ -3025,232 +5219,452 @@ void INTERNAL_GL_APIENTRY glVertexArrayVertexBuffersNULL(GLuint vaobj,
                                                          const GLuint *buffers,
                                                          const GLintptr *offsets,
                                                          const GLsizei *strides)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexArrayVertexBuffers);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1dNULL(GLuint index, GLdouble x) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1dNULL(GLuint index, GLdouble x)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib1d);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1dvNULL(GLuint index, const GLdouble *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib1dv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1fNULL(GLuint index, GLfloat x) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1fNULL(GLuint index, GLfloat x)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib1f);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1fvNULL(GLuint index, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1fvNULL(GLuint index, const GLfloat *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib1fv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1sNULL(GLuint index, GLshort x) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1sNULL(GLuint index, GLshort x)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib1s);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1svNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1svNULL(GLuint index, const GLshort *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib1sv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2dNULL(GLuint index, GLdouble x, GLdouble y) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2dNULL(GLuint index, GLdouble x, GLdouble y)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib2d);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2dvNULL(GLuint index, const GLdouble *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib2dv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2fNULL(GLuint index, GLfloat x, GLfloat y) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2fNULL(GLuint index, GLfloat x, GLfloat y)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib2f);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2fvNULL(GLuint index, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2fvNULL(GLuint index, const GLfloat *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib2fv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2sNULL(GLuint index, GLshort x, GLshort y) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2sNULL(GLuint index, GLshort x, GLshort y)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib2s);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2svNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2svNULL(GLuint index, const GLshort *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib2sv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib3d);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3dvNULL(GLuint index, const GLdouble *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib3dv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3fNULL(GLuint index, GLfloat x, GLfloat y, GLfloat z) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3fNULL(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib3f);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3fvNULL(GLuint index, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3fvNULL(GLuint index, const GLfloat *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib3fv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3sNULL(GLuint index, GLshort x, GLshort y, GLshort z) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3sNULL(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib3s);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3svNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3svNULL(GLuint index, const GLshort *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib3sv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NbvNULL(GLuint index, const GLbyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NbvNULL(GLuint index, const GLbyte *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4Nbv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NivNULL(GLuint index, const GLint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4Niv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NsvNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NsvNULL(GLuint index, const GLshort *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4Nsv);
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttrib4NubNULL(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4Nub);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NubvNULL(GLuint index, const GLubyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NubvNULL(GLuint index, const GLubyte *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4Nubv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NuivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NuivNULL(GLuint index, const GLuint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4Nuiv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NusvNULL(GLuint index, const GLushort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NusvNULL(GLuint index, const GLushort *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4Nusv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4bvNULL(GLuint index, const GLbyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4bvNULL(GLuint index, const GLbyte *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4bv);
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttrib4dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4d);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4dvNULL(GLuint index, const GLdouble *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4dv);
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttrib4fNULL(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4f);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4fvNULL(GLuint index, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4fvNULL(GLuint index, const GLfloat *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4fv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4ivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4ivNULL(GLuint index, const GLint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4iv);
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttrib4sNULL(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4s);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4svNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4svNULL(GLuint index, const GLshort *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4sv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4ubvNULL(GLuint index, const GLubyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4ubvNULL(GLuint index, const GLubyte *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4ubv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4uivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4uivNULL(GLuint index, const GLuint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4uiv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4usvNULL(GLuint index, const GLushort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4usvNULL(GLuint index, const GLushort *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttrib4usv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribBindingNULL(GLuint attribindex, GLuint bindingindex) {}
+void INTERNAL_GL_APIENTRY glVertexAttribBindingNULL(GLuint attribindex, GLuint bindingindex)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribBinding);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribDivisorNULL(GLuint index, GLuint divisor) {}
+void INTERNAL_GL_APIENTRY glVertexAttribDivisorNULL(GLuint index, GLuint divisor)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribDivisor);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribFormatNULL(GLuint attribindex,
                                                    GLint size,
                                                    GLenum type,
                                                    GLboolean normalized,
                                                    GLuint relativeoffset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribFormat);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI1iNULL(GLuint index, GLint x) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI1iNULL(GLuint index, GLint x)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI1i);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI1ivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI1ivNULL(GLuint index, const GLint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI1iv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI1uiNULL(GLuint index, GLuint x) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI1uiNULL(GLuint index, GLuint x)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI1ui);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI1uivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI1uivNULL(GLuint index, const GLuint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI1uiv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI2iNULL(GLuint index, GLint x, GLint y) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI2iNULL(GLuint index, GLint x, GLint y)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI2i);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI2ivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI2ivNULL(GLuint index, const GLint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI2iv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI2uiNULL(GLuint index, GLuint x, GLuint y) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI2uiNULL(GLuint index, GLuint x, GLuint y)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI2ui);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI2uivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI2uivNULL(GLuint index, const GLuint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI2uiv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI3iNULL(GLuint index, GLint x, GLint y, GLint z) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI3iNULL(GLuint index, GLint x, GLint y, GLint z)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI3i);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI3ivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI3ivNULL(GLuint index, const GLint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI3iv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI3uiNULL(GLuint index, GLuint x, GLuint y, GLuint z) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI3uiNULL(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI3ui);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI3uivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI3uivNULL(GLuint index, const GLuint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI3uiv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4bvNULL(GLuint index, const GLbyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4bvNULL(GLuint index, const GLbyte *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI4bv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4iNULL(GLuint index, GLint x, GLint y, GLint z, GLint w) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4iNULL(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI4i);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4ivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4ivNULL(GLuint index, const GLint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI4iv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4svNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4svNULL(GLuint index, const GLshort *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI4sv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4ubvNULL(GLuint index, const GLubyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4ubvNULL(GLuint index, const GLubyte *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI4ubv);
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttribI4uiNULL(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI4ui);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4uivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4uivNULL(GLuint index, const GLuint *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI4uiv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4usvNULL(GLuint index, const GLushort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4usvNULL(GLuint index, const GLushort *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribI4usv);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribIFormatNULL(GLuint attribindex,
                                                     GLint size,
                                                     GLenum type,
                                                     GLuint relativeoffset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribIFormat);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribIPointerNULL(GLuint index,
                                                      GLint size,
                                                      GLenum type,
                                                      GLsizei stride,
                                                      const void *pointer)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribIPointer);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL1dNULL(GLuint index, GLdouble x) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL1dNULL(GLuint index, GLdouble x)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribL1d);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL1dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL1dvNULL(GLuint index, const GLdouble *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribL1dv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL2dNULL(GLuint index, GLdouble x, GLdouble y) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL2dNULL(GLuint index, GLdouble x, GLdouble y)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribL2d);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL2dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL2dvNULL(GLuint index, const GLdouble *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribL2dv);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL3dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL3dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribL3d);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL3dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL3dvNULL(GLuint index, const GLdouble *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribL3dv);
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttribL4dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribL4d);
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL4dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL4dvNULL(GLuint index, const GLdouble *v)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribL4dv);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribLFormatNULL(GLuint attribindex,
                                                     GLint size,
                                                     GLenum type,
                                                     GLuint relativeoffset)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribLFormat);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribLPointerNULL(GLuint index,
                                                      GLint size,
                                                      GLenum type,
                                                      GLsizei stride,
                                                      const void *pointer)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribLPointer);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP1uiNULL(GLuint index,
                                                  GLenum type,
                                                  GLboolean normalized,
                                                  GLuint value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribP1ui);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP1uivNULL(GLuint index,
                                                   GLenum type,
                                                   GLboolean normalized,
                                                   const GLuint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribP1uiv);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP2uiNULL(GLuint index,
                                                  GLenum type,
                                                  GLboolean normalized,
                                                  GLuint value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribP2ui);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP2uivNULL(GLuint index,
                                                   GLenum type,
                                                   GLboolean normalized,
                                                   const GLuint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribP2uiv);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP3uiNULL(GLuint index,
                                                  GLenum type,
                                                  GLboolean normalized,
                                                  GLuint value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribP3ui);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP3uivNULL(GLuint index,
                                                   GLenum type,
                                                   GLboolean normalized,
                                                   const GLuint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribP3uiv);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP4uiNULL(GLuint index,
                                                  GLenum type,
                                                  GLboolean normalized,
                                                  GLuint value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribP4ui);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP4uivNULL(GLuint index,
                                                   GLenum type,
                                                   GLboolean normalized,
                                                   const GLuint *value)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribP4uiv);
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribPointerNULL(GLuint index,
                                                     GLint size,
@@ -3258,19 +5672,35 @@ void INTERNAL_GL_APIENTRY glVertexAttribPointerNULL(GLuint index,
                                                     GLboolean normalized,
                                                     GLsizei stride,
                                                     const void *pointer)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::VertexAttribPointer);
+}
 
-void INTERNAL_GL_APIENTRY glVertexBindingDivisorNULL(GLuint bindingindex, GLuint divisor) {}
+void INTERNAL_GL_APIENTRY glVertexBindingDivisorNULL(GLuint bindingindex, GLuint divisor)
+{
+    RecordNullDriverCall(NullEntryPoint::VertexBindingDivisor);
+}
 
-void INTERNAL_GL_APIENTRY glViewportNULL(GLint x, GLint y, GLsizei width, GLsizei height) {}
+void INTERNAL_GL_APIENTRY glViewportNULL(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    RecordNullDriverCall(NullEntryPoint::Viewport);
+}
 
-void INTERNAL_GL_APIENTRY glViewportArrayvNULL(GLuint first, GLsizei count, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glViewportArrayvNULL(GLuint first, GLsizei count, const GLfloat *v)
+{
+    RecordNullDriverCall(NullEntryPoint::ViewportArrayv);
+}
 
 void INTERNAL_GL_APIENTRY
 glViewportIndexedfNULL(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::ViewportIndexedf);
+}
 
-void INTERNAL_GL_APIENTRY glViewportIndexedfvNULL(GLuint index, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glViewportIndexedfvNULL(GLuint index, const GLfloat *v)
+{
+    RecordNullDriverCall(NullEntryPoint::ViewportIndexedfv);
+}
 
 void INTERNAL_GL_APIENTRY glWaitSemaphoreEXTNULL(GLuint semaphore,
                                                  GLuint numBufferBarriers,
@@ -3278,7 +5708,12 @@ void INTERNAL_GL_APIENTRY glWaitSemaphoreEXTNULL(GLuint semaphore,
                                                  GLuint numTextureBarriers,
                                                  const GLuint *textures,
                                                  const GLenum *srcLayouts)
-{}
+{
+    RecordNullDriverCall(NullEntryPoint::WaitSemaphoreEXT);
+}
 
-void INTERNAL_GL_APIENTRY glWaitSyncNULL(GLsync sync, GLbitfield flags, GLuint64 timeout) {}
+void INTERNAL_GL_APIENTRY glWaitSyncNULL(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    RecordNullDriverCall(NullEntryPoint::WaitSync);
+}
 }  // namespace rx
@@ -2657,6 +2657,9 @@ void InitializeFeatures(const FunctionsGL *functions, angle::FeaturesGL *feature
         features, supportsShaderFramebufferFetchNonCoherentEXT,
         functions->hasGLESExtension("GL_EXT_shader_framebuffer_fetch_non_coherent"));
 
+    // GL 4.4 or GL_ARB_multi_bind
+    ANGLE_FEATURE_CONDITION(features, supportsMultiBind, nativegl::SupportsMultiBind(functions));
+
     // https://crbug.com/1356053
     ANGLE_FEATURE_CONDITION(features, bindCompleteFramebufferForTimerQueries, isMali);
 
@@ -2805,6 +2808,20 @@ bool CanUseClientSideArrays(const FunctionsGL *functions, GLuint vao)
     return CanUseDefaultVertexArrayObject(functions) && vao == 0;
 }
 
+bool SupportsPersistentMappedBuffers(const FunctionsGL *functions)
+{
+    // GL 4.4, GL_ARB_buffer_storage or GL_EXT_buffer_storage, and fences to guard the writes.
+    return functions->bufferStorage != nullptr && functions->mapBufferRange != nullptr &&
+           functions->fenceSync != nullptr;
+}
+
+bool SupportsMultiBind(const FunctionsGL *functions)
+{
+    // GL 4.4 or GL_ARB_multi_bind.
+    return functions->bindTextures != nullptr && functions->bindSamplers != nullptr &&
+           functions->bindBuffersBase != nullptr && functions->bindBuffersRange != nullptr;
+}
+
 bool SupportsCompute(const FunctionsGL *functions)
 {
     // OpenGL 4.2 is required for GL_ARB_compute_shader, some platform drivers have the extension,
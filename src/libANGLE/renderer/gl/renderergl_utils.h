@@ -131,6 +131,8 @@ namespace nativegl
 bool SupportsVertexArrayObjects(const FunctionsGL *functions);
 bool CanUseDefaultVertexArrayObject(const FunctionsGL *functions);
 bool CanUseClientSideArrays(const FunctionsGL *functions, GLuint vao);
+bool SupportsPersistentMappedBuffers(const FunctionsGL *functions);
+bool SupportsMultiBind(const FunctionsGL *functions);
 bool SupportsCompute(const FunctionsGL *functions);
 bool SupportsOcclusionQueries(const FunctionsGL *functions);
 bool SupportsNativeRendering(const FunctionsGL *functions,
@@ -13,6 +13,7 @@
 
 #include "libANGLE/renderer/renderer_utils.h"
 
+#include "common/WorkerThread.h"
 #include "common/base/anglebase/numerics/checked_math.h"
 #include "common/string_utils.h"
 #include "common/system_utils.h"
@@ -30,6 +31,7 @@
 
 #include <cctype>
 #include <cstring>
+#include <thread>
 
 namespace angle
 {
@@ -427,6 +429,147 @@ void SetFloatUniformMatrixFast(unsigned int arrayElementOffset,
 
     memcpy(targetData, valueData, matrixSize * count);
 }
+
+// The source of PackPixels once the rotation and y-flip are resolved: row y of the destination
+// starts at source + y * yAxisPitch, and consecutive pixels of the row are xAxisPitch apart.
+struct PackPixelsRows
+{
+    const PackPixelsParams *params;
+    const angle::Format *sourceFormat;
+    const uint8_t *source;
+    uint8_t *dest;
+    int xAxisPitch;
+    int yAxisPitch;
+    int destWidth;
+    int destHeight;
+    bool isDirectCopy;
+    FastCopyFunction fastCopyFunc;
+};
+
+// Packs the destination rows in the range [begin, end).
+void PackRows(const PackPixelsRows &rows, int begin, int end)
+{
+    const PackPixelsParams &params    = *rows.params;
+    const angle::Format &sourceFormat = *rows.sourceFormat;
+    const angle::Format &destFormat   = *params.destFormat;
+    const uint8_t *source             = rows.source + begin * rows.yAxisPitch;
+    uint8_t *destWithOffset           = rows.dest + begin * params.outputPitch;
+    const int destWidth               = rows.destWidth;
+    const int destHeight              = end - begin;
+
+    if (rows.isDirectCopy)
+    {
+        for (int y = 0; y < destHeight; ++y)
+        {
+            memcpy(destWithOffset + y * params.outputPitch, source + y * rows.yAxisPitch,
+                   destWidth * sourceFormat.pixelBytes);
+        }
+        return;
+    }
+
+    if (rows.fastCopyFunc)
+    {
+        // Fast copy is possible through some special function
+        rows.fastCopyFunc(source, rows.xAxisPitch, rows.yAxisPitch, destWithOffset,
+                          destFormat.pixelBytes, params.outputPitch, destWidth, destHeight);
+        return;
+    }
+
+    PixelWriteFunction pixelWriteFunction = destFormat.pixelWriteFunction;
+    ASSERT(pixelWriteFunction != nullptr);
+
+    // Maximum size of any Color<T> type used.
+    uint8_t temp[16];
+    static_assert(sizeof(temp) >= sizeof(gl::ColorF) && sizeof(temp) >= sizeof(gl::ColorUI) &&
+                      sizeof(temp) >= sizeof(gl::ColorI) &&
+                      sizeof(temp) >= sizeof(angle::DepthStencil),
+                  "Unexpected size of pixel struct.");
+
+    PixelReadFunction pixelReadFunction = sourceFormat.pixelReadFunction;
+    ASSERT(pixelReadFunction != nullptr);
+
+    for (int y = 0; y < destHeight; ++y)
+    {
+        uint8_t *destRow      = destWithOffset + y * params.outputPitch;
+        const uint8_t *srcRow = source + y * rows.yAxisPitch;
+        for (int x = 0; x < destWidth; ++x)
+        {
+            // readFunc and writeFunc will be using the same type of color, CopyTexImage
+            // will not allow the copy otherwise.
+            pixelReadFunction(srcRow + x * rows.xAxisPitch, temp);
+            pixelWriteFunction(temp, destRow + x * destFormat.pixelBytes);
+        }
+    }
+}
+
+class PackRowsTask : public angle::Closure
+{
+  public:
+    PackRowsTask(const PackPixelsRows &rows, int begin, int end)
+        : mRows(rows), mBegin(begin), mEnd(end)
+    {}
+
+    void operator()() override { PackRows(mRows, mBegin, mEnd); }
+
+  private:
+    const PackPixelsRows &mRows;
+    int mBegin;
+    int mEnd;
+};
+
+// Returns the max number of threads to use when packing on the worker thread pool.
+int MaxPackThreads()
+{
+    static const int numThreads =
+        std::max(1, static_cast<int>(std::min(16u, std::thread::hardware_concurrency())));
+    return numThreads;
+}
+
+// Readbacks smaller than this are packed on the calling thread, where the cost of waking the
+// workers would exceed the time saved.
+constexpr int kMinPackPixelsPerTask = 256 * 1024;
+
+// Rows are independent, so if a worker thread pool is provided, they are split in contiguous
+// ranges that are packed in parallel, with the calling thread packing the first range itself.
+void PackAllRows(const PackPixelsRows &rows)
+{
+    angle::WorkerThreadPool *pool = rows.params->workerThreadPool;
+
+    int taskCount = 1;
+    if (pool != nullptr && pool->isAsync() && rows.destWidth > 0)
+    {
+        taskCount = std::min({MaxPackThreads(), rows.destHeight,
+                              rows.destWidth * rows.destHeight / kMinPackPixelsPerTask});
+    }
+
+    if (taskCount <= 1)
+    {
+        PackRows(rows, 0, rows.destHeight);
+        return;
+    }
+
+    const int rowsPerTask = (rows.destHeight + taskCount - 1) / taskCount;
+
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    waitEvents.reserve(taskCount - 1);
+    for (int begin = rowsPerTask; begin < rows.destHeight; begin += rowsPerTask)
+    {
+        const int end = std::min(begin + rowsPerTask, rows.destHeight);
+        std::shared_ptr<angle::WaitableEvent> waitEvent =
+            pool->postWorkerTask(std::make_shared<PackRowsTask>(rows, begin, end));
+        if (waitEvent)
+        {
+            waitEvents.push_back(std::move(waitEvent));
+        }
+        else
+        {
+            PackRows(rows, begin, end);
+        }
+    }
+
+    PackRows(rows, 0, rowsPerTask);
+    angle::WaitableEvent::WaitMany(&waitEvents);
+}
 }  // anonymous namespace
 
 bool IsRotatedAspectRatio(SurfaceRotation rotation)
@@ -493,7 +636,8 @@ PackPixelsParams::PackPixelsParams()
       packBuffer(nullptr),
       reverseRowOrder(false),
       offset(0),
-      rotation(SurfaceRotation::Identity)
+      rotation(SurfaceRotation::Identity),
+      workerThreadPool(nullptr)
 {}
 
 PackPixelsParams::PackPixelsParams(const gl::Rectangle &areaIn,
@@ -508,7 +652,8 @@ PackPixelsParams::PackPixelsParams(const gl::Rectangle &areaIn,
       packBuffer(packBufferIn),
       reverseRowOrder(reverseRowOrderIn),
       offset(offsetIn),
-      rotation(SurfaceRotation::Identity)
+      rotation(SurfaceRotation::Identity),
+      workerThreadPool(nullptr)
 {}
 
 void PackPixels(const PackPixelsParams &params,
@@ -520,7 +665,6 @@ void PackPixels(const PackPixelsParams &params,
     uint8_t *destWithOffset = destWithoutOffset + params.offset;
 
     const uint8_t *source = sourceIn;
-    int inputPitch        = inputPitchIn;
     int destWidth         = params.area.width;
     int destHeight        = params.area.height;
     int xAxisPitch        = 0;
@@ -539,7 +683,6 @@ void PackPixels(const PackPixelsParams &params,
                 // The source image is y-flipped, which means we start at the last row, and each
                 // source row is BEFORE the previous row.
                 source += inputPitchIn * (params.area.height - 1);
-                inputPitch = -inputPitch;
                 yAxisPitch = -inputPitchIn;
             }
             else
@@ -579,7 +722,7 @@ void PackPixels(const PackPixelsParams &params,
             yAxisPitch = -static_cast<int>(sourceFormat.pixelBytes);
             destWidth  = params.area.height;
             destHeight = params.area.width;
-            source += inputPitch * (params.area.height - 1) +
+            source += inputPitchIn * (params.area.height - 1) +
                       sourceFormat.pixelBytes * (params.area.width - 1);
             break;
         default:
@@ -587,54 +730,21 @@ void PackPixels(const PackPixelsParams &params,
             break;
     }
 
-    if (params.rotation == SurfaceRotation::Identity && sourceFormat == *params.destFormat)
-    {
-        // Direct copy possible
-        for (int y = 0; y < params.area.height; ++y)
-        {
-            memcpy(destWithOffset + y * params.outputPitch, source + y * inputPitch,
-                   params.area.width * sourceFormat.pixelBytes);
-        }
-        return;
-    }
-
-    FastCopyFunction fastCopyFunc = sourceFormat.fastCopyFunctions.get(params.destFormat->id);
-
-    if (fastCopyFunc)
-    {
-        // Fast copy is possible through some special function
-        fastCopyFunc(source, xAxisPitch, yAxisPitch, destWithOffset, params.destFormat->pixelBytes,
-                     params.outputPitch, destWidth, destHeight);
-        return;
-    }
-
-    PixelWriteFunction pixelWriteFunction = params.destFormat->pixelWriteFunction;
-    ASSERT(pixelWriteFunction != nullptr);
-
-    // Maximum size of any Color<T> type used.
-    uint8_t temp[16];
-    static_assert(sizeof(temp) >= sizeof(gl::ColorF) && sizeof(temp) >= sizeof(gl::ColorUI) &&
-                      sizeof(temp) >= sizeof(gl::ColorI) &&
-                      sizeof(temp) >= sizeof(angle::DepthStencil),
-                  "Unexpected size of pixel struct.");
-
-    PixelReadFunction pixelReadFunction = sourceFormat.pixelReadFunction;
-    ASSERT(pixelReadFunction != nullptr);
-
-    for (int y = 0; y < destHeight; ++y)
-    {
-        for (int x = 0; x < destWidth; ++x)
-        {
-            uint8_t *dest =
-                destWithOffset + y * params.outputPitch + x * params.destFormat->pixelBytes;
-            const uint8_t *src = source + y * yAxisPitch + x * xAxisPitch;
-
-            // readFunc and writeFunc will be using the same type of color, CopyTexImage
-            // will not allow the copy otherwise.
-            pixelReadFunction(src, temp);
-            pixelWriteFunction(temp, dest);
-        }
-    }
+    PackPixelsRows rows;
+    rows.params       = &params;
+    rows.sourceFormat = &sourceFormat;
+    rows.source       = source;
+    rows.dest         = destWithOffset;
+    rows.xAxisPitch   = xAxisPitch;
+    rows.yAxisPitch   = yAxisPitch;
+    rows.destWidth    = destWidth;
+    rows.destHeight   = destHeight;
+    // Direct copy is possible if the rows are not rotated and the formats match.
+    rows.isDirectCopy =
+        params.rotation == SurfaceRotation::Identity && sourceFormat == *params.destFormat;
+    rows.fastCopyFunc = sourceFormat.fastCopyFunctions.get(params.destFormat->id);
+
+    PackAllRows(rows);
 }
 
 angle::Result GetPackPixelsParams(const gl::InternalFormat &sizedFormatInfo,
@@ -30,6 +30,7 @@ namespace angle
 struct FeatureSetBase;
 struct Format;
 struct ImageLoadContext;
+class WorkerThreadPool;
 enum class FormatID : uint8_t;
 }  // namespace angle
 
@@ -143,6 +144,8 @@ struct PackPixelsParams
     bool reverseRowOrder;
     ptrdiff_t offset;
     SurfaceRotation rotation;
+    // If set, large readbacks are packed in parallel on this pool.
+    angle::WorkerThreadPool *workerThreadPool;
 };
 
 void PackPixels(const PackPixelsParams &params,
@@ -256,6 +256,10 @@ CLCommandQueueVk::CLCommandQueueVk(const cl::CommandQueue &commandQueue)
       mPrintfBuffer(nullptr),
       mComputePassCommands(nullptr),
       mQueueSerialIndex(kInvalidQueueSerialIndex),
+      mCurrentCommandNode(kFinishedCommandNode),
+      mFirstCommandNodeSinceBarrier(kFinishedCommandNode),
+      mCommandNodeWaitCount(0),
+      mMemoryAccessNodeCount(0),
       mNeedPrintfHandling(false),
       mFinishHandler(this)
 {}
@@ -1266,7 +1270,7 @@ angle::Result CLCommandQueueVk::enqueueNDRangeKernel(const cl::Kernel &kernel,
     std::scoped_lock<std::mutex> sl(mCommandQueueMutex);
 
     ANGLE_TRY(preEnqueueOps(event, cl::ExecutionStatus::Queued));
-    ANGLE_TRY(processWaitlist(waitEvents));
+    ANGLE_TRY(processWaitlist(waitEvents, WaitlistDependency::MemoryHazards));
 
     vk::PipelineCacheAccess pipelineCache;
     vk::PipelineHelper *pipelineHelper = nullptr;
@@ -1454,9 +1458,93 @@ angle::Result CLCommandQueueVk::insertBarrier()
         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
         &memoryBarrier, 0, nullptr, 0, nullptr);
 
+    // The previous commands are now complete for the ones that follow, except for the memory
+    // accesses of the current command that were already tracked.
+    mFirstCommandNodeSinceBarrier = mCurrentCommandNode;
+    mCurrentCommandWaits.clear();
+    mCurrentCommandDependencies.clear();
+    mCommandNodeWaits.clear();
+    mCommandNodeWaitCount  = 0;
+    mMemoryAccessNodeCount = 0;
+    angle::HashMap<cl::Object *, MemoryAccessNodes> currentCommandAccessNodes;
+    for (const auto &memoryAccessNodes : mMemoryAccessNodes)
+    {
+        const MemoryAccessNodes &accessNodes = memoryAccessNodes.second;
+        if (accessNodes.readers.contains(mCurrentCommandNode))
+        {
+            currentCommandAccessNodes[memoryAccessNodes.first].readers.insert(mCurrentCommandNode);
+            mMemoryAccessNodeCount++;
+        }
+        if (accessNodes.writers.contains(mCurrentCommandNode))
+        {
+            currentCommandAccessNodes[memoryAccessNodes.first].writers.insert(mCurrentCommandNode);
+            mMemoryAccessNodeCount++;
+        }
+    }
+    mMemoryAccessNodes = std::move(currentCommandAccessNodes);
+
     return angle::Result::Continue;
 }
 
+void CLCommandQueueVk::onCommandNodesFinished()
+{
+    // Every later command depends on the finished ones.  Their memory accesses still need a
+    // barrier to be visible to the later commands, so they are kept as the accesses of a single
+    // node, which may include the accesses already tracked for the current command.
+    mCurrentCommandWaits.clear();
+    mCurrentCommandDependencies.clear();
+    mCommandNodeWaits.clear();
+    mCommandNodeWaitCount  = 0;
+    mMemoryAccessNodeCount = 0;
+    for (auto &memoryAccessNodes : mMemoryAccessNodes)
+    {
+        for (angle::HashSet<CLCommandNode> *nodes :
+             {&memoryAccessNodes.second.readers, &memoryAccessNodes.second.writers})
+        {
+            if (!nodes->empty())
+            {
+                nodes->clear();
+                nodes->insert(kFinishedCommandNode);
+                mMemoryAccessNodeCount++;
+            }
+        }
+    }
+}
+
+bool CLCommandQueueVk::dependsOnAnyCommandNode(const angle::HashSet<CLCommandNode> &nodes) const
+{
+    for (CLCommandNode node : nodes)
+    {
+        if (node != mCurrentCommandNode &&
+            (!isOutOfOrder() || node == kFinishedCommandNode ||
+             mCurrentCommandDependencies.contains(node)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CLCommandQueueVk::resolveCurrentCommandDependencies()
+{
+    // Each waited command is followed once, so this is linear in the number of tracked waits.
+    std::vector<CLCommandNode> pendingNodes(mCurrentCommandWaits);
+    while (!pendingNodes.empty())
+    {
+        CLCommandNode node = pendingNodes.back();
+        pendingNodes.pop_back();
+        if (!mCurrentCommandDependencies.insert(node).second)
+        {
+            continue;
+        }
+        auto waits = mCommandNodeWaits.find(node);
+        if (waits != mCommandNodeWaits.end())
+        {
+            pendingNodes.insert(pendingNodes.end(), waits->second.begin(), waits->second.end());
+        }
+    }
+}
+
 angle::Result CLCommandQueueVk::enqueueBarrier()
 {
     std::scoped_lock<std::mutex> sl(mCommandQueueMutex);
@@ -1544,45 +1632,40 @@ angle::Result CLCommandQueueVk::addMemoryDependencies(cl::Memory *clMem, MemoryH
     // Take an usage count
     mCommandsStateMap.addMemory(mComputePassCommands->getQueueSerial(), clMem);
 
-    // Handle possible resource hazards
-    bool needsBarrier = false;
+    // Handle possible resource hazards with the commands the current one depends on
+    bool needsBarrier = mMemoryAccessNodes.size() >= kMaxDependencyTrackerSize ||
+                        mMemoryAccessNodeCount >= kMaxTrackedCommandNodes;
     // A barrier is needed in the following cases
     //  - Presence of a pending write, irrespective of the current usage
     //  - A write usage with a pending read
-    if (mWriteDependencyTracker.contains(clMem) || mWriteDependencyTracker.contains(parentMem) ||
-        mWriteDependencyTracker.size() == kMaxDependencyTrackerSize)
-    {
-        needsBarrier = true;
-    }
-    else if (isWritable && (mReadDependencyTracker.contains(clMem) ||
-                            mReadDependencyTracker.contains(parentMem) ||
-                            mReadDependencyTracker.size() == kMaxDependencyTrackerSize))
+    for (cl::Memory *mem : {clMem, parentMem})
     {
-        needsBarrier = true;
+        auto accessNodes = mMemoryAccessNodes.find(mem);
+        if (mem == nullptr || accessNodes == mMemoryAccessNodes.end())
+        {
+            continue;
+        }
+        needsBarrier = needsBarrier || dependsOnAnyCommandNode(accessNodes->second.writers) ||
+                       (isWritable && dependsOnAnyCommandNode(accessNodes->second.readers));
     }
 
-    // If a barrier is inserted with the current usage, we can safely clear existing dependencies as
-    // this barrier signalling ensures their completion.
+    // The barrier ensures the completion of the existing dependencies, so they are cleared.
     if (needsBarrier)
     {
-        mReadDependencyTracker.clear();
-        mWriteDependencyTracker.clear();
+        ANGLE_TRY(insertBarrier());
     }
     // Add the current mem object, to the appropriate dependency list
-    if (isWritable)
+    for (cl::Memory *mem : {clMem, parentMem})
     {
-        mWriteDependencyTracker.insert(clMem);
-        if (parentMem)
+        if (mem != nullptr)
         {
-            mWriteDependencyTracker.insert(parentMem);
-        }
-    }
-    else
-    {
-        mReadDependencyTracker.insert(clMem);
-        if (parentMem)
-        {
-            mReadDependencyTracker.insert(parentMem);
+            MemoryAccessNodes &accessNodes = mMemoryAccessNodes[mem];
+            angle::HashSet<CLCommandNode> &nodes =
+                isWritable ? accessNodes.writers : accessNodes.readers;
+            if (nodes.insert(mCurrentCommandNode).second)
+            {
+                mMemoryAccessNodeCount++;
+            }
         }
     }
 
@@ -1594,10 +1677,6 @@ angle::Result CLCommandQueueVk::addMemoryDependencies(cl::Memory *clMem, MemoryH
                                          vkMem.getImage().getAspectFlags(),
                                          vk::ImageAccess::ComputeShaderWrite, &vkMem.getImage());
     }
-    if (needsBarrier)
-    {
-        ANGLE_TRY(insertBarrier());
-    }
 
     return angle::Result::Continue;
 }
@@ -2156,7 +2235,8 @@ angle::Result CLCommandQueueVk::flushComputePassCommands()
                                                              cl::ExecutionStatus::Submitted);
 }
 
-angle::Result CLCommandQueueVk::processWaitlist(const cl::EventPtrs &waitEvents)
+angle::Result CLCommandQueueVk::processWaitlist(const cl::EventPtrs &waitEvents,
+                                                WaitlistDependency dependency)
 {
     if (!waitEvents.empty())
     {
@@ -2168,7 +2248,29 @@ angle::Result CLCommandQueueVk::processWaitlist(const cl::EventPtrs &waitEvents)
                 // Track the user and external cq events separately
                 mExternalEvents.push_back(event);
             }
-            if (!event->isUserEvent())
+            if (!event->isUserEvent() && event->getCommandQueue() == &mCommandQueue)
+            {
+                // A barrier was already inserted after commands older than the last one
+                CLCommandNode node = event->getImpl<CLEventVk>().getCommandNode();
+                if (node < mFirstCommandNodeSinceBarrier)
+                {
+                    continue;
+                }
+
+                // Kernels only have to wait for the kernels whose memory accesses conflict with
+                // theirs.  Other commands are not covered by the memory access tracking.  Once too
+                // many waits are tracked, a barrier is inserted instead.
+                cl_command_type commandType = event->getCommandType();
+                if (dependency == WaitlistDependency::MemoryHazards && isOutOfOrder() &&
+                    (commandType == CL_COMMAND_NDRANGE_KERNEL || commandType == CL_COMMAND_TASK) &&
+                    mCommandNodeWaitCount + mCurrentCommandWaits.size() < kMaxTrackedCommandNodes)
+                {
+                    mCurrentCommandWaits.push_back(node);
+                    continue;
+                }
+                needsBarrier = true;
+            }
+            else if (!event->isUserEvent())
             {
                 // At the moment, the vulkan backend is set up with single queue for all the command
                 // buffer recording (only if the Vk Queue priorities match).
@@ -2181,6 +2283,7 @@ angle::Result CLCommandQueueVk::processWaitlist(const cl::EventPtrs &waitEvents)
         {
             ANGLE_TRY(insertBarrier());
         }
+        resolveCurrentCommandDependencies();
     }
     return angle::Result::Continue;
 }
@@ -2214,6 +2317,11 @@ angle::Result CLCommandQueueVk::submitCommands()
 angle::Result CLCommandQueueVk::preEnqueueOps(cl::EventPtr &event,
                                               cl::ExecutionStatus initialStatus)
 {
+    // Start a new node in the dependency graph
+    mCurrentCommandNode++;
+    mCurrentCommandWaits.clear();
+    mCurrentCommandDependencies.clear();
+
     if (event != nullptr)
     {
         ANGLE_TRY(event->initBackend([initialStatus](const cl::Event &event) {
@@ -2238,6 +2346,13 @@ angle::Result CLCommandQueueVk::postEnqueueOps(const cl::EventPtr &event)
 
         cl_int status;
         CLEventVk &eventVk = event->getImpl<CLEventVk>();
+        eventVk.setCommandNode(mCurrentCommandNode);
+        if (isOutOfOrder() && !mCurrentCommandWaits.empty())
+        {
+            mCommandNodeWaitCount += mCurrentCommandWaits.size();
+            mCommandNodeWaits[mCurrentCommandNode] = std::move(mCurrentCommandWaits);
+            mCurrentCommandWaits.clear();
+        }
         ANGLE_TRY(eventVk.getCommandExecutionStatus(status));
         if (cl::FromCLenum<cl::ExecutionStatus>(status) == cl::ExecutionStatus::Complete)
         {
@@ -2390,8 +2505,10 @@ angle::Result CLCommandQueueVk::finishInternal()
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CLCommandQueueVk::finish");
     ANGLE_TRY(flushInternal());
+    ANGLE_TRY(finishQueueSerialInternal(mLastSubmittedQueueSerial));
 
-    return finishQueueSerialInternal(mLastSubmittedQueueSerial);
+    onCommandNodesFinished();
+    return angle::Result::Continue;
 }
 
 // Helper function to insert appropriate memory barriers before accessing the resources in the
@@ -486,6 +486,8 @@ class CLCommandQueueVk : public CLCommandQueueImpl
 
   private:
     static constexpr size_t kMaxDependencyTrackerSize    = 64;
+    // Limit on the memory access nodes and on the wait list edges tracked between barriers
+    static constexpr size_t kMaxTrackedCommandNodes      = 256;
     static constexpr size_t kMaxHostBufferUpdateListSize = 16;
 
     angle::Result resetCommandBufferWithError(cl_int errorCode);
@@ -509,7 +511,19 @@ class CLCommandQueueVk : public CLCommandQueueImpl
     // buffer.
     angle::Result flushComputePassCommands();
 
-    angle::Result processWaitlist(const cl::EventPtrs &waitEvents);
+    // Same-queue events in the wait list of a kernel on an out-of-order queue only add edges to
+    // the dependency graph, barriers are then inserted for the memory hazards along these edges.
+    // All other waits insert a barrier, unless one was already inserted since the waited command.
+    enum class WaitlistDependency
+    {
+        Barrier,
+        MemoryHazards,
+    };
+    angle::Result processWaitlist(const cl::EventPtrs &waitEvents)
+    {
+        return processWaitlist(waitEvents, WaitlistDependency::Barrier);
+    }
+    angle::Result processWaitlist(const cl::EventPtrs &waitEvents, WaitlistDependency dependency);
     angle::Result preEnqueueOps(cl::EventPtr &event, cl::ExecutionStatus initialStatus);
     angle::Result postEnqueueOps(const cl::EventPtr &event);
 
@@ -538,6 +552,18 @@ class CLCommandQueueVk : public CLCommandQueueImpl
     };
     angle::Result addMemoryDependencies(cl::Memory *mem, MemoryHandleAccess access);
 
+    bool isOutOfOrder() const
+    {
+        return mCommandQueue.getProperties().intersects(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    }
+    // Whether the current command has to wait for any of |nodes|.  Commands of in-order queues
+    // wait for every previous command.
+    bool dependsOnAnyCommandNode(const angle::HashSet<CLCommandNode> &nodes) const;
+    // Finds all the commands the current one waits on, following the waits of the waited commands.
+    void resolveCurrentCommandDependencies();
+    // Called once all the recorded commands are complete.
+    void onCommandNodesFinished();
+
     angle::Result submitEmptyCommand();
 
     void addCommandBufferDiagnostics(const std::string &addCommandBufferDiagnostics);
@@ -559,9 +585,28 @@ class CLCommandQueueVk : public CLCommandQueueImpl
     // External dependent events that this queue has to wait on
     cl::EventPtrs mExternalEvents;
 
+    // Every enqueued command is a node of a dependency graph.  Only the commands recorded since the
+    // last barrier are tracked, as the barrier orders them after all the previous commands.  The
+    // commands found complete by a finish are all replaced by kFinishedCommandNode.
+    static constexpr CLCommandNode kFinishedCommandNode = 0;
+    CLCommandNode mCurrentCommandNode;
+    CLCommandNode mFirstCommandNodeSinceBarrier;
+    // Out-of-order queues: the same-queue kernels the current command waits on through its event
+    // wait list, and the same for the previous commands with an event.  Only these direct waits
+    // are stored, the current command's indirect ones are found by following them.
+    std::vector<CLCommandNode> mCurrentCommandWaits;
+    angle::HashSet<CLCommandNode> mCurrentCommandDependencies;
+    angle::HashMap<CLCommandNode, std::vector<CLCommandNode>> mCommandNodeWaits;
+    size_t mCommandNodeWaitCount;
+
     // Keep track of kernel resources on prior kernel enqueues
-    angle::HashSet<cl::Object *> mWriteDependencyTracker;
-    angle::HashSet<cl::Object *> mReadDependencyTracker;
+    struct MemoryAccessNodes
+    {
+        angle::HashSet<CLCommandNode> readers;
+        angle::HashSet<CLCommandNode> writers;
+    };
+    angle::HashMap<cl::Object *, MemoryAccessNodes> mMemoryAccessNodes;
+    size_t mMemoryAccessNodeCount;
 
     CommandsStateMap mCommandsStateMap;
 
@@ -73,7 +73,8 @@ CLDeviceVk::CLDeviceVk(const cl::Device &device, vk::Renderer *renderer)
         {cl::DeviceInfo::QueueOnDeviceProperties, 0},
         {cl::DeviceInfo::PartitionAffinityDomain, 0},
         {cl::DeviceInfo::DeviceEnqueueCapabilities, 0},
-        {cl::DeviceInfo::QueueOnHostProperties, CL_QUEUE_PROFILING_ENABLE},
+        {cl::DeviceInfo::QueueOnHostProperties,
+         CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE | CL_QUEUE_PROFILING_ENABLE},
 
         // TODO(aannestrand) Update these hardcoded platform/device queries
         // http://anglebug.com/42266935
@@ -23,7 +23,8 @@ CLEventVk::CLEventVk(const cl::Event &event, const cl::ExecutionStatus initialSt
     : CLEventImpl(event),
       mStatus(cl::ToCLenum(initialStatus)),
       mProfilingTimestamps(ProfilingTimestamps{}),
-      mQueueSerial(QueueSerial())
+      mQueueSerial(QueueSerial()),
+      mCommandNode(0)
 {
     ANGLE_CL_IMPL_TRY(setTimestamp(*mStatus));
 }
@@ -19,6 +19,10 @@
 namespace rx
 {
 
+// Identifies a command in the dependency graph of its command queue.  Increases with every command
+// enqueued.
+using CLCommandNode = uint64_t;
+
 class CLEventVk : public CLEventImpl
 {
   public:
@@ -31,6 +35,9 @@ class CLEventVk : public CLEventImpl
     const QueueSerial &getQueueSerial() { return mQueueSerial; }
     void setQueueSerial(QueueSerial queueSerial);
 
+    CLCommandNode getCommandNode() const { return mCommandNode; }
+    void setCommandNode(CLCommandNode commandNode) { mCommandNode = commandNode; }
+
     angle::Result getCommandExecutionStatus(cl_int &executionStatus) override;
 
     angle::Result setUserEventStatus(cl_int executionStatus) override;
@@ -63,6 +70,7 @@ class CLEventVk : public CLEventImpl
     };
     angle::SynchronizedValue<ProfilingTimestamps> mProfilingTimestamps;
     QueueSerial mQueueSerial;
+    CLCommandNode mCommandNode;
 };
 
 }  // namespace rx
@@ -36,6 +36,13 @@ constexpr bool kUseComputeOnlyQueue = true;
 #else
 constexpr bool kUseComputeOnlyQueue = false;
 #endif
+
+constexpr size_t kBlobCacheSize = 1024 * 1024;
+// Holds the SPIR-V of several big programs, a single one of which may exceed kBlobCacheSize.
+constexpr size_t kClspvOutputCacheSize = 16 * 1024 * 1024;
+// The amount of clspv output stored in the application's blob cache per run, which leaves room for
+// the programs and pipeline caches of the EGL displays that share it.
+constexpr size_t kClspvOutputPersistentSize = 16 * 1024 * 1024;
 }  // namespace
 
 angle::Result CLPlatformVk::initBackendRenderer()
@@ -202,6 +209,10 @@ angle::Result CLPlatformVk::createContextFromType(cl::Context &context,
 
 angle::Result CLPlatformVk::unloadCompiler()
 {
+    // The application is done building programs for now.  The clspv output stored in its blob
+    // cache is still found by the next builds.
+    std::scoped_lock<angle::SimpleMutex> lock(mClspvOutputCacheMutex);
+    mClspvOutputCache.clear();
     return angle::Result::Continue;
 }
 
@@ -227,7 +238,12 @@ const std::string &CLPlatformVk::GetVersionString()
 }
 
 CLPlatformVk::CLPlatformVk(const cl::Platform &platform)
-    : CLPlatformImpl(platform), vk::ErrorContext(new vk::Renderer()), mBlobCache(1024 * 1024)
+    : CLPlatformImpl(platform),
+      vk::ErrorContext(new vk::Renderer()),
+      mBlobCache(kBlobCacheSize),
+      mClspvOutputCache(kClspvOutputCacheSize),
+      mClspvOutputPersistentSize(0),
+      mApplicationBlobCache(0)
 {}
 
 void CLPlatformVk::handleError(VkResult result,
@@ -306,6 +322,97 @@ bool CLPlatformVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue
     return result;
 }
 
+void CLPlatformVk::putClspvOutput(const angle::BlobCacheKey &key, angle::MemoryBuffer &&value)
+{
+    // The key hashes an "ANGLE clspv program" prefix, which keeps it apart from the keys of the
+    // displays in the application's cache.
+    egl::BlobCache *applicationBlobCache = getApplicationBlobCache();
+    if (applicationBlobCache != nullptr)
+    {
+        bool fitsBudget = false;
+        {
+            std::scoped_lock<angle::SimpleMutex> lock(mClspvOutputCacheMutex);
+            fitsBudget = value.size() <= kClspvOutputPersistentSize - mClspvOutputPersistentSize;
+            if (fitsBudget)
+            {
+                mClspvOutputPersistentSize += value.size();
+            }
+        }
+        if (fitsBudget)
+        {
+            applicationBlobCache->putApplication(nullptr, key, value);
+        }
+    }
+
+    std::scoped_lock<angle::SimpleMutex> lock(mClspvOutputCacheMutex);
+    size_t valueSize = value.size();
+    mClspvOutputCache.put(key, std::move(value), valueSize);
+}
+
+bool CLPlatformVk::getClspvOutput(const angle::BlobCacheKey &key, angle::MemoryBuffer *valueOut)
+{
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mClspvOutputCacheMutex);
+        const angle::MemoryBuffer *entry;
+        if (mClspvOutputCache.get(key, &entry))
+        {
+            if (!valueOut->resize(entry->size()))
+            {
+                return false;
+            }
+            memcpy(valueOut->data(), entry->data(), entry->size());
+            return true;
+        }
+    }
+
+    egl::BlobCache *applicationBlobCache = getApplicationBlobCache();
+    if (applicationBlobCache == nullptr)
+    {
+        return false;
+    }
+
+    // The scratch buffer is local, so programs can be built on several threads at the same time.
+    angle::ScratchBuffer scratchBuffer;
+    egl::BlobCache::Value value;
+    if (!applicationBlobCache->get(nullptr, &scratchBuffer, key, &value) ||
+        !valueOut->resize(value.size()))
+    {
+        return false;
+    }
+    memcpy(valueOut->data(), value.data(), value.size());
+
+    // Keep the entry in memory, so the next build doesn't go through the application.
+    angle::MemoryBuffer entry;
+    if (entry.resize(value.size()))
+    {
+        memcpy(entry.data(), value.data(), value.size());
+        std::scoped_lock<angle::SimpleMutex> lock(mClspvOutputCacheMutex);
+        mClspvOutputCache.put(key, std::move(entry), value.size());
+    }
+    return true;
+}
+
+void CLPlatformVk::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
+{
+    mApplicationBlobCache.setBlobCacheFuncs(set, get);
+}
+
+egl::BlobCache *CLPlatformVk::getApplicationBlobCache()
+{
+    if (!mApplicationBlobCache.areBlobCacheFuncsSet())
+    {
+        EGLSetBlobFuncANDROID set = nullptr;
+        EGLGetBlobFuncANDROID get = nullptr;
+        egl::Display::GetApplicationBlobCacheFuncs(&set, &get);
+        if (set == nullptr || get == nullptr)
+        {
+            return nullptr;
+        }
+        mApplicationBlobCache.setBlobCacheFuncs(set, get);
+    }
+    return &mApplicationBlobCache;
+}
+
 std::shared_ptr<angle::WaitableEvent> CLPlatformVk::postMultiThreadWorkerTask(
     const std::shared_ptr<angle::Closure> &task)
 {
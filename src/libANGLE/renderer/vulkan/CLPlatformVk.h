@@ -63,6 +63,17 @@ class CLPlatformVk : public CLPlatformImpl, public vk::ErrorContext, public vk::
         const std::shared_ptr<angle::Closure> &task) override;
     void notifyDeviceLost() override;
 
+    // The clspv output of CLProgramVk is kept apart from the pipeline cache blobs, with its own
+    // budget.  Entries are copied in and out under the lock, as another thread may evict them.
+    // They are also stored in the application's blob cache, if its callbacks are set, so they are
+    // kept across runs.
+    void putClspvOutput(const angle::BlobCacheKey &key, angle::MemoryBuffer &&value);
+    bool getClspvOutput(const angle::BlobCacheKey &key, angle::MemoryBuffer *valueOut);
+
+    // CL has no display of its own, so unless set here, the application's callbacks are those set
+    // on an EGL display.
+    void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
+
   private:
     explicit CLPlatformVk(const cl::Platform &platform);
 
@@ -70,8 +81,17 @@ class CLPlatformVk : public CLPlatformImpl, public vk::ErrorContext, public vk::
     const char *getWSIExtension();
     const char *getWSILayer() { return nullptr; }
 
+    egl::BlobCache *getApplicationBlobCache();
+
     mutable angle::SimpleMutex mBlobCacheMutex;
     angle::SizedMRUCache<angle::BlobCacheKey, angle::MemoryBuffer> mBlobCache;
+
+    angle::SimpleMutex mClspvOutputCacheMutex;
+    angle::SizedMRUCache<angle::BlobCacheKey, angle::MemoryBuffer> mClspvOutputCache;
+    size_t mClspvOutputPersistentSize;
+
+    // Only used through the application's callbacks, so it never holds entries itself.
+    egl::BlobCache mApplicationBlobCache;
 };
 
 constexpr cl_version CLPlatformVk::GetVersion()
@@ -22,6 +22,8 @@
 #include "libANGLE/CLProgram.h"
 #include "libANGLE/cl_utils.h"
 
+#include "common/BinaryStream.h"
+#include "common/angle_version_info.h"
 #include "common/log_utils.h"
 #include "common/string_utils.h"
 #include "common/system_utils.h"
@@ -34,6 +36,8 @@
 #include "spirv-tools/libspirv.hpp"
 #include "spirv-tools/optimizer.hpp"
 
+#include <anglebase/sha1.h>
+
 namespace rx
 {
 
@@ -402,6 +406,109 @@ std::string ProcessBuildOptions(const std::vector<std::string> &optionTokens,
     return processedOptions;
 }
 
+// Version of the clspv output stored in the platform cache.  Must be bumped whenever the format of
+// the cache entries changes.
+constexpr uint32_t kClspvCacheVersion = 1;
+
+// The files pulled in through include paths are not part of the cache key, so programs that use
+// them are always built by clspv.
+bool UsesExternalHeaders(const std::vector<std::string> &optionTokens)
+{
+    return std::any_of(optionTokens.begin(), optionTokens.end(), [](const std::string &token) {
+        return angle::BeginsWith(token, "-I") || token == "-include";
+    });
+}
+
+void ComputeClspvCacheKey(const CLDeviceVk &device,
+                          CLProgramVk::BuildType buildType,
+                          const std::string &processedOptions,
+                          const std::vector<size_t> &inputSizes,
+                          const std::vector<const char *> &inputs,
+                          angle::BlobCacheKey *keyOut)
+{
+    gl::BinaryOutputStream hashStream;
+    hashStream.writeString("ANGLE clspv program");
+    hashStream.writeInt(kClspvCacheVersion);
+
+    // clspv is pinned to the ANGLE revision, so the commit hash stands in for the clspv version.
+    hashStream.writeString(angle::GetANGLECommitHash());
+
+    // The device capabilities are mostly captured by the clspv options derived from them.
+    const VkPhysicalDeviceProperties &properties =
+        device.getRenderer()->getPhysicalDeviceProperties();
+    hashStream.writeInt(properties.vendorID);
+    hashStream.writeInt(properties.deviceID);
+    hashStream.writeInt(properties.driverVersion);
+    hashStream.writeEnum(device.getSpirvVersion());
+
+    hashStream.writeEnum(buildType);
+    hashStream.writeString(processedOptions);
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        hashStream.writeInt(inputSizes[i]);
+        hashStream.writeBytes(reinterpret_cast<const unsigned char *>(inputs[i]), inputSizes[i]);
+    }
+
+    const std::vector<uint8_t> &keyData = hashStream.getData();
+    angle::base::SHA1HashBytes(keyData.data(), keyData.size(), keyOut->data());
+}
+
+bool LoadClspvOutput(CLPlatformVk *platform,
+                     const angle::BlobCacheKey &key,
+                     CLProgramVk::DeviceProgramData *deviceProgramDataOut)
+{
+    angle::MemoryBuffer value;
+    if (!platform->getClspvOutput(key, &value))
+    {
+        return false;
+    }
+
+    gl::BinaryInputStream stream(value.data(), value.size());
+    if (stream.readInt<uint32_t>() != kClspvCacheVersion)
+    {
+        return false;
+    }
+
+    std::string buildLog;
+    std::vector<char> IR;
+    angle::spirv::Blob binary;
+    cl_program_binary_type binaryType = stream.readInt<cl_program_binary_type>();
+    stream.readString(&buildLog);
+    stream.readVector(&IR);
+    stream.readVector(&binary);
+    if (stream.error() || !stream.endOfStream())
+    {
+        WARN() << "Failed to load clspv output from the cache!";
+        return false;
+    }
+
+    deviceProgramDataOut->binaryType = binaryType;
+    deviceProgramDataOut->buildLog   = std::move(buildLog);
+    deviceProgramDataOut->IR         = std::move(IR);
+    deviceProgramDataOut->binary     = std::move(binary);
+    return true;
+}
+
+void StoreClspvOutput(CLPlatformVk *platform,
+                      const angle::BlobCacheKey &key,
+                      const CLProgramVk::DeviceProgramData &deviceProgramData)
+{
+    gl::BinaryOutputStream stream;
+    stream.writeInt(kClspvCacheVersion);
+    stream.writeInt(deviceProgramData.binaryType);
+    stream.writeString(deviceProgramData.buildLog);
+    stream.writeVector(deviceProgramData.IR);
+    stream.writeVector(deviceProgramData.binary);
+
+    angle::MemoryBuffer value;
+    if (!value.resize(stream.length()))
+    {
+        return;
+    }
+    memcpy(value.data(), stream.data(), stream.length());
+    platform->putClspvOutput(key, std::move(value));
+}
+
 }  // namespace
 
 void CLAsyncBuildTask::operator()()
@@ -919,6 +1026,7 @@ bool CLProgramVk::buildInternal(const cl::DevicePtrs &devices,
     const bool createLibrary     = std::find(optionTokens.begin(), optionTokens.end(),
                                              "-create-library") != optionTokens.end();
     std::string processedOptions = ProcessBuildOptions(optionTokens, buildType);
+    const bool useClspvCache     = !UsesExternalHeaders(optionTokens);
 
     // Build for each associated device
     for (size_t i = 0; i < devices.size(); ++i)
@@ -930,7 +1038,44 @@ bool CLProgramVk::buildInternal(const cl::DevicePtrs &devices,
         // add clspv compiler options based on device features
         processedOptions += ClspvGetCompilerOptions(&device->getImpl<CLDeviceVk>());
 
-        if (buildType != BuildType::BINARY)
+        // Look for the output of a previous identical build in the platform cache
+        angle::BlobCacheKey clspvCacheKey;
+        bool loadedFromCache = false;
+        if (buildType != BuildType::BINARY && useClspvCache)
+        {
+            std::vector<size_t> inputSizes;
+            std::vector<const char *> inputs;
+            if (buildType == BuildType::LINK)
+            {
+                for (const CLProgramVk::DeviceProgramData *linkProgramData : LinkProgramsList.at(i))
+                {
+                    inputSizes.push_back(linkProgramData->IR.size());
+                    inputs.push_back(linkProgramData->IR.data());
+                }
+            }
+            else
+            {
+                inputSizes.push_back(mProgram.getSource().size());
+                inputs.push_back(mProgram.getSource().c_str());
+            }
+            ComputeClspvCacheKey(device->getImpl<CLDeviceVk>(), buildType, processedOptions,
+                                 inputSizes, inputs, &clspvCacheKey);
+            loadedFromCache = LoadClspvOutput(getPlatform(), clspvCacheKey, &deviceProgramData);
+
+            vk::CacheStats cacheStats;
+            if (loadedFromCache)
+            {
+                cacheStats.hit();
+            }
+            else
+            {
+                cacheStats.miss();
+            }
+            mContext->getRenderer()->accumulateCacheStats(VulkanCacheType::ClspvProgram,
+                                                          cacheStats);
+        }
+
+        if (buildType != BuildType::BINARY && !loadedFromCache)
         {
             // Invoke clspv
             switch (buildType)
@@ -1022,8 +1167,10 @@ bool CLProgramVk::buildInternal(const cl::DevicePtrs &devices,
         // the shader module
         if (deviceProgramData.binaryType == CL_PROGRAM_BINARY_TYPE_EXECUTABLE)
         {
-            // Report SPIR-V validation failure as a build failure
-            if (!ClspvValidate(mContext->getRenderer(), deviceProgramData.binary))
+            // Report SPIR-V validation failure as a build failure.  Cached binaries were validated
+            // before they were stored.
+            if (!loadedFromCache &&
+                !ClspvValidate(mContext->getRenderer(), deviceProgramData.binary))
             {
                 ERR() << "Failed to validate SPIR-V binary!";
                 deviceProgramData.buildStatus = CL_BUILD_ERROR;
@@ -1105,6 +1252,11 @@ bool CLProgramVk::buildInternal(const cl::DevicePtrs &devices,
                 }
             }
         }
+
+        if (buildType != BuildType::BINARY && useClspvCache && !loadedFromCache)
+        {
+            StoreClspvOutput(getPlatform(), clspvCacheKey, deviceProgramData);
+        }
         deviceProgramData.buildStatus = CL_BUILD_SUCCESS;
     }
     return true;
@@ -860,6 +860,8 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
       mUseSizePointerForBindingVertexBuffers(false),
       mTotalBufferToImageCopySize(0),
       mEstimatedPendingImageGarbageSize(0),
+      mPendingImageUploadStagingSize(0),
+      mInFlightImageUploadStagingSize(0),
       mRenderPassCountSinceSubmit(0),
       mHasWaitSemaphoresPendingSubmission(false),
       mGpuClockSync{std::numeric_limits<double>::max(), std::numeric_limits<double>::max()},
@@ -3746,6 +3748,14 @@ angle::Result ContextVk::submitCommands(const vk::Semaphore *signalSemaphore,
     mLastSubmittedQueueSerial = mLastFlushedQueueSerial;
     mSubmittedResourceUse.setQueueSerial(mLastSubmittedQueueSerial);
 
+    if (mPendingImageUploadStagingSize > 0)
+    {
+        mInFlightImageUploadStaging.emplace_back(mLastSubmittedQueueSerial,
+                                                 mPendingImageUploadStagingSize);
+        mInFlightImageUploadStagingSize += mPendingImageUploadStagingSize;
+        mPendingImageUploadStagingSize = 0;
+    }
+
     // Now that we have submitted commands, some of pending garbage may no longer pending
     // and should be moved to garbage list.
     mRenderer->cleanupPendingSubmissionGarbage();
@@ -3789,6 +3799,33 @@ angle::Result ContextVk::onCopyUpdate(VkDeviceSize size, bool *commandBufferWasF
     return angle::Result::Continue;
 }
 
+void ContextVk::onImageUploadStaging(VkDeviceSize size)
+{
+    while (!mInFlightImageUploadStaging.empty() &&
+           mRenderer->hasQueueSerialFinished(mInFlightImageUploadStaging.front().first))
+    {
+        mInFlightImageUploadStagingSize -= mInFlightImageUploadStaging.front().second;
+        mInFlightImageUploadStaging.pop_front();
+    }
+
+    mPendingImageUploadStagingSize += size;
+    mPerfCounters.imageUploadPeakStagingBytes =
+        std::max<uint64_t>(mPerfCounters.imageUploadPeakStagingBytes,
+                           mPendingImageUploadStagingSize + mInFlightImageUploadStagingSize);
+}
+
+angle::Result ContextVk::waitForImageUploadStaging(VkDeviceSize maxSize)
+{
+    while (mInFlightImageUploadStagingSize > maxSize)
+    {
+        ASSERT(!mInFlightImageUploadStaging.empty());
+        ANGLE_TRY(mRenderer->finishQueueSerial(this, mInFlightImageUploadStaging.front().first));
+        mInFlightImageUploadStagingSize -= mInFlightImageUploadStaging.front().second;
+        mInFlightImageUploadStaging.pop_front();
+    }
+    return angle::Result::Continue;
+}
+
 void ContextVk::addToPendingImageGarbage(vk::ResourceUse use, VkDeviceSize size)
 {
     if (!mRenderer->hasResourceUseFinished(use))
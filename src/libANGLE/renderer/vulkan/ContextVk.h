@@ -11,6 +11,7 @@
 #define LIBANGLE_RENDERER_VULKAN_CONTEXTVK_H_
 
 #include <condition_variable>
+#include <deque>
 
 #include "common/PackedEnums.h"
 #include "common/vulkan/vk_headers.h"
@@ -744,6 +745,13 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // buffer.
     angle::Result onCopyUpdate(VkDeviceSize size, bool *commandBufferWasFlushedOut);
 
+    // Keeping track of the staging memory of texture uploads that may still be in use, and of its
+    // peak.  Staging memory is considered in use until the submission that follows its allocation
+    // has finished.
+    void onImageUploadStaging(VkDeviceSize size);
+    // Waits until at most |maxSize| bytes of submitted texture upload staging memory are in use.
+    angle::Result waitForImageUploadStaging(VkDeviceSize maxSize);
+
     // Implementation of MultisampleTextureInitializer
     angle::Result initializeMultisampleTextureToBlack(const gl::Context *context,
                                                       gl::Texture *glTexture) override;
@@ -1669,6 +1677,12 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     VkDeviceSize mTotalBufferToImageCopySize;
     VkDeviceSize mEstimatedPendingImageGarbageSize;
 
+    // Staging memory of texture uploads allocated since the last submission, and that of previous
+    // submissions that may not have finished yet.
+    VkDeviceSize mPendingImageUploadStagingSize;
+    VkDeviceSize mInFlightImageUploadStagingSize;
+    std::deque<std::pair<QueueSerial, VkDeviceSize>> mInFlightImageUploadStaging;
+
     // The number of render passes since the last submission of all commands.
     VkDeviceSize mRenderPassCountSinceSubmit;
 
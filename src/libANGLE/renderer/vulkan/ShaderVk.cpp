@@ -141,6 +141,15 @@ std::shared_ptr<ShaderTranslateTask> ShaderVk::compile(const gl::Context *contex
 
     options->removeInactiveVariables = true;
 
+    // Uber-shaders commonly branch on values that are constant in practice; don't emit the dead
+    // branches in the SPIR-V.
+    options->propagateConstants = true;
+
+    if (contextVk->getFeatures().optimizeTranslatedSpirv.enabled)
+    {
+        options->optimizeSPIRV = true;
+    }
+
     if (contextVk->getFeatures().convertLowpAndMediumpFloatUniformsTo16Bits.enabled)
     {
         options->transformFloatUniformTo16Bits = true;
@@ -14,8 +14,9 @@
 #include "libANGLE/renderer/vulkan/TextureVk.h"
 #include <vulkan/vulkan.h>
 
+#include "common/FixedVector.h"
 #include "common/debug.h"
-#include "image_util/generatemip.inc"
+#include "image_util/generatemip.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Image.h"
@@ -2857,6 +2858,11 @@ angle::Result TextureVk::generateMipmap(const gl::Context *context)
             gl::IsMipmapFiltered(mState.getSamplerState().getMinFilter()));
     }
 
+    if (renderer->getFeatures().forceGenerateMipmapOnCPU.enabled)
+    {
+        return generateMipmapsWithCPU(context);
+    }
+
     // If it's possible to generate mipmap in compute, that would give the best possible
     // performance on some hardware.
     if (CanGenerateMipmapWithCompute(renderer, mImage->getType(), mImage->getActualFormatID(),
@@ -4432,20 +4438,21 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
                                                      const size_t sourceDepthPitch,
                                                      uint8_t *sourceData)
 {
-    size_t previousLevelWidth      = sourceWidth;
-    size_t previousLevelHeight     = sourceHeight;
-    size_t previousLevelDepth      = sourceDepth;
-    uint8_t *previousLevelData     = sourceData;
-    size_t previousLevelRowPitch   = sourceRowPitch;
-    size_t previousLevelDepthPitch = sourceDepthPitch;
+    // Allocate all the levels first, so they can be generated together.
+    angle::FixedVector<angle::MipLevelDestination, gl::IMPLEMENTATION_MAX_TEXTURE_LEVELS>
+        destLevels;
+
+    size_t mipWidth  = sourceWidth;
+    size_t mipHeight = sourceHeight;
+    size_t mipDepth  = sourceDepth;
 
     for (gl::LevelIndex currentMipLevel = firstMipLevel; currentMipLevel <= maxMipLevel;
          ++currentMipLevel)
     {
         // Compute next level width and height.
-        size_t mipWidth  = std::max<size_t>(1, previousLevelWidth >> 1);
-        size_t mipHeight = std::max<size_t>(1, previousLevelHeight >> 1);
-        size_t mipDepth  = std::max<size_t>(1, previousLevelDepth >> 1);
+        mipWidth  = std::max<size_t>(1, mipWidth >> 1);
+        mipHeight = std::max<size_t>(1, mipHeight >> 1);
+        mipDepth  = std::max<size_t>(1, mipDepth >> 1);
 
         // With the width and height of the next mip, we can allocate the next buffer we need.
         uint8_t *destData     = nullptr;
@@ -4461,20 +4468,16 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
             gl::ImageIndex::MakeFromType(mState.getType(), currentMipLevel.get(), layer),
             mipLevelExtents, gl::Offset(), &destData, sourceFormat.id));
 
-        // Generate the mipmap into that new buffer
-        sourceFormat.mipGenerationFunction(
-            previousLevelWidth, previousLevelHeight, previousLevelDepth, previousLevelData,
-            previousLevelRowPitch, previousLevelDepthPitch, destData, destRowPitch, destDepthPitch);
-
-        // Swap for the next iteration
-        previousLevelWidth      = mipWidth;
-        previousLevelHeight     = mipHeight;
-        previousLevelDepth      = mipDepth;
-        previousLevelData       = destData;
-        previousLevelRowPitch   = destRowPitch;
-        previousLevelDepthPitch = destDepthPitch;
+        destLevels.push_back({destData, destRowPitch, destDepthPitch});
     }
 
+    // Generate the mipmaps into the new buffers.  The levels of large images are generated while
+    // the previous level is still in cache, and in parallel if allowed.
+    angle::GenerateMipChain(contextVk->getImageLoadContext(), sourceFormat.mipGenerationFunction,
+                            sourceFormat.pixelBytes, sourceWidth, sourceHeight, sourceDepth,
+                            sourceData, sourceRowPitch, sourceDepthPitch, destLevels.data(),
+                            destLevels.size());
+
     return angle::Result::Continue;
 }
 
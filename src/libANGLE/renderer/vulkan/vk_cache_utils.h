@@ -2474,6 +2474,7 @@ enum class VulkanCacheType
     ShaderResourcesDescriptors,
     Framebuffer,
     DescriptorMetaCache,
+    ClspvProgram,
     EnumCount
 };
 
@@ -18,6 +18,7 @@
 #include "image_util/loadimage.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/MemoryTranscodeCache.h"
 #include "libANGLE/renderer/driver_utils.h"
 #include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
@@ -51,6 +52,10 @@ constexpr VkClearDepthStencilValue kRobustInitDepthStencilValue = {1.0f, 0};
 constexpr VkImageAspectFlags kDepthStencilAspects =
     VK_IMAGE_ASPECT_STENCIL_BIT | VK_IMAGE_ASPECT_DEPTH_BIT;
 
+// Texture uploads larger than this are converted and flushed in bands of at most this size when
+// possible, which bounds the staging memory they need.
+constexpr size_t kMaxStagingBandSize = 8 * 1024 * 1024;
+
 // A flag that is used to allow to fetch raw GPU pointer to a buffer and can be used when
 // supportsBufferDeviceAddress is enabled
 constexpr VkMemoryAllocateFlagsInfo kMemoryAllocateDeviceAddressFlags = {
@@ -8188,6 +8193,9 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
     LoadImageFunctionInfo loadFunctionInfo = vkFormat.getTextureLoadFunction(formatSupport, type);
     LoadImageFunction stencilLoadFunction  = nullptr;
 
+    // The number of rows of pixels per row of the staged data.
+    GLuint outputBlockHeight = 1;
+
     bool useComputeTransCoding = false;
     if (storageFormat.isBlock)
     {
@@ -8204,9 +8212,10 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
         ANGLE_VK_CHECK_MATH(contextVk,
                             storageFormatInfo.computeCompressedImageSize(glExtents, &totalSize));
 
-        outputRowPitch   = rowPitch;
-        outputDepthPitch = depthPitch;
-        allocationSize   = totalSize;
+        outputRowPitch    = rowPitch;
+        outputDepthPitch  = depthPitch;
+        allocationSize    = totalSize;
+        outputBlockHeight = storageFormatInfo.compressedBlockHeight;
 
         ANGLE_VK_CHECK_MATH(
             contextVk, storageFormatInfo.computeBufferRowLength(glExtents.width, &bufferRowLength));
@@ -8315,6 +8324,39 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
         }
     }
 
+    // ETC data transcoded to BC on the CPU is cached, as applications tend to upload the same
+    // assets every time they run.  The cache is consulted whether or not the update is banded.
+    gl::MemoryTranscodeCache *transcodeCache = contextVk->getMemoryTranscodeCache();
+    const bool cacheTranscode = !useComputeTransCoding && transcodeCache != nullptr &&
+                                IsETCFormat(vkFormat.getIntendedFormatID()) &&
+                                IsBCFormat(storageFormat.id) && transcodeCache->isEnabled();
+
+    egl::BlobCache::Key transcodeHash;
+    if (cacheTranscode)
+    {
+        gl::MemoryTranscodeCache::ComputeHash(
+            vkFormat.getIntendedFormatID(), storageFormat.id, glExtents, inputRowPitch,
+            inputDepthPitch, source, static_cast<size_t>(inputDepthPitch) * glExtents.depth,
+            &transcodeHash);
+    }
+
+    // Large updates that may be applied right away are staged in bands, each flushed to the image
+    // before the next one is converted.
+    if (applyUpdate != ApplyImageUpdate::Defer && valid() && allocationSize > kMaxStagingBandSize &&
+        !useComputeTransCoding && !storageFormat.isYUV && stencilAllocationSize == 0 &&
+        GetFormatAspectFlags(storageFormat) == VK_IMAGE_ASPECT_COLOR_BIT)
+    {
+        const GLuint inputBlockHeight =
+            formatInfo.compressed ? formatInfo.compressedBlockHeight : 1;
+        ANGLE_TRY(stageSubresourceUpdateInBands(
+            contextVk, index, glExtents, offset, source, loadFunctionInfo.loadFunction,
+            storageFormat.id, inputRowPitch, inputDepthPitch, inputBlockHeight, outputRowPitch,
+            outputDepthPitch, outputBlockHeight, bufferRowLength, bufferImageHeight,
+            cacheTranscode ? transcodeCache : nullptr, transcodeHash, allocationSize));
+        *updateAppliedImmediatelyOut = true;
+        return angle::Result::Continue;
+    }
+
     std::unique_ptr<RefCounted<BufferHelper>> stagingBuffer =
         std::make_unique<RefCounted<BufferHelper>>();
     BufferHelper *currentBuffer = &stagingBuffer->get();
@@ -8324,10 +8366,24 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
     ANGLE_TRY(contextVk->initBufferForImageCopy(currentBuffer, allocationSize,
                                                 MemoryCoherency::CachedNonCoherent,
                                                 storageFormat.id, &stagingOffset, &stagingPointer));
+    contextVk->onImageUploadStaging(allocationSize);
+
+    const bool loadedFromCache =
+        cacheTranscode &&
+        transcodeCache->getTranscodedData(transcodeHash, stagingPointer, allocationSize);
+
+    if (!loadedFromCache)
+    {
+        loadFunctionInfo.loadFunction(contextVk->getImageLoadContext(), glExtents.width,
+                                      glExtents.height, glExtents.depth, source, inputRowPitch,
+                                      inputDepthPitch, stagingPointer, outputRowPitch,
+                                      outputDepthPitch);
 
-    loadFunctionInfo.loadFunction(
-        contextVk->getImageLoadContext(), glExtents.width, glExtents.height, glExtents.depth,
-        source, inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch, outputDepthPitch);
+        if (cacheTranscode)
+        {
+            transcodeCache->putTranscodedData(transcodeHash, stagingPointer, allocationSize);
+        }
+    }
 
     // YUV formats need special handling.
     if (storageFormat.isYUV)
@@ -8451,6 +8507,172 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result ImageHelper::stageSubresourceUpdateInBands(ContextVk *contextVk,
+                                                         const gl::ImageIndex &index,
+                                                         const gl::Extents &glExtents,
+                                                         const gl::Offset &offset,
+                                                         const uint8_t *source,
+                                                         LoadImageFunction loadFunction,
+                                                         angle::FormatID storageFormatID,
+                                                         GLuint inputRowPitch,
+                                                         GLuint inputDepthPitch,
+                                                         GLuint inputBlockHeight,
+                                                         size_t outputRowPitch,
+                                                         size_t outputDepthPitch,
+                                                         GLuint outputBlockHeight,
+                                                         uint32_t bufferRowLength,
+                                                         uint32_t bufferImageHeight,
+                                                         gl::MemoryTranscodeCache *transcodeCache,
+                                                         const angle::BlobCacheKey &transcodeHash,
+                                                         size_t allocationSize)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::stageSubresourceUpdateInBands");
+
+    // The transcode cache holds the whole transcoded data, so it is gathered on the host to be
+    // looked up or stored.  The cache budget bounds this memory; transcodes that wouldn't fit in
+    // the cache are not cached.  The staging memory remains banded either way.
+    angle::MemoryBuffer transcodedData;
+    bool loadedFromCache = false;
+    if (transcodeCache != nullptr)
+    {
+        if (allocationSize <= transcodeCache->maxSize() && transcodedData.resize(allocationSize))
+        {
+            loadedFromCache = transcodeCache->getTranscodedData(
+                transcodeHash, transcodedData.data(), allocationSize);
+        }
+        else
+        {
+            transcodeCache = nullptr;
+        }
+    }
+
+    // Bands start on a row of blocks of both the source and the staged data.
+    const GLuint bandRowAlignment = std::max(inputBlockHeight, outputBlockHeight);
+    ASSERT(bandRowAlignment % inputBlockHeight == 0 && bandRowAlignment % outputBlockHeight == 0);
+
+    // Whole slices are staged together if they fit in a band, otherwise each slice is staged in
+    // bands of rows.
+    GLint bandHeight = glExtents.height;
+    GLint bandDepth  = 1;
+    if (outputDepthPitch <= kMaxStagingBandSize)
+    {
+        bandDepth = static_cast<GLint>(kMaxStagingBandSize / outputDepthPitch);
+    }
+    else
+    {
+        const size_t bandRows = kMaxStagingBandSize / outputRowPitch * outputBlockHeight;
+        bandHeight = static_cast<GLint>(
+            std::max<size_t>(bandRows / bandRowAlignment * bandRowAlignment, bandRowAlignment));
+    }
+
+    const gl::LevelIndex updateLevelGL(index.getLevelIndex());
+    const bool isArray = gl::IsArrayTextureType(index.getType());
+
+    bool isFirstBand = true;
+    for (GLint z = 0; z < glExtents.depth; z += bandDepth)
+    {
+        for (GLint y = 0; y < glExtents.height; y += bandHeight)
+        {
+            // Submit the copies of the previous bands, and wait until at most one band worth of
+            // staging memory is in use before allocating the next one.  This bounds the staging
+            // memory of the upload to two bands.
+            if (!isFirstBand)
+            {
+                ANGLE_TRY(contextVk->flushAndSubmitOutsideRenderPassCommands());
+                ANGLE_TRY(contextVk->waitForImageUploadStaging(kMaxStagingBandSize));
+            }
+            isFirstBand = false;
+
+            const gl::Extents bandExtents(glExtents.width,
+                                          std::min(bandHeight, glExtents.height - y),
+                                          std::min(bandDepth, glExtents.depth - z));
+            const bool wholeSlices = bandExtents.height == glExtents.height;
+            const GLuint bandOutputRows =
+                UnsignedCeilDivide(static_cast<GLuint>(bandExtents.height), outputBlockHeight);
+            const size_t bandOutputDepthPitch =
+                wholeSlices ? outputDepthPitch : outputRowPitch * bandOutputRows;
+            const size_t bandSize = bandOutputDepthPitch * bandExtents.depth;
+
+            const uint8_t *bandSource =
+                source + z * static_cast<size_t>(inputDepthPitch) +
+                (y / inputBlockHeight) * static_cast<size_t>(inputRowPitch);
+
+            std::unique_ptr<RefCounted<BufferHelper>> stagingBuffer =
+                std::make_unique<RefCounted<BufferHelper>>();
+            BufferHelper *currentBuffer = &stagingBuffer->get();
+
+            uint8_t *stagingPointer;
+            VkDeviceSize stagingOffset;
+            ANGLE_TRY(contextVk->initBufferForImageCopy(
+                currentBuffer, bandSize, MemoryCoherency::CachedNonCoherent, storageFormatID,
+                &stagingOffset, &stagingPointer));
+            contextVk->onImageUploadStaging(bandSize);
+
+            // The staged data of a band is contiguous in the staged data of the whole update.
+            const size_t bandOffset =
+                z * outputDepthPitch + (y / outputBlockHeight) * outputRowPitch;
+            ASSERT(transcodeCache == nullptr || bandOffset + bandSize <= allocationSize);
+
+            if (loadedFromCache)
+            {
+                memcpy(stagingPointer, transcodedData.data() + bandOffset, bandSize);
+            }
+            else
+            {
+                loadFunction(contextVk->getImageLoadContext(), bandExtents.width,
+                             bandExtents.height, bandExtents.depth, bandSource, inputRowPitch,
+                             inputDepthPitch, stagingPointer, outputRowPitch,
+                             bandOutputDepthPitch);
+                if (transcodeCache != nullptr)
+                {
+                    memcpy(transcodedData.data() + bandOffset, stagingPointer, bandSize);
+                }
+            }
+
+            VkBufferImageCopy copy           = {};
+            copy.bufferOffset                = stagingOffset;
+            copy.bufferRowLength             = bufferRowLength;
+            copy.bufferImageHeight =
+                wholeSlices ? bufferImageHeight : bandOutputRows * outputBlockHeight;
+            copy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            copy.imageSubresource.mipLevel   = updateLevelGL.get();
+
+            gl_vk::GetOffset(gl::Offset(offset.x, offset.y + y, offset.z + z), &copy.imageOffset);
+            gl_vk::GetExtent(bandExtents, &copy.imageExtent);
+
+            if (isArray)
+            {
+                copy.imageSubresource.baseArrayLayer = offset.z + z;
+                copy.imageSubresource.layerCount     = bandExtents.depth;
+                copy.imageOffset.z                   = 0;
+                copy.imageExtent.depth               = 1;
+            }
+            else
+            {
+                copy.imageSubresource.baseArrayLayer = index.hasLayer() ? index.getLayerIndex() : 0;
+                copy.imageSubresource.layerCount     = index.getLayerCount();
+            }
+
+            appendSubresourceUpdate(updateLevelGL, SubresourceUpdate(stagingBuffer.get(),
+                                                                     currentBuffer, copy,
+                                                                     storageFormatID));
+            stagingBuffer.release();
+
+            // Record the copy now, so the staging buffer can be reused once it's done.  The
+            // copies are submitted once large enough, see ContextVk::onCopyUpdate.
+            ANGLE_TRY(flushStagedUpdates(contextVk, updateLevelGL, updateLevelGL + 1, 0,
+                                         mLayerCount, {}));
+        }
+    }
+
+    if (transcodeCache != nullptr && !loadedFromCache)
+    {
+        transcodeCache->putTranscodedData(transcodeHash, transcodedData.data(), allocationSize);
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result ImageHelper::updateSubresourceOnHost(ContextVk *contextVk,
                                                    ApplyImageUpdate applyUpdate,
                                                    const gl::ImageIndex &index,
@@ -11278,6 +11500,10 @@ angle::Result ImageHelper::packReadPixelBuffer(ContextVk *contextVk,
     const gl::InternalFormat &storageFormatInfo =
         vkFormat.getInternalFormatInfo(readFormat.componentType);
 
+    // Large readbacks are converted on the same threads as texture uploads.
+    PackPixelsParams params = packPixelsParams;
+    params.workerThreadPool = contextVk->getImageLoadContext().multiThreadPool.get();
+
     if (readFormat.isBlock)
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::packReadPixelBuffer - Block");
@@ -11305,15 +11531,15 @@ angle::Result ImageHelper::packReadPixelBuffer(ContextVk *contextVk,
         ANGLE_TRY(packBufferVk->mapImpl(contextVk, GL_MAP_WRITE_BIT, &mapPtr, &feedback));
         ASSERT(!feedback.hasFeedback());
         uint8_t *dst = static_cast<uint8_t *>(mapPtr) + reinterpret_cast<ptrdiff_t>(pixels);
-        PackPixels(packPixelsParams, aspectFormat, area.width * aspectFormat.pixelBytes,
-                   readPixelBuffer, dst);
+        PackPixels(params, aspectFormat, area.width * aspectFormat.pixelBytes, readPixelBuffer,
+                   dst);
         ANGLE_TRY(packBufferVk->unmapImpl(contextVk, &feedback));
         ASSERT(!feedback.hasFeedback());
     }
     else
     {
-        PackPixels(packPixelsParams, aspectFormat, area.width * aspectFormat.pixelBytes,
-                   readPixelBuffer, static_cast<uint8_t *>(pixels));
+        PackPixels(params, aspectFormat, area.width * aspectFormat.pixelBytes, readPixelBuffer,
+                   static_cast<uint8_t *>(pixels));
     }
 
     return angle::Result::Continue;
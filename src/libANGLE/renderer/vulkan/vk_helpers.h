@@ -27,6 +27,7 @@
 namespace gl
 {
 class ImageIndex;
+class MemoryTranscodeCache;
 }  // namespace gl
 
 namespace rx
@@ -3095,6 +3096,29 @@ class ImageHelper final : public Resource, public angle::Subject
                                         uint32_t baseArrayLayer,
                                         uint32_t layerCount);
 
+    // Converts and stages an update in bands of rows or slices, flushing each band to the image
+    // before converting the next, so the staging memory doesn't depend on the size of the update.
+    // If |transcodeCache| is given, the transcoded data is looked up in or stored to it with
+    // |transcodeHash|.
+    angle::Result stageSubresourceUpdateInBands(ContextVk *contextVk,
+                                                const gl::ImageIndex &index,
+                                                const gl::Extents &glExtents,
+                                                const gl::Offset &offset,
+                                                const uint8_t *source,
+                                                LoadImageFunction loadFunction,
+                                                angle::FormatID storageFormatID,
+                                                GLuint inputRowPitch,
+                                                GLuint inputDepthPitch,
+                                                GLuint inputBlockHeight,
+                                                size_t outputRowPitch,
+                                                size_t outputDepthPitch,
+                                                GLuint outputBlockHeight,
+                                                uint32_t bufferRowLength,
+                                                uint32_t bufferImageHeight,
+                                                gl::MemoryTranscodeCache *transcodeCache,
+                                                const angle::BlobCacheKey &transcodeHash,
+                                                size_t allocationSize);
+
     angle::Result updateSubresourceOnHost(ContextVk *contextVk,
                                           ApplyImageUpdate applyUpdate,
                                           const gl::ImageIndex &index,
@@ -5657,6 +5657,8 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                                 maxComputeWorkGroupInvocations >= 256 &&
                                 ((isAMD && !IsWindows()) || isNvidia || isSamsung));
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, forceGenerateMipmapOnCPU, false);
+
     bool isAdreno540 = mPhysicalDeviceProperties.deviceID == angle::kDeviceID_Adreno540;
     ANGLE_FEATURE_CONDITION(&mFeatures, forceMaxUniformBufferSize16KB,
                             isQualcommProprietary && isAdreno540);
@@ -6589,6 +6591,13 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                                 mShaderFloat16Int8Features.shaderFloat16 == VK_TRUE &&
                                 isARMProprietary);
 
+    // The optimizer adds about 10% to the translation time of a shader and removes a few percent
+    // of its SPIR-V, but more importantly the loads and stores the driver compiler would otherwise
+    // have to eliminate itself.  Enable it where pipeline creation is dominated by the driver
+    // compiler.  Each pass is capped by the size of the module, so its cost stays bounded.
+    ANGLE_FEATURE_CONDITION(&mFeatures, optimizeTranslatedSpirv,
+                            isARMProprietary || isQualcommProprietary);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsUnifiedImageLayouts,
                             mUnifiedImageLayoutsFeatures.unifiedImageLayouts == VK_TRUE);
 
@@ -6785,6 +6794,11 @@ void Renderer::initializeFrontendFeatures(angle::FrontendFeatures *features) con
     // Always run the link's warm up job in a thread.  It's an optimization only, and does not block
     // the link resolution.
     ANGLE_FEATURE_CONDITION(features, alwaysRunLinkSubJobsThreaded, true);
+
+    // ETC textures are transcoded to BC on the CPU when the device lacks ETC.  Transcoding costs
+    // far more than hashing the source data, so cache the results there.
+    ANGLE_FEATURE_CONDITION(features, cacheTranscodedTextures,
+                            mFeatures.supportsComputeTranscodeEtcToBc.enabled);
 }
 
 angle::Result Renderer::getLockedPipelineCacheDataIfNew(vk::ErrorContext *context,
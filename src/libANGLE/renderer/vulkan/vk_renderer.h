@@ -500,6 +500,11 @@ class Renderer : angle::NonCopyable
         std::unique_lock<angle::SimpleMutex> localLock(mCacheStatsMutex);
         mVulkanCacheStats[cache].accumulate(stats);
     }
+    CacheStats getCacheStats(VulkanCacheType cache) const
+    {
+        std::unique_lock<angle::SimpleMutex> localLock(mCacheStatsMutex);
+        return mVulkanCacheStats[cache];
+    }
     // Log cache stats for all caches
     void logCacheStats() const;
 
@@ -30,6 +30,7 @@ void GL_APIENTRY GL_AlphaFunc(GLenum func, GLfloat ref)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLAlphaFunc, "context = %d, func = %s, ref = %f", CID(context),
           GLenumToString(GLESEnum::AlphaFunction, func), ref);
+    ANGLE_PROFILE_ENTRY_POINT(GLAlphaFunc);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -37,6 +38,7 @@ void GL_APIENTRY GL_AlphaFunc(GLenum func, GLfloat ref)
         bool isCallValid         = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -74,6 +76,7 @@ void GL_APIENTRY GL_AlphaFuncx(GLenum func, GLfixed ref)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLAlphaFuncx, "context = %d, func = %s, ref = 0x%X", CID(context),
           GLenumToString(GLESEnum::AlphaFunction, func), ref);
+    ANGLE_PROFILE_ENTRY_POINT(GLAlphaFuncx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -81,6 +84,7 @@ void GL_APIENTRY GL_AlphaFuncx(GLenum func, GLfixed ref)
         bool isCallValid         = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -119,12 +123,14 @@ void GL_APIENTRY GL_ClearColorx(GLfixed red, GLfixed green, GLfixed blue, GLfixe
     EVENT(context, GLClearColorx,
           "context = %d, red = 0x%X, green = 0x%X, blue = 0x%X, alpha = 0x%X", CID(context), red,
           green, blue, alpha);
+    ANGLE_PROFILE_ENTRY_POINT(GLClearColorx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -162,12 +168,14 @@ void GL_APIENTRY GL_ClearDepthx(GLfixed depth)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearDepthx, "context = %d, depth = 0x%X", CID(context), depth);
+    ANGLE_PROFILE_ENTRY_POINT(GLClearDepthx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -205,6 +213,7 @@ void GL_APIENTRY GL_ClientActiveTexture(GLenum texture)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClientActiveTexture, "context = %d, texture = %s", CID(context),
           GLenumToString(GLESEnum::TextureUnit, texture));
+    ANGLE_PROFILE_ENTRY_POINT(GLClientActiveTexture);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -212,6 +221,7 @@ void GL_APIENTRY GL_ClientActiveTexture(GLenum texture)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -247,12 +257,14 @@ void GL_APIENTRY GL_ClipPlanef(GLenum p, const GLfloat *eqn)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClipPlanef, "context = %d, p = %s, eqn = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::ClipPlaneName, p), (uintptr_t)eqn);
+    ANGLE_PROFILE_ENTRY_POINT(GLClipPlanef);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -290,12 +302,14 @@ void GL_APIENTRY GL_ClipPlanex(GLenum plane, const GLfixed *equation)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClipPlanex, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ClipPlaneName, plane), (uintptr_t)equation);
+    ANGLE_PROFILE_ENTRY_POINT(GLClipPlanex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -333,12 +347,14 @@ void GL_APIENTRY GL_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4f, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
+    ANGLE_PROFILE_ENTRY_POINT(GLColor4f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -376,12 +392,14 @@ void GL_APIENTRY GL_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte a
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4ub, "context = %d, red = %d, green = %d, blue = %d, alpha = %d",
           CID(context), red, green, blue, alpha);
+    ANGLE_PROFILE_ENTRY_POINT(GLColor4ub);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -419,12 +437,14 @@ void GL_APIENTRY GL_Color4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed al
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4x, "context = %d, red = 0x%X, green = 0x%X, blue = 0x%X, alpha = 0x%X",
           CID(context), red, green, blue, alpha);
+    ANGLE_PROFILE_ENTRY_POINT(GLColor4x);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -464,6 +484,7 @@ void GL_APIENTRY GL_ColorPointer(GLint size, GLenum type, GLsizei stride, const
           "context = %d, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "",
           CID(context), size, GLenumToString(GLESEnum::ColorPointerType, type), stride,
           (uintptr_t)pointer);
+    ANGLE_PROFILE_ENTRY_POINT(GLColorPointer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -472,6 +493,7 @@ void GL_APIENTRY GL_ColorPointer(GLint size, GLenum type, GLsizei stride, const
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -506,12 +528,14 @@ void GL_APIENTRY GL_DepthRangex(GLfixed n, GLfixed f)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDepthRangex, "context = %d, n = 0x%X, f = 0x%X", CID(context), n, f);
+    ANGLE_PROFILE_ENTRY_POINT(GLDepthRangex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -549,6 +573,7 @@ void GL_APIENTRY GL_DisableClientState(GLenum array)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisableClientState, "context = %d, array = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, array));
+    ANGLE_PROFILE_ENTRY_POINT(GLDisableClientState);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -557,6 +582,7 @@ void GL_APIENTRY GL_DisableClientState(GLenum array)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -592,6 +618,7 @@ void GL_APIENTRY GL_EnableClientState(GLenum array)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnableClientState, "context = %d, array = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, array));
+    ANGLE_PROFILE_ENTRY_POINT(GLEnableClientState);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -600,6 +627,7 @@ void GL_APIENTRY GL_EnableClientState(GLenum array)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -635,12 +663,14 @@ void GL_APIENTRY GL_Fogf(GLenum pname, GLfloat param)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFogf, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::FogParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLFogf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -678,12 +708,14 @@ void GL_APIENTRY GL_Fogfv(GLenum pname, const GLfloat *params)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFogfv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::FogParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLFogfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -721,12 +753,14 @@ void GL_APIENTRY GL_Fogx(GLenum pname, GLfixed param)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFogx, "context = %d, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::FogPName, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLFogx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -764,12 +798,14 @@ void GL_APIENTRY GL_Fogxv(GLenum pname, const GLfixed *param)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFogxv, "context = %d, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::FogPName, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLFogxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -807,12 +843,14 @@ void GL_APIENTRY GL_Frustumf(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFrustumf, "context = %d, l = %f, r = %f, b = %f, t = %f, n = %f, f = %f",
           CID(context), l, r, b, t, n, f);
+    ANGLE_PROFILE_ENTRY_POINT(GLFrustumf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -851,12 +889,14 @@ void GL_APIENTRY GL_Frustumx(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed
     EVENT(context, GLFrustumx,
           "context = %d, l = 0x%X, r = 0x%X, b = 0x%X, t = 0x%X, n = 0x%X, f = 0x%X", CID(context),
           l, r, b, t, n, f);
+    ANGLE_PROFILE_ENTRY_POINT(GLFrustumx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -894,12 +934,14 @@ void GL_APIENTRY GL_GetClipPlanef(GLenum plane, GLfloat *equation)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetClipPlanef, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ClipPlaneName, plane), (uintptr_t)equation);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetClipPlanef);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -937,12 +979,14 @@ void GL_APIENTRY GL_GetClipPlanex(GLenum plane, GLfixed *equation)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetClipPlanex, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ClipPlaneName, plane), (uintptr_t)equation);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetClipPlanex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -980,6 +1024,7 @@ void GL_APIENTRY GL_GetFixedv(GLenum pname, GLfixed *params)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFixedv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFixedv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -987,6 +1032,7 @@ void GL_APIENTRY GL_GetFixedv(GLenum pname, GLfixed *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1023,6 +1069,7 @@ void GL_APIENTRY GL_GetLightfv(GLenum light, GLenum pname, GLfloat *params)
     EVENT(context, GLGetLightfv, "context = %d, light = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetLightfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1030,6 +1077,7 @@ void GL_APIENTRY GL_GetLightfv(GLenum light, GLenum pname, GLfloat *params)
         bool isCallValid           = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1069,6 +1117,7 @@ void GL_APIENTRY GL_GetLightxv(GLenum light, GLenum pname, GLfixed *params)
     EVENT(context, GLGetLightxv, "context = %d, light = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetLightxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1076,6 +1125,7 @@ void GL_APIENTRY GL_GetLightxv(GLenum light, GLenum pname, GLfixed *params)
         bool isCallValid           = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1116,6 +1166,7 @@ void GL_APIENTRY GL_GetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
           "context = %d, face = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetMaterialfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1123,6 +1174,7 @@ void GL_APIENTRY GL_GetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
         bool isCallValid              = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1163,6 +1215,7 @@ void GL_APIENTRY GL_GetMaterialxv(GLenum face, GLenum pname, GLfixed *params)
           "context = %d, face = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetMaterialxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1170,6 +1223,7 @@ void GL_APIENTRY GL_GetMaterialxv(GLenum face, GLenum pname, GLfixed *params)
         bool isCallValid              = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1210,6 +1264,7 @@ void GL_APIENTRY GL_GetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexEnvfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1218,6 +1273,7 @@ void GL_APIENTRY GL_GetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
         bool isCallValid                = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1258,6 +1314,7 @@ void GL_APIENTRY GL_GetTexEnviv(GLenum target, GLenum pname, GLint *params)
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexEnviv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1266,6 +1323,7 @@ void GL_APIENTRY GL_GetTexEnviv(GLenum target, GLenum pname, GLint *params)
         bool isCallValid                = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1306,6 +1364,7 @@ void GL_APIENTRY GL_GetTexEnvxv(GLenum target, GLenum pname, GLfixed *params)
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexEnvxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1314,6 +1373,7 @@ void GL_APIENTRY GL_GetTexEnvxv(GLenum target, GLenum pname, GLfixed *params)
         bool isCallValid                = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1354,6 +1414,7 @@ void GL_APIENTRY GL_GetTexParameterxv(GLenum target, GLenum pname, GLfixed *para
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1362,6 +1423,7 @@ void GL_APIENTRY GL_GetTexParameterxv(GLenum target, GLenum pname, GLfixed *para
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1397,12 +1459,14 @@ void GL_APIENTRY GL_LightModelf(GLenum pname, GLfloat param)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightModelf, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::LightModelParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLLightModelf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1440,12 +1504,14 @@ void GL_APIENTRY GL_LightModelfv(GLenum pname, const GLfloat *params)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightModelfv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightModelParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLLightModelfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1483,12 +1549,14 @@ void GL_APIENTRY GL_LightModelx(GLenum pname, GLfixed param)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightModelx, "context = %d, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::LightModelParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLLightModelx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1526,12 +1594,14 @@ void GL_APIENTRY GL_LightModelxv(GLenum pname, const GLfixed *param)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightModelxv, "context = %d, pname = %s, param = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightModelParameter, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLLightModelxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1570,6 +1640,7 @@ void GL_APIENTRY GL_Lightf(GLenum light, GLenum pname, GLfloat param)
     EVENT(context, GLLightf, "context = %d, light = %s, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLLightf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1577,6 +1648,7 @@ void GL_APIENTRY GL_Lightf(GLenum light, GLenum pname, GLfloat param)
         bool isCallValid           = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1615,6 +1687,7 @@ void GL_APIENTRY GL_Lightfv(GLenum light, GLenum pname, const GLfloat *params)
     EVENT(context, GLLightfv, "context = %d, light = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLLightfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1622,6 +1695,7 @@ void GL_APIENTRY GL_Lightfv(GLenum light, GLenum pname, const GLfloat *params)
         bool isCallValid           = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1661,6 +1735,7 @@ void GL_APIENTRY GL_Lightx(GLenum light, GLenum pname, GLfixed param)
     EVENT(context, GLLightx, "context = %d, light = %s, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLLightx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1668,6 +1743,7 @@ void GL_APIENTRY GL_Lightx(GLenum light, GLenum pname, GLfixed param)
         bool isCallValid           = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1706,6 +1782,7 @@ void GL_APIENTRY GL_Lightxv(GLenum light, GLenum pname, const GLfixed *params)
     EVENT(context, GLLightxv, "context = %d, light = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightName, light),
           GLenumToString(GLESEnum::LightParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLLightxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1713,6 +1790,7 @@ void GL_APIENTRY GL_Lightxv(GLenum light, GLenum pname, const GLfixed *params)
         bool isCallValid           = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1750,12 +1828,14 @@ void GL_APIENTRY GL_LineWidthx(GLfixed width)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLineWidthx, "context = %d, width = 0x%X", CID(context), width);
+    ANGLE_PROFILE_ENTRY_POINT(GLLineWidthx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1792,12 +1872,14 @@ void GL_APIENTRY GL_LoadIdentity()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoadIdentity, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLLoadIdentity);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1835,12 +1917,14 @@ void GL_APIENTRY GL_LoadMatrixf(const GLfloat *m)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoadMatrixf, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
+    ANGLE_PROFILE_ENTRY_POINT(GLLoadMatrixf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1878,12 +1962,14 @@ void GL_APIENTRY GL_LoadMatrixx(const GLfixed *m)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoadMatrixx, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
+    ANGLE_PROFILE_ENTRY_POINT(GLLoadMatrixx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1921,6 +2007,7 @@ void GL_APIENTRY GL_LogicOp(GLenum opcode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLogicOp, "context = %d, opcode = %s", CID(context),
           GLenumToString(GLESEnum::LogicOp, opcode));
+    ANGLE_PROFILE_ENTRY_POINT(GLLogicOp);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1928,6 +2015,7 @@ void GL_APIENTRY GL_LogicOp(GLenum opcode)
         bool isCallValid              = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1966,6 +2054,7 @@ void GL_APIENTRY GL_Materialf(GLenum face, GLenum pname, GLfloat param)
     EVENT(context, GLMaterialf, "context = %d, face = %s, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLMaterialf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1973,6 +2062,7 @@ void GL_APIENTRY GL_Materialf(GLenum face, GLenum pname, GLfloat param)
         bool isCallValid              = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2012,6 +2102,7 @@ void GL_APIENTRY GL_Materialfv(GLenum face, GLenum pname, const GLfloat *params)
     EVENT(context, GLMaterialfv, "context = %d, face = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLMaterialfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2019,6 +2110,7 @@ void GL_APIENTRY GL_Materialfv(GLenum face, GLenum pname, const GLfloat *params)
         bool isCallValid              = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2058,6 +2150,7 @@ void GL_APIENTRY GL_Materialx(GLenum face, GLenum pname, GLfixed param)
     EVENT(context, GLMaterialx, "context = %d, face = %s, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLMaterialx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2065,6 +2158,7 @@ void GL_APIENTRY GL_Materialx(GLenum face, GLenum pname, GLfixed param)
         bool isCallValid              = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2104,6 +2198,7 @@ void GL_APIENTRY GL_Materialxv(GLenum face, GLenum pname, const GLfixed *param)
     EVENT(context, GLMaterialxv, "context = %d, face = %s, pname = %s, param = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::MaterialParameter, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLMaterialxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2111,6 +2206,7 @@ void GL_APIENTRY GL_Materialxv(GLenum face, GLenum pname, const GLfixed *param)
         bool isCallValid              = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2149,6 +2245,7 @@ void GL_APIENTRY GL_MatrixMode(GLenum mode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMatrixMode, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::MatrixMode, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLMatrixMode);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2156,6 +2253,7 @@ void GL_APIENTRY GL_MatrixMode(GLenum mode)
         bool isCallValid      = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2193,12 +2291,14 @@ void GL_APIENTRY GL_MultMatrixf(const GLfloat *m)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultMatrixf, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultMatrixf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2236,12 +2336,14 @@ void GL_APIENTRY GL_MultMatrixx(const GLfixed *m)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultMatrixx, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultMatrixx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2279,12 +2381,14 @@ void GL_APIENTRY GL_MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiTexCoord4f, "context = %d, target = %s, s = %f, t = %f, r = %f, q = %f",
           CID(context), GLenumToString(GLESEnum::TextureUnit, target), s, t, r, q);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiTexCoord4f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2324,12 +2428,14 @@ void GL_APIENTRY GL_MultiTexCoord4x(GLenum texture, GLfixed s, GLfixed t, GLfixe
     EVENT(context, GLMultiTexCoord4x,
           "context = %d, texture = %s, s = 0x%X, t = 0x%X, r = 0x%X, q = 0x%X", CID(context),
           GLenumToString(GLESEnum::TextureUnit, texture), s, t, r, q);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiTexCoord4x);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2367,12 +2473,14 @@ void GL_APIENTRY GL_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3f, "context = %d, nx = %f, ny = %f, nz = %f", CID(context), nx, ny, nz);
+    ANGLE_PROFILE_ENTRY_POINT(GLNormal3f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2410,12 +2518,14 @@ void GL_APIENTRY GL_Normal3x(GLfixed nx, GLfixed ny, GLfixed nz)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3x, "context = %d, nx = 0x%X, ny = 0x%X, nz = 0x%X", CID(context), nx,
           ny, nz);
+    ANGLE_PROFILE_ENTRY_POINT(GLNormal3x);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2454,6 +2564,7 @@ void GL_APIENTRY GL_NormalPointer(GLenum type, GLsizei stride, const void *point
     EVENT(context, GLNormalPointer,
           "context = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::NormalPointerType, type), stride, (uintptr_t)pointer);
+    ANGLE_PROFILE_ENTRY_POINT(GLNormalPointer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2462,6 +2573,7 @@ void GL_APIENTRY GL_NormalPointer(GLenum type, GLsizei stride, const void *point
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2497,12 +2609,14 @@ void GL_APIENTRY GL_Orthof(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n
     Context *context = GetValidGlobalContext();
     EVENT(context, GLOrthof, "context = %d, l = %f, r = %f, b = %f, t = %f, n = %f, f = %f",
           CID(context), l, r, b, t, n, f);
+    ANGLE_PROFILE_ENTRY_POINT(GLOrthof);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2541,12 +2655,14 @@ void GL_APIENTRY GL_Orthox(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n
     EVENT(context, GLOrthox,
           "context = %d, l = 0x%X, r = 0x%X, b = 0x%X, t = 0x%X, n = 0x%X, f = 0x%X", CID(context),
           l, r, b, t, n, f);
+    ANGLE_PROFILE_ENTRY_POINT(GLOrthox);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2584,6 +2700,7 @@ void GL_APIENTRY GL_PointParameterf(GLenum pname, GLfloat param)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointParameterf, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::AllEnums, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLPointParameterf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2591,6 +2708,7 @@ void GL_APIENTRY GL_PointParameterf(GLenum pname, GLfloat param)
         bool isCallValid           = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2629,6 +2747,7 @@ void GL_APIENTRY GL_PointParameterfv(GLenum pname, const GLfloat *params)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointParameterfv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLPointParameterfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2636,6 +2755,7 @@ void GL_APIENTRY GL_PointParameterfv(GLenum pname, const GLfloat *params)
         bool isCallValid           = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2674,6 +2794,7 @@ void GL_APIENTRY GL_PointParameterx(GLenum pname, GLfixed param)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointParameterx, "context = %d, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::AllEnums, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLPointParameterx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2681,6 +2802,7 @@ void GL_APIENTRY GL_PointParameterx(GLenum pname, GLfixed param)
         bool isCallValid           = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2719,6 +2841,7 @@ void GL_APIENTRY GL_PointParameterxv(GLenum pname, const GLfixed *params)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointParameterxv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLPointParameterxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2726,6 +2849,7 @@ void GL_APIENTRY GL_PointParameterxv(GLenum pname, const GLfixed *params)
         bool isCallValid           = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2763,12 +2887,14 @@ void GL_APIENTRY GL_PointSize(GLfloat size)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointSize, "context = %d, size = %f", CID(context), size);
+    ANGLE_PROFILE_ENTRY_POINT(GLPointSize);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2805,12 +2931,14 @@ void GL_APIENTRY GL_PointSizex(GLfixed size)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointSizex, "context = %d, size = 0x%X", CID(context), size);
+    ANGLE_PROFILE_ENTRY_POINT(GLPointSizex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2848,12 +2976,14 @@ void GL_APIENTRY GL_PolygonOffsetx(GLfixed factor, GLfixed units)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPolygonOffsetx, "context = %d, factor = 0x%X, units = 0x%X", CID(context),
           factor, units);
+    ANGLE_PROFILE_ENTRY_POINT(GLPolygonOffsetx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2890,12 +3020,14 @@ void GL_APIENTRY GL_PopMatrix()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPopMatrix, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLPopMatrix);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2932,12 +3064,14 @@ void GL_APIENTRY GL_PushMatrix()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPushMatrix, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLPushMatrix);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2975,12 +3109,14 @@ void GL_APIENTRY GL_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRotatef, "context = %d, angle = %f, x = %f, y = %f, z = %f", CID(context),
           angle, x, y, z);
+    ANGLE_PROFILE_ENTRY_POINT(GLRotatef);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3018,12 +3154,14 @@ void GL_APIENTRY GL_Rotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRotatex, "context = %d, angle = 0x%X, x = 0x%X, y = 0x%X, z = 0x%X",
           CID(context), angle, x, y, z);
+    ANGLE_PROFILE_ENTRY_POINT(GLRotatex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3061,12 +3199,14 @@ void GL_APIENTRY GL_SampleCoveragex(GLclampx value, GLboolean invert)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSampleCoveragex, "context = %d, value = 0x%X, invert = %s", CID(context),
           value, GLbooleanToString(invert));
+    ANGLE_PROFILE_ENTRY_POINT(GLSampleCoveragex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3103,12 +3243,14 @@ void GL_APIENTRY GL_Scalef(GLfloat x, GLfloat y, GLfloat z)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLScalef, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
+    ANGLE_PROFILE_ENTRY_POINT(GLScalef);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3145,12 +3287,14 @@ void GL_APIENTRY GL_Scalex(GLfixed x, GLfixed y, GLfixed z)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLScalex, "context = %d, x = 0x%X, y = 0x%X, z = 0x%X", CID(context), x, y, z);
+    ANGLE_PROFILE_ENTRY_POINT(GLScalex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3188,6 +3332,7 @@ void GL_APIENTRY GL_ShadeModel(GLenum mode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLShadeModel, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::ShadingModel, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLShadeModel);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3195,6 +3340,7 @@ void GL_APIENTRY GL_ShadeModel(GLenum mode)
         bool isCallValid        = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3234,6 +3380,7 @@ void GL_APIENTRY GL_TexCoordPointer(GLint size, GLenum type, GLsizei stride, con
           "context = %d, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "",
           CID(context), size, GLenumToString(GLESEnum::TexCoordPointerType, type), stride,
           (uintptr_t)pointer);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexCoordPointer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3242,6 +3389,7 @@ void GL_APIENTRY GL_TexCoordPointer(GLint size, GLenum type, GLsizei stride, con
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3278,6 +3426,7 @@ void GL_APIENTRY GL_TexEnvf(GLenum target, GLenum pname, GLfloat param)
     EVENT(context, GLTexEnvf, "context = %d, target = %s, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexEnvf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3286,6 +3435,7 @@ void GL_APIENTRY GL_TexEnvf(GLenum target, GLenum pname, GLfloat param)
         bool isCallValid                = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3325,6 +3475,7 @@ void GL_APIENTRY GL_TexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
     EVENT(context, GLTexEnvfv, "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexEnvfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3333,6 +3484,7 @@ void GL_APIENTRY GL_TexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
         bool isCallValid                = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3372,6 +3524,7 @@ void GL_APIENTRY GL_TexEnvi(GLenum target, GLenum pname, GLint param)
     EVENT(context, GLTexEnvi, "context = %d, target = %s, pname = %s, param = %d", CID(context),
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexEnvi);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3380,6 +3533,7 @@ void GL_APIENTRY GL_TexEnvi(GLenum target, GLenum pname, GLint param)
         bool isCallValid                = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3419,6 +3573,7 @@ void GL_APIENTRY GL_TexEnviv(GLenum target, GLenum pname, const GLint *params)
     EVENT(context, GLTexEnviv, "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexEnviv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3427,6 +3582,7 @@ void GL_APIENTRY GL_TexEnviv(GLenum target, GLenum pname, const GLint *params)
         bool isCallValid                = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3466,6 +3622,7 @@ void GL_APIENTRY GL_TexEnvx(GLenum target, GLenum pname, GLfixed param)
     EVENT(context, GLTexEnvx, "context = %d, target = %s, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexEnvx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3474,6 +3631,7 @@ void GL_APIENTRY GL_TexEnvx(GLenum target, GLenum pname, GLfixed param)
         bool isCallValid                = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3513,6 +3671,7 @@ void GL_APIENTRY GL_TexEnvxv(GLenum target, GLenum pname, const GLfixed *params)
     EVENT(context, GLTexEnvxv, "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TextureEnvTarget, target),
           GLenumToString(GLESEnum::TextureEnvParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexEnvxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3521,6 +3680,7 @@ void GL_APIENTRY GL_TexEnvxv(GLenum target, GLenum pname, const GLfixed *params)
         bool isCallValid                = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3560,6 +3720,7 @@ void GL_APIENTRY GL_TexParameterx(GLenum target, GLenum pname, GLfixed param)
     EVENT(context, GLTexParameterx, "context = %d, target = %s, pname = %s, param = 0x%X",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterx);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3568,6 +3729,7 @@ void GL_APIENTRY GL_TexParameterx(GLenum target, GLenum pname, GLfixed param)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3605,6 +3767,7 @@ void GL_APIENTRY GL_TexParameterxv(GLenum target, GLenum pname, const GLfixed *p
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterxv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3613,6 +3776,7 @@ void GL_APIENTRY GL_TexParameterxv(GLenum target, GLenum pname, const GLfixed *p
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3647,12 +3811,14 @@ void GL_APIENTRY GL_Translatef(GLfloat x, GLfloat y, GLfloat z)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTranslatef, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
+    ANGLE_PROFILE_ENTRY_POINT(GLTranslatef);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3690,12 +3856,14 @@ void GL_APIENTRY GL_Translatex(GLfixed x, GLfixed y, GLfixed z)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTranslatex, "context = %d, x = 0x%X, y = 0x%X, z = 0x%X", CID(context), x, y,
           z);
+    ANGLE_PROFILE_ENTRY_POINT(GLTranslatex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3735,6 +3903,7 @@ void GL_APIENTRY GL_VertexPointer(GLint size, GLenum type, GLsizei stride, const
           "context = %d, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "",
           CID(context), size, GLenumToString(GLESEnum::VertexPointerType, type), stride,
           (uintptr_t)pointer);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexPointer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3743,6 +3912,7 @@ void GL_APIENTRY GL_VertexPointer(GLint size, GLenum type, GLsizei stride, const
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
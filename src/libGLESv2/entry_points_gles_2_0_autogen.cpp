@@ -30,12 +30,14 @@ void GL_APIENTRY GL_ActiveTexture(GLenum texture)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLActiveTexture, "context = %d, texture = %s", CID(context),
           GLenumToString(GLESEnum::TextureUnit, texture));
+    ANGLE_PROFILE_ENTRY_POINT(GLActiveTexture);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -69,6 +71,7 @@ void GL_APIENTRY GL_AttachShader(GLuint program, GLuint shader)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLAttachShader, "context = %d, program = %u, shader = %u", CID(context), program,
           shader);
+    ANGLE_PROFILE_ENTRY_POINT(GLAttachShader);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -78,6 +81,7 @@ void GL_APIENTRY GL_AttachShader(GLuint program, GLuint shader)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -114,6 +118,7 @@ void GL_APIENTRY GL_BindAttribLocation(GLuint program, GLuint index, const GLcha
     EVENT(context, GLBindAttribLocation,
           "context = %d, program = %u, index = %u, name = 0x%016" PRIxPTR "", CID(context), program,
           index, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindAttribLocation);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -122,6 +127,7 @@ void GL_APIENTRY GL_BindAttribLocation(GLuint program, GLuint index, const GLcha
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -157,6 +163,7 @@ void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindBuffer, "context = %d, target = %s, buffer = %u", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target), buffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindBuffer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -166,6 +173,7 @@ void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -197,6 +205,7 @@ void GL_APIENTRY GL_BindFramebuffer(GLenum target, GLuint framebuffer)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindFramebuffer, "context = %d, target = %s, framebuffer = %u", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target), framebuffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindFramebuffer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -209,6 +218,7 @@ void GL_APIENTRY GL_BindFramebuffer(GLenum target, GLuint framebuffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -244,6 +254,7 @@ void GL_APIENTRY GL_BindRenderbuffer(GLenum target, GLuint renderbuffer)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindRenderbuffer, "context = %d, target = %s, renderbuffer = %u", CID(context),
           GLenumToString(GLESEnum::RenderbufferTarget, target), renderbuffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindRenderbuffer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -252,6 +263,7 @@ void GL_APIENTRY GL_BindRenderbuffer(GLenum target, GLuint renderbuffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -287,6 +299,7 @@ void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindTexture, "context = %d, target = %s, texture = %u", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target), texture);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindTexture);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -296,6 +309,7 @@ void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -327,12 +341,14 @@ void GL_APIENTRY GL_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendColor, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendColor);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -371,12 +387,14 @@ void GL_APIENTRY GL_BlendEquation(GLenum mode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquation, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::BlendEquationModeEXT, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendEquation);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -415,12 +433,14 @@ void GL_APIENTRY GL_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
     EVENT(context, GLBlendEquationSeparate, "context = %d, modeRGB = %s, modeAlpha = %s",
           CID(context), GLenumToString(GLESEnum::BlendEquationModeEXT, modeRGB),
           GLenumToString(GLESEnum::BlendEquationModeEXT, modeAlpha));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendEquationSeparate);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -460,12 +480,14 @@ void GL_APIENTRY GL_BlendFunc(GLenum sfactor, GLenum dfactor)
     EVENT(context, GLBlendFunc, "context = %d, sfactor = %s, dfactor = %s", CID(context),
           GLenumToString(GLESEnum::BlendingFactor, sfactor),
           GLenumToString(GLESEnum::BlendingFactor, dfactor));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendFunc);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -506,12 +528,14 @@ void GL_APIENTRY GL_BlendFuncSeparate(GLenum sfactorRGB,
           GLenumToString(GLESEnum::BlendingFactor, dfactorRGB),
           GLenumToString(GLESEnum::BlendingFactor, sfactorAlpha),
           GLenumToString(GLESEnum::BlendingFactor, dfactorAlpha));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendFuncSeparate);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -555,6 +579,7 @@ void GL_APIENTRY GL_BufferData(GLenum target, GLsizeiptr size, const void *data,
           CID(context), GLenumToString(GLESEnum::BufferTargetARB, target),
           static_cast<unsigned long long>(size), (uintptr_t)data,
           GLenumToString(GLESEnum::BufferUsageARB, usage));
+    ANGLE_PROFILE_ENTRY_POINT(GLBufferData);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -564,6 +589,7 @@ void GL_APIENTRY GL_BufferData(GLenum target, GLsizeiptr size, const void *data,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -598,6 +624,7 @@ void GL_APIENTRY GL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr siz
           CID(context), GLenumToString(GLESEnum::BufferTargetARB, target),
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(size),
           (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLBufferSubData);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -606,6 +633,7 @@ void GL_APIENTRY GL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr siz
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -637,6 +665,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatus(GLenum target)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCheckFramebufferStatus, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target));
+    ANGLE_PROFILE_ENTRY_POINT(GLCheckFramebufferStatus);
 
     GLenum returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -645,6 +674,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatus(GLenum target)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -687,6 +717,7 @@ void GL_APIENTRY GL_Clear(GLbitfield mask)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClear, "context = %d, mask = %s", CID(context),
           GLbitfieldToString(GLESEnum::ClearBufferMask, mask).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLClear);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -694,6 +725,7 @@ void GL_APIENTRY GL_Clear(GLbitfield mask)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -724,12 +756,14 @@ void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearColor, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
+    ANGLE_PROFILE_ENTRY_POINT(GLClearColor);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -763,12 +797,14 @@ void GL_APIENTRY GL_ClearDepthf(GLfloat d)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearDepthf, "context = %d, d = %f", CID(context), d);
+    ANGLE_PROFILE_ENTRY_POINT(GLClearDepthf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -801,12 +837,14 @@ void GL_APIENTRY GL_ClearStencil(GLint s)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearStencil, "context = %d, s = %d", CID(context), s);
+    ANGLE_PROFILE_ENTRY_POINT(GLClearStencil);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -841,12 +879,14 @@ void GL_APIENTRY GL_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GL
     EVENT(context, GLColorMask, "context = %d, red = %s, green = %s, blue = %s, alpha = %s",
           CID(context), GLbooleanToString(red), GLbooleanToString(green), GLbooleanToString(blue),
           GLbooleanToString(alpha));
+    ANGLE_PROFILE_ENTRY_POINT(GLColorMask);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -880,6 +920,7 @@ void GL_APIENTRY GL_CompileShader(GLuint shader)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompileShader, "context = %d, shader = %u", CID(context), shader);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompileShader);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -888,6 +929,7 @@ void GL_APIENTRY GL_CompileShader(GLuint shader)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -934,6 +976,7 @@ void GL_APIENTRY GL_CompressedTexImage2D(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level,
           GLenumToString(GLESEnum::InternalFormat, internalformat), width, height, border,
           imageSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedTexImage2D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -942,6 +985,7 @@ void GL_APIENTRY GL_CompressedTexImage2D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -988,6 +1032,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2D(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, xoffset, yoffset,
           width, height, GLenumToString(GLESEnum::InternalFormat, format), imageSize,
           (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedTexSubImage2D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -996,6 +1041,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1041,6 +1087,7 @@ void GL_APIENTRY GL_CopyTexImage2D(GLenum target,
           "height = %d, border = %d",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level,
           GLenumToString(GLESEnum::InternalFormat, internalformat), x, y, width, height, border);
+    ANGLE_PROFILE_ENTRY_POINT(GLCopyTexImage2D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1053,6 +1100,7 @@ void GL_APIENTRY GL_CopyTexImage2D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1097,6 +1145,7 @@ void GL_APIENTRY GL_CopyTexSubImage2D(GLenum target,
           "width = %d, height = %d",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, xoffset, yoffset, x,
           y, width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLCopyTexSubImage2D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1109,6 +1158,7 @@ void GL_APIENTRY GL_CopyTexSubImage2D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1141,6 +1191,7 @@ GLuint GL_APIENTRY GL_CreateProgram()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCreateProgram, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLCreateProgram);
 
     GLuint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -1149,6 +1200,7 @@ GLuint GL_APIENTRY GL_CreateProgram()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1189,6 +1241,7 @@ GLuint GL_APIENTRY GL_CreateShader(GLenum type)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCreateShader, "context = %d, type = %s", CID(context),
           GLenumToString(GLESEnum::ShaderType, type));
+    ANGLE_PROFILE_ENTRY_POINT(GLCreateShader);
 
     GLuint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -1198,6 +1251,7 @@ GLuint GL_APIENTRY GL_CreateShader(GLenum type)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1239,6 +1293,7 @@ void GL_APIENTRY GL_CullFace(GLenum mode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCullFace, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::TriangleFace, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLCullFace);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1246,6 +1301,7 @@ void GL_APIENTRY GL_CullFace(GLenum mode)
         bool isCallValid        = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1279,6 +1335,7 @@ void GL_APIENTRY GL_DeleteBuffers(GLsizei n, const GLuint *buffers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteBuffers, "context = %d, n = %d, buffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)buffers);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteBuffers);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1287,6 +1344,7 @@ void GL_APIENTRY GL_DeleteBuffers(GLsizei n, const GLuint *buffers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1318,6 +1376,7 @@ void GL_APIENTRY GL_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteFramebuffers, "context = %d, n = %d, framebuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)framebuffers);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteFramebuffers);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1326,6 +1385,7 @@ void GL_APIENTRY GL_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1360,6 +1420,7 @@ void GL_APIENTRY GL_DeleteProgram(GLuint program)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteProgram, "context = %d, program = %u", CID(context), program);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteProgram);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1368,6 +1429,7 @@ void GL_APIENTRY GL_DeleteProgram(GLuint program)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1403,6 +1465,7 @@ void GL_APIENTRY GL_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteRenderbuffers, "context = %d, n = %d, renderbuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)renderbuffers);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteRenderbuffers);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1412,6 +1475,7 @@ void GL_APIENTRY GL_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1446,6 +1510,7 @@ void GL_APIENTRY GL_DeleteShader(GLuint shader)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteShader, "context = %d, shader = %u", CID(context), shader);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteShader);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1454,6 +1519,7 @@ void GL_APIENTRY GL_DeleteShader(GLuint shader)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1489,6 +1555,7 @@ void GL_APIENTRY GL_DeleteTextures(GLsizei n, const GLuint *textures)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteTextures, "context = %d, n = %d, textures = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)textures);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteTextures);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1497,6 +1564,7 @@ void GL_APIENTRY GL_DeleteTextures(GLsizei n, const GLuint *textures)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1528,12 +1596,14 @@ void GL_APIENTRY GL_DepthFunc(GLenum func)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDepthFunc, "context = %d, func = %s", CID(context),
           GLenumToString(GLESEnum::DepthFunction, func));
+    ANGLE_PROFILE_ENTRY_POINT(GLDepthFunc);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1566,12 +1636,14 @@ void GL_APIENTRY GL_DepthMask(GLboolean flag)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDepthMask, "context = %d, flag = %s", CID(context), GLbooleanToString(flag));
+    ANGLE_PROFILE_ENTRY_POINT(GLDepthMask);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1604,12 +1676,14 @@ void GL_APIENTRY GL_DepthRangef(GLfloat n, GLfloat f)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDepthRangef, "context = %d, n = %f, f = %f", CID(context), n, f);
+    ANGLE_PROFILE_ENTRY_POINT(GLDepthRangef);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1643,6 +1717,7 @@ void GL_APIENTRY GL_DetachShader(GLuint program, GLuint shader)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDetachShader, "context = %d, program = %u, shader = %u", CID(context), program,
           shader);
+    ANGLE_PROFILE_ENTRY_POINT(GLDetachShader);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1652,6 +1727,7 @@ void GL_APIENTRY GL_DetachShader(GLuint program, GLuint shader)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1687,12 +1763,14 @@ void GL_APIENTRY GL_Disable(GLenum cap)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisable, "context = %d, cap = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, cap));
+    ANGLE_PROFILE_ENTRY_POINT(GLDisable);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1725,12 +1803,14 @@ void GL_APIENTRY GL_DisableVertexAttribArray(GLuint index)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisableVertexAttribArray, "context = %d, index = %u", CID(context), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLDisableVertexAttribArray);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1769,6 +1849,7 @@ void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawArrays, "context = %d, mode = %s, first = %d, count = %d", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, mode), first, count);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawArrays);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1777,6 +1858,7 @@ void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1810,6 +1892,7 @@ void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElements);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1819,6 +1902,7 @@ void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1851,12 +1935,14 @@ void GL_APIENTRY GL_Enable(GLenum cap)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnable, "context = %d, cap = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, cap));
+    ANGLE_PROFILE_ENTRY_POINT(GLEnable);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1889,12 +1975,14 @@ void GL_APIENTRY GL_EnableVertexAttribArray(GLuint index)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnableVertexAttribArray, "context = %d, index = %u", CID(context), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLEnableVertexAttribArray);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1932,6 +2020,7 @@ void GL_APIENTRY GL_Finish()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFinish, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLFinish);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1939,6 +2028,7 @@ void GL_APIENTRY GL_Finish()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1968,6 +2058,7 @@ void GL_APIENTRY GL_Flush()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFlush, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLFlush);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1975,6 +2066,7 @@ void GL_APIENTRY GL_Flush()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2011,6 +2103,7 @@ void GL_APIENTRY GL_FramebufferRenderbuffer(GLenum target,
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment),
           GLenumToString(GLESEnum::RenderbufferTarget, renderbuffertarget), renderbuffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferRenderbuffer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2023,6 +2116,7 @@ void GL_APIENTRY GL_FramebufferRenderbuffer(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2069,6 +2163,7 @@ void GL_APIENTRY GL_FramebufferTexture2D(GLenum target,
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment),
           GLenumToString(GLESEnum::TextureTarget, textarget), texture, level);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferTexture2D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2082,6 +2177,7 @@ void GL_APIENTRY GL_FramebufferTexture2D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2120,12 +2216,14 @@ void GL_APIENTRY GL_FrontFace(GLenum mode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFrontFace, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::FrontFaceDirection, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLFrontFace);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2159,6 +2257,7 @@ void GL_APIENTRY GL_GenBuffers(GLsizei n, GLuint *buffers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenBuffers, "context = %d, n = %d, buffers = 0x%016" PRIxPTR "", CID(context),
           n, (uintptr_t)buffers);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenBuffers);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2167,6 +2266,7 @@ void GL_APIENTRY GL_GenBuffers(GLsizei n, GLuint *buffers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2198,6 +2298,7 @@ void GL_APIENTRY GL_GenFramebuffers(GLsizei n, GLuint *framebuffers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenFramebuffers, "context = %d, n = %d, framebuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)framebuffers);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenFramebuffers);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2206,6 +2307,7 @@ void GL_APIENTRY GL_GenFramebuffers(GLsizei n, GLuint *framebuffers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2241,6 +2343,7 @@ void GL_APIENTRY GL_GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenRenderbuffers, "context = %d, n = %d, renderbuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)renderbuffers);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenRenderbuffers);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2249,6 +2352,7 @@ void GL_APIENTRY GL_GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2284,6 +2388,7 @@ void GL_APIENTRY GL_GenTextures(GLsizei n, GLuint *textures)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenTextures, "context = %d, n = %d, textures = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)textures);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenTextures);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2292,6 +2397,7 @@ void GL_APIENTRY GL_GenTextures(GLsizei n, GLuint *textures)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2323,6 +2429,7 @@ void GL_APIENTRY GL_GenerateMipmap(GLenum target)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenerateMipmap, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target));
+    ANGLE_PROFILE_ENTRY_POINT(GLGenerateMipmap);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2331,6 +2438,7 @@ void GL_APIENTRY GL_GenerateMipmap(GLenum target)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2375,6 +2483,7 @@ void GL_APIENTRY GL_GetActiveAttrib(GLuint program,
           ", size = 0x%016" PRIxPTR ", type = 0x%016" PRIxPTR ", name = 0x%016" PRIxPTR "",
           CID(context), program, index, bufSize, (uintptr_t)length, (uintptr_t)size,
           (uintptr_t)type, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetActiveAttrib);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2383,6 +2492,7 @@ void GL_APIENTRY GL_GetActiveAttrib(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2429,6 +2539,7 @@ void GL_APIENTRY GL_GetActiveUniform(GLuint program,
           ", size = 0x%016" PRIxPTR ", type = 0x%016" PRIxPTR ", name = 0x%016" PRIxPTR "",
           CID(context), program, index, bufSize, (uintptr_t)length, (uintptr_t)size,
           (uintptr_t)type, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetActiveUniform);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2437,6 +2548,7 @@ void GL_APIENTRY GL_GetActiveUniform(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2479,6 +2591,7 @@ void GL_APIENTRY GL_GetAttachedShaders(GLuint program,
           "context = %d, program = %u, maxCount = %d, count = 0x%016" PRIxPTR
           ", shaders = 0x%016" PRIxPTR "",
           CID(context), program, maxCount, (uintptr_t)count, (uintptr_t)shaders);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetAttachedShaders);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2488,6 +2601,7 @@ void GL_APIENTRY GL_GetAttachedShaders(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2525,6 +2639,7 @@ GLint GL_APIENTRY GL_GetAttribLocation(GLuint program, const GLchar *name)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetAttribLocation, "context = %d, program = %u, name = 0x%016" PRIxPTR "",
           CID(context), program, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetAttribLocation);
 
     GLint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -2534,6 +2649,7 @@ GLint GL_APIENTRY GL_GetAttribLocation(GLuint program, const GLchar *name)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2575,6 +2691,7 @@ void GL_APIENTRY GL_GetBooleanv(GLenum pname, GLboolean *data)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBooleanv, "context = %d, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBooleanv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2582,6 +2699,7 @@ void GL_APIENTRY GL_GetBooleanv(GLenum pname, GLboolean *data)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2615,6 +2733,7 @@ void GL_APIENTRY GL_GetBufferParameteriv(GLenum target, GLenum pname, GLint *par
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target),
           GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBufferParameteriv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2623,6 +2742,7 @@ void GL_APIENTRY GL_GetBufferParameteriv(GLenum target, GLenum pname, GLint *par
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2654,6 +2774,7 @@ GLenum GL_APIENTRY GL_GetError()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetGlobalContext();
     EVENT(context, GLGetError, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLGetError);
 
     GLenum returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -2662,6 +2783,7 @@ GLenum GL_APIENTRY GL_GetError()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2698,6 +2820,7 @@ void GL_APIENTRY GL_GetFloatv(GLenum pname, GLfloat *data)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFloatv, "context = %d, pname = %s, data = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFloatv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2705,6 +2828,7 @@ void GL_APIENTRY GL_GetFloatv(GLenum pname, GLfloat *data)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2742,6 +2866,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameteriv(GLenum target,
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment),
           GLenumToString(GLESEnum::FramebufferAttachmentParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFramebufferAttachmentParameteriv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2749,6 +2874,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameteriv(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2788,6 +2914,7 @@ void GL_APIENTRY GL_GetIntegerv(GLenum pname, GLint *data)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetIntegerv, "context = %d, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetIntegerv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2795,6 +2922,7 @@ void GL_APIENTRY GL_GetIntegerv(GLenum pname, GLint *data)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2831,6 +2959,7 @@ void GL_APIENTRY GL_GetProgramInfoLog(GLuint program,
           "context = %d, program = %u, bufSize = %d, length = 0x%016" PRIxPTR
           ", infoLog = 0x%016" PRIxPTR "",
           CID(context), program, bufSize, (uintptr_t)length, (uintptr_t)infoLog);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramInfoLog);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2839,6 +2968,7 @@ void GL_APIENTRY GL_GetProgramInfoLog(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2877,6 +3007,7 @@ void GL_APIENTRY GL_GetProgramiv(GLuint program, GLenum pname, GLint *params)
     EVENT(context, GLGetProgramiv,
           "context = %d, program = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           program, GLenumToString(GLESEnum::ProgramPropertyARB, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2885,6 +3016,7 @@ void GL_APIENTRY GL_GetProgramiv(GLuint program, GLenum pname, GLint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2921,6 +3053,7 @@ void GL_APIENTRY GL_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLin
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::RenderbufferTarget, target),
           GLenumToString(GLESEnum::RenderbufferParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetRenderbufferParameteriv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2928,6 +3061,7 @@ void GL_APIENTRY GL_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLin
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2970,6 +3104,7 @@ void GL_APIENTRY GL_GetShaderInfoLog(GLuint shader,
           "context = %d, shader = %u, bufSize = %d, length = 0x%016" PRIxPTR
           ", infoLog = 0x%016" PRIxPTR "",
           CID(context), shader, bufSize, (uintptr_t)length, (uintptr_t)infoLog);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetShaderInfoLog);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2978,6 +3113,7 @@ void GL_APIENTRY GL_GetShaderInfoLog(GLuint shader,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3022,6 +3158,7 @@ void GL_APIENTRY GL_GetShaderPrecisionFormat(GLenum shadertype,
           CID(context), GLenumToString(GLESEnum::ShaderType, shadertype),
           GLenumToString(GLESEnum::PrecisionType, precisiontype), (uintptr_t)range,
           (uintptr_t)precision);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetShaderPrecisionFormat);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3029,6 +3166,7 @@ void GL_APIENTRY GL_GetShaderPrecisionFormat(GLenum shadertype,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3069,6 +3207,7 @@ void GL_APIENTRY GL_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *len
           "context = %d, shader = %u, bufSize = %d, length = 0x%016" PRIxPTR
           ", source = 0x%016" PRIxPTR "",
           CID(context), shader, bufSize, (uintptr_t)length, (uintptr_t)source);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetShaderSource);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3077,6 +3216,7 @@ void GL_APIENTRY GL_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *len
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3114,6 +3254,7 @@ void GL_APIENTRY GL_GetShaderiv(GLuint shader, GLenum pname, GLint *params)
     EVENT(context, GLGetShaderiv,
           "context = %d, shader = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), shader,
           GLenumToString(GLESEnum::ShaderParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetShaderiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3122,6 +3263,7 @@ void GL_APIENTRY GL_GetShaderiv(GLuint shader, GLenum pname, GLint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3156,6 +3298,7 @@ const GLubyte *GL_APIENTRY GL_GetString(GLenum name)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetString, "context = %d, name = %s", CID(context),
           GLenumToString(GLESEnum::StringName, name));
+    ANGLE_PROFILE_ENTRY_POINT(GLGetString);
 
     const GLubyte *returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3164,6 +3307,7 @@ const GLubyte *GL_APIENTRY GL_GetString(GLenum name)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3202,6 +3346,7 @@ void GL_APIENTRY GL_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *para
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3210,6 +3355,7 @@ void GL_APIENTRY GL_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *para
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3243,6 +3389,7 @@ void GL_APIENTRY GL_GetTexParameteriv(GLenum target, GLenum pname, GLint *params
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameteriv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3251,6 +3398,7 @@ void GL_APIENTRY GL_GetTexParameteriv(GLenum target, GLenum pname, GLint *params
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3282,6 +3430,7 @@ GLint GL_APIENTRY GL_GetUniformLocation(GLuint program, const GLchar *name)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUniformLocation, "context = %d, program = %u, name = 0x%016" PRIxPTR "",
           CID(context), program, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUniformLocation);
 
     GLint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3291,6 +3440,7 @@ GLint GL_APIENTRY GL_GetUniformLocation(GLuint program, const GLchar *name)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3334,6 +3484,7 @@ void GL_APIENTRY GL_GetUniformfv(GLuint program, GLint location, GLfloat *params
     EVENT(context, GLGetUniformfv,
           "context = %d, program = %u, location = %d, params = 0x%016" PRIxPTR "", CID(context),
           program, location, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUniformfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3343,6 +3494,7 @@ void GL_APIENTRY GL_GetUniformfv(GLuint program, GLint location, GLfloat *params
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3379,6 +3531,7 @@ void GL_APIENTRY GL_GetUniformiv(GLuint program, GLint location, GLint *params)
     EVENT(context, GLGetUniformiv,
           "context = %d, program = %u, location = %d, params = 0x%016" PRIxPTR "", CID(context),
           program, location, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUniformiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3388,6 +3541,7 @@ void GL_APIENTRY GL_GetUniformiv(GLuint program, GLint location, GLint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3424,6 +3578,7 @@ void GL_APIENTRY GL_GetVertexAttribPointerv(GLuint index, GLenum pname, void **p
     EVENT(context, GLGetVertexAttribPointerv,
           "context = %d, index = %u, pname = %s, pointer = 0x%016" PRIxPTR "", CID(context), index,
           GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)pointer);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetVertexAttribPointerv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3431,6 +3586,7 @@ void GL_APIENTRY GL_GetVertexAttribPointerv(GLuint index, GLenum pname, void **p
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3468,6 +3624,7 @@ void GL_APIENTRY GL_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *param
     EVENT(context, GLGetVertexAttribfv,
           "context = %d, index = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), index,
           GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetVertexAttribfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3475,6 +3632,7 @@ void GL_APIENTRY GL_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *param
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3511,6 +3669,7 @@ void GL_APIENTRY GL_GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
     EVENT(context, GLGetVertexAttribiv,
           "context = %d, index = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), index,
           GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetVertexAttribiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3518,6 +3677,7 @@ void GL_APIENTRY GL_GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3553,12 +3713,14 @@ void GL_APIENTRY GL_Hint(GLenum target, GLenum mode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLHint, "context = %d, target = %s, mode = %s", CID(context),
           GLenumToString(GLESEnum::HintTarget, target), GLenumToString(GLESEnum::HintMode, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLHint);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3591,6 +3753,7 @@ GLboolean GL_APIENTRY GL_IsBuffer(GLuint buffer)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsBuffer, "context = %d, buffer = %u", CID(context), buffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsBuffer);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3600,6 +3763,7 @@ GLboolean GL_APIENTRY GL_IsBuffer(GLuint buffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3637,6 +3801,7 @@ GLboolean GL_APIENTRY GL_IsEnabled(GLenum cap)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsEnabled, "context = %d, cap = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, cap));
+    ANGLE_PROFILE_ENTRY_POINT(GLIsEnabled);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3644,6 +3809,7 @@ GLboolean GL_APIENTRY GL_IsEnabled(GLenum cap)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3682,6 +3848,7 @@ GLboolean GL_APIENTRY GL_IsFramebuffer(GLuint framebuffer)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsFramebuffer, "context = %d, framebuffer = %u", CID(context), framebuffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsFramebuffer);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3691,6 +3858,7 @@ GLboolean GL_APIENTRY GL_IsFramebuffer(GLuint framebuffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3731,6 +3899,7 @@ GLboolean GL_APIENTRY GL_IsProgram(GLuint program)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsProgram, "context = %d, program = %u", CID(context), program);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsProgram);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3740,6 +3909,7 @@ GLboolean GL_APIENTRY GL_IsProgram(GLuint program)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3780,6 +3950,7 @@ GLboolean GL_APIENTRY GL_IsRenderbuffer(GLuint renderbuffer)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsRenderbuffer, "context = %d, renderbuffer = %u", CID(context), renderbuffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsRenderbuffer);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3789,6 +3960,7 @@ GLboolean GL_APIENTRY GL_IsRenderbuffer(GLuint renderbuffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3829,6 +4001,7 @@ GLboolean GL_APIENTRY GL_IsShader(GLuint shader)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsShader, "context = %d, shader = %u", CID(context), shader);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsShader);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3838,6 +4011,7 @@ GLboolean GL_APIENTRY GL_IsShader(GLuint shader)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3878,6 +4052,7 @@ GLboolean GL_APIENTRY GL_IsTexture(GLuint texture)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsTexture, "context = %d, texture = %u", CID(context), texture);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsTexture);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3887,6 +4062,7 @@ GLboolean GL_APIENTRY GL_IsTexture(GLuint texture)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3923,12 +4099,14 @@ void GL_APIENTRY GL_LineWidth(GLfloat width)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLineWidth, "context = %d, width = %f", CID(context), width);
+    ANGLE_PROFILE_ENTRY_POINT(GLLineWidth);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3961,6 +4139,7 @@ void GL_APIENTRY GL_LinkProgram(GLuint program)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLinkProgram, "context = %d, program = %u", CID(context), program);
+    ANGLE_PROFILE_ENTRY_POINT(GLLinkProgram);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3969,6 +4148,7 @@ void GL_APIENTRY GL_LinkProgram(GLuint program)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4004,12 +4184,14 @@ void GL_APIENTRY GL_PixelStorei(GLenum pname, GLint param)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPixelStorei, "context = %d, pname = %s, param = %d", CID(context),
           GLenumToString(GLESEnum::PixelStoreParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLPixelStorei);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4043,12 +4225,14 @@ void GL_APIENTRY GL_PolygonOffset(GLfloat factor, GLfloat units)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPolygonOffset, "context = %d, factor = %f, units = %f", CID(context), factor,
           units);
+    ANGLE_PROFILE_ENTRY_POINT(GLPolygonOffset);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4091,6 +4275,7 @@ void GL_APIENTRY GL_ReadPixels(GLint x,
           "0x%016" PRIxPTR "",
           CID(context), x, y, width, height, GLenumToString(GLESEnum::PixelFormat, format),
           GLenumToString(GLESEnum::PixelType, type), (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLReadPixels);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4102,6 +4287,7 @@ void GL_APIENTRY GL_ReadPixels(GLint x,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4133,6 +4319,7 @@ void GL_APIENTRY GL_ReleaseShaderCompiler()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReleaseShaderCompiler, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLReleaseShaderCompiler);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4140,6 +4327,7 @@ void GL_APIENTRY GL_ReleaseShaderCompiler()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4180,6 +4368,7 @@ void GL_APIENTRY GL_RenderbufferStorage(GLenum target,
           "context = %d, target = %s, internalformat = %s, width = %d, height = %d", CID(context),
           GLenumToString(GLESEnum::RenderbufferTarget, target),
           GLenumToString(GLESEnum::InternalFormat, internalformat), width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLRenderbufferStorage);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4187,6 +4376,7 @@ void GL_APIENTRY GL_RenderbufferStorage(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4224,12 +4414,14 @@ void GL_APIENTRY GL_SampleCoverage(GLfloat value, GLboolean invert)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSampleCoverage, "context = %d, value = %f, invert = %s", CID(context), value,
           GLbooleanToString(invert));
+    ANGLE_PROFILE_ENTRY_POINT(GLSampleCoverage);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4263,12 +4455,14 @@ void GL_APIENTRY GL_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLScissor, "context = %d, x = %d, y = %d, width = %d, height = %d", CID(context),
           x, y, width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLScissor);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4309,6 +4503,7 @@ void GL_APIENTRY GL_ShaderBinary(GLsizei count,
           ", binaryFormat = %s, binary = 0x%016" PRIxPTR ", length = %d",
           CID(context), count, (uintptr_t)shaders,
           GLenumToString(GLESEnum::ShaderBinaryFormat, binaryFormat), (uintptr_t)binary, length);
+    ANGLE_PROFILE_ENTRY_POINT(GLShaderBinary);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4317,6 +4512,7 @@ void GL_APIENTRY GL_ShaderBinary(GLsizei count,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4359,6 +4555,7 @@ void GL_APIENTRY GL_ShaderSource(GLuint shader,
           "context = %d, shader = %u, count = %d, string = 0x%016" PRIxPTR
           ", length = 0x%016" PRIxPTR "",
           CID(context), shader, count, (uintptr_t)string, (uintptr_t)length);
+    ANGLE_PROFILE_ENTRY_POINT(GLShaderSource);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4367,6 +4564,7 @@ void GL_APIENTRY GL_ShaderSource(GLuint shader,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4402,12 +4600,14 @@ void GL_APIENTRY GL_StencilFunc(GLenum func, GLint ref, GLuint mask)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLStencilFunc, "context = %d, func = %s, ref = %d, mask = %u", CID(context),
           GLenumToString(GLESEnum::StencilFunction, func), ref, mask);
+    ANGLE_PROFILE_ENTRY_POINT(GLStencilFunc);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4442,12 +4642,14 @@ void GL_APIENTRY GL_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLu
     EVENT(context, GLStencilFuncSeparate, "context = %d, face = %s, func = %s, ref = %d, mask = %u",
           CID(context), GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::StencilFunction, func), ref, mask);
+    ANGLE_PROFILE_ENTRY_POINT(GLStencilFuncSeparate);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4485,12 +4687,14 @@ void GL_APIENTRY GL_StencilMask(GLuint mask)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLStencilMask, "context = %d, mask = %u", CID(context), mask);
+    ANGLE_PROFILE_ENTRY_POINT(GLStencilMask);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4524,12 +4728,14 @@ void GL_APIENTRY GL_StencilMaskSeparate(GLenum face, GLuint mask)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLStencilMaskSeparate, "context = %d, face = %s, mask = %u", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face), mask);
+    ANGLE_PROFILE_ENTRY_POINT(GLStencilMaskSeparate);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4568,12 +4774,14 @@ void GL_APIENTRY GL_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
     EVENT(context, GLStencilOp, "context = %d, fail = %s, zfail = %s, zpass = %s", CID(context),
           GLenumToString(GLESEnum::StencilOp, fail), GLenumToString(GLESEnum::StencilOp, zfail),
           GLenumToString(GLESEnum::StencilOp, zpass));
+    ANGLE_PROFILE_ENTRY_POINT(GLStencilOp);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4609,12 +4817,14 @@ void GL_APIENTRY GL_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail,
           "context = %d, face = %s, sfail = %s, dpfail = %s, dppass = %s", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face), GLenumToString(GLESEnum::StencilOp, sfail),
           GLenumToString(GLESEnum::StencilOp, dpfail), GLenumToString(GLESEnum::StencilOp, dppass));
+    ANGLE_PROFILE_ENTRY_POINT(GLStencilOpSeparate);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4665,6 +4875,7 @@ void GL_APIENTRY GL_TexImage2D(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, internalformat,
           width, height, border, GLenumToString(GLESEnum::PixelFormat, format),
           GLenumToString(GLESEnum::PixelType, type), (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexImage2D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4673,6 +4884,7 @@ void GL_APIENTRY GL_TexImage2D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4708,6 +4920,7 @@ void GL_APIENTRY GL_TexParameterf(GLenum target, GLenum pname, GLfloat param)
     EVENT(context, GLTexParameterf, "context = %d, target = %s, pname = %s, param = %f",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::TextureParameterName, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4716,6 +4929,7 @@ void GL_APIENTRY GL_TexParameterf(GLenum target, GLenum pname, GLfloat param)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4749,6 +4963,7 @@ void GL_APIENTRY GL_TexParameterfv(GLenum target, GLenum pname, const GLfloat *p
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::TextureParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4757,6 +4972,7 @@ void GL_APIENTRY GL_TexParameterfv(GLenum target, GLenum pname, const GLfloat *p
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4789,6 +5005,7 @@ void GL_APIENTRY GL_TexParameteri(GLenum target, GLenum pname, GLint param)
     EVENT(context, GLTexParameteri, "context = %d, target = %s, pname = %s, param = %d",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::TextureParameterName, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameteri);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4797,6 +5014,7 @@ void GL_APIENTRY GL_TexParameteri(GLenum target, GLenum pname, GLint param)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4830,6 +5048,7 @@ void GL_APIENTRY GL_TexParameteriv(GLenum target, GLenum pname, const GLint *par
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::TextureParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameteriv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4838,6 +5057,7 @@ void GL_APIENTRY GL_TexParameteriv(GLenum target, GLenum pname, const GLint *par
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4881,6 +5101,7 @@ void GL_APIENTRY GL_TexSubImage2D(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, xoffset, yoffset,
           width, height, GLenumToString(GLESEnum::PixelFormat, format),
           GLenumToString(GLESEnum::PixelType, type), (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexSubImage2D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4889,6 +5110,7 @@ void GL_APIENTRY GL_TexSubImage2D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4922,6 +5144,7 @@ void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform1f, "context = %d, location = %d, v0 = %f", CID(context), location, v0);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform1f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4930,6 +5153,7 @@ void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4966,6 +5190,7 @@ void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *val
     EVENT(context, GLUniform1fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform1fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4974,6 +5199,7 @@ void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *val
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5008,6 +5234,7 @@ void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform1i, "context = %d, location = %d, v0 = %d", CID(context), location, v0);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform1i);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5016,6 +5243,7 @@ void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5052,6 +5280,7 @@ void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value
     EVENT(context, GLUniform1iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform1iv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5060,6 +5289,7 @@ void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5095,6 +5325,7 @@ void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform2f, "context = %d, location = %d, v0 = %f, v1 = %f", CID(context),
           location, v0, v1);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform2f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5103,6 +5334,7 @@ void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5139,6 +5371,7 @@ void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *val
     EVENT(context, GLUniform2fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform2fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5147,6 +5380,7 @@ void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *val
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5182,6 +5416,7 @@ void GL_APIENTRY GL_Uniform2i(GLint location, GLint v0, GLint v1)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform2i, "context = %d, location = %d, v0 = %d, v1 = %d", CID(context),
           location, v0, v1);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform2i);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5190,6 +5425,7 @@ void GL_APIENTRY GL_Uniform2i(GLint location, GLint v0, GLint v1)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5226,6 +5462,7 @@ void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value
     EVENT(context, GLUniform2iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform2iv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5234,6 +5471,7 @@ void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5269,6 +5507,7 @@ void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform3f, "context = %d, location = %d, v0 = %f, v1 = %f, v2 = %f",
           CID(context), location, v0, v1, v2);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform3f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5277,6 +5516,7 @@ void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5313,6 +5553,7 @@ void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *val
     EVENT(context, GLUniform3fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform3fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5321,6 +5562,7 @@ void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *val
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5356,6 +5598,7 @@ void GL_APIENTRY GL_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform3i, "context = %d, location = %d, v0 = %d, v1 = %d, v2 = %d",
           CID(context), location, v0, v1, v2);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform3i);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5364,6 +5607,7 @@ void GL_APIENTRY GL_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5400,6 +5644,7 @@ void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value
     EVENT(context, GLUniform3iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform3iv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5408,6 +5653,7 @@ void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5443,6 +5689,7 @@ void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform4f, "context = %d, location = %d, v0 = %f, v1 = %f, v2 = %f, v3 = %f",
           CID(context), location, v0, v1, v2, v3);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform4f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5451,6 +5698,7 @@ void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5487,6 +5735,7 @@ void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *val
     EVENT(context, GLUniform4fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform4fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5495,6 +5744,7 @@ void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *val
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5530,6 +5780,7 @@ void GL_APIENTRY GL_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLin
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform4i, "context = %d, location = %d, v0 = %d, v1 = %d, v2 = %d, v3 = %d",
           CID(context), location, v0, v1, v2, v3);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform4i);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5538,6 +5789,7 @@ void GL_APIENTRY GL_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLin
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5574,6 +5826,7 @@ void GL_APIENTRY GL_Uniform4iv(GLint location, GLsizei count, const GLint *value
     EVENT(context, GLUniform4iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform4iv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5582,6 +5835,7 @@ void GL_APIENTRY GL_Uniform4iv(GLint location, GLsizei count, const GLint *value
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5621,6 +5875,7 @@ void GL_APIENTRY GL_UniformMatrix2fv(GLint location,
     EVENT(context, GLUniformMatrix2fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniformMatrix2fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5629,6 +5884,7 @@ void GL_APIENTRY GL_UniformMatrix2fv(GLint location,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5670,6 +5926,7 @@ void GL_APIENTRY GL_UniformMatrix3fv(GLint location,
     EVENT(context, GLUniformMatrix3fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniformMatrix3fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5678,6 +5935,7 @@ void GL_APIENTRY GL_UniformMatrix3fv(GLint location,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5719,6 +5977,7 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
     EVENT(context, GLUniformMatrix4fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniformMatrix4fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5727,6 +5986,7 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5763,6 +6023,7 @@ void GL_APIENTRY GL_UseProgram(GLuint program)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUseProgram, "context = %d, program = %u", CID(context), program);
+    ANGLE_PROFILE_ENTRY_POINT(GLUseProgram);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5771,6 +6032,7 @@ void GL_APIENTRY GL_UseProgram(GLuint program)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5805,6 +6067,7 @@ void GL_APIENTRY GL_ValidateProgram(GLuint program)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLValidateProgram, "context = %d, program = %u", CID(context), program);
+    ANGLE_PROFILE_ENTRY_POINT(GLValidateProgram);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5813,6 +6076,7 @@ void GL_APIENTRY GL_ValidateProgram(GLuint program)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5847,12 +6111,14 @@ void GL_APIENTRY GL_VertexAttrib1f(GLuint index, GLfloat x)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib1f, "context = %d, index = %u, x = %f", CID(context), index, x);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttrib1f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5890,12 +6156,14 @@ void GL_APIENTRY GL_VertexAttrib1fv(GLuint index, const GLfloat *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib1fv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttrib1fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5933,12 +6201,14 @@ void GL_APIENTRY GL_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib2f, "context = %d, index = %u, x = %f, y = %f", CID(context),
           index, x, y);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttrib2f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5976,12 +6246,14 @@ void GL_APIENTRY GL_VertexAttrib2fv(GLuint index, const GLfloat *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib2fv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttrib2fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6019,12 +6291,14 @@ void GL_APIENTRY GL_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib3f, "context = %d, index = %u, x = %f, y = %f, z = %f",
           CID(context), index, x, y, z);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttrib3f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6062,12 +6336,14 @@ void GL_APIENTRY GL_VertexAttrib3fv(GLuint index, const GLfloat *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib3fv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttrib3fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6105,12 +6381,14 @@ void GL_APIENTRY GL_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib4f, "context = %d, index = %u, x = %f, y = %f, z = %f, w = %f",
           CID(context), index, x, y, z, w);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttrib4f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6148,12 +6426,14 @@ void GL_APIENTRY GL_VertexAttrib4fv(GLuint index, const GLfloat *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib4fv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttrib4fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6199,6 +6479,7 @@ void GL_APIENTRY GL_VertexAttribPointer(GLuint index,
           "0x%016" PRIxPTR "",
           CID(context), index, size, GLenumToString(GLESEnum::VertexAttribPointerType, type),
           GLbooleanToString(normalized), stride, (uintptr_t)pointer);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribPointer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6207,6 +6488,7 @@ void GL_APIENTRY GL_VertexAttribPointer(GLuint index,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_2_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6244,12 +6526,14 @@ void GL_APIENTRY GL_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLViewport, "context = %d, x = %d, y = %d, width = %d, height = %d",
           CID(context), x, y, width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLViewport);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(true))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -30,6 +30,7 @@ void GL_APIENTRY GL_BeginQuery(GLenum target, GLuint id)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBeginQuery, "context = %d, target = %s, id = %u", CID(context),
           GLenumToString(GLESEnum::QueryTarget, target), id);
+    ANGLE_PROFILE_ENTRY_POINT(GLBeginQuery);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -39,6 +40,7 @@ void GL_APIENTRY GL_BeginQuery(GLenum target, GLuint id)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -74,6 +76,7 @@ void GL_APIENTRY GL_BeginTransformFeedback(GLenum primitiveMode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBeginTransformFeedback, "context = %d, primitiveMode = %s", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, primitiveMode));
+    ANGLE_PROFILE_ENTRY_POINT(GLBeginTransformFeedback);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -86,6 +89,7 @@ void GL_APIENTRY GL_BeginTransformFeedback(GLenum primitiveMode)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -121,6 +125,7 @@ void GL_APIENTRY GL_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindBufferBase, "context = %d, target = %s, index = %u, buffer = %u",
           CID(context), GLenumToString(GLESEnum::BufferTargetARB, target), index, buffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindBufferBase);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -130,6 +135,7 @@ void GL_APIENTRY GL_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -177,6 +183,7 @@ GL_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -214,6 +221,7 @@ void GL_APIENTRY GL_BindSampler(GLuint unit, GLuint sampler)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindSampler, "context = %d, unit = %u, sampler = %u", CID(context), unit,
           sampler);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindSampler);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -222,6 +230,7 @@ void GL_APIENTRY GL_BindSampler(GLuint unit, GLuint sampler)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -257,6 +266,7 @@ void GL_APIENTRY GL_BindTransformFeedback(GLenum target, GLuint id)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindTransformFeedback, "context = %d, target = %s, id = %u", CID(context),
           GLenumToString(GLESEnum::BindTransformFeedbackTarget, target), id);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindTransformFeedback);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -265,6 +275,7 @@ void GL_APIENTRY GL_BindTransformFeedback(GLenum target, GLuint id)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -299,6 +310,7 @@ void GL_APIENTRY GL_BindVertexArray(GLuint array)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindVertexArray, "context = %d, array = %u", CID(context), array);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindVertexArray);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -307,6 +319,7 @@ void GL_APIENTRY GL_BindVertexArray(GLuint array)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -355,6 +368,7 @@ void GL_APIENTRY GL_BlitFramebuffer(GLint srcX0,
           CID(context), srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1,
           GLbitfieldToString(GLESEnum::ClearBufferMask, mask).c_str(),
           GLenumToString(GLESEnum::BlitFramebufferFilter, filter));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlitFramebuffer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -366,6 +380,7 @@ void GL_APIENTRY GL_BlitFramebuffer(GLint srcX0,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -405,6 +420,7 @@ void GL_APIENTRY GL_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth
     EVENT(context, GLClearBufferfi,
           "context = %d, buffer = %s, drawbuffer = %d, depth = %f, stencil = %d", CID(context),
           GLenumToString(GLESEnum::Buffer, buffer), drawbuffer, depth, stencil);
+    ANGLE_PROFILE_ENTRY_POINT(GLClearBufferfi);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -412,6 +428,7 @@ void GL_APIENTRY GL_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -448,6 +465,7 @@ void GL_APIENTRY GL_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat
     EVENT(context, GLClearBufferfv,
           "context = %d, buffer = %s, drawbuffer = %d, value = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::Buffer, buffer), drawbuffer, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLClearBufferfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -455,6 +473,7 @@ void GL_APIENTRY GL_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -491,6 +510,7 @@ void GL_APIENTRY GL_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *
     EVENT(context, GLClearBufferiv,
           "context = %d, buffer = %s, drawbuffer = %d, value = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::Buffer, buffer), drawbuffer, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLClearBufferiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -498,6 +518,7 @@ void GL_APIENTRY GL_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -534,6 +555,7 @@ void GL_APIENTRY GL_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint
     EVENT(context, GLClearBufferuiv,
           "context = %d, buffer = %s, drawbuffer = %d, value = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::Buffer, buffer), drawbuffer, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLClearBufferuiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -541,6 +563,7 @@ void GL_APIENTRY GL_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -578,6 +601,7 @@ GLenum GL_APIENTRY GL_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 tim
           "context = %d, sync = 0x%016" PRIxPTR ", flags = %s, timeout = %llu", CID(context),
           (uintptr_t)sync, GLbitfieldToString(GLESEnum::SyncObjectMask, flags).c_str(),
           static_cast<unsigned long long>(timeout));
+    ANGLE_PROFILE_ENTRY_POINT(GLClientWaitSync);
 
     GLenum returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -587,6 +611,7 @@ GLenum GL_APIENTRY GL_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 tim
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -641,6 +666,7 @@ void GL_APIENTRY GL_CompressedTexImage3D(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level,
           GLenumToString(GLESEnum::InternalFormat, internalformat), width, height, depth, border,
           imageSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedTexImage3D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -649,6 +675,7 @@ void GL_APIENTRY GL_CompressedTexImage3D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -701,6 +728,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3D(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, xoffset, yoffset,
           zoffset, width, height, depth, GLenumToString(GLESEnum::InternalFormat, format),
           imageSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedTexSubImage3D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -709,6 +737,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -757,6 +786,7 @@ void GL_APIENTRY GL_CopyBufferSubData(GLenum readTarget,
           GLenumToString(GLESEnum::CopyBufferSubDataTarget, writeTarget),
           static_cast<unsigned long long>(readOffset), static_cast<unsigned long long>(writeOffset),
           static_cast<unsigned long long>(size));
+    ANGLE_PROFILE_ENTRY_POINT(GLCopyBufferSubData);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -766,6 +796,7 @@ void GL_APIENTRY GL_CopyBufferSubData(GLenum readTarget,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -815,6 +846,7 @@ void GL_APIENTRY GL_CopyTexSubImage3D(GLenum target,
           "%d, y = %d, width = %d, height = %d",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, xoffset, yoffset,
           zoffset, x, y, width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLCopyTexSubImage3D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -827,6 +859,7 @@ void GL_APIENTRY GL_CopyTexSubImage3D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -865,6 +898,7 @@ void GL_APIENTRY GL_DeleteQueries(GLsizei n, const GLuint *ids)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteQueries, "context = %d, n = %d, ids = 0x%016" PRIxPTR "", CID(context),
           n, (uintptr_t)ids);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteQueries);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -873,6 +907,7 @@ void GL_APIENTRY GL_DeleteQueries(GLsizei n, const GLuint *ids)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -908,6 +943,7 @@ void GL_APIENTRY GL_DeleteSamplers(GLsizei count, const GLuint *samplers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteSamplers, "context = %d, count = %d, samplers = 0x%016" PRIxPTR "",
           CID(context), count, (uintptr_t)samplers);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteSamplers);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -916,6 +952,7 @@ void GL_APIENTRY GL_DeleteSamplers(GLsizei count, const GLuint *samplers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -951,6 +988,7 @@ void GL_APIENTRY GL_DeleteSync(GLsync sync)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteSync, "context = %d, sync = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)sync);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteSync);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -959,6 +997,7 @@ void GL_APIENTRY GL_DeleteSync(GLsync sync)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -994,6 +1033,7 @@ void GL_APIENTRY GL_DeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteTransformFeedbacks, "context = %d, n = %d, ids = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)ids);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteTransformFeedbacks);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1002,6 +1042,7 @@ void GL_APIENTRY GL_DeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1038,6 +1079,7 @@ void GL_APIENTRY GL_DeleteVertexArrays(GLsizei n, const GLuint *arrays)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteVertexArrays, "context = %d, n = %d, arrays = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)arrays);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteVertexArrays);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1046,6 +1088,7 @@ void GL_APIENTRY GL_DeleteVertexArrays(GLsizei n, const GLuint *arrays)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1085,6 +1128,7 @@ void GL_APIENTRY GL_DrawArraysInstanced(GLenum mode,
     EVENT(context, GLDrawArraysInstanced,
           "context = %d, mode = %s, first = %d, count = %d, instancecount = %d", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, mode), first, count, instancecount);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawArraysInstanced);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1093,6 +1137,7 @@ void GL_APIENTRY GL_DrawArraysInstanced(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1130,6 +1175,7 @@ void GL_APIENTRY GL_DrawBuffers(GLsizei n, const GLenum *bufs)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawBuffers, "context = %d, n = %d, bufs = 0x%016" PRIxPTR "", CID(context), n,
           (uintptr_t)bufs);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawBuffers);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1141,6 +1187,7 @@ void GL_APIENTRY GL_DrawBuffers(GLsizei n, const GLenum *bufs)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1183,6 +1230,7 @@ void GL_APIENTRY GL_DrawElementsInstanced(GLenum mode,
           ", instancecount = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, instancecount);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsInstanced);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1192,6 +1240,7 @@ void GL_APIENTRY GL_DrawElementsInstanced(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1237,6 +1286,7 @@ void GL_APIENTRY GL_DrawRangeElements(GLenum mode,
           "0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), start, end, count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawRangeElements);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1246,6 +1296,7 @@ void GL_APIENTRY GL_DrawRangeElements(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1283,6 +1334,7 @@ void GL_APIENTRY GL_EndQuery(GLenum target)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndQuery, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::QueryTarget, target));
+    ANGLE_PROFILE_ENTRY_POINT(GLEndQuery);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1291,6 +1343,7 @@ void GL_APIENTRY GL_EndQuery(GLenum target)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1325,6 +1378,7 @@ void GL_APIENTRY GL_EndTransformFeedback()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndTransformFeedback, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLEndTransformFeedback);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1332,6 +1386,7 @@ void GL_APIENTRY GL_EndTransformFeedback()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1368,6 +1423,7 @@ GLsync GL_APIENTRY GL_FenceSync(GLenum condition, GLbitfield flags)
     EVENT(context, GLFenceSync, "context = %d, condition = %s, flags = %s", CID(context),
           GLenumToString(GLESEnum::SyncCondition, condition),
           GLbitfieldToString(GLESEnum::SyncBehaviorFlags, flags).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLFenceSync);
 
     GLsync returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -1376,6 +1432,7 @@ GLsync GL_APIENTRY GL_FenceSync(GLenum condition, GLbitfield flags)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1419,6 +1476,7 @@ void GL_APIENTRY GL_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsiz
           "context = %d, target = %s, offset = %llu, length = %llu", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target),
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(length));
+    ANGLE_PROFILE_ENTRY_POINT(GLFlushMappedBufferRange);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1427,6 +1485,7 @@ void GL_APIENTRY GL_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsiz
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1470,6 +1529,7 @@ void GL_APIENTRY GL_FramebufferTextureLayer(GLenum target,
           "context = %d, target = %s, attachment = %s, texture = %u, level = %d, layer = %d",
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment), texture, level, layer);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferTextureLayer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1482,6 +1542,7 @@ void GL_APIENTRY GL_FramebufferTextureLayer(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1520,6 +1581,7 @@ void GL_APIENTRY GL_GenQueries(GLsizei n, GLuint *ids)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenQueries, "context = %d, n = %d, ids = 0x%016" PRIxPTR "", CID(context), n,
           (uintptr_t)ids);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenQueries);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1528,6 +1590,7 @@ void GL_APIENTRY GL_GenQueries(GLsizei n, GLuint *ids)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1563,6 +1626,7 @@ void GL_APIENTRY GL_GenSamplers(GLsizei count, GLuint *samplers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenSamplers, "context = %d, count = %d, samplers = 0x%016" PRIxPTR "",
           CID(context), count, (uintptr_t)samplers);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenSamplers);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1571,6 +1635,7 @@ void GL_APIENTRY GL_GenSamplers(GLsizei count, GLuint *samplers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1606,6 +1671,7 @@ void GL_APIENTRY GL_GenTransformFeedbacks(GLsizei n, GLuint *ids)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenTransformFeedbacks, "context = %d, n = %d, ids = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)ids);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenTransformFeedbacks);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1614,6 +1680,7 @@ void GL_APIENTRY GL_GenTransformFeedbacks(GLsizei n, GLuint *ids)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1649,6 +1716,7 @@ void GL_APIENTRY GL_GenVertexArrays(GLsizei n, GLuint *arrays)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenVertexArrays, "context = %d, n = %d, arrays = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)arrays);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenVertexArrays);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1656,6 +1724,7 @@ void GL_APIENTRY GL_GenVertexArrays(GLsizei n, GLuint *arrays)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1701,6 +1770,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockName(GLuint program,
         ", uniformBlockName = 0x%016" PRIxPTR "",
         CID(context), program, uniformBlockIndex, bufSize, (uintptr_t)length,
         (uintptr_t)uniformBlockName);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetActiveUniformBlockName);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1710,6 +1780,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockName(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1755,6 +1826,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockiv(GLuint program,
           "",
           CID(context), program, uniformBlockIndex,
           GLenumToString(GLESEnum::UniformBlockPName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetActiveUniformBlockiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1764,6 +1836,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockiv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1809,6 +1882,7 @@ void GL_APIENTRY GL_GetActiveUniformsiv(GLuint program,
           ", pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), program, uniformCount, (uintptr_t)uniformIndices,
           GLenumToString(GLESEnum::UniformPName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetActiveUniformsiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1817,6 +1891,7 @@ void GL_APIENTRY GL_GetActiveUniformsiv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1857,6 +1932,7 @@ void GL_APIENTRY GL_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target),
           GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBufferParameteri64v);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1865,6 +1941,7 @@ void GL_APIENTRY GL_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1903,6 +1980,7 @@ void GL_APIENTRY GL_GetBufferPointerv(GLenum target, GLenum pname, void **params
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target),
           GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBufferPointerv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1911,6 +1989,7 @@ void GL_APIENTRY GL_GetBufferPointerv(GLenum target, GLenum pname, void **params
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1946,6 +2025,7 @@ GLint GL_APIENTRY GL_GetFragDataLocation(GLuint program, const GLchar *name)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFragDataLocation, "context = %d, program = %u, name = 0x%016" PRIxPTR "",
           CID(context), program, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFragDataLocation);
 
     GLint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -1955,6 +2035,7 @@ GLint GL_APIENTRY GL_GetFragDataLocation(GLuint program, const GLchar *name)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1998,6 +2079,7 @@ void GL_APIENTRY GL_GetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
     EVENT(context, GLGetInteger64i_v,
           "context = %d, target = %s, index = %u, data = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::GetPName, target), index, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetInteger64i_v);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2005,6 +2087,7 @@ void GL_APIENTRY GL_GetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2040,6 +2123,7 @@ void GL_APIENTRY GL_GetInteger64v(GLenum pname, GLint64 *data)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetInteger64v, "context = %d, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetInteger64v);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2047,6 +2131,7 @@ void GL_APIENTRY GL_GetInteger64v(GLenum pname, GLint64 *data)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2083,6 +2168,7 @@ void GL_APIENTRY GL_GetIntegeri_v(GLenum target, GLuint index, GLint *data)
     EVENT(context, GLGetIntegeri_v,
           "context = %d, target = %s, index = %u, data = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::GetPName, target), index, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetIntegeri_v);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2090,6 +2176,7 @@ void GL_APIENTRY GL_GetIntegeri_v(GLenum target, GLuint index, GLint *data)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2133,6 +2220,7 @@ void GL_APIENTRY GL_GetInternalformativ(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::InternalFormat, internalformat),
           GLenumToString(GLESEnum::InternalFormatPName, pname), count, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetInternalformativ);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2140,6 +2228,7 @@ void GL_APIENTRY GL_GetInternalformativ(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2184,6 +2273,7 @@ void GL_APIENTRY GL_GetProgramBinary(GLuint program,
           ", binaryFormat = 0x%016" PRIxPTR ", binary = 0x%016" PRIxPTR "",
           CID(context), program, bufSize, (uintptr_t)length, (uintptr_t)binaryFormat,
           (uintptr_t)binary);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramBinary);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2192,6 +2282,7 @@ void GL_APIENTRY GL_GetProgramBinary(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2230,6 +2321,7 @@ void GL_APIENTRY GL_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
     EVENT(context, GLGetQueryObjectuiv,
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
           GLenumToString(GLESEnum::QueryObjectParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryObjectuiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2238,6 +2330,7 @@ void GL_APIENTRY GL_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2274,6 +2367,7 @@ void GL_APIENTRY GL_GetQueryiv(GLenum target, GLenum pname, GLint *params)
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::QueryTarget, target),
           GLenumToString(GLESEnum::QueryParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2282,6 +2376,7 @@ void GL_APIENTRY GL_GetQueryiv(GLenum target, GLenum pname, GLint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2318,6 +2413,7 @@ void GL_APIENTRY GL_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat
     EVENT(context, GLGetSamplerParameterfv,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterF, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2326,6 +2422,7 @@ void GL_APIENTRY GL_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2363,6 +2460,7 @@ void GL_APIENTRY GL_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *p
     EVENT(context, GLGetSamplerParameteriv,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameteriv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2371,6 +2469,7 @@ void GL_APIENTRY GL_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *p
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2407,6 +2506,7 @@ const GLubyte *GL_APIENTRY GL_GetStringi(GLenum name, GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetStringi, "context = %d, name = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::StringName, name), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetStringi);
 
     const GLubyte *returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -2415,6 +2515,7 @@ const GLubyte *GL_APIENTRY GL_GetStringi(GLenum name, GLuint index)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2468,6 +2569,7 @@ GL_GetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *v
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2511,6 +2613,7 @@ void GL_APIENTRY GL_GetTransformFeedbackVarying(GLuint program,
           ", size = 0x%016" PRIxPTR ", type = 0x%016" PRIxPTR ", name = 0x%016" PRIxPTR "",
           CID(context), program, index, bufSize, (uintptr_t)length, (uintptr_t)size,
           (uintptr_t)type, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTransformFeedbackVarying);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2519,6 +2622,7 @@ void GL_APIENTRY GL_GetTransformFeedbackVarying(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2559,6 +2663,7 @@ GLuint GL_APIENTRY GL_GetUniformBlockIndex(GLuint program, const GLchar *uniform
     EVENT(context, GLGetUniformBlockIndex,
           "context = %d, program = %u, uniformBlockName = 0x%016" PRIxPTR "", CID(context), program,
           (uintptr_t)uniformBlockName);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUniformBlockIndex);
 
     GLuint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -2568,6 +2673,7 @@ GLuint GL_APIENTRY GL_GetUniformBlockIndex(GLuint program, const GLchar *uniform
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2617,6 +2723,7 @@ void GL_APIENTRY GL_GetUniformIndices(GLuint program,
           "context = %d, program = %u, uniformCount = %d, uniformNames = 0x%016" PRIxPTR
           ", uniformIndices = 0x%016" PRIxPTR "",
           CID(context), program, uniformCount, (uintptr_t)uniformNames, (uintptr_t)uniformIndices);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUniformIndices);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2625,6 +2732,7 @@ void GL_APIENTRY GL_GetUniformIndices(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2663,6 +2771,7 @@ void GL_APIENTRY GL_GetUniformuiv(GLuint program, GLint location, GLuint *params
     EVENT(context, GLGetUniformuiv,
           "context = %d, program = %u, location = %d, params = 0x%016" PRIxPTR "", CID(context),
           program, location, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUniformuiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2672,6 +2781,7 @@ void GL_APIENTRY GL_GetUniformuiv(GLuint program, GLint location, GLuint *params
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2709,6 +2819,7 @@ void GL_APIENTRY GL_GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params
     EVENT(context, GLGetVertexAttribIiv,
           "context = %d, index = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), index,
           GLenumToString(GLESEnum::VertexAttribEnum, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetVertexAttribIiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2716,6 +2827,7 @@ void GL_APIENTRY GL_GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2752,6 +2864,7 @@ void GL_APIENTRY GL_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *para
     EVENT(context, GLGetVertexAttribIuiv,
           "context = %d, index = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), index,
           GLenumToString(GLESEnum::VertexAttribEnum, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetVertexAttribIuiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2759,6 +2872,7 @@ void GL_APIENTRY GL_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *para
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2798,6 +2912,7 @@ void GL_APIENTRY GL_InvalidateFramebuffer(GLenum target,
           "context = %d, target = %s, numAttachments = %d, attachments = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target), numAttachments,
           (uintptr_t)attachments);
+    ANGLE_PROFILE_ENTRY_POINT(GLInvalidateFramebuffer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2809,6 +2924,7 @@ void GL_APIENTRY GL_InvalidateFramebuffer(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2855,6 +2971,7 @@ void GL_APIENTRY GL_InvalidateSubFramebuffer(GLenum target,
           ", x = %d, y = %d, width = %d, height = %d",
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target), numAttachments,
           (uintptr_t)attachments, x, y, width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLInvalidateSubFramebuffer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2866,6 +2983,7 @@ void GL_APIENTRY GL_InvalidateSubFramebuffer(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2904,6 +3022,7 @@ GLboolean GL_APIENTRY GL_IsQuery(GLuint id)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsQuery, "context = %d, id = %u", CID(context), id);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsQuery);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -2913,6 +3032,7 @@ GLboolean GL_APIENTRY GL_IsQuery(GLuint id)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2952,6 +3072,7 @@ GLboolean GL_APIENTRY GL_IsSampler(GLuint sampler)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsSampler, "context = %d, sampler = %u", CID(context), sampler);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsSampler);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -2961,6 +3082,7 @@ GLboolean GL_APIENTRY GL_IsSampler(GLuint sampler)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3002,6 +3124,7 @@ GLboolean GL_APIENTRY GL_IsSync(GLsync sync)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsSync, "context = %d, sync = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)sync);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsSync);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3011,6 +3134,7 @@ GLboolean GL_APIENTRY GL_IsSync(GLsync sync)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3050,6 +3174,7 @@ GLboolean GL_APIENTRY GL_IsTransformFeedback(GLuint id)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsTransformFeedback, "context = %d, id = %u", CID(context), id);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsTransformFeedback);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3059,6 +3184,7 @@ GLboolean GL_APIENTRY GL_IsTransformFeedback(GLuint id)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3100,6 +3226,7 @@ GLboolean GL_APIENTRY GL_IsVertexArray(GLuint array)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsVertexArray, "context = %d, array = %u", CID(context), array);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsVertexArray);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3108,6 +3235,7 @@ GLboolean GL_APIENTRY GL_IsVertexArray(GLuint array)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3158,6 +3286,7 @@ void *GL_APIENTRY GL_MapBufferRange(GLenum target,
           GLenumToString(GLESEnum::BufferTargetARB, target),
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(length),
           GLbitfieldToString(GLESEnum::MapBufferAccessMask, access).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLMapBufferRange);
 
     void *returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -3167,6 +3296,7 @@ void *GL_APIENTRY GL_MapBufferRange(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3208,6 +3338,7 @@ void GL_APIENTRY GL_PauseTransformFeedback()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPauseTransformFeedback, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLPauseTransformFeedback);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3215,6 +3346,7 @@ void GL_APIENTRY GL_PauseTransformFeedback()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3255,6 +3387,7 @@ void GL_APIENTRY GL_ProgramBinary(GLuint program,
           "context = %d, program = %u, binaryFormat = %s, binary = 0x%016" PRIxPTR ", length = %d",
           CID(context), program, GLenumToString(GLESEnum::AllEnums, binaryFormat),
           (uintptr_t)binary, length);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramBinary);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3263,6 +3396,7 @@ void GL_APIENTRY GL_ProgramBinary(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3299,6 +3433,7 @@ void GL_APIENTRY GL_ProgramParameteri(GLuint program, GLenum pname, GLint value)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramParameteri, "context = %d, program = %u, pname = %s, value = %d",
           CID(context), program, GLenumToString(GLESEnum::ProgramParameterPName, pname), value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramParameteri);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3307,6 +3442,7 @@ void GL_APIENTRY GL_ProgramParameteri(GLuint program, GLenum pname, GLint value)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3342,6 +3478,7 @@ void GL_APIENTRY GL_ReadBuffer(GLenum src)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReadBuffer, "context = %d, src = %s", CID(context),
           GLenumToString(GLESEnum::ReadBufferMode, src));
+    ANGLE_PROFILE_ENTRY_POINT(GLReadBuffer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3349,6 +3486,7 @@ void GL_APIENTRY GL_ReadBuffer(GLenum src)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3389,6 +3527,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisample(GLenum target,
           "context = %d, target = %s, samples = %d, internalformat = %s, width = %d, height = %d",
           CID(context), GLenumToString(GLESEnum::RenderbufferTarget, target), samples,
           GLenumToString(GLESEnum::InternalFormat, internalformat), width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLRenderbufferStorageMultisample);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3396,6 +3535,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisample(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3434,6 +3574,7 @@ void GL_APIENTRY GL_ResumeTransformFeedback()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLResumeTransformFeedback, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLResumeTransformFeedback);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3441,6 +3582,7 @@ void GL_APIENTRY GL_ResumeTransformFeedback()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3477,6 +3619,7 @@ void GL_APIENTRY GL_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat para
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterf, "context = %d, sampler = %u, pname = %s, param = %f",
           CID(context), sampler, GLenumToString(GLESEnum::SamplerParameterF, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterf);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3485,6 +3628,7 @@ void GL_APIENTRY GL_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat para
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3521,6 +3665,7 @@ void GL_APIENTRY GL_SamplerParameterfv(GLuint sampler, GLenum pname, const GLflo
     EVENT(context, GLSamplerParameterfv,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterF, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3529,6 +3674,7 @@ void GL_APIENTRY GL_SamplerParameterfv(GLuint sampler, GLenum pname, const GLflo
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3564,6 +3710,7 @@ void GL_APIENTRY GL_SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameteri, "context = %d, sampler = %u, pname = %s, param = %d",
           CID(context), sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameteri);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3572,6 +3719,7 @@ void GL_APIENTRY GL_SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3608,6 +3756,7 @@ void GL_APIENTRY GL_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint
     EVENT(context, GLSamplerParameteriv,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameteriv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3616,6 +3765,7 @@ void GL_APIENTRY GL_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3664,6 +3814,7 @@ void GL_APIENTRY GL_TexImage3D(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, internalformat,
           width, height, depth, border, GLenumToString(GLESEnum::PixelFormat, format),
           GLenumToString(GLESEnum::PixelType, type), (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexImage3D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3672,6 +3823,7 @@ void GL_APIENTRY GL_TexImage3D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3721,6 +3873,7 @@ GL_TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei wi
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3766,6 +3919,7 @@ void GL_APIENTRY GL_TexStorage3D(GLenum target,
           "depth = %d",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), levels,
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), width, height, depth);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorage3D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3774,6 +3928,7 @@ void GL_APIENTRY GL_TexStorage3D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3825,6 +3980,7 @@ void GL_APIENTRY GL_TexSubImage3D(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, xoffset, yoffset,
           zoffset, width, height, depth, GLenumToString(GLESEnum::PixelFormat, format),
           GLenumToString(GLESEnum::PixelType, type), (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexSubImage3D);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3833,6 +3989,7 @@ void GL_APIENTRY GL_TexSubImage3D(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3876,6 +4033,7 @@ void GL_APIENTRY GL_TransformFeedbackVaryings(GLuint program,
           "context = %d, program = %u, count = %d, varyings = 0x%016" PRIxPTR ", bufferMode = %s",
           CID(context), program, count, (uintptr_t)varyings,
           GLenumToString(GLESEnum::TransformFeedbackBufferMode, bufferMode));
+    ANGLE_PROFILE_ENTRY_POINT(GLTransformFeedbackVaryings);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3884,6 +4042,7 @@ void GL_APIENTRY GL_TransformFeedbackVaryings(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3922,6 +4081,7 @@ void GL_APIENTRY GL_Uniform1ui(GLint location, GLuint v0)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform1ui, "context = %d, location = %d, v0 = %u", CID(context), location,
           v0);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform1ui);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3930,6 +4090,7 @@ void GL_APIENTRY GL_Uniform1ui(GLint location, GLuint v0)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3966,6 +4127,7 @@ void GL_APIENTRY GL_Uniform1uiv(GLint location, GLsizei count, const GLuint *val
     EVENT(context, GLUniform1uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform1uiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3974,6 +4136,7 @@ void GL_APIENTRY GL_Uniform1uiv(GLint location, GLsizei count, const GLuint *val
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4009,6 +4172,7 @@ void GL_APIENTRY GL_Uniform2ui(GLint location, GLuint v0, GLuint v1)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform2ui, "context = %d, location = %d, v0 = %u, v1 = %u", CID(context),
           location, v0, v1);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform2ui);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4017,6 +4181,7 @@ void GL_APIENTRY GL_Uniform2ui(GLint location, GLuint v0, GLuint v1)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4053,6 +4218,7 @@ void GL_APIENTRY GL_Uniform2uiv(GLint location, GLsizei count, const GLuint *val
     EVENT(context, GLUniform2uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform2uiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4061,6 +4227,7 @@ void GL_APIENTRY GL_Uniform2uiv(GLint location, GLsizei count, const GLuint *val
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4096,6 +4263,7 @@ void GL_APIENTRY GL_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform3ui, "context = %d, location = %d, v0 = %u, v1 = %u, v2 = %u",
           CID(context), location, v0, v1, v2);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform3ui);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4104,6 +4272,7 @@ void GL_APIENTRY GL_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4140,6 +4309,7 @@ void GL_APIENTRY GL_Uniform3uiv(GLint location, GLsizei count, const GLuint *val
     EVENT(context, GLUniform3uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform3uiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4148,6 +4318,7 @@ void GL_APIENTRY GL_Uniform3uiv(GLint location, GLsizei count, const GLuint *val
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4183,6 +4354,7 @@ void GL_APIENTRY GL_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2,
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform4ui, "context = %d, location = %d, v0 = %u, v1 = %u, v2 = %u, v3 = %u",
           CID(context), location, v0, v1, v2, v3);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform4ui);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4191,6 +4363,7 @@ void GL_APIENTRY GL_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4227,6 +4400,7 @@ void GL_APIENTRY GL_Uniform4uiv(GLint location, GLsizei count, const GLuint *val
     EVENT(context, GLUniform4uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniform4uiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4235,6 +4409,7 @@ void GL_APIENTRY GL_Uniform4uiv(GLint location, GLsizei count, const GLuint *val
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4273,6 +4448,7 @@ void GL_APIENTRY GL_UniformBlockBinding(GLuint program,
     EVENT(context, GLUniformBlockBinding,
           "context = %d, program = %u, uniformBlockIndex = %u, uniformBlockBinding = %u",
           CID(context), program, uniformBlockIndex, uniformBlockBinding);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniformBlockBinding);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4282,6 +4458,7 @@ void GL_APIENTRY GL_UniformBlockBinding(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4324,6 +4501,7 @@ void GL_APIENTRY GL_UniformMatrix2x3fv(GLint location,
     EVENT(context, GLUniformMatrix2x3fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniformMatrix2x3fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4332,6 +4510,7 @@ void GL_APIENTRY GL_UniformMatrix2x3fv(GLint location,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4373,6 +4552,7 @@ void GL_APIENTRY GL_UniformMatrix2x4fv(GLint location,
     EVENT(context, GLUniformMatrix2x4fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniformMatrix2x4fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4381,6 +4561,7 @@ void GL_APIENTRY GL_UniformMatrix2x4fv(GLint location,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4422,6 +4603,7 @@ void GL_APIENTRY GL_UniformMatrix3x2fv(GLint location,
     EVENT(context, GLUniformMatrix3x2fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniformMatrix3x2fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4430,6 +4612,7 @@ void GL_APIENTRY GL_UniformMatrix3x2fv(GLint location,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4471,6 +4654,7 @@ void GL_APIENTRY GL_UniformMatrix3x4fv(GLint location,
     EVENT(context, GLUniformMatrix3x4fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniformMatrix3x4fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4479,6 +4663,7 @@ void GL_APIENTRY GL_UniformMatrix3x4fv(GLint location,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4520,6 +4705,7 @@ void GL_APIENTRY GL_UniformMatrix4x2fv(GLint location,
     EVENT(context, GLUniformMatrix4x2fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniformMatrix4x2fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4528,6 +4714,7 @@ void GL_APIENTRY GL_UniformMatrix4x2fv(GLint location,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4569,6 +4756,7 @@ void GL_APIENTRY GL_UniformMatrix4x3fv(GLint location,
     EVENT(context, GLUniformMatrix4x3fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLUniformMatrix4x3fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4577,6 +4765,7 @@ void GL_APIENTRY GL_UniformMatrix4x3fv(GLint location,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4614,6 +4803,7 @@ GLboolean GL_APIENTRY GL_UnmapBuffer(GLenum target)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUnmapBuffer, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target));
+    ANGLE_PROFILE_ENTRY_POINT(GLUnmapBuffer);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -4623,6 +4813,7 @@ GLboolean GL_APIENTRY GL_UnmapBuffer(GLenum target)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4664,12 +4855,14 @@ void GL_APIENTRY GL_VertexAttribDivisor(GLuint index, GLuint divisor)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribDivisor, "context = %d, index = %u, divisor = %u", CID(context),
           index, divisor);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribDivisor);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4708,12 +4901,14 @@ void GL_APIENTRY GL_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLi
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribI4i, "context = %d, index = %u, x = %d, y = %d, z = %d, w = %d",
           CID(context), index, x, y, z, w);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribI4i);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4752,12 +4947,14 @@ void GL_APIENTRY GL_VertexAttribI4iv(GLuint index, const GLint *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribI4iv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribI4iv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4795,12 +4992,14 @@ void GL_APIENTRY GL_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z,
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribI4ui, "context = %d, index = %u, x = %u, y = %u, z = %u, w = %u",
           CID(context), index, x, y, z, w);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribI4ui);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4839,12 +5038,14 @@ void GL_APIENTRY GL_VertexAttribI4uiv(GLuint index, const GLuint *v)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribI4uiv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribI4uiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4894,6 +5095,7 @@ GL_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, c
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4933,6 +5135,7 @@ void GL_APIENTRY GL_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
           CID(context), (uintptr_t)sync,
           GLbitfieldToString(GLESEnum::SyncBehaviorFlags, flags).c_str(),
           static_cast<unsigned long long>(timeout));
+    ANGLE_PROFILE_ENTRY_POINT(GLWaitSync);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4941,6 +5144,7 @@ void GL_APIENTRY GL_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_0))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -30,6 +30,7 @@ void GL_APIENTRY GL_ActiveShaderProgram(GLuint pipeline, GLuint program)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLActiveShaderProgram, "context = %d, pipeline = %u, program = %u", CID(context),
           pipeline, program);
+    ANGLE_PROFILE_ENTRY_POINT(GLActiveShaderProgram);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -39,6 +40,7 @@ void GL_APIENTRY GL_ActiveShaderProgram(GLuint pipeline, GLuint program)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -85,6 +87,7 @@ void GL_APIENTRY GL_BindImageTexture(GLuint unit,
           CID(context), unit, texture, level, GLbooleanToString(layered), layer,
           GLenumToString(GLESEnum::BufferAccessARB, access),
           GLenumToString(GLESEnum::InternalFormat, format));
+    ANGLE_PROFILE_ENTRY_POINT(GLBindImageTexture);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -93,6 +96,7 @@ void GL_APIENTRY GL_BindImageTexture(GLuint unit,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -129,6 +133,7 @@ void GL_APIENTRY GL_BindProgramPipeline(GLuint pipeline)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindProgramPipeline, "context = %d, pipeline = %u", CID(context), pipeline);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindProgramPipeline);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -137,6 +142,7 @@ void GL_APIENTRY GL_BindProgramPipeline(GLuint pipeline)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -176,6 +182,7 @@ void GL_APIENTRY GL_BindVertexBuffer(GLuint bindingindex,
     EVENT(context, GLBindVertexBuffer,
           "context = %d, bindingindex = %u, buffer = %u, offset = %llu, stride = %d", CID(context),
           bindingindex, buffer, static_cast<unsigned long long>(offset), stride);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindVertexBuffer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -184,6 +191,7 @@ void GL_APIENTRY GL_BindVertexBuffer(GLuint bindingindex,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -222,6 +230,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramv(GLenum type, GLsizei count, const GLc
     EVENT(context, GLCreateShaderProgramv,
           "context = %d, type = %s, count = %d, strings = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::ShaderType, type), count, (uintptr_t)strings);
+    ANGLE_PROFILE_ENTRY_POINT(GLCreateShaderProgramv);
 
     GLuint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -231,6 +240,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramv(GLenum type, GLsizei count, const GLc
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -274,6 +284,7 @@ void GL_APIENTRY GL_DeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteProgramPipelines, "context = %d, n = %d, pipelines = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)pipelines);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteProgramPipelines);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -282,6 +293,7 @@ void GL_APIENTRY GL_DeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -318,6 +330,7 @@ void GL_APIENTRY GL_DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GL
     EVENT(context, GLDispatchCompute,
           "context = %d, num_groups_x = %u, num_groups_y = %u, num_groups_z = %u", CID(context),
           num_groups_x, num_groups_y, num_groups_z);
+    ANGLE_PROFILE_ENTRY_POINT(GLDispatchCompute);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -325,6 +338,7 @@ void GL_APIENTRY GL_DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GL
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -361,6 +375,7 @@ void GL_APIENTRY GL_DispatchComputeIndirect(GLintptr indirect)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDispatchComputeIndirect, "context = %d, indirect = %llu", CID(context),
           static_cast<unsigned long long>(indirect));
+    ANGLE_PROFILE_ENTRY_POINT(GLDispatchComputeIndirect);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -368,6 +383,7 @@ void GL_APIENTRY GL_DispatchComputeIndirect(GLintptr indirect)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -404,6 +420,7 @@ void GL_APIENTRY GL_DrawArraysIndirect(GLenum mode, const void *indirect)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawArraysIndirect, "context = %d, mode = %s, indirect = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)indirect);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawArraysIndirect);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -412,6 +429,7 @@ void GL_APIENTRY GL_DrawArraysIndirect(GLenum mode, const void *indirect)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -449,6 +467,7 @@ void GL_APIENTRY GL_DrawElementsIndirect(GLenum mode, GLenum type, const void *i
           "context = %d, mode = %s, type = %s, indirect = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, mode),
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indirect);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsIndirect);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -458,6 +477,7 @@ void GL_APIENTRY GL_DrawElementsIndirect(GLenum mode, GLenum type, const void *i
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -496,6 +516,7 @@ void GL_APIENTRY GL_FramebufferParameteri(GLenum target, GLenum pname, GLint par
     EVENT(context, GLFramebufferParameteri, "context = %d, target = %s, pname = %s, param = %d",
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferParameterName, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferParameteri);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -507,6 +528,7 @@ void GL_APIENTRY GL_FramebufferParameteri(GLenum target, GLenum pname, GLint par
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -542,6 +564,7 @@ void GL_APIENTRY GL_GenProgramPipelines(GLsizei n, GLuint *pipelines)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenProgramPipelines, "context = %d, n = %d, pipelines = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)pipelines);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenProgramPipelines);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -550,6 +573,7 @@ void GL_APIENTRY GL_GenProgramPipelines(GLsizei n, GLuint *pipelines)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -586,6 +610,7 @@ void GL_APIENTRY GL_GetBooleani_v(GLenum target, GLuint index, GLboolean *data)
     EVENT(context, GLGetBooleani_v,
           "context = %d, target = %s, index = %u, data = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target), index, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBooleani_v);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -593,6 +618,7 @@ void GL_APIENTRY GL_GetBooleani_v(GLenum target, GLuint index, GLboolean *data)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -630,6 +656,7 @@ void GL_APIENTRY GL_GetFramebufferParameteriv(GLenum target, GLenum pname, GLint
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachmentParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFramebufferParameteriv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -637,6 +664,7 @@ void GL_APIENTRY GL_GetFramebufferParameteriv(GLenum target, GLenum pname, GLint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -674,6 +702,7 @@ void GL_APIENTRY GL_GetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
     EVENT(context, GLGetMultisamplefv,
           "context = %d, pname = %s, index = %u, val = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::AllEnums, pname), index, (uintptr_t)val);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetMultisamplefv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -681,6 +710,7 @@ void GL_APIENTRY GL_GetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -722,6 +752,7 @@ void GL_APIENTRY GL_GetProgramInterfaceiv(GLuint program,
           "",
           CID(context), program, GLenumToString(GLESEnum::ProgramInterface, programInterface),
           GLenumToString(GLESEnum::ProgramInterfacePName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramInterfaceiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -730,6 +761,7 @@ void GL_APIENTRY GL_GetProgramInterfaceiv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -772,6 +804,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLog(GLuint pipeline,
           "context = %d, pipeline = %u, bufSize = %d, length = 0x%016" PRIxPTR
           ", infoLog = 0x%016" PRIxPTR "",
           CID(context), pipeline, bufSize, (uintptr_t)length, (uintptr_t)infoLog);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramPipelineInfoLog);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -780,6 +813,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLog(GLuint pipeline,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -819,6 +853,7 @@ void GL_APIENTRY GL_GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *p
     EVENT(context, GLGetProgramPipelineiv,
           "context = %d, pipeline = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           pipeline, GLenumToString(GLESEnum::PipelineParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramPipelineiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -827,6 +862,7 @@ void GL_APIENTRY GL_GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *p
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -867,6 +903,7 @@ GLuint GL_APIENTRY GL_GetProgramResourceIndex(GLuint program,
           "context = %d, program = %u, programInterface = %s, name = 0x%016" PRIxPTR "",
           CID(context), program, GLenumToString(GLESEnum::ProgramInterface, programInterface),
           (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramResourceIndex);
 
     GLuint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -876,6 +913,7 @@ GLuint GL_APIENTRY GL_GetProgramResourceIndex(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -925,6 +963,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocation(GLuint program,
           "context = %d, program = %u, programInterface = %s, name = 0x%016" PRIxPTR "",
           CID(context), program, GLenumToString(GLESEnum::ProgramInterface, programInterface),
           (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramResourceLocation);
 
     GLint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -934,6 +973,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocation(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -989,6 +1029,7 @@ void GL_APIENTRY GL_GetProgramResourceName(GLuint program,
           "0x%016" PRIxPTR ", name = 0x%016" PRIxPTR "",
           CID(context), program, GLenumToString(GLESEnum::ProgramInterface, programInterface),
           index, bufSize, (uintptr_t)length, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramResourceName);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -997,6 +1038,7 @@ void GL_APIENTRY GL_GetProgramResourceName(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1045,6 +1087,7 @@ void GL_APIENTRY GL_GetProgramResourceiv(GLuint program,
           "0x%016" PRIxPTR ", count = %d, length = 0x%016" PRIxPTR ", params = 0x%016" PRIxPTR "",
           CID(context), program, GLenumToString(GLESEnum::ProgramInterface, programInterface),
           index, propCount, (uintptr_t)props, count, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramResourceiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1053,6 +1096,7 @@ void GL_APIENTRY GL_GetProgramResourceiv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1096,6 +1140,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfv(GLenum target,
           "context = %d, target = %s, level = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level,
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexLevelParameterfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1104,6 +1149,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfv(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1143,6 +1189,7 @@ void GL_APIENTRY GL_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pn
           "context = %d, target = %s, level = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level,
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexLevelParameteriv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1151,6 +1198,7 @@ void GL_APIENTRY GL_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pn
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1187,6 +1235,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipeline(GLuint pipeline)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsProgramPipeline, "context = %d, pipeline = %u", CID(context), pipeline);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsProgramPipeline);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -1196,6 +1245,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipeline(GLuint pipeline)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1238,6 +1288,7 @@ void GL_APIENTRY GL_MemoryBarrier(GLbitfield barriers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMemoryBarrier, "context = %d, barriers = %s", CID(context),
           GLbitfieldToString(GLESEnum::MemoryBarrierMask, barriers).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLMemoryBarrier);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1245,6 +1296,7 @@ void GL_APIENTRY GL_MemoryBarrier(GLbitfield barriers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1280,6 +1332,7 @@ void GL_APIENTRY GL_MemoryBarrierByRegion(GLbitfield barriers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMemoryBarrierByRegion, "context = %d, barriers = %s", CID(context),
           GLbitfieldToString(GLESEnum::MemoryBarrierMask, barriers).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLMemoryBarrierByRegion);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1287,6 +1340,7 @@ void GL_APIENTRY GL_MemoryBarrierByRegion(GLbitfield barriers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1322,6 +1376,7 @@ void GL_APIENTRY GL_ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1f, "context = %d, program = %u, location = %d, v0 = %f",
           CID(context), program, location, v0);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1331,6 +1386,7 @@ void GL_APIENTRY GL_ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1371,6 +1427,7 @@ void GL_APIENTRY GL_ProgramUniform1fv(GLuint program,
     EVENT(context, GLProgramUniform1fv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1380,6 +1437,7 @@ void GL_APIENTRY GL_ProgramUniform1fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1417,6 +1475,7 @@ void GL_APIENTRY GL_ProgramUniform1i(GLuint program, GLint location, GLint v0)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1i, "context = %d, program = %u, location = %d, v0 = %d",
           CID(context), program, location, v0);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1i);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1426,6 +1485,7 @@ void GL_APIENTRY GL_ProgramUniform1i(GLuint program, GLint location, GLint v0)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1466,6 +1526,7 @@ void GL_APIENTRY GL_ProgramUniform1iv(GLuint program,
     EVENT(context, GLProgramUniform1iv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1iv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1475,6 +1536,7 @@ void GL_APIENTRY GL_ProgramUniform1iv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1512,6 +1574,7 @@ void GL_APIENTRY GL_ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1ui, "context = %d, program = %u, location = %d, v0 = %u",
           CID(context), program, location, v0);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1ui);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1521,6 +1584,7 @@ void GL_APIENTRY GL_ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1562,6 +1626,7 @@ void GL_APIENTRY GL_ProgramUniform1uiv(GLuint program,
     EVENT(context, GLProgramUniform1uiv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1uiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1571,6 +1636,7 @@ void GL_APIENTRY GL_ProgramUniform1uiv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1609,6 +1675,7 @@ void GL_APIENTRY GL_ProgramUniform2f(GLuint program, GLint location, GLfloat v0,
     EVENT(context, GLProgramUniform2f,
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f", CID(context), program,
           location, v0, v1);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2f);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1618,6 +1685,7 @@ void GL_APIENTRY GL_ProgramUniform2f(GLuint program, GLint location, GLfloat v0,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1659,6 +1727,7 @@ void GL_APIENTRY GL_ProgramUniform2fv(GLuint program,
     EVENT(context, GLProgramUniform2fv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1668,6 +1737,7 @@ void GL_APIENTRY GL_ProgramUniform2fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1706,6 +1776,7 @@ void GL_APIENTRY GL_ProgramUniform2i(GLuint program, GLint location, GLint v0, G
     EVENT(context, GLProgramUniform2i,
           "context = %d, program = %u, location = %d, v0 = %d, v1 = %d", CID(context), program,
           location, v0, v1);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2i);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1715,6 +1786,7 @@ void GL_APIENTRY GL_ProgramUniform2i(GLuint program, GLint location, GLint v0, G
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1756,6 +1828,7 @@ void GL_APIENTRY GL_ProgramUniform2iv(GLuint program,
     EVENT(context, GLProgramUniform2iv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2iv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1765,6 +1838,7 @@ void GL_APIENTRY GL_ProgramUniform2iv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1803,6 +1877,7 @@ void GL_APIENTRY GL_ProgramUniform2ui(GLuint program, GLint location, GLuint v0,
     EVENT(context, GLProgramUniform2ui,
           "context = %d, program = %u, location = %d, v0 = %u, v1 = %u", CID(context), program,
           location, v0, v1);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2ui);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1812,6 +1887,7 @@ void GL_APIENTRY GL_ProgramUniform2ui(GLuint program, GLint location, GLuint v0,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1853,6 +1929,7 @@ void GL_APIENTRY GL_ProgramUniform2uiv(GLuint program,
     EVENT(context, GLProgramUniform2uiv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2uiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1862,6 +1939,7 @@ void GL_APIENTRY GL_ProgramUniform2uiv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1910,6 +1988,7 @@ GL_ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfl
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1951,6 +2030,7 @@ void GL_APIENTRY GL_ProgramUniform3fv(GLuint program,
     EVENT(context, GLProgramUniform3fv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform3fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1960,6 +2040,7 @@ void GL_APIENTRY GL_ProgramUniform3fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1998,6 +2079,7 @@ void GL_APIENTRY GL_ProgramUniform3i(GLuint program, GLint location, GLint v0, G
     EVENT(context, GLProgramUniform3i,
           "context = %d, program = %u, location = %d, v0 = %d, v1 = %d, v2 = %d", CID(context),
           program, location, v0, v1, v2);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform3i);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2007,6 +2089,7 @@ void GL_APIENTRY GL_ProgramUniform3i(GLuint program, GLint location, GLint v0, G
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2048,6 +2131,7 @@ void GL_APIENTRY GL_ProgramUniform3iv(GLuint program,
     EVENT(context, GLProgramUniform3iv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform3iv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2057,6 +2141,7 @@ void GL_APIENTRY GL_ProgramUniform3iv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2105,6 +2190,7 @@ GL_ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuin
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2146,6 +2232,7 @@ void GL_APIENTRY GL_ProgramUniform3uiv(GLuint program,
     EVENT(context, GLProgramUniform3uiv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform3uiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2155,6 +2242,7 @@ void GL_APIENTRY GL_ProgramUniform3uiv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2203,6 +2291,7 @@ GL_ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfl
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2244,6 +2333,7 @@ void GL_APIENTRY GL_ProgramUniform4fv(GLuint program,
     EVENT(context, GLProgramUniform4fv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform4fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2253,6 +2343,7 @@ void GL_APIENTRY GL_ProgramUniform4fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2301,6 +2392,7 @@ GL_ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2342,6 +2434,7 @@ void GL_APIENTRY GL_ProgramUniform4iv(GLuint program,
     EVENT(context, GLProgramUniform4iv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform4iv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2351,6 +2444,7 @@ void GL_APIENTRY GL_ProgramUniform4iv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2399,6 +2493,7 @@ GL_ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuin
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2440,6 +2535,7 @@ void GL_APIENTRY GL_ProgramUniform4uiv(GLuint program,
     EVENT(context, GLProgramUniform4uiv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform4uiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2449,6 +2545,7 @@ void GL_APIENTRY GL_ProgramUniform4uiv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2492,6 +2589,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix2fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2501,6 +2599,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2546,6 +2645,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix2x3fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2555,6 +2655,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2600,6 +2701,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix2x4fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2609,6 +2711,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2654,6 +2757,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix3fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2663,6 +2767,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2708,6 +2813,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix3x2fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2717,6 +2823,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2762,6 +2869,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix3x4fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2771,6 +2879,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2816,6 +2925,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix4fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2825,6 +2935,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2870,6 +2981,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix4x2fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2879,6 +2991,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2924,6 +3037,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fv(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix4x3fv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2933,6 +3047,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fv(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2972,12 +3087,14 @@ void GL_APIENTRY GL_SampleMaski(GLuint maskNumber, GLbitfield mask)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSampleMaski, "context = %d, maskNumber = %u, mask = %s", CID(context),
           maskNumber, GLbitfieldToString(GLESEnum::AllEnums, mask).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLSampleMaski);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3024,6 +3141,7 @@ void GL_APIENTRY GL_TexStorage2DMultisample(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), samples,
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), width, height,
           GLbooleanToString(fixedsamplelocations));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorage2DMultisample);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3032,6 +3150,7 @@ void GL_APIENTRY GL_TexStorage2DMultisample(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3072,6 +3191,7 @@ void GL_APIENTRY GL_UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint
     EVENT(context, GLUseProgramStages, "context = %d, pipeline = %u, stages = %s, program = %u",
           CID(context), pipeline, GLbitfieldToString(GLESEnum::UseProgramStageMask, stages).c_str(),
           program);
+    ANGLE_PROFILE_ENTRY_POINT(GLUseProgramStages);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3081,6 +3201,7 @@ void GL_APIENTRY GL_UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3118,6 +3239,7 @@ void GL_APIENTRY GL_ValidateProgramPipeline(GLuint pipeline)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLValidateProgramPipeline, "context = %d, pipeline = %u", CID(context),
           pipeline);
+    ANGLE_PROFILE_ENTRY_POINT(GLValidateProgramPipeline);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3126,6 +3248,7 @@ void GL_APIENTRY GL_ValidateProgramPipeline(GLuint pipeline)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3162,12 +3285,14 @@ void GL_APIENTRY GL_VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribBinding, "context = %d, attribindex = %u, bindingindex = %u",
           CID(context), attribindex, bindingindex);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribBinding);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3213,6 +3338,7 @@ void GL_APIENTRY GL_VertexAttribFormat(GLuint attribindex,
           "%u",
           CID(context), attribindex, size, GLenumToString(GLESEnum::VertexAttribType, type),
           GLbooleanToString(normalized), relativeoffset);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribFormat);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3220,6 +3346,7 @@ void GL_APIENTRY GL_VertexAttribFormat(GLuint attribindex,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3265,6 +3392,7 @@ void GL_APIENTRY GL_VertexAttribIFormat(GLuint attribindex,
     EVENT(context, GLVertexAttribIFormat,
           "context = %d, attribindex = %u, size = %d, type = %s, relativeoffset = %u", CID(context),
           attribindex, size, GLenumToString(GLESEnum::VertexAttribIType, type), relativeoffset);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribIFormat);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3272,6 +3400,7 @@ void GL_APIENTRY GL_VertexAttribIFormat(GLuint attribindex,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3313,12 +3442,14 @@ void GL_APIENTRY GL_VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexBindingDivisor, "context = %d, bindingindex = %u, divisor = %u",
           CID(context), bindingindex, divisor);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexBindingDivisor);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_1))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
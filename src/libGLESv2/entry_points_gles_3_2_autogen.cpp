@@ -29,6 +29,7 @@ void GL_APIENTRY GL_BlendBarrier()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendBarrier, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendBarrier);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -36,6 +37,7 @@ void GL_APIENTRY GL_BlendBarrier()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -71,12 +73,14 @@ void GL_APIENTRY GL_BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum mo
     EVENT(context, GLBlendEquationSeparatei, "context = %d, buf = %u, modeRGB = %s, modeAlpha = %s",
           CID(context), buf, GLenumToString(GLESEnum::BlendEquationModeEXT, modeRGB),
           GLenumToString(GLESEnum::BlendEquationModeEXT, modeAlpha));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendEquationSeparatei);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -115,12 +119,14 @@ void GL_APIENTRY GL_BlendEquationi(GLuint buf, GLenum mode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationi, "context = %d, buf = %u, mode = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendEquationModeEXT, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendEquationi);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -169,6 +175,7 @@ GL_BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -210,12 +217,14 @@ void GL_APIENTRY GL_BlendFunci(GLuint buf, GLenum src, GLenum dst)
     EVENT(context, GLBlendFunci, "context = %d, buf = %u, src = %s, dst = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendingFactor, src),
           GLenumToString(GLESEnum::BlendingFactor, dst));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendFunci);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -254,12 +263,14 @@ void GL_APIENTRY GL_ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean
     EVENT(context, GLColorMaski, "context = %d, index = %u, r = %s, g = %s, b = %s, a = %s",
           CID(context), index, GLbooleanToString(r), GLbooleanToString(g), GLbooleanToString(b),
           GLbooleanToString(a));
+    ANGLE_PROFILE_ENTRY_POINT(GLColorMaski);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -317,6 +328,7 @@ void GL_APIENTRY GL_CopyImageSubData(GLuint srcName,
           srcLevel, srcX, srcY, srcZ, dstName,
           GLenumToString(GLESEnum::CopyImageSubDataTarget, dstTarget), dstLevel, dstX, dstY, dstZ,
           srcWidth, srcHeight, srcDepth);
+    ANGLE_PROFILE_ENTRY_POINT(GLCopyImageSubData);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -324,6 +336,7 @@ void GL_APIENTRY GL_CopyImageSubData(GLuint srcName,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -366,6 +379,7 @@ void GL_APIENTRY GL_DebugMessageCallback(GLDEBUGPROC callback, const void *userP
     EVENT(context, GLDebugMessageCallback,
           "context = %d, callback = 0x%016" PRIxPTR ", userParam = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)callback, (uintptr_t)userParam);
+    ANGLE_PROFILE_ENTRY_POINT(GLDebugMessageCallback);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -373,6 +387,7 @@ void GL_APIENTRY GL_DebugMessageCallback(GLDEBUGPROC callback, const void *userP
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -418,6 +433,7 @@ void GL_APIENTRY GL_DebugMessageControl(GLenum source,
           GLenumToString(GLESEnum::DebugType, type),
           GLenumToString(GLESEnum::DebugSeverity, severity), count, (uintptr_t)ids,
           GLbooleanToString(enabled));
+    ANGLE_PROFILE_ENTRY_POINT(GLDebugMessageControl);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -425,6 +441,7 @@ void GL_APIENTRY GL_DebugMessageControl(GLenum source,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -471,6 +488,7 @@ void GL_APIENTRY GL_DebugMessageInsert(GLenum source,
           CID(context), GLenumToString(GLESEnum::DebugSource, source),
           GLenumToString(GLESEnum::DebugType, type), id,
           GLenumToString(GLESEnum::DebugSeverity, severity), length, (uintptr_t)buf);
+    ANGLE_PROFILE_ENTRY_POINT(GLDebugMessageInsert);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -478,6 +496,7 @@ void GL_APIENTRY GL_DebugMessageInsert(GLenum source,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -515,12 +534,14 @@ void GL_APIENTRY GL_Disablei(GLenum target, GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisablei, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLDisablei);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -565,6 +586,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertex(GLenum mode,
           ", basevertex = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, basevertex);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsBaseVertex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -574,6 +596,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertex(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -620,6 +643,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertex(GLenum mode,
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, instancecount,
           basevertex);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsInstancedBaseVertex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -629,6 +653,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertex(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -678,6 +703,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertex(GLenum mode,
           "0x%016" PRIxPTR ", basevertex = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), start, end, count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, basevertex);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawRangeElementsBaseVertex);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -687,6 +713,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertex(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -726,12 +753,14 @@ void GL_APIENTRY GL_Enablei(GLenum target, GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnablei, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLEnablei);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -774,6 +803,7 @@ void GL_APIENTRY GL_FramebufferTexture(GLenum target,
           "context = %d, target = %s, attachment = %s, texture = %u, level = %d", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment), texture, level);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferTexture);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -786,6 +816,7 @@ void GL_APIENTRY GL_FramebufferTexture(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -834,6 +865,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLog(GLuint count,
           ", lengths = 0x%016" PRIxPTR ", messageLog = 0x%016" PRIxPTR "",
           CID(context), count, bufSize, (uintptr_t)sources, (uintptr_t)types, (uintptr_t)ids,
           (uintptr_t)severities, (uintptr_t)lengths, (uintptr_t)messageLog);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetDebugMessageLog);
 
     GLuint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -842,6 +874,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLog(GLuint count,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -885,6 +918,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatus()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetGlobalContext();
     EVENT(context, GLGetGraphicsResetStatus, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLGetGraphicsResetStatus);
 
     GLenum returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -893,6 +927,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatus()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -946,6 +981,7 @@ GL_GetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *leng
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -987,6 +1023,7 @@ void GL_APIENTRY GL_GetObjectPtrLabel(const void *ptr,
           "context = %d, ptr = 0x%016" PRIxPTR ", bufSize = %d, length = 0x%016" PRIxPTR
           ", label = 0x%016" PRIxPTR "",
           CID(context), (uintptr_t)ptr, bufSize, (uintptr_t)length, (uintptr_t)label);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetObjectPtrLabel);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -994,6 +1031,7 @@ void GL_APIENTRY GL_GetObjectPtrLabel(const void *ptr,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1029,6 +1067,7 @@ void GL_APIENTRY GL_GetPointerv(GLenum pname, void **params)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPointerv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPointervPName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetPointerv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1036,6 +1075,7 @@ void GL_APIENTRY GL_GetPointerv(GLenum pname, void **params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() < ES_2_0 ||
                              context->getClientVersion() >= ES_3_2))
             {
@@ -1073,6 +1113,7 @@ void GL_APIENTRY GL_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *
     EVENT(context, GLGetSamplerParameterIiv,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterIiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1081,6 +1122,7 @@ void GL_APIENTRY GL_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1119,6 +1161,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint
     EVENT(context, GLGetSamplerParameterIuiv,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterIuiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1127,6 +1170,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1167,6 +1211,7 @@ void GL_APIENTRY GL_GetTexParameterIiv(GLenum target, GLenum pname, GLint *param
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterIiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1175,6 +1220,7 @@ void GL_APIENTRY GL_GetTexParameterIiv(GLenum target, GLenum pname, GLint *param
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1212,6 +1258,7 @@ void GL_APIENTRY GL_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint *par
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterIuiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1220,6 +1267,7 @@ void GL_APIENTRY GL_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint *par
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1256,6 +1304,7 @@ void GL_APIENTRY GL_GetnUniformfv(GLuint program, GLint location, GLsizei bufSiz
     EVENT(context, GLGetnUniformfv,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformfv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1265,6 +1314,7 @@ void GL_APIENTRY GL_GetnUniformfv(GLuint program, GLint location, GLsizei bufSiz
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1302,6 +1352,7 @@ void GL_APIENTRY GL_GetnUniformiv(GLuint program, GLint location, GLsizei bufSiz
     EVENT(context, GLGetnUniformiv,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1311,6 +1362,7 @@ void GL_APIENTRY GL_GetnUniformiv(GLuint program, GLint location, GLsizei bufSiz
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1348,6 +1400,7 @@ void GL_APIENTRY GL_GetnUniformuiv(GLuint program, GLint location, GLsizei bufSi
     EVENT(context, GLGetnUniformuiv,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformuiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1357,6 +1410,7 @@ void GL_APIENTRY GL_GetnUniformuiv(GLuint program, GLint location, GLsizei bufSi
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1394,6 +1448,7 @@ GLboolean GL_APIENTRY GL_IsEnabledi(GLenum target, GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsEnabledi, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsEnabledi);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -1401,6 +1456,7 @@ GLboolean GL_APIENTRY GL_IsEnabledi(GLenum target, GLuint index)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1444,12 +1500,14 @@ void GL_APIENTRY GL_MinSampleShading(GLfloat value)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMinSampleShading, "context = %d, value = %f", CID(context), value);
+    ANGLE_PROFILE_ENTRY_POINT(GLMinSampleShading);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1489,6 +1547,7 @@ void GL_APIENTRY GL_ObjectLabel(GLenum identifier, GLuint name, GLsizei length,
           "context = %d, identifier = %s, name = %u, length = %d, label = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ObjectIdentifier, identifier), name, length,
           (uintptr_t)label);
+    ANGLE_PROFILE_ENTRY_POINT(GLObjectLabel);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1496,6 +1555,7 @@ void GL_APIENTRY GL_ObjectLabel(GLenum identifier, GLuint name, GLsizei length,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1532,6 +1592,7 @@ void GL_APIENTRY GL_ObjectPtrLabel(const void *ptr, GLsizei length, const GLchar
     EVENT(context, GLObjectPtrLabel,
           "context = %d, ptr = 0x%016" PRIxPTR ", length = %d, label = 0x%016" PRIxPTR "",
           CID(context), (uintptr_t)ptr, length, (uintptr_t)label);
+    ANGLE_PROFILE_ENTRY_POINT(GLObjectPtrLabel);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1539,6 +1600,7 @@ void GL_APIENTRY GL_ObjectPtrLabel(const void *ptr, GLsizei length, const GLchar
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1574,12 +1636,14 @@ void GL_APIENTRY GL_PatchParameteri(GLenum pname, GLint value)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPatchParameteri, "context = %d, pname = %s, value = %d", CID(context),
           GLenumToString(GLESEnum::PatchParameterName, pname), value);
+    ANGLE_PROFILE_ENTRY_POINT(GLPatchParameteri);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1616,6 +1680,7 @@ void GL_APIENTRY GL_PopDebugGroup()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPopDebugGroup, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLPopDebugGroup);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1623,6 +1688,7 @@ void GL_APIENTRY GL_PopDebugGroup()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1666,12 +1732,14 @@ void GL_APIENTRY GL_PrimitiveBoundingBox(GLfloat minX,
           "context = %d, minX = %f, minY = %f, minZ = %f, minW = %f, maxX = %f, maxY = %f, maxZ = "
           "%f, maxW = %f",
           CID(context), minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
+    ANGLE_PROFILE_ENTRY_POINT(GLPrimitiveBoundingBox);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1714,6 +1782,7 @@ void GL_APIENTRY GL_PushDebugGroup(GLenum source, GLuint id, GLsizei length, con
           "context = %d, source = %s, id = %u, length = %d, message = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::DebugSource, source), id, length,
           (uintptr_t)message);
+    ANGLE_PROFILE_ENTRY_POINT(GLPushDebugGroup);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1721,6 +1790,7 @@ void GL_APIENTRY GL_PushDebugGroup(GLenum source, GLuint id, GLsizei length, con
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1766,6 +1836,7 @@ void GL_APIENTRY GL_ReadnPixels(GLint x,
           "= %d, data = 0x%016" PRIxPTR "",
           CID(context), x, y, width, height, GLenumToString(GLESEnum::PixelFormat, format),
           GLenumToString(GLESEnum::PixelType, type), bufSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLReadnPixels);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1773,6 +1844,7 @@ void GL_APIENTRY GL_ReadnPixels(GLint x,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1810,6 +1882,7 @@ void GL_APIENTRY GL_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLin
     EVENT(context, GLSamplerParameterIiv,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterIiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1818,6 +1891,7 @@ void GL_APIENTRY GL_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLin
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1854,6 +1928,7 @@ void GL_APIENTRY GL_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLu
     EVENT(context, GLSamplerParameterIuiv,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterIuiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1862,6 +1937,7 @@ void GL_APIENTRY GL_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLu
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1899,6 +1975,7 @@ void GL_APIENTRY GL_TexBuffer(GLenum target, GLenum internalformat, GLuint buffe
     EVENT(context, GLTexBuffer, "context = %d, target = %s, internalformat = %s, buffer = %u",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), buffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexBuffer);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1908,6 +1985,7 @@ void GL_APIENTRY GL_TexBuffer(GLenum target, GLenum internalformat, GLuint buffe
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1951,6 +2029,7 @@ void GL_APIENTRY GL_TexBufferRange(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), buffer,
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(size));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexBufferRange);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1960,6 +2039,7 @@ void GL_APIENTRY GL_TexBufferRange(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1999,6 +2079,7 @@ void GL_APIENTRY GL_TexParameterIiv(GLenum target, GLenum pname, const GLint *pa
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::TextureParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterIiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2007,6 +2088,7 @@ void GL_APIENTRY GL_TexParameterIiv(GLenum target, GLenum pname, const GLint *pa
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2044,6 +2126,7 @@ void GL_APIENTRY GL_TexParameterIuiv(GLenum target, GLenum pname, const GLuint *
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::TextureParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterIuiv);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2052,6 +2135,7 @@ void GL_APIENTRY GL_TexParameterIuiv(GLenum target, GLenum pname, const GLuint *
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2097,6 +2181,7 @@ void GL_APIENTRY GL_TexStorage3DMultisample(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), samples,
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), width, height, depth,
           GLbooleanToString(fixedsamplelocations));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorage3DMultisample);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2105,6 +2190,7 @@ void GL_APIENTRY GL_TexStorage3DMultisample(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getClientVersion() >= ES_3_2))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
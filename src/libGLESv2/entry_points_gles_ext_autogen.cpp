@@ -44,6 +44,7 @@ void GL_APIENTRY GL_BeginPerfMonitorAMD(GLuint monitor)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBeginPerfMonitorAMD, "context = %d, monitor = %u", CID(context), monitor);
+    ANGLE_PROFILE_ENTRY_POINT(GLBeginPerfMonitorAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -51,6 +52,7 @@ void GL_APIENTRY GL_BeginPerfMonitorAMD(GLuint monitor)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -86,6 +88,7 @@ void GL_APIENTRY GL_DeletePerfMonitorsAMD(GLsizei n, GLuint *monitors)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeletePerfMonitorsAMD, "context = %d, n = %d, monitors = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)monitors);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeletePerfMonitorsAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -93,6 +96,7 @@ void GL_APIENTRY GL_DeletePerfMonitorsAMD(GLsizei n, GLuint *monitors)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -127,6 +131,7 @@ void GL_APIENTRY GL_EndPerfMonitorAMD(GLuint monitor)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndPerfMonitorAMD, "context = %d, monitor = %u", CID(context), monitor);
+    ANGLE_PROFILE_ENTRY_POINT(GLEndPerfMonitorAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -134,6 +139,7 @@ void GL_APIENTRY GL_EndPerfMonitorAMD(GLuint monitor)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -169,6 +175,7 @@ void GL_APIENTRY GL_GenPerfMonitorsAMD(GLsizei n, GLuint *monitors)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenPerfMonitorsAMD, "context = %d, n = %d, monitors = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)monitors);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenPerfMonitorsAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -176,6 +183,7 @@ void GL_APIENTRY GL_GenPerfMonitorsAMD(GLsizei n, GLuint *monitors)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -218,6 +226,7 @@ void GL_APIENTRY GL_GetPerfMonitorCounterDataAMD(GLuint monitor,
           ", bytesWritten = 0x%016" PRIxPTR "",
           CID(context), monitor, GLenumToString(GLESEnum::AllEnums, pname), dataSize,
           (uintptr_t)data, (uintptr_t)bytesWritten);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetPerfMonitorCounterDataAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -225,6 +234,7 @@ void GL_APIENTRY GL_GetPerfMonitorCounterDataAMD(GLuint monitor,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -267,6 +277,7 @@ void GL_APIENTRY GL_GetPerfMonitorCounterInfoAMD(GLuint group,
     EVENT(context, GLGetPerfMonitorCounterInfoAMD,
           "context = %d, group = %u, counter = %u, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), group, counter, GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetPerfMonitorCounterInfoAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -274,6 +285,7 @@ void GL_APIENTRY GL_GetPerfMonitorCounterInfoAMD(GLuint group,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -318,6 +330,7 @@ void GL_APIENTRY GL_GetPerfMonitorCounterStringAMD(GLuint group,
           "context = %d, group = %u, counter = %u, bufSize = %d, length = 0x%016" PRIxPTR
           ", counterString = 0x%016" PRIxPTR "",
           CID(context), group, counter, bufSize, (uintptr_t)length, (uintptr_t)counterString);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetPerfMonitorCounterStringAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -325,6 +338,7 @@ void GL_APIENTRY GL_GetPerfMonitorCounterStringAMD(GLuint group,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -371,6 +385,7 @@ void GL_APIENTRY GL_GetPerfMonitorCountersAMD(GLuint group,
           ", maxActiveCounters = 0x%016" PRIxPTR ", counterSize = %d, counters = 0x%016" PRIxPTR "",
           CID(context), group, (uintptr_t)numCounters, (uintptr_t)maxActiveCounters, counterSize,
           (uintptr_t)counters);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetPerfMonitorCountersAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -378,6 +393,7 @@ void GL_APIENTRY GL_GetPerfMonitorCountersAMD(GLuint group,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -422,6 +438,7 @@ void GL_APIENTRY GL_GetPerfMonitorGroupStringAMD(GLuint group,
           "context = %d, group = %u, bufSize = %d, length = 0x%016" PRIxPTR
           ", groupString = 0x%016" PRIxPTR "",
           CID(context), group, bufSize, (uintptr_t)length, (uintptr_t)groupString);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetPerfMonitorGroupStringAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -429,6 +446,7 @@ void GL_APIENTRY GL_GetPerfMonitorGroupStringAMD(GLuint group,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -469,6 +487,7 @@ void GL_APIENTRY GL_GetPerfMonitorGroupsAMD(GLint *numGroups, GLsizei groupsSize
           "context = %d, numGroups = 0x%016" PRIxPTR ", groupsSize = %d, groups = 0x%016" PRIxPTR
           "",
           CID(context), (uintptr_t)numGroups, groupsSize, (uintptr_t)groups);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetPerfMonitorGroupsAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -476,6 +495,7 @@ void GL_APIENTRY GL_GetPerfMonitorGroupsAMD(GLint *numGroups, GLsizei groupsSize
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -521,6 +541,7 @@ void GL_APIENTRY GL_SelectPerfMonitorCountersAMD(GLuint monitor,
           "0x%016" PRIxPTR "",
           CID(context), monitor, GLbooleanToString(enable), group, numCounters,
           (uintptr_t)counterList);
+    ANGLE_PROFILE_ENTRY_POINT(GLSelectPerfMonitorCountersAMD);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -528,6 +549,7 @@ void GL_APIENTRY GL_SelectPerfMonitorCountersAMD(GLuint monitor,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().performanceMonitorAMD))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -575,6 +597,7 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstanceANGLE(GLenum mode,
           "context = %d, mode = %s, first = %d, count = %d, instanceCount = %d, baseInstance = %u",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), first, count, instanceCount,
           baseInstance);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawArraysInstancedBaseInstanceANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -583,6 +606,7 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstanceANGLE(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().baseVertexBaseInstanceANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -633,6 +657,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstanceANGLE(GLenum mode
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, instanceCount,
           baseVertex, baseInstance);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsInstancedBaseVertexBaseInstanceANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -642,6 +667,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstanceANGLE(GLenum mode
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().baseVertexBaseInstanceANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -692,6 +718,7 @@ void GL_APIENTRY GL_MultiDrawArraysInstancedBaseInstanceANGLE(GLenum mode,
           ", instanceCounts = 0x%016" PRIxPTR ", baseInstances = 0x%016" PRIxPTR ", drawcount = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)firsts,
           (uintptr_t)counts, (uintptr_t)instanceCounts, (uintptr_t)baseInstances, drawcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiDrawArraysInstancedBaseInstanceANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -700,6 +727,7 @@ void GL_APIENTRY GL_MultiDrawArraysInstancedBaseInstanceANGLE(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().baseVertexBaseInstanceANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -762,6 +790,7 @@ GL_MultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().baseVertexBaseInstanceANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -812,6 +841,7 @@ void GL_APIENTRY GL_BlobCacheCallbacksANGLE(GLSETBLOBPROCANGLE set,
           "context = %d, set = 0x%016" PRIxPTR ", get = 0x%016" PRIxPTR
           ", userParam = 0x%016" PRIxPTR "",
           CID(context), (uintptr_t)set, (uintptr_t)get, (uintptr_t)userParam);
+    ANGLE_PROFILE_ENTRY_POINT(GLBlobCacheCallbacksANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -819,6 +849,7 @@ void GL_APIENTRY GL_BlobCacheCallbacksANGLE(GLSETBLOBPROCANGLE set,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().blobCacheANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -855,6 +886,7 @@ void GL_APIENTRY GL_GetPointervANGLE(GLenum pname, void **params)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPointervANGLE, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetPointervANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -862,6 +894,7 @@ void GL_APIENTRY GL_GetPointervANGLE(GLenum pname, void **params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().blobCacheANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -917,6 +950,7 @@ void GL_APIENTRY GL_CopyTexture3DANGLE(GLuint sourceId,
           destId, destLevel, internalFormat, GLenumToString(GLESEnum::AllEnums, destType),
           GLbooleanToString(unpackFlipY), GLbooleanToString(unpackPremultiplyAlpha),
           GLbooleanToString(unpackUnmultiplyAlpha));
+    ANGLE_PROFILE_ENTRY_POINT(GLCopyTexture3DANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -927,6 +961,7 @@ void GL_APIENTRY GL_CopyTexture3DANGLE(GLuint sourceId,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().copyTexture3dANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -991,6 +1026,7 @@ void GL_APIENTRY GL_CopySubTexture3DANGLE(GLuint sourceId,
           destId, destLevel, xoffset, yoffset, zoffset, x, y, z, width, height, depth,
           GLbooleanToString(unpackFlipY), GLbooleanToString(unpackPremultiplyAlpha),
           GLbooleanToString(unpackUnmultiplyAlpha));
+    ANGLE_PROFILE_ENTRY_POINT(GLCopySubTexture3DANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1001,6 +1037,7 @@ void GL_APIENTRY GL_CopySubTexture3DANGLE(GLuint sourceId,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().copyTexture3dANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1061,6 +1098,7 @@ void GL_APIENTRY GL_BlitFramebufferANGLE(GLint srcX0,
           CID(context), srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1,
           GLbitfieldToString(GLESEnum::ClearBufferMask, mask).c_str(),
           GLenumToString(GLESEnum::BlitFramebufferFilter, filter));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlitFramebufferANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1068,6 +1106,7 @@ void GL_APIENTRY GL_BlitFramebufferANGLE(GLint srcX0,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferBlitANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1113,6 +1152,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleANGLE(GLenum target,
           "context = %d, target = %s, samples = %d, internalformat = %s, width = %d, height = %d",
           CID(context), GLenumToString(GLESEnum::RenderbufferTarget, target), samples,
           GLenumToString(GLESEnum::InternalFormat, internalformat), width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLRenderbufferStorageMultisampleANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1120,6 +1160,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferMultisampleANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1173,6 +1214,7 @@ GL_GetTexImageANGLE(GLenum target, GLint level, GLenum format, GLenum type, void
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().getImageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1211,6 +1253,7 @@ void GL_APIENTRY GL_GetCompressedTexImageANGLE(GLenum target, GLint level, void
     EVENT(context, GLGetCompressedTexImageANGLE,
           "context = %d, target = %s, level = %d, pixels = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target), level, (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetCompressedTexImageANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1219,6 +1262,7 @@ void GL_APIENTRY GL_GetCompressedTexImageANGLE(GLenum target, GLint level, void
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().getImageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1263,6 +1307,7 @@ void GL_APIENTRY GL_GetRenderbufferImageANGLE(GLenum target,
           CID(context), GLenumToString(GLESEnum::RenderbufferTarget, target),
           GLenumToString(GLESEnum::PixelFormat, format), GLenumToString(GLESEnum::PixelType, type),
           (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetRenderbufferImageANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1270,6 +1315,7 @@ void GL_APIENTRY GL_GetRenderbufferImageANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().getImageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1316,6 +1362,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivANGLE(GLenum target,
           "context = %d, target = %s, level = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level,
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexLevelParameterivANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1324,6 +1371,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().getTexLevelParameterANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1367,6 +1415,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvANGLE(GLenum target,
           "context = %d, target = %s, level = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level,
           GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexLevelParameterfvANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1375,6 +1424,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().getTexLevelParameterANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1418,6 +1468,7 @@ void GL_APIENTRY GL_DrawArraysInstancedANGLE(GLenum mode,
     EVENT(context, GLDrawArraysInstancedANGLE,
           "context = %d, mode = %s, first = %d, count = %d, primcount = %d", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, mode), first, count, primcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawArraysInstancedANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1426,6 +1477,7 @@ void GL_APIENTRY GL_DrawArraysInstancedANGLE(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().instancedArraysANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1471,6 +1523,7 @@ void GL_APIENTRY GL_DrawElementsInstancedANGLE(GLenum mode,
           ", primcount = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, primcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsInstancedANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1480,6 +1533,7 @@ void GL_APIENTRY GL_DrawElementsInstancedANGLE(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().instancedArraysANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1518,12 +1572,14 @@ void GL_APIENTRY GL_VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribDivisorANGLE, "context = %d, index = %u, divisor = %u",
           CID(context), index, divisor);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribDivisorANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().instancedArraysANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1564,6 +1620,7 @@ void GL_APIENTRY GL_LogicOpANGLE(GLenum opcode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLogicOpANGLE, "context = %d, opcode = %s", CID(context),
           GLenumToString(GLESEnum::LogicOp, opcode));
+    ANGLE_PROFILE_ENTRY_POINT(GLLogicOpANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1571,6 +1628,7 @@ void GL_APIENTRY GL_LogicOpANGLE(GLenum opcode)
         bool isCallValid              = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().logicOpANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1628,6 +1686,7 @@ void GL_APIENTRY GL_TexStorageMemFlags2DANGLE(GLenum target,
           GLbitfieldToString(GLESEnum::AllEnums, createFlags).c_str(),
           GLbitfieldToString(GLESEnum::AllEnums, usageFlags).c_str(),
           (uintptr_t)imageCreateInfoPNext);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorageMemFlags2DANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1637,6 +1696,7 @@ void GL_APIENTRY GL_TexStorageMemFlags2DANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectFlagsANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1697,6 +1757,7 @@ void GL_APIENTRY GL_TexStorageMemFlags2DMultisampleANGLE(GLenum target,
           GLbitfieldToString(GLESEnum::AllEnums, createFlags).c_str(),
           GLbitfieldToString(GLESEnum::AllEnums, usageFlags).c_str(),
           (uintptr_t)imageCreateInfoPNext);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorageMemFlags2DMultisampleANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1706,6 +1767,7 @@ void GL_APIENTRY GL_TexStorageMemFlags2DMultisampleANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectFlagsANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1767,6 +1829,7 @@ void GL_APIENTRY GL_TexStorageMemFlags3DANGLE(GLenum target,
           GLbitfieldToString(GLESEnum::AllEnums, createFlags).c_str(),
           GLbitfieldToString(GLESEnum::AllEnums, usageFlags).c_str(),
           (uintptr_t)imageCreateInfoPNext);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorageMemFlags3DANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1776,6 +1839,7 @@ void GL_APIENTRY GL_TexStorageMemFlags3DANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectFlagsANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1837,6 +1901,7 @@ void GL_APIENTRY GL_TexStorageMemFlags3DMultisampleANGLE(GLenum target,
           GLbitfieldToString(GLESEnum::AllEnums, createFlags).c_str(),
           GLbitfieldToString(GLESEnum::AllEnums, usageFlags).c_str(),
           (uintptr_t)imageCreateInfoPNext);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorageMemFlags3DMultisampleANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1846,6 +1911,7 @@ void GL_APIENTRY GL_TexStorageMemFlags3DMultisampleANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectFlagsANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1896,6 +1962,7 @@ void GL_APIENTRY GL_ImportMemoryZirconHandleANGLE(GLuint memory,
           "context = %d, memory = %u, size = %llu, handleType = %s, handle = %u", CID(context),
           memory, static_cast<unsigned long long>(size),
           GLenumToString(GLESEnum::ExternalHandleType, handleType), handle);
+    ANGLE_PROFILE_ENTRY_POINT(GLImportMemoryZirconHandleANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1905,6 +1972,7 @@ void GL_APIENTRY GL_ImportMemoryZirconHandleANGLE(GLuint memory,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectFuchsiaANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1953,6 +2021,7 @@ void GL_APIENTRY GL_MultiDrawArraysANGLE(GLenum mode,
           ", drawcount = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)firsts,
           (uintptr_t)counts, drawcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiDrawArraysANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -1961,6 +2030,7 @@ void GL_APIENTRY GL_MultiDrawArraysANGLE(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multiDrawANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2005,6 +2075,7 @@ void GL_APIENTRY GL_MultiDrawArraysInstancedANGLE(GLenum mode,
           ", instanceCounts = 0x%016" PRIxPTR ", drawcount = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)firsts,
           (uintptr_t)counts, (uintptr_t)instanceCounts, drawcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiDrawArraysInstancedANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2013,6 +2084,7 @@ void GL_APIENTRY GL_MultiDrawArraysInstancedANGLE(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multiDrawANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2060,6 +2132,7 @@ void GL_APIENTRY GL_MultiDrawElementsANGLE(GLenum mode,
           ", drawcount = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)counts,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, drawcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiDrawElementsANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2069,6 +2142,7 @@ void GL_APIENTRY GL_MultiDrawElementsANGLE(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multiDrawANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2115,6 +2189,7 @@ void GL_APIENTRY GL_MultiDrawElementsInstancedANGLE(GLenum mode,
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)counts,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices,
           (uintptr_t)instanceCounts, drawcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiDrawElementsInstancedANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2124,6 +2199,7 @@ void GL_APIENTRY GL_MultiDrawElementsInstancedANGLE(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multiDrawANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2168,6 +2244,7 @@ void GL_APIENTRY GL_PolygonModeANGLE(GLenum face, GLenum mode)
     EVENT(context, GLPolygonModeANGLE, "context = %d, face = %s, mode = %s", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::PolygonMode, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLPolygonModeANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2175,6 +2252,7 @@ void GL_APIENTRY GL_PolygonModeANGLE(GLenum face, GLenum mode)
         bool isCallValid       = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().polygonModeANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2219,6 +2297,7 @@ void GL_APIENTRY GL_ProvokingVertexANGLE(GLenum provokeMode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProvokingVertexANGLE, "context = %d, provokeMode = %s", CID(context),
           GLenumToString(GLESEnum::VertexProvokingMode, provokeMode));
+    ANGLE_PROFILE_ENTRY_POINT(GLProvokingVertexANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2227,6 +2306,7 @@ void GL_APIENTRY GL_ProvokingVertexANGLE(GLenum provokeMode)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().provokingVertexANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2268,6 +2348,7 @@ void GL_APIENTRY GL_RequestExtensionANGLE(const GLchar *name)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRequestExtensionANGLE, "context = %d, name = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLRequestExtensionANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2275,6 +2356,7 @@ void GL_APIENTRY GL_RequestExtensionANGLE(const GLchar *name)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().requestExtensionANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2310,6 +2392,7 @@ void GL_APIENTRY GL_DisableExtensionANGLE(const GLchar *name)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisableExtensionANGLE, "context = %d, name = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLDisableExtensionANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2317,6 +2400,7 @@ void GL_APIENTRY GL_DisableExtensionANGLE(const GLchar *name)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().requestExtensionANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2361,6 +2445,7 @@ void GL_APIENTRY GL_GetBooleanvRobustANGLE(GLenum pname,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length,
           (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBooleanvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2368,6 +2453,7 @@ void GL_APIENTRY GL_GetBooleanvRobustANGLE(GLenum pname,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2412,6 +2498,7 @@ void GL_APIENTRY GL_GetBufferParameterivRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBufferParameterivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2420,6 +2507,7 @@ void GL_APIENTRY GL_GetBufferParameterivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2465,6 +2553,7 @@ void GL_APIENTRY GL_GetFloatvRobustANGLE(GLenum pname,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length,
           (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFloatvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2472,6 +2561,7 @@ void GL_APIENTRY GL_GetFloatvRobustANGLE(GLenum pname,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2518,6 +2608,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivRobustANGLE(GLenum target
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, attachment), GLenumToString(GLESEnum::AllEnums, pname),
           bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFramebufferAttachmentParameterivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2525,6 +2616,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivRobustANGLE(GLenum target
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2571,6 +2663,7 @@ void GL_APIENTRY GL_GetIntegervRobustANGLE(GLenum pname,
           ", data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length,
           (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetIntegervRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2578,6 +2671,7 @@ void GL_APIENTRY GL_GetIntegervRobustANGLE(GLenum pname,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2622,6 +2716,7 @@ void GL_APIENTRY GL_GetProgramivRobustANGLE(GLuint program,
           ", params = 0x%016" PRIxPTR "",
           CID(context), program, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2630,6 +2725,7 @@ void GL_APIENTRY GL_GetProgramivRobustANGLE(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2673,6 +2769,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetRenderbufferParameterivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2680,6 +2777,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2726,6 +2824,7 @@ void GL_APIENTRY GL_GetShaderivRobustANGLE(GLuint shader,
           ", params = 0x%016" PRIxPTR "",
           CID(context), shader, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetShaderivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2734,6 +2833,7 @@ void GL_APIENTRY GL_GetShaderivRobustANGLE(GLuint shader,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2777,6 +2877,7 @@ void GL_APIENTRY GL_GetTexParameterfvRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterfvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2785,6 +2886,7 @@ void GL_APIENTRY GL_GetTexParameterfvRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2830,6 +2932,7 @@ void GL_APIENTRY GL_GetTexParameterivRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2838,6 +2941,7 @@ void GL_APIENTRY GL_GetTexParameterivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2882,6 +2986,7 @@ void GL_APIENTRY GL_GetUniformfvRobustANGLE(GLuint program,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
           ", params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUniformfvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2891,6 +2996,7 @@ void GL_APIENTRY GL_GetUniformfvRobustANGLE(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2935,6 +3041,7 @@ void GL_APIENTRY GL_GetUniformivRobustANGLE(GLuint program,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
           ", params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUniformivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2944,6 +3051,7 @@ void GL_APIENTRY GL_GetUniformivRobustANGLE(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -2989,6 +3097,7 @@ void GL_APIENTRY GL_GetVertexAttribfvRobustANGLE(GLuint index,
           ", params = 0x%016" PRIxPTR "",
           CID(context), index, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetVertexAttribfvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -2996,6 +3105,7 @@ void GL_APIENTRY GL_GetVertexAttribfvRobustANGLE(GLuint index,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3041,6 +3151,7 @@ void GL_APIENTRY GL_GetVertexAttribivRobustANGLE(GLuint index,
           ", params = 0x%016" PRIxPTR "",
           CID(context), index, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetVertexAttribivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3048,6 +3159,7 @@ void GL_APIENTRY GL_GetVertexAttribivRobustANGLE(GLuint index,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3093,6 +3205,7 @@ void GL_APIENTRY GL_GetVertexAttribPointervRobustANGLE(GLuint index,
           ", pointer = 0x%016" PRIxPTR "",
           CID(context), index, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)pointer);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetVertexAttribPointervRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3100,6 +3213,7 @@ void GL_APIENTRY GL_GetVertexAttribPointervRobustANGLE(GLuint index,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3154,6 +3268,7 @@ void GL_APIENTRY GL_ReadPixelsRobustANGLE(GLint x,
           CID(context), x, y, width, height, GLenumToString(GLESEnum::AllEnums, format),
           GLenumToString(GLESEnum::AllEnums, type), bufSize, (uintptr_t)length, (uintptr_t)columns,
           (uintptr_t)rows, (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLReadPixelsRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3161,6 +3276,7 @@ void GL_APIENTRY GL_ReadPixelsRobustANGLE(GLint x,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3212,6 +3328,7 @@ void GL_APIENTRY GL_TexImage2DRobustANGLE(GLenum target,
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level, internalformat, width,
           height, border, GLenumToString(GLESEnum::AllEnums, format),
           GLenumToString(GLESEnum::AllEnums, type), bufSize, (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexImage2DRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3220,6 +3337,7 @@ void GL_APIENTRY GL_TexImage2DRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3263,6 +3381,7 @@ void GL_APIENTRY GL_TexParameterfvRobustANGLE(GLenum target,
           "context = %d, target = %s, pname = %s, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterfvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3271,6 +3390,7 @@ void GL_APIENTRY GL_TexParameterfvRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3314,6 +3434,7 @@ void GL_APIENTRY GL_TexParameterivRobustANGLE(GLenum target,
           "context = %d, target = %s, pname = %s, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3322,6 +3443,7 @@ void GL_APIENTRY GL_TexParameterivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3373,6 +3495,7 @@ void GL_APIENTRY GL_TexSubImage2DRobustANGLE(GLenum target,
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level, xoffset, yoffset, width,
           height, GLenumToString(GLESEnum::AllEnums, format),
           GLenumToString(GLESEnum::AllEnums, type), bufSize, (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexSubImage2DRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3381,6 +3504,7 @@ void GL_APIENTRY GL_TexSubImage2DRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3435,6 +3559,7 @@ void GL_APIENTRY GL_TexImage3DRobustANGLE(GLenum target,
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level, internalformat, width,
           height, depth, border, GLenumToString(GLESEnum::AllEnums, format),
           GLenumToString(GLESEnum::AllEnums, type), bufSize, (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexImage3DRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3443,6 +3568,7 @@ void GL_APIENTRY GL_TexImage3DRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3499,6 +3625,7 @@ void GL_APIENTRY GL_TexSubImage3DRobustANGLE(GLenum target,
         CID(context), GLenumToString(GLESEnum::AllEnums, target), level, xoffset, yoffset, zoffset,
         width, height, depth, GLenumToString(GLESEnum::AllEnums, format),
         GLenumToString(GLESEnum::AllEnums, type), bufSize, (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexSubImage3DRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3507,6 +3634,7 @@ void GL_APIENTRY GL_TexSubImage3DRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3559,6 +3687,7 @@ void GL_APIENTRY GL_CompressedTexImage2DRobustANGLE(GLenum target,
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level,
           GLenumToString(GLESEnum::AllEnums, internalformat), width, height, border, imageSize,
           dataSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedTexImage2DRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3567,6 +3696,7 @@ void GL_APIENTRY GL_CompressedTexImage2DRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3619,6 +3749,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2DRobustANGLE(GLenum target,
           "%d, format = %s, imageSize = %d, dataSize = %d, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level, xoffset, yoffset, width,
           height, GLenumToString(GLESEnum::AllEnums, format), imageSize, dataSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedTexSubImage2DRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3627,6 +3758,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2DRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3680,6 +3812,7 @@ void GL_APIENTRY GL_CompressedTexImage3DRobustANGLE(GLenum target,
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level,
           GLenumToString(GLESEnum::AllEnums, internalformat), width, height, depth, border,
           imageSize, dataSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedTexImage3DRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3688,6 +3821,7 @@ void GL_APIENTRY GL_CompressedTexImage3DRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3744,6 +3878,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DRobustANGLE(GLenum target,
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level, xoffset, yoffset,
           zoffset, width, height, depth, GLenumToString(GLESEnum::AllEnums, format), imageSize,
           dataSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedTexSubImage3DRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3752,6 +3887,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3802,6 +3938,7 @@ void GL_APIENTRY GL_GetQueryivRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3810,6 +3947,7 @@ void GL_APIENTRY GL_GetQueryivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3854,6 +3992,7 @@ void GL_APIENTRY GL_GetQueryObjectuivRobustANGLE(GLuint id,
           ", params = 0x%016" PRIxPTR "",
           CID(context), id, GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length,
           (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryObjectuivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3862,6 +4001,7 @@ void GL_APIENTRY GL_GetQueryObjectuivRobustANGLE(GLuint id,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3905,6 +4045,7 @@ void GL_APIENTRY GL_GetBufferPointervRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBufferPointervRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3913,6 +4054,7 @@ void GL_APIENTRY GL_GetBufferPointervRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -3958,6 +4100,7 @@ void GL_APIENTRY GL_GetIntegeri_vRobustANGLE(GLenum target,
           ", data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target), index, bufSize,
           (uintptr_t)length, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetIntegeri_vRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -3965,6 +4108,7 @@ void GL_APIENTRY GL_GetIntegeri_vRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4012,6 +4156,7 @@ void GL_APIENTRY GL_GetInternalformativRobustANGLE(GLenum target,
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, internalformat),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetInternalformativRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4019,6 +4164,7 @@ void GL_APIENTRY GL_GetInternalformativRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4066,6 +4212,7 @@ void GL_APIENTRY GL_GetVertexAttribIivRobustANGLE(GLuint index,
           ", params = 0x%016" PRIxPTR "",
           CID(context), index, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetVertexAttribIivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4073,6 +4220,7 @@ void GL_APIENTRY GL_GetVertexAttribIivRobustANGLE(GLuint index,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4119,6 +4267,7 @@ void GL_APIENTRY GL_GetVertexAttribIuivRobustANGLE(GLuint index,
           ", params = 0x%016" PRIxPTR "",
           CID(context), index, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetVertexAttribIuivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4126,6 +4275,7 @@ void GL_APIENTRY GL_GetVertexAttribIuivRobustANGLE(GLuint index,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4171,6 +4321,7 @@ void GL_APIENTRY GL_GetUniformuivRobustANGLE(GLuint program,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
           ", params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUniformuivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4180,6 +4331,7 @@ void GL_APIENTRY GL_GetUniformuivRobustANGLE(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4226,6 +4378,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockivRobustANGLE(GLuint program,
           "0x%016" PRIxPTR ", params = 0x%016" PRIxPTR "",
           CID(context), program, uniformBlockIndex, GLenumToString(GLESEnum::AllEnums, pname),
           bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetActiveUniformBlockivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4235,6 +4388,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockivRobustANGLE(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4281,6 +4435,7 @@ void GL_APIENTRY GL_GetInteger64vRobustANGLE(GLenum pname,
           ", data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length,
           (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetInteger64vRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4288,6 +4443,7 @@ void GL_APIENTRY GL_GetInteger64vRobustANGLE(GLenum pname,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4333,6 +4489,7 @@ void GL_APIENTRY GL_GetInteger64i_vRobustANGLE(GLenum target,
           ", data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target), index, bufSize,
           (uintptr_t)length, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetInteger64i_vRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4340,6 +4497,7 @@ void GL_APIENTRY GL_GetInteger64i_vRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4385,6 +4543,7 @@ void GL_APIENTRY GL_GetBufferParameteri64vRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBufferParameteri64vRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4393,6 +4552,7 @@ void GL_APIENTRY GL_GetBufferParameteri64vRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4436,6 +4596,7 @@ void GL_APIENTRY GL_SamplerParameterivRobustANGLE(GLuint sampler,
     EVENT(context, GLSamplerParameterivRobustANGLE,
           "context = %d, sampler = %u, pname = %u, bufSize = %d, param = 0x%016" PRIxPTR "",
           CID(context), sampler, pname, bufSize, (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4444,6 +4605,7 @@ void GL_APIENTRY GL_SamplerParameterivRobustANGLE(GLuint sampler,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4488,6 +4650,7 @@ void GL_APIENTRY GL_SamplerParameterfvRobustANGLE(GLuint sampler,
           "context = %d, sampler = %u, pname = %s, bufSize = %d, param = 0x%016" PRIxPTR "",
           CID(context), sampler, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterfvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4496,6 +4659,7 @@ void GL_APIENTRY GL_SamplerParameterfvRobustANGLE(GLuint sampler,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4542,6 +4706,7 @@ void GL_APIENTRY GL_GetSamplerParameterivRobustANGLE(GLuint sampler,
           ", params = 0x%016" PRIxPTR "",
           CID(context), sampler, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4550,6 +4715,7 @@ void GL_APIENTRY GL_GetSamplerParameterivRobustANGLE(GLuint sampler,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4596,6 +4762,7 @@ void GL_APIENTRY GL_GetSamplerParameterfvRobustANGLE(GLuint sampler,
           ", params = 0x%016" PRIxPTR "",
           CID(context), sampler, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterfvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4604,6 +4771,7 @@ void GL_APIENTRY GL_GetSamplerParameterfvRobustANGLE(GLuint sampler,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4650,6 +4818,7 @@ void GL_APIENTRY GL_GetFramebufferParameterivRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFramebufferParameterivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4657,6 +4826,7 @@ void GL_APIENTRY GL_GetFramebufferParameterivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4704,6 +4874,7 @@ void GL_APIENTRY GL_GetProgramInterfaceivRobustANGLE(GLuint program,
           "0x%016" PRIxPTR ", params = 0x%016" PRIxPTR "",
           CID(context), program, GLenumToString(GLESEnum::AllEnums, programInterface),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramInterfaceivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4712,6 +4883,7 @@ void GL_APIENTRY GL_GetProgramInterfaceivRobustANGLE(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4759,6 +4931,7 @@ void GL_APIENTRY GL_GetBooleani_vRobustANGLE(GLenum target,
           ", data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target), index, bufSize,
           (uintptr_t)length, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBooleani_vRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4766,6 +4939,7 @@ void GL_APIENTRY GL_GetBooleani_vRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4811,6 +4985,7 @@ void GL_APIENTRY GL_GetMultisamplefvRobustANGLE(GLenum pname,
           ", val = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), index, bufSize,
           (uintptr_t)length, (uintptr_t)val);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetMultisamplefvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4818,6 +4993,7 @@ void GL_APIENTRY GL_GetMultisamplefvRobustANGLE(GLenum pname,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4864,6 +5040,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level,
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexLevelParameterivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4872,6 +5049,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4920,6 +5098,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level,
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexLevelParameterfvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4928,6 +5107,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -4974,6 +5154,7 @@ void GL_APIENTRY GL_GetPointervRobustANGLERobustANGLE(GLenum pname,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length,
           (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetPointervRobustANGLERobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -4981,6 +5162,7 @@ void GL_APIENTRY GL_GetPointervRobustANGLERobustANGLE(GLenum pname,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5035,6 +5217,7 @@ void GL_APIENTRY GL_ReadnPixelsRobustANGLE(GLint x,
           CID(context), x, y, width, height, GLenumToString(GLESEnum::AllEnums, format),
           GLenumToString(GLESEnum::AllEnums, type), bufSize, (uintptr_t)length, (uintptr_t)columns,
           (uintptr_t)rows, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLReadnPixelsRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5042,6 +5225,7 @@ void GL_APIENTRY GL_ReadnPixelsRobustANGLE(GLint x,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5086,6 +5270,7 @@ void GL_APIENTRY GL_GetnUniformfvRobustANGLE(GLuint program,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
           ", params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformfvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5095,6 +5280,7 @@ void GL_APIENTRY GL_GetnUniformfvRobustANGLE(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5139,6 +5325,7 @@ void GL_APIENTRY GL_GetnUniformivRobustANGLE(GLuint program,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
           ", params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5148,6 +5335,7 @@ void GL_APIENTRY GL_GetnUniformivRobustANGLE(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5192,6 +5380,7 @@ void GL_APIENTRY GL_GetnUniformuivRobustANGLE(GLuint program,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
           ", params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformuivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5201,6 +5390,7 @@ void GL_APIENTRY GL_GetnUniformuivRobustANGLE(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5244,6 +5434,7 @@ void GL_APIENTRY GL_TexParameterIivRobustANGLE(GLenum target,
           "context = %d, target = %s, pname = %s, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterIivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5252,6 +5443,7 @@ void GL_APIENTRY GL_TexParameterIivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5295,6 +5487,7 @@ void GL_APIENTRY GL_TexParameterIuivRobustANGLE(GLenum target,
           "context = %d, target = %s, pname = %s, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterIuivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5303,6 +5496,7 @@ void GL_APIENTRY GL_TexParameterIuivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5348,6 +5542,7 @@ void GL_APIENTRY GL_GetTexParameterIivRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterIivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5356,6 +5551,7 @@ void GL_APIENTRY GL_GetTexParameterIivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5402,6 +5598,7 @@ void GL_APIENTRY GL_GetTexParameterIuivRobustANGLE(GLenum target,
           ", params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterIuivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5410,6 +5607,7 @@ void GL_APIENTRY GL_GetTexParameterIuivRobustANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5454,6 +5652,7 @@ void GL_APIENTRY GL_SamplerParameterIivRobustANGLE(GLuint sampler,
           "context = %d, sampler = %u, pname = %s, bufSize = %d, param = 0x%016" PRIxPTR "",
           CID(context), sampler, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterIivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5462,6 +5661,7 @@ void GL_APIENTRY GL_SamplerParameterIivRobustANGLE(GLuint sampler,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5506,6 +5706,7 @@ void GL_APIENTRY GL_SamplerParameterIuivRobustANGLE(GLuint sampler,
           "context = %d, sampler = %u, pname = %s, bufSize = %d, param = 0x%016" PRIxPTR "",
           CID(context), sampler, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterIuivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5514,6 +5715,7 @@ void GL_APIENTRY GL_SamplerParameterIuivRobustANGLE(GLuint sampler,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5560,6 +5762,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivRobustANGLE(GLuint sampler,
           ", params = 0x%016" PRIxPTR "",
           CID(context), sampler, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterIivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5568,6 +5771,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivRobustANGLE(GLuint sampler,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5614,6 +5818,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivRobustANGLE(GLuint sampler,
           ", params = 0x%016" PRIxPTR "",
           CID(context), sampler, GLenumToString(GLESEnum::AllEnums, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterIuivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5622,6 +5827,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivRobustANGLE(GLuint sampler,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5668,6 +5874,7 @@ void GL_APIENTRY GL_GetQueryObjectivRobustANGLE(GLuint id,
           ", params = 0x%016" PRIxPTR "",
           CID(context), id, GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length,
           (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryObjectivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5676,6 +5883,7 @@ void GL_APIENTRY GL_GetQueryObjectivRobustANGLE(GLuint id,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5719,6 +5927,7 @@ void GL_APIENTRY GL_GetQueryObjecti64vRobustANGLE(GLuint id,
           ", params = 0x%016" PRIxPTR "",
           CID(context), id, GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length,
           (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryObjecti64vRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5727,6 +5936,7 @@ void GL_APIENTRY GL_GetQueryObjecti64vRobustANGLE(GLuint id,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5771,6 +5981,7 @@ void GL_APIENTRY GL_GetQueryObjectui64vRobustANGLE(GLuint id,
           ", params = 0x%016" PRIxPTR "",
           CID(context), id, GLenumToString(GLESEnum::AllEnums, pname), bufSize, (uintptr_t)length,
           (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryObjectui64vRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5779,6 +5990,7 @@ void GL_APIENTRY GL_GetQueryObjectui64vRobustANGLE(GLuint id,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5823,6 +6035,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterfvRobustANGLE(GLint
           ", params = 0x%016" PRIxPTR "",
           CID(context), plane, GLenumToString(GLESEnum::PLSQueryFloat, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFramebufferPixelLocalStorageParameterfvRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5830,6 +6043,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterfvRobustANGLE(GLint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5879,6 +6093,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterivRobustANGLE(GLint
           ", params = 0x%016" PRIxPTR "",
           CID(context), plane, GLenumToString(GLESEnum::PLSQueryInt, pname), bufSize,
           (uintptr_t)length, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFramebufferPixelLocalStorageParameterivRobustANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5886,6 +6101,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterivRobustANGLE(GLint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustClientMemoryANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5936,6 +6152,7 @@ void GL_APIENTRY GL_ImportSemaphoreZirconHandleANGLE(GLuint semaphore,
     EVENT(context, GLImportSemaphoreZirconHandleANGLE,
           "context = %d, semaphore = %u, handleType = %s, handle = %u", CID(context), semaphore,
           GLenumToString(GLESEnum::ExternalHandleType, handleType), handle);
+    ANGLE_PROFILE_ENTRY_POINT(GLImportSemaphoreZirconHandleANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5945,6 +6162,7 @@ void GL_APIENTRY GL_ImportSemaphoreZirconHandleANGLE(GLuint semaphore,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().semaphoreFuchsiaANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -5988,6 +6206,7 @@ void GL_APIENTRY GL_FramebufferMemorylessPixelLocalStorageANGLE(GLint plane, GLe
     EVENT(context, GLFramebufferMemorylessPixelLocalStorageANGLE,
           "context = %d, plane = %d, internalformat = %s", CID(context), plane,
           GLenumToString(GLESEnum::AllEnums, internalformat));
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferMemorylessPixelLocalStorageANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -5999,6 +6218,7 @@ void GL_APIENTRY GL_FramebufferMemorylessPixelLocalStorageANGLE(GLint plane, GLe
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6042,6 +6262,7 @@ void GL_APIENTRY GL_FramebufferTexturePixelLocalStorageANGLE(GLint plane,
     EVENT(context, GLFramebufferTexturePixelLocalStorageANGLE,
           "context = %d, plane = %d, backingtexture = %u, level = %d, layer = %d", CID(context),
           plane, backingtexture, level, layer);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferTexturePixelLocalStorageANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6054,6 +6275,7 @@ void GL_APIENTRY GL_FramebufferTexturePixelLocalStorageANGLE(GLint plane,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6094,6 +6316,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalClearValuefvANGLE(GLint plane, const GL
     EVENT(context, GLFramebufferPixelLocalClearValuefvANGLE,
           "context = %d, plane = %d, value = 0x%016" PRIxPTR "", CID(context), plane,
           (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferPixelLocalClearValuefvANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6101,6 +6324,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalClearValuefvANGLE(GLint plane, const GL
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6141,6 +6365,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalClearValueivANGLE(GLint plane, const GL
     EVENT(context, GLFramebufferPixelLocalClearValueivANGLE,
           "context = %d, plane = %d, value = 0x%016" PRIxPTR "", CID(context), plane,
           (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferPixelLocalClearValueivANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6148,6 +6373,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalClearValueivANGLE(GLint plane, const GL
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6188,6 +6414,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalClearValueuivANGLE(GLint plane, const G
     EVENT(context, GLFramebufferPixelLocalClearValueuivANGLE,
           "context = %d, plane = %d, value = 0x%016" PRIxPTR "", CID(context), plane,
           (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferPixelLocalClearValueuivANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6195,6 +6422,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalClearValueuivANGLE(GLint plane, const G
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6234,6 +6462,7 @@ void GL_APIENTRY GL_BeginPixelLocalStorageANGLE(GLsizei n, const GLenum *loadops
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBeginPixelLocalStorageANGLE,
           "context = %d, n = %d, loadops = 0x%016" PRIxPTR "", CID(context), n, (uintptr_t)loadops);
+    ANGLE_PROFILE_ENTRY_POINT(GLBeginPixelLocalStorageANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6241,6 +6470,7 @@ void GL_APIENTRY GL_BeginPixelLocalStorageANGLE(GLsizei n, const GLenum *loadops
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6278,6 +6508,7 @@ void GL_APIENTRY GL_EndPixelLocalStorageANGLE(GLsizei n, const GLenum *storeops)
     EVENT(context, GLEndPixelLocalStorageANGLE,
           "context = %d, n = %d, storeops = 0x%016" PRIxPTR "", CID(context), n,
           (uintptr_t)storeops);
+    ANGLE_PROFILE_ENTRY_POINT(GLEndPixelLocalStorageANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6285,6 +6516,7 @@ void GL_APIENTRY GL_EndPixelLocalStorageANGLE(GLsizei n, const GLenum *storeops)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6320,6 +6552,7 @@ void GL_APIENTRY GL_PixelLocalStorageBarrierANGLE()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPixelLocalStorageBarrierANGLE, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLPixelLocalStorageBarrierANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6327,6 +6560,7 @@ void GL_APIENTRY GL_PixelLocalStorageBarrierANGLE()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6363,6 +6597,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalStorageInterruptANGLE()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferPixelLocalStorageInterruptANGLE, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferPixelLocalStorageInterruptANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6370,6 +6605,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalStorageInterruptANGLE()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6406,6 +6642,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalStorageRestoreANGLE()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferPixelLocalStorageRestoreANGLE, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferPixelLocalStorageRestoreANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6413,6 +6650,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalStorageRestoreANGLE()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6453,6 +6691,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterfvANGLE(GLint plane,
     EVENT(context, GLGetFramebufferPixelLocalStorageParameterfvANGLE,
           "context = %d, plane = %d, pname = %s, params = 0x%016" PRIxPTR "", CID(context), plane,
           GLenumToString(GLESEnum::PLSQueryFloat, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFramebufferPixelLocalStorageParameterfvANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6460,6 +6699,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterfvANGLE(GLint plane,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6502,6 +6742,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterivANGLE(GLint plane,
     EVENT(context, GLGetFramebufferPixelLocalStorageParameterivANGLE,
           "context = %d, plane = %d, pname = %s, params = 0x%016" PRIxPTR "", CID(context), plane,
           GLenumToString(GLESEnum::PLSQueryInt, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFramebufferPixelLocalStorageParameterivANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6509,6 +6750,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterivANGLE(GLint plane,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderPixelLocalStorageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6567,6 +6809,7 @@ void GL_APIENTRY GL_TexImage2DExternalANGLE(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, internalformat,
           width, height, border, GLenumToString(GLESEnum::PixelFormat, format),
           GLenumToString(GLESEnum::PixelType, type));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexImage2DExternalANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6575,6 +6818,7 @@ void GL_APIENTRY GL_TexImage2DExternalANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureExternalUpdateANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6614,6 +6858,7 @@ void GL_APIENTRY GL_InvalidateTextureANGLE(GLenum target)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLInvalidateTextureANGLE, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target));
+    ANGLE_PROFILE_ENTRY_POINT(GLInvalidateTextureANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6622,6 +6867,7 @@ void GL_APIENTRY GL_InvalidateTextureANGLE(GLenum target)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureExternalUpdateANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6667,6 +6913,7 @@ void GL_APIENTRY GL_TexStorage2DMultisampleANGLE(GLenum target,
           CID(context), GLenumToString(GLESEnum::AllEnums, target), samples,
           GLenumToString(GLESEnum::AllEnums, internalformat), width, height,
           GLbooleanToString(fixedsamplelocations));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorage2DMultisampleANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6675,6 +6922,7 @@ void GL_APIENTRY GL_TexStorage2DMultisampleANGLE(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureMultisampleANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6715,6 +6963,7 @@ void GL_APIENTRY GL_GetMultisamplefvANGLE(GLenum pname, GLuint index, GLfloat *v
     EVENT(context, GLGetMultisamplefvANGLE,
           "context = %d, pname = %s, index = %u, val = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::AllEnums, pname), index, (uintptr_t)val);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetMultisamplefvANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6722,6 +6971,7 @@ void GL_APIENTRY GL_GetMultisamplefvANGLE(GLenum pname, GLuint index, GLfloat *v
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureMultisampleANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6757,12 +7007,14 @@ void GL_APIENTRY GL_SampleMaskiANGLE(GLuint maskNumber, GLbitfield mask)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSampleMaskiANGLE, "context = %d, maskNumber = %u, mask = %s", CID(context),
           maskNumber, GLbitfieldToString(GLESEnum::AllEnums, mask).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLSampleMaskiANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureMultisampleANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6809,6 +7061,7 @@ void GL_APIENTRY GL_GetTranslatedShaderSourceANGLE(GLuint shader,
           "context = %d, shader = %u, bufSize = %d, length = 0x%016" PRIxPTR
           ", source = 0x%016" PRIxPTR "",
           CID(context), shader, bufSize, (uintptr_t)length, (uintptr_t)source);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTranslatedShaderSourceANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6817,6 +7070,7 @@ void GL_APIENTRY GL_GetTranslatedShaderSourceANGLE(GLuint shader,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().translatedShaderSourceANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6861,6 +7115,7 @@ void GL_APIENTRY GL_AcquireTexturesANGLE(GLuint numTextures,
           "context = %d, numTextures = %u, textures = 0x%016" PRIxPTR ", layouts = 0x%016" PRIxPTR
           "",
           CID(context), numTextures, (uintptr_t)textures, (uintptr_t)layouts);
+    ANGLE_PROFILE_ENTRY_POINT(GLAcquireTexturesANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6869,6 +7124,7 @@ void GL_APIENTRY GL_AcquireTexturesANGLE(GLuint numTextures,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().vulkanImageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6910,6 +7166,7 @@ void GL_APIENTRY GL_ReleaseTexturesANGLE(GLuint numTextures,
           "context = %d, numTextures = %u, textures = 0x%016" PRIxPTR ", layouts = 0x%016" PRIxPTR
           "",
           CID(context), numTextures, (uintptr_t)textures, (uintptr_t)layouts);
+    ANGLE_PROFILE_ENTRY_POINT(GLReleaseTexturesANGLE);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6918,6 +7175,7 @@ void GL_APIENTRY GL_ReleaseTexturesANGLE(GLuint numTextures,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().vulkanImageANGLE))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -6969,6 +7227,7 @@ void GL_APIENTRY GL_BindUniformLocationCHROMIUM(GLuint program, GLint location,
     EVENT(context, GLBindUniformLocationCHROMIUM,
           "context = %d, program = %u, location = %d, name = 0x%016" PRIxPTR "", CID(context),
           program, location, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindUniformLocationCHROMIUM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -6978,6 +7237,7 @@ void GL_APIENTRY GL_BindUniformLocationCHROMIUM(GLuint program, GLint location,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().bindUniformLocationCHROMIUM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7017,6 +7277,7 @@ void GL_APIENTRY GL_CompressedCopyTextureCHROMIUM(GLuint sourceId, GLuint destId
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedCopyTextureCHROMIUM, "context = %d, sourceId = %u, destId = %u",
           CID(context), sourceId, destId);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedCopyTextureCHROMIUM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7026,6 +7287,7 @@ void GL_APIENTRY GL_CompressedCopyTextureCHROMIUM(GLuint sourceId, GLuint destId
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().copyCompressedTextureCHROMIUM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7081,6 +7343,7 @@ void GL_APIENTRY GL_CopyTextureCHROMIUM(GLuint sourceId,
           destId, destLevel, internalFormat, GLenumToString(GLESEnum::AllEnums, destType),
           GLbooleanToString(unpackFlipY), GLbooleanToString(unpackPremultiplyAlpha),
           GLbooleanToString(unpackUnmultiplyAlpha));
+    ANGLE_PROFILE_ENTRY_POINT(GLCopyTextureCHROMIUM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7091,6 +7354,7 @@ void GL_APIENTRY GL_CopyTextureCHROMIUM(GLuint sourceId,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().copyTextureCHROMIUM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7150,6 +7414,7 @@ void GL_APIENTRY GL_CopySubTextureCHROMIUM(GLuint sourceId,
           CID(context), sourceId, sourceLevel, GLenumToString(GLESEnum::AllEnums, destTarget),
           destId, destLevel, xoffset, yoffset, x, y, width, height, GLbooleanToString(unpackFlipY),
           GLbooleanToString(unpackPremultiplyAlpha), GLbooleanToString(unpackUnmultiplyAlpha));
+    ANGLE_PROFILE_ENTRY_POINT(GLCopySubTextureCHROMIUM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7160,6 +7425,7 @@ void GL_APIENTRY GL_CopySubTextureCHROMIUM(GLuint sourceId,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().copyTextureCHROMIUM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7202,12 +7468,14 @@ void GL_APIENTRY GL_CoverageModulationCHROMIUM(GLenum components)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCoverageModulationCHROMIUM, "context = %d, components = %s", CID(context),
           GLenumToString(GLESEnum::AllEnums, components));
+    ANGLE_PROFILE_ENTRY_POINT(GLCoverageModulationCHROMIUM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferMixedSamplesCHROMIUM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7248,6 +7516,7 @@ void GL_APIENTRY GL_LoseContextCHROMIUM(GLenum current, GLenum other)
     EVENT(context, GLLoseContextCHROMIUM, "context = %d, current = %s, other = %s", CID(context),
           GLenumToString(GLESEnum::GraphicsResetStatus, current),
           GLenumToString(GLESEnum::GraphicsResetStatus, other));
+    ANGLE_PROFILE_ENTRY_POINT(GLLoseContextCHROMIUM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7257,6 +7526,7 @@ void GL_APIENTRY GL_LoseContextCHROMIUM(GLenum current, GLenum other)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().loseContextCHROMIUM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7299,6 +7569,7 @@ void GL_APIENTRY GL_EGLImageTargetTexStorageEXT(GLenum target,
           "context = %d, target = %s, image = 0x%016" PRIxPTR ", attrib_list = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, target), (uintptr_t)image,
           (uintptr_t)attrib_list);
+    ANGLE_PROFILE_ENTRY_POINT(GLEGLImageTargetTexStorageEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7307,6 +7578,7 @@ void GL_APIENTRY GL_EGLImageTargetTexStorageEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().EGLImageStorageEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7357,6 +7629,7 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstanceEXT(GLenum mode,
           "context = %d, mode = %s, first = %d, count = %d, instancecount = %d, baseinstance = %u",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), first, count, instancecount,
           baseinstance);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawArraysInstancedBaseInstanceEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7365,6 +7638,7 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstanceEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().baseInstanceEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7414,6 +7688,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseInstanceEXT(GLenum mode,
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, instancecount,
           baseinstance);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsInstancedBaseInstanceEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7423,6 +7698,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseInstanceEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().baseInstanceEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7473,6 +7749,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstanceEXT(GLenum mode,
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, instancecount,
           basevertex, baseinstance);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsInstancedBaseVertexBaseInstanceEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7482,6 +7759,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstanceEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().baseInstanceEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7526,6 +7804,7 @@ void GL_APIENTRY GL_BindFragDataLocationEXT(GLuint program, GLuint color, const
     EVENT(context, GLBindFragDataLocationEXT,
           "context = %d, program = %u, color = %u, name = 0x%016" PRIxPTR "", CID(context), program,
           color, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindFragDataLocationEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7534,6 +7813,7 @@ void GL_APIENTRY GL_BindFragDataLocationEXT(GLuint program, GLuint color, const
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().blendFuncExtendedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7575,6 +7855,7 @@ void GL_APIENTRY GL_BindFragDataLocationIndexedEXT(GLuint program,
     EVENT(context, GLBindFragDataLocationIndexedEXT,
           "context = %d, program = %u, colorNumber = %u, index = %u, name = 0x%016" PRIxPTR "",
           CID(context), program, colorNumber, index, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindFragDataLocationIndexedEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7583,6 +7864,7 @@ void GL_APIENTRY GL_BindFragDataLocationIndexedEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().blendFuncExtendedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7622,6 +7904,7 @@ GLint GL_APIENTRY GL_GetFragDataIndexEXT(GLuint program, const GLchar *name)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFragDataIndexEXT, "context = %d, program = %u, name = 0x%016" PRIxPTR "",
           CID(context), program, (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFragDataIndexEXT);
 
     GLint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -7631,6 +7914,7 @@ GLint GL_APIENTRY GL_GetFragDataIndexEXT(GLuint program, const GLchar *name)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().blendFuncExtendedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7677,6 +7961,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocationIndexEXT(GLuint program,
           "context = %d, program = %u, programInterface = %s, name = 0x%016" PRIxPTR "",
           CID(context), program, GLenumToString(GLESEnum::ProgramInterface, programInterface),
           (uintptr_t)name);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramResourceLocationIndexEXT);
 
     GLint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -7686,6 +7971,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocationIndexEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().blendFuncExtendedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7744,6 +8030,7 @@ void GL_APIENTRY GL_BufferStorageEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::BufferStorageTarget, target),
           static_cast<unsigned long long>(size), (uintptr_t)data,
           GLbitfieldToString(GLESEnum::BufferStorageMask, flags).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLBufferStorageEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7752,6 +8039,7 @@ void GL_APIENTRY GL_BufferStorageEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().bufferStorageEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7801,6 +8089,7 @@ GL_ClearTexImageEXT(GLuint texture, GLint level, GLenum format, GLenum type, con
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().clearTextureEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7852,6 +8141,7 @@ void GL_APIENTRY GL_ClearTexSubImageEXT(GLuint texture,
           CID(context), texture, level, xoffset, yoffset, zoffset, width, height, depth,
           GLenumToString(GLESEnum::PixelFormat, format), GLenumToString(GLESEnum::PixelType, type),
           (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLClearTexSubImageEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7860,6 +8150,7 @@ void GL_APIENTRY GL_ClearTexSubImageEXT(GLuint texture,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().clearTextureEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7899,6 +8190,7 @@ void GL_APIENTRY GL_ClipControlEXT(GLenum origin, GLenum depth)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClipControlEXT, "context = %d, origin = %s, depth = %s", CID(context),
           GLenumToString(GLESEnum::AllEnums, origin), GLenumToString(GLESEnum::AllEnums, depth));
+    ANGLE_PROFILE_ENTRY_POINT(GLClipControlEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7907,6 +8199,7 @@ void GL_APIENTRY GL_ClipControlEXT(GLenum origin, GLenum depth)
         bool isCallValid          = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().clipControlEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -7974,6 +8267,7 @@ void GL_APIENTRY GL_CopyImageSubDataEXT(GLuint srcName,
           srcLevel, srcX, srcY, srcZ, dstName,
           GLenumToString(GLESEnum::CopyBufferSubDataTarget, dstTarget), dstLevel, dstX, dstY, dstZ,
           srcWidth, srcHeight, srcDepth);
+    ANGLE_PROFILE_ENTRY_POINT(GLCopyImageSubDataEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -7981,6 +8275,7 @@ void GL_APIENTRY GL_CopyImageSubDataEXT(GLuint srcName,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().copyImageEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8034,6 +8329,7 @@ GL_GetObjectLabelEXT(GLenum type, GLuint object, GLsizei bufSize, GLsizei *lengt
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugLabelEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8072,6 +8368,7 @@ void GL_APIENTRY GL_LabelObjectEXT(GLenum type, GLuint object, GLsizei length, c
     EVENT(context, GLLabelObjectEXT,
           "context = %d, type = %s, object = %u, length = %d, label = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, type), object, length, (uintptr_t)label);
+    ANGLE_PROFILE_ENTRY_POINT(GLLabelObjectEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8079,6 +8376,7 @@ void GL_APIENTRY GL_LabelObjectEXT(GLenum type, GLuint object, GLsizei length, c
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugLabelEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8117,6 +8415,7 @@ void GL_APIENTRY GL_InsertEventMarkerEXT(GLsizei length, const GLchar *marker)
     // It can interfere with the debug events being set by the caller.
     // EVENT(context, GLInsertEventMarkerEXT, "context = %d, length = %d, marker = 0x%016" PRIxPTR
     // "", CID(context), length, (uintptr_t)marker);
+    ANGLE_PROFILE_ENTRY_POINT(GLInsertEventMarkerEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8124,6 +8423,7 @@ void GL_APIENTRY GL_InsertEventMarkerEXT(GLsizei length, const GLchar *marker)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugMarkerEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8160,6 +8460,7 @@ void GL_APIENTRY GL_PopGroupMarkerEXT()
     // Don't run the EVENT() macro on the EXT_debug_marker entry points.
     // It can interfere with the debug events being set by the caller.
     // EVENT(context, GLPopGroupMarkerEXT, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLPopGroupMarkerEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8167,6 +8468,7 @@ void GL_APIENTRY GL_PopGroupMarkerEXT()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugMarkerEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8204,6 +8506,7 @@ void GL_APIENTRY GL_PushGroupMarkerEXT(GLsizei length, const GLchar *marker)
     // It can interfere with the debug events being set by the caller.
     // EVENT(context, GLPushGroupMarkerEXT, "context = %d, length = %d, marker = 0x%016" PRIxPTR "",
     // CID(context), length, (uintptr_t)marker);
+    ANGLE_PROFILE_ENTRY_POINT(GLPushGroupMarkerEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8211,6 +8514,7 @@ void GL_APIENTRY GL_PushGroupMarkerEXT(GLsizei length, const GLchar *marker)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugMarkerEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8253,6 +8557,7 @@ void GL_APIENTRY GL_DiscardFramebufferEXT(GLenum target,
           "context = %d, target = %s, numAttachments = %d, attachments = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target), numAttachments,
           (uintptr_t)attachments);
+    ANGLE_PROFILE_ENTRY_POINT(GLDiscardFramebufferEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8264,6 +8569,7 @@ void GL_APIENTRY GL_DiscardFramebufferEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().discardFramebufferEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8302,6 +8608,7 @@ void GL_APIENTRY GL_BeginQueryEXT(GLenum target, GLuint id)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBeginQueryEXT, "context = %d, target = %s, id = %u", CID(context),
           GLenumToString(GLESEnum::QueryTarget, target), id);
+    ANGLE_PROFILE_ENTRY_POINT(GLBeginQueryEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8311,6 +8618,7 @@ void GL_APIENTRY GL_BeginQueryEXT(GLenum target, GLuint id)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT ||
                              context->getExtensions().occlusionQueryBooleanEXT))
             {
@@ -8347,6 +8655,7 @@ void GL_APIENTRY GL_DeleteQueriesEXT(GLsizei n, const GLuint *ids)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteQueriesEXT, "context = %d, n = %d, ids = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)ids);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteQueriesEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8355,6 +8664,7 @@ void GL_APIENTRY GL_DeleteQueriesEXT(GLsizei n, const GLuint *ids)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT ||
                              context->getExtensions().occlusionQueryBooleanEXT))
             {
@@ -8391,6 +8701,7 @@ void GL_APIENTRY GL_EndQueryEXT(GLenum target)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndQueryEXT, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::QueryTarget, target));
+    ANGLE_PROFILE_ENTRY_POINT(GLEndQueryEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8399,6 +8710,7 @@ void GL_APIENTRY GL_EndQueryEXT(GLenum target)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT ||
                              context->getExtensions().occlusionQueryBooleanEXT))
             {
@@ -8435,6 +8747,7 @@ void GL_APIENTRY GL_GenQueriesEXT(GLsizei n, GLuint *ids)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenQueriesEXT, "context = %d, n = %d, ids = 0x%016" PRIxPTR "", CID(context),
           n, (uintptr_t)ids);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenQueriesEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8443,6 +8756,7 @@ void GL_APIENTRY GL_GenQueriesEXT(GLsizei n, GLuint *ids)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT ||
                              context->getExtensions().occlusionQueryBooleanEXT))
             {
@@ -8479,6 +8793,7 @@ void GL_APIENTRY GL_GetInteger64vEXT(GLenum pname, GLint64 *data)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetInteger64vEXT, "context = %d, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetInteger64vEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8486,6 +8801,7 @@ void GL_APIENTRY GL_GetInteger64vEXT(GLenum pname, GLint64 *data)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8522,6 +8838,7 @@ void GL_APIENTRY GL_GetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 *para
     EVENT(context, GLGetQueryObjecti64vEXT,
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
           GLenumToString(GLESEnum::QueryObjectParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryObjecti64vEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8530,6 +8847,7 @@ void GL_APIENTRY GL_GetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 *para
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8565,6 +8883,7 @@ void GL_APIENTRY GL_GetQueryObjectivEXT(GLuint id, GLenum pname, GLint *params)
     EVENT(context, GLGetQueryObjectivEXT,
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
           GLenumToString(GLESEnum::QueryObjectParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryObjectivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8573,6 +8892,7 @@ void GL_APIENTRY GL_GetQueryObjectivEXT(GLuint id, GLenum pname, GLint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8608,6 +8928,7 @@ void GL_APIENTRY GL_GetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 *pa
     EVENT(context, GLGetQueryObjectui64vEXT,
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
           GLenumToString(GLESEnum::QueryObjectParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryObjectui64vEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8616,6 +8937,7 @@ void GL_APIENTRY GL_GetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 *pa
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8651,6 +8973,7 @@ void GL_APIENTRY GL_GetQueryObjectuivEXT(GLuint id, GLenum pname, GLuint *params
     EVENT(context, GLGetQueryObjectuivEXT,
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
           GLenumToString(GLESEnum::QueryObjectParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryObjectuivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8659,6 +8982,7 @@ void GL_APIENTRY GL_GetQueryObjectuivEXT(GLuint id, GLenum pname, GLuint *params
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT ||
                              context->getExtensions().occlusionQueryBooleanEXT))
             {
@@ -8696,6 +9020,7 @@ void GL_APIENTRY GL_GetQueryivEXT(GLenum target, GLenum pname, GLint *params)
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::QueryTarget, target),
           GLenumToString(GLESEnum::QueryParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetQueryivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8704,6 +9029,7 @@ void GL_APIENTRY GL_GetQueryivEXT(GLenum target, GLenum pname, GLint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT ||
                              context->getExtensions().occlusionQueryBooleanEXT))
             {
@@ -8739,6 +9065,7 @@ GLboolean GL_APIENTRY GL_IsQueryEXT(GLuint id)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsQueryEXT, "context = %d, id = %u", CID(context), id);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsQueryEXT);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -8748,6 +9075,7 @@ GLboolean GL_APIENTRY GL_IsQueryEXT(GLuint id)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT ||
                              context->getExtensions().occlusionQueryBooleanEXT))
             {
@@ -8790,6 +9118,7 @@ void GL_APIENTRY GL_QueryCounterEXT(GLuint id, GLenum target)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLQueryCounterEXT, "context = %d, id = %u, target = %s", CID(context), id,
           GLenumToString(GLESEnum::QueryCounterTarget, target));
+    ANGLE_PROFILE_ENTRY_POINT(GLQueryCounterEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8799,6 +9128,7 @@ void GL_APIENTRY GL_QueryCounterEXT(GLuint id, GLenum target)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().disjointTimerQueryEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8835,6 +9165,7 @@ void GL_APIENTRY GL_DrawBuffersEXT(GLsizei n, const GLenum *bufs)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawBuffersEXT, "context = %d, n = %d, bufs = 0x%016" PRIxPTR "", CID(context),
           n, (uintptr_t)bufs);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawBuffersEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -8842,6 +9173,7 @@ void GL_APIENTRY GL_DrawBuffersEXT(GLsizei n, const GLenum *bufs)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8880,12 +9212,14 @@ void GL_APIENTRY GL_BlendEquationSeparateiEXT(GLuint buf, GLenum modeRGB, GLenum
           "context = %d, buf = %u, modeRGB = %s, modeAlpha = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendEquationModeEXT, modeRGB),
           GLenumToString(GLESEnum::BlendEquationModeEXT, modeAlpha));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendEquationSeparateiEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8925,12 +9259,14 @@ void GL_APIENTRY GL_BlendEquationiEXT(GLuint buf, GLenum mode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationiEXT, "context = %d, buf = %u, mode = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendEquationModeEXT, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendEquationiEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -8979,6 +9315,7 @@ GL_BlendFuncSeparateiEXT(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlp
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9020,12 +9357,14 @@ void GL_APIENTRY GL_BlendFunciEXT(GLuint buf, GLenum src, GLenum dst)
     EVENT(context, GLBlendFunciEXT, "context = %d, buf = %u, src = %s, dst = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendingFactor, src),
           GLenumToString(GLESEnum::BlendingFactor, dst));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendFunciEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9064,12 +9403,14 @@ void GL_APIENTRY GL_ColorMaskiEXT(GLuint index, GLboolean r, GLboolean g, GLbool
     EVENT(context, GLColorMaskiEXT, "context = %d, index = %u, r = %s, g = %s, b = %s, a = %s",
           CID(context), index, GLbooleanToString(r), GLbooleanToString(g), GLbooleanToString(b),
           GLbooleanToString(a));
+    ANGLE_PROFILE_ENTRY_POINT(GLColorMaskiEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9107,12 +9448,14 @@ void GL_APIENTRY GL_DisableiEXT(GLenum target, GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisableiEXT, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLDisableiEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9150,12 +9493,14 @@ void GL_APIENTRY GL_EnableiEXT(GLenum target, GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnableiEXT, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLEnableiEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9193,6 +9538,7 @@ GLboolean GL_APIENTRY GL_IsEnablediEXT(GLenum target, GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsEnablediEXT, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsEnablediEXT);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -9200,6 +9546,7 @@ GLboolean GL_APIENTRY GL_IsEnablediEXT(GLenum target, GLuint index)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9252,6 +9599,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexEXT(GLenum mode,
           ", basevertex = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, basevertex);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsBaseVertexEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9261,6 +9609,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawElementsBaseVertexEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9308,6 +9657,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexEXT(GLenum mode,
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, instancecount,
           basevertex);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsInstancedBaseVertexEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9317,6 +9667,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawElementsBaseVertexEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9366,6 +9717,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexEXT(GLenum mode,
           "0x%016" PRIxPTR ", basevertex = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), start, end, count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, basevertex);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawRangeElementsBaseVertexEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9375,6 +9727,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawElementsBaseVertexEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9424,6 +9777,7 @@ void GL_APIENTRY GL_MultiDrawElementsBaseVertexEXT(GLenum mode,
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, drawcount,
           (uintptr_t)basevertex);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiDrawElementsBaseVertexEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9433,6 +9787,7 @@ void GL_APIENTRY GL_MultiDrawElementsBaseVertexEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawElementsBaseVertexEXT ||
                              context->getExtensions().drawElementsBaseVertexOES))
             {
@@ -9479,6 +9834,7 @@ void GL_APIENTRY GL_DrawArraysInstancedEXT(GLenum mode,
     EVENT(context, GLDrawArraysInstancedEXT,
           "context = %d, mode = %s, start = %d, count = %d, primcount = %d", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, mode), start, count, primcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawArraysInstancedEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9487,6 +9843,7 @@ void GL_APIENTRY GL_DrawArraysInstancedEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawInstancedEXT ||
                              context->getExtensions().instancedArraysEXT))
             {
@@ -9532,6 +9889,7 @@ void GL_APIENTRY GL_DrawElementsInstancedEXT(GLenum mode,
           ", primcount = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, primcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsInstancedEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9541,6 +9899,7 @@ void GL_APIENTRY GL_DrawElementsInstancedEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawInstancedEXT ||
                              context->getExtensions().instancedArraysEXT))
             {
@@ -9589,6 +9948,7 @@ void GL_APIENTRY GL_BufferStorageExternalEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::AllEnums, target),
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(size),
           (uintptr_t)clientBuffer, GLbitfieldToString(GLESEnum::BufferStorageMask, flags).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLBufferStorageExternalEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9597,6 +9957,7 @@ void GL_APIENTRY GL_BufferStorageExternalEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().externalBufferEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9648,6 +10009,7 @@ void GL_APIENTRY GL_FramebufferShadingRateEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment), texture, baseLayer,
           numLayers, texelWidth, texelHeight);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferShadingRateEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9655,6 +10017,7 @@ void GL_APIENTRY GL_FramebufferShadingRateEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fragmentShadingRateEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9699,6 +10062,7 @@ void GL_APIENTRY GL_GetFragmentShadingRatesEXT(GLsizei samples,
           "context = %d, samples = %d, maxCount = %d, count = 0x%016" PRIxPTR
           ", shadingRates = 0x%016" PRIxPTR "",
           CID(context), samples, maxCount, (uintptr_t)count, (uintptr_t)shadingRates);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFragmentShadingRatesEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9706,6 +10070,7 @@ void GL_APIENTRY GL_GetFragmentShadingRatesEXT(GLsizei samples,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fragmentShadingRateEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9744,6 +10109,7 @@ void GL_APIENTRY GL_ShadingRateEXT(GLenum rate)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLShadingRateEXT, "context = %d, rate = %s", CID(context),
           GLenumToString(GLESEnum::ShadingRate, rate));
+    ANGLE_PROFILE_ENTRY_POINT(GLShadingRateEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9751,6 +10117,7 @@ void GL_APIENTRY GL_ShadingRateEXT(GLenum rate)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fragmentShadingRateEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9789,6 +10156,7 @@ void GL_APIENTRY GL_ShadingRateCombinerOpsEXT(GLenum combinerOp0, GLenum combine
     EVENT(context, GLShadingRateCombinerOpsEXT, "context = %d, combinerOp0 = %s, combinerOp1 = %s",
           CID(context), GLenumToString(GLESEnum::ShadingRateCombinerOp, combinerOp0),
           GLenumToString(GLESEnum::ShadingRateCombinerOp, combinerOp1));
+    ANGLE_PROFILE_ENTRY_POINT(GLShadingRateCombinerOpsEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9797,6 +10165,7 @@ void GL_APIENTRY GL_ShadingRateCombinerOpsEXT(GLenum combinerOp0, GLenum combine
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fragmentShadingRateEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9844,6 +10213,7 @@ void GL_APIENTRY GL_FramebufferTextureEXT(GLenum target,
           "context = %d, target = %s, attachment = %s, texture = %u, level = %d", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment), texture, level);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferTextureEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9856,6 +10226,7 @@ void GL_APIENTRY GL_FramebufferTextureEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().geometryShaderEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9896,12 +10267,14 @@ void GL_APIENTRY GL_VertexAttribDivisorEXT(GLuint index, GLuint divisor)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribDivisorEXT, "context = %d, index = %u, divisor = %u", CID(context),
           index, divisor);
+    ANGLE_PROFILE_ENTRY_POINT(GLVertexAttribDivisorEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().instancedArraysEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9947,6 +10320,7 @@ void GL_APIENTRY GL_FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GL
           "context = %d, target = %s, offset = %llu, length = %llu", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target),
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(length));
+    ANGLE_PROFILE_ENTRY_POINT(GLFlushMappedBufferRangeEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -9955,6 +10329,7 @@ void GL_APIENTRY GL_FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GL
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().mapBufferRangeEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -9999,6 +10374,7 @@ void *GL_APIENTRY GL_MapBufferRangeEXT(GLenum target,
           GLenumToString(GLESEnum::BufferTargetARB, target),
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(length),
           GLbitfieldToString(GLESEnum::MapBufferAccessMask, access).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLMapBufferRangeEXT);
 
     void *returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -10008,6 +10384,7 @@ void *GL_APIENTRY GL_MapBufferRangeEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().mapBufferRangeEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10057,6 +10434,7 @@ void GL_APIENTRY GL_BufferStorageMemEXT(GLenum target,
           "context = %d, target = %s, size = %llu, memory = %u, offset = %llu", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target), static_cast<unsigned long long>(size),
           memory, static_cast<unsigned long long>(offset));
+    ANGLE_PROFILE_ENTRY_POINT(GLBufferStorageMemEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10066,6 +10444,7 @@ void GL_APIENTRY GL_BufferStorageMemEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10104,6 +10483,7 @@ void GL_APIENTRY GL_CreateMemoryObjectsEXT(GLsizei n, GLuint *memoryObjects)
     EVENT(context, GLCreateMemoryObjectsEXT,
           "context = %d, n = %d, memoryObjects = 0x%016" PRIxPTR "", CID(context), n,
           (uintptr_t)memoryObjects);
+    ANGLE_PROFILE_ENTRY_POINT(GLCreateMemoryObjectsEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10112,6 +10492,7 @@ void GL_APIENTRY GL_CreateMemoryObjectsEXT(GLsizei n, GLuint *memoryObjects)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10148,6 +10529,7 @@ void GL_APIENTRY GL_DeleteMemoryObjectsEXT(GLsizei n, const GLuint *memoryObject
     EVENT(context, GLDeleteMemoryObjectsEXT,
           "context = %d, n = %d, memoryObjects = 0x%016" PRIxPTR "", CID(context), n,
           (uintptr_t)memoryObjects);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteMemoryObjectsEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10157,6 +10539,7 @@ void GL_APIENTRY GL_DeleteMemoryObjectsEXT(GLsizei n, const GLuint *memoryObject
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10194,6 +10577,7 @@ void GL_APIENTRY GL_GetMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pn
           "context = %d, memoryObject = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           memoryObject, GLenumToString(GLESEnum::MemoryObjectParameterName, pname),
           (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetMemoryObjectParameterivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10202,6 +10586,7 @@ void GL_APIENTRY GL_GetMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pn
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10241,6 +10626,7 @@ void GL_APIENTRY GL_GetUnsignedBytevEXT(GLenum pname, GLubyte *data)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUnsignedBytevEXT, "context = %d, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUnsignedBytevEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10248,6 +10634,7 @@ void GL_APIENTRY GL_GetUnsignedBytevEXT(GLenum pname, GLubyte *data)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT ||
                              context->getExtensions().semaphoreEXT))
             {
@@ -10285,6 +10672,7 @@ void GL_APIENTRY GL_GetUnsignedBytei_vEXT(GLenum target, GLuint index, GLubyte *
     EVENT(context, GLGetUnsignedBytei_vEXT,
           "context = %d, target = %s, index = %u, data = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::AllEnums, target), index, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetUnsignedBytei_vEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10292,6 +10680,7 @@ void GL_APIENTRY GL_GetUnsignedBytei_vEXT(GLenum target, GLuint index, GLubyte *
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT ||
                              context->getExtensions().semaphoreEXT))
             {
@@ -10328,6 +10717,7 @@ GLboolean GL_APIENTRY GL_IsMemoryObjectEXT(GLuint memoryObject)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsMemoryObjectEXT, "context = %d, memoryObject = %u", CID(context),
           memoryObject);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsMemoryObjectEXT);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -10337,6 +10727,7 @@ GLboolean GL_APIENTRY GL_IsMemoryObjectEXT(GLuint memoryObject)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10383,6 +10774,7 @@ void GL_APIENTRY GL_MemoryObjectParameterivEXT(GLuint memoryObject,
           "context = %d, memoryObject = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           memoryObject, GLenumToString(GLESEnum::MemoryObjectParameterName, pname),
           (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLMemoryObjectParameterivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10391,6 +10783,7 @@ void GL_APIENTRY GL_MemoryObjectParameterivEXT(GLuint memoryObject,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10439,6 +10832,7 @@ void GL_APIENTRY GL_TexStorageMem2DEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), levels,
           GLenumToString(GLESEnum::SizedInternalFormat, internalFormat), width, height, memory,
           static_cast<unsigned long long>(offset));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorageMem2DEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10448,6 +10842,7 @@ void GL_APIENTRY GL_TexStorageMem2DEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10497,6 +10892,7 @@ void GL_APIENTRY GL_TexStorageMem2DMultisampleEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), samples,
           GLenumToString(GLESEnum::SizedInternalFormat, internalFormat), width, height,
           GLbooleanToString(fixedSampleLocations), memory, static_cast<unsigned long long>(offset));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorageMem2DMultisampleEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10506,6 +10902,7 @@ void GL_APIENTRY GL_TexStorageMem2DMultisampleEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10558,6 +10955,7 @@ void GL_APIENTRY GL_TexStorageMem3DEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), levels,
           GLenumToString(GLESEnum::SizedInternalFormat, internalFormat), width, height, depth,
           memory, static_cast<unsigned long long>(offset));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorageMem3DEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10567,6 +10965,7 @@ void GL_APIENTRY GL_TexStorageMem3DEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10617,6 +11016,7 @@ void GL_APIENTRY GL_TexStorageMem3DMultisampleEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), samples,
           GLenumToString(GLESEnum::SizedInternalFormat, internalFormat), width, height, depth,
           GLbooleanToString(fixedSampleLocations), memory, static_cast<unsigned long long>(offset));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorageMem3DMultisampleEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10626,6 +11026,7 @@ void GL_APIENTRY GL_TexStorageMem3DMultisampleEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10672,6 +11073,7 @@ void GL_APIENTRY GL_ImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handl
           "context = %d, memory = %u, size = %llu, handleType = %s, fd = %d", CID(context), memory,
           static_cast<unsigned long long>(size),
           GLenumToString(GLESEnum::ExternalHandleType, handleType), fd);
+    ANGLE_PROFILE_ENTRY_POINT(GLImportMemoryFdEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10681,6 +11083,7 @@ void GL_APIENTRY GL_ImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handl
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().memoryObjectFdEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10725,6 +11128,7 @@ void GL_APIENTRY GL_MultiDrawArraysEXT(GLenum mode,
           ", primcount = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)first,
           (uintptr_t)count, primcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiDrawArraysEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10733,6 +11137,7 @@ void GL_APIENTRY GL_MultiDrawArraysEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multiDrawArraysEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10777,6 +11182,7 @@ void GL_APIENTRY GL_MultiDrawElementsEXT(GLenum mode,
           ", primcount = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, primcount);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiDrawElementsEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10786,6 +11192,7 @@ void GL_APIENTRY GL_MultiDrawElementsEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multiDrawArraysEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10829,6 +11236,7 @@ void GL_APIENTRY GL_MultiDrawArraysIndirectEXT(GLenum mode,
           "context = %d, mode = %s, indirect = 0x%016" PRIxPTR ", drawcount = %d, stride = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)indirect,
           drawcount, stride);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiDrawArraysIndirectEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10837,6 +11245,7 @@ void GL_APIENTRY GL_MultiDrawArraysIndirectEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multiDrawIndirectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10882,6 +11291,7 @@ void GL_APIENTRY GL_MultiDrawElementsIndirectEXT(GLenum mode,
           ", drawcount = %d, stride = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode),
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indirect, drawcount, stride);
+    ANGLE_PROFILE_ENTRY_POINT(GLMultiDrawElementsIndirectEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10891,6 +11301,7 @@ void GL_APIENTRY GL_MultiDrawElementsIndirectEXT(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multiDrawIndirectEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10939,6 +11350,7 @@ void GL_APIENTRY GL_FramebufferTexture2DMultisampleEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment),
           GLenumToString(GLESEnum::TextureTarget, textarget), texture, level, samples);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferTexture2DMultisampleEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -10952,6 +11364,7 @@ void GL_APIENTRY GL_FramebufferTexture2DMultisampleEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multisampledRenderToTextureEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -10998,6 +11411,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleEXT(GLenum target,
           "context = %d, target = %s, samples = %d, internalformat = %s, width = %d, height = %d",
           CID(context), GLenumToString(GLESEnum::RenderbufferTarget, target), samples,
           GLenumToString(GLESEnum::InternalFormat, internalformat), width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLRenderbufferStorageMultisampleEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11005,6 +11419,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multisampledRenderToTextureEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11063,12 +11478,14 @@ void GL_APIENTRY GL_PolygonOffsetClampEXT(GLfloat factor, GLfloat units, GLfloat
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPolygonOffsetClampEXT, "context = %d, factor = %f, units = %f, clamp = %f",
           CID(context), factor, units, clamp);
+    ANGLE_PROFILE_ENTRY_POINT(GLPolygonOffsetClampEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().polygonOffsetClampEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11117,12 +11534,14 @@ void GL_APIENTRY GL_PrimitiveBoundingBoxEXT(GLfloat minX,
           "context = %d, minX = %f, minY = %f, minZ = %f, minW = %f, maxX = %f, maxY = %f, maxZ = "
           "%f, maxW = %f",
           CID(context), minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
+    ANGLE_PROFILE_ENTRY_POINT(GLPrimitiveBoundingBoxEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().primitiveBoundingBoxEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11172,6 +11591,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatusEXT()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetGlobalContext();
     EVENT(context, GLGetGraphicsResetStatusEXT, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLGetGraphicsResetStatusEXT);
 
     GLenum returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -11180,6 +11600,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatusEXT()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustnessEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11227,6 +11648,7 @@ void GL_APIENTRY GL_GetnUniformfvEXT(GLuint program,
     EVENT(context, GLGetnUniformfvEXT,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformfvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11236,6 +11658,7 @@ void GL_APIENTRY GL_GetnUniformfvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustnessEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11274,6 +11697,7 @@ void GL_APIENTRY GL_GetnUniformivEXT(GLuint program, GLint location, GLsizei buf
     EVENT(context, GLGetnUniformivEXT,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11283,6 +11707,7 @@ void GL_APIENTRY GL_GetnUniformivEXT(GLuint program, GLint location, GLsizei buf
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustnessEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11330,6 +11755,7 @@ void GL_APIENTRY GL_ReadnPixelsEXT(GLint x,
           "= %d, data = 0x%016" PRIxPTR "",
           CID(context), x, y, width, height, GLenumToString(GLESEnum::PixelFormat, format),
           GLenumToString(GLESEnum::PixelType, type), bufSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLReadnPixelsEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11337,6 +11763,7 @@ void GL_APIENTRY GL_ReadnPixelsEXT(GLint x,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustnessEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11379,6 +11806,7 @@ void GL_APIENTRY GL_DeleteSemaphoresEXT(GLsizei n, const GLuint *semaphores)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteSemaphoresEXT, "context = %d, n = %d, semaphores = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)semaphores);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteSemaphoresEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11387,6 +11815,7 @@ void GL_APIENTRY GL_DeleteSemaphoresEXT(GLsizei n, const GLuint *semaphores)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().semaphoreEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11422,6 +11851,7 @@ void GL_APIENTRY GL_GenSemaphoresEXT(GLsizei n, GLuint *semaphores)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenSemaphoresEXT, "context = %d, n = %d, semaphores = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)semaphores);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenSemaphoresEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11430,6 +11860,7 @@ void GL_APIENTRY GL_GenSemaphoresEXT(GLsizei n, GLuint *semaphores)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().semaphoreEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11466,6 +11897,7 @@ void GL_APIENTRY GL_GetSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname
     EVENT(context, GLGetSemaphoreParameterui64vEXT,
           "context = %d, semaphore = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           semaphore, GLenumToString(GLESEnum::SemaphoreParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSemaphoreParameterui64vEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11474,6 +11906,7 @@ void GL_APIENTRY GL_GetSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().semaphoreEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11512,6 +11945,7 @@ GLboolean GL_APIENTRY GL_IsSemaphoreEXT(GLuint semaphore)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsSemaphoreEXT, "context = %d, semaphore = %u", CID(context), semaphore);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsSemaphoreEXT);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -11521,6 +11955,7 @@ GLboolean GL_APIENTRY GL_IsSemaphoreEXT(GLuint semaphore)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().semaphoreEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11565,6 +12000,7 @@ void GL_APIENTRY GL_SemaphoreParameterui64vEXT(GLuint semaphore,
     EVENT(context, GLSemaphoreParameterui64vEXT,
           "context = %d, semaphore = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           semaphore, GLenumToString(GLESEnum::SemaphoreParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLSemaphoreParameterui64vEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11573,6 +12009,7 @@ void GL_APIENTRY GL_SemaphoreParameterui64vEXT(GLuint semaphore,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().semaphoreEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11619,6 +12056,7 @@ void GL_APIENTRY GL_SignalSemaphoreEXT(GLuint semaphore,
           ", numTextureBarriers = %u, textures = 0x%016" PRIxPTR ", dstLayouts = 0x%016" PRIxPTR "",
           CID(context), semaphore, numBufferBarriers, (uintptr_t)buffers, numTextureBarriers,
           (uintptr_t)textures, (uintptr_t)dstLayouts);
+    ANGLE_PROFILE_ENTRY_POINT(GLSignalSemaphoreEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11629,6 +12067,7 @@ void GL_APIENTRY GL_SignalSemaphoreEXT(GLuint semaphore,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().semaphoreEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11677,6 +12116,7 @@ void GL_APIENTRY GL_WaitSemaphoreEXT(GLuint semaphore,
           ", numTextureBarriers = %u, textures = 0x%016" PRIxPTR ", srcLayouts = 0x%016" PRIxPTR "",
           CID(context), semaphore, numBufferBarriers, (uintptr_t)buffers, numTextureBarriers,
           (uintptr_t)textures, (uintptr_t)srcLayouts);
+    ANGLE_PROFILE_ENTRY_POINT(GLWaitSemaphoreEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11687,6 +12127,7 @@ void GL_APIENTRY GL_WaitSemaphoreEXT(GLuint semaphore,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().semaphoreEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11731,6 +12172,7 @@ void GL_APIENTRY GL_ImportSemaphoreFdEXT(GLuint semaphore, GLenum handleType, GL
     Context *context = GetValidGlobalContext();
     EVENT(context, GLImportSemaphoreFdEXT, "context = %d, semaphore = %u, handleType = %s, fd = %d",
           CID(context), semaphore, GLenumToString(GLESEnum::ExternalHandleType, handleType), fd);
+    ANGLE_PROFILE_ENTRY_POINT(GLImportSemaphoreFdEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11740,6 +12182,7 @@ void GL_APIENTRY GL_ImportSemaphoreFdEXT(GLuint semaphore, GLenum handleType, GL
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().semaphoreFdEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11780,6 +12223,7 @@ void GL_APIENTRY GL_ActiveShaderProgramEXT(GLuint pipeline, GLuint program)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLActiveShaderProgramEXT, "context = %d, pipeline = %u, program = %u",
           CID(context), pipeline, program);
+    ANGLE_PROFILE_ENTRY_POINT(GLActiveShaderProgramEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11789,6 +12233,7 @@ void GL_APIENTRY GL_ActiveShaderProgramEXT(GLuint pipeline, GLuint program)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11825,6 +12270,7 @@ void GL_APIENTRY GL_BindProgramPipelineEXT(GLuint pipeline)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindProgramPipelineEXT, "context = %d, pipeline = %u", CID(context), pipeline);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindProgramPipelineEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11833,6 +12279,7 @@ void GL_APIENTRY GL_BindProgramPipelineEXT(GLuint pipeline)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11871,6 +12318,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramvEXT(GLenum type,
     EVENT(context, GLCreateShaderProgramvEXT,
           "context = %d, type = %s, count = %d, strings = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::ShaderType, type), count, (uintptr_t)strings);
+    ANGLE_PROFILE_ENTRY_POINT(GLCreateShaderProgramvEXT);
 
     GLuint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -11880,6 +12328,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramvEXT(GLenum type,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11926,6 +12375,7 @@ void GL_APIENTRY GL_DeleteProgramPipelinesEXT(GLsizei n, const GLuint *pipelines
     EVENT(context, GLDeleteProgramPipelinesEXT,
           "context = %d, n = %d, pipelines = 0x%016" PRIxPTR "", CID(context), n,
           (uintptr_t)pipelines);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteProgramPipelinesEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11934,6 +12384,7 @@ void GL_APIENTRY GL_DeleteProgramPipelinesEXT(GLsizei n, const GLuint *pipelines
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -11970,6 +12421,7 @@ void GL_APIENTRY GL_GenProgramPipelinesEXT(GLsizei n, GLuint *pipelines)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenProgramPipelinesEXT, "context = %d, n = %d, pipelines = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)pipelines);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenProgramPipelinesEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -11978,6 +12430,7 @@ void GL_APIENTRY GL_GenProgramPipelinesEXT(GLsizei n, GLuint *pipelines)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12018,6 +12471,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLogEXT(GLuint pipeline,
           "context = %d, pipeline = %u, bufSize = %d, length = 0x%016" PRIxPTR
           ", infoLog = 0x%016" PRIxPTR "",
           CID(context), pipeline, bufSize, (uintptr_t)length, (uintptr_t)infoLog);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramPipelineInfoLogEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12026,6 +12480,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLogEXT(GLuint pipeline,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12065,6 +12520,7 @@ void GL_APIENTRY GL_GetProgramPipelineivEXT(GLuint pipeline, GLenum pname, GLint
     EVENT(context, GLGetProgramPipelineivEXT,
           "context = %d, pipeline = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           pipeline, GLenumToString(GLESEnum::PipelineParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramPipelineivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12073,6 +12529,7 @@ void GL_APIENTRY GL_GetProgramPipelineivEXT(GLuint pipeline, GLenum pname, GLint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12110,6 +12567,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipelineEXT(GLuint pipeline)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsProgramPipelineEXT, "context = %d, pipeline = %u", CID(context), pipeline);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsProgramPipelineEXT);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -12119,6 +12577,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipelineEXT(GLuint pipeline)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12161,6 +12620,7 @@ void GL_APIENTRY GL_ProgramParameteriEXT(GLuint program, GLenum pname, GLint val
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramParameteriEXT, "context = %d, program = %u, pname = %s, value = %d",
           CID(context), program, GLenumToString(GLESEnum::ProgramParameterPName, pname), value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramParameteriEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12169,6 +12629,7 @@ void GL_APIENTRY GL_ProgramParameteriEXT(GLuint program, GLenum pname, GLint val
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12205,6 +12666,7 @@ void GL_APIENTRY GL_ProgramUniform1fEXT(GLuint program, GLint location, GLfloat
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1fEXT, "context = %d, program = %u, location = %d, v0 = %f",
           CID(context), program, location, v0);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1fEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12214,6 +12676,7 @@ void GL_APIENTRY GL_ProgramUniform1fEXT(GLuint program, GLint location, GLfloat
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12255,6 +12718,7 @@ void GL_APIENTRY GL_ProgramUniform1fvEXT(GLuint program,
     EVENT(context, GLProgramUniform1fvEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12264,6 +12728,7 @@ void GL_APIENTRY GL_ProgramUniform1fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12301,6 +12766,7 @@ void GL_APIENTRY GL_ProgramUniform1iEXT(GLuint program, GLint location, GLint v0
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1iEXT, "context = %d, program = %u, location = %d, v0 = %d",
           CID(context), program, location, v0);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1iEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12310,6 +12776,7 @@ void GL_APIENTRY GL_ProgramUniform1iEXT(GLuint program, GLint location, GLint v0
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12351,6 +12818,7 @@ void GL_APIENTRY GL_ProgramUniform1ivEXT(GLuint program,
     EVENT(context, GLProgramUniform1ivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1ivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12360,6 +12828,7 @@ void GL_APIENTRY GL_ProgramUniform1ivEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12397,6 +12866,7 @@ void GL_APIENTRY GL_ProgramUniform1uiEXT(GLuint program, GLint location, GLuint
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1uiEXT, "context = %d, program = %u, location = %d, v0 = %u",
           CID(context), program, location, v0);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1uiEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12406,6 +12876,7 @@ void GL_APIENTRY GL_ProgramUniform1uiEXT(GLuint program, GLint location, GLuint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12447,6 +12918,7 @@ void GL_APIENTRY GL_ProgramUniform1uivEXT(GLuint program,
     EVENT(context, GLProgramUniform1uivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform1uivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12456,6 +12928,7 @@ void GL_APIENTRY GL_ProgramUniform1uivEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12494,6 +12967,7 @@ void GL_APIENTRY GL_ProgramUniform2fEXT(GLuint program, GLint location, GLfloat
     EVENT(context, GLProgramUniform2fEXT,
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f", CID(context), program,
           location, v0, v1);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2fEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12503,6 +12977,7 @@ void GL_APIENTRY GL_ProgramUniform2fEXT(GLuint program, GLint location, GLfloat
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12544,6 +13019,7 @@ void GL_APIENTRY GL_ProgramUniform2fvEXT(GLuint program,
     EVENT(context, GLProgramUniform2fvEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12553,6 +13029,7 @@ void GL_APIENTRY GL_ProgramUniform2fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12591,6 +13068,7 @@ void GL_APIENTRY GL_ProgramUniform2iEXT(GLuint program, GLint location, GLint v0
     EVENT(context, GLProgramUniform2iEXT,
           "context = %d, program = %u, location = %d, v0 = %d, v1 = %d", CID(context), program,
           location, v0, v1);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2iEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12600,6 +13078,7 @@ void GL_APIENTRY GL_ProgramUniform2iEXT(GLuint program, GLint location, GLint v0
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12641,6 +13120,7 @@ void GL_APIENTRY GL_ProgramUniform2ivEXT(GLuint program,
     EVENT(context, GLProgramUniform2ivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2ivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12650,6 +13130,7 @@ void GL_APIENTRY GL_ProgramUniform2ivEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12688,6 +13169,7 @@ void GL_APIENTRY GL_ProgramUniform2uiEXT(GLuint program, GLint location, GLuint
     EVENT(context, GLProgramUniform2uiEXT,
           "context = %d, program = %u, location = %d, v0 = %u, v1 = %u", CID(context), program,
           location, v0, v1);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2uiEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12697,6 +13179,7 @@ void GL_APIENTRY GL_ProgramUniform2uiEXT(GLuint program, GLint location, GLuint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12738,6 +13221,7 @@ void GL_APIENTRY GL_ProgramUniform2uivEXT(GLuint program,
     EVENT(context, GLProgramUniform2uivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform2uivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12747,6 +13231,7 @@ void GL_APIENTRY GL_ProgramUniform2uivEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12795,6 +13280,7 @@ GL_ProgramUniform3fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, G
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12836,6 +13322,7 @@ void GL_APIENTRY GL_ProgramUniform3fvEXT(GLuint program,
     EVENT(context, GLProgramUniform3fvEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform3fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12845,6 +13332,7 @@ void GL_APIENTRY GL_ProgramUniform3fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12893,6 +13381,7 @@ GL_ProgramUniform3iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12934,6 +13423,7 @@ void GL_APIENTRY GL_ProgramUniform3ivEXT(GLuint program,
     EVENT(context, GLProgramUniform3ivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform3ivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -12943,6 +13433,7 @@ void GL_APIENTRY GL_ProgramUniform3ivEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -12991,6 +13482,7 @@ GL_ProgramUniform3uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GL
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13032,6 +13524,7 @@ void GL_APIENTRY GL_ProgramUniform3uivEXT(GLuint program,
     EVENT(context, GLProgramUniform3uivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform3uivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13041,6 +13534,7 @@ void GL_APIENTRY GL_ProgramUniform3uivEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13084,6 +13578,7 @@ void GL_APIENTRY GL_ProgramUniform4fEXT(GLuint program,
     EVENT(context, GLProgramUniform4fEXT,
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f, v2 = %f, v3 = %f",
           CID(context), program, location, v0, v1, v2, v3);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform4fEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13093,6 +13588,7 @@ void GL_APIENTRY GL_ProgramUniform4fEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13134,6 +13630,7 @@ void GL_APIENTRY GL_ProgramUniform4fvEXT(GLuint program,
     EVENT(context, GLProgramUniform4fvEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform4fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13143,6 +13640,7 @@ void GL_APIENTRY GL_ProgramUniform4fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13191,6 +13689,7 @@ GL_ProgramUniform4iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13232,6 +13731,7 @@ void GL_APIENTRY GL_ProgramUniform4ivEXT(GLuint program,
     EVENT(context, GLProgramUniform4ivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform4ivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13241,6 +13741,7 @@ void GL_APIENTRY GL_ProgramUniform4ivEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13289,6 +13790,7 @@ GL_ProgramUniform4uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GL
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13330,6 +13832,7 @@ void GL_APIENTRY GL_ProgramUniform4uivEXT(GLuint program,
     EVENT(context, GLProgramUniform4uivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
           CID(context), program, location, count, (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniform4uivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13339,6 +13842,7 @@ void GL_APIENTRY GL_ProgramUniform4uivEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13382,6 +13886,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fvEXT(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix2fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13391,6 +13896,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13436,6 +13942,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fvEXT(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix2x3fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13445,6 +13952,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13490,6 +13998,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fvEXT(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix2x4fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13499,6 +14008,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13544,6 +14054,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fvEXT(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix3fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13553,6 +14064,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13598,6 +14110,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fvEXT(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix3x2fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13607,6 +14120,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13652,6 +14166,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fvEXT(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix3x4fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13661,6 +14176,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13706,6 +14222,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fvEXT(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix4fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13715,6 +14232,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13760,6 +14278,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fvEXT(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix4x2fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13769,6 +14288,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13814,6 +14334,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fvEXT(GLuint program,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
           "0x%016" PRIxPTR "",
           CID(context), program, location, count, GLbooleanToString(transpose), (uintptr_t)value);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramUniformMatrix4x3fvEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13823,6 +14344,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fvEXT(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13863,6 +14385,7 @@ void GL_APIENTRY GL_UseProgramStagesEXT(GLuint pipeline, GLbitfield stages, GLui
     EVENT(context, GLUseProgramStagesEXT, "context = %d, pipeline = %u, stages = %s, program = %u",
           CID(context), pipeline, GLbitfieldToString(GLESEnum::UseProgramStageMask, stages).c_str(),
           program);
+    ANGLE_PROFILE_ENTRY_POINT(GLUseProgramStagesEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13872,6 +14395,7 @@ void GL_APIENTRY GL_UseProgramStagesEXT(GLuint pipeline, GLbitfield stages, GLui
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13909,6 +14433,7 @@ void GL_APIENTRY GL_ValidateProgramPipelineEXT(GLuint pipeline)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLValidateProgramPipelineEXT, "context = %d, pipeline = %u", CID(context),
           pipeline);
+    ANGLE_PROFILE_ENTRY_POINT(GLValidateProgramPipelineEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13917,6 +14442,7 @@ void GL_APIENTRY GL_ValidateProgramPipelineEXT(GLuint pipeline)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().separateShaderObjectsEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -13955,6 +14481,7 @@ void GL_APIENTRY GL_FramebufferFetchBarrierEXT()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferFetchBarrierEXT, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferFetchBarrierEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -13962,6 +14489,7 @@ void GL_APIENTRY GL_FramebufferFetchBarrierEXT()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shaderFramebufferFetchNonCoherentEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14007,12 +14535,14 @@ void GL_APIENTRY GL_PatchParameteriEXT(GLenum pname, GLint value)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPatchParameteriEXT, "context = %d, pname = %s, value = %d", CID(context),
           GLenumToString(GLESEnum::PatchParameterName, pname), value);
+    ANGLE_PROFILE_ENTRY_POINT(GLPatchParameteriEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().tessellationShaderEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14052,6 +14582,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivEXT(GLuint sampler, GLenum pname, GLin
     EVENT(context, GLGetSamplerParameterIivEXT,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterIivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14060,6 +14591,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivEXT(GLuint sampler, GLenum pname, GLin
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14099,6 +14631,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivEXT(GLuint sampler, GLenum pname, GLu
     EVENT(context, GLGetSamplerParameterIuivEXT,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterIuivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14107,6 +14640,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivEXT(GLuint sampler, GLenum pname, GLu
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14147,6 +14681,7 @@ void GL_APIENTRY GL_GetTexParameterIivEXT(GLenum target, GLenum pname, GLint *pa
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterIivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14155,6 +14690,7 @@ void GL_APIENTRY GL_GetTexParameterIivEXT(GLenum target, GLenum pname, GLint *pa
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14193,6 +14729,7 @@ void GL_APIENTRY GL_GetTexParameterIuivEXT(GLenum target, GLenum pname, GLuint *
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterIuivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14201,6 +14738,7 @@ void GL_APIENTRY GL_GetTexParameterIuivEXT(GLenum target, GLenum pname, GLuint *
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14238,6 +14776,7 @@ void GL_APIENTRY GL_SamplerParameterIivEXT(GLuint sampler, GLenum pname, const G
     EVENT(context, GLSamplerParameterIivEXT,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterIivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14246,6 +14785,7 @@ void GL_APIENTRY GL_SamplerParameterIivEXT(GLuint sampler, GLenum pname, const G
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14283,6 +14823,7 @@ void GL_APIENTRY GL_SamplerParameterIuivEXT(GLuint sampler, GLenum pname, const
     EVENT(context, GLSamplerParameterIuivEXT,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterIuivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14291,6 +14832,7 @@ void GL_APIENTRY GL_SamplerParameterIuivEXT(GLuint sampler, GLenum pname, const
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14331,6 +14873,7 @@ void GL_APIENTRY GL_TexParameterIivEXT(GLenum target, GLenum pname, const GLint
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::TextureParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterIivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14339,6 +14882,7 @@ void GL_APIENTRY GL_TexParameterIivEXT(GLenum target, GLenum pname, const GLint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14376,6 +14920,7 @@ void GL_APIENTRY GL_TexParameterIuivEXT(GLenum target, GLenum pname, const GLuin
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::TextureParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterIuivEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14384,6 +14929,7 @@ void GL_APIENTRY GL_TexParameterIuivEXT(GLenum target, GLenum pname, const GLuin
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14421,6 +14967,7 @@ void GL_APIENTRY GL_TexBufferEXT(GLenum target, GLenum internalformat, GLuint bu
     EVENT(context, GLTexBufferEXT, "context = %d, target = %s, internalformat = %s, buffer = %u",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), buffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexBufferEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14430,6 +14977,7 @@ void GL_APIENTRY GL_TexBufferEXT(GLenum target, GLenum internalformat, GLuint bu
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBufferEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14473,6 +15021,7 @@ void GL_APIENTRY GL_TexBufferRangeEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), buffer,
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(size));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexBufferRangeEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14482,6 +15031,7 @@ void GL_APIENTRY GL_TexBufferRangeEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBufferEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14564,6 +15114,7 @@ void GL_APIENTRY GL_TexStorage2DEXT(GLenum target,
           "context = %d, target = %s, levels = %d, internalformat = %s, width = %d, height = %d",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), levels,
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorage2DEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14572,6 +15123,7 @@ void GL_APIENTRY GL_TexStorage2DEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureStorageEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14617,6 +15169,7 @@ void GL_APIENTRY GL_TexStorage3DEXT(GLenum target,
           "depth = %d",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), levels,
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), width, height, depth);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorage3DEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14625,6 +15178,7 @@ void GL_APIENTRY GL_TexStorage3DEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureStorageEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14672,6 +15226,7 @@ void GL_APIENTRY GL_TexStorageAttribs2DEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), levels,
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), width, height,
           (uintptr_t)attrib_list);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorageAttribs2DEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14679,6 +15234,7 @@ void GL_APIENTRY GL_TexStorageAttribs2DEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureStorageCompressionEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14727,6 +15283,7 @@ void GL_APIENTRY GL_TexStorageAttribs3DEXT(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), levels,
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), width, height, depth,
           (uintptr_t)attrib_list);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorageAttribs3DEXT);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14734,6 +15291,7 @@ void GL_APIENTRY GL_TexStorageAttribs3DEXT(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureStorageCompressionEXT))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14780,6 +15338,7 @@ void GL_APIENTRY GL_BlendBarrierKHR()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendBarrierKHR, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendBarrierKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14787,6 +15346,7 @@ void GL_APIENTRY GL_BlendBarrierKHR()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().blendEquationAdvancedKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14826,6 +15386,7 @@ void GL_APIENTRY GL_DebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void
     EVENT(context, GLDebugMessageCallbackKHR,
           "context = %d, callback = 0x%016" PRIxPTR ", userParam = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)callback, (uintptr_t)userParam);
+    ANGLE_PROFILE_ENTRY_POINT(GLDebugMessageCallbackKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14833,6 +15394,7 @@ void GL_APIENTRY GL_DebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14879,6 +15441,7 @@ void GL_APIENTRY GL_DebugMessageControlKHR(GLenum source,
           GLenumToString(GLESEnum::DebugType, type),
           GLenumToString(GLESEnum::DebugSeverity, severity), count, (uintptr_t)ids,
           GLbooleanToString(enabled));
+    ANGLE_PROFILE_ENTRY_POINT(GLDebugMessageControlKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14886,6 +15449,7 @@ void GL_APIENTRY GL_DebugMessageControlKHR(GLenum source,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14932,6 +15496,7 @@ void GL_APIENTRY GL_DebugMessageInsertKHR(GLenum source,
           CID(context), GLenumToString(GLESEnum::DebugSource, source),
           GLenumToString(GLESEnum::DebugType, type), id,
           GLenumToString(GLESEnum::DebugSeverity, severity), length, (uintptr_t)buf);
+    ANGLE_PROFILE_ENTRY_POINT(GLDebugMessageInsertKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -14939,6 +15504,7 @@ void GL_APIENTRY GL_DebugMessageInsertKHR(GLenum source,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -14987,6 +15553,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLogKHR(GLuint count,
           ", lengths = 0x%016" PRIxPTR ", messageLog = 0x%016" PRIxPTR "",
           CID(context), count, bufSize, (uintptr_t)sources, (uintptr_t)types, (uintptr_t)ids,
           (uintptr_t)severities, (uintptr_t)lengths, (uintptr_t)messageLog);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetDebugMessageLogKHR);
 
     GLuint returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -14995,6 +15562,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLogKHR(GLuint count,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15047,6 +15615,7 @@ void GL_APIENTRY GL_GetObjectLabelKHR(GLenum identifier,
           ", label = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, identifier), name, bufSize,
           (uintptr_t)length, (uintptr_t)label);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetObjectLabelKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15054,6 +15623,7 @@ void GL_APIENTRY GL_GetObjectLabelKHR(GLenum identifier,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15096,6 +15666,7 @@ void GL_APIENTRY GL_GetObjectPtrLabelKHR(const void *ptr,
           "context = %d, ptr = 0x%016" PRIxPTR ", bufSize = %d, length = 0x%016" PRIxPTR
           ", label = 0x%016" PRIxPTR "",
           CID(context), (uintptr_t)ptr, bufSize, (uintptr_t)length, (uintptr_t)label);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetObjectPtrLabelKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15103,6 +15674,7 @@ void GL_APIENTRY GL_GetObjectPtrLabelKHR(const void *ptr,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15139,6 +15711,7 @@ void GL_APIENTRY GL_GetPointervKHR(GLenum pname, void **params)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPointervKHR, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetPointervKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15146,6 +15719,7 @@ void GL_APIENTRY GL_GetPointervKHR(GLenum pname, void **params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15186,6 +15760,7 @@ void GL_APIENTRY GL_ObjectLabelKHR(GLenum identifier,
           "context = %d, identifier = %s, name = %u, length = %d, label = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ObjectIdentifier, identifier), name, length,
           (uintptr_t)label);
+    ANGLE_PROFILE_ENTRY_POINT(GLObjectLabelKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15193,6 +15768,7 @@ void GL_APIENTRY GL_ObjectLabelKHR(GLenum identifier,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15229,6 +15805,7 @@ void GL_APIENTRY GL_ObjectPtrLabelKHR(const void *ptr, GLsizei length, const GLc
     EVENT(context, GLObjectPtrLabelKHR,
           "context = %d, ptr = 0x%016" PRIxPTR ", length = %d, label = 0x%016" PRIxPTR "",
           CID(context), (uintptr_t)ptr, length, (uintptr_t)label);
+    ANGLE_PROFILE_ENTRY_POINT(GLObjectPtrLabelKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15236,6 +15813,7 @@ void GL_APIENTRY GL_ObjectPtrLabelKHR(const void *ptr, GLsizei length, const GLc
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15270,6 +15848,7 @@ void GL_APIENTRY GL_PopDebugGroupKHR()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPopDebugGroupKHR, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLPopDebugGroupKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15277,6 +15856,7 @@ void GL_APIENTRY GL_PopDebugGroupKHR()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15317,6 +15897,7 @@ void GL_APIENTRY GL_PushDebugGroupKHR(GLenum source,
           "context = %d, source = %s, id = %u, length = %d, message = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::DebugSource, source), id, length,
           (uintptr_t)message);
+    ANGLE_PROFILE_ENTRY_POINT(GLPushDebugGroupKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15324,6 +15905,7 @@ void GL_APIENTRY GL_PushDebugGroupKHR(GLenum source,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().debugKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15361,6 +15943,7 @@ void GL_APIENTRY GL_MaxShaderCompilerThreadsKHR(GLuint count)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMaxShaderCompilerThreadsKHR, "context = %d, count = %u", CID(context), count);
+    ANGLE_PROFILE_ENTRY_POINT(GLMaxShaderCompilerThreadsKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15368,6 +15951,7 @@ void GL_APIENTRY GL_MaxShaderCompilerThreadsKHR(GLuint count)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().parallelShaderCompileKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15406,6 +15990,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatusKHR()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetGlobalContext();
     EVENT(context, GLGetGraphicsResetStatusKHR, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLGetGraphicsResetStatusKHR);
 
     GLenum returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -15414,6 +15999,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatusKHR()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustnessKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15461,6 +16047,7 @@ void GL_APIENTRY GL_GetnUniformfvKHR(GLuint program,
     EVENT(context, GLGetnUniformfvKHR,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformfvKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15470,6 +16057,7 @@ void GL_APIENTRY GL_GetnUniformfvKHR(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustnessKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15508,6 +16096,7 @@ void GL_APIENTRY GL_GetnUniformivKHR(GLuint program, GLint location, GLsizei buf
     EVENT(context, GLGetnUniformivKHR,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformivKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15517,6 +16106,7 @@ void GL_APIENTRY GL_GetnUniformivKHR(GLuint program, GLint location, GLsizei buf
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustnessKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15558,6 +16148,7 @@ void GL_APIENTRY GL_GetnUniformuivKHR(GLuint program,
     EVENT(context, GLGetnUniformuivKHR,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
           CID(context), program, location, bufSize, (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetnUniformuivKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15567,6 +16158,7 @@ void GL_APIENTRY GL_GetnUniformuivKHR(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustnessKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15614,6 +16206,7 @@ void GL_APIENTRY GL_ReadnPixelsKHR(GLint x,
           "= %d, data = 0x%016" PRIxPTR "",
           CID(context), x, y, width, height, GLenumToString(GLESEnum::PixelFormat, format),
           GLenumToString(GLESEnum::PixelType, type), bufSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLReadnPixelsKHR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15621,6 +16214,7 @@ void GL_APIENTRY GL_ReadnPixelsKHR(GLint x,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().robustnessKHR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15666,6 +16260,7 @@ void GL_APIENTRY GL_FramebufferParameteriMESA(GLenum target, GLenum pname, GLint
     EVENT(context, GLFramebufferParameteriMESA, "context = %d, target = %s, pname = %s, param = %d",
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferParameterName, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferParameteriMESA);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15677,6 +16272,7 @@ void GL_APIENTRY GL_FramebufferParameteriMESA(GLenum target, GLenum pname, GLint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferFlipYMESA))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15715,6 +16311,7 @@ void GL_APIENTRY GL_GetFramebufferParameterivMESA(GLenum target, GLenum pname, G
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachmentParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFramebufferParameterivMESA);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15722,6 +16319,7 @@ void GL_APIENTRY GL_GetFramebufferParameterivMESA(GLenum target, GLenum pname, G
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferFlipYMESA))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15762,6 +16360,7 @@ void GL_APIENTRY GL_DeleteFencesNV(GLsizei n, const GLuint *fences)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteFencesNV, "context = %d, n = %d, fences = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)fences);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteFencesNV);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15770,6 +16369,7 @@ void GL_APIENTRY GL_DeleteFencesNV(GLsizei n, const GLuint *fences)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fenceNV))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15804,6 +16404,7 @@ void GL_APIENTRY GL_FinishFenceNV(GLuint fence)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFinishFenceNV, "context = %d, fence = %u", CID(context), fence);
+    ANGLE_PROFILE_ENTRY_POINT(GLFinishFenceNV);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15812,6 +16413,7 @@ void GL_APIENTRY GL_FinishFenceNV(GLuint fence)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fenceNV))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15847,6 +16449,7 @@ void GL_APIENTRY GL_GenFencesNV(GLsizei n, GLuint *fences)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenFencesNV, "context = %d, n = %d, fences = 0x%016" PRIxPTR "", CID(context),
           n, (uintptr_t)fences);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenFencesNV);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15855,6 +16458,7 @@ void GL_APIENTRY GL_GenFencesNV(GLsizei n, GLuint *fences)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fenceNV))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15891,6 +16495,7 @@ void GL_APIENTRY GL_GetFenceivNV(GLuint fence, GLenum pname, GLint *params)
     EVENT(context, GLGetFenceivNV,
           "context = %d, fence = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), fence,
           GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFenceivNV);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15899,6 +16504,7 @@ void GL_APIENTRY GL_GetFenceivNV(GLuint fence, GLenum pname, GLint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fenceNV))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15933,6 +16539,7 @@ GLboolean GL_APIENTRY GL_IsFenceNV(GLuint fence)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsFenceNV, "context = %d, fence = %u", CID(context), fence);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsFenceNV);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -15942,6 +16549,7 @@ GLboolean GL_APIENTRY GL_IsFenceNV(GLuint fence)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fenceNV))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -15983,6 +16591,7 @@ void GL_APIENTRY GL_SetFenceNV(GLuint fence, GLenum condition)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSetFenceNV, "context = %d, fence = %u, condition = %s", CID(context), fence,
           GLenumToString(GLESEnum::AllEnums, condition));
+    ANGLE_PROFILE_ENTRY_POINT(GLSetFenceNV);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -15991,6 +16600,7 @@ void GL_APIENTRY GL_SetFenceNV(GLuint fence, GLenum condition)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fenceNV))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16025,6 +16635,7 @@ GLboolean GL_APIENTRY GL_TestFenceNV(GLuint fence)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTestFenceNV, "context = %d, fence = %u", CID(context), fence);
+    ANGLE_PROFILE_ENTRY_POINT(GLTestFenceNV);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -16034,6 +16645,7 @@ GLboolean GL_APIENTRY GL_TestFenceNV(GLuint fence)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().fenceNV))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16089,6 +16701,7 @@ void GL_APIENTRY GL_BlitFramebufferNV(GLint srcX0,
           CID(context), srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1,
           GLbitfieldToString(GLESEnum::ClearBufferMask, mask).c_str(),
           GLenumToString(GLESEnum::BlitFramebufferFilter, filter));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlitFramebufferNV);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -16096,6 +16709,7 @@ void GL_APIENTRY GL_BlitFramebufferNV(GLint srcX0,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferBlitNV))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16140,6 +16754,7 @@ void GL_APIENTRY GL_PolygonModeNV(GLenum face, GLenum mode)
     EVENT(context, GLPolygonModeNV, "context = %d, face = %s, mode = %s", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face),
           GLenumToString(GLESEnum::PolygonMode, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLPolygonModeNV);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -16147,6 +16762,7 @@ void GL_APIENTRY GL_PolygonModeNV(GLenum face, GLenum mode)
         bool isCallValid       = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().polygonModeNV))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16196,6 +16812,7 @@ void GL_APIENTRY GL_EGLImageTargetRenderbufferStorageOES(GLenum target, GLeglIma
     EVENT(context, GLEGLImageTargetRenderbufferStorageOES,
           "context = %d, target = %s, image = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::AllEnums, target), (uintptr_t)image);
+    ANGLE_PROFILE_ENTRY_POINT(GLEGLImageTargetRenderbufferStorageOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -16204,6 +16821,7 @@ void GL_APIENTRY GL_EGLImageTargetRenderbufferStorageOES(GLenum target, GLeglIma
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().EGLImageOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16244,6 +16862,7 @@ void GL_APIENTRY GL_EGLImageTargetTexture2DOES(GLenum target, GLeglImageOES imag
     EVENT(context, GLEGLImageTargetTexture2DOES,
           "context = %d, target = %s, image = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::AllEnums, target), (uintptr_t)image);
+    ANGLE_PROFILE_ENTRY_POINT(GLEGLImageTargetTexture2DOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -16253,6 +16872,7 @@ void GL_APIENTRY GL_EGLImageTargetTexture2DOES(GLenum target, GLeglImageOES imag
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().EGLImageExternalOES ||
                              context->getExtensions().EGLImageOES))
             {
@@ -16298,12 +16918,14 @@ void GL_APIENTRY GL_BlendEquationOES(GLenum mode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationOES, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::BlendEquationModeEXT, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendEquationOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().blendSubtractOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16366,6 +16988,7 @@ void GL_APIENTRY GL_CopyImageSubDataOES(GLuint srcName,
           srcLevel, srcX, srcY, srcZ, dstName,
           GLenumToString(GLESEnum::CopyBufferSubDataTarget, dstTarget), dstLevel, dstX, dstY, dstZ,
           srcWidth, srcHeight, srcDepth);
+    ANGLE_PROFILE_ENTRY_POINT(GLCopyImageSubDataOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -16373,6 +16996,7 @@ void GL_APIENTRY GL_CopyImageSubDataOES(GLuint srcName,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().copyImageOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16423,12 +17047,14 @@ void GL_APIENTRY GL_BlendEquationSeparateiOES(GLuint buf, GLenum modeRGB, GLenum
           "context = %d, buf = %u, modeRGB = %s, modeAlpha = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendEquationModeEXT, modeRGB),
           GLenumToString(GLESEnum::BlendEquationModeEXT, modeAlpha));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendEquationSeparateiOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16468,12 +17094,14 @@ void GL_APIENTRY GL_BlendEquationiOES(GLuint buf, GLenum mode)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationiOES, "context = %d, buf = %u, mode = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendEquationModeEXT, mode));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendEquationiOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16522,6 +17150,7 @@ GL_BlendFuncSeparateiOES(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlp
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16563,12 +17192,14 @@ void GL_APIENTRY GL_BlendFunciOES(GLuint buf, GLenum src, GLenum dst)
     EVENT(context, GLBlendFunciOES, "context = %d, buf = %u, src = %s, dst = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendingFactor, src),
           GLenumToString(GLESEnum::BlendingFactor, dst));
+    ANGLE_PROFILE_ENTRY_POINT(GLBlendFunciOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16607,12 +17238,14 @@ void GL_APIENTRY GL_ColorMaskiOES(GLuint index, GLboolean r, GLboolean g, GLbool
     EVENT(context, GLColorMaskiOES, "context = %d, index = %u, r = %s, g = %s, b = %s, a = %s",
           CID(context), index, GLbooleanToString(r), GLbooleanToString(g), GLbooleanToString(b),
           GLbooleanToString(a));
+    ANGLE_PROFILE_ENTRY_POINT(GLColorMaskiOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16650,12 +17283,14 @@ void GL_APIENTRY GL_DisableiOES(GLenum target, GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisableiOES, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLDisableiOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16693,12 +17328,14 @@ void GL_APIENTRY GL_EnableiOES(GLenum target, GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnableiOES, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLEnableiOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16736,6 +17373,7 @@ GLboolean GL_APIENTRY GL_IsEnablediOES(GLenum target, GLuint index)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsEnablediOES, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsEnablediOES);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -16743,6 +17381,7 @@ GLboolean GL_APIENTRY GL_IsEnablediOES(GLenum target, GLuint index)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawBuffersIndexedOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16795,6 +17434,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexOES(GLenum mode,
           ", basevertex = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, basevertex);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsBaseVertexOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -16804,6 +17444,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexOES(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawElementsBaseVertexOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16851,6 +17492,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexOES(GLenum mode,
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, instancecount,
           basevertex);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawElementsInstancedBaseVertexOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -16860,6 +17502,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexOES(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawElementsBaseVertexOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16909,6 +17552,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexOES(GLenum mode,
           "0x%016" PRIxPTR ", basevertex = %d",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), start, end, count,
           GLenumToString(GLESEnum::DrawElementsType, type), (uintptr_t)indices, basevertex);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawRangeElementsBaseVertexOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -16918,6 +17562,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexOES(GLenum mode,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawElementsBaseVertexOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -16961,6 +17606,7 @@ void GL_APIENTRY GL_DrawTexfOES(GLfloat x, GLfloat y, GLfloat z, GLfloat width,
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexfOES, "context = %d, x = %f, y = %f, z = %f, width = %f, height = %f",
           CID(context), x, y, z, width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawTexfOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -16968,6 +17614,7 @@ void GL_APIENTRY GL_DrawTexfOES(GLfloat x, GLfloat y, GLfloat z, GLfloat width,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawTextureOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17003,6 +17650,7 @@ void GL_APIENTRY GL_DrawTexfvOES(const GLfloat *coords)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexfvOES, "context = %d, coords = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)coords);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawTexfvOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17010,6 +17658,7 @@ void GL_APIENTRY GL_DrawTexfvOES(const GLfloat *coords)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawTextureOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17045,6 +17694,7 @@ void GL_APIENTRY GL_DrawTexiOES(GLint x, GLint y, GLint z, GLint width, GLint he
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexiOES, "context = %d, x = %d, y = %d, z = %d, width = %d, height = %d",
           CID(context), x, y, z, width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawTexiOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17052,6 +17702,7 @@ void GL_APIENTRY GL_DrawTexiOES(GLint x, GLint y, GLint z, GLint width, GLint he
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawTextureOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17087,6 +17738,7 @@ void GL_APIENTRY GL_DrawTexivOES(const GLint *coords)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexivOES, "context = %d, coords = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)coords);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawTexivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17094,6 +17746,7 @@ void GL_APIENTRY GL_DrawTexivOES(const GLint *coords)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawTextureOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17129,6 +17782,7 @@ void GL_APIENTRY GL_DrawTexsOES(GLshort x, GLshort y, GLshort z, GLshort width,
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexsOES, "context = %d, x = %d, y = %d, z = %d, width = %d, height = %d",
           CID(context), x, y, z, width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawTexsOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17136,6 +17790,7 @@ void GL_APIENTRY GL_DrawTexsOES(GLshort x, GLshort y, GLshort z, GLshort width,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawTextureOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17171,6 +17826,7 @@ void GL_APIENTRY GL_DrawTexsvOES(const GLshort *coords)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexsvOES, "context = %d, coords = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)coords);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawTexsvOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17178,6 +17834,7 @@ void GL_APIENTRY GL_DrawTexsvOES(const GLshort *coords)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawTextureOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17214,6 +17871,7 @@ void GL_APIENTRY GL_DrawTexxOES(GLfixed x, GLfixed y, GLfixed z, GLfixed width,
     EVENT(context, GLDrawTexxOES,
           "context = %d, x = 0x%X, y = 0x%X, z = 0x%X, width = 0x%X, height = 0x%X", CID(context),
           x, y, z, width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawTexxOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17221,6 +17879,7 @@ void GL_APIENTRY GL_DrawTexxOES(GLfixed x, GLfixed y, GLfixed z, GLfixed width,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawTextureOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17256,6 +17915,7 @@ void GL_APIENTRY GL_DrawTexxvOES(const GLfixed *coords)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexxvOES, "context = %d, coords = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)coords);
+    ANGLE_PROFILE_ENTRY_POINT(GLDrawTexxvOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17263,6 +17923,7 @@ void GL_APIENTRY GL_DrawTexxvOES(const GLfixed *coords)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().drawTextureOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17303,6 +17964,7 @@ void GL_APIENTRY GL_BindFramebufferOES(GLenum target, GLuint framebuffer)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindFramebufferOES, "context = %d, target = %s, framebuffer = %u",
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target), framebuffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindFramebufferOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17311,6 +17973,7 @@ void GL_APIENTRY GL_BindFramebufferOES(GLenum target, GLuint framebuffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17346,6 +18009,7 @@ void GL_APIENTRY GL_BindRenderbufferOES(GLenum target, GLuint renderbuffer)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindRenderbufferOES, "context = %d, target = %s, renderbuffer = %u",
           CID(context), GLenumToString(GLESEnum::RenderbufferTarget, target), renderbuffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindRenderbufferOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17354,6 +18018,7 @@ void GL_APIENTRY GL_BindRenderbufferOES(GLenum target, GLuint renderbuffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17389,6 +18054,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatusOES(GLenum target)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCheckFramebufferStatusOES, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target));
+    ANGLE_PROFILE_ENTRY_POINT(GLCheckFramebufferStatusOES);
 
     GLenum returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -17397,6 +18063,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatusOES(GLenum target)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17442,6 +18109,7 @@ void GL_APIENTRY GL_DeleteFramebuffersOES(GLsizei n, const GLuint *framebuffers)
     EVENT(context, GLDeleteFramebuffersOES,
           "context = %d, n = %d, framebuffers = 0x%016" PRIxPTR "", CID(context), n,
           (uintptr_t)framebuffers);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteFramebuffersOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17450,6 +18118,7 @@ void GL_APIENTRY GL_DeleteFramebuffersOES(GLsizei n, const GLuint *framebuffers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17486,6 +18155,7 @@ void GL_APIENTRY GL_DeleteRenderbuffersOES(GLsizei n, const GLuint *renderbuffer
     EVENT(context, GLDeleteRenderbuffersOES,
           "context = %d, n = %d, renderbuffers = 0x%016" PRIxPTR "", CID(context), n,
           (uintptr_t)renderbuffers);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteRenderbuffersOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17495,6 +18165,7 @@ void GL_APIENTRY GL_DeleteRenderbuffersOES(GLsizei n, const GLuint *renderbuffer
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17536,6 +18207,7 @@ void GL_APIENTRY GL_FramebufferRenderbufferOES(GLenum target,
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment),
           GLenumToString(GLESEnum::RenderbufferTarget, renderbuffertarget), renderbuffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferRenderbufferOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17544,6 +18216,7 @@ void GL_APIENTRY GL_FramebufferRenderbufferOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17590,6 +18263,7 @@ void GL_APIENTRY GL_FramebufferTexture2DOES(GLenum target,
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment),
           GLenumToString(GLESEnum::TextureTarget, textarget), texture, level);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferTexture2DOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17603,6 +18277,7 @@ void GL_APIENTRY GL_FramebufferTexture2DOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17642,6 +18317,7 @@ void GL_APIENTRY GL_GenFramebuffersOES(GLsizei n, GLuint *framebuffers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenFramebuffersOES, "context = %d, n = %d, framebuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)framebuffers);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenFramebuffersOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17650,6 +18326,7 @@ void GL_APIENTRY GL_GenFramebuffersOES(GLsizei n, GLuint *framebuffers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17685,6 +18362,7 @@ void GL_APIENTRY GL_GenRenderbuffersOES(GLsizei n, GLuint *renderbuffers)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenRenderbuffersOES, "context = %d, n = %d, renderbuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)renderbuffers);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenRenderbuffersOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17693,6 +18371,7 @@ void GL_APIENTRY GL_GenRenderbuffersOES(GLsizei n, GLuint *renderbuffers)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17728,6 +18407,7 @@ void GL_APIENTRY GL_GenerateMipmapOES(GLenum target)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenerateMipmapOES, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target));
+    ANGLE_PROFILE_ENTRY_POINT(GLGenerateMipmapOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17736,6 +18416,7 @@ void GL_APIENTRY GL_GenerateMipmapOES(GLenum target)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17777,6 +18458,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivOES(GLenum target,
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment),
           GLenumToString(GLESEnum::FramebufferAttachmentParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetFramebufferAttachmentParameterivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17784,6 +18466,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17825,6 +18508,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivOES(GLenum target, GLenum pname, G
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::RenderbufferTarget, target),
           GLenumToString(GLESEnum::RenderbufferParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetRenderbufferParameterivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17832,6 +18516,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivOES(GLenum target, GLenum pname, G
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17870,6 +18555,7 @@ GLboolean GL_APIENTRY GL_IsFramebufferOES(GLuint framebuffer)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsFramebufferOES, "context = %d, framebuffer = %u", CID(context), framebuffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsFramebufferOES);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -17879,6 +18565,7 @@ GLboolean GL_APIENTRY GL_IsFramebufferOES(GLuint framebuffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17920,6 +18607,7 @@ GLboolean GL_APIENTRY GL_IsRenderbufferOES(GLuint renderbuffer)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsRenderbufferOES, "context = %d, renderbuffer = %u", CID(context),
           renderbuffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsRenderbufferOES);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -17929,6 +18617,7 @@ GLboolean GL_APIENTRY GL_IsRenderbufferOES(GLuint renderbuffer)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -17976,6 +18665,7 @@ void GL_APIENTRY GL_RenderbufferStorageOES(GLenum target,
           "context = %d, target = %s, internalformat = %s, width = %d, height = %d", CID(context),
           GLenumToString(GLESEnum::RenderbufferTarget, target),
           GLenumToString(GLESEnum::InternalFormat, internalformat), width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLRenderbufferStorageOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -17983,6 +18673,7 @@ void GL_APIENTRY GL_RenderbufferStorageOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18026,6 +18717,7 @@ void GL_APIENTRY GL_FramebufferTextureOES(GLenum target,
           "context = %d, target = %s, attachment = %s, texture = %u, level = %d", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment), texture, level);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferTextureOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18038,6 +18730,7 @@ void GL_APIENTRY GL_FramebufferTextureOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().geometryShaderOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18083,6 +18776,7 @@ void GL_APIENTRY GL_GetProgramBinaryOES(GLuint program,
           ", binaryFormat = 0x%016" PRIxPTR ", binary = 0x%016" PRIxPTR "",
           CID(context), program, bufSize, (uintptr_t)length, (uintptr_t)binaryFormat,
           (uintptr_t)binary);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetProgramBinaryOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18091,6 +18785,7 @@ void GL_APIENTRY GL_GetProgramBinaryOES(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().getProgramBinaryOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18133,6 +18828,7 @@ void GL_APIENTRY GL_ProgramBinaryOES(GLuint program,
           "context = %d, program = %u, binaryFormat = %s, binary = 0x%016" PRIxPTR ", length = %d",
           CID(context), program, GLenumToString(GLESEnum::AllEnums, binaryFormat),
           (uintptr_t)binary, length);
+    ANGLE_PROFILE_ENTRY_POINT(GLProgramBinaryOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18141,6 +18837,7 @@ void GL_APIENTRY GL_ProgramBinaryOES(GLuint program,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().getProgramBinaryOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18183,6 +18880,7 @@ void GL_APIENTRY GL_GetBufferPointervOES(GLenum target, GLenum pname, void **par
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target),
           GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetBufferPointervOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18191,6 +18889,7 @@ void GL_APIENTRY GL_GetBufferPointervOES(GLenum target, GLenum pname, void **par
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().mapbufferOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18228,6 +18927,7 @@ void *GL_APIENTRY GL_MapBufferOES(GLenum target, GLenum access)
     EVENT(context, GLMapBufferOES, "context = %d, target = %s, access = %s", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target),
           GLenumToString(GLESEnum::BufferAccessARB, access));
+    ANGLE_PROFILE_ENTRY_POINT(GLMapBufferOES);
 
     void *returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -18237,6 +18937,7 @@ void *GL_APIENTRY GL_MapBufferOES(GLenum target, GLenum access)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().mapbufferOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18278,6 +18979,7 @@ GLboolean GL_APIENTRY GL_UnmapBufferOES(GLenum target)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUnmapBufferOES, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::AllEnums, target));
+    ANGLE_PROFILE_ENTRY_POINT(GLUnmapBufferOES);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -18287,6 +18989,7 @@ GLboolean GL_APIENTRY GL_UnmapBufferOES(GLenum target)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().mapbufferOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18329,6 +19032,7 @@ void GL_APIENTRY GL_CurrentPaletteMatrixOES(GLuint matrixpaletteindex)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCurrentPaletteMatrixOES, "context = %d, matrixpaletteindex = %u", CID(context),
           matrixpaletteindex);
+    ANGLE_PROFILE_ENTRY_POINT(GLCurrentPaletteMatrixOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18336,6 +19040,7 @@ void GL_APIENTRY GL_CurrentPaletteMatrixOES(GLuint matrixpaletteindex)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().matrixPaletteOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18371,6 +19076,7 @@ void GL_APIENTRY GL_LoadPaletteFromModelViewMatrixOES()
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoadPaletteFromModelViewMatrixOES, "context = %d", CID(context));
+    ANGLE_PROFILE_ENTRY_POINT(GLLoadPaletteFromModelViewMatrixOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18378,6 +19084,7 @@ void GL_APIENTRY GL_LoadPaletteFromModelViewMatrixOES()
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().matrixPaletteOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18419,6 +19126,7 @@ void GL_APIENTRY GL_MatrixIndexPointerOES(GLint size,
     EVENT(context, GLMatrixIndexPointerOES,
           "context = %d, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "",
           CID(context), size, GLenumToString(GLESEnum::AllEnums, type), stride, (uintptr_t)pointer);
+    ANGLE_PROFILE_ENTRY_POINT(GLMatrixIndexPointerOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18426,6 +19134,7 @@ void GL_APIENTRY GL_MatrixIndexPointerOES(GLint size,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().matrixPaletteOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18463,6 +19172,7 @@ void GL_APIENTRY GL_WeightPointerOES(GLint size, GLenum type, GLsizei stride, co
     EVENT(context, GLWeightPointerOES,
           "context = %d, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "",
           CID(context), size, GLenumToString(GLESEnum::AllEnums, type), stride, (uintptr_t)pointer);
+    ANGLE_PROFILE_ENTRY_POINT(GLWeightPointerOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18470,6 +19180,7 @@ void GL_APIENTRY GL_WeightPointerOES(GLint size, GLenum type, GLsizei stride, co
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().matrixPaletteOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18509,6 +19220,7 @@ void GL_APIENTRY GL_PointSizePointerOES(GLenum type, GLsizei stride, const void
     EVENT(context, GLPointSizePointerOES,
           "context = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::AllEnums, type), stride, (uintptr_t)pointer);
+    ANGLE_PROFILE_ENTRY_POINT(GLPointSizePointerOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18517,6 +19229,7 @@ void GL_APIENTRY GL_PointSizePointerOES(GLenum type, GLsizei stride, const void
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().pointSizeArrayOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18564,12 +19277,14 @@ void GL_APIENTRY GL_PrimitiveBoundingBoxOES(GLfloat minX,
           "context = %d, minX = %f, minY = %f, minZ = %f, minW = %f, maxX = %f, maxY = %f, maxZ = "
           "%f, maxW = %f",
           CID(context), minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
+    ANGLE_PROFILE_ENTRY_POINT(GLPrimitiveBoundingBoxOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().primitiveBoundingBoxOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18613,6 +19328,7 @@ GLbitfield GL_APIENTRY GL_QueryMatrixxOES(GLfixed *mantissa, GLint *exponent)
     EVENT(context, GLQueryMatrixxOES,
           "context = %d, mantissa = 0x%016" PRIxPTR ", exponent = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)mantissa, (uintptr_t)exponent);
+    ANGLE_PROFILE_ENTRY_POINT(GLQueryMatrixxOES);
 
     GLbitfield returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -18621,6 +19337,7 @@ GLbitfield GL_APIENTRY GL_QueryMatrixxOES(GLfixed *mantissa, GLint *exponent)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().queryMatrixOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18666,12 +19383,14 @@ void GL_APIENTRY GL_MinSampleShadingOES(GLfloat value)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMinSampleShadingOES, "context = %d, value = %f", CID(context), value);
+    ANGLE_PROFILE_ENTRY_POINT(GLMinSampleShadingOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().sampleShadingOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18722,12 +19441,14 @@ void GL_APIENTRY GL_PatchParameteriOES(GLenum pname, GLint value)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPatchParameteriOES, "context = %d, pname = %s, value = %d", CID(context),
           GLenumToString(GLESEnum::PatchParameterName, pname), value);
+    ANGLE_PROFILE_ENTRY_POINT(GLPatchParameteriOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().tessellationShaderOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18778,6 +19499,7 @@ void GL_APIENTRY GL_CompressedTexImage3DOES(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level,
           GLenumToString(GLESEnum::InternalFormat, internalformat), width, height, depth, border,
           imageSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedTexImage3DOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18786,6 +19508,7 @@ void GL_APIENTRY GL_CompressedTexImage3DOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().texture3DOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18839,6 +19562,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DOES(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, xoffset, yoffset,
           zoffset, width, height, depth, GLenumToString(GLESEnum::InternalFormat, format),
           imageSize, (uintptr_t)data);
+    ANGLE_PROFILE_ENTRY_POINT(GLCompressedTexSubImage3DOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18847,6 +19571,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().texture3DOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18897,6 +19622,7 @@ void GL_APIENTRY GL_CopyTexSubImage3DOES(GLenum target,
           "%d, y = %d, width = %d, height = %d",
           CID(context), GLenumToString(GLESEnum::AllEnums, target), level, xoffset, yoffset,
           zoffset, x, y, width, height);
+    ANGLE_PROFILE_ENTRY_POINT(GLCopyTexSubImage3DOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18909,6 +19635,7 @@ void GL_APIENTRY GL_CopyTexSubImage3DOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().texture3DOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -18956,6 +19683,7 @@ void GL_APIENTRY GL_FramebufferTexture3DOES(GLenum target,
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment),
           GLenumToString(GLESEnum::TextureTarget, textarget), texture, level, zoffset);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferTexture3DOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -18969,6 +19697,7 @@ void GL_APIENTRY GL_FramebufferTexture3DOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().texture3DOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19022,6 +19751,7 @@ void GL_APIENTRY GL_TexImage3DOES(GLenum target,
           GLenumToString(GLESEnum::InternalFormat, internalformat), width, height, depth, border,
           GLenumToString(GLESEnum::PixelFormat, format), GLenumToString(GLESEnum::PixelType, type),
           (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexImage3DOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19030,6 +19760,7 @@ void GL_APIENTRY GL_TexImage3DOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().texture3DOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19082,6 +19813,7 @@ void GL_APIENTRY GL_TexSubImage3DOES(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), level, xoffset, yoffset,
           zoffset, width, height, depth, GLenumToString(GLESEnum::PixelFormat, format),
           GLenumToString(GLESEnum::PixelType, type), (uintptr_t)pixels);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexSubImage3DOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19090,6 +19822,7 @@ void GL_APIENTRY GL_TexSubImage3DOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().texture3DOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19130,6 +19863,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivOES(GLuint sampler, GLenum pname, GLin
     EVENT(context, GLGetSamplerParameterIivOES,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterIivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19138,6 +19872,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivOES(GLuint sampler, GLenum pname, GLin
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19177,6 +19912,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivOES(GLuint sampler, GLenum pname, GLu
     EVENT(context, GLGetSamplerParameterIuivOES,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetSamplerParameterIuivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19185,6 +19921,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivOES(GLuint sampler, GLenum pname, GLu
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19225,6 +19962,7 @@ void GL_APIENTRY GL_GetTexParameterIivOES(GLenum target, GLenum pname, GLint *pa
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterIivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19233,6 +19971,7 @@ void GL_APIENTRY GL_GetTexParameterIivOES(GLenum target, GLenum pname, GLint *pa
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19271,6 +20010,7 @@ void GL_APIENTRY GL_GetTexParameterIuivOES(GLenum target, GLenum pname, GLuint *
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::GetTextureParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexParameterIuivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19279,6 +20019,7 @@ void GL_APIENTRY GL_GetTexParameterIuivOES(GLenum target, GLenum pname, GLuint *
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19316,6 +20057,7 @@ void GL_APIENTRY GL_SamplerParameterIivOES(GLuint sampler, GLenum pname, const G
     EVENT(context, GLSamplerParameterIivOES,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterIivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19324,6 +20066,7 @@ void GL_APIENTRY GL_SamplerParameterIivOES(GLuint sampler, GLenum pname, const G
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19361,6 +20104,7 @@ void GL_APIENTRY GL_SamplerParameterIuivOES(GLuint sampler, GLenum pname, const
     EVENT(context, GLSamplerParameterIuivOES,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), (uintptr_t)param);
+    ANGLE_PROFILE_ENTRY_POINT(GLSamplerParameterIuivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19369,6 +20113,7 @@ void GL_APIENTRY GL_SamplerParameterIuivOES(GLuint sampler, GLenum pname, const
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19409,6 +20154,7 @@ void GL_APIENTRY GL_TexParameterIivOES(GLenum target, GLenum pname, const GLint
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::TextureParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterIivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19417,6 +20163,7 @@ void GL_APIENTRY GL_TexParameterIivOES(GLenum target, GLenum pname, const GLint
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19454,6 +20201,7 @@ void GL_APIENTRY GL_TexParameterIuivOES(GLenum target, GLenum pname, const GLuin
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::TextureParameterName, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexParameterIuivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19462,6 +20210,7 @@ void GL_APIENTRY GL_TexParameterIuivOES(GLenum target, GLenum pname, const GLuin
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBorderClampOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19499,6 +20248,7 @@ void GL_APIENTRY GL_TexBufferOES(GLenum target, GLenum internalformat, GLuint bu
     EVENT(context, GLTexBufferOES, "context = %d, target = %s, internalformat = %s, buffer = %u",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), buffer);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexBufferOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19508,6 +20258,7 @@ void GL_APIENTRY GL_TexBufferOES(GLenum target, GLenum internalformat, GLuint bu
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBufferOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19551,6 +20302,7 @@ void GL_APIENTRY GL_TexBufferRangeOES(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), buffer,
           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(size));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexBufferRangeOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19560,6 +20312,7 @@ void GL_APIENTRY GL_TexBufferRangeOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureBufferOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19602,6 +20355,7 @@ void GL_APIENTRY GL_GetTexGenfvOES(GLenum coord, GLenum pname, GLfloat *params)
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
           GLenumToString(GLESEnum::TextureGenParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexGenfvOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19609,6 +20363,7 @@ void GL_APIENTRY GL_GetTexGenfvOES(GLenum coord, GLenum pname, GLfloat *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureCubeMapOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19646,6 +20401,7 @@ void GL_APIENTRY GL_GetTexGenivOES(GLenum coord, GLenum pname, GLint *params)
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
           GLenumToString(GLESEnum::TextureGenParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexGenivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19653,6 +20409,7 @@ void GL_APIENTRY GL_GetTexGenivOES(GLenum coord, GLenum pname, GLint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureCubeMapOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19690,6 +20447,7 @@ void GL_APIENTRY GL_GetTexGenxvOES(GLenum coord, GLenum pname, GLfixed *params)
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
           GLenumToString(GLESEnum::TextureGenParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLGetTexGenxvOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19697,6 +20455,7 @@ void GL_APIENTRY GL_GetTexGenxvOES(GLenum coord, GLenum pname, GLfixed *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureCubeMapOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19733,6 +20492,7 @@ void GL_APIENTRY GL_TexGenfOES(GLenum coord, GLenum pname, GLfloat param)
     EVENT(context, GLTexGenfOES, "context = %d, coord = %s, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
           GLenumToString(GLESEnum::TextureGenParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexGenfOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19740,6 +20500,7 @@ void GL_APIENTRY GL_TexGenfOES(GLenum coord, GLenum pname, GLfloat param)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureCubeMapOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19777,6 +20538,7 @@ void GL_APIENTRY GL_TexGenfvOES(GLenum coord, GLenum pname, const GLfloat *param
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
           GLenumToString(GLESEnum::TextureGenParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexGenfvOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19784,6 +20546,7 @@ void GL_APIENTRY GL_TexGenfvOES(GLenum coord, GLenum pname, const GLfloat *param
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureCubeMapOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19820,6 +20583,7 @@ void GL_APIENTRY GL_TexGeniOES(GLenum coord, GLenum pname, GLint param)
     EVENT(context, GLTexGeniOES, "context = %d, coord = %s, pname = %s, param = %d", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
           GLenumToString(GLESEnum::TextureGenParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexGeniOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19827,6 +20591,7 @@ void GL_APIENTRY GL_TexGeniOES(GLenum coord, GLenum pname, GLint param)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureCubeMapOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19864,6 +20629,7 @@ void GL_APIENTRY GL_TexGenivOES(GLenum coord, GLenum pname, const GLint *params)
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
           GLenumToString(GLESEnum::TextureGenParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexGenivOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19871,6 +20637,7 @@ void GL_APIENTRY GL_TexGenivOES(GLenum coord, GLenum pname, const GLint *params)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureCubeMapOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19907,6 +20674,7 @@ void GL_APIENTRY GL_TexGenxOES(GLenum coord, GLenum pname, GLfixed param)
     EVENT(context, GLTexGenxOES, "context = %d, coord = %s, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
           GLenumToString(GLESEnum::TextureGenParameter, pname), param);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexGenxOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19914,6 +20682,7 @@ void GL_APIENTRY GL_TexGenxOES(GLenum coord, GLenum pname, GLfixed param)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureCubeMapOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -19951,6 +20720,7 @@ void GL_APIENTRY GL_TexGenxvOES(GLenum coord, GLenum pname, const GLfixed *param
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
           GLenumToString(GLESEnum::TextureGenParameter, pname), (uintptr_t)params);
+    ANGLE_PROFILE_ENTRY_POINT(GLTexGenxvOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -19958,6 +20728,7 @@ void GL_APIENTRY GL_TexGenxvOES(GLenum coord, GLenum pname, const GLfixed *param
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureCubeMapOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20020,6 +20791,7 @@ void GL_APIENTRY GL_TexStorage3DMultisampleOES(GLenum target,
           CID(context), GLenumToString(GLESEnum::TextureTarget, target), samples,
           GLenumToString(GLESEnum::SizedInternalFormat, internalformat), width, height, depth,
           GLbooleanToString(fixedsamplelocations));
+    ANGLE_PROFILE_ENTRY_POINT(GLTexStorage3DMultisampleOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -20028,6 +20800,7 @@ void GL_APIENTRY GL_TexStorage3DMultisampleOES(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureStorageMultisample2dArrayOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20067,6 +20840,7 @@ void GL_APIENTRY GL_BindVertexArrayOES(GLuint array)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindVertexArrayOES, "context = %d, array = %u", CID(context), array);
+    ANGLE_PROFILE_ENTRY_POINT(GLBindVertexArrayOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -20075,6 +20849,7 @@ void GL_APIENTRY GL_BindVertexArrayOES(GLuint array)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().vertexArrayObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20110,6 +20885,7 @@ void GL_APIENTRY GL_DeleteVertexArraysOES(GLsizei n, const GLuint *arrays)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteVertexArraysOES, "context = %d, n = %d, arrays = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)arrays);
+    ANGLE_PROFILE_ENTRY_POINT(GLDeleteVertexArraysOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -20118,6 +20894,7 @@ void GL_APIENTRY GL_DeleteVertexArraysOES(GLsizei n, const GLuint *arrays)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().vertexArrayObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20153,6 +20930,7 @@ void GL_APIENTRY GL_GenVertexArraysOES(GLsizei n, GLuint *arrays)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenVertexArraysOES, "context = %d, n = %d, arrays = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)arrays);
+    ANGLE_PROFILE_ENTRY_POINT(GLGenVertexArraysOES);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -20160,6 +20938,7 @@ void GL_APIENTRY GL_GenVertexArraysOES(GLsizei n, GLuint *arrays)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().vertexArrayObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20196,6 +20975,7 @@ GLboolean GL_APIENTRY GL_IsVertexArrayOES(GLuint array)
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsVertexArrayOES, "context = %d, array = %u", CID(context), array);
+    ANGLE_PROFILE_ENTRY_POINT(GLIsVertexArrayOES);
 
     GLboolean returnValue;
     if (ANGLE_LIKELY(context != nullptr))
@@ -20204,6 +20984,7 @@ GLboolean GL_APIENTRY GL_IsVertexArrayOES(GLuint array)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().vertexArrayObjectOES))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20262,6 +21043,7 @@ void GL_APIENTRY GL_FramebufferTextureMultiviewOVR(GLenum target,
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
           GLenumToString(GLESEnum::FramebufferAttachment, attachment), texture, level,
           baseViewIndex, numViews);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferTextureMultiviewOVR);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -20274,6 +21056,7 @@ void GL_APIENTRY GL_FramebufferTextureMultiviewOVR(GLenum target,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().multiviewOVR))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20324,6 +21107,7 @@ void GL_APIENTRY GL_FramebufferFoveationConfigQCOM(GLuint framebuffer,
           "requestedFeatures = %u, providedFeatures = 0x%016" PRIxPTR "",
           CID(context), framebuffer, numLayers, focalPointsPerLayer, requestedFeatures,
           (uintptr_t)providedFeatures);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferFoveationConfigQCOM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -20332,6 +21116,7 @@ void GL_APIENTRY GL_FramebufferFoveationConfigQCOM(GLuint framebuffer,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferFoveatedQCOM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20381,6 +21166,7 @@ void GL_APIENTRY GL_FramebufferFoveationParametersQCOM(GLuint framebuffer,
           "context = %d, framebuffer = %u, layer = %u, focalPoint = %u, focalX = %f, focalY = %f, "
           "gainX = %f, gainY = %f, foveaArea = %f",
           CID(context), framebuffer, layer, focalPoint, focalX, focalY, gainX, gainY, foveaArea);
+    ANGLE_PROFILE_ENTRY_POINT(GLFramebufferFoveationParametersQCOM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -20389,6 +21175,7 @@ void GL_APIENTRY GL_FramebufferFoveationParametersQCOM(GLuint framebuffer,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().framebufferFoveatedQCOM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20433,6 +21220,7 @@ void GL_APIENTRY GL_ShadingRateQCOM(GLenum rate)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLShadingRateQCOM, "context = %d, rate = %s", CID(context),
           GLenumToString(GLESEnum::ShadingRateQCOM, rate));
+    ANGLE_PROFILE_ENTRY_POINT(GLShadingRateQCOM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -20440,6 +21228,7 @@ void GL_APIENTRY GL_ShadingRateQCOM(GLenum rate)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().shadingRateQCOM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20487,6 +21276,7 @@ void GL_APIENTRY GL_TextureFoveationParametersQCOM(GLuint texture,
           "context = %d, texture = %u, layer = %u, focalPoint = %u, focalX = %f, focalY = %f, "
           "gainX = %f, gainY = %f, foveaArea = %f",
           CID(context), texture, layer, focalPoint, focalX, focalY, gainX, gainY, foveaArea);
+    ANGLE_PROFILE_ENTRY_POINT(GLTextureFoveationParametersQCOM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -20495,6 +21285,7 @@ void GL_APIENTRY GL_TextureFoveationParametersQCOM(GLuint texture,
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().textureFoveatedQCOM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20536,6 +21327,7 @@ void GL_APIENTRY GL_EndTilingQCOM(GLbitfield preserveMask)
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndTilingQCOM, "context = %d, preserveMask = %s", CID(context),
           GLbitfieldToString(GLESEnum::BufferBitQCOM, preserveMask).c_str());
+    ANGLE_PROFILE_ENTRY_POINT(GLEndTilingQCOM);
 
     if (ANGLE_LIKELY(context != nullptr))
     {
@@ -20543,6 +21335,7 @@ void GL_APIENTRY GL_EndTilingQCOM(GLbitfield preserveMask)
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().tiledRenderingQCOM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -20591,6 +21384,7 @@ GL_StartTilingQCOM(GLuint x, GLuint y, GLuint width, GLuint height, GLbitfield p
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
+            ANGLE_PROFILE_PHASE(Validation);
             if (ANGLE_LIKELY(context->getExtensions().tiledRenderingQCOM))
             {
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -0,0 +1,258 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CLCommandQueueVkDependencyTest:
+//   Tests that the kernels of out-of-order queues see the results of the commands they depend on.
+//
+
+#include "cl_tests/CLVulkanTest.h"
+
+using namespace angle;
+
+namespace
+{
+// Large enough for a missing barrier to let the kernels overlap
+constexpr size_t kElementCount = 1024 * 1024;
+constexpr size_t kBufferSize   = sizeof(cl_int) * kElementCount;
+
+constexpr char kSource[] = R"(
+__kernel void fill(__global int *output, int value)
+{
+    int gid = get_global_id(0);
+    output[gid] = gid + value;
+}
+
+__kernel void copyAdd(__global const int *input, __global int *output, int value)
+{
+    int gid = get_global_id(0);
+    output[gid] = input[gid] + value;
+}
+
+__kernel void increment(__global int *data)
+{
+    int gid = get_global_id(0);
+    data[gid] += 1;
+}
+
+__kernel void read(__global const int *input)
+{
+    int gid = get_global_id(0);
+    volatile int value = input[gid];
+})";
+
+class CLCommandQueueVkDependencyTest : public CLVulkanTest
+{
+  protected:
+    void SetUp() override
+    {
+        CLVulkanTest::SetUp();
+        if (mContext == nullptr)
+        {
+            return;
+        }
+
+        mQueue = createQueue(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+        if (mQueue == nullptr)
+        {
+            GTEST_SKIP() << "Out-of-order queues are not supported";
+        }
+
+        mProgram = buildProgram(kSource);
+
+        cl_int error = CL_SUCCESS;
+        mFill        = cl::clCreateKernel(mProgram, "fill", &error);
+        ASSERT_EQ(CL_SUCCESS, error);
+        mCopyAdd = cl::clCreateKernel(mProgram, "copyAdd", &error);
+        ASSERT_EQ(CL_SUCCESS, error);
+        mIncrement = cl::clCreateKernel(mProgram, "increment", &error);
+        ASSERT_EQ(CL_SUCCESS, error);
+        mRead = cl::clCreateKernel(mProgram, "read", &error);
+        ASSERT_EQ(CL_SUCCESS, error);
+    }
+
+    void TearDown() override
+    {
+        for (cl_event event : mEvents)
+        {
+            cl::clReleaseEvent(event);
+        }
+        for (cl_mem buffer : mBuffers)
+        {
+            cl::clReleaseMemObject(buffer);
+        }
+        for (cl_kernel kernel : {mFill, mCopyAdd, mIncrement, mRead})
+        {
+            if (kernel != nullptr)
+            {
+                cl::clReleaseKernel(kernel);
+            }
+        }
+        if (mProgram != nullptr)
+        {
+            cl::clReleaseProgram(mProgram);
+        }
+        CLVulkanTest::TearDown();
+    }
+
+    cl_mem createTestBuffer()
+    {
+        mBuffers.push_back(createBuffer(kBufferSize));
+        return mBuffers.back();
+    }
+
+    cl_event enqueueKernel(cl_kernel kernel, const std::vector<cl_event> &waitEvents)
+    {
+        size_t globalWorkSize = kElementCount;
+        cl_event event        = nullptr;
+        EXPECT_EQ(CL_SUCCESS, cl::clEnqueueNDRangeKernel(
+                                  mQueue, kernel, 1, nullptr, &globalWorkSize, nullptr,
+                                  static_cast<cl_uint>(waitEvents.size()),
+                                  waitEvents.empty() ? nullptr : waitEvents.data(), &event));
+        mEvents.push_back(event);
+        return event;
+    }
+
+    cl_event enqueueFill(cl_mem output, cl_int value, const std::vector<cl_event> &waitEvents)
+    {
+        EXPECT_EQ(CL_SUCCESS, cl::clSetKernelArg(mFill, 0, sizeof(cl_mem), &output));
+        EXPECT_EQ(CL_SUCCESS, cl::clSetKernelArg(mFill, 1, sizeof(cl_int), &value));
+        return enqueueKernel(mFill, waitEvents);
+    }
+
+    cl_event enqueueCopyAdd(cl_mem input,
+                            cl_mem output,
+                            cl_int value,
+                            const std::vector<cl_event> &waitEvents)
+    {
+        EXPECT_EQ(CL_SUCCESS, cl::clSetKernelArg(mCopyAdd, 0, sizeof(cl_mem), &input));
+        EXPECT_EQ(CL_SUCCESS, cl::clSetKernelArg(mCopyAdd, 1, sizeof(cl_mem), &output));
+        EXPECT_EQ(CL_SUCCESS, cl::clSetKernelArg(mCopyAdd, 2, sizeof(cl_int), &value));
+        return enqueueKernel(mCopyAdd, waitEvents);
+    }
+
+    cl_event enqueueIncrement(cl_mem data, const std::vector<cl_event> &waitEvents)
+    {
+        EXPECT_EQ(CL_SUCCESS, cl::clSetKernelArg(mIncrement, 0, sizeof(cl_mem), &data));
+        return enqueueKernel(mIncrement, waitEvents);
+    }
+
+    cl_event enqueueRead(cl_mem input, const std::vector<cl_event> &waitEvents)
+    {
+        EXPECT_EQ(CL_SUCCESS, cl::clSetKernelArg(mRead, 0, sizeof(cl_mem), &input));
+        return enqueueKernel(mRead, waitEvents);
+    }
+
+    // Reads the buffer once the wait events are complete, and checks that each element is its
+    // index plus |value|.
+    void expectBufferContents(cl_mem buffer, cl_int value, const std::vector<cl_event> &waitEvents)
+    {
+        std::vector<cl_int> results(kElementCount);
+        ASSERT_EQ(CL_SUCCESS, cl::clEnqueueReadBuffer(
+                                  mQueue, buffer, CL_TRUE, 0, kBufferSize, results.data(),
+                                  static_cast<cl_uint>(waitEvents.size()),
+                                  waitEvents.empty() ? nullptr : waitEvents.data(), nullptr));
+        for (size_t i = 0; i < kElementCount; ++i)
+        {
+            ASSERT_EQ(static_cast<cl_int>(i) + value, results[i]) << "at element " << i;
+        }
+    }
+
+    cl_command_queue mQueue = nullptr;
+    cl_program mProgram     = nullptr;
+    cl_kernel mFill         = nullptr;
+    cl_kernel mCopyAdd      = nullptr;
+    cl_kernel mIncrement    = nullptr;
+    cl_kernel mRead         = nullptr;
+    std::vector<cl_mem> mBuffers;
+    std::vector<cl_event> mEvents;
+};
+
+// Test that kernels without dependencies on each other both complete.
+TEST_F(CLCommandQueueVkDependencyTest, IndependentKernels)
+{
+    cl_mem first  = createTestBuffer();
+    cl_mem second = createTestBuffer();
+
+    cl_event fillFirst  = enqueueFill(first, 1, {});
+    cl_event fillSecond = enqueueFill(second, 2, {});
+
+    expectBufferContents(first, 1, {fillFirst});
+    expectBufferContents(second, 2, {fillSecond});
+}
+
+// Test that a kernel waiting on the kernel that wrote its input reads the written values.
+TEST_F(CLCommandQueueVkDependencyTest, ReadAfterWriteThroughWaitList)
+{
+    cl_mem input  = createTestBuffer();
+    cl_mem output = createTestBuffer();
+
+    cl_event fill = enqueueFill(input, 5, {});
+    cl_event copy = enqueueCopyAdd(input, output, 3, {fill});
+
+    expectBufferContents(output, 8, {copy});
+}
+
+// Test that a kernel waiting on a kernel that waited on the writer of its input reads the written
+// values, while the kernel in between doesn't access that input.
+TEST_F(CLCommandQueueVkDependencyTest, DependenciesInheritedThroughChain)
+{
+    cl_mem input     = createTestBuffer();
+    cl_mem unrelated = createTestBuffer();
+    cl_mem output    = createTestBuffer();
+
+    cl_event fill      = enqueueFill(input, 5, {});
+    cl_event inBetween = enqueueFill(unrelated, 1, {fill});
+    cl_event copy      = enqueueCopyAdd(input, output, 3, {inBetween});
+
+    expectBufferContents(output, 8, {copy});
+    expectBufferContents(unrelated, 1, {inBetween});
+}
+
+// Test a long chain of kernels that each update the results of the previous one.
+TEST_F(CLCommandQueueVkDependencyTest, LongChain)
+{
+    constexpr cl_int kChainLength = 600;
+
+    cl_mem data    = createTestBuffer();
+    cl_event event = enqueueFill(data, 0, {});
+    for (cl_int i = 0; i < kChainLength; ++i)
+    {
+        event = enqueueIncrement(data, {event});
+    }
+
+    expectBufferContents(data, kChainLength, {event});
+}
+
+// Test a chain of kernels that only read the same input, so don't need barriers between them, and
+// wait on more commands than are tracked between barriers.
+TEST_F(CLCommandQueueVkDependencyTest, LongChainOfReaders)
+{
+    constexpr int kChainLength = 600;
+
+    cl_mem input   = createTestBuffer();
+    cl_mem output  = createTestBuffer();
+    cl_event event = enqueueFill(input, 5, {});
+    for (int i = 0; i < kChainLength; ++i)
+    {
+        event = enqueueRead(input, {event});
+    }
+    cl_event copy = enqueueCopyAdd(input, output, 3, {event});
+
+    expectBufferContents(output, 8, {copy});
+}
+
+// Test that the kernels enqueued after a finish see the results of the commands before it.
+TEST_F(CLCommandQueueVkDependencyTest, FinishOrdersLaterKernels)
+{
+    cl_mem input  = createTestBuffer();
+    cl_mem output = createTestBuffer();
+
+    enqueueFill(input, 5, {});
+    ASSERT_EQ(CL_SUCCESS, cl::clFinish(mQueue));
+    cl_event copy = enqueueCopyAdd(input, output, 3, {});
+
+    expectBufferContents(output, 8, {copy});
+}
+}  // anonymous namespace
@@ -0,0 +1,178 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CLProgramVkCacheTest:
+//   Tests that the clspv output of CL programs is reused by identical builds, including through
+//   the application's blob cache.
+//
+
+#include "cl_tests/CLVulkanTest.h"
+
+#include <map>
+
+#include "libANGLE/CLContext.h"
+#include "libANGLE/CLPlatform.h"
+#include "libANGLE/renderer/vulkan/CLContextVk.h"
+#include "libANGLE/renderer/vulkan/CLPlatformVk.h"
+#include "libANGLE/renderer/vulkan/vk_renderer.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr size_t kElementCount = 64;
+
+constexpr char kSource[] = R"(
+    __kernel void addOffset(__global int *output, int offset)
+    {
+        int gid = get_global_id(0);
+        output[gid] = gid + offset;
+    })";
+
+// Stands in for the application's cache, which outlives the process.
+std::map<std::vector<uint8_t>, std::vector<uint8_t>> gApplicationCache;
+
+void SetBlob(const void *key,
+             EGLsizeiANDROID keySize,
+             const void *value,
+             EGLsizeiANDROID valueSize)
+{
+    const uint8_t *keyBytes   = static_cast<const uint8_t *>(key);
+    const uint8_t *valueBytes = static_cast<const uint8_t *>(value);
+    gApplicationCache[std::vector<uint8_t>(keyBytes, keyBytes + keySize)] =
+        std::vector<uint8_t>(valueBytes, valueBytes + valueSize);
+}
+
+EGLsizeiANDROID GetBlob(const void *key,
+                        EGLsizeiANDROID keySize,
+                        void *value,
+                        EGLsizeiANDROID valueSize)
+{
+    const uint8_t *keyBytes = static_cast<const uint8_t *>(key);
+    auto iter = gApplicationCache.find(std::vector<uint8_t>(keyBytes, keyBytes + keySize));
+    if (iter == gApplicationCache.end())
+    {
+        return 0;
+    }
+    if (static_cast<size_t>(valueSize) >= iter->second.size())
+    {
+        memcpy(value, iter->second.data(), iter->second.size());
+    }
+    return static_cast<EGLsizeiANDROID>(iter->second.size());
+}
+
+class CLProgramVkCacheTest : public CLVulkanTest
+{
+  protected:
+    void SetUp() override
+    {
+        CLVulkanTest::SetUp();
+        if (mContext != nullptr)
+        {
+            mQueue = createQueue(0);
+            ASSERT_NE(nullptr, mQueue);
+        }
+    }
+
+    rx::CLPlatformVk &getPlatformVk()
+    {
+        return mContext->cast<cl::Context>().getPlatform().getImpl<rx::CLPlatformVk>();
+    }
+
+    // Drops the clspv output kept in memory.
+    void unloadCompiler()
+    {
+        cl_platform_id platform = nullptr;
+        ASSERT_EQ(CL_SUCCESS, cl::clGetDeviceInfo(mDevice, CL_DEVICE_PLATFORM, sizeof(platform),
+                                                  &platform, nullptr));
+        ASSERT_EQ(CL_SUCCESS, cl::clUnloadPlatformCompiler(platform));
+    }
+
+    rx::CacheStats getClspvCacheStats()
+    {
+        return mContext->cast<cl::Context>()
+            .getImpl<rx::CLContextVk>()
+            .getRenderer()
+            ->getCacheStats(rx::VulkanCacheType::ClspvProgram);
+    }
+
+    // Runs the kernel of the program, which writes its work-item id plus |offset| to each element.
+    void expectKernelRuns(cl_program program, const char *kernelName, cl_int offset)
+    {
+        cl_int error     = CL_SUCCESS;
+        cl_kernel kernel = cl::clCreateKernel(program, kernelName, &error);
+        ASSERT_EQ(CL_SUCCESS, error);
+        cl_mem output = createBuffer(sizeof(cl_int) * kElementCount);
+
+        EXPECT_EQ(CL_SUCCESS, cl::clSetKernelArg(kernel, 0, sizeof(cl_mem), &output));
+        EXPECT_EQ(CL_SUCCESS, cl::clSetKernelArg(kernel, 1, sizeof(cl_int), &offset));
+        size_t globalWorkSize = kElementCount;
+        EXPECT_EQ(CL_SUCCESS, cl::clEnqueueNDRangeKernel(mQueue, kernel, 1, nullptr,
+                                                         &globalWorkSize, nullptr, 0, nullptr,
+                                                         nullptr));
+
+        std::vector<cl_int> results(kElementCount);
+        EXPECT_EQ(CL_SUCCESS, cl::clEnqueueReadBuffer(mQueue, output, CL_TRUE, 0,
+                                                      sizeof(cl_int) * kElementCount,
+                                                      results.data(), 0, nullptr, nullptr));
+        for (size_t i = 0; i < kElementCount; ++i)
+        {
+            EXPECT_EQ(static_cast<cl_int>(i) + offset, results[i]) << "at element " << i;
+        }
+
+        cl::clReleaseMemObject(output);
+        cl::clReleaseKernel(kernel);
+    }
+
+    cl_command_queue mQueue = nullptr;
+};
+
+// Test that building the same source twice reuses the output of the first build, and that the
+// kernels of both programs run.
+TEST_F(CLProgramVkCacheTest, IdenticalBuildHitsCache)
+{
+    // The source may already have been built by an earlier test in the process, so only the
+    // difference made by the second build is checked.
+    cl_program first                = buildProgram(kSource);
+    rx::CacheStats statsAfterFirst  = getClspvCacheStats();
+    cl_program second               = buildProgram(kSource);
+    rx::CacheStats statsAfterSecond = getClspvCacheStats();
+
+    EXPECT_EQ(statsAfterFirst.getHitCount() + 1, statsAfterSecond.getHitCount());
+    EXPECT_EQ(statsAfterFirst.getMissCount(), statsAfterSecond.getMissCount());
+
+    expectKernelRuns(first, "addOffset", 3);
+    expectKernelRuns(second, "addOffset", 7);
+
+    cl::clReleaseProgram(first);
+    cl::clReleaseProgram(second);
+}
+
+// Test that the output of a build is stored in the application's blob cache, and is loaded back
+// from it once it is no longer kept in memory.
+TEST_F(CLProgramVkCacheTest, ApplicationCacheRoundTrip)
+{
+    gApplicationCache.clear();
+    getPlatformVk().setBlobCacheFuncs(SetBlob, GetBlob);
+    unloadCompiler();
+
+    cl_program first               = buildProgram(kSource);
+    rx::CacheStats statsAfterFirst = getClspvCacheStats();
+    EXPECT_EQ(1u, gApplicationCache.size());
+
+    unloadCompiler();
+    cl_program second               = buildProgram(kSource);
+    rx::CacheStats statsAfterSecond = getClspvCacheStats();
+
+    EXPECT_EQ(statsAfterFirst.getHitCount() + 1, statsAfterSecond.getHitCount());
+    EXPECT_EQ(statsAfterFirst.getMissCount(), statsAfterSecond.getMissCount());
+
+    expectKernelRuns(second, "addOffset", 5);
+
+    getPlatformVk().setBlobCacheFuncs(nullptr, nullptr);
+    cl::clReleaseProgram(first);
+    cl::clReleaseProgram(second);
+}
+}  // anonymous namespace
@@ -0,0 +1,119 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CLVulkanTest.h:
+//   Fixture of the white-box tests of the Vulkan CL backend, which call the CL entry points of
+//   libGLESv2 directly.
+//
+
+#ifndef ANGLE_TESTS_CL_TESTS_CLVULKANTEST_H_
+#define ANGLE_TESTS_CL_TESTS_CLVULKANTEST_H_
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "libGLESv2/entry_points_cl_autogen.h"
+
+namespace angle
+{
+class CLVulkanTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        cl_uint platformCount = 0;
+        cl::clGetPlatformIDs(0, nullptr, &platformCount);
+        std::vector<cl_platform_id> platforms(platformCount);
+        if (platformCount > 0)
+        {
+            cl::clGetPlatformIDs(platformCount, platforms.data(), nullptr);
+        }
+
+        // The Vulkan platform is the one ANGLE implements itself, the others pass through.
+        for (cl_platform_id platform : platforms)
+        {
+            char version[256] = {};
+            cl::clGetPlatformInfo(platform, CL_PLATFORM_VERSION, sizeof(version), version,
+                                  nullptr);
+            if (std::string(version).find("ANGLE") != std::string::npos &&
+                cl::clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &mDevice, nullptr) ==
+                    CL_SUCCESS)
+            {
+                break;
+            }
+            mDevice = nullptr;
+        }
+        if (mDevice == nullptr)
+        {
+            GTEST_SKIP() << "No ANGLE Vulkan CL device";
+        }
+
+        cl_int error = CL_SUCCESS;
+        mContext     = cl::clCreateContext(nullptr, 1, &mDevice, nullptr, nullptr, &error);
+        ASSERT_EQ(CL_SUCCESS, error);
+    }
+
+    void TearDown() override
+    {
+        for (cl_command_queue queue : mQueues)
+        {
+            cl::clReleaseCommandQueue(queue);
+        }
+        if (mContext != nullptr)
+        {
+            cl::clReleaseContext(mContext);
+        }
+    }
+
+    // Returns null if the device doesn't support the queue properties.
+    cl_command_queue createQueue(cl_command_queue_properties properties)
+    {
+        cl_command_queue_properties supportedProperties = 0;
+        cl::clGetDeviceInfo(mDevice, CL_DEVICE_QUEUE_ON_HOST_PROPERTIES,
+                            sizeof(supportedProperties), &supportedProperties, nullptr);
+        if ((supportedProperties & properties) != properties)
+        {
+            return nullptr;
+        }
+
+        const cl_queue_properties queueProperties[] = {CL_QUEUE_PROPERTIES, properties, 0};
+
+        cl_int error = CL_SUCCESS;
+        cl_command_queue queue =
+            cl::clCreateCommandQueueWithProperties(mContext, mDevice, queueProperties, &error);
+        EXPECT_EQ(CL_SUCCESS, error);
+        if (queue != nullptr)
+        {
+            mQueues.push_back(queue);
+        }
+        return queue;
+    }
+
+    cl_program buildProgram(const char *source)
+    {
+        cl_int error       = CL_SUCCESS;
+        cl_program program = cl::clCreateProgramWithSource(mContext, 1, &source, nullptr, &error);
+        EXPECT_EQ(CL_SUCCESS, error);
+        EXPECT_EQ(CL_SUCCESS, cl::clBuildProgram(program, 1, &mDevice, nullptr, nullptr, nullptr));
+        return program;
+    }
+
+    cl_mem createBuffer(size_t size)
+    {
+        cl_int error  = CL_SUCCESS;
+        cl_mem buffer = cl::clCreateBuffer(mContext, CL_MEM_READ_WRITE, size, nullptr, &error);
+        EXPECT_EQ(CL_SUCCESS, error);
+        return buffer;
+    }
+
+    cl_device_id mDevice = nullptr;
+    cl_context mContext  = nullptr;
+    std::vector<cl_command_queue> mQueues;
+};
+}  // namespace angle
+
+#endif  // ANGLE_TESTS_CL_TESTS_CLVULKANTEST_H_
@@ -0,0 +1,274 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeSPIRV_test.cpp:
+//   Test that the SPIR-V optimizer removes redundant local variable accesses from the generated
+//   SPIR-V without removing anything that is used.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "common/spirv/spirv_instruction_parser_autogen.h"
+#include "gtest/gtest.h"
+
+namespace spirv = angle::spirv;
+
+namespace
+{
+struct InstructionCounts
+{
+    size_t wordCount      = 0;
+    size_t loads          = 0;
+    size_t stores         = 0;
+    size_t localVariables = 0;
+    size_t functions      = 0;
+};
+
+class OptimizeSPIRVTest : public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        sh::InitBuiltInResources(&mResources);
+        mCompiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                          SH_SPIRV_VULKAN_OUTPUT, &mResources);
+        ASSERT_TRUE(mCompiler != nullptr);
+    }
+
+    void TearDown() override
+    {
+        if (mCompiler)
+        {
+            sh::Destruct(mCompiler);
+            mCompiler = nullptr;
+        }
+    }
+
+    // Compile the shader with and without the optimizer, and gather the instruction counts of
+    // each.
+    void compile(const char *shaderSource,
+                 InstructionCounts *unoptimizedOut,
+                 InstructionCounts *optimizedOut)
+    {
+        compile(shaderSource, false, unoptimizedOut);
+        compile(shaderSource, true, optimizedOut);
+    }
+
+  private:
+    void compile(const char *shaderSource, bool optimize, InstructionCounts *countsOut)
+    {
+        const char *shaderStrings[] = {shaderSource};
+
+        ShCompileOptions options        = {};
+        options.objectCode              = true;
+        options.removeInactiveVariables = true;
+        options.optimizeSPIRV           = optimize;
+
+        ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, options))
+            << sh::GetInfoLog(mCompiler);
+
+        CountInstructions(sh::GetObjectBinaryBlob(mCompiler), countsOut);
+    }
+
+    static void CountInstructions(const spirv::Blob &blob, InstructionCounts *countsOut);
+
+    ShBuiltInResources mResources;
+    ShHandle mCompiler = nullptr;
+};
+
+void OptimizeSPIRVTest::CountInstructions(const spirv::Blob &blob, InstructionCounts *countsOut)
+{
+    *countsOut           = {};
+    countsOut->wordCount = blob.size();
+
+    size_t currentWord = spirv::kHeaderIndexInstructions;
+    while (currentWord < blob.size())
+    {
+        uint32_t wordCount;
+        spv::Op opCode;
+        const uint32_t *instruction = &blob[currentWord];
+        spirv::GetInstructionOpAndLength(instruction, &opCode, &wordCount);
+
+        currentWord += wordCount;
+
+        switch (opCode)
+        {
+            case spv::OpLoad:
+                ++countsOut->loads;
+                break;
+            case spv::OpStore:
+                ++countsOut->stores;
+                break;
+            case spv::OpFunction:
+                ++countsOut->functions;
+                break;
+            case spv::OpVariable:
+            {
+                spirv::IdResultType type;
+                spirv::IdResult id;
+                spv::StorageClass storageClass;
+                spirv::ParseVariable(instruction, &type, &id, &storageClass, nullptr);
+                if (storageClass == spv::StorageClassFunction)
+                {
+                    ++countsOut->localVariables;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+// Test that a chain of temporaries is forwarded, leaving no local variables behind.
+TEST_F(OptimizeSPIRVTest, ForwardLocalVariables)
+{
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 color;
+void main()
+{
+    vec4 a = u * 2.0;
+    vec4 b = a + u;
+    vec4 c = b * a;
+    c = c - b;
+    color = c;
+})";
+
+    InstructionCounts unoptimized, optimized;
+    compile(kFS, &unoptimized, &optimized);
+
+    EXPECT_LT(optimized.loads, unoptimized.loads);
+    EXPECT_LT(optimized.stores, unoptimized.stores);
+    EXPECT_LT(optimized.localVariables, unoptimized.localVariables);
+    EXPECT_EQ(optimized.localVariables, 0u);
+    EXPECT_LT(optimized.wordCount, unoptimized.wordCount);
+}
+
+// Test that a store that is overwritten before being read is removed.
+TEST_F(OptimizeSPIRVTest, DeadStore)
+{
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+uniform vec4 v;
+out vec4 color;
+void main()
+{
+    vec4 a = u;
+    a = v;
+    color = a;
+})";
+
+    InstructionCounts unoptimized, optimized;
+    compile(kFS, &unoptimized, &optimized);
+
+    EXPECT_LT(optimized.stores, unoptimized.stores);
+    EXPECT_EQ(optimized.localVariables, 0u);
+}
+
+// Test that a local variable whose elements are individually accessed is kept.
+TEST_F(OptimizeSPIRVTest, PartiallyAccessedVariableIsKept)
+{
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 color;
+void main()
+{
+    vec4 a = u;
+    a.x = 1.0;
+    color = a;
+})";
+
+    InstructionCounts unoptimized, optimized;
+    compile(kFS, &unoptimized, &optimized);
+
+    EXPECT_EQ(optimized.localVariables, unoptimized.localVariables);
+    EXPECT_GE(optimized.localVariables, 1u);
+}
+
+// Test that a variable accessed across blocks is kept, but the accesses within each block are
+// still optimized.
+TEST_F(OptimizeSPIRVTest, AccessAcrossBlocks)
+{
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+uniform bool b;
+out vec4 color;
+void main()
+{
+    vec4 a = u;
+    if (b)
+    {
+        a = a * 2.0;
+        a = a + u;
+    }
+    color = a;
+})";
+
+    InstructionCounts unoptimized, optimized;
+    compile(kFS, &unoptimized, &optimized);
+
+    EXPECT_GE(optimized.localVariables, 1u);
+    EXPECT_LT(optimized.loads, unoptimized.loads);
+}
+
+// Test that functions that are called are not removed.
+TEST_F(OptimizeSPIRVTest, CalledFunctionsAreKept)
+{
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 color;
+vec4 f(vec4 x)
+{
+    return x * 0.5;
+}
+vec4 g(vec4 x)
+{
+    return f(x) + 0.25;
+}
+void main()
+{
+    color = g(u);
+})";
+
+    InstructionCounts unoptimized, optimized;
+    compile(kFS, &unoptimized, &optimized);
+
+    EXPECT_EQ(optimized.functions, unoptimized.functions);
+    EXPECT_EQ(optimized.functions, 3u);
+}
+
+// Test that an uninitialized out parameter is handled.
+TEST_F(OptimizeSPIRVTest, OutParameter)
+{
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+out vec4 color;
+void f(vec4 x, out vec4 y)
+{
+    vec4 t = x * 0.5;
+    y = t;
+}
+void main()
+{
+    vec4 result;
+    f(u, result);
+    color = result;
+})";
+
+    InstructionCounts unoptimized, optimized;
+    compile(kFS, &unoptimized, &optimized);
+
+    EXPECT_LE(optimized.loads, unoptimized.loads);
+    EXPECT_LE(optimized.stores, unoptimized.stores);
+    EXPECT_LE(optimized.wordCount, unoptimized.wordCount);
+}
+}  // anonymous namespace
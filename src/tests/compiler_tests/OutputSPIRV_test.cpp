@@ -0,0 +1,211 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OutputSPIRV_test.cpp:
+//   Test that the SPIR-V generated for shaders whose functions are generated in parallel is the
+//   same as when they are generated on a single thread.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "common/WorkerThread.h"
+#include "common/spirv/spirv_instruction_parser_autogen.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+namespace spirv = angle::spirv;
+
+namespace
+{
+// Enough functions for the shader to be large enough to be generated in parallel.
+constexpr int kFunctionCount = 24;
+
+class OutputSPIRVTest : public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        sh::InitBuiltInResources(&mResources);
+        mThreadPool = angle::WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
+    }
+
+    // Compile the shader without and with a thread pool, and expect the same output.  The shader
+    // is also compiled twice with the thread pool, as which thread generates which function
+    // changes between compilations.
+    void testParallelOutputMatchesSerial(GLenum shaderType, const std::string &shaderSource)
+    {
+        spirv::Blob serial, parallel, parallelAgain;
+        compile(shaderType, shaderSource, nullptr, &serial);
+        compile(shaderType, shaderSource, mThreadPool, &parallel);
+        compile(shaderType, shaderSource, mThreadPool, &parallelAgain);
+
+        EXPECT_GT(CountFunctions(serial), static_cast<size_t>(kFunctionCount));
+        EXPECT_EQ(serial, parallel);
+        EXPECT_EQ(parallel, parallelAgain);
+    }
+
+  private:
+    void compile(GLenum shaderType,
+                 const std::string &shaderSource,
+                 const std::shared_ptr<angle::WorkerThreadPool> &threadPool,
+                 spirv::Blob *blobOut)
+    {
+        ShHandle compiler = sh::ConstructCompiler(shaderType, SH_GLES3_1_SPEC,
+                                                  SH_SPIRV_VULKAN_OUTPUT, &mResources);
+        ASSERT_TRUE(compiler != nullptr);
+        sh::SetWorkerThreadPool(compiler, threadPool);
+
+        const char *shaderStrings[] = {shaderSource.c_str()};
+        ShCompileOptions options    = {};
+        options.objectCode          = true;
+
+        EXPECT_TRUE(sh::Compile(compiler, shaderStrings, 1, options)) << sh::GetInfoLog(compiler);
+        *blobOut = sh::GetObjectBinaryBlob(compiler);
+
+        sh::Destruct(compiler);
+    }
+
+    static size_t CountFunctions(const spirv::Blob &blob);
+
+    ShBuiltInResources mResources;
+    std::shared_ptr<angle::WorkerThreadPool> mThreadPool;
+};
+
+size_t OutputSPIRVTest::CountFunctions(const spirv::Blob &blob)
+{
+    size_t functions = 0;
+
+    size_t currentWord = spirv::kHeaderIndexInstructions;
+    while (currentWord < blob.size())
+    {
+        uint32_t wordCount;
+        spv::Op opCode;
+        spirv::GetInstructionOpAndLength(&blob[currentWord], &opCode, &wordCount);
+
+        currentWord += wordCount;
+
+        if (opCode == spv::OpFunction)
+        {
+            ++functions;
+        }
+    }
+
+    return functions;
+}
+
+// Test a fragment shader whose functions use built-ins that are only declared on first use,
+// built-ins that return structs, local structs, constants and global variables.
+TEST_F(OutputSPIRVTest, FragmentShaderFunctionsInParallel)
+{
+    std::stringstream shader;
+    shader << R"(#version 310 es
+precision highp float;
+precision highp int;
+layout(location = 0) out vec4 color;
+uniform highp sampler2D tex;
+layout(std140, binding = 0) uniform UBO { vec4 u[4]; mat4 m; };
+layout(std430, binding = 1) buffer SSBO { uint data[]; } ssbo;
+const float kScale[3] = float[3](0.5, 1.5, 2.5);
+float g;
+)";
+
+    for (int i = 0; i < kFunctionCount; ++i)
+    {
+        shader << "struct L" << i << " { vec2 p; float q[3]; };\n"
+               << "float f" << i << "(float x, inout int k, out vec2 o)\n"
+               << "{\n"
+               << "    L" << i << " l = L" << i << "(vec2(x, " << i << ".0), float[3](1.0, 2.0, "
+               << i << ".0));\n"
+               << "    vec4 v = vec4(gl_FragCoord.xy * " << i + 1 << ".0, x, 1.0);\n"
+               << "    vec3 e;\n"
+               << "    vec3 fr = modf(v.xyz, e);\n"
+               << "    uint hi, lo;\n"
+               << "    umulExtended(uint(k), " << i + 7 << "u, hi, lo);\n"
+               << R"(    for (int j = 0; j < 3; ++j)
+    {
+        switch ((j + k) % 3)
+        {
+            case 0: v.x += kScale[j % 3] * texture(tex, v.xy).r; break;
+            case 1: v.yzw = v.wzy * u[j % 4].xyz; break;
+            default: v = m * v; if (v.x > 1.0) { k += int(hi ^ lo); continue; }
+        }
+        v[k & 3] += l.q[j % 3];
+        v.wzyx[k & 3] += e.x;
+    }
+    o = v.x > 0.5 && gl_FrontFacing ? l.p + fr.xy : vec2(v.z);
+    ssbo.data[k & 7] = uint(k);
+    g += v.x;
+)";
+        if (i == 0)
+        {
+            shader << "    return v.y;\n";
+        }
+        else
+        {
+            shader << "    return v.x + f" << i - 1 << "(v.y, k, o);\n";
+        }
+        shader << "}\n";
+    }
+
+    shader << "void main()\n"
+           << "{\n"
+           << "    int k = 1;\n"
+           << "    vec2 o;\n"
+           << "    float r = f" << kFunctionCount - 1 << "(gl_FragCoord.x, k, o);\n"
+           << "    color = vec4(r, o, float(k) + g);\n"
+           << "}\n";
+
+    testParallelOutputMatchesSerial(GL_FRAGMENT_SHADER, shader.str());
+}
+
+// Test a compute shader whose functions use shared memory, barriers and compute built-ins.
+TEST_F(OutputSPIRVTest, ComputeShaderFunctionsInParallel)
+{
+    std::stringstream shader;
+    shader << R"(#version 310 es
+layout(local_size_x = 8) in;
+shared float sharedData[8];
+layout(std430, binding = 1) buffer SSBO { float data[]; } ssbo;
+)";
+
+    for (int i = 0; i < kFunctionCount; ++i)
+    {
+        shader << "float f" << i << "(float x)\n"
+               << "{\n"
+               << "    float a[4] = float[4](x, " << i << ".0, 2.0, 3.0);\n"
+               << R"(    sharedData[gl_LocalInvocationID.x] =
+        a[int(x) & 3] + float(gl_WorkGroupID.x);
+    barrier();
+    uint carry;
+    uint sum = uaddCarry(uint(x), 5u, carry);
+    for (int j = 0; j < 3; ++j)
+    {
+        a[j] += sharedData[(j + 1) % 8] * float(sum + carry);
+    }
+    a[3] = a[0] * a[1] + a[2] / (a[3] + 1.0) - float(gl_LocalInvocationIndex);
+    a[0] = max(a[3], min(a[1], a[2])) + sharedData[sum & 7u];
+    a[1] = a[int(sum) & 3] > 0.0 ? sqrt(a[1] * a[1] + a[2] * a[2]) : abs(a[3]);
+)";
+        if (i == 0)
+        {
+            shader << "    return a[0];\n";
+        }
+        else
+        {
+            shader << "    return f" << i - 1 << "(a[1] + a[2]);\n";
+        }
+        shader << "}\n";
+    }
+
+    shader << "void main()\n"
+           << "{\n"
+           << "    ssbo.data[gl_GlobalInvocationID.x] = f" << kFunctionCount - 1
+           << "(ssbo.data[0]);\n"
+           << "}\n";
+
+    testParallelOutputMatchesSerial(GL_COMPUTE_SHADER, shader.str());
+}
+}  // anonymous namespace
@@ -0,0 +1,221 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PropagateConstants_test.cpp:
+//   Tests for propagating constants through variables and pruning the resulting dead branches.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+namespace
+{
+
+class PropagateConstantsTest : public MatchOutputCodeTest
+{
+  public:
+    PropagateConstantsTest() : MatchOutputCodeTest(GL_FRAGMENT_SHADER, SH_ESSL_OUTPUT)
+    {
+        ShCompileOptions defaultCompileOptions   = {};
+        defaultCompileOptions.propagateConstants = true;
+        setDefaultCompileOptions(defaultCompileOptions);
+    }
+};
+
+// Test that a branch on a global that is never written is pruned.
+TEST_F(PropagateConstantsTest, BranchOnUnwrittenGlobal)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        out vec4 color;
+        bool useSlowPath = false;
+        void main()
+        {
+            if (useSlowPath)
+            {
+                color = vec4(0.25);
+            }
+            else
+            {
+                color = vec4(0.75);
+            }
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("0.25"));
+    ASSERT_TRUE(foundInCode("0.75"));
+    ASSERT_TRUE(notFoundInCode("useSlowPath"));
+}
+
+// Test that a branch on a global that is written to is not pruned.
+TEST_F(PropagateConstantsTest, BranchOnWrittenGlobal)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform bool u;
+        out vec4 color;
+        bool useSlowPath = false;
+        void setSlowPath(out bool slowPath)
+        {
+            slowPath = u;
+        }
+        void main()
+        {
+            setSlowPath(useSlowPath);
+            if (useSlowPath)
+            {
+                color = vec4(0.25);
+            }
+            else
+            {
+                color = vec4(0.75);
+            }
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("0.25"));
+    ASSERT_TRUE(foundInCode("0.75"));
+}
+
+// Test that constants are propagated through chains of locals.
+TEST_F(PropagateConstantsTest, ChainOfLocals)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        out vec4 color;
+        void main()
+        {
+            int mode = 2;
+            int modeCopy = mode + 1;
+            if (modeCopy == 3)
+            {
+                color = vec4(0.25);
+            }
+            else
+            {
+                color = vec4(0.75);
+            }
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("0.25"));
+    ASSERT_TRUE(notFoundInCode("0.75"));
+}
+
+// Test that a parameter that receives the same constant at every call site is propagated, and
+// that the function only called from the dead branch is pruned.
+TEST_F(PropagateConstantsTest, ConstantParameter)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform vec4 u;
+        out vec4 color;
+        vec4 expensive(vec4 v)
+        {
+            return sqrt(v) * 0.25;
+        }
+        vec4 shade(vec4 v, bool highQuality)
+        {
+            if (highQuality)
+            {
+                return expensive(v);
+            }
+            return v;
+        }
+        void main()
+        {
+            color = shade(u, false) + shade(u.wzyx, false);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("expensive"));
+    ASSERT_TRUE(notFoundInCode("sqrt"));
+}
+
+// Test that a parameter that receives different constants is not propagated.
+TEST_F(PropagateConstantsTest, DifferentConstantParameters)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform vec4 u;
+        out vec4 color;
+        vec4 shade(vec4 v, bool highQuality)
+        {
+            if (highQuality)
+            {
+                return sqrt(v);
+            }
+            return v;
+        }
+        void main()
+        {
+            color = shade(u, false) + shade(u.wzyx, true);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("sqrt"));
+}
+
+// Test that pruning a dead branch with the only write to a variable lets that variable be
+// propagated too.
+TEST_F(PropagateConstantsTest, WriteInDeadBranch)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        out vec4 color;
+        bool debugMode = false;
+        void main()
+        {
+            float scale = 0.5;
+            if (debugMode)
+            {
+                scale = 2.0;
+            }
+            while (scale > 1.0)
+            {
+                color = vec4(0.25);
+            }
+            color = vec4(scale);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("2.0"));
+    ASSERT_TRUE(notFoundInCode("0.25"));
+    ASSERT_TRUE(notFoundInCode("while"));
+}
+
+// Test that a do-while loop with a false condition is kept.
+TEST_F(PropagateConstantsTest, DoWhileFalseIsKept)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform float u;
+        out vec4 color;
+        void main()
+        {
+            bool repeat = false;
+            do
+            {
+                color = vec4(u);
+            } while (repeat);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("do"));
+    ASSERT_TRUE(foundInCode("while"));
+}
+
+}  // anonymous namespace
@@ -396,6 +396,93 @@ TEST_P(DrawElementsTest, DeletingAfterStreamingIndexes)
     ASSERT_GL_NO_ERROR();
 }
 
+// Test that client indices and attributes streamed by the same draws stay intact while the
+// streaming buffers are reused.  Every draw streams enough data for the streamed indices and
+// attributes to often land in different parts of the buffer, and the results are only read back
+// once all draws are issued.
+TEST_P(DrawElementsTest, StreamingIndicesAndAttributesWrap)
+{
+    constexpr char kVS[] =
+        "attribute vec2 position;\n"
+        "attribute vec4 color;\n"
+        "varying vec4 v_color;\n"
+        "void main() {\n"
+        "  gl_Position = vec4(position, 0, 1);\n"
+        "  v_color = color;\n"
+        "}";
+
+    constexpr char kFS[] =
+        "varying highp vec4 v_color;\n"
+        "void main() {\n"
+        "  gl_FragColor = v_color;\n"
+        "}";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    GLint positionLocation = glGetAttribLocation(mProgram, "position");
+    ASSERT_NE(-1, positionLocation);
+
+    GLint colorLocation = glGetAttribLocation(mProgram, "color");
+    ASSERT_NE(-1, colorLocation);
+
+    // Each draw covers its own column of the window with a quad of its own color.  The quad is
+    // followed by degenerate triangles that make the streamed data larger; the ones referencing
+    // the last vertex make all the vertices be streamed.
+    constexpr GLsizei kDrawCount   = 32;
+    constexpr GLuint kVertexCount  = 32768;
+    constexpr GLsizei kIndexCount  = 60000;
+    constexpr GLint kColumnWidth   = 2;
+    const GLint windowHeight       = getWindowHeight();
+    ASSERT_EQ(kDrawCount * kColumnWidth, getWindowWidth());
+
+    std::vector<GLuint> indices(kIndexCount, 0);
+    const GLuint quadIndices[] = {0, 1, 2, 2, 3, 0};
+    std::copy(std::begin(quadIndices), std::end(quadIndices), indices.begin());
+    std::fill(indices.end() - 3, indices.end(), kVertexCount - 1);
+
+    std::vector<std::vector<GLfloat>> positions(kDrawCount);
+    std::vector<std::vector<GLColor>> colors(kDrawCount);
+    for (GLsizei draw = 0; draw < kDrawCount; ++draw)
+    {
+        const GLfloat left  = -1.0f + 2.0f * draw / kDrawCount;
+        const GLfloat right = -1.0f + 2.0f * (draw + 1) / kDrawCount;
+
+        positions[draw].resize(kVertexCount * 2, 0.0f);
+        const GLfloat quad[] = {left, 1.0f, left, -1.0f, right, -1.0f, right, 1.0f};
+        std::copy(std::begin(quad), std::end(quad), positions[draw].begin());
+
+        const GLColor color(static_cast<GLubyte>(draw * 8), static_cast<GLubyte>(255 - draw * 8),
+                            static_cast<GLubyte>(draw % 2 * 255), 255);
+        colors[draw].resize(kVertexCount, color);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glEnableVertexAttribArray(positionLocation);
+    glEnableVertexAttribArray(colorLocation);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Enough data is streamed for any streaming buffer to be reused several times.
+    for (GLsizei draw = 0; draw < kDrawCount; ++draw)
+    {
+        glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0,
+                              positions[draw].data());
+        glVertexAttribPointer(colorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0,
+                              colors[draw].data());
+        glDrawElements(GL_TRIANGLES, kIndexCount, GL_UNSIGNED_INT, indices.data());
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (GLsizei draw = 0; draw < kDrawCount; ++draw)
+    {
+        EXPECT_PIXEL_COLOR_EQ(draw * kColumnWidth, windowHeight / 2, colors[draw][0]);
+    }
+}
+
 // Verify that detaching shaders after linking doesn't break draw calls
 TEST_P(DrawElementsTest, DrawWithDetachedShaders)
 {
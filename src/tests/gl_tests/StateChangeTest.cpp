@@ -16,6 +16,7 @@
 #include "test_utils/gl_raii.h"
 #include "util/random_utils.h"
 
+#include <sstream>
 #include <thread>
 
 using namespace angle;
@@ -11616,6 +11617,237 @@ TEST_P(StateChangeTest, ScissortChangeWithinRenderPass)
     EXPECT_PIXEL_COLOR_EQ(12, 12, GLColor::blue);
 }
 
+// Tests of programs that use consecutive texture units, samplers and buffer bindings, which the GL
+// backend binds together with the multi-bind entry points if the driver supports them.
+class BindingRangeStateChangeTest : public SimpleStateChangeTest
+{
+  protected:
+    static constexpr GLuint kUnitsPerProgram = 3;
+    static constexpr GLuint kUnitCount       = kUnitsPerProgram * 2;
+    static constexpr size_t kValueCount      = kUnitsPerProgram + 4;
+
+    using Values = std::array<std::array<GLfloat, 4>, kValueCount>;
+
+    // The program samples |kUnitsPerProgram| consecutive units starting at |firstUnit|, and reads
+    // two uniform and shader storage blocks starting at binding |firstBinding|.  It outputs green
+    // if all of them have the values given in the |expected| uniform, and red otherwise.
+    static std::string MakeFragmentShader(GLuint firstUnit, GLuint firstBinding)
+    {
+        std::stringstream shader;
+        shader << "#version 310 es\n"
+               << "precision highp float;\n";
+        for (GLuint i = 0; i < kUnitsPerProgram; ++i)
+        {
+            shader << "layout(binding = " << firstUnit + i << ") uniform highp sampler2D tex" << i
+                   << ";\n";
+        }
+        for (GLuint i = 0; i < 2; ++i)
+        {
+            shader << "layout(std140, binding = " << firstBinding + i << ") uniform U" << i
+                   << " { vec4 value; } u" << i << ";\n"
+                   << "layout(std430, binding = " << firstBinding + i << ") readonly buffer S" << i
+                   << " { vec4 value; } s" << i << ";\n";
+        }
+        shader << "uniform vec4 expected[" << kValueCount << "];\n"
+               << "out vec4 color;\n"
+               << "void main()\n"
+               << "{\n"
+               << "    vec4 values[" << kValueCount << "] = vec4[" << kValueCount << "](\n";
+        for (GLuint i = 0; i < kUnitsPerProgram; ++i)
+        {
+            shader << "        texture(tex" << i << ", vec2(0.5)),\n";
+        }
+        shader << R"(        u0.value, u1.value, s0.value, s1.value);
+    bool matches = true;
+    for (int i = 0; i < values.length(); ++i)
+    {
+        matches = matches && all(lessThan(abs(values[i] - expected[i]), vec4(0.01)));
+    }
+    color = matches ? vec4(0, 1, 0, 1) : vec4(1, 0, 0, 1);
+})";
+        return shader.str();
+    }
+
+    void drawAndExpectValues(GLuint program, const Values &expected)
+    {
+        glUseProgram(program);
+        GLint expectedLoc = glGetUniformLocation(program, "expected");
+        ASSERT_NE(-1, expectedLoc);
+        glUniform4fv(expectedLoc, static_cast<GLsizei>(kValueCount), expected[0].data());
+
+        drawQuad(program, essl31_shaders::PositionAttrib(), 0.5f);
+        ASSERT_GL_NO_ERROR();
+        EXPECT_PIXEL_COLOR_EQ(kWindowSize / 2, kWindowSize / 2, GLColor::green);
+    }
+
+    // Creates a buffer with one vec4 at each multiple of |alignment|.
+    void initBlockBuffer(GLBuffer *buffer,
+                         GLenum target,
+                         GLint alignment,
+                         const std::vector<std::array<GLfloat, 4>> &values)
+    {
+        std::vector<uint8_t> data(alignment * values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            memcpy(data.data() + alignment * i, values[i].data(), sizeof(values[i]));
+        }
+        glBindBuffer(target, *buffer);
+        glBufferData(target, data.size(), data.data(), GL_STATIC_DRAW);
+    }
+
+    uint64_t getMultiBindCallsSaved()
+    {
+        if (!IsGLExtensionEnabled("GL_AMD_performance_monitor"))
+        {
+            return 0;
+        }
+        CounterNameToValueMap counters = BuildCounterNameToValueMap();
+        auto iter                      = counters.find("multiBindCallsSaved");
+        return iter == counters.end() ? 0 : iter->second;
+    }
+};
+
+// Test switching between programs that use different ranges of texture units, samplers and uniform
+// and shader storage buffers, including units and samplers that are unbound while in use and
+// buffers bound whole or by range.
+TEST_P(BindingRangeStateChangeTest, SwitchProgramsWithConsecutiveBindings)
+{
+    GLint maxFragmentStorageBlocks = 0;
+    glGetIntegerv(GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS, &maxFragmentStorageBlocks);
+    ANGLE_SKIP_TEST_IF(maxFragmentStorageBlocks < 2);
+
+    // Program A uses units 0 to 2 and bindings 0 and 1, program B units 3 to 5 and bindings 2
+    // and 3.
+    ANGLE_GL_PROGRAM(programA, essl31_shaders::vs::Simple(), MakeFragmentShader(0, 0).c_str());
+    ANGLE_GL_PROGRAM(programB, essl31_shaders::vs::Simple(),
+                     MakeFragmentShader(kUnitsPerProgram, 2).c_str());
+
+    const uint64_t multiBindCallsSavedBefore = getMultiBindCallsSaved();
+
+    // The textures have no mips and a mipmapped minification filter, so they are only complete
+    // with a sampler that doesn't use mips.
+    const std::array<GLColor, kUnitCount> colors = {GLColor::red,    GLColor::green,
+                                                    GLColor::blue,   GLColor::yellow,
+                                                    GLColor::cyan,   GLColor::magenta};
+    std::array<GLTexture, kUnitCount> textures;
+    std::array<GLSampler, 2> samplers;
+    for (GLuint unit = 0; unit < kUnitCount; ++unit)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D, textures[unit]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &colors[unit]);
+    }
+    for (GLSampler &sampler : samplers)
+    {
+        glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+    for (GLuint unit = 0; unit < kUnitCount; ++unit)
+    {
+        glBindSampler(unit, samplers[0]);
+    }
+
+    // Two whole buffers for program A, and ranges of a larger buffer for program B.
+    GLint uniformAlignment = 0;
+    GLint storageAlignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+    uniformAlignment = std::max<GLint>(uniformAlignment, 16);
+    storageAlignment = std::max<GLint>(storageAlignment, 16);
+
+    const std::vector<std::array<GLfloat, 4>> wholeValues = {{0.1f, 0.2f, 0.3f, 0.4f},
+                                                             {0.5f, 0.6f, 0.7f, 0.8f}};
+    const std::vector<std::array<GLfloat, 4>> rangeValues = {{0.9f, 0.8f, 0.7f, 0.6f},
+                                                             {0.5f, 0.4f, 0.3f, 0.2f},
+                                                             {0.1f, 0.3f, 0.5f, 0.7f},
+                                                             {0.2f, 0.4f, 0.6f, 0.8f}};
+    std::array<GLBuffer, 2> wholeUniformBuffers;
+    std::array<GLBuffer, 2> wholeStorageBuffers;
+    GLBuffer uniformRangeBuffer;
+    GLBuffer storageRangeBuffer;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        initBlockBuffer(&wholeUniformBuffers[i], GL_UNIFORM_BUFFER, 16, {wholeValues[i]});
+        initBlockBuffer(&wholeStorageBuffers[i], GL_SHADER_STORAGE_BUFFER, 16,
+                        {wholeValues[1 - i]});
+    }
+    initBlockBuffer(&uniformRangeBuffer, GL_UNIFORM_BUFFER, uniformAlignment, rangeValues);
+    initBlockBuffer(&storageRangeBuffer, GL_SHADER_STORAGE_BUFFER, storageAlignment, rangeValues);
+
+    auto bindRanges = [&](GLuint uniformSlot, GLuint storageSlot) {
+        for (GLuint i = 0; i < 2; ++i)
+        {
+            glBindBufferRange(GL_UNIFORM_BUFFER, 2 + i, uniformRangeBuffer,
+                              uniformAlignment * ((uniformSlot + i) % rangeValues.size()), 16);
+            glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 2 + i, storageRangeBuffer,
+                              storageAlignment * ((storageSlot + i) % rangeValues.size()), 16);
+        }
+    };
+    for (GLuint i = 0; i < 2; ++i)
+    {
+        glBindBufferBase(GL_UNIFORM_BUFFER, i, wholeUniformBuffers[i]);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, i, wholeStorageBuffers[i]);
+    }
+    bindRanges(0, 1);
+    ASSERT_GL_NO_ERROR();
+
+    auto toValue = [](const GLColor &color) {
+        const Vector4 normalized = color.toNormalizedVector();
+        return std::array<GLfloat, 4>{normalized[0], normalized[1], normalized[2], normalized[3]};
+    };
+    const std::array<GLfloat, 4> kIncomplete = {0, 0, 0, 1};
+
+    const Values expectedA = {toValue(colors[0]), toValue(colors[1]), toValue(colors[2]),
+                              wholeValues[0],     wholeValues[1],     wholeValues[1],
+                              wholeValues[0]};
+    drawAndExpectValues(programA, expectedA);
+    drawAndExpectValues(programB, {toValue(colors[3]), toValue(colors[4]), toValue(colors[5]),
+                                   rangeValues[0], rangeValues[1], rangeValues[1],
+                                   rangeValues[2]});
+
+    // Change the bindings of program B.  Unit 3 now has the texture of unit 0 and unit 4 none.
+    // Unit 4 gets the other sampler, and unit 5 loses its sampler, so its texture is incomplete.
+    glActiveTexture(GL_TEXTURE3);
+    glBindTexture(GL_TEXTURE_2D, textures[0]);
+    glActiveTexture(GL_TEXTURE4);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindSampler(4, samplers[1]);
+    glBindSampler(5, 0);
+    bindRanges(2, 3);
+    ASSERT_GL_NO_ERROR();
+
+    // Program A's bindings were left alone.
+    drawAndExpectValues(programA, expectedA);
+    drawAndExpectValues(programB, {toValue(colors[0]), kIncomplete, kIncomplete, rangeValues[2],
+                                   rangeValues[3], rangeValues[3], rangeValues[0]});
+
+    // Restore the original bindings, and switch back and forth again.
+    glActiveTexture(GL_TEXTURE3);
+    glBindTexture(GL_TEXTURE_2D, textures[3]);
+    glActiveTexture(GL_TEXTURE4);
+    glBindTexture(GL_TEXTURE_2D, textures[4]);
+    glBindSampler(4, samplers[0]);
+    glBindSampler(5, samplers[0]);
+    bindRanges(0, 1);
+    drawAndExpectValues(programB, {toValue(colors[3]), toValue(colors[4]), toValue(colors[5]),
+                                   rangeValues[0], rangeValues[1], rangeValues[1],
+                                   rangeValues[2]});
+    drawAndExpectValues(programA, expectedA);
+
+    // The GL backend binds the consecutive units and bindings together when it can.
+    if (IsOpenGL() || IsOpenGLES())
+    {
+        if (getEGLWindow()->isFeatureEnabled(Feature::SupportsMultiBind))
+        {
+            EXPECT_GT(getMultiBindCallsSaved(), multiBindCallsSavedBefore);
+        }
+        else
+        {
+            EXPECT_EQ(getMultiBindCallsSaved(), multiBindCallsSavedBefore);
+        }
+    }
+}
+
 }  // anonymous namespace
 
 ANGLE_INSTANTIATE_TEST_ES2(StateChangeTest);
@@ -11674,6 +11906,10 @@ ANGLE_INSTANTIATE_TEST_ES3(ImageRespecificationTest);
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SimpleStateChangeTestES31);
 ANGLE_INSTANTIATE_TEST_ES31(SimpleStateChangeTestES31);
 
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BindingRangeStateChangeTest);
+ANGLE_INSTANTIATE_TEST_ES31_AND(BindingRangeStateChangeTest,
+                                ES31_OPENGL().disable(Feature::SupportsMultiBind));
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SimpleStateChangeTestComputeES31);
 ANGLE_INSTANTIATE_TEST_ES31(SimpleStateChangeTestComputeES31);
 
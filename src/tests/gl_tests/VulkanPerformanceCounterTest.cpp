@@ -869,6 +869,35 @@ TEST_P(VulkanPerformanceCounterTest, SubmittingOutsideCommandBufferTriggersEndRe
     EXPECT_PIXEL_COLOR_EQ(width / 2 + 1, 0, GLColor::green);
 }
 
+// Tests that a large upload that needs conversion is staged in bands, and that the staging memory
+// in use stays bounded while the bands are uploaded, instead of growing with the upload.
+TEST_P(VulkanPerformanceCounterTest, LargeConvertedTextureUploadStagedInBands)
+{
+    // 4096x4096 RGB8 takes 48MB of staging, or 64MB where it is emulated with RGBA8.  Staged in
+    // bands, at most two bands are in use at any time.
+    constexpr GLsizei kSize          = 4096;
+    constexpr uint64_t kMaxBandBytes = 8 * 1024 * 1024;
+    std::vector<GLColorRGB> pixels(kSize * kSize, GLColorRGB::green);
+
+    GLTexture tex;
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGB8, kSize, kSize);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize, kSize, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+    EXPECT_GL_NO_ERROR();
+
+    // The first band alone is at least half a band, as bands are only shortened to whole rows.
+    const uint64_t peakStagingBytes = getPerfCounters().imageUploadPeakStagingBytes;
+    EXPECT_GE(peakStagingBytes, kMaxBandBytes / 2);
+    EXPECT_LE(peakStagingBytes, 2 * kMaxBandBytes);
+
+    GLFramebuffer fbo;
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor::green);
+}
+
 // Tests that a color 2D image is cleared via vkCmdClearColorImage.
 TEST_P(VulkanPerformanceCounterTest, ClearTextureEXTFullColorImageClear2D)
 {
@@ -56,6 +56,7 @@ bool gRunToKeyFrame                = false;
 int gFixedTestTime                 = 0;
 int gFixedTestTimeWithWarmup       = 0;
 const char *gTraceInterpreter      = nullptr;
+const char *gEntryPointProfileJson = nullptr;
 const char *gPrintExtensionsToFile = nullptr;
 const char *gRequestedExtensions   = nullptr;
 bool gIncludeInactiveResources     = false;
@@ -95,6 +96,8 @@ bool TraceTestArg(int *argc, char **argv, int argIndex)
            ParseFlag("--vsync", argc, argv, argIndex, &gVsync) ||
            ParseFlag("--minimize-gpu-work", argc, argv, argIndex, &gMinimizeGPUWork) ||
            ParseCStringArg("--trace-interpreter", argc, argv, argIndex, &gTraceInterpreter) ||
+           ParseCStringArg("--entry-point-profile-json", argc, argv, argIndex,
+                           &gEntryPointProfileJson) ||
            ParseIntArg("--screenshot-frame", argc, argv, argIndex, &gScreenshotFrame) ||
            ParseIntArg("--fps-limit", argc, argv, argIndex, &gFpsLimit) ||
            ParseCStringArgWithHandling("--render-test-output-dir", argc, argv, argIndex,
@@ -34,6 +34,7 @@ extern bool gRetraceMode;
 extern bool gMinimizeGPUWork;
 extern bool gTraceTestValidation;
 extern const char *gTraceInterpreter;
+extern const char *gEntryPointProfileJson;
 extern const char *gPerfCounters;
 extern const char *gUseANGLE;
 extern const char *gUseGL;
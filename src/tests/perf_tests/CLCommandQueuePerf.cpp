@@ -0,0 +1,225 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CLCommandQueuePerf:
+//   Performance test for the throughput of independent kernels on in-order and out-of-order CL
+//   command queues.  Each kernel writes its own part of a shared buffer, so in-order queues need a
+//   barrier between the kernels while out-of-order queues don't.
+//
+
+#include "ANGLEComputeTestCL.h"
+
+#include <angle_cl.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kKernelsPerStep = 32;
+// Enough work for each kernel for the barriers to stall the GPU.
+constexpr size_t kElementsPerKernel = 64 * 1024;
+
+constexpr char kSource[] = R"(
+__kernel void work(__global float *output, uint offset)
+{
+    uint gid = get_global_id(0);
+    float value = (float)gid;
+    for (int i = 0; i < 64; ++i)
+    {
+        value = value * 0.99f + 1.0f;
+    }
+    output[offset + gid] = value;
+})";
+
+struct CLCommandQueueParams final : public RenderTestParams
+{
+    CLCommandQueueParams()
+    {
+        eglParameters     = egl_platform::VULKAN();
+        iterationsPerStep = kKernelsPerStep;
+    }
+
+    std::string story() const override;
+
+    bool outOfOrder = false;
+};
+
+std::ostream &operator<<(std::ostream &os, const CLCommandQueueParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string CLCommandQueueParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+    strstr << (outOfOrder ? "_out_of_order" : "_in_order");
+
+    return strstr.str();
+}
+
+class CLCommandQueueBenchmark : public ANGLEComputeTestCL,
+                                public ::testing::WithParamInterface<CLCommandQueueParams>
+{
+  public:
+    CLCommandQueueBenchmark();
+    ~CLCommandQueueBenchmark() override;
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    cl_context mContext     = nullptr;
+    cl_command_queue mQueue = nullptr;
+    cl_program mProgram     = nullptr;
+    cl_kernel mKernel       = nullptr;
+    cl_mem mOutput          = nullptr;
+};
+
+CLCommandQueueBenchmark::CLCommandQueueBenchmark()
+    : ANGLEComputeTestCL("CLCommandQueue", GetParam())
+{}
+
+CLCommandQueueBenchmark::~CLCommandQueueBenchmark()
+{
+    destroyBenchmark();
+}
+
+void CLCommandQueueBenchmark::initializeBenchmark()
+{
+    cl_uint platformCount = 0;
+    clGetPlatformIDs(0, nullptr, &platformCount);
+    std::vector<cl_platform_id> platforms(platformCount);
+    if (platformCount > 0)
+    {
+        clGetPlatformIDs(platformCount, platforms.data(), nullptr);
+    }
+
+    // The Vulkan platform is the one ANGLE implements itself, the others pass through.
+    cl_device_id device = nullptr;
+    for (cl_platform_id platform : platforms)
+    {
+        char version[256] = {};
+        clGetPlatformInfo(platform, CL_PLATFORM_VERSION, sizeof(version), version, nullptr);
+        if (std::string(version).find("ANGLE") != std::string::npos &&
+            clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr) == CL_SUCCESS)
+        {
+            break;
+        }
+        device = nullptr;
+    }
+    if (device == nullptr)
+    {
+        skipTest("No ANGLE Vulkan CL device");
+        return;
+    }
+
+    cl_command_queue_properties queueProperties = 0;
+    if (GetParam().outOfOrder)
+    {
+        cl_command_queue_properties supportedProperties = 0;
+        clGetDeviceInfo(device, CL_DEVICE_QUEUE_ON_HOST_PROPERTIES, sizeof(supportedProperties),
+                        &supportedProperties, nullptr);
+        if ((supportedProperties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) == 0)
+        {
+            skipTest("Out-of-order queues are not supported");
+            return;
+        }
+        queueProperties = CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE;
+    }
+
+    cl_int error = CL_SUCCESS;
+    mContext     = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &error);
+    ASSERT_EQ(CL_SUCCESS, error);
+
+    const cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, queueProperties, 0};
+    mQueue = clCreateCommandQueueWithProperties(mContext, device, properties, &error);
+    ASSERT_EQ(CL_SUCCESS, error);
+
+    const char *source = kSource;
+    mProgram           = clCreateProgramWithSource(mContext, 1, &source, nullptr, &error);
+    ASSERT_EQ(CL_SUCCESS, error);
+    ASSERT_EQ(CL_SUCCESS, clBuildProgram(mProgram, 1, &device, nullptr, nullptr, nullptr));
+    mKernel = clCreateKernel(mProgram, "work", &error);
+    ASSERT_EQ(CL_SUCCESS, error);
+
+    mOutput = clCreateBuffer(mContext, CL_MEM_READ_WRITE,
+                             sizeof(cl_float) * kElementsPerKernel * kKernelsPerStep, nullptr,
+                             &error);
+    ASSERT_EQ(CL_SUCCESS, error);
+    ASSERT_EQ(CL_SUCCESS, clSetKernelArg(mKernel, 0, sizeof(cl_mem), &mOutput));
+}
+
+void CLCommandQueueBenchmark::destroyBenchmark()
+{
+    if (mOutput != nullptr)
+    {
+        clReleaseMemObject(mOutput);
+        mOutput = nullptr;
+    }
+    if (mKernel != nullptr)
+    {
+        clReleaseKernel(mKernel);
+        mKernel = nullptr;
+    }
+    if (mProgram != nullptr)
+    {
+        clReleaseProgram(mProgram);
+        mProgram = nullptr;
+    }
+    if (mQueue != nullptr)
+    {
+        clReleaseCommandQueue(mQueue);
+        mQueue = nullptr;
+    }
+    if (mContext != nullptr)
+    {
+        clReleaseContext(mContext);
+        mContext = nullptr;
+    }
+}
+
+void CLCommandQueueBenchmark::drawBenchmark()
+{
+    // None of the kernels wait on each other.
+    for (unsigned int kernel = 0; kernel < kKernelsPerStep; ++kernel)
+    {
+        cl_uint offset        = static_cast<cl_uint>(kernel * kElementsPerKernel);
+        size_t globalWorkSize = kElementsPerKernel;
+        clSetKernelArg(mKernel, 1, sizeof(cl_uint), &offset);
+        clEnqueueNDRangeKernel(mQueue, mKernel, 1, nullptr, &globalWorkSize, nullptr, 0, nullptr,
+                               nullptr);
+    }
+
+    clFinish(mQueue);
+}
+
+CLCommandQueueParams CLCommandQueueVulkanParams(bool outOfOrder)
+{
+    CLCommandQueueParams params;
+    params.outOfOrder = outOfOrder;
+    return params;
+}
+
+}  // anonymous namespace
+
+// Measures the time per kernel of independent kernels writing to the same buffer.
+TEST_P(CLCommandQueueBenchmark, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CLCommandQueueBenchmark,
+                         ::testing::Values(CLCommandQueueVulkanParams(false),
+                                           CLCommandQueueVulkanParams(true)),
+                         ::testing::PrintToStringParamName());
@@ -0,0 +1,207 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CoherentBufferTrackingPerf:
+//   Performance test for the ways frame capture finds the app's writes to persistently mapped
+//   coherent buffers: write protecting the pages and catching the first write to each, or reading
+//   the soft-dirty bits of the pages.  The app writes some pages of the buffer and of its other
+//   memory before each draw.
+//
+//   The tracking only runs while a frame is captured, so the test has to run with capture, e.g.:
+//   ANGLE_CAPTURE_FRAME_START=1 ANGLE_CAPTURE_FRAME_END=100000 ANGLE_CAPTURE_OUT_DIR=/tmp \
+//   ./out/Release/angle_perftests --gtest_filter="CoherentBufferTrackingBenchmark.*"
+//   with libGLESv2 built with angle_with_capture_by_default=true.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <vector>
+
+#include "common/system_utils.h"
+#include "test_utils/draw_call_perf_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 20;
+constexpr size_t kBufferPages             = 256;
+// The rest of the app's memory, of which it writes some pages between draws.  Clearing the
+// soft-dirty bits makes the next write to each page of the process fault.
+constexpr size_t kAppMemorySize   = 64 * 1024 * 1024;
+constexpr size_t kWrittenAppPages = 16;
+
+enum class TrackingMode
+{
+    PageFault,
+    SoftDirty,
+};
+
+struct CoherentBufferTrackingParams final : public RenderTestParams
+{
+    CoherentBufferTrackingParams()
+    {
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 256;
+        windowHeight      = 256;
+        iterationsPerStep = kIterationsPerStep;
+    }
+
+    std::string story() const override;
+
+    TrackingMode trackingMode = TrackingMode::SoftDirty;
+    // Pages of the coherent buffer the app writes before each draw
+    size_t writtenBufferPages = 4;
+};
+
+std::ostream &operator<<(std::ostream &os, const CoherentBufferTrackingParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string CoherentBufferTrackingParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+    strstr << (trackingMode == TrackingMode::PageFault ? "_page_fault" : "_soft_dirty");
+    strstr << "_" << writtenBufferPages << "_pages";
+
+    return strstr.str();
+}
+
+class CoherentBufferTrackingBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<CoherentBufferTrackingParams>
+{
+  public:
+    CoherentBufferTrackingBenchmark();
+    ~CoherentBufferTrackingBenchmark() override;
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram      = 0;
+    GLuint mBuffer       = 0;
+    uint8_t *mBufferData = nullptr;
+    size_t mPageSize;
+    std::vector<uint8_t> mAppMemory;
+    size_t mNextBufferPage = 0;
+    size_t mNextAppPage    = 0;
+};
+
+CoherentBufferTrackingBenchmark::CoherentBufferTrackingBenchmark()
+    : ANGLERenderTest("CoherentBufferTracking", GetParam()),
+      mPageSize(GetPageSize()),
+      mAppMemory(kAppMemorySize, 1)
+{
+    addExtensionPrerequisite("GL_EXT_buffer_storage");
+
+    // Read when the context's capture is set up
+    SetEnvironmentVar("ANGLE_CAPTURE_SOFT_DIRTY",
+                      GetParam().trackingMode == TrackingMode::PageFault ? "0" : "1");
+}
+
+CoherentBufferTrackingBenchmark::~CoherentBufferTrackingBenchmark()
+{
+    UnsetEnvironmentVar("ANGLE_CAPTURE_SOFT_DIRTY");
+}
+
+void CoherentBufferTrackingBenchmark::initializeBenchmark()
+{
+    mProgram = SetupSimpleScaleAndOffsetProgram();
+    ASSERT_NE(0u, mProgram);
+
+    const GLsizeiptr bufferSize = static_cast<GLsizeiptr>(kBufferPages * mPageSize);
+    const GLbitfield flags =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+
+    glGenBuffers(1, &mBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferStorageEXT(GL_ARRAY_BUFFER, bufferSize, nullptr, flags);
+    mBufferData = static_cast<uint8_t *>(glMapBufferRange(GL_ARRAY_BUFFER, 0, bufferSize, flags));
+    ASSERT_NE(nullptr, mBufferData);
+
+    // The draws read a triangle from the start of the buffer
+    const GLfloat kTriangle[] = {0.0f, 0.5f, -0.5f, -0.5f, 0.5f, -0.5f};
+    memset(mBufferData, 0, bufferSize);
+    memcpy(mBufferData, kTriangle, sizeof(kTriangle));
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void CoherentBufferTrackingBenchmark::destroyBenchmark()
+{
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteProgram(mProgram);
+}
+
+void CoherentBufferTrackingBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+    {
+        for (size_t write = 0; write < kWrittenAppPages; write++)
+        {
+            mAppMemory[mNextAppPage * mPageSize]++;
+            mNextAppPage = (mNextAppPage + 1) % (kAppMemorySize / mPageSize);
+        }
+
+        // The last byte of each page is written, which leaves the triangle alone.
+        for (size_t write = 0; write < params.writtenBufferPages; write++)
+        {
+            mBufferData[(mNextBufferPage + 1) * mPageSize - 1]++;
+            mNextBufferPage = (mNextBufferPage + 1) % kBufferPages;
+        }
+
+        // Capture finds the written pages of the buffer before each draw.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+CoherentBufferTrackingParams CoherentBufferTrackingVulkanParams(TrackingMode trackingMode,
+                                                                size_t writtenBufferPages)
+{
+    CoherentBufferTrackingParams params;
+    params.eglParameters      = egl_platform::VULKAN();
+    params.trackingMode       = trackingMode;
+    params.writtenBufferPages = writtenBufferPages;
+    return params;
+}
+
+// Measures the cost per draw of finding the app's writes to a coherent buffer during capture.
+TEST_P(CoherentBufferTrackingBenchmark, Run)
+{
+    run();
+}
+
+// Writing 64 pages per draw makes soft-dirty tracking clear the bits at each draw.
+ANGLE_INSTANTIATE_TEST(CoherentBufferTrackingBenchmark,
+                       CoherentBufferTrackingVulkanParams(TrackingMode::PageFault, 4),
+                       CoherentBufferTrackingVulkanParams(TrackingMode::SoftDirty, 4),
+                       CoherentBufferTrackingVulkanParams(TrackingMode::PageFault, 64),
+                       CoherentBufferTrackingVulkanParams(TrackingMode::SoftDirty, 64));
+}  // anonymous namespace
@@ -162,6 +162,83 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// An uber-shader that selects features through globals and parameters that are constant in
+// practice.  Most of it can be pruned by constant propagation.
+const char *kUberShaderESSL300FragSource = R"(#version 300 es
+precision highp float;
+
+uniform sampler2D uAlbedo;
+uniform sampler2D uNormal;
+uniform vec3 uLightDir;
+uniform vec4 uFogColor;
+
+in vec2 vTexCoord;
+in vec3 vNormal;
+in float vDepth;
+
+out vec4 my_FragColor;
+
+bool kUseNormalMap = false;
+bool kUseFog       = true;
+int kShadowQuality = 0;
+
+vec3 perturbNormal(vec3 n, vec2 uv)
+{
+    vec3 t = texture(uNormal, uv).xyz * 2.0 - 1.0;
+    return normalize(n + t);
+}
+
+float pcf(vec2 uv, int taps)
+{
+    float sum = 0.0;
+    for (int i = 0; i < 16; ++i)
+    {
+        if (i >= taps)
+        {
+            break;
+        }
+        sum += texture(uAlbedo, uv + vec2(float(i)) * 0.001).a;
+    }
+    return sum / float(taps);
+}
+
+float shadow(vec2 uv, int quality)
+{
+    if (quality == 0)
+    {
+        return 1.0;
+    }
+    else if (quality == 1)
+    {
+        return pcf(uv, 4);
+    }
+    return pcf(uv, 16);
+}
+
+vec3 applyFog(vec3 color, float depth, bool enabled)
+{
+    if (!enabled)
+    {
+        return color;
+    }
+    return mix(color, uFogColor.rgb, clamp(depth * uFogColor.a, 0.0, 1.0));
+}
+
+void main()
+{
+    vec3 n = normalize(vNormal);
+    if (kUseNormalMap)
+    {
+        n = perturbNormal(n, vTexCoord);
+    }
+    vec4 albedo = texture(uAlbedo, vTexCoord);
+    float lit   = max(dot(n, uLightDir), 0.0) * shadow(vTexCoord, kShadowQuality);
+    vec3 color  = applyFog(albedo.rgb * lit, vDepth, kUseFog);
+    my_FragColor = vec4(color, albedo.a);
+})";
+
+const char *kUberShaderESSL300Id = "UberShaderESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
 
 struct CompilerParameters
@@ -180,6 +257,8 @@ struct CompilerParameters
                 return "GLSL_4_50";
             case SH_ESSL_OUTPUT:
                 return "ESSL";
+            case SH_SPIRV_VULKAN_OUTPUT:
+                return "SPIRV";
             default:
                 UNREACHABLE();
                 return "unk";
@@ -195,6 +274,7 @@ bool IsPlatformAvailable(const CompilerParameters &param)
     {
         case SH_HLSL_4_1_OUTPUT:
         case SH_HLSL_3_0_OUTPUT:
+        case SH_SPIRV_VULKAN_OUTPUT:
         {
             angle::PoolAllocator allocator;
             InitializePoolIndex();
@@ -220,15 +300,30 @@ struct CompilerPerfParameters final : public CompilerParameters
 {
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
-                           const char *shaderSourceId)
-        : CompilerParameters(output), shaderSource(shaderSource)
+                           const char *shaderSourceId,
+                           bool propagateConstants = false,
+                           bool optimizeSPIRV      = false)
+        : CompilerParameters(output),
+          shaderSource(shaderSource),
+          propagateConstants(propagateConstants),
+          optimizeSPIRV(optimizeSPIRV)
     {
         testId = shaderSourceId;
         testId += "_";
         testId += CompilerParameters::str();
+        if (propagateConstants)
+        {
+            testId += "_PropagateConstants";
+        }
+        if (optimizeSPIRV)
+        {
+            testId += "_OptimizeSPIRV";
+        }
     }
 
     const char *shaderSource;
+    bool propagateConstants;
+    bool optimizeSPIRV;
     std::string testId;
 };
 
@@ -282,10 +377,20 @@ void CompilerPerfTest::SetUp()
     }
 
     setTestShader(params.shaderSource);
+
+    mReporter->RegisterImportantMetric(".object_code_size", "sizeInBytes");
 }
 
 void CompilerPerfTest::TearDown()
 {
+    // Report the size of the translated shader, to track the effect of the optimizing passes.
+    if (mTranslator)
+    {
+        recordIntegerMetric(".object_code_size",
+                            static_cast<size_t>(mTranslator->getInfoSink().obj.size()),
+                            "sizeInBytes");
+    }
+
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -304,6 +409,8 @@ void CompilerPerfTest::step()
     compileOptions.objectCode                    = true;
     compileOptions.initializeUninitializedLocals = true;
     compileOptions.initOutputVariables           = true;
+    compileOptions.propagateConstants            = GetParam().propagateConstants;
+    compileOptions.optimizeSPIRV                 = GetParam().optimizeSPIRV;
 
 #if !defined(NDEBUG)
     // Make sure that compilation succeeds and print the info log if it doesn't in debug mode.
@@ -340,6 +447,31 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kUberShaderESSL300FragSource, kUberShaderESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           kUberShaderESSL300FragSource,
+                           kUberShaderESSL300Id,
+                           true),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kUberShaderESSL300FragSource,
+                           kUberShaderESSL300Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kUberShaderESSL300FragSource,
+                           kUberShaderESSL300Id,
+                           true),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id,
+                           false,
+                           true),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kUberShaderESSL300FragSource,
+                           kUberShaderESSL300Id,
+                           true,
+                           true));
 
 }  // anonymous namespace
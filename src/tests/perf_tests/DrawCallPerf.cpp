@@ -162,6 +162,8 @@ DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf",
     {
         skipTest("https://issuetracker.google.com/issues/298407224 Fails on Pixel 6 GLES");
     }
+
+    mReporter->RegisterFyiMetric(".driver_calls_per_draw", "count");
 }
 
 void DrawCallPerfBenchmark::initializeBenchmark()
@@ -341,6 +343,20 @@ void main()
 
 void DrawCallPerfBenchmark::destroyBenchmark()
 {
+    // The NULL driver of the GL back-end counts the calls made to it in the last frame.
+    if (IsGLExtensionEnabled("GL_AMD_performance_monitor"))
+    {
+        CounterNameToValueMap counters = BuildCounterNameToValueMap();
+        auto nullDriverCalls           = counters.find("nullDriverCalls");
+        if (nullDriverCalls != counters.end() && nullDriverCalls->second > 0)
+        {
+            recordDoubleMetric(".driver_calls_per_draw",
+                               static_cast<double>(nullDriverCalls->second) /
+                                   static_cast<double>(GetParam().iterationsPerStep),
+                               "count");
+        }
+    }
+
     glDeleteProgram(mProgram1);
     glDeleteProgram(mProgram2);
     glDeleteProgram(mProgram3);
@@ -0,0 +1,189 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EtcDecompressorPerf: Performance test for the ETC/EAC decoders and transcoders.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <gmock/gmock.h>
+
+#include "common/WorkerThread.h"
+#include "image_util/loadimage.h"
+
+using namespace testing;
+
+namespace
+{
+using angle::WorkerThreadPool;
+
+using LoadFunction = void (*)(const angle::ImageLoadContext &context,
+                              size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+
+struct EtcFormat
+{
+    const char *name;
+    LoadFunction loadFunction;
+    // Bytes per 4x4 block of the input.
+    size_t inputBlockBytes;
+    // If the output is compressed, bytes per 4x4 block, otherwise bytes per pixel.
+    size_t outputBytes;
+    bool isOutputCompressed;
+};
+
+constexpr EtcFormat kETC2RGB8ToRGBA8  = {"ETC2RGB8ToRGBA8", angle::LoadETC2RGB8ToRGBA8, 8, 4,
+                                         false};
+constexpr EtcFormat kETC2RGBA8ToRGBA8 = {"ETC2RGBA8ToRGBA8", angle::LoadETC2RGBA8ToRGBA8, 16, 4,
+                                         false};
+constexpr EtcFormat kETC2RGB8ToBC1    = {"ETC2RGB8ToBC1", angle::LoadETC2RGB8ToBC1, 8, 8, true};
+constexpr EtcFormat kETC2RGBA8ToBC3   = {"ETC2RGBA8ToBC3", angle::LoadETC2RGBA8ToBC3, 16, 16, true};
+constexpr EtcFormat kEACR11ToR16      = {"EACR11ToR16", angle::LoadEACR11ToR16, 8, 2, false};
+constexpr EtcFormat kEACRG11ToBC5     = {"EACRG11ToBC5", angle::LoadEACRG11ToBC5, 16, 16, true};
+
+struct EtcDecompressorParams
+{
+    EtcDecompressorParams(const EtcFormat &format, uint32_t size, uint32_t threadCount)
+        : format(format), size(size), threadCount(threadCount)
+    {}
+
+    EtcFormat format;
+    uint32_t size;
+    // 1 decodes on the calling thread only.  0 lets the pool choose the number of threads.
+    uint32_t threadCount;
+};
+
+std::ostream &operator<<(std::ostream &os, const EtcDecompressorParams &params)
+{
+    os << params.format.name << "_" << params.size << "x" << params.size << "_";
+    if (params.threadCount == 0)
+    {
+        os << "max_threads";
+    }
+    else
+    {
+        os << params.threadCount << "_threads";
+    }
+    return os;
+}
+
+std::vector<EtcDecompressorParams> GetEtcDecompressorParams()
+{
+    constexpr EtcFormat kFormats[] = {kETC2RGB8ToRGBA8, kETC2RGB8ToBC1, kETC2RGBA8ToRGBA8,
+                                      kETC2RGBA8ToBC3,  kEACR11ToR16,   kEACRG11ToBC5};
+    constexpr uint32_t kThreadCounts[] = {1, 2, 4, 0};
+
+    std::vector<EtcDecompressorParams> params;
+    for (const EtcFormat &format : kFormats)
+    {
+        for (uint32_t threadCount : kThreadCounts)
+        {
+            params.emplace_back(format, 1024, threadCount);
+        }
+    }
+    return params;
+}
+
+class EtcDecompressorPerfTest : public ANGLEPerfTest,
+                                public WithParamInterface<EtcDecompressorParams>
+{
+  public:
+    EtcDecompressorPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+    std::string getName();
+
+  private:
+    angle::ImageLoadContext mContext;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+    size_t mInputRowPitch;
+    size_t mOutputRowPitch;
+};
+
+EtcDecompressorPerfTest::EtcDecompressorPerfTest()
+    : ANGLEPerfTest(getName(), "", "_run", 1, "us")
+{
+    const EtcDecompressorParams &params = GetParam();
+    const size_t blocksPerRow           = (params.size + 3) / 4;
+
+    mInputRowPitch  = blocksPerRow * params.format.inputBlockBytes;
+    mOutputRowPitch = params.format.isOutputCompressed ? blocksPerRow * params.format.outputBytes
+                                                       : params.size * params.format.outputBytes;
+    const size_t outputRows = params.format.isOutputCompressed ? blocksPerRow : params.size;
+
+    // Random blocks exercise all the ETC2 modes.
+    mInput.resize(mInputRowPitch * blocksPerRow);
+    uint32_t seed = 1;
+    for (uint8_t &value : mInput)
+    {
+        seed  = seed * 1664525u + 1013904223u;
+        value = static_cast<uint8_t>(seed >> 24);
+    }
+    mOutput.resize(mOutputRowPitch * outputRows);
+
+    if (params.threadCount != 1)
+    {
+        mContext.multiThreadPool =
+            WorkerThreadPool::Create(params.threadCount, ANGLEPlatformCurrent());
+    }
+}
+
+void EtcDecompressorPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+    mReporter->RegisterImportantMetric(".megabytes_per_second", "unitless");
+}
+
+void EtcDecompressorPerfTest::TearDown()
+{
+    // Report the throughput of the last trial in terms of decoded pixels, which is comparable
+    // between formats with the same number of channels.
+    const double seconds = mTrialTimer.getElapsedWallClockTime();
+    if (seconds > 0 && mTrialNumStepsPerformed > 0)
+    {
+        const double pixelBytes =
+            static_cast<double>(GetParam().size) * GetParam().size * 4 * mTrialNumStepsPerformed;
+        recordDoubleMetric(".megabytes_per_second", pixelBytes / seconds / 1e6, "unitless");
+    }
+    ANGLEPerfTest::TearDown();
+}
+
+void EtcDecompressorPerfTest::step()
+{
+    const uint32_t size = GetParam().size;
+    GetParam().format.loadFunction(mContext, size, size, 1, mInput.data(), mInputRowPitch,
+                                   mInput.size(), mOutput.data(), mOutputRowPitch, mOutput.size());
+}
+
+std::string EtcDecompressorPerfTest::getName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+// Measures the speed of ETC and EAC decoding and transcoding on the CPU.
+TEST_P(EtcDecompressorPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         EtcDecompressorPerfTest,
+                         ValuesIn(GetEtcDecompressorParams()),
+                         PrintToStringParamName());
+
+}  // anonymous namespace
@@ -33,8 +33,11 @@ struct GenerateMipmapParams final : public RenderTestParams
         textureHeight = 1080;
 
         internalFormat = GL_RGBA;
+        format         = GL_RGBA;
+        type           = GL_UNSIGNED_BYTE;
 
         webgl = false;
+        cpu   = false;
     }
 
     std::string story() const override;
@@ -43,8 +46,12 @@ struct GenerateMipmapParams final : public RenderTestParams
     GLsizei textureHeight;
 
     GLenum internalFormat;
+    GLenum format;
+    GLenum type;
 
     bool webgl;
+    // Whether the Vulkan backend is forced to generate the mipmaps on the CPU.
+    bool cpu;
 };
 
 std::ostream &operator<<(std::ostream &os, const GenerateMipmapParams &params)
@@ -67,6 +74,19 @@ std::string GenerateMipmapParams::story() const
     {
         strstr << "_rgb";
     }
+    else if (internalFormat == GL_RGBA16F)
+    {
+        strstr << "_rgba16f";
+    }
+    else if (internalFormat == GL_RGBA32F)
+    {
+        strstr << "_rgba32f";
+    }
+
+    if (cpu)
+    {
+        strstr << "_cpu_" << textureWidth << "x" << textureHeight;
+    }
 
     return strstr.str();
 }
@@ -80,6 +100,28 @@ void FillWithRandomData(T *storage)
     }
 }
 
+// Random bits make a lot of NaNs and infinities, so floats are filled with values in [0, 1].
+template <typename T>
+void FillWithRandomData(T *storage, GLenum type)
+{
+    if (type != GL_FLOAT)
+    {
+        FillWithRandomData(storage);
+        return;
+    }
+
+    float *values = reinterpret_cast<float *>(storage->data());
+    for (size_t index = 0; index < storage->size() / sizeof(float); ++index)
+    {
+        values[index] = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+    }
+}
+
+size_t GetPixelBytes(const GenerateMipmapParams &params)
+{
+    return params.type == GL_FLOAT ? 4 * sizeof(float) : 4;
+}
+
 class GenerateMipmapBenchmarkBase : public ANGLERenderTest,
                                     public ::testing::WithParamInterface<GenerateMipmapParams>
 {
@@ -124,6 +166,16 @@ GenerateMipmapBenchmarkBase::GenerateMipmapBenchmarkBase(const char *benchmarkNa
     setWebGLCompatibilityEnabled(GetParam().webgl);
     setRobustResourceInit(GetParam().webgl);
 
+    // Float formats must be renderable and filterable for mipmaps to be generated.
+    if (GetParam().internalFormat == GL_RGBA16F || GetParam().internalFormat == GL_RGBA32F)
+    {
+        addExtensionPrerequisite("GL_EXT_color_buffer_float");
+    }
+    if (GetParam().internalFormat == GL_RGBA32F)
+    {
+        addExtensionPrerequisite("GL_OES_texture_float_linear");
+    }
+
     if (GetParam().getRenderer() == EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE)
     {
         skipTest("http://crbug.com/945415 Crashes on nvidia+d3d11");
@@ -154,11 +206,11 @@ void GenerateMipmapBenchmarkBase::initializeBenchmark()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-    mTextureData.resize(params.textureWidth * params.textureHeight * 4);
-    FillWithRandomData(&mTextureData);
+    mTextureData.resize(params.textureWidth * params.textureHeight * GetPixelBytes(params));
+    FillWithRandomData(&mTextureData, params.type);
 
     glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
-                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+                 0, params.format, params.type, mTextureData.data());
 
     // Perform a draw so the image data is flushed.
     glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -216,10 +268,10 @@ void GenerateMipmapBenchmark::drawBenchmark()
     for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
     {
         // Slightly modify the base texture so the mipmap is definitely regenerated.
-        std::array<uint8_t, 4> randomData;
-        FillWithRandomData(&randomData);
+        std::array<uint8_t, 4 * sizeof(float)> randomData;
+        FillWithRandomData(&randomData, params.type);
 
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, params.internalFormat, GL_UNSIGNED_BYTE,
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, params.format, params.type,
                         randomData.data());
 
         // Generate mipmaps
@@ -248,7 +300,7 @@ void GenerateMipmapWithRedefineBenchmark::drawBenchmark()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
-                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+                 0, params.format, params.type, mTextureData.data());
 
     // Perform a draw so the image data is flushed.
     glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -324,6 +376,7 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     if (emulatedFormat)
     {
         params.internalFormat = GL_RGB;
+        params.format         = GL_RGB;
     }
     if (singleIteration)
     {
@@ -332,6 +385,19 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     return params;
 }
 
+// Generates the mipmaps of a 4K texture with the CPU path of the Vulkan backend.
+GenerateMipmapParams VulkanCPUParams(GLenum internalFormat, GLenum type)
+{
+    GenerateMipmapParams params = VulkanParams(false, false, false);
+    params.eglParameters.enable(Feature::ForceGenerateMipmapOnCPU);
+    params.textureWidth   = 3840;
+    params.textureHeight  = 2160;
+    params.internalFormat = internalFormat;
+    params.type           = type;
+    params.cpu            = true;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(GenerateMipmapBenchmark, Run)
@@ -356,7 +422,10 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
                        VulkanParams(false, false, false),
                        VulkanParams(true, false, false),
                        VulkanParams(false, false, true),
-                       VulkanParams(true, false, true));
+                       VulkanParams(true, false, true),
+                       VulkanCPUParams(GL_RGBA, GL_UNSIGNED_BYTE),
+                       VulkanCPUParams(GL_RGBA16F, GL_FLOAT),
+                       VulkanCPUParams(GL_RGBA32F, GL_FLOAT));
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        D3D11Params(false, true),
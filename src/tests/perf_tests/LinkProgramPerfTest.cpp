@@ -10,9 +10,13 @@
 #include "ANGLEPerfTest.h"
 
 #include <array>
+#include <sstream>
 
+#include "common/system_utils.h"
 #include "common/vector_utils.h"
+#include "util/EGLWindow.h"
 #include "util/shader_utils.h"
+#include "util/test_utils.h"
 
 using namespace angle;
 
@@ -23,6 +27,12 @@ enum class TaskOption
 {
     CompileOnly,
     CompileAndLink,
+    // Compile and link a batch of programs before checking any of them, so that the driver can
+    // compile and link them in parallel.
+    CompileAndLinkBatch,
+    // Compile the first shaders of a newly created context, which includes any initialization of
+    // the shader compiler that is not done ahead of time.
+    FirstCompile,
 
     Unspecified
 };
@@ -62,6 +72,14 @@ struct LinkProgramParams final : public RenderTestParams
         {
             strstr << "_compile_and_link";
         }
+        else if (taskOption == TaskOption::CompileAndLinkBatch)
+        {
+            strstr << "_compile_and_link_batch";
+        }
+        else if (taskOption == TaskOption::FirstCompile)
+        {
+            strstr << "_first_compile";
+        }
 
         if (threadOption == ThreadOption::SingleThread)
         {
@@ -101,7 +119,18 @@ class LinkProgramBenchmark : public ANGLERenderTest,
     void drawBenchmark() override;
 
   protected:
+    void compileAndLinkBatch();
+    void compileInNewContext();
+    void drawWithProgram(GLuint program);
+
     GLuint mVertexBuffer = 0;
+
+    // Total time spent in the first compilation of each new context, in seconds.
+    double mFirstCompileTime  = 0.0;
+    uint32_t mNewContextCount = 0;
+
+    // Makes the shaders of every batch unique, so that the programs aren't loaded from the cache.
+    uint32_t mBatchSerial = 0;
 };
 
 LinkProgramBenchmark::LinkProgramBenchmark() : ANGLERenderTest("LinkProgram", GetParam()) {}
@@ -115,6 +144,16 @@ void LinkProgramBenchmark::initializeBenchmark()
         return;
     }
 
+    if (GetParam().taskOption == TaskOption::FirstCompile)
+    {
+        if (GetParam().driver != GLESDriverType::AngleEGL)
+        {
+            skipTest("first compile is only measured with ANGLE's EGL");
+            return;
+        }
+        mReporter->RegisterImportantMetric(".first_compile_time", "ms");
+    }
+
     if (IsGLExtensionEnabled("GL_KHR_parallel_shader_compile") &&
         GetParam().threadOption == ThreadOption::SingleThread)
     {
@@ -134,10 +173,27 @@ void LinkProgramBenchmark::initializeBenchmark()
 void LinkProgramBenchmark::destroyBenchmark()
 {
     glDeleteBuffers(1, &mVertexBuffer);
+
+    if (mNewContextCount > 0)
+    {
+        mReporter->AddResult(".first_compile_time", mFirstCompileTime * 1000.0 / mNewContextCount);
+    }
 }
 
 void LinkProgramBenchmark::drawBenchmark()
 {
+    if (GetParam().taskOption == TaskOption::CompileAndLinkBatch)
+    {
+        compileAndLinkBatch();
+        return;
+    }
+
+    if (GetParam().taskOption == TaskOption::FirstCompile)
+    {
+        compileInNewContext();
+        return;
+    }
+
     static const char *vertexShader =
         "attribute vec2 position;\n"
         "void main() {\n"
@@ -168,6 +224,115 @@ void LinkProgramBenchmark::drawBenchmark()
     glAttachShader(program, fs);
     glDeleteShader(fs);
     glLinkProgram(program);
+
+    drawWithProgram(program);
+
+    glDeleteProgram(program);
+}
+
+void LinkProgramBenchmark::compileAndLinkBatch()
+{
+    constexpr size_t kBatchSize = 16;
+
+    static const char *vertexShader =
+        "attribute vec2 position;\n"
+        "void main() {\n"
+        "    gl_Position = vec4(position, 0, 1);\n"
+        "}";
+
+    std::array<GLuint, kBatchSize> programs;
+    for (size_t programIndex = 0; programIndex < kBatchSize; ++programIndex)
+    {
+        std::stringstream fragmentShader;
+        fragmentShader << "precision mediump float;\n"
+                          "void main() {\n"
+                          "    gl_FragColor = vec4(1, 0, "
+                       << mBatchSerial << ".0, " << programIndex << ".0);\n"
+                       << "}";
+        const std::string fragmentShaderSource = fragmentShader.str();
+        const char *fragmentShaderSourcePtr    = fragmentShaderSource.c_str();
+
+        GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vs, 1, &vertexShader, nullptr);
+        glCompileShader(vs);
+
+        GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fs, 1, &fragmentShaderSourcePtr, nullptr);
+        glCompileShader(fs);
+
+        // Link without checking the compile status, which would wait for the compilation.
+        programs[programIndex] = glCreateProgram();
+        glAttachShader(programs[programIndex], vs);
+        glDeleteShader(vs);
+        glAttachShader(programs[programIndex], fs);
+        glDeleteShader(fs);
+        glLinkProgram(programs[programIndex]);
+    }
+    ++mBatchSerial;
+
+    const bool hasParallelCompile = IsGLExtensionEnabled("GL_KHR_parallel_shader_compile");
+    for (GLuint program : programs)
+    {
+        // Poll the completion of the link like an application hiding its latency would, instead of
+        // waiting for it right away.
+        GLint completionStatus = hasParallelCompile ? GL_FALSE : GL_TRUE;
+        while (completionStatus == GL_FALSE)
+        {
+            glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completionStatus);
+        }
+
+        GLint linkStatus = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        ASSERT_EQ(GL_TRUE, linkStatus);
+
+        drawWithProgram(program);
+
+        glDeleteProgram(program);
+    }
+}
+
+void LinkProgramBenchmark::compileInNewContext()
+{
+    // Applications typically create a few resources between making a context current and
+    // compiling their first shaders.  This gives the implementation a chance to prepare the
+    // shader compiler in the background.
+    constexpr unsigned int kSetupTimeMs = 10;
+
+    static const char *vertexShader =
+        "attribute vec2 position;\n"
+        "void main() {\n"
+        "    gl_Position = vec4(position, 0, 1);\n"
+        "}";
+    static const char *fragmentShader =
+        "precision mediump float;\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(1, 0, 0, 1);\n"
+        "}";
+
+    EGLWindow *eglWindow = static_cast<EGLWindow *>(getGLWindow());
+    EGLContext context   = eglWindow->createContext(EGL_NO_CONTEXT, nullptr);
+    ASSERT_NE(EGL_NO_CONTEXT, context);
+    ASSERT_TRUE(eglWindow->makeCurrent(context));
+
+    angle::Sleep(kSetupTimeMs);
+
+    const double compileStartTime = angle::GetCurrentSystemTime();
+    GLuint vs                     = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    GLuint fs                     = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+    mFirstCompileTime += angle::GetCurrentSystemTime() - compileStartTime;
+    ++mNewContextCount;
+
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, fs);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    ASSERT_TRUE(eglWindow->makeCurrent());
+    eglDestroyContext(eglWindow->getDisplay(), context);
+}
+
+void LinkProgramBenchmark::drawWithProgram(GLuint program)
+{
     glUseProgram(program);
 
     GLint positionLoc = glGetAttribLocation(program, "position");
@@ -176,8 +341,6 @@ void LinkProgramBenchmark::drawBenchmark()
 
     // Draw with the program to ensure the shader gets compiled and used.
     glDrawArrays(GL_TRIANGLES, 0, 6);
-
-    glDeleteProgram(program);
 }
 
 using namespace egl_platform;
@@ -232,6 +395,12 @@ ANGLE_INSTANTIATE_TEST(
     LinkProgramD3D11Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramMetalParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
-    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread));
+    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLinkBatch, ThreadOption::MultiThread),
+    LinkProgramVulkanParams(TaskOption::CompileAndLinkBatch, ThreadOption::MultiThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLinkBatch, ThreadOption::SingleThread),
+    LinkProgramVulkanParams(TaskOption::CompileAndLinkBatch, ThreadOption::SingleThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::FirstCompile, ThreadOption::MultiThread),
+    LinkProgramVulkanParams(TaskOption::FirstCompile, ThreadOption::MultiThread));
 
 }  // anonymous namespace
@@ -0,0 +1,120 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImagePerf: Performance test for the CPU pixel conversions done on texture upload.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <gmock/gmock.h>
+
+#include "image_util/loadimage.h"
+
+using namespace testing;
+
+namespace
+{
+using LoadFunction = void (*)(const angle::ImageLoadContext &context,
+                              size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+
+struct LoadImageParams
+{
+    const char *name;
+    LoadFunction loadFunction;
+    size_t inputPixelBytes;
+    size_t outputPixelBytes;
+};
+
+std::ostream &operator<<(std::ostream &os, const LoadImageParams &params)
+{
+    os << params.name;
+    return os;
+}
+
+constexpr size_t kWidth  = 1024;
+constexpr size_t kHeight = 1024;
+
+class LoadImagePerfTest : public ANGLEPerfTest, public WithParamInterface<LoadImageParams>
+{
+  public:
+    LoadImagePerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+    std::string getName();
+
+  private:
+    angle::ImageLoadContext mContext;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+LoadImagePerfTest::LoadImagePerfTest()
+    : ANGLEPerfTest(getName(), "", "_run", 1, "us"),
+      mInput(kWidth * kHeight * GetParam().inputPixelBytes),
+      mOutput(kWidth * kHeight * GetParam().outputPixelBytes)
+{
+    for (size_t index = 0; index < mInput.size(); ++index)
+    {
+        mInput[index] = static_cast<uint8_t>(index * 31);
+    }
+}
+
+void LoadImagePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+    mReporter->RegisterImportantMetric(".bytes_per_step", "sizeInBytes");
+}
+
+void LoadImagePerfTest::TearDown()
+{
+    // Together with the time per step, gives the bandwidth of the conversion.
+    recordIntegerMetric(".bytes_per_step", mInput.size() + mOutput.size(), "sizeInBytes");
+    ANGLEPerfTest::TearDown();
+}
+
+void LoadImagePerfTest::step()
+{
+    const LoadImageParams &params = GetParam();
+    params.loadFunction(mContext, kWidth, kHeight, 1, mInput.data(),
+                        kWidth * params.inputPixelBytes, mInput.size(), mOutput.data(),
+                        kWidth * params.outputPixelBytes, mOutput.size());
+}
+
+std::string LoadImagePerfTest::getName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+// Measures the speed of converting a 1024x1024 image on upload.
+TEST_P(LoadImagePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ,
+    LoadImagePerfTest,
+    Values(LoadImageParams{"LA8ToRGBA8", angle::LoadLA8ToRGBA8, 2, 4},
+           LoadImageParams{"RGB8ToBGRX8", angle::LoadRGB8ToBGRX8, 3, 4},
+           LoadImageParams{"RGBA8ToBGRA8", angle::LoadRGBA8ToBGRA8, 4, 4},
+           LoadImageParams{"R5G6B5ToRGBA8", angle::LoadR5G6B5ToRGBA8, 2, 4},
+           LoadImageParams{"R5G6B5ToBGRA8", angle::LoadR5G6B5ToBGRA8, 2, 4},
+           LoadImageParams{"RGB10A2ToRGBA8", angle::LoadRGB10A2ToRGBA8, 4, 4}),
+    PrintToStringParamName());
+
+}  // anonymous namespace
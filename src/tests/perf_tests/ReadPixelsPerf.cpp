@@ -0,0 +1,226 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReadPixelsPerf:
+//   Performance test for glReadPixels of large framebuffers, including the conversions between
+//   RGBA and BGRA and the y-flip done on the CPU.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <vector>
+
+#include "util/gles_loader_autogen.h"
+
+using namespace angle;
+
+namespace
+{
+struct ReadPixelsParams final : public RenderTestParams
+{
+    ReadPixelsParams()
+    {
+        iterationsPerStep = 1;
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 64;
+        windowHeight      = 64;
+    }
+
+    std::string story() const override;
+
+    GLsizei framebufferWidth  = 3840;
+    GLsizei framebufferHeight = 2160;
+    // GL_RGBA or GL_BGRA_EXT.
+    GLenum framebufferFormat = GL_RGBA;
+    GLenum readFormat        = GL_RGBA;
+    // Whether the rows are read bottom-up with GL_ANGLE_pack_reverse_row_order.
+    bool reverseRowOrder = false;
+    // Whether the pixels are read into a pixel pack buffer.
+    bool pbo = false;
+};
+
+std::ostream &operator<<(std::ostream &os, const ReadPixelsParams &params)
+{
+    return os << params.backendAndStory().substr(1);
+}
+
+const char *FormatString(GLenum format)
+{
+    return format == GL_BGRA_EXT ? "bgra" : "rgba";
+}
+
+std::string ReadPixelsParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+    strstr << "_" << FormatString(framebufferFormat) << "_to_" << FormatString(readFormat);
+    strstr << "_" << framebufferWidth << "x" << framebufferHeight;
+
+    if (reverseRowOrder)
+    {
+        strstr << "_flip";
+    }
+    if (pbo)
+    {
+        strstr << "_pbo";
+    }
+
+    return strstr.str();
+}
+
+class ReadPixelsBenchmark : public ANGLERenderTest,
+                            public ::testing::WithParamInterface<ReadPixelsParams>
+{
+  public:
+    ReadPixelsBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mTexture     = 0;
+    GLuint mFramebuffer = 0;
+    GLuint mPackBuffer  = 0;
+    std::vector<uint8_t> mPixels;
+    uint32_t mFrame = 0;
+};
+
+ReadPixelsBenchmark::ReadPixelsBenchmark() : ANGLERenderTest("ReadPixels", GetParam())
+{
+    const ReadPixelsParams &params = GetParam();
+    if (params.framebufferFormat == GL_BGRA_EXT)
+    {
+        addExtensionPrerequisite("GL_EXT_texture_format_BGRA8888");
+    }
+    if (params.readFormat == GL_BGRA_EXT)
+    {
+        addExtensionPrerequisite("GL_EXT_read_format_bgra");
+    }
+    if (params.reverseRowOrder)
+    {
+        addExtensionPrerequisite("GL_ANGLE_pack_reverse_row_order");
+    }
+}
+
+void ReadPixelsBenchmark::initializeBenchmark()
+{
+    const ReadPixelsParams &params = GetParam();
+
+    glGenTextures(1, &mTexture);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, params.framebufferFormat, params.framebufferWidth,
+                 params.framebufferHeight, 0, params.framebufferFormat, GL_UNSIGNED_BYTE, nullptr);
+
+    glGenFramebuffers(1, &mFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture, 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    const size_t readbackSize = params.framebufferWidth * params.framebufferHeight * 4;
+    if (params.pbo)
+    {
+        glGenBuffers(1, &mPackBuffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, mPackBuffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, readbackSize, nullptr, GL_STREAM_READ);
+    }
+    else
+    {
+        mPixels.resize(readbackSize);
+    }
+
+    if (params.reverseRowOrder)
+    {
+        glPixelStorei(GL_PACK_REVERSE_ROW_ORDER_ANGLE, GL_TRUE);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ReadPixelsBenchmark::destroyBenchmark()
+{
+    glDeleteBuffers(1, &mPackBuffer);
+    glDeleteFramebuffers(1, &mFramebuffer);
+    glDeleteTextures(1, &mTexture);
+}
+
+void ReadPixelsBenchmark::drawBenchmark()
+{
+    const ReadPixelsParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        // Change the contents every time, so the readback waits for the GPU as it would in an
+        // application.
+        glClearColor(static_cast<float>(++mFrame % 2), 0.25f, 0.5f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glReadPixels(0, 0, params.framebufferWidth, params.framebufferHeight, params.readFormat,
+                     GL_UNSIGNED_BYTE, params.pbo ? nullptr : mPixels.data());
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+ReadPixelsParams VulkanParams(GLenum framebufferFormat,
+                              GLenum readFormat,
+                              bool reverseRowOrder,
+                              bool pbo)
+{
+    ReadPixelsParams params;
+    params.eglParameters     = egl_platform::VULKAN();
+    params.framebufferFormat = framebufferFormat;
+    params.readFormat        = readFormat;
+    params.reverseRowOrder   = reverseRowOrder;
+    params.pbo               = pbo;
+    return params;
+}
+
+ReadPixelsParams D3D11Params(GLenum framebufferFormat, GLenum readFormat, bool reverseRowOrder)
+{
+    ReadPixelsParams params;
+    params.eglParameters     = egl_platform::D3D11();
+    params.framebufferFormat = framebufferFormat;
+    params.readFormat        = readFormat;
+    params.reverseRowOrder   = reverseRowOrder;
+    return params;
+}
+
+ReadPixelsParams OpenGLOrGLESParams(GLenum framebufferFormat, GLenum readFormat)
+{
+    ReadPixelsParams params;
+    params.eglParameters     = egl_platform::OPENGL_OR_GLES();
+    params.framebufferFormat = framebufferFormat;
+    params.readFormat        = readFormat;
+    return params;
+}
+}  // anonymous namespace
+
+// Measures the time to read back a 4K framebuffer, most of which is spent converting the pixels on
+// the CPU.
+TEST_P(ReadPixelsBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(ReadPixelsBenchmark,
+                       D3D11Params(GL_RGBA, GL_RGBA, false),
+                       D3D11Params(GL_RGBA, GL_RGBA, true),
+                       D3D11Params(GL_BGRA_EXT, GL_RGBA, false),
+                       OpenGLOrGLESParams(GL_RGBA, GL_RGBA),
+                       OpenGLOrGLESParams(GL_RGBA, GL_BGRA_EXT),
+                       VulkanParams(GL_RGBA, GL_RGBA, false, false),
+                       VulkanParams(GL_RGBA, GL_RGBA, true, false),
+                       VulkanParams(GL_RGBA, GL_BGRA_EXT, false, false),
+                       VulkanParams(GL_BGRA_EXT, GL_RGBA, false, false),
+                       VulkanParams(GL_BGRA_EXT, GL_BGRA_EXT, false, false),
+                       VulkanParams(GL_RGBA, GL_RGBA, false, true),
+                       VulkanParams(GL_RGBA, GL_BGRA_EXT, false, true));
+
+// This test suite is not instantiated on some OSes.
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ReadPixelsBenchmark);
@@ -23,6 +23,7 @@
 #include "util/capture/traces_export.h"
 #include "util/egl_loader_autogen.h"
 #include "util/png_utils.h"
+#include "util/shader_utils.h"
 #include "util/test_utils.h"
 
 #if defined(ANGLE_PLATFORM_ANDROID)
@@ -30,8 +31,11 @@
 #endif
 
 #include <rapidjson/document.h>
+#include <rapidjson/filewritestream.h>
 #include <rapidjson/istreamwrapper.h>
+#include <rapidjson/prettywriter.h>
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <functional>
@@ -166,6 +170,9 @@ class TracePerfTest : public ANGLERenderTest
     void saveScreenshotIfEnabled(ScreenshotType screenshotType);
     void saveScreenshot(const std::string &screenshotName);
 
+    void beginEntryPointProfile();
+    void reportEntryPointProfile();
+
     std::unique_ptr<const TracePerfParams> mParams;
 
     uint32_t mStartFrame;
@@ -198,6 +205,12 @@ class TracePerfTest : public ANGLERenderTest
     int32_t mScreenshotFrame                                            = gScreenshotFrame;
     std::unique_ptr<TraceLibrary> mTraceReplay;
     GPUTestExpectationsParser mTestExpectationsParser;
+
+    // Per-entry point CPU time, only available when ANGLE is built with
+    // angle_enable_entry_point_profiling.
+    GLint mEntryPointProfileGroup = -1;
+    std::vector<std::string> mEntryPointProfileCounterNames;
+    std::vector<uint64_t> mEntryPointProfileStartValues;
 };
 
 TracePerfTest *gCurrentTracePerfTest = nullptr;
@@ -1378,6 +1391,223 @@ std::string FindTraceGzPath(const std::string &traceName)
     return pathStream.str();
 }
 
+// Written by angle_trace_bytecode_compiler.
+std::string FindTraceBytecodePath(const std::string &traceName)
+{
+    std::stringstream pathStream;
+
+    char genDir[kMaxPath] = {};
+    if (!angle::FindTestDataPath("gen", genDir, kMaxPath))
+    {
+        return "";
+    }
+    pathStream << genDir << angle::GetPathSeparator() << "tracebc_" << traceName << ".bin";
+
+    return pathStream.str();
+}
+
+// The perf monitor group reported by ANGLE when built with angle_enable_entry_point_profiling.
+// Each entry point has a call count, followed by its frontend, validation and backend time.
+constexpr char kEntryPointProfileGroupName[]             = "EntryPointProfile";
+constexpr char kEntryPointProfileCallsSuffix[]           = ".calls";
+constexpr size_t kEntryPointProfileCountersPerEntryPoint = 4;
+constexpr size_t kEntryPointProfileTableRows             = 25;
+
+struct EntryPointProfileRow
+{
+    std::string entryPoint;
+    uint64_t callCount;
+    uint64_t frontendNs;
+    uint64_t validationNs;
+    uint64_t backendNs;
+
+    uint64_t totalNs() const { return frontendNs + validationNs + backendNs; }
+};
+
+GLint FindPerfMonitorGroup(const char *groupName)
+{
+    GLint numGroups = 0;
+    glGetPerfMonitorGroupsAMD(&numGroups, 0, nullptr);
+    std::vector<GLuint> groups(numGroups, 0);
+    glGetPerfMonitorGroupsAMD(nullptr, numGroups, groups.data());
+
+    for (GLuint group : groups)
+    {
+        static constexpr size_t kBufSize = 1000;
+        char buffer[kBufSize]            = {};
+        glGetPerfMonitorGroupStringAMD(group, kBufSize, nullptr, buffer);
+        if (strcmp(buffer, groupName) == 0)
+        {
+            return static_cast<GLint>(group);
+        }
+    }
+
+    return -1;
+}
+
+std::vector<uint64_t> GetPerfMonitorGroupValues(GLuint group, size_t counterCount)
+{
+    std::vector<uint64_t> values(counterCount, 0);
+    for (const PerfMonitorTriplet &triplet : GetPerfMonitorTriplets())
+    {
+        if (triplet.group == group && triplet.counter < counterCount)
+        {
+            values[triplet.counter] = triplet.value;
+        }
+    }
+    return values;
+}
+
+bool WriteEntryPointProfileJson(const char *fileName,
+                                const char *traceName,
+                                uint32_t frameCount,
+                                const std::vector<EntryPointProfileRow> &rows)
+{
+    rapidjson::Document doc(rapidjson::kObjectType);
+    rapidjson::Document::AllocatorType &allocator = doc.GetAllocator();
+
+    rapidjson::Value trace(traceName, allocator);
+    doc.AddMember("trace", trace, allocator);
+    doc.AddMember("frames", frameCount, allocator);
+
+    rapidjson::Value entryPoints(rapidjson::kArrayType);
+    for (const EntryPointProfileRow &row : rows)
+    {
+        rapidjson::Value entryPoint(rapidjson::kObjectType);
+        rapidjson::Value name(row.entryPoint.c_str(), allocator);
+        entryPoint.AddMember("name", name, allocator);
+        entryPoint.AddMember("calls", row.callCount, allocator);
+        entryPoint.AddMember("total_ns", row.totalNs(), allocator);
+        entryPoint.AddMember("validation_ns", row.validationNs, allocator);
+        entryPoint.AddMember("frontend_ns", row.frontendNs, allocator);
+        entryPoint.AddMember("backend_ns", row.backendNs, allocator);
+        entryPoints.PushBack(entryPoint, allocator);
+    }
+    doc.AddMember("entry_points", entryPoints, allocator);
+
+    FILE *fp = fopen(fileName, "w");
+    if (!fp)
+    {
+        return false;
+    }
+
+    constexpr size_t kBufferSize = 0xFFFF;
+    std::vector<char> writeBuffer(kBufferSize);
+    rapidjson::FileWriteStream os(fp, writeBuffer.data(), kBufferSize);
+    rapidjson::PrettyWriter<rapidjson::FileWriteStream> writer(os);
+    bool success = doc.Accept(writer);
+    fclose(fp);
+    return success;
+}
+
+void TracePerfTest::beginEntryPointProfile()
+{
+    if (!IsGLExtensionEnabled(kPerfMonitorExtensionName))
+    {
+        return;
+    }
+
+    mEntryPointProfileGroup = FindPerfMonitorGroup(kEntryPointProfileGroupName);
+    if (mEntryPointProfileGroup < 0)
+    {
+        if (gEntryPointProfileJson)
+        {
+            fprintf(stderr,
+                    "Cannot write the entry point profile, ANGLE must be built with "
+                    "angle_enable_entry_point_profiling.\n");
+        }
+        return;
+    }
+
+    GLuint group      = static_cast<GLuint>(mEntryPointProfileGroup);
+    GLint numCounters = 0;
+    glGetPerfMonitorCountersAMD(group, &numCounters, nullptr, 0, nullptr);
+
+    mEntryPointProfileCounterNames.resize(numCounters);
+    for (GLint counter = 0; counter < numCounters; ++counter)
+    {
+        static constexpr size_t kBufSize = 1000;
+        char buffer[kBufSize]            = {};
+        glGetPerfMonitorCounterStringAMD(group, static_cast<GLuint>(counter), kBufSize, nullptr,
+                                         buffer);
+        mEntryPointProfileCounterNames[counter] = buffer;
+    }
+
+    // The setup of the trace isn't included in the profile.
+    mEntryPointProfileStartValues =
+        GetPerfMonitorGroupValues(group, mEntryPointProfileCounterNames.size());
+}
+
+void TracePerfTest::reportEntryPointProfile()
+{
+    if (mEntryPointProfileGroup < 0)
+    {
+        return;
+    }
+
+    std::vector<uint64_t> endValues = GetPerfMonitorGroupValues(
+        static_cast<GLuint>(mEntryPointProfileGroup), mEntryPointProfileCounterNames.size());
+
+    std::vector<EntryPointProfileRow> rows;
+    for (size_t counter = 0; counter + kEntryPointProfileCountersPerEntryPoint <=
+                             mEntryPointProfileCounterNames.size();
+         counter += kEntryPointProfileCountersPerEntryPoint)
+    {
+        auto delta = [&](size_t offset) {
+            return endValues[counter + offset] - mEntryPointProfileStartValues[counter + offset];
+        };
+
+        const std::string &callsName = mEntryPointProfileCounterNames[counter];
+        ASSERT(EndsWith(callsName, kEntryPointProfileCallsSuffix));
+
+        EntryPointProfileRow row;
+        row.entryPoint =
+            callsName.substr(0, callsName.size() - strlen(kEntryPointProfileCallsSuffix));
+        row.callCount    = delta(0);
+        row.frontendNs   = delta(1);
+        row.validationNs = delta(2);
+        row.backendNs    = delta(3);
+        if (row.callCount > 0)
+        {
+            rows.push_back(row);
+        }
+    }
+
+    std::sort(rows.begin(), rows.end(),
+              [](const EntryPointProfileRow &a, const EntryPointProfileRow &b) {
+                  return a.totalNs() > b.totalNs();
+              });
+
+    uint64_t totalNs = 0;
+    for (const EntryPointProfileRow &row : rows)
+    {
+        totalNs += row.totalNs();
+    }
+
+    auto toMs = [](uint64_t ns) { return static_cast<double>(ns) / 1000000.0; };
+
+    printf("\nEntry point CPU time of %s over %u frames (%.3f ms total):\n",
+           mParams->traceInfo.name, mTotalFrameCount, toMs(totalNs));
+    printf("%-44s %10s %12s %12s %12s %12s %10s\n", "Entry point", "Calls", "Total ms",
+           "Validation", "Frontend", "Backend", "ns/call");
+    for (size_t rowIndex = 0; rowIndex < std::min(rows.size(), kEntryPointProfileTableRows);
+         ++rowIndex)
+    {
+        const EntryPointProfileRow &row = rows[rowIndex];
+        printf("%-44s %10llu %12.3f %12.3f %12.3f %12.3f %10.0f\n", row.entryPoint.c_str(),
+               static_cast<unsigned long long>(row.callCount), toMs(row.totalNs()),
+               toMs(row.validationNs), toMs(row.frontendNs), toMs(row.backendNs),
+               static_cast<double>(row.totalNs()) / static_cast<double>(row.callCount));
+    }
+
+    if (gEntryPointProfileJson &&
+        !WriteEntryPointProfileJson(gEntryPointProfileJson, mParams->traceInfo.name,
+                                    mTotalFrameCount, rows))
+    {
+        fprintf(stderr, "Error writing the entry point profile to %s.\n", gEntryPointProfileJson);
+    }
+}
+
 void TracePerfTest::initializeBenchmark()
 {
     const TraceInfo &traceInfo = mParams->traceInfo;
@@ -1407,6 +1637,16 @@ void TracePerfTest::initializeBenchmark()
             }
             mTraceReplay->setTraceGzPath(traceGzPath);
         }
+        else if (strcmp(gTraceInterpreter, "bytecode") == 0)
+        {
+            std::string traceBytecodePath = FindTraceBytecodePath(traceInfo.name);
+            if (traceBytecodePath.empty())
+            {
+                failTest("Could not find trace bytecode.");
+                return;
+            }
+            mTraceReplay->setTraceBytecodePath(traceBytecodePath);
+        }
     }
     else
     {
@@ -1509,6 +1749,22 @@ void TracePerfTest::initializeBenchmark()
     // Potentially slow. Can load a lot of resources.
     mTraceReplay->setupReplay();
 
+    if (gTraceInterpreter)
+    {
+        TraceInterpreterStats stats;
+        mTraceReplay->getTraceInterpreterStats(&stats);
+
+        mReporter->RegisterFyiMetric(".trace_load_time", "ms");
+        recordDoubleMetric(".trace_load_time", stats.loadTimeSeconds * 1000.0, "ms");
+
+        // Only measured when running bytecode.
+        if (stats.callOverheadNs > 0.0)
+        {
+            mReporter->RegisterFyiMetric(".interpreter_call_overhead", "ns");
+            recordDoubleMetric(".interpreter_call_overhead", stats.callOverheadNs, "ns");
+        }
+    }
+
     glFinish();
 
     ASSERT_GE(mEndFrame, mStartFrame);
@@ -1522,12 +1778,16 @@ void TracePerfTest::initializeBenchmark()
     {
         getGLWindow()->swap();
     }
+
+    beginEntryPointProfile();
 }
 
 #undef TRACE_TEST_CASE
 
 void TracePerfTest::destroyBenchmark()
 {
+    reportEntryPointProfile();
+
     if (mParams->surfaceType == SurfaceType::Offscreen)
     {
         glDeleteTextures(mMaxOffscreenBufferCount, mOffscreenTextures.data());
@@ -1544,6 +1804,16 @@ void TracePerfTest::destroyBenchmark()
         mOffscreenFramebuffers.fill(0);
     }
 
+    // Long traces stall when a block of their binary data has to be loaded during a frame.
+    double binaryDataStallTime = mTraceReplay->getBinaryDataStallTimeSeconds();
+    if (binaryDataStallTime > 0.0 && mTotalFrameCount > 0)
+    {
+        mReporter->RegisterFyiMetric(".binary_data_stall_time", "ms");
+        recordDoubleMetric(".binary_data_stall_time",
+                           binaryDataStallTime * 1000.0 / static_cast<double>(mTotalFrameCount),
+                           "ms");
+    }
+
     mTraceReplay->finishReplay();
     mTraceReplay.reset(nullptr);
 }
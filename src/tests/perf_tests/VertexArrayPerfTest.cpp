@@ -4,7 +4,8 @@
 // found in the LICENSE file.
 //
 // VertexArrayPerfTest:
-//   Performance test for glBindVertexArray.
+//   Performance test for glBindVertexArray, for the conversion of vertex formats the backends
+//   emulate, and for the streaming of client arrays.
 //
 
 #ifdef UNSAFE_BUFFERS_BUILD
@@ -24,8 +25,32 @@ enum class TestMode
     BufferData,
     BindBuffer,
     UpdateBufferData,
+    ConvertClientArray,
+    StreamClientArray,
 };
 
+// A vertex format that backends commonly convert on the CPU.
+struct VertexFormat
+{
+    const char *name;
+    GLenum type;
+    GLint components;
+    GLboolean normalized;
+    size_t vertexSize;
+};
+
+constexpr VertexFormat kByte3{"byte3", GL_BYTE, 3, GL_FALSE, 3};
+constexpr VertexFormat kByte3Norm{"byte3norm", GL_BYTE, 3, GL_TRUE, 3};
+constexpr VertexFormat kUByte3{"ubyte3", GL_UNSIGNED_BYTE, 3, GL_FALSE, 3};
+constexpr VertexFormat kUByte3Norm{"ubyte3norm", GL_UNSIGNED_BYTE, 3, GL_TRUE, 3};
+constexpr VertexFormat kShort3{"short3", GL_SHORT, 3, GL_FALSE, 6};
+constexpr VertexFormat kShort3Norm{"short3norm", GL_SHORT, 3, GL_TRUE, 6};
+constexpr VertexFormat kUShort3{"ushort3", GL_UNSIGNED_SHORT, 3, GL_FALSE, 6};
+constexpr VertexFormat kUShort3Norm{"ushort3norm", GL_UNSIGNED_SHORT, 3, GL_TRUE, 6};
+constexpr VertexFormat kInt2101010Norm{"int2101010norm", GL_INT_2_10_10_10_REV, 4, GL_TRUE, 4};
+constexpr VertexFormat kUInt2101010Norm{"uint2101010norm", GL_UNSIGNED_INT_2_10_10_10_REV, 4,
+                                        GL_TRUE, 4};
+
 struct VertexArrayParams final : public RenderTestParams
 {
     VertexArrayParams()
@@ -45,6 +70,13 @@ struct VertexArrayParams final : public RenderTestParams
     int numBuffers       = 5;
     GLuint bufferSize[5] = {384, 1028, 192, 384, 192};
     TestMode testMode    = TestMode::BufferData;
+
+    // Used by TestMode::ConvertClientArray and TestMode::StreamClientArray.
+    VertexFormat vertexFormat = kByte3;
+    int numVertices           = 65536;
+
+    // Used by TestMode::StreamClientArray.
+    int numDraws = 1;
 };
 
 std::ostream &operator<<(std::ostream &os, const VertexArrayParams &params)
@@ -67,6 +99,14 @@ std::string VertexArrayParams::story() const
     {
         strstr << "_updatebufferdata";
     }
+    else if (testMode == TestMode::ConvertClientArray)
+    {
+        strstr << "_convert_" << vertexFormat.name;
+    }
+    else if (testMode == TestMode::StreamClientArray)
+    {
+        strstr << "_stream_" << numDraws << "x" << numVertices;
+    }
 
     return strstr.str();
 }
@@ -85,16 +125,32 @@ class VertexArrayBenchmark : public ANGLERenderTest,
     void updateBufferData(GLuint vertexArrayID, GLuint bufferID, GLuint bufferSize);
 
   private:
+    void initializeConvertClientArray();
+    void initializeStreamClientArray();
+
     std::vector<GLuint> mBuffers;
     GLuint mProgram       = 0;
     GLint mAttribLocation = 0;
     std::vector<GLuint> mVertexArrays;
+    std::vector<uint8_t> mClientVertexData;
+    std::vector<GLushort> mClientIndexData;
 };
 
 VertexArrayBenchmark::VertexArrayBenchmark() : ANGLERenderTest("VertexArrayPerf", GetParam()) {}
 
 void VertexArrayBenchmark::initializeBenchmark()
 {
+    if (GetParam().testMode == TestMode::ConvertClientArray)
+    {
+        initializeConvertClientArray();
+        return;
+    }
+    if (GetParam().testMode == TestMode::StreamClientArray)
+    {
+        initializeStreamClientArray();
+        return;
+    }
+
     constexpr char kVS[] = R"(attribute vec4 position;
 attribute float in_attrib;
 varying float v_attrib;
@@ -136,6 +192,62 @@ void main()
     glBindBuffer(GL_ARRAY_BUFFER, mBuffers[0]);
 }
 
+void VertexArrayBenchmark::initializeConvertClientArray()
+{
+    // Every draw reads the client array again, so the format has to be converted each time.
+    constexpr char kVS[] = R"(attribute vec4 in_attrib;
+varying vec4 v_attrib;
+void main()
+{
+    v_attrib = in_attrib;
+    gl_Position = vec4(0, 0, 0, 1);
+    gl_PointSize = 1.0;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec4 v_attrib;
+void main()
+{
+    gl_FragColor = v_attrib;
+})";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    mAttribLocation = glGetAttribLocation(mProgram, "in_attrib");
+    ASSERT_NE(mAttribLocation, -1);
+
+    const VertexFormat &format = GetParam().vertexFormat;
+    mClientVertexData.resize(format.vertexSize * GetParam().numVertices);
+    for (size_t index = 0; index < mClientVertexData.size(); ++index)
+    {
+        mClientVertexData[index] = static_cast<uint8_t>(index * 37 + 11);
+    }
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glEnableVertexAttribArray(mAttribLocation);
+    glVertexAttribPointer(mAttribLocation, format.components, format.type, format.normalized, 0,
+                          mClientVertexData.data());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void VertexArrayBenchmark::initializeStreamClientArray()
+{
+    // Backends that can't source vertices from client memory copy the client arrays and indices
+    // to buffers on every draw.
+    initializeConvertClientArray();
+    ASSERT_LE(GetParam().numVertices, 65536);
+
+    mClientIndexData.resize(GetParam().numVertices);
+    for (size_t index = 0; index < mClientIndexData.size(); ++index)
+    {
+        mClientIndexData[index] = static_cast<GLushort>(mClientIndexData.size() - 1 - index);
+    }
+}
+
 void VertexArrayBenchmark::rebindVertexArray(GLuint vertexArrayID, GLuint bufferID)
 {
     // Rebind a vertex array object and a generic vertex attribute inside of it.
@@ -177,6 +289,18 @@ void VertexArrayBenchmark::drawBenchmark()
     {
         glBufferData(GL_ARRAY_BUFFER, 128, nullptr, GL_STATIC_DRAW);
     }
+    else if (params.testMode == TestMode::ConvertClientArray)
+    {
+        glDrawArrays(GL_POINTS, 0, params.numVertices);
+    }
+    else if (params.testMode == TestMode::StreamClientArray)
+    {
+        for (int draw = 0; draw < params.numDraws; ++draw)
+        {
+            glDrawElements(GL_POINTS, params.numVertices, GL_UNSIGNED_SHORT,
+                           mClientIndexData.data());
+        }
+    }
     else if (params.testMode == TestMode::UpdateBufferData)
     {
         int bufferSizeIndex = 0;
@@ -224,6 +348,37 @@ VertexArrayParams VulkanNullParams(TestMode testMode)
     return params;
 }
 
+VertexArrayParams StreamParams(int numDraws, int numVertices)
+{
+    VertexArrayParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    params.testMode      = TestMode::StreamClientArray;
+    params.vertexFormat  = kShort3Norm;
+    params.numDraws      = numDraws;
+    params.numVertices   = numVertices;
+    return params;
+}
+
+VertexArrayParams CombineVertexFormat(const VertexArrayParams &in, VertexFormat vertexFormat)
+{
+    VertexArrayParams out = in;
+    out.testMode          = TestMode::ConvertClientArray;
+    out.vertexFormat      = vertexFormat;
+    return out;
+}
+
+using P = VertexArrayParams;
+
+std::vector<P> gConvertFormats =
+    CombineWithValues({P()},
+                      {kByte3, kByte3Norm, kUByte3, kUByte3Norm, kShort3, kShort3Norm, kUShort3,
+                       kUShort3Norm, kInt2101010Norm, kUInt2101010Norm},
+                      CombineVertexFormat);
+std::vector<P> gConvertWithRenderer =
+    CombineWithFuncs(gConvertFormats, {params::D3D11<P>, params::Metal<P>, params::Vulkan<P>});
+std::vector<P> gConvertWithDevice =
+    CombineWithFuncs(gConvertWithRenderer, {params::Passthrough<P>, params::NullDevice<P>});
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VertexArrayBenchmark);
 ANGLE_INSTANTIATE_TEST(VertexArrayBenchmark,
                        MetalParams(),
@@ -231,5 +386,20 @@ ANGLE_INSTANTIATE_TEST(VertexArrayBenchmark,
                        VulkanNullParams(TestMode::BindBuffer),
                        VulkanNullParams(TestMode::BufferData),
                        VulkanNullParams(TestMode::UpdateBufferData),
+                       StreamParams(100, 1024),
+                       StreamParams(10, 16384),
                        params::Native(VertexArrayParams()));
+
+// The conversion benchmarks are combined with every format, renderer and device, so they are
+// instantiated from an array.
+class VertexArrayConversionBenchmark : public VertexArrayBenchmark
+{};
+
+TEST_P(VertexArrayConversionBenchmark, Run)
+{
+    run();
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VertexArrayConversionBenchmark);
+ANGLE_INSTANTIATE_TEST_ARRAY(VertexArrayConversionBenchmark, gConvertWithDevice);
 }  // namespace
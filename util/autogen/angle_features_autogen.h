@@ -63,6 +63,7 @@ enum class Feature
     BottomLeftOriginPresentRegionRectangles,
     BresenhamLineRasterization,
     CacheCompiledShader,
+    CacheTranscodedTextures,
     CallClearTwice,
     ClampArrayAccess,
     ClampFragDepth,
@@ -185,6 +186,7 @@ enum class Feature
     ForceFallbackFormat,
     ForceFlushAfterDrawcallUsingShadowmap,
     ForceFragmentShaderPrecisionHighpToMediump,
+    ForceGenerateMipmapOnCPU,
     ForceGlErrorChecking,
     ForceHostImageCopyForLuma,
     ForceInitShaderVariables,
@@ -240,6 +242,7 @@ enum class Feature
     MultisampleColorFormatShaderReadWorkaround,
     MutableMipmapTextureUpload,
     NoperspectiveInterpolationBrokenWithPassthroughShaders,
+    OptimizeTranslatedSpirv,
     OverrideSurfaceFormatRGB8ToRGBA8,
     PackLastRowSeparatelyForPaddingInclusion,
     PackOverlappingRowsSeparatelyPackBuffer,
@@ -380,6 +383,7 @@ enum class Feature
     SupportsMaintenance5,
     SupportsMaintenance9,
     SupportsMemoryBudget,
+    SupportsMultiBind,
     SupportsMultiDrawIndirect,
     SupportsMultisampledRenderToSingleSampled,
     SupportsMultiview,
@@ -424,11 +424,12 @@ FrameCaptureBinaryData *TraceLibrary::ConfigureBinaryDataLoader(const char *file
     FrameCaptureBinaryData *binaryData = new FrameCaptureBinaryData;
 
     binaryData->configureBinaryDataLoader(
-        mTraceInfo.isBinaryDataCompressed, mTraceInfo.binaryBlockCount,
+        mTraceInfo.binaryVersion, mTraceInfo.isBinaryDataCompressed, mTraceInfo.binaryBlockCount,
         static_cast<size_t>(mTraceInfo.binaryBlockSize),
         static_cast<size_t>(mTraceInfo.binaryResidentSize),
         static_cast<size_t>(mTraceInfo.binaryIndexOffset), pathBuffer.str());
 
+    mBinaryDataLoader = binaryData;
     return binaryData;
 }
 }  // namespace angle
@@ -43,6 +43,8 @@ using ValidateSerializedStateCallback = void (*)(const char *, const char *, uin
 
 using GetSerializedContextStateFunc          = const char *(*)(uint32_t);
 using SetValidateSerializedStateCallbackFunc = void (*)(ValidateSerializedStateCallback);
+using CompileTraceBytecodeFunc               = bool (*)(const char *);
+using GetTraceInterpreterStatsFunc           = void (*)(TraceInterpreterStats *);
 using SetupEntryPoints = void (*)(angle::TraceCallbacks *, angle::TraceFunctions **);
 
 class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
@@ -71,7 +73,14 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
 
     void setDebugOutputDir(const char *dataDir) { mDebugOutputDir = dataDir; }
 
-    void replayFrame(uint32_t frameIndex) { mTraceFunctions->ReplayFrame(frameIndex); }
+    void replayFrame(uint32_t frameIndex)
+    {
+        if (mBinaryDataLoader)
+        {
+            mBinaryDataLoader->onReplayFrame(frameIndex);
+        }
+        mTraceFunctions->ReplayFrame(frameIndex);
+    }
 
     void setupReplay() { mTraceFunctions->SetupReplay(); }
 
@@ -80,7 +89,8 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
     void finishReplay()
     {
         mTraceFunctions->FinishReplay();
-        mBinaryData = {};  // set to empty vector to release memory.
+        mBinaryData       = {};  // set to empty vector to release memory.
+        mBinaryDataLoader = nullptr;
     }
 
     void setupFirstFrame() { mTraceFunctions->SetupFirstFrame(); }
@@ -101,6 +111,28 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
         mTraceFunctions->SetTraceGzPath(traceGzPath);
     }
 
+    void setTraceBytecodePath(const std::string &traceBytecodePath)
+    {
+        mTraceFunctions->SetTraceBytecodePath(traceBytecodePath);
+    }
+
+    // Only implemented by the trace interpreter.
+    bool compileTraceBytecode(const char *outputPath)
+    {
+        return callFunc<CompileTraceBytecodeFunc>("CompileTraceBytecode", outputPath);
+    }
+
+    void getTraceInterpreterStats(TraceInterpreterStats *statsOut)
+    {
+        return callFunc<GetTraceInterpreterStatsFunc>("GetTraceInterpreterStats", statsOut);
+    }
+
+    // Time the replay spent waiting for the binary data of long traces to be loaded.
+    double getBinaryDataStallTimeSeconds() const
+    {
+        return mBinaryDataLoader ? mBinaryDataLoader->getStallTimeSeconds() : 0.0;
+    }
+
   private:
     template <typename FuncT, typename... ArgsT>
     typename std::invoke_result<FuncT, ArgsT...>::type callFunc(const char *funcName, ArgsT... args)
@@ -117,9 +149,12 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
 
     FrameCaptureBinaryData *ConfigureBinaryDataLoader(const char *fileName) override;
     uint8_t *LoadBinaryData(const char *fileName) override;
+    size_t GetBinaryDataSize() const override { return mBinaryData.size(); }
 
     std::unique_ptr<Library> mTraceLibrary;
     std::vector<uint8_t> mBinaryData;
+    // Owned by the trace fixture, which deletes it in FinishReplay().
+    FrameCaptureBinaryData *mBinaryDataLoader = nullptr;
     std::string mBinaryDataDir;
     std::string mDebugOutputDir;
     angle::TraceInfo mTraceInfo;
@@ -0,0 +1,760 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// trace_bytecode.cpp:
+//   Compiler and interpreter for the bytecode form of the C-based replays.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include "trace_bytecode.h"
+
+#include "common/mathutil.h"
+#include "common/string_utils.h"
+#include "common/system_utils.h"
+#include "trace_fixture.h"
+
+namespace angle
+{
+namespace
+{
+constexpr size_t kSectionAlignment = 8;
+
+template <typename T>
+void AppendBytes(std::vector<uint8_t> *data, const T &value)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    data->insert(data->end(), bytes, bytes + sizeof(T));
+}
+
+size_t AlignSection(std::vector<uint8_t> *data)
+{
+    data->resize(rx::roundUpPow2(data->size(), kSectionAlignment), 0);
+    return data->size();
+}
+
+uint64_t GetTokenOffset(const Token &token, const char *prefix)
+{
+    return static_cast<uint64_t>(strtoull(&token[strlen(prefix)], nullptr, 10));
+}
+
+bool IsRangeInFile(uint64_t offset, uint64_t size, size_t fileSize)
+{
+    return offset % kSectionAlignment == 0 && offset <= fileSize && size <= fileSize - offset;
+}
+
+void SetPointerValue(ParamCapture *capture, const void *pointer)
+{
+    memcpy(static_cast<void *>(&capture->value), &pointer, sizeof(pointer));
+}
+}  // anonymous namespace
+
+TraceBytecodeWriter::TraceBytecodeWriter()  = default;
+TraceBytecodeWriter::~TraceBytecodeWriter() = default;
+
+void TraceBytecodeWriter::beginFunction(const std::string &name)
+{
+    mFunctions.emplace_back();
+    mFunctions.back().name = name;
+}
+
+void TraceBytecodeWriter::addCall(const CallCapture &call, const Token *paramTokens)
+{
+    ASSERT(!mFunctions.empty());
+    Function &function = mFunctions.back();
+
+    const std::vector<ParamCapture> &captures = call.params.getParamCaptures();
+    ASSERT(captures.size() <= kMaxParameters);
+
+    TraceBytecodeInstruction instruction = {};
+    instruction.operandCount             = static_cast<uint8_t>(captures.size());
+    if (call.entryPoint != EntryPoint::Invalid)
+    {
+        instruction.opcode = TraceBytecodeOpcode::CallEntryPoint;
+        instruction.target = static_cast<uint32_t>(call.entryPoint);
+    }
+    else
+    {
+        // Custom calls to functions of the trace are found in save(), once all of them are known.
+        const std::string &name = call.customFunctionName;
+        instruction.opcode      = TraceBytecodeOpcode::CallFixtureFunction;
+        instruction.target      = addFixtureFunction(name);
+        function.customCalls.emplace_back(function.code.size(), name);
+    }
+    AppendBytes(&function.code, instruction);
+
+    for (size_t paramIndex = 0; paramIndex < captures.size(); ++paramIndex)
+    {
+        const ParamCapture &param = captures[paramIndex];
+        const Token &token        = paramTokens[paramIndex];
+
+        TraceBytecodeOperand operand = {};
+        operand.type                 = param.type;
+        operand.kind                 = TraceBytecodeOperandKind::Immediate;
+
+        // The pointers to the replay's buffers are rebased when the bytecode runs. All the other
+        // values, including the resource IDs, are stored as they were parsed.
+        if (param.type == ParamType::TGLcharConstPointerPointer)
+        {
+            auto iter = mStringArrayIndices.find(token);
+            ASSERT(iter != mStringArrayIndices.end());
+            operand.kind    = TraceBytecodeOperandKind::StringArray;
+            operand.payload = iter->second;
+        }
+        else if (token[0] == '"')
+        {
+            ASSERT(param.type == ParamType::TGLcharConstPointer && param.data.size() == 1);
+            const std::vector<uint8_t> &str = param.data[0];
+            operand.kind                    = TraceBytecodeOperandKind::String;
+            operand.payload = addString(reinterpret_cast<const char *>(str.data()), str.size() - 1);
+        }
+        else if (BeginsWith(token, "&gBinaryData["))
+        {
+            operand.kind    = TraceBytecodeOperandKind::BinaryData;
+            operand.payload = GetTokenOffset(token, "&gBinaryData[");
+        }
+        else if (BeginsWith(token, "&gReadBuffer["))
+        {
+            operand.kind    = TraceBytecodeOperandKind::ReadBuffer;
+            operand.payload = GetTokenOffset(token, "&gReadBuffer[");
+        }
+        else if (strcmp(token, "gReadBuffer") == 0)
+        {
+            operand.kind = TraceBytecodeOperandKind::ReadBuffer;
+        }
+        else if (strcmp(token, "gResourceIDBuffer") == 0)
+        {
+            operand.kind = TraceBytecodeOperandKind::ResourceIDBuffer;
+        }
+        else if (BeginsWith(token, "gClientArrays["))
+        {
+            operand.kind    = TraceBytecodeOperandKind::ClientArray;
+            operand.payload = GetTokenOffset(token, "gClientArrays[");
+        }
+        else
+        {
+            memcpy(&operand.payload, &param.value, sizeof(ParamValue));
+        }
+
+        AppendBytes(&function.code, operand);
+    }
+
+    function.callCount++;
+}
+
+void TraceBytecodeWriter::addStringArray(const std::string &name, const TraceString &traceString)
+{
+    TraceBytecodeStringArray stringArray;
+    stringArray.firstEntry = static_cast<uint32_t>(mStringArrayEntries.size());
+    stringArray.entryCount = static_cast<uint32_t>(traceString.strings.size());
+    for (const std::string &str : traceString.strings)
+    {
+        mStringArrayEntries.push_back(addString(str.c_str(), str.size()));
+    }
+
+    mStringArrayIndices[name] = static_cast<uint32_t>(mStringArrays.size());
+    mStringArrays.push_back(stringArray);
+}
+
+uint32_t TraceBytecodeWriter::addString(const char *str, size_t length)
+{
+    std::string key(str, length);
+    auto iter = mStringOffsets.find(key);
+    if (iter != mStringOffsets.end())
+    {
+        return iter->second;
+    }
+
+    uint32_t offset = static_cast<uint32_t>(mStringTable.size());
+    mStringTable.insert(mStringTable.end(), str, str + length);
+    mStringTable.push_back(0);
+    mStringOffsets.emplace(std::move(key), offset);
+    return offset;
+}
+
+uint32_t TraceBytecodeWriter::addFixtureFunction(const std::string &name)
+{
+    auto iter = mFixtureFunctionIndices.find(name);
+    if (iter != mFixtureFunctionIndices.end())
+    {
+        return iter->second;
+    }
+
+    uint32_t index = static_cast<uint32_t>(mFixtureFunctions.size());
+    mFixtureFunctions.push_back(addString(name.c_str(), name.size()));
+    mFixtureFunctionIndices.emplace(name, index);
+    return index;
+}
+
+bool TraceBytecodeWriter::save(const std::string &path)
+{
+    // Calls between functions of the trace are made by index, without looking up their names.
+    std::map<std::string, uint32_t> functionIndices;
+    for (size_t functionIndex = 0; functionIndex < mFunctions.size(); ++functionIndex)
+    {
+        functionIndices[mFunctions[functionIndex].name] = static_cast<uint32_t>(functionIndex);
+    }
+
+    std::vector<TraceBytecodeFunction> functions;
+    std::vector<uint8_t> code;
+    for (Function &function : mFunctions)
+    {
+        for (const std::pair<size_t, std::string> &customCall : function.customCalls)
+        {
+            auto iter = functionIndices.find(customCall.second);
+            if (iter == functionIndices.end())
+            {
+                continue;
+            }
+
+            TraceBytecodeInstruction instruction;
+            memcpy(&instruction, &function.code[customCall.first], sizeof(instruction));
+            ASSERT(instruction.operandCount == 0);
+            instruction.opcode = TraceBytecodeOpcode::CallTraceFunction;
+            instruction.target = iter->second;
+            memcpy(&function.code[customCall.first], &instruction, sizeof(instruction));
+        }
+
+        TraceBytecodeFunction functionRecord;
+        functionRecord.nameOffset = addString(function.name.c_str(), function.name.size());
+        functionRecord.callCount  = function.callCount;
+        functionRecord.codeOffset = code.size();
+        functionRecord.codeSize   = function.code.size();
+        functions.push_back(functionRecord);
+
+        code.insert(code.end(), function.code.begin(), function.code.end());
+    }
+
+    TraceBytecodeHeader header = {};
+    memcpy(header.magic, kTraceBytecodeMagic, sizeof(header.magic));
+    header.version               = kTraceBytecodeVersion;
+    header.entryPointCount       = static_cast<uint32_t>(kEntryPointCount);
+    header.paramTypeCount        = static_cast<uint32_t>(kParamTypeCount);
+    header.functionCount         = static_cast<uint32_t>(functions.size());
+    header.fixtureFunctionCount  = static_cast<uint32_t>(mFixtureFunctions.size());
+    header.stringArrayCount      = static_cast<uint32_t>(mStringArrays.size());
+    header.stringArrayEntryCount = static_cast<uint32_t>(mStringArrayEntries.size());
+
+    std::vector<uint8_t> data(sizeof(header));
+
+    header.functionsOffset = AlignSection(&data);
+    for (const TraceBytecodeFunction &function : functions)
+    {
+        AppendBytes(&data, function);
+    }
+
+    header.fixtureFunctionsOffset = AlignSection(&data);
+    for (uint32_t nameOffset : mFixtureFunctions)
+    {
+        AppendBytes(&data, nameOffset);
+    }
+
+    header.stringArraysOffset = AlignSection(&data);
+    for (const TraceBytecodeStringArray &stringArray : mStringArrays)
+    {
+        AppendBytes(&data, stringArray);
+    }
+
+    header.stringArrayEntriesOffset = AlignSection(&data);
+    for (uint32_t entry : mStringArrayEntries)
+    {
+        AppendBytes(&data, entry);
+    }
+
+    header.stringTableOffset = AlignSection(&data);
+    header.stringTableSize   = mStringTable.size();
+    data.insert(data.end(), mStringTable.begin(), mStringTable.end());
+
+    header.codeOffset = AlignSection(&data);
+    header.codeSize   = code.size();
+    data.insert(data.end(), code.begin(), code.end());
+
+    memcpy(data.data(), &header, sizeof(header));
+
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        printf("Error opening trace bytecode for writing: %s\n", path.c_str());
+        return false;
+    }
+    size_t written = fwrite(data.data(), 1, data.size(), fp);
+    fclose(fp);
+
+    if (written != data.size())
+    {
+        printf("Error writing trace bytecode: %s\n", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+const TraceBytecode::InstructionHandler TraceBytecode::kReplayHandlers[] = {
+    &TraceBytecode::callEntryPoint,
+    &TraceBytecode::callFixtureFunction,
+    &TraceBytecode::callTraceFunction,
+};
+
+const TraceBytecode::InstructionHandler TraceBytecode::kDecodeOnlyHandlers[] = {
+    &TraceBytecode::decodeOnly,
+    &TraceBytecode::decodeOnly,
+    &TraceBytecode::decodeOnly,
+};
+
+TraceBytecode::TraceBytecode() : mCall(EntryPoint::Invalid, ParamBuffer())
+{
+    static_assert(ArraySize(kReplayHandlers) == static_cast<size_t>(TraceBytecodeOpcode::EnumCount),
+                  "Every opcode needs a handler");
+    static_assert(
+        ArraySize(kDecodeOnlyHandlers) == static_cast<size_t>(TraceBytecodeOpcode::EnumCount),
+        "Every opcode needs a handler");
+
+    for (size_t paramIndex = 0; paramIndex < kMaxParameters; ++paramIndex)
+    {
+        mCall.params.addParam(ParamCapture("", ParamType::TGLuint));
+    }
+}
+
+TraceBytecode::~TraceBytecode()
+{
+    unmap();
+}
+
+void TraceBytecode::unmap()
+{
+    if (mMapped)
+    {
+        UnmapFile(mData, mSize);
+    }
+
+    mData   = nullptr;
+    mSize   = 0;
+    mMapped = false;
+    mFileData.clear();
+
+    mHeader      = nullptr;
+    mFunctions   = nullptr;
+    mStringTable = nullptr;
+    mCode        = nullptr;
+    mFunctionIndices.clear();
+    mStringArrays.clear();
+    mBinaryDataEnd = 0;
+    mReadBufferEnd = 0;
+    mFixtureCalls.clear();
+    mFixtureCallInitializesReplay.clear();
+}
+
+bool TraceBytecode::load(const std::string &path)
+{
+    unmap();
+
+    // The bytecode is mapped rather than read, so only the functions that are replayed are paged
+    // in.
+    mData   = MapFileReadOnly(path.c_str(), &mSize);
+    mMapped = mData != nullptr;
+
+    if (!mMapped)
+    {
+        std::string fileData;
+        if (!ReadFileToString(path, &fileData))
+        {
+            printf("Error loading trace bytecode from: %s\n", path.c_str());
+            return false;
+        }
+        mFileData.assign(fileData.begin(), fileData.end());
+        mData = mFileData.data();
+        mSize = mFileData.size();
+    }
+
+    if (!validate())
+    {
+        printf("Invalid trace bytecode: %s\n", path.c_str());
+        unmap();
+        return false;
+    }
+
+    mHeader = reinterpret_cast<const TraceBytecodeHeader *>(mData);
+    mFunctions =
+        reinterpret_cast<const TraceBytecodeFunction *>(mData + mHeader->functionsOffset);
+    mStringTable = reinterpret_cast<const char *>(mData + mHeader->stringTableOffset);
+    mCode        = mData + mHeader->codeOffset;
+
+    for (uint32_t functionIndex = 0; functionIndex < mHeader->functionCount; ++functionIndex)
+    {
+        mFunctionIndices[mStringTable + mFunctions[functionIndex].nameOffset] = functionIndex;
+    }
+
+    // The name of every fixture function is set once, rather than at each call.
+    const uint32_t *fixtureFunctions =
+        reinterpret_cast<const uint32_t *>(mData + mHeader->fixtureFunctionsOffset);
+    mFixtureCalls.reserve(mHeader->fixtureFunctionCount);
+    for (uint32_t fixtureIndex = 0; fixtureIndex < mHeader->fixtureFunctionCount; ++fixtureIndex)
+    {
+        const char *name = mStringTable + fixtureFunctions[fixtureIndex];
+        mFixtureCalls.emplace_back(name, ParamBuffer());
+        for (size_t paramIndex = 0; paramIndex < kMaxParameters; ++paramIndex)
+        {
+            mFixtureCalls.back().params.addParam(ParamCapture("", ParamType::TGLuint));
+        }
+        mFixtureCallInitializesReplay.push_back(BeginsWith(name, "InitializeReplay"));
+    }
+
+    // glShaderSource takes an array of pointers, which can't be stored in the file.
+    const TraceBytecodeStringArray *stringArrays =
+        reinterpret_cast<const TraceBytecodeStringArray *>(mData + mHeader->stringArraysOffset);
+    const uint32_t *stringArrayEntries =
+        reinterpret_cast<const uint32_t *>(mData + mHeader->stringArrayEntriesOffset);
+    mStringArrays.resize(mHeader->stringArrayCount);
+    for (uint32_t arrayIndex = 0; arrayIndex < mHeader->stringArrayCount; ++arrayIndex)
+    {
+        const TraceBytecodeStringArray &stringArray = stringArrays[arrayIndex];
+        for (uint32_t entry = 0; entry < stringArray.entryCount; ++entry)
+        {
+            uint32_t stringOffset = stringArrayEntries[stringArray.firstEntry + entry];
+            mStringArrays[arrayIndex].push_back(mStringTable + stringOffset);
+        }
+    }
+
+    return true;
+}
+
+bool TraceBytecode::validate()
+{
+    if (mSize < sizeof(TraceBytecodeHeader))
+    {
+        return false;
+    }
+
+    const TraceBytecodeHeader *header = reinterpret_cast<const TraceBytecodeHeader *>(mData);
+    if (memcmp(header->magic, kTraceBytecodeMagic, sizeof(header->magic)) != 0 ||
+        header->version != kTraceBytecodeVersion)
+    {
+        return false;
+    }
+
+    // Entry points and parameter types are stored by value, so they must be numbered the same as
+    // when the bytecode was compiled.
+    if (header->entryPointCount != kEntryPointCount || header->paramTypeCount != kParamTypeCount)
+    {
+        return false;
+    }
+
+    if (!IsRangeInFile(header->functionsOffset,
+                       header->functionCount * sizeof(TraceBytecodeFunction), mSize) ||
+        !IsRangeInFile(header->fixtureFunctionsOffset,
+                       header->fixtureFunctionCount * sizeof(uint32_t), mSize) ||
+        !IsRangeInFile(header->stringArraysOffset,
+                       header->stringArrayCount * sizeof(TraceBytecodeStringArray), mSize) ||
+        !IsRangeInFile(header->stringArrayEntriesOffset,
+                       header->stringArrayEntryCount * sizeof(uint32_t), mSize) ||
+        !IsRangeInFile(header->stringTableOffset, header->stringTableSize, mSize) ||
+        !IsRangeInFile(header->codeOffset, header->codeSize, mSize))
+    {
+        return false;
+    }
+
+    // Every string ends before the end of the table.
+    const char *stringTable = reinterpret_cast<const char *>(mData + header->stringTableOffset);
+    if (header->stringTableSize == 0 || stringTable[header->stringTableSize - 1] != 0)
+    {
+        return false;
+    }
+
+    const uint32_t *fixtureFunctions =
+        reinterpret_cast<const uint32_t *>(mData + header->fixtureFunctionsOffset);
+    for (uint32_t fixtureIndex = 0; fixtureIndex < header->fixtureFunctionCount; ++fixtureIndex)
+    {
+        if (fixtureFunctions[fixtureIndex] >= header->stringTableSize)
+        {
+            return false;
+        }
+    }
+
+    const uint32_t *stringArrayEntries =
+        reinterpret_cast<const uint32_t *>(mData + header->stringArrayEntriesOffset);
+    for (uint32_t entry = 0; entry < header->stringArrayEntryCount; ++entry)
+    {
+        if (stringArrayEntries[entry] >= header->stringTableSize)
+        {
+            return false;
+        }
+    }
+
+    const TraceBytecodeStringArray *stringArrays =
+        reinterpret_cast<const TraceBytecodeStringArray *>(mData + header->stringArraysOffset);
+    for (uint32_t arrayIndex = 0; arrayIndex < header->stringArrayCount; ++arrayIndex)
+    {
+        const TraceBytecodeStringArray &stringArray = stringArrays[arrayIndex];
+        if (stringArray.firstEntry > header->stringArrayEntryCount ||
+            stringArray.entryCount > header->stringArrayEntryCount - stringArray.firstEntry)
+        {
+            return false;
+        }
+    }
+
+    // Check every instruction once, so they can be run without bounds checks.
+    const TraceBytecodeFunction *functions =
+        reinterpret_cast<const TraceBytecodeFunction *>(mData + header->functionsOffset);
+    const uint8_t *code = mData + header->codeOffset;
+    for (uint32_t functionIndex = 0; functionIndex < header->functionCount; ++functionIndex)
+    {
+        const TraceBytecodeFunction &function = functions[functionIndex];
+        if (function.nameOffset >= header->stringTableSize ||
+            !IsRangeInFile(function.codeOffset, function.codeSize, header->codeSize))
+        {
+            return false;
+        }
+
+        size_t offset = function.codeOffset;
+        size_t end    = function.codeOffset + function.codeSize;
+        while (offset < end)
+        {
+            if (end - offset < sizeof(TraceBytecodeInstruction))
+            {
+                return false;
+            }
+
+            const TraceBytecodeInstruction *instruction =
+                reinterpret_cast<const TraceBytecodeInstruction *>(code + offset);
+            offset += sizeof(TraceBytecodeInstruction);
+
+            size_t operandsSize = instruction->operandCount * sizeof(TraceBytecodeOperand);
+            if (end - offset < operandsSize ||
+                !validateInstruction(*instruction,
+                                     reinterpret_cast<const TraceBytecodeOperand *>(code + offset)))
+            {
+                return false;
+            }
+            offset += operandsSize;
+        }
+    }
+
+    return true;
+}
+
+bool TraceBytecode::validateInstruction(const TraceBytecodeInstruction &instruction,
+                                        const TraceBytecodeOperand *operands)
+{
+    const TraceBytecodeHeader *header = reinterpret_cast<const TraceBytecodeHeader *>(mData);
+
+    if (instruction.operandCount > kMaxParameters)
+    {
+        return false;
+    }
+
+    switch (instruction.opcode)
+    {
+        case TraceBytecodeOpcode::CallEntryPoint:
+            if (instruction.target >= kEntryPointCount)
+            {
+                return false;
+            }
+            break;
+        case TraceBytecodeOpcode::CallFixtureFunction:
+            if (instruction.target >= header->fixtureFunctionCount)
+            {
+                return false;
+            }
+            break;
+        case TraceBytecodeOpcode::CallTraceFunction:
+            if (instruction.target >= header->functionCount || instruction.operandCount != 0)
+            {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+
+    for (uint8_t operandIndex = 0; operandIndex < instruction.operandCount; ++operandIndex)
+    {
+        const TraceBytecodeOperand &operand = operands[operandIndex];
+        if (static_cast<uint32_t>(operand.type) >= kParamTypeCount)
+        {
+            return false;
+        }
+
+        switch (operand.kind)
+        {
+            case TraceBytecodeOperandKind::Immediate:
+            case TraceBytecodeOperandKind::ResourceIDBuffer:
+                break;
+            // The sizes of these buffers are only known once the replay is initialized, so the
+            // offsets are checked by validateBufferOffsets().
+            case TraceBytecodeOperandKind::BinaryData:
+                mBinaryDataEnd = std::max(mBinaryDataEnd, operand.payload + 1);
+                break;
+            case TraceBytecodeOperandKind::ReadBuffer:
+                mReadBufferEnd = std::max(mReadBufferEnd, operand.payload + 1);
+                break;
+            case TraceBytecodeOperandKind::ClientArray:
+                if (operand.payload >= kMaxClientArrays)
+                {
+                    return false;
+                }
+                break;
+            case TraceBytecodeOperandKind::String:
+                if (operand.payload >= header->stringTableSize)
+                {
+                    return false;
+                }
+                break;
+            case TraceBytecodeOperandKind::StringArray:
+                if (operand.payload >= header->stringArrayCount)
+                {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool TraceBytecode::validateBufferOffsets() const
+{
+    return mBinaryDataEnd <= gBinaryDataSize && mReadBufferEnd <= gReadBufferSize;
+}
+
+bool TraceBytecode::hasFunction(const char *name) const
+{
+    return mFunctionIndices.count(name) != 0;
+}
+
+void TraceBytecode::replayFunction(const char *name)
+{
+    auto iter = mFunctionIndices.find(name);
+    if (iter == mFunctionIndices.end())
+    {
+        printf("Cannot find function: %s\n", name);
+        UNREACHABLE();
+        return;
+    }
+
+    runFunction(iter->second, kReplayHandlers);
+}
+
+double TraceBytecode::measureCallOverheadNs()
+{
+    uint64_t callCount = 0;
+    for (uint32_t functionIndex = 0; functionIndex < mHeader->functionCount; ++functionIndex)
+    {
+        callCount += mFunctions[functionIndex].callCount;
+    }
+    if (callCount == 0)
+    {
+        return 0.0;
+    }
+
+    double startTime = GetCurrentSystemTime();
+    for (uint32_t functionIndex = 0; functionIndex < mHeader->functionCount; ++functionIndex)
+    {
+        runFunction(functionIndex, kDecodeOnlyHandlers);
+    }
+    double elapsedTime = GetCurrentSystemTime() - startTime;
+
+    return elapsedTime * 1e9 / static_cast<double>(callCount);
+}
+
+void TraceBytecode::runFunction(uint32_t functionIndex, const InstructionHandler *handlers)
+{
+    const TraceBytecodeFunction &function = mFunctions[functionIndex];
+
+    const uint8_t *pc  = mCode + function.codeOffset;
+    const uint8_t *end = pc + function.codeSize;
+    while (pc < end)
+    {
+        const TraceBytecodeInstruction *instruction =
+            reinterpret_cast<const TraceBytecodeInstruction *>(pc);
+        const TraceBytecodeOperand *operands =
+            reinterpret_cast<const TraceBytecodeOperand *>(instruction + 1);
+
+        (this->*handlers[static_cast<size_t>(instruction->opcode)])(*instruction, operands);
+
+        pc = reinterpret_cast<const uint8_t *>(operands + instruction->operandCount);
+    }
+}
+
+void TraceBytecode::decodeOperands(const TraceBytecodeInstruction &instruction,
+                                   const TraceBytecodeOperand *operands,
+                                   CallCapture *call)
+{
+    std::vector<ParamCapture> &captures = call->params.getParamCaptures();
+
+    for (uint8_t operandIndex = 0; operandIndex < instruction.operandCount; ++operandIndex)
+    {
+        const TraceBytecodeOperand &operand = operands[operandIndex];
+        ParamCapture &capture               = captures[operandIndex];
+
+        capture.type = operand.type;
+        switch (operand.kind)
+        {
+            case TraceBytecodeOperandKind::Immediate:
+                memcpy(static_cast<void *>(&capture.value), &operand.payload, sizeof(ParamValue));
+                break;
+            case TraceBytecodeOperandKind::BinaryData:
+                SetPointerValue(&capture, gBinaryData + operand.payload);
+                break;
+            case TraceBytecodeOperandKind::ReadBuffer:
+                SetPointerValue(&capture, gReadBuffer + operand.payload);
+                break;
+            case TraceBytecodeOperandKind::ClientArray:
+                SetPointerValue(&capture, gClientArrays[operand.payload]);
+                break;
+            case TraceBytecodeOperandKind::ResourceIDBuffer:
+                SetPointerValue(&capture, gResourceIDBuffer);
+                break;
+            case TraceBytecodeOperandKind::String:
+                SetPointerValue(&capture, mStringTable + operand.payload);
+                break;
+            case TraceBytecodeOperandKind::StringArray:
+                SetPointerValue(&capture, mStringArrays[operand.payload].data());
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+    }
+}
+
+void TraceBytecode::callEntryPoint(const TraceBytecodeInstruction &instruction,
+                                   const TraceBytecodeOperand *operands)
+{
+    decodeOperands(instruction, operands, &mCall);
+    mCall.entryPoint = static_cast<EntryPoint>(instruction.target);
+    ReplayTraceFunctionCall(mCall, mNoTraceFunctions);
+    mReplayedCallCount++;
+}
+
+void TraceBytecode::callFixtureFunction(const TraceBytecodeInstruction &instruction,
+                                        const TraceBytecodeOperand *operands)
+{
+    CallCapture &call = mFixtureCalls[instruction.target];
+    decodeOperands(instruction, operands, &call);
+    ReplayCustomFunctionCall(call, mNoTraceFunctions);
+    mReplayedCallCount++;
+
+    if (mFixtureCallInitializesReplay[instruction.target] && !validateBufferOffsets())
+    {
+        printf("Trace bytecode reads past the end of the replay's buffers.\n");
+        exit(1);
+    }
+}
+
+void TraceBytecode::callTraceFunction(const TraceBytecodeInstruction &instruction,
+                                      const TraceBytecodeOperand *operands)
+{
+    runFunction(instruction.target, kReplayHandlers);
+}
+
+void TraceBytecode::decodeOnly(const TraceBytecodeInstruction &instruction,
+                               const TraceBytecodeOperand *operands)
+{
+    decodeOperands(instruction, operands, &mCall);
+}
+}  // namespace angle
@@ -0,0 +1,243 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// trace_bytecode.h:
+//   Compact binary form of the C-based replays. The trace interpreter compiles the parsed replay
+//   functions to bytecode once, and can then map it and run it without tokenizing anything.
+//
+
+#ifndef ANGLE_TRACE_BYTECODE_H_
+#define ANGLE_TRACE_BYTECODE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "trace_interpreter.h"
+
+namespace angle
+{
+// The file starts with a TraceBytecodeHeader, followed by the functions, the fixture functions,
+// the string arrays, the string array entries, the string table and the code. All the offsets are
+// in bytes from the start of the file, and every section is 8-byte aligned. Entry points and
+// parameter types are stored by value, so the header records how many of them the compiler knew,
+// and bytecode compiled by another revision is rejected.
+constexpr char kTraceBytecodeMagic[8]    = {'A', 'N', 'G', 'L', 'E', 'T', 'B', 'C'};
+constexpr uint32_t kTraceBytecodeVersion = 2;
+
+struct TraceBytecodeHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t entryPointCount;
+    uint32_t paramTypeCount;
+    uint32_t functionCount;
+    uint32_t fixtureFunctionCount;
+    uint32_t stringArrayCount;
+    uint32_t stringArrayEntryCount;
+    uint32_t padding;
+    uint64_t functionsOffset;
+    // Each fixture function is the offset of its name in the string table.
+    uint64_t fixtureFunctionsOffset;
+    uint64_t stringArraysOffset;
+    uint64_t stringArrayEntriesOffset;
+    uint64_t stringTableOffset;
+    uint64_t stringTableSize;
+    uint64_t codeOffset;
+    uint64_t codeSize;
+};
+
+struct TraceBytecodeFunction
+{
+    // Offset of the name in the string table.
+    uint32_t nameOffset;
+    uint32_t callCount;
+    // Range of the function's instructions in the code.
+    uint64_t codeOffset;
+    uint64_t codeSize;
+};
+
+// A string array is a range of string array entries, each the offset of a string in the string
+// table. They hold the sources passed to glShaderSource and glTransformFeedbackVaryings.
+struct TraceBytecodeStringArray
+{
+    uint32_t firstEntry;
+    uint32_t entryCount;
+};
+
+enum class TraceBytecodeOpcode : uint8_t
+{
+    // Calls a GL or EGL entry point. The target is the EntryPoint.
+    CallEntryPoint,
+    // Calls a function of the trace fixture, such as CreateContext. The target is the index of
+    // the fixture function.
+    CallFixtureFunction,
+    // Calls another function of the trace. The target is the index of the function.
+    CallTraceFunction,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+// Every instruction is followed by its operands.
+struct TraceBytecodeInstruction
+{
+    TraceBytecodeOpcode opcode;
+    uint8_t operandCount;
+    uint16_t padding;
+    uint32_t target;
+};
+
+// How the payload of an operand turns into the value of the parameter.
+enum class TraceBytecodeOperandKind : uint32_t
+{
+    // The payload holds the ParamValue.
+    Immediate,
+    // The payload is an offset in gBinaryData or gReadBuffer.
+    BinaryData,
+    ReadBuffer,
+    // The payload is an index in gClientArrays.
+    ClientArray,
+    // gResourceIDBuffer, the payload is unused.
+    ResourceIDBuffer,
+    // The payload is the offset of a string in the string table.
+    String,
+    // The payload is the index of a string array.
+    StringArray,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+struct TraceBytecodeOperand
+{
+    ParamType type;
+    TraceBytecodeOperandKind kind;
+    uint64_t payload;
+};
+
+static_assert(sizeof(TraceBytecodeInstruction) == 8, "Instructions must stay 8-byte aligned");
+static_assert(sizeof(TraceBytecodeOperand) == 16, "Operands must stay 8-byte aligned");
+static_assert(sizeof(ParamValue) <= sizeof(uint64_t), "Immediate operands must fit the payload");
+
+// Collects the functions of a trace while it is parsed, and writes them as bytecode.
+class TraceBytecodeWriter : angle::NonCopyable
+{
+  public:
+    TraceBytecodeWriter();
+    ~TraceBytecodeWriter();
+
+    void beginFunction(const std::string &name);
+    // |paramTokens| are the tokens the parameters of |call| were parsed from. They tell apart the
+    // pointers to the replay's buffers, which are only known once the trace is running.
+    void addCall(const CallCapture &call, const Token *paramTokens);
+
+    void addStringArray(const std::string &name, const TraceString &traceString);
+
+    // Resolves the calls between functions of the trace and writes the bytecode to |path|.
+    bool save(const std::string &path);
+
+  private:
+    struct Function
+    {
+        std::string name;
+        uint32_t callCount = 0;
+        std::vector<uint8_t> code;
+        // Offsets in |code| of the custom calls, with the names of the functions they call.
+        std::vector<std::pair<size_t, std::string>> customCalls;
+    };
+
+    uint32_t addString(const char *str, size_t length);
+    uint32_t addFixtureFunction(const std::string &name);
+
+    std::vector<Function> mFunctions;
+    std::vector<uint32_t> mFixtureFunctions;
+    std::map<std::string, uint32_t> mFixtureFunctionIndices;
+    std::vector<char> mStringTable;
+    std::map<std::string, uint32_t> mStringOffsets;
+    std::vector<TraceBytecodeStringArray> mStringArrays;
+    std::vector<uint32_t> mStringArrayEntries;
+    std::map<std::string, uint32_t> mStringArrayIndices;
+};
+
+// Bytecode mapped in memory, and the interpreter running it.
+class TraceBytecode : angle::NonCopyable
+{
+  public:
+    TraceBytecode();
+    ~TraceBytecode();
+
+    // Maps the bytecode at |path| and checks that every instruction and operand is in bounds. The
+    // offsets in the replay's buffers are checked once InitializeReplay has allocated them.
+    bool load(const std::string &path);
+
+    bool hasFunction(const char *name) const;
+    void replayFunction(const char *name);
+
+    // Returns the average time it takes to decode and dispatch a call, without making it. This is
+    // the overhead the interpreter adds to every call of the replay.
+    double measureCallOverheadNs();
+
+    uint64_t getReplayedCallCount() const { return mReplayedCallCount; }
+
+  private:
+    using InstructionHandler = void (TraceBytecode::*)(const TraceBytecodeInstruction &,
+                                                       const TraceBytecodeOperand *);
+
+    void unmap();
+    bool validate();
+    bool validateInstruction(const TraceBytecodeInstruction &instruction,
+                             const TraceBytecodeOperand *operands);
+
+    bool validateBufferOffsets() const;
+
+    void runFunction(uint32_t functionIndex, const InstructionHandler *handlers);
+    void decodeOperands(const TraceBytecodeInstruction &instruction,
+                        const TraceBytecodeOperand *operands,
+                        CallCapture *call);
+
+    void callEntryPoint(const TraceBytecodeInstruction &instruction,
+                        const TraceBytecodeOperand *operands);
+    void callFixtureFunction(const TraceBytecodeInstruction &instruction,
+                             const TraceBytecodeOperand *operands);
+    void callTraceFunction(const TraceBytecodeInstruction &instruction,
+                           const TraceBytecodeOperand *operands);
+    void decodeOnly(const TraceBytecodeInstruction &instruction,
+                    const TraceBytecodeOperand *operands);
+
+    static const InstructionHandler kReplayHandlers[];
+    static const InstructionHandler kDecodeOnlyHandlers[];
+
+    const uint8_t *mData = nullptr;
+    size_t mSize         = 0;
+    bool mMapped         = false;
+    std::vector<uint8_t> mFileData;
+
+    const TraceBytecodeHeader *mHeader      = nullptr;
+    const TraceBytecodeFunction *mFunctions = nullptr;
+    const char *mStringTable                = nullptr;
+    const uint8_t *mCode                    = nullptr;
+    std::map<std::string, uint32_t> mFunctionIndices;
+    std::vector<std::vector<const char *>> mStringArrays;
+
+    // Past the largest offset of the operands in gBinaryData and gReadBuffer, or 0 if there are
+    // none.
+    uint64_t mBinaryDataEnd = 0;
+    uint64_t mReadBufferEnd = 0;
+
+    // The calls to entry points are decoded into |mCall|, and the calls to each fixture function
+    // into its own capture, which already holds its name. They all hold kMaxParameters parameters
+    // so replaying never allocates.
+    CallCapture mCall;
+    std::vector<CallCapture> mFixtureCalls;
+    // Whether each fixture function allocates the replay's buffers.
+    std::vector<bool> mFixtureCallInitializesReplay;
+    // Calls between functions of the trace are resolved by the compiler.
+    const TraceFunctionMap mNoTraceFunctions;
+    uint64_t mReplayedCallCount = 0;
+};
+}  // namespace angle
+
+#endif  // ANGLE_TRACE_BYTECODE_H_
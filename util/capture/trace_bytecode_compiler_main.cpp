@@ -0,0 +1,66 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// trace_bytecode_compiler_main.cpp:
+//   Compiles a C-based replay to the bytecode run by the trace interpreter. Usage:
+//
+//     angle_trace_bytecode_compiler <trace> <trace_dir> <output> [<trace_gz>]
+//
+//   The trace tests look for the bytecode of a trace in gen/tracebc_<trace>.bin when run with
+//   --trace-interpreter=bytecode.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+#include "common/system_utils.h"
+#include "frame_capture_test_utils.h"
+
+int main(int argc, char **argv)
+{
+    if (argc != 4 && argc != 5)
+    {
+        fprintf(stderr, "Usage: %s <trace> <trace_dir> <output> [<trace_gz>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::string traceName = argv[1];
+    const std::string traceDir  = argv[2];
+    const char *outputPath      = argv[3];
+
+    std::string traceJsonPath = traceDir + angle::GetPathSeparator() + traceName + ".json";
+
+    angle::TraceInfo traceInfo = {};
+    if (!angle::LoadTraceInfoFromJSON(traceName, traceJsonPath, &traceInfo))
+    {
+        fprintf(stderr, "Could not load trace info from %s\n", traceJsonPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    // The binary data of the trace is loaded through the library, as during a replay.
+    angle::TraceLibrary traceLibrary("angle_trace_interpreter", traceInfo, "");
+    if (!traceLibrary.valid())
+    {
+        fprintf(stderr, "Could not load the trace interpreter\n");
+        return EXIT_FAILURE;
+    }
+
+    traceLibrary.setBinaryDataDir(traceDir.c_str());
+    if (argc == 5)
+    {
+        traceLibrary.setTraceGzPath(argv[4]);
+    }
+
+    double startTime = angle::GetCurrentSystemTime();
+    if (!traceLibrary.compileTraceBytecode(outputPath))
+    {
+        return EXIT_FAILURE;
+    }
+
+    printf("Compiled %s to %s in %.3f seconds.\n", traceName.c_str(), outputPath,
+           angle::GetCurrentSystemTime() - startTime);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,229 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// trace_bytecode_unittest.cpp:
+//   Tests that the bytecode of the C-based replays loads back, and that corrupted bytecode is
+//   rejected before it runs.
+//
+
+#include "gtest/gtest.h"
+
+#include "common/string_utils.h"
+#include "common/system_utils.h"
+#include "trace_bytecode.h"
+#include "trace_fixture.h"
+
+#include <cstdio>
+#include <functional>
+
+using namespace angle;
+
+namespace
+{
+class TraceBytecodeTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        Optional<std::string> path = CreateTemporaryFile();
+        ASSERT_TRUE(path.valid());
+        mPath = path.value();
+
+        // SetupReplay binds an attribute name, sets a client array pointer, calls the fixture
+        // and calls ReplayFrame1, which draws.
+        TraceBytecodeWriter writer;
+        writer.beginFunction("SetupReplay");
+        addCall(&writer, EntryPoint::GLBindAttribLocation,
+                {{ParamType::TGLuint, "1"}, {ParamType::TGLuint, "0"}},
+                ParamType::TGLcharConstPointer, "\"position\"");
+        addCall(&writer, EntryPoint::GLVertexAttribPointer,
+                {{ParamType::TGLuint, "0"},
+                 {ParamType::TGLint, "4"},
+                 {ParamType::TGLenum, "GL_FLOAT"},
+                 {ParamType::TGLboolean, "GL_FALSE"},
+                 {ParamType::TGLsizei, "0"}},
+                ParamType::TvoidConstPointer, "gClientArrays[3]");
+        addCustomCall(&writer, "CreateContext", {{ParamType::TGLuint, "1"}});
+        addCustomCall(&writer, "ReplayFrame1", {});
+
+        writer.beginFunction("ReplayFrame1");
+        addCall(&writer, EntryPoint::GLDrawArrays,
+                {{ParamType::TGLenum, "GL_TRIANGLES"}, {ParamType::TGLint, "0"}},
+                ParamType::TGLsizei, "3");
+
+        ASSERT_TRUE(writer.save(mPath));
+
+        std::string fileData;
+        ASSERT_TRUE(ReadFileToString(mPath, &fileData));
+        mData.assign(fileData.begin(), fileData.end());
+    }
+
+    void TearDown() override { std::remove(mPath.c_str()); }
+
+    using Params = std::vector<std::pair<ParamType, const char *>>;
+
+    // The last parameter is passed separately, as it is where the strings and the pointers to the
+    // replay's buffers go.
+    void addCall(TraceBytecodeWriter *writer,
+                 EntryPoint entryPoint,
+                 const Params &params,
+                 ParamType lastType,
+                 const char *lastToken)
+    {
+        CallCapture call(entryPoint, ParamBuffer());
+        std::vector<Token> tokens(params.size() + 1);
+        for (size_t paramIndex = 0; paramIndex < params.size(); ++paramIndex)
+        {
+            call.params.addParam(ParamCapture("", params[paramIndex].first));
+            snprintf(tokens[paramIndex], kMaxTokenSize, "%s", params[paramIndex].second);
+        }
+
+        ParamCapture last("last", lastType);
+        if (lastToken[0] == '"')
+        {
+            std::string str(lastToken + 1, strlen(lastToken) - 2);
+            last.data.emplace_back(str.begin(), str.end());
+            last.data.back().push_back(0);
+        }
+        call.params.addParam(std::move(last));
+        snprintf(tokens.back(), kMaxTokenSize, "%s", lastToken);
+
+        writer->addCall(call, tokens.data());
+    }
+
+    void addCustomCall(TraceBytecodeWriter *writer, const char *name, const Params &params)
+    {
+        CallCapture call(name, ParamBuffer());
+        std::vector<Token> tokens(params.size());
+        for (size_t paramIndex = 0; paramIndex < params.size(); ++paramIndex)
+        {
+            call.params.addParam(ParamCapture("", params[paramIndex].first));
+            snprintf(tokens[paramIndex], kMaxTokenSize, "%s", params[paramIndex].second);
+        }
+
+        writer->addCall(call, tokens.data());
+    }
+
+    static std::vector<TraceBytecodeInstruction *> GetInstructions(std::vector<uint8_t> *data)
+    {
+        const TraceBytecodeHeader *header =
+            reinterpret_cast<const TraceBytecodeHeader *>(data->data());
+
+        std::vector<TraceBytecodeInstruction *> instructions;
+        size_t offset = header->codeOffset;
+        while (offset < header->codeOffset + header->codeSize)
+        {
+            TraceBytecodeInstruction *instruction =
+                reinterpret_cast<TraceBytecodeInstruction *>(&(*data)[offset]);
+            instructions.push_back(instruction);
+            offset += sizeof(*instruction) +
+                      instruction->operandCount * sizeof(TraceBytecodeOperand);
+        }
+        return instructions;
+    }
+
+    // Applies |corrupt| to a copy of the saved bytecode, and returns whether the copy loads.
+    bool loadCorrupted(
+        const std::function<void(TraceBytecodeHeader *,
+                                 const std::vector<TraceBytecodeInstruction *> &)> &corrupt)
+    {
+        std::vector<uint8_t> data = mData;
+        corrupt(reinterpret_cast<TraceBytecodeHeader *>(data.data()), GetInstructions(&data));
+
+        FILE *fp = fopen(mPath.c_str(), "wb");
+        EXPECT_NE(nullptr, fp);
+        fwrite(data.data(), 1, data.size(), fp);
+        fclose(fp);
+
+        TraceBytecode bytecode;
+        return bytecode.load(mPath);
+    }
+
+    static TraceBytecodeOperand *GetOperand(TraceBytecodeInstruction *instruction, size_t index)
+    {
+        return reinterpret_cast<TraceBytecodeOperand *>(instruction + 1) + index;
+    }
+
+    std::string mPath;
+    std::vector<uint8_t> mData;
+};
+
+// Test that the saved bytecode loads back with all its functions, and that every call decodes.
+TEST_F(TraceBytecodeTest, RoundTrip)
+{
+    TraceBytecode bytecode;
+    ASSERT_TRUE(bytecode.load(mPath));
+
+    EXPECT_TRUE(bytecode.hasFunction("SetupReplay"));
+    EXPECT_TRUE(bytecode.hasFunction("ReplayFrame1"));
+    EXPECT_FALSE(bytecode.hasFunction("ReplayFrame2"));
+    EXPECT_GE(bytecode.measureCallOverheadNs(), 0.0);
+
+    // Rewriting the bytecode unchanged keeps it valid.
+    EXPECT_TRUE(loadCorrupted(
+        [](TraceBytecodeHeader *, const std::vector<TraceBytecodeInstruction *> &) {}));
+
+    // The call to ReplayFrame1 is resolved to the trace function, the one to CreateContext isn't.
+    std::vector<TraceBytecodeInstruction *> instructions = GetInstructions(&mData);
+    ASSERT_EQ(5u, instructions.size());
+    EXPECT_EQ(TraceBytecodeOpcode::CallEntryPoint, instructions[0]->opcode);
+    EXPECT_EQ(TraceBytecodeOperandKind::String, GetOperand(instructions[0], 2)->kind);
+    EXPECT_EQ(TraceBytecodeOperandKind::ClientArray, GetOperand(instructions[1], 5)->kind);
+    EXPECT_EQ(3u, GetOperand(instructions[1], 5)->payload);
+    EXPECT_EQ(TraceBytecodeOpcode::CallFixtureFunction, instructions[2]->opcode);
+    EXPECT_EQ(TraceBytecodeOpcode::CallTraceFunction, instructions[3]->opcode);
+    EXPECT_EQ(1u, instructions[3]->target);
+    EXPECT_EQ(static_cast<uint32_t>(EntryPoint::GLDrawArrays), instructions[4]->target);
+}
+
+// Test that bytecode calling an entry point that doesn't exist is rejected.
+TEST_F(TraceBytecodeTest, RejectsInvalidEntryPoint)
+{
+    EXPECT_FALSE(loadCorrupted(
+        [](TraceBytecodeHeader *, const std::vector<TraceBytecodeInstruction *> &instructions) {
+            instructions[4]->target = static_cast<uint32_t>(kEntryPointCount);
+        }));
+}
+
+// Test that bytecode calling a fixture function that doesn't exist is rejected.
+TEST_F(TraceBytecodeTest, RejectsInvalidFixtureFunction)
+{
+    EXPECT_FALSE(loadCorrupted([](TraceBytecodeHeader *header,
+                                  const std::vector<TraceBytecodeInstruction *> &instructions) {
+        instructions[2]->target = header->fixtureFunctionCount;
+    }));
+}
+
+// Test that bytecode reading past the client arrays is rejected.
+TEST_F(TraceBytecodeTest, RejectsInvalidClientArray)
+{
+    EXPECT_FALSE(loadCorrupted(
+        [](TraceBytecodeHeader *, const std::vector<TraceBytecodeInstruction *> &instructions) {
+            GetOperand(instructions[1], 5)->payload = kMaxClientArrays;
+        }));
+}
+
+// Test that bytecode reading past the string table is rejected.
+TEST_F(TraceBytecodeTest, RejectsInvalidString)
+{
+    EXPECT_FALSE(loadCorrupted([](TraceBytecodeHeader *header,
+                                  const std::vector<TraceBytecodeInstruction *> &instructions) {
+        GetOperand(instructions[0], 2)->payload = header->stringTableSize;
+    }));
+}
+
+// Test that bytecode compiled with different entry points or parameter types is rejected.
+TEST_F(TraceBytecodeTest, RejectsOtherRevision)
+{
+    EXPECT_FALSE(loadCorrupted(
+        [](TraceBytecodeHeader *header, const std::vector<TraceBytecodeInstruction *> &) {
+            header->entryPointCount++;
+        }));
+    EXPECT_FALSE(loadCorrupted(
+        [](TraceBytecodeHeader *header, const std::vector<TraceBytecodeInstruction *> &) {
+            header->paramTypeCount++;
+        }));
+}
+}  // anonymous namespace
@@ -70,8 +70,6 @@ EGLClientBuffer GetClientBuffer(EGLenum target, uintptr_t key)
 
 ValidateSerializedStateCallback gValidateSerializedStateCallback;
 std::unordered_map<GLuint, std::vector<GLint>> gInternalUniformLocationsMap;
-
-constexpr size_t kMaxClientArrays = 16;
 }  // namespace
 
 GLint **gUniformLocations;
@@ -133,8 +131,10 @@ void UpdateCurrentProgramPerContext(GLuint program)
 }
 
 uint8_t *gBinaryData;
+size_t gBinaryDataSize;
 angle::FrameCaptureBinaryData *gFrameCaptureBinaryData;
 uint8_t *gReadBuffer;
+size_t gReadBufferSize;
 uint8_t *gClientArrays[kMaxClientArrays];
 GLuint *gResourceIDBuffer;
 SyncResourceMap gSyncMap;
@@ -340,7 +340,8 @@ void InitializeReplay(const char *binaryDataFileName,
 {
     if (!gFrameCaptureBinaryData)
     {
-        gBinaryData = gTraceCallbacks->LoadBinaryData(binaryDataFileName);
+        gBinaryData     = gTraceCallbacks->LoadBinaryData(binaryDataFileName);
+        gBinaryDataSize = gTraceCallbacks->GetBinaryDataSize();
     }
 
     for (uint8_t *&clientArray : gClientArrays)
@@ -348,7 +349,8 @@ void InitializeReplay(const char *binaryDataFileName,
         clientArray = new uint8_t[maxClientArraySize];
     }
 
-    gReadBuffer = new uint8_t[readBufferSize];
+    gReadBuffer     = new uint8_t[readBufferSize];
+    gReadBufferSize = readBufferSize;
 
     gBufferMap            = AllocateZeroedUints(maxBuffer);
     gFenceNVMap           = AllocateZeroedUints(maxFenceNV);
@@ -427,6 +429,7 @@ void SetValidateSerializedStateCallback(ValidateSerializedStateCallback callback
 
 angle::TraceInfo gTraceInfo;
 std::string gTraceGzPath;
+std::string gTraceBytecodePath;
 
 struct TraceFunctionsImpl : angle::TraceFunctions
 {
@@ -450,6 +453,11 @@ struct TraceFunctionsImpl : angle::TraceFunctions
     void SetTraceInfo(const angle::TraceInfo &traceInfo) override { gTraceInfo = traceInfo; }
 
     void SetTraceGzPath(const std::string &traceGzPath) override { gTraceGzPath = traceGzPath; }
+
+    void SetTraceBytecodePath(const std::string &traceBytecodePath) override
+    {
+        gTraceBytecodePath = traceBytecodePath;
+    }
 };
 
 TraceFunctionsImpl gTraceFunctionsImpl;
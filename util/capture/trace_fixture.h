@@ -47,6 +47,7 @@ extern ContextMap gContextMap;
 extern std::string gBinaryDataDir;
 extern angle::TraceInfo gTraceInfo;
 extern std::string gTraceGzPath;
+extern std::string gTraceBytecodePath;
 
 using ValidateSerializedStateCallback = void (*)(const char *, const char *, uint32_t);
 
@@ -86,9 +87,13 @@ void UpdateCurrentProgramPerContext(GLuint program);
 
 // Global state
 
+constexpr size_t kMaxClientArrays = 16;
+
 extern uint8_t *gBinaryData;
+extern size_t gBinaryDataSize;
 extern uint8_t *gReadBuffer;
-extern uint8_t *gClientArrays[];
+extern size_t gReadBufferSize;
+extern uint8_t *gClientArrays[kMaxClientArrays];
 extern GLuint *gResourceIDBuffer;
 
 extern GLuint *gBufferMap;
@@ -140,6 +140,7 @@ void FinishReplay()
 
 angle::TraceInfo gTraceInfo;
 std::string gTraceGzPath;
+std::string gTraceBytecodePath;
 
 struct TraceFunctionsImplCL : angle::TraceFunctions
 {
@@ -163,6 +164,11 @@ struct TraceFunctionsImplCL : angle::TraceFunctions
     void SetTraceInfo(const angle::TraceInfo &traceInfo) override { gTraceInfo = traceInfo; }
 
     void SetTraceGzPath(const std::string &traceGzPath) override { gTraceGzPath = traceGzPath; }
+
+    void SetTraceBytecodePath(const std::string &traceBytecodePath) override
+    {
+        gTraceBytecodePath = traceBytecodePath;
+    }
 };
 
 TraceFunctionsImplCL gTraceFunctionsImpl;
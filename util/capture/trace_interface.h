@@ -62,6 +62,18 @@ struct TraceInfo
     std::vector<int> keyFrames;
 };
 
+// Returned by the trace interpreter.
+struct TraceInterpreterStats
+{
+    // Time spent parsing the trace, or mapping its bytecode, before SetupReplay runs. The binary
+    // data is loaded while parsing, and by SetupReplay when running bytecode.
+    double loadTimeSeconds     = 0.0;
+    // Time the bytecode interpreter spends decoding and dispatching a call.
+    double callOverheadNs      = 0.0;
+    // Calls made by the bytecode interpreter.
+    uint64_t replayedCallCount = 0;
+};
+
 // Test suite calls into the trace library (fixture).
 struct TraceFunctions
 {
@@ -74,6 +86,7 @@ struct TraceFunctions
     virtual void SetBinaryDataDir(const char *dataDir)                        = 0;
     virtual void SetReplayResourceMode(const ReplayResourceMode resourceMode) = 0;
     virtual void SetTraceGzPath(const std::string &traceGzPath)               = 0;
+    virtual void SetTraceBytecodePath(const std::string &traceBytecodePath)   = 0;
     virtual void SetTraceInfo(const TraceInfo &traceInfo)                     = 0;
 
     virtual ~TraceFunctions() {}
@@ -83,6 +96,8 @@ struct TraceFunctions
 struct TraceCallbacks
 {
     virtual uint8_t *LoadBinaryData(const char *fileName) = 0;
+    // Size of the data returned by the last LoadBinaryData.
+    virtual size_t GetBinaryDataSize() const = 0;
     virtual FrameCaptureBinaryData *ConfigureBinaryDataLoader(const char *fileName) = 0;
     virtual ~TraceCallbacks() {}
 };
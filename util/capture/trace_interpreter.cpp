@@ -16,6 +16,8 @@
 #include "anglebase/no_destructor.h"
 #include "common/gl_enum_utils.h"
 #include "common/string_utils.h"
+#include "common/system_utils.h"
+#include "trace_bytecode.h"
 #include "trace_fixture.h"
 
 #define USE_SYSTEM_ZLIB
@@ -44,10 +46,12 @@ class Parser : angle::NonCopyable
     Parser(const std::string &stream,
            TraceFunctionMap &functionsIn,
            TraceStringMap &stringsIn,
+           TraceBytecodeWriter *bytecodeWriter,
            bool verboseLogging)
         : mStream(stream),
           mFunctions(functionsIn),
           mStrings(stringsIn),
+          mBytecodeWriter(bytecodeWriter),
           mIndex(0),
           mVerboseLogging(verboseLogging)
     {}
@@ -214,6 +218,11 @@ class Parser : angle::NonCopyable
             return;
         }
 
+        if (mBytecodeWriter)
+        {
+            mBytecodeWriter->beginFunction(funcName);
+        }
+
         skipLine();
         ASSERT(peek() == '{');
         skipLine();
@@ -269,6 +278,10 @@ class Parser : angle::NonCopyable
 
             // We pass in the strings for specific use with C string array parameters.
             CallCapture call = ParseCallCapture(nameToken, numParams, paramTokens, mStrings);
+            if (mBytecodeWriter)
+            {
+                mBytecodeWriter->addCall(call, paramTokens);
+            }
             func.push_back(std::move(call));
             skipLine();
         }
@@ -313,6 +326,11 @@ class Parser : angle::NonCopyable
             traceStr.pointers.push_back(cppstr.c_str());
         }
 
+        if (mBytecodeWriter)
+        {
+            mBytecodeWriter->addStringArray(name, traceStr);
+        }
+
         mStrings[name] = std::move(traceStr);
     }
 
@@ -330,6 +348,7 @@ class Parser : angle::NonCopyable
     const std::string &mStream;
     TraceFunctionMap &mFunctions;
     TraceStringMap &mStrings;
+    TraceBytecodeWriter *mBytecodeWriter;
     size_t mIndex;
     bool mVerboseLogging = false;
 };
@@ -523,13 +542,21 @@ class TraceInterpreter : angle::NonCopyable
     void setupFirstFrame();
     const char *getSerializedContextState(uint32_t frameIndex);
 
+    bool compileBytecode(const char *outputPath);
+    void getStats(TraceInterpreterStats *statsOut) const;
+
   private:
-    void runTraceFunction(const char *name) const;
-    void parseTraceUncompressed();
-    void parseTraceGz();
+    bool hasTraceFunction(const char *name) const;
+    void runTraceFunction(const char *name);
+    void parseTrace(TraceBytecodeWriter *bytecodeWriter);
+    void parseTraceUncompressed(TraceBytecodeWriter *bytecodeWriter);
+    void parseTraceGz(TraceBytecodeWriter *bytecodeWriter);
+    void loadBytecode();
 
     TraceFunctionMap mTraceFunctions;
     TraceStringMap mTraceStrings;
+    std::unique_ptr<TraceBytecode> mBytecode;
+    TraceInterpreterStats mStats;
     bool mVerboseLogging = true;
 };
 
@@ -540,7 +567,19 @@ void TraceInterpreter::replayFrame(uint32_t frameIndex)
     runTraceFunction(funcName);
 }
 
-void TraceInterpreter::parseTraceUncompressed()
+void TraceInterpreter::parseTrace(TraceBytecodeWriter *bytecodeWriter)
+{
+    if (!gTraceGzPath.empty())
+    {
+        parseTraceGz(bytecodeWriter);
+    }
+    else
+    {
+        parseTraceUncompressed(bytecodeWriter);
+    }
+}
+
+void TraceInterpreter::parseTraceUncompressed(TraceBytecodeWriter *bytecodeWriter)
 {
     for (const std::string &file : gTraceInfo.traceFiles)
     {
@@ -567,12 +606,12 @@ void TraceInterpreter::parseTraceUncompressed()
             UNREACHABLE();
         }
 
-        Parser parser(fileData, mTraceFunctions, mTraceStrings, mVerboseLogging);
+        Parser parser(fileData, mTraceFunctions, mTraceStrings, bytecodeWriter, mVerboseLogging);
         parser.parse();
     }
 }
 
-void TraceInterpreter::parseTraceGz()
+void TraceInterpreter::parseTraceGz(TraceBytecodeWriter *bytecodeWriter)
 {
     if (mVerboseLogging)
     {
@@ -608,25 +647,52 @@ void TraceInterpreter::parseTraceGz()
         exit(1);
     }
 
-    Parser parser(uncompressedData, mTraceFunctions, mTraceStrings, mVerboseLogging);
+    Parser parser(uncompressedData, mTraceFunctions, mTraceStrings, bytecodeWriter,
+                  mVerboseLogging);
     parser.parse();
 }
 
+void TraceInterpreter::loadBytecode()
+{
+    if (mVerboseLogging)
+    {
+        printf("Loading bytecode from %s\n", gTraceBytecodePath.c_str());
+    }
+
+    mBytecode = std::make_unique<TraceBytecode>();
+    if (!mBytecode->load(gTraceBytecodePath))
+    {
+        exit(1);
+    }
+}
+
 void TraceInterpreter::setupReplay()
 {
-    if (!gTraceGzPath.empty())
+    double startTime = GetCurrentSystemTime();
+    if (!gTraceBytecodePath.empty())
     {
-        parseTraceGz();
+        loadBytecode();
     }
     else
     {
-        parseTraceUncompressed();
+        parseTrace(nullptr);
+    }
+    mStats.loadTimeSeconds = GetCurrentSystemTime() - startTime;
+
+    if (mBytecode)
+    {
+        mStats.callOverheadNs = mBytecode->measureCallOverheadNs();
+    }
+
+    if (mVerboseLogging)
+    {
+        printf("Loaded trace in %.3f seconds, %.1f ns of overhead per call.\n",
+               mStats.loadTimeSeconds, mStats.callOverheadNs);
     }
 
-    if (mTraceFunctions.count("SetupReplay") == 0)
+    if (!hasTraceFunction("SetupReplay"))
     {
-        printf("Did not find a SetupReplay function to run among %zu parsed functions.\n",
-               mTraceFunctions.size());
+        printf("Did not find a SetupReplay function to run among the parsed functions.\n");
         exit(1);
     }
 
@@ -650,8 +716,32 @@ const char *TraceInterpreter::getSerializedContextState(uint32_t frameIndex)
     return nullptr;
 }
 
-void TraceInterpreter::runTraceFunction(const char *name) const
+bool TraceInterpreter::compileBytecode(const char *outputPath)
 {
+    TraceBytecodeWriter bytecodeWriter;
+    parseTrace(&bytecodeWriter);
+    return bytecodeWriter.save(outputPath);
+}
+
+void TraceInterpreter::getStats(TraceInterpreterStats *statsOut) const
+{
+    *statsOut                   = mStats;
+    statsOut->replayedCallCount = mBytecode ? mBytecode->getReplayedCallCount() : 0;
+}
+
+bool TraceInterpreter::hasTraceFunction(const char *name) const
+{
+    return mBytecode ? mBytecode->hasFunction(name) : mTraceFunctions.count(name) != 0;
+}
+
+void TraceInterpreter::runTraceFunction(const char *name)
+{
+    if (mBytecode)
+    {
+        mBytecode->replayFunction(name);
+        return;
+    }
+
     auto iter = mTraceFunctions.find(name);
     if (iter == mTraceFunctions.end())
     {
@@ -1084,4 +1174,14 @@ const char *GetSerializedContextState(uint32_t frameIndex)
 {
     return angle::GetInterpreter().getSerializedContextState(frameIndex);
 }
+
+bool CompileTraceBytecode(const char *outputPath)
+{
+    return angle::GetInterpreter().compileBytecode(outputPath);
+}
+
+void GetTraceInterpreterStats(angle::TraceInterpreterStats *statsOut)
+{
+    angle::GetInterpreter().getStats(statsOut);
+}
 }  // extern "C"
@@ -306,6 +306,10 @@ void ReplayFrame(uint32_t frameIndex);
 void ResetReplay();
 void SetupFirstFrame();
 ANGLE_REPLAY_EXPORT const char *GetSerializedContextState(uint32_t frameIndex);
+// Parses the trace and writes it as bytecode, which is replayed instead of the trace when
+// SetTraceBytecodePath is called.
+ANGLE_REPLAY_EXPORT bool CompileTraceBytecode(const char *outputPath);
+ANGLE_REPLAY_EXPORT void GetTraceInterpreterStats(angle::TraceInterpreterStats *statsOut);
 }  // extern "C"
 
 #endif  // ANGLE_TRACE_INTERPRETER_H_